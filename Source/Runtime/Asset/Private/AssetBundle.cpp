@@ -1,34 +1,39 @@
 #include "Asset/AssetBundle.h"
 
+#include "BundleCompression.h"
+#include "Jobs/Parallel.h"
+#include "Threading/Atomic.h"
 #include "Types/Traits.h"
 #include "Types/NumericProperties.h"
-#include "Utility/Filesystem/Path.h"
-#include "Utility/String/CodeConvert.h"
+
+#include <cstring>
 
 namespace AltinaEngine::Asset {
     namespace {
-        auto ToUtf8Path(const FString& value) -> Container::FNativeString {
-            const Core::Utility::Filesystem::FPath path(value);
-            return Core::Utility::String::ToUtf8Bytes(path.GetString());
-        }
-
-        auto ReadExact(std::ifstream& stream, void* outBuffer, usize size) -> bool {
-            if (outBuffer == nullptr || size == 0U) {
-                return false;
+        auto ReadUuid(const FBundleIndexEntry& entry) noexcept -> FUuid {
+            FUuid::FBytes bytes{};
+            for (usize index = 0; index < FUuid::kByteCount; ++index) {
+                bytes[index] = entry.mUuid[index];
             }
-
-            stream.read(reinterpret_cast<char*>(outBuffer), static_cast<std::streamsize>(size));
-            return static_cast<usize>(stream.gcount()) == size;
+            return FUuid(bytes);
         }
 
-        auto UuidMatches(const FBundleIndexEntry& entry, const FUuid& uuid) noexcept -> bool {
+        void WriteUuid(FBundleIndexEntry& entry, const FUuid& uuid) noexcept {
             const auto& bytes = uuid.GetBytes();
             for (usize index = 0; index < FUuid::kByteCount; ++index) {
-                if (entry.mUuid[index] != bytes[index]) {
-                    return false;
-                }
+                entry.mUuid[index] = bytes[index];
             }
-            return true;
+        }
+
+        // True if [offset, offset + size) lies within [0, limit), without overflowing.
+        auto IsRangeWithin(u64 offset, u64 size, u64 limit) noexcept -> bool {
+            return offset <= limit && size <= limit - offset;
+        }
+
+        template <typename T> void AppendPod(TVector<u8>& bytes, const T& value) {
+            const usize offset = bytes.Size();
+            bytes.Resize(offset + sizeof(T));
+            std::memcpy(bytes.Data() + offset, &value, sizeof(T));
         }
     } // namespace
 
@@ -37,22 +42,13 @@ namespace AltinaEngine::Asset {
     auto FAssetBundleReader::Open(const FString& path) -> bool {
         Close();
 
-        const auto utf8Path = ToUtf8Path(path);
-        mFile.open(utf8Path.CStr(), std::ios::binary);
-        if (!mFile) {
-            return false;
-        }
-
-        mFile.seekg(0, std::ios::end);
-        const auto endPos = mFile.tellg();
-        if (endPos < 0) {
-            Close();
+        mFile = Core::Platform::OpenFileForRead(path);
+        if (mFile == nullptr) {
             return false;
         }
-        mFileSize = static_cast<u64>(endPos);
-        mFile.seekg(0, std::ios::beg);
+        mFileSize = Core::Platform::GetFileSize(mFile);
 
-        if (!ReadExact(mFile, &mHeader, sizeof(FBundleHeader))) {
+        if (!Core::Platform::ReadFileAt(mFile, 0U, &mHeader, sizeof(FBundleHeader))) {
             Close();
             return false;
         }
@@ -70,22 +66,27 @@ namespace AltinaEngine::Asset {
             return false;
         }
 
-        if (mHeader.mIndexOffset == 0U || mHeader.mIndexSize == 0U) {
+        if (mHeader.mIndexOffset == 0U || mHeader.mIndexSize < sizeof(FBundleIndexHeader)) {
             Close();
             return false;
         }
-        if (mHeader.mIndexOffset + mHeader.mIndexSize > mHeader.mBundleSize) {
+        if (!IsRangeWithin(mHeader.mIndexOffset, mHeader.mIndexSize, mHeader.mBundleSize)
+            || mHeader.mIndexSize > static_cast<u64>(TNumericProperty<u32>::Max)) {
             Close();
             return false;
         }
 
-        mFile.seekg(static_cast<std::streamoff>(mHeader.mIndexOffset), std::ios::beg);
-        FBundleIndexHeader indexHeader{};
-        if (!ReadExact(mFile, &indexHeader, sizeof(FBundleIndexHeader))) {
+        // One read for the index header, the entries and the chunk tables.
+        mIndexData.Resize(static_cast<usize>(mHeader.mIndexSize));
+        if (!Core::Platform::ReadFileAt(
+                mFile, mHeader.mIndexOffset, mIndexData.Data(), mIndexData.Size())) {
             Close();
             return false;
         }
 
+        FBundleIndexHeader indexHeader{};
+        std::memcpy(&indexHeader, mIndexData.Data(), sizeof(FBundleIndexHeader));
+
         const u64 entryBytes =
             static_cast<u64>(indexHeader.mEntryCount) * sizeof(FBundleIndexEntry);
         if (sizeof(FBundleIndexHeader) + entryBytes > mHeader.mIndexSize) {
@@ -93,70 +94,301 @@ namespace AltinaEngine::Asset {
             return false;
         }
 
-        mEntries.Clear();
+        mEntries.Resize(static_cast<usize>(indexHeader.mEntryCount));
         if (indexHeader.mEntryCount > 0U) {
-            mEntries.Resize(static_cast<usize>(indexHeader.mEntryCount));
-            if (!ReadExact(mFile, mEntries.Data(), static_cast<usize>(entryBytes))) {
-                Close();
-                return false;
-            }
+            std::memcpy(mEntries.Data(), mIndexData.Data() + sizeof(FBundleIndexHeader),
+                static_cast<usize>(entryBytes));
         }
 
-        mFile.clear();
+        mEntryByUuid.Reserve(mEntries.Size());
+        for (usize index = 0; index < mEntries.Size(); ++index) {
+            // The first entry wins for duplicate UUIDs, as with the former linear search.
+            mEntryByUuid.TryEmplace(ReadUuid(mEntries[index]), static_cast<u32>(index));
+        }
+
+        // Mapping is an optimization only; positional reads keep working without it.
+        if (!Core::Platform::MapFile(mFile, mMapping)) {
+            mMapping = {};
+        }
         return true;
     }
 
     void FAssetBundleReader::Close() {
-        if (mFile.is_open()) {
-            mFile.close();
+        Core::Platform::UnmapFile(mMapping);
+        if (mFile != nullptr) {
+            Core::Platform::CloseFile(mFile);
+            mFile = nullptr;
         }
         mEntries.Clear();
+        mEntryByUuid.Clear();
+        mIndexData.Clear();
         mHeader   = {};
         mFileSize = 0U;
     }
 
-    auto FAssetBundleReader::IsOpen() const noexcept -> bool { return mFile.is_open(); }
+    auto FAssetBundleReader::IsOpen() const noexcept -> bool { return mFile != nullptr; }
 
     auto FAssetBundleReader::GetEntry(const FUuid& uuid, FBundleIndexEntry& outEntry) const noexcept
         -> bool {
-        for (const auto& entry : mEntries) {
-            if (UuidMatches(entry, uuid)) {
-                outEntry = entry;
-                return true;
-            }
+        const u32* index = mEntryByUuid.Find(uuid);
+        if (index == nullptr) {
+            return false;
+        }
+        outEntry = mEntries[*index];
+        return true;
+    }
+
+    auto FAssetBundleReader::GetEntryData(const FBundleIndexEntry& entry) const noexcept
+        -> const u8* {
+        if (mMapping.mData == nullptr || entry.mChunkCount != 0U || entry.mSize == 0U
+            || entry.mCompression != static_cast<u32>(EBundleCompression::None)) {
+            return nullptr;
+        }
+        if (!IsRangeWithin(entry.mOffset, entry.mSize, mHeader.mBundleSize)
+            || mHeader.mBundleSize > mMapping.mSize) {
+            return nullptr;
+        }
+        return mMapping.mData + entry.mOffset;
+    }
+
+    auto FAssetBundleReader::ReadChunk(const FBundleIndexEntry& entry,
+        const FBundleChunkDesc& chunk, u8* dst, TVector<u8>& scratch) const -> bool {
+        if (chunk.Size == chunk.RawSize) {
+            return Core::Platform::ReadFileAt(
+                mFile, chunk.Offset, dst, static_cast<usize>(chunk.Size));
+        }
+        scratch.Resize(static_cast<usize>(chunk.Size));
+        if (!Core::Platform::ReadFileAt(mFile, chunk.Offset, scratch.Data(), scratch.Size())) {
+            return false;
         }
-        return false;
+        return Detail::DecompressBlock(static_cast<EBundleCompression>(entry.mCompression),
+            scratch.Data(), scratch.Size(), dst, static_cast<usize>(chunk.RawSize));
     }
 
     auto FAssetBundleReader::ReadEntry(const FBundleIndexEntry& entry, TVector<u8>& outBytes) const
         -> bool {
         outBytes.Clear();
-        if (!mFile.is_open()) {
+        if (mFile == nullptr) {
             return false;
         }
 
-        if (entry.mCompression != static_cast<u32>(EBundleCompression::None)) {
+        const auto compression = static_cast<EBundleCompression>(entry.mCompression);
+        if (!Detail::IsCompressionSupported(compression)) {
             return false;
         }
-        if (entry.mChunkCount != 0U) {
+        if (!IsRangeWithin(entry.mOffset, entry.mSize, mHeader.mBundleSize)) {
             return false;
         }
-        if (entry.mOffset + entry.mSize > mHeader.mBundleSize) {
+        if (entry.mSize > static_cast<u64>(TNumericProperty<usize>::Max)
+            || entry.mRawSize > static_cast<u64>(TNumericProperty<usize>::Max)) {
             return false;
         }
-        if (entry.mSize > static_cast<u64>(TNumericProperty<usize>::Max)) {
+
+        if (entry.mChunkCount == 0U && compression == EBundleCompression::None) {
+            if (entry.mSize == 0U) {
+                return false;
+            }
+            outBytes.Resize(static_cast<usize>(entry.mSize));
+            if (!Core::Platform::ReadFileAt(
+                    mFile, entry.mOffset, outBytes.Data(), outBytes.Size())) {
+                outBytes.Clear();
+                return false;
+            }
+            return true;
+        }
+
+        // An unchunked compressed entry is decoded as a single chunk.
+        TVector<FBundleChunkDesc> chunks;
+        if (entry.mChunkCount == 0U) {
+            chunks.PushBack({ entry.mOffset, entry.mSize, entry.mRawSize });
+        } else {
+            const u64 tableBytes = static_cast<u64>(entry.mChunkCount) * sizeof(FBundleChunkDesc);
+            if (!IsRangeWithin(entry.mChunkTableOffset, tableBytes, mIndexData.Size())) {
+                return false;
+            }
+            chunks.Resize(entry.mChunkCount);
+            std::memcpy(chunks.Data(), mIndexData.Data() + entry.mChunkTableOffset,
+                static_cast<usize>(tableBytes));
+        }
+
+        // Validate the whole table up front so that the decode jobs cannot fail on layout.
+        TVector<usize> rawOffsets;
+        rawOffsets.Resize(chunks.Size());
+        u64 rawTotal = 0U;
+        for (usize index = 0; index < chunks.Size(); ++index) {
+            const FBundleChunkDesc& chunk = chunks[index];
+            if (!IsRangeWithin(chunk.Offset, chunk.Size, mHeader.mBundleSize)
+                || chunk.Size == 0U || chunk.RawSize > entry.mRawSize - rawTotal) {
+                return false;
+            }
+            rawOffsets[index] = static_cast<usize>(rawTotal);
+            rawTotal += chunk.RawSize;
+        }
+        if (rawTotal != entry.mRawSize || rawTotal == 0U) {
             return false;
         }
 
-        outBytes.Resize(static_cast<usize>(entry.mSize));
-        mFile.clear();
-        mFile.seekg(static_cast<std::streamoff>(entry.mOffset), std::ios::beg);
-        if (!ReadExact(mFile, outBytes.Data(), static_cast<usize>(entry.mSize))) {
+        outBytes.Resize(static_cast<usize>(rawTotal));
+        bool ok = true;
+        if (chunks.Size() == 1U) {
+            TVector<u8> scratch;
+            ok = ReadChunk(entry, chunks[0], outBytes.Data(), scratch);
+        } else {
+            Core::Threading::TAtomic<u32> failed;
+            Core::Jobs::ParallelForRange(chunks.Size(), 1U, [&](usize begin, usize end) -> void {
+                TVector<u8> scratch;
+                for (usize index = begin; index < end; ++index) {
+                    if (failed.Load() != 0U) {
+                        return;
+                    }
+                    if (!ReadChunk(entry, chunks[index], outBytes.Data() + rawOffsets[index],
+                            scratch)) {
+                        failed.Store(1U);
+                    }
+                }
+            });
+            ok = failed.Load() == 0U;
+        }
+
+        if (!ok) {
             outBytes.Clear();
+        }
+        return ok;
+    }
+
+    FAssetBundleWriter::FAssetBundleWriter(EBundleCompression compression, u32 chunkSize) noexcept
+        : mCompression(compression), mChunkSize(chunkSize > 0U ? chunkSize : kDefaultChunkSize) {}
+
+    auto FAssetBundleWriter::AddEntry(const FUuid& uuid, EAssetType type, const u8* data,
+        usize size) -> bool {
+        if (data == nullptr || size == 0U || !Detail::IsCompressionSupported(mCompression)) {
+            return false;
+        }
+        if (mEntryByUuid.Find(uuid) != nullptr) {
             return false;
         }
 
+        FPendingEntry pending{};
+        WriteUuid(pending.mEntry, uuid);
+        pending.mEntry.mType    = static_cast<u32>(type);
+        pending.mEntry.mRawSize = static_cast<u64>(size);
+
+        bool anyCompressed = false;
+        if (mCompression != EBundleCompression::None) {
+            const usize chunkCount = (size + mChunkSize - 1U) / mChunkSize;
+            TVector<TVector<u8>> compressed;
+            compressed.Resize(chunkCount);
+            Core::Jobs::ParallelFor(chunkCount, 1U, [&](usize index) -> void {
+                const usize  begin = index * mChunkSize;
+                const usize  count = (size - begin < mChunkSize) ? size - begin : mChunkSize;
+                TVector<u8>& out   = compressed[index];
+                out.Resize(Detail::GetCompressBound(mCompression, count));
+                const usize written = Detail::CompressBlock(
+                    mCompression, data + begin, count, out.Data(), out.Size());
+                // Keep the chunk raw unless it actually shrank.
+                if (written == 0U || written >= count) {
+                    out.Resize(count);
+                    std::memcpy(out.Data(), data + begin, count);
+                } else {
+                    out.Resize(written);
+                }
+            });
+
+            usize rawOffset = 0U;
+            for (usize index = 0; index < chunkCount; ++index) {
+                const usize rawSize = (size - rawOffset < mChunkSize) ? size - rawOffset
+                                                                      : mChunkSize;
+                FBundleChunkDesc chunk{};
+                chunk.Offset  = static_cast<u64>(pending.mPayload.Size());
+                chunk.Size    = static_cast<u64>(compressed[index].Size());
+                chunk.RawSize = static_cast<u64>(rawSize);
+                anyCompressed = anyCompressed || chunk.Size != chunk.RawSize;
+                pending.mChunks.PushBack(chunk);
+
+                const usize offset = pending.mPayload.Size();
+                pending.mPayload.Resize(offset + compressed[index].Size());
+                std::memcpy(pending.mPayload.Data() + offset, compressed[index].Data(),
+                    compressed[index].Size());
+                rawOffset += rawSize;
+            }
+        }
+
+        if (anyCompressed) {
+            pending.mEntry.mCompression = static_cast<u32>(mCompression);
+            pending.mEntry.mChunkCount  = static_cast<u32>(pending.mChunks.Size());
+        } else {
+            // Nothing shrank: store the entry plainly so readers can use it without decoding.
+            pending.mChunks.Clear();
+            pending.mPayload.Resize(size);
+            std::memcpy(pending.mPayload.Data(), data, size);
+            pending.mEntry.mCompression = static_cast<u32>(EBundleCompression::None);
+        }
+        pending.mEntry.mSize = static_cast<u64>(pending.mPayload.Size());
+
+        mPayloadSize += pending.mEntry.mSize;
+        mEntryByUuid.InsertOrAssign(uuid, static_cast<u32>(mEntries.Size()));
+        mEntries.PushBack(Move(pending));
         return true;
     }
 
+    void FAssetBundleWriter::Build(TVector<u8>& outBytes) const {
+        outBytes.Clear();
+
+        // Layout: header, payloads, then the index block (index header, entries, chunk tables).
+        FBundleHeader header{};
+        AppendPod(outBytes, header);
+
+        TVector<FBundleIndexEntry> entries;
+        entries.Reserve(mEntries.Size());
+        u64 chunkCount = 0U;
+        for (const FPendingEntry& pending : mEntries) {
+            FBundleIndexEntry entry = pending.mEntry;
+            entry.mOffset           = static_cast<u64>(outBytes.Size());
+            entries.PushBack(entry);
+            chunkCount += pending.mChunks.Size();
+
+            const usize offset = outBytes.Size();
+            outBytes.Resize(offset + pending.mPayload.Size());
+            std::memcpy(outBytes.Data() + offset, pending.mPayload.Data(), pending.mPayload.Size());
+        }
+
+        const u64          indexOffset = static_cast<u64>(outBytes.Size());
+        FBundleIndexHeader indexHeader{};
+        indexHeader.mEntryCount = static_cast<u32>(entries.Size());
+        AppendPod(outBytes, indexHeader);
+
+        u64 tableOffset = sizeof(FBundleIndexHeader)
+            + static_cast<u64>(entries.Size()) * sizeof(FBundleIndexEntry);
+        for (usize index = 0; index < entries.Size(); ++index) {
+            if (entries[index].mChunkCount != 0U) {
+                entries[index].mChunkTableOffset = static_cast<u32>(tableOffset);
+                tableOffset += static_cast<u64>(entries[index].mChunkCount)
+                    * sizeof(FBundleChunkDesc);
+            }
+            AppendPod(outBytes, entries[index]);
+        }
+        for (usize index = 0; index < entries.Size(); ++index) {
+            for (const FBundleChunkDesc& pendingChunk : mEntries[index].mChunks) {
+                FBundleChunkDesc chunk = pendingChunk;
+                chunk.Offset += entries[index].mOffset;
+                AppendPod(outBytes, chunk);
+            }
+        }
+
+        header.mIndexOffset = indexOffset;
+        header.mIndexSize   = static_cast<u64>(outBytes.Size()) - indexOffset;
+        header.mBundleSize  = static_cast<u64>(outBytes.Size());
+        if (chunkCount > 0U) {
+            header.mFlags = static_cast<u16>(static_cast<u16>(EBundleFlags::HasChunks)
+                | static_cast<u16>(EBundleFlags::HasCompression));
+        }
+        std::memcpy(outBytes.Data(), &header, sizeof(header));
+    }
+
+    auto FAssetBundleWriter::WriteToFile(const FString& path) const -> bool {
+        TVector<u8> bytes;
+        Build(bytes);
+        return Core::Platform::WriteFileBytes(path, bytes.Data(), bytes.Size());
+    }
+
 } // namespace AltinaEngine::Asset
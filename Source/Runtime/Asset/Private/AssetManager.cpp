@@ -1,21 +1,29 @@
 #include "Asset/AssetManager.h"
 
+#include "Jobs/JobSystem.h"
 #include "Platform/PlatformFileSystem.h"
+#include "Platform/PlatformMemory.h"
+#include "Threading/Atomic.h"
 #include <cstring>
 
 namespace AltinaEngine::Asset {
     namespace Container = Core::Container;
+    using Container::MakeShared;
     using Container::TVector;
+    using Core::Platform::EMemoryTag;
+    using Core::Platform::FScopedMemoryTag;
     using Core::Platform::ReadFileBytes;
+    using Core::Threading::FScopedLock;
 
     namespace {
+        // Views bytes owned elsewhere: a file read into memory, or an entry of a mapped bundle.
         class FMemoryAssetStream final : public IAssetStream {
         public:
-            explicit FMemoryAssetStream(const TVector<u8>& data)
-                : mData(data.Data()), mSize(data.Size()) {}
+            FMemoryAssetStream(const u8* data, usize size) : mData(data), mSize(size) {}
 
             [[nodiscard]] auto Size() const noexcept -> usize override { return mSize; }
             [[nodiscard]] auto Tell() const noexcept -> usize override { return mOffset; }
+            [[nodiscard]] auto GetData() const noexcept -> const u8* override { return mData; }
 
             void               Seek(usize offset) noexcept override {
                 mOffset = (offset > mSize) ? mSize : offset;
@@ -43,14 +51,146 @@ namespace AltinaEngine::Asset {
             usize     mOffset = 0;
         };
 
-        auto HandlesMatch(const FAssetHandle& left, const FAssetHandle& right) -> bool {
-            return left.mUuid == right.mUuid && left.mType == right.mType;
+        // A blocking Load() of an asset that is still queued jumps ahead of everything else.
+        constexpr i32 kBlockingLoadPriority = 0x7fffffff;
+
+        auto ReadAndDecode(const FAssetDesc& desc, IAssetLoader& loader,
+            const FAssetBundleReader* bundle) -> TShared<IAsset> {
+            FScopedMemoryTag  memoryTag(EMemoryTag::Asset);
+            TVector<u8>       bytes;
+            FBundleIndexEntry entry{};
+            if (bundle != nullptr && bundle->GetEntry(desc.mHandle.mUuid, entry)) {
+                // Uncompressed entries are decoded in place from the mapped bundle.
+                if (const u8* data = bundle->GetEntryData(entry)) {
+                    FMemoryAssetStream stream(data, static_cast<usize>(entry.mSize));
+                    return loader.Load(desc, stream);
+                }
+                if (!bundle->ReadEntry(entry, bytes)) {
+                    return {};
+                }
+            } else if (!desc.mCookedPath.IsEmptyString()) {
+                if (!ReadFileBytes(desc.mCookedPath, bytes)) {
+                    return {};
+                }
+            } else if (desc.mHandle.mType != EAssetType::Script) {
+                return {};
+            }
+
+            FMemoryAssetStream stream(bytes.Data(), bytes.Size());
+            return loader.Load(desc, stream);
         }
     } // namespace
 
+    // Scheduling fields are guarded by the owning manager's mutex. FAssetLoadHandle reads
+    // `mState` without it; `mAsset` is written before the state turns final.
+    struct FAssetLoadRequest {
+        FAssetManager*                      mOwner = nullptr;
+        FAssetHandle                        mHandle;
+        const FAssetDesc*                   mDesc                = nullptr;
+        IAssetLoader*                       mLoader              = nullptr;
+        const FAssetBundleReader*           mBundle              = nullptr;
+        i32                                 mPriority            = 0;
+        u64                                 mSequence            = 0ULL;
+        u32                                 mPendingDependencies = 0U;
+        // Blocking Load() calls waiting on this request; a pinned request is never cancelled.
+        u32                                 mBlockingWaiters   = 0U;
+        bool                                mRequestedDirectly = false;
+        TVector<TShared<FAssetLoadRequest>> mDependencies;
+        TVector<TShared<FAssetLoadRequest>> mDependents;
+        Core::Threading::TAtomic<u32>       mState;
+        TShared<IAsset>                     mAsset;
+        Core::Jobs::FWaitGroup              mDone;
+
+        [[nodiscard]] auto                  GetState() const noexcept -> EAssetLoadState {
+            return static_cast<EAssetLoadState>(mState.Load());
+        }
+        [[nodiscard]] auto IsPending() const noexcept -> bool {
+            return GetState() == EAssetLoadState::Pending;
+        }
+        [[nodiscard]] auto IsInFlight() const noexcept -> bool {
+            const EAssetLoadState state = GetState();
+            return state == EAssetLoadState::Pending || state == EAssetLoadState::Loading;
+        }
+        void SetState(EAssetLoadState state) noexcept { mState.Store(static_cast<u32>(state)); }
+    };
+
+    namespace {
+        auto MakeFinishedRequest(const FAssetHandle& handle, TShared<IAsset> asset)
+            -> TShared<FAssetLoadRequest> {
+            auto request     = MakeShared<FAssetLoadRequest>();
+            request->mHandle = handle;
+            request->mAsset  = Move(asset);
+            request->SetState(request->mAsset ? EAssetLoadState::Loaded : EAssetLoadState::Failed);
+            return request;
+        }
+
+        void RemoveRequest(
+            TVector<TShared<FAssetLoadRequest>>& requests, const FAssetLoadRequest* request) {
+            for (usize index = 0; index < requests.Size(); ++index) {
+                if (requests[index].Get() == request) {
+                    const usize lastIndex = requests.Size() - 1;
+                    if (index != lastIndex) {
+                        requests[index] = Move(requests[lastIndex]);
+                    }
+                    requests.PopBack();
+                    return;
+                }
+            }
+        }
+    } // namespace
+
+    FAssetLoadHandle::FAssetLoadHandle(TShared<FAssetLoadRequest> request) noexcept
+        : mRequest(Move(request)) {}
+
+    auto FAssetLoadHandle::IsValid() const noexcept -> bool { return static_cast<bool>(mRequest); }
+
+    auto FAssetLoadHandle::GetAssetHandle() const noexcept -> FAssetHandle {
+        return mRequest ? mRequest->mHandle : FAssetHandle{};
+    }
+
+    auto FAssetLoadHandle::GetState() const noexcept -> EAssetLoadState {
+        return mRequest ? mRequest->GetState() : EAssetLoadState::Failed;
+    }
+
+    auto FAssetLoadHandle::IsDone() const noexcept -> bool {
+        return !mRequest || !mRequest->IsInFlight();
+    }
+
+    void FAssetLoadHandle::Wait() const noexcept {
+        if (mRequest) {
+            mRequest->mDone.Wait();
+        }
+    }
+
+    auto FAssetLoadHandle::Get() const -> TShared<IAsset> {
+        if (!mRequest) {
+            return {};
+        }
+        mRequest->mDone.Wait();
+        return mRequest->mAsset;
+    }
+
+    auto FAssetLoadHandle::Cancel() -> bool {
+        // Finished requests may outlive their manager; only reach for it while still pending.
+        if (!mRequest || !mRequest->IsPending() || mRequest->mOwner == nullptr) {
+            return false;
+        }
+        return mRequest->mOwner->CancelRequest(mRequest);
+    }
+
+    void FAssetLoadHandle::SetPriority(i32 priority) {
+        if (!mRequest || !mRequest->IsPending() || mRequest->mOwner == nullptr) {
+            return;
+        }
+        mRequest->mOwner->SetRequestPriority(mRequest, priority);
+    }
+
     FAssetManager::FAssetManager() = default;
 
+    FAssetManager::~FAssetManager() { FlushAsyncLoads(); }
+
     void FAssetManager::SetRegistry(const FAssetRegistry* registry) noexcept {
+        FScopedLock lock(mMutex);
         mRegistry = registry;
     }
 
@@ -59,10 +199,12 @@ namespace AltinaEngine::Asset {
             return;
         }
 
+        FScopedLock lock(mMutex);
         mLoaders.PushBack(loader);
     }
 
     void FAssetManager::UnregisterLoader(IAssetLoader* loader) {
+        FScopedLock lock(mMutex);
         if (loader == nullptr || mLoaders.IsEmpty()) {
             return;
         }
@@ -79,71 +221,144 @@ namespace AltinaEngine::Asset {
         }
     }
 
-    auto FAssetManager::Load(const FAssetHandle& handle) -> TShared<IAsset> {
-        if (mRegistry == nullptr || !handle.IsValid()) {
-            return {};
-        }
-
-        const FAssetHandle resolved = mRegistry->ResolveRedirector(handle);
-        if (!resolved.IsValid()) {
-            return {};
+    void FAssetManager::RegisterBundle(const FAssetBundleReader* bundle) {
+        if (bundle == nullptr || !bundle->IsOpen()) {
+            return;
         }
 
-        if (TShared<IAsset> cached = FindLoaded(resolved)) {
-            return cached;
-        }
+        FScopedLock lock(mMutex);
+        mBundles.PushBack(bundle);
+    }
 
-        const FAssetDesc* desc = mRegistry->GetDesc(resolved);
-        if (desc == nullptr) {
-            return {};
+    void FAssetManager::UnregisterBundle(const FAssetBundleReader* bundle) {
+        FScopedLock lock(mMutex);
+        for (usize index = 0; index < mBundles.Size(); ++index) {
+            if (mBundles[index] == bundle) {
+                // Keep the order: later bundles override earlier ones.
+                for (usize next = index + 1U; next < mBundles.Size(); ++next) {
+                    mBundles[next - 1U] = mBundles[next];
+                }
+                mBundles.PopBack();
+                return;
+            }
         }
+    }
 
-        IAssetLoader* loader = FindLoader(desc->mHandle.mType);
-        if (loader == nullptr) {
-            return {};
-        }
+    auto FAssetManager::Load(const FAssetHandle& handle) -> TShared<IAsset> {
+        const FAssetDesc* desc   = nullptr;
+        IAssetLoader*             loader = nullptr;
+        const FAssetBundleReader* bundle = nullptr;
+        FRequestRef               inFlight;
+        {
+            FScopedLock lock(mMutex);
+            if (mRegistry == nullptr || !handle.IsValid()) {
+                return {};
+            }
 
-        TVector<u8> bytes;
-        if (!desc->mCookedPath.IsEmptyString()) {
-            if (!ReadFileBytes(desc->mCookedPath, bytes)) {
+            const FAssetHandle resolved = mRegistry->ResolveRedirector(handle);
+            if (!resolved.IsValid()) {
                 return {};
             }
-        } else if (desc->mHandle.mType != EAssetType::Script) {
-            return {};
+
+            if (TShared<IAsset> cached = FindLoadedLocked(resolved)) {
+                return cached;
+            }
+
+            if (FRequestRef* request = mInFlight.Find(resolved.mUuid)) {
+                inFlight = *request;
+                ++inFlight->mBlockingWaiters;
+                RaisePriorityLocked(*inFlight, kBlockingLoadPriority);
+            } else {
+                desc   = mRegistry->GetDesc(resolved);
+                loader = (desc != nullptr) ? FindLoader(desc->mHandle.mType) : nullptr;
+                if (loader == nullptr) {
+                    return {};
+                }
+                bundle = FindBundleLocked(resolved.mUuid);
+            }
+        }
+
+        // Already queued: wait for that request instead of decoding the asset twice. The pin
+        // keeps a cancelled parent or another handle from dropping it while this call waits.
+        if (inFlight) {
+            TShared<IAsset> asset = FAssetLoadHandle(inFlight).Get();
+            FScopedLock     lock(mMutex);
+            --inFlight->mBlockingWaiters;
+            return asset;
         }
 
-        FMemoryAssetStream stream(bytes);
-        TShared<IAsset>    asset = loader->Load(*desc, stream);
+        TShared<IAsset> asset = ReadAndDecode(*desc, *loader, bundle);
         if (asset) {
-            mCache.PushBack({ resolved, asset });
+            FScopedLock lock(mMutex);
+            auto        result = mCache.TryEmplace(desc->mHandle.mUuid);
+            if (!result.second) {
+                // Another thread finished the same asset first; hand out a single instance.
+                return result.first->second.mAsset;
+            }
+            result.first->second = FCacheEntry{ desc->mHandle, asset };
         }
 
         return asset;
     }
 
-    void FAssetManager::Unload(const FAssetHandle& handle) {
-        const isize index = FindCacheIndex(handle);
-        if (index < 0) {
-            return;
+    auto FAssetManager::LoadAsync(const FAssetHandle& handle, i32 priority) -> FAssetLoadHandle {
+        FRequestRef request;
+        u32         readyCount = 0U;
+        {
+            FScopedLock lock(mMutex);
+            if (mRegistry != nullptr && handle.IsValid()) {
+                TVector<FUuid> visiting;
+                request = EnqueueLocked(handle, priority, visiting, readyCount);
+            }
+            if (request) {
+                request->mRequestedDirectly = true;
+            }
         }
+        SubmitLoadJobs(readyCount);
 
-        const usize lastIndex   = mCache.Size() - 1;
-        const usize removeIndex = static_cast<usize>(index);
-        if (removeIndex != lastIndex) {
-            mCache[removeIndex] = mCache[lastIndex];
+        if (!request) {
+            request = MakeFinishedRequest(handle, {});
         }
-        mCache.PopBack();
+        return FAssetLoadHandle(Move(request));
     }
 
-    void FAssetManager::ClearCache() { mCache.Clear(); }
+    void FAssetManager::FlushAsyncLoads() {
+        {
+            FScopedLock lock(mMutex);
+            // Cancel from the top of the dependency graph down: a request can only be
+            // cancelled once nothing pending depends on it.
+            bool        progressed = true;
+            while (progressed) {
+                progressed = false;
+                TVector<FRequestRef> roots;
+                for (auto& entry : mInFlight) {
+                    if (entry.second->IsPending() && entry.second->mDependents.IsEmpty()) {
+                        roots.PushBack(entry.second);
+                    }
+                }
+                for (auto& root : roots) {
+                    progressed = CancelLocked(root) || progressed;
+                }
+            }
+        }
+        mLoadJobs.Wait();
+    }
 
-    auto FAssetManager::FindLoaded(const FAssetHandle& handle) const -> TShared<IAsset> {
-        const isize index = FindCacheIndex(handle);
-        if (index < 0) {
-            return {};
+    void FAssetManager::Unload(const FAssetHandle& handle) {
+        FScopedLock lock(mMutex);
+        if (FindLoadedLocked(handle)) {
+            mCache.Remove(handle.mUuid);
         }
+    }
+
+    void FAssetManager::ClearCache() {
+        FScopedLock lock(mMutex);
+        mCache.Clear();
+    }
 
-        return mCache[static_cast<usize>(index)].mAsset;
+    auto FAssetManager::FindLoaded(const FAssetHandle& handle) const -> TShared<IAsset> {
+        FScopedLock lock(mMutex);
+        return FindLoadedLocked(handle);
     }
 
     auto FAssetManager::FindLoader(EAssetType type) const noexcept -> IAssetLoader* {
@@ -156,18 +371,230 @@ namespace AltinaEngine::Asset {
         return nullptr;
     }
 
-    auto FAssetManager::FindCacheIndex(const FAssetHandle& handle) const noexcept -> isize {
+    auto FAssetManager::FindBundleLocked(const FUuid& uuid) const noexcept
+        -> const FAssetBundleReader* {
+        FBundleIndexEntry entry{};
+        for (usize index = mBundles.Size(); index > 0U; --index) {
+            const FAssetBundleReader* bundle = mBundles[index - 1U];
+            if (bundle->GetEntry(uuid, entry)) {
+                return bundle;
+            }
+        }
+        return nullptr;
+    }
+
+    auto FAssetManager::FindLoadedLocked(const FAssetHandle& handle) const -> TShared<IAsset> {
         if (!handle.IsValid()) {
-            return -1;
+            return {};
         }
 
-        for (usize index = 0; index < mCache.Size(); ++index) {
-            if (HandlesMatch(mCache[index].mHandle, handle)) {
-                return static_cast<isize>(index);
+        const FCacheEntry* entry = mCache.Find(handle.mUuid);
+        if (entry == nullptr || entry->mHandle.mType != handle.mType) {
+            return {};
+        }
+
+        return entry->mAsset;
+    }
+
+    auto FAssetManager::EnqueueLocked(const FAssetHandle& handle, i32 priority,
+        TVector<FUuid>& visiting, u32& outReadyCount) -> FRequestRef {
+        const FAssetHandle resolved = mRegistry->ResolveRedirector(handle);
+        if (!resolved.IsValid()) {
+            return {};
+        }
+        // The registry has a dependency cycle; ignore the edge that closes it.
+        for (const FUuid& uuid : visiting) {
+            if (uuid == resolved.mUuid) {
+                return {};
             }
         }
 
-        return -1;
+        if (FRequestRef* existing = mInFlight.Find(resolved.mUuid)) {
+            RaisePriorityLocked(**existing, priority);
+            return *existing;
+        }
+        if (TShared<IAsset> cached = FindLoadedLocked(resolved)) {
+            return MakeFinishedRequest(resolved, Move(cached));
+        }
+
+        const FAssetDesc* desc   = mRegistry->GetDesc(resolved);
+        IAssetLoader*     loader = (desc != nullptr) ? FindLoader(desc->mHandle.mType) : nullptr;
+        if (loader == nullptr) {
+            return {};
+        }
+
+        FRequestRef request = MakeShared<FAssetLoadRequest>();
+        request->mOwner     = this;
+        request->mHandle    = resolved;
+        request->mDesc      = desc;
+        request->mLoader    = loader;
+        request->mBundle    = FindBundleLocked(resolved.mUuid);
+        request->mPriority  = priority;
+        request->mSequence  = mNextSequence++;
+        request->SetState(EAssetLoadState::Pending);
+        request->mDone.Add(1);
+        mInFlight.Emplace(resolved.mUuid, request);
+
+        if (const TVector<FAssetHandle>* dependencies = mRegistry->GetDependencies(resolved)) {
+            visiting.PushBack(resolved.mUuid);
+            for (const FAssetHandle& dependency : *dependencies) {
+                // Dependency lists may omit the type; ResolveRedirector fills it in.
+                if (dependency.mUuid.IsNil()) {
+                    continue;
+                }
+                FRequestRef dependencyRequest =
+                    EnqueueLocked(dependency, priority, visiting, outReadyCount);
+                if (!dependencyRequest || !dependencyRequest->IsInFlight()) {
+                    continue;
+                }
+                dependencyRequest->mDependents.PushBack(request);
+                request->mDependencies.PushBack(Move(dependencyRequest));
+                ++request->mPendingDependencies;
+            }
+            visiting.PopBack();
+        }
+
+        if (request->mPendingDependencies == 0U) {
+            mReady.PushBack(request);
+            ++outReadyCount;
+        }
+        return request;
+    }
+
+    void FAssetManager::RaisePriorityLocked(FAssetLoadRequest& request, i32 priority) {
+        if (!request.IsPending() || request.mPriority >= priority) {
+            return;
+        }
+        request.mPriority = priority;
+        for (auto& dependency : request.mDependencies) {
+            RaisePriorityLocked(*dependency, priority);
+        }
+    }
+
+    auto FAssetManager::CancelLocked(const FRequestRef& request) -> bool {
+        if (!request->IsPending() || !request->mDependents.IsEmpty()
+            || request->mBlockingWaiters > 0U) {
+            return false;
+        }
+
+        request->SetState(EAssetLoadState::Cancelled);
+        mInFlight.Remove(request->mHandle.mUuid);
+        RemoveRequest(mReady, request.Get());
+
+        TVector<FRequestRef> dependencies = Move(request->mDependencies);
+        request->mDependencies.Clear();
+        for (auto& dependency : dependencies) {
+            RemoveRequest(dependency->mDependents, request.Get());
+            if (!dependency->mRequestedDirectly) {
+                CancelLocked(dependency);
+            }
+        }
+
+        request->mDone.Done();
+        return true;
+    }
+
+    void FAssetManager::CompleteLocked(
+        const FRequestRef& request, TShared<IAsset> asset, u32& outReadyCount) {
+        if (asset) {
+            mCache.InsertOrAssign(request->mHandle.mUuid, FCacheEntry{ request->mHandle, asset });
+        }
+        mInFlight.Remove(request->mHandle.mUuid);
+
+        // Dependents are released even when this load failed; their loaders decide whether a
+        // missing dependency is fatal.
+        for (auto& dependent : request->mDependents) {
+            if (dependent->IsPending() && --dependent->mPendingDependencies == 0U) {
+                mReady.PushBack(dependent);
+                ++outReadyCount;
+            }
+        }
+        request->mDependents.Clear();
+        request->mDependencies.Clear();
+
+        request->mAsset = Move(asset);
+        request->SetState(request->mAsset ? EAssetLoadState::Loaded : EAssetLoadState::Failed);
+        request->mDone.Done();
+    }
+
+    auto FAssetManager::PopReadyLocked() -> FRequestRef {
+        if (mReady.IsEmpty()) {
+            return {};
+        }
+
+        // Priorities change while requests wait, so the best one is picked when a worker asks
+        // instead of keeping the queue sorted. Ties go to the oldest request.
+        usize best = 0;
+        for (usize index = 1; index < mReady.Size(); ++index) {
+            const FAssetLoadRequest& candidate = *mReady[index];
+            const FAssetLoadRequest& current   = *mReady[best];
+            if (candidate.mPriority > current.mPriority
+                || (candidate.mPriority == current.mPriority
+                    && candidate.mSequence < current.mSequence)) {
+                best = index;
+            }
+        }
+
+        FRequestRef request   = mReady[best];
+        const usize lastIndex = mReady.Size() - 1;
+        if (best != lastIndex) {
+            mReady[best] = Move(mReady[lastIndex]);
+        }
+        mReady.PopBack();
+        return request;
+    }
+
+    void FAssetManager::SubmitLoadJobs(u32 count) {
+        for (u32 index = 0U; index < count; ++index) {
+            mLoadJobs.Add(1);
+            Core::Jobs::FJobDescriptor desc{};
+            desc.DebugLabel = "Asset.Load";
+            desc.Callback   = [this]() -> void { RunNextLoad(); };
+            Core::Jobs::FJobSystem::Submit(Move(desc));
+        }
+    }
+
+    void FAssetManager::RunNextLoad() {
+        // A job serves whichever ready request is most urgent when it runs, not the one that
+        // queued it. It comes up empty when that request was cancelled in the meantime.
+        FRequestRef request;
+        {
+            FScopedLock lock(mMutex);
+            request = PopReadyLocked();
+            if (request) {
+                request->SetState(EAssetLoadState::Loading);
+            }
+        }
+
+        if (request) {
+            TShared<IAsset> asset =
+                ReadAndDecode(*request->mDesc, *request->mLoader, request->mBundle);
+            u32             readyCount = 0U;
+            {
+                FScopedLock lock(mMutex);
+                CompleteLocked(request, Move(asset), readyCount);
+            }
+            SubmitLoadJobs(readyCount);
+        }
+
+        // Last access to `this`: the destructor may return as soon as the count drops.
+        mLoadJobs.Done();
+    }
+
+    auto FAssetManager::CancelRequest(const FRequestRef& request) -> bool {
+        FScopedLock lock(mMutex);
+        return CancelLocked(request);
+    }
+
+    void FAssetManager::SetRequestPriority(const FRequestRef& request, i32 priority) {
+        FScopedLock lock(mMutex);
+        if (!request->IsPending()) {
+            return;
+        }
+        request->mPriority = priority;
+        for (auto& dependency : request->mDependencies) {
+            RaisePriorityLocked(*dependency, priority);
+        }
     }
 
 } // namespace AltinaEngine::Asset
@@ -1,5 +1,6 @@
 #include "Asset/AssetRegistry.h"
 
+#include "Algorithm/CStringUtils.h"
 #include "Platform/PlatformFileSystem.h"
 #include "Types/Traits.h"
 #include "Types/NumericProperties.h"
@@ -11,13 +12,8 @@
 using AltinaEngine::Move;
 namespace AltinaEngine::Asset {
     namespace {
-        using Core::Utility::Json::EJsonType;
-        using Core::Utility::Json::FindObjectValueInsensitive;
-        using Core::Utility::Json::FJsonDocument;
-        using Core::Utility::Json::FJsonValue;
-        using Core::Utility::Json::GetBoolValue;
-        using Core::Utility::Json::GetNumberValue;
-        using Core::Utility::Json::GetStringValue;
+        using Core::Utility::Json::EJsonToken;
+        using Core::Utility::Json::FJsonPullReader;
 
         auto ParseAssetType(FNativeStringView text) -> EAssetType {
             if (Core::Utility::String::EqualLiteralI(text, "texture2d")) {
@@ -59,290 +55,427 @@ namespace AltinaEngine::Asset {
             return EAssetType::Unknown;
         }
 
-        void ReadU32Field(const FJsonValue& object, const char* key, u32& out) {
-            const FJsonValue* value  = FindObjectValueInsensitive(object, key);
-            double            number = 0.0;
-            if (!GetNumberValue(value, number)) {
-                return;
-            }
-            if (number < 0.0) {
-                return;
-            }
-            if (number > static_cast<double>(TNumericProperty<u32>::Max)) {
-                return;
-            }
-            out = static_cast<u32>(number);
+        enum class EDescFieldKind : u8 {
+            U32,
+            Float,
+            Bool,
+            String,
+        };
+
+        struct FDescField {
+            const char*    mKey    = nullptr;
+            EDescFieldKind mKind   = EDescFieldKind::U32;
+            void*          mTarget = nullptr;
+        };
+
+        auto MakeField(const char* key, u32& target) -> FDescField {
+            return { key, EDescFieldKind::U32, &target };
         }
-
-        void ReadFloatField(const FJsonValue& object, const char* key, f32& out) {
-            const FJsonValue* value  = FindObjectValueInsensitive(object, key);
-            double            number = 0.0;
-            if (!GetNumberValue(value, number)) {
-                return;
-            }
-            out = static_cast<f32>(number);
+        auto MakeField(const char* key, f32& target) -> FDescField {
+            return { key, EDescFieldKind::Float, &target };
         }
-
-        void ReadBoolField(const FJsonValue& object, const char* key, bool& out) {
-            const FJsonValue* value = FindObjectValueInsensitive(object, key);
-            bool              flag  = false;
-            if (!GetBoolValue(value, flag)) {
-                return;
-            }
-            out = flag;
+        auto MakeField(const char* key, bool& target) -> FDescField {
+            return { key, EDescFieldKind::Bool, &target };
+        }
+        auto MakeField(const char* key, FNativeString& target) -> FDescField {
+            return { key, EDescFieldKind::String, &target };
         }
 
-        void ReadDescFields(const FJsonValue& descObject, FAssetDesc& desc) {
+        // Up to five fields per asset type; returns how many were filled in.
+        auto GetDescFields(FAssetDesc& desc, FDescField (&outFields)[5]) -> usize {
             switch (desc.mHandle.mType) {
                 case EAssetType::Texture2D:
-                    ReadU32Field(descObject, "Width", desc.mTexture.Width);
-                    ReadU32Field(descObject, "Height", desc.mTexture.Height);
-                    ReadU32Field(descObject, "MipCount", desc.mTexture.MipCount);
-                    ReadU32Field(descObject, "Format", desc.mTexture.Format);
-                    ReadBoolField(descObject, "SRGB", desc.mTexture.SRGB);
-                    break;
+                    outFields[0] = MakeField("Width", desc.mTexture.Width);
+                    outFields[1] = MakeField("Height", desc.mTexture.Height);
+                    outFields[2] = MakeField("MipCount", desc.mTexture.MipCount);
+                    outFields[3] = MakeField("Format", desc.mTexture.Format);
+                    outFields[4] = MakeField("SRGB", desc.mTexture.SRGB);
+                    return 5U;
                 case EAssetType::CubeMap:
-                    ReadU32Field(descObject, "Size", desc.mCubeMap.Size);
-                    ReadU32Field(descObject, "MipCount", desc.mCubeMap.MipCount);
-                    ReadU32Field(descObject, "Format", desc.mCubeMap.Format);
-                    ReadBoolField(descObject, "SRGB", desc.mCubeMap.SRGB);
-                    break;
+                    outFields[0] = MakeField("Size", desc.mCubeMap.Size);
+                    outFields[1] = MakeField("MipCount", desc.mCubeMap.MipCount);
+                    outFields[2] = MakeField("Format", desc.mCubeMap.Format);
+                    outFields[3] = MakeField("SRGB", desc.mCubeMap.SRGB);
+                    return 4U;
                 case EAssetType::Mesh:
-                    ReadU32Field(descObject, "VertexFormat", desc.mMesh.VertexFormat);
-                    ReadU32Field(descObject, "IndexFormat", desc.mMesh.IndexFormat);
-                    ReadU32Field(descObject, "SubMeshCount", desc.mMesh.SubMeshCount);
-                    break;
+                    outFields[0] = MakeField("VertexFormat", desc.mMesh.VertexFormat);
+                    outFields[1] = MakeField("IndexFormat", desc.mMesh.IndexFormat);
+                    outFields[2] = MakeField("SubMeshCount", desc.mMesh.SubMeshCount);
+                    return 3U;
                 case EAssetType::MaterialTemplate:
-                    ReadU32Field(descObject, "PassCount", desc.mMaterial.PassCount);
-                    ReadU32Field(descObject, "ShaderCount", desc.mMaterial.ShaderCount);
-                    ReadU32Field(descObject, "VariantCount", desc.mMaterial.VariantCount);
-                    break;
+                    outFields[0] = MakeField("PassCount", desc.mMaterial.PassCount);
+                    outFields[1] = MakeField("ShaderCount", desc.mMaterial.ShaderCount);
+                    outFields[2] = MakeField("VariantCount", desc.mMaterial.VariantCount);
+                    return 3U;
                 case EAssetType::Shader:
-                    ReadU32Field(descObject, "Language", desc.mShader.Language);
-                    break;
+                    outFields[0] = MakeField("Language", desc.mShader.Language);
+                    return 1U;
                 case EAssetType::Model:
-                    ReadU32Field(descObject, "NodeCount", desc.mModel.NodeCount);
-                    ReadU32Field(descObject, "MeshRefCount", desc.mModel.MeshRefCount);
-                    ReadU32Field(descObject, "MaterialSlotCount", desc.mModel.MaterialSlotCount);
-                    break;
+                    outFields[0] = MakeField("NodeCount", desc.mModel.NodeCount);
+                    outFields[1] = MakeField("MeshRefCount", desc.mModel.MeshRefCount);
+                    outFields[2] = MakeField("MaterialSlotCount", desc.mModel.MaterialSlotCount);
+                    return 3U;
                 case EAssetType::Audio:
-                    ReadU32Field(descObject, "Codec", desc.mAudio.Codec);
-                    ReadU32Field(descObject, "Channels", desc.mAudio.Channels);
-                    ReadU32Field(descObject, "SampleRate", desc.mAudio.SampleRate);
-                    ReadFloatField(descObject, "Duration", desc.mAudio.DurationSeconds);
-                    break;
+                    outFields[0] = MakeField("Codec", desc.mAudio.Codec);
+                    outFields[1] = MakeField("Channels", desc.mAudio.Channels);
+                    outFields[2] = MakeField("SampleRate", desc.mAudio.SampleRate);
+                    outFields[3] = MakeField("Duration", desc.mAudio.DurationSeconds);
+                    return 4U;
                 case EAssetType::Script:
-                {
-                    FNativeString assemblyText;
-                    if (GetStringValue(
-                            FindObjectValueInsensitive(descObject, "AssemblyPath"), assemblyText)) {
-                        desc.mScript.mAssemblyPath.Assign(assemblyText);
-                    }
-                    FNativeString typeText;
-                    if (GetStringValue(
-                            FindObjectValueInsensitive(descObject, "TypeName"), typeText)) {
-                        desc.mScript.mTypeName.Assign(typeText);
-                    }
-                    break;
-                }
+                    outFields[0] = MakeField("AssemblyPath", desc.mScript.mAssemblyPath);
+                    outFields[1] = MakeField("TypeName", desc.mScript.mTypeName);
+                    return 2U;
                 case EAssetType::Level:
-                    ReadU32Field(descObject, "Encoding", desc.mLevel.Encoding);
-                    ReadU32Field(descObject, "ByteSize", desc.mLevel.ByteSize);
-                    break;
+                    outFields[0] = MakeField("Encoding", desc.mLevel.Encoding);
+                    outFields[1] = MakeField("ByteSize", desc.mLevel.ByteSize);
+                    return 2U;
                 default:
-                    break;
+                    return 0U;
             }
         }
 
-        auto ValidateSchema(const FJsonValue& root, FNativeString& outError) -> bool {
-            if (root.Type != EJsonType::Object) {
-                outError = "Root must be a JSON object.";
-                return false;
-            }
-
-            const FJsonValue* schemaVersion = FindObjectValueInsensitive(root, "SchemaVersion");
-            double            versionNumber = 0.0;
-            if (!GetNumberValue(schemaVersion, versionNumber)) {
-                outError = "SchemaVersion is missing or not a number.";
-                return false;
-            }
-
-            const FJsonValue* assets = FindObjectValueInsensitive(root, "Assets");
-            if (assets == nullptr || assets->Type != EJsonType::Array) {
-                outError = "Assets array is missing.";
-                return false;
+        // The reader is on the Desc object's '{'. Keys match case-insensitively and only the
+        // first occurrence of a key counts; values of the wrong type leave the field unchanged.
+        void ReadDescFields(FJsonPullReader& reader, FAssetDesc& desc) {
+            FDescField  fields[5];
+            const usize fieldCount = GetDescFields(desc, fields);
+            u32         seen       = 0U;
+            while (reader.Next() == EJsonToken::Key) {
+                const FNativeStringView key   = reader.GetString();
+                usize                   match = fieldCount;
+                for (usize index = 0U; index < fieldCount; ++index) {
+                    if ((seen & (1U << index)) == 0U
+                        && Core::Utility::String::EqualLiteralI(key, fields[index].mKey)) {
+                        match = index;
+                        break;
+                    }
+                }
+                if (match == fieldCount) {
+                    (void)reader.SkipValue();
+                    continue;
+                }
+                seen |= 1U << match;
+
+                const EJsonToken  token = reader.Next();
+                const FDescField& field = fields[match];
+                if (token == EJsonToken::Number) {
+                    const double number = reader.GetNumber();
+                    if (field.mKind == EDescFieldKind::U32 && number >= 0.0
+                        && number <= static_cast<double>(TNumericProperty<u32>::Max)) {
+                        *static_cast<u32*>(field.mTarget) = static_cast<u32>(number);
+                    } else if (field.mKind == EDescFieldKind::Float) {
+                        *static_cast<f32*>(field.mTarget) = static_cast<f32>(number);
+                    }
+                } else if (token == EJsonToken::Bool && field.mKind == EDescFieldKind::Bool) {
+                    *static_cast<bool*>(field.mTarget) = reader.GetBool();
+                } else if (token == EJsonToken::String && field.mKind == EDescFieldKind::String) {
+                    static_cast<FNativeString*>(field.mTarget)->Assign(reader.GetString());
+                } else {
+                    (void)reader.SkipValue();
+                }
             }
-
-            (void)versionNumber;
-            return true;
         }
 
-        auto ParseDependencies(const FJsonValue& object, TVector<FAssetHandle>& outDependencies)
-            -> bool {
-            const FJsonValue* deps = FindObjectValueInsensitive(object, "Dependencies");
-            if (deps == nullptr) {
-                return true;
-            }
-            if (deps->Type != EJsonType::Array) {
-                return false;
-            }
-
-            for (const auto* item : deps->Array) {
-                if (item == nullptr) {
-                    continue;
+        // The reader is on the Dependencies array's '['. Items are UUID strings or objects with
+        // Uuid and optional Type; anything else, or an unparsable UUID, is ignored.
+        void ParseDependencies(FJsonPullReader& reader, TVector<FAssetHandle>& outDependencies) {
+            while (true) {
+                const EJsonToken token = reader.Next();
+                if (token == EJsonToken::EndArray || token == EJsonToken::Error) {
+                    return;
                 }
 
-                if (item->Type == EJsonType::String) {
+                if (token == EJsonToken::String) {
                     FUuid uuid;
-                    if (Core::Utility::String::ParseUuid(item->String, uuid)) {
+                    if (Core::Utility::String::ParseUuid(reader.GetString(), uuid)) {
                         outDependencies.PushBack({ uuid, EAssetType::Unknown });
                     }
                     continue;
                 }
+                if (token != EJsonToken::BeginObject) {
+                    (void)reader.SkipValue();
+                    continue;
+                }
 
-                if (item->Type == EJsonType::Object) {
-                    FNativeString uuidText;
-                    if (!GetStringValue(FindObjectValueInsensitive(*item, "Uuid"), uuidText)) {
-                        continue;
-                    }
-                    FUuid uuid;
-                    if (!Core::Utility::String::ParseUuid(uuidText, uuid)) {
-                        continue;
+                FUuid      uuid;
+                EAssetType type       = EAssetType::Unknown;
+                bool       bSeenUuid  = false;
+                bool       bSeenType  = false;
+                bool       bValidUuid = false;
+                while (reader.Next() == EJsonToken::Key) {
+                    const FNativeStringView key = reader.GetString();
+                    if (!bSeenUuid && Core::Utility::String::EqualLiteralI(key, "Uuid")) {
+                        bSeenUuid = true;
+                        if (reader.Next() == EJsonToken::String) {
+                            bValidUuid = Core::Utility::String::ParseUuid(reader.GetString(), uuid);
+                        }
+                    } else if (!bSeenType && Core::Utility::String::EqualLiteralI(key, "Type")) {
+                        bSeenType = true;
+                        if (reader.Next() == EJsonToken::String) {
+                            type = ParseAssetType(reader.GetString());
+                        }
                     }
+                    (void)reader.SkipValue();
+                }
+                if (bValidUuid) {
+                    outDependencies.PushBack({ uuid, type });
+                }
+            }
+        }
 
-                    EAssetType    type = EAssetType::Unknown;
-                    FNativeString typeText;
-                    if (GetStringValue(FindObjectValueInsensitive(*item, "Type"), typeText)) {
-                        type = ParseAssetType(
-                            FNativeStringView(typeText.GetData(), typeText.Length()));
+        // The reader is on an asset entry's '{'. Fields are taken in any order; the checks run
+        // once the entry is complete, in the order the registry format documents them.
+        void ParseAssetEntry(FJsonPullReader& reader, FNativeStringView text,
+            TVector<FAssetDesc>& outAssets, FNativeString& outError) {
+            FAssetDesc desc;
+            FUuid      uuid;
+            EAssetType type          = EAssetType::Unknown;
+            bool       bHasUuid      = false;
+            bool       bValidUuid    = false;
+            bool       bHasType      = false;
+            bool       bHasPath      = false;
+            bool       bSeenUuid     = false;
+            bool       bSeenType     = false;
+            bool       bSeenPath     = false;
+            bool       bSeenCooked   = false;
+            bool       bSeenDeps     = false;
+            bool       bSeenDesc     = false;
+            bool       bInvalidDeps  = false;
+            bool       bDeferredDesc = false;
+            usize      descBegin     = 0U;
+            usize      descEnd       = 0U;
+
+            while (reader.Next() == EJsonToken::Key) {
+                const FNativeStringView key = reader.GetString();
+                if (!bSeenUuid && Core::Utility::String::EqualLiteralI(key, "Uuid")) {
+                    bSeenUuid = true;
+                    if (reader.Next() == EJsonToken::String) {
+                        bHasUuid   = true;
+                        bValidUuid = Core::Utility::String::ParseUuid(reader.GetString(), uuid);
+                    }
+                } else if (!bSeenType && Core::Utility::String::EqualLiteralI(key, "Type")) {
+                    bSeenType = true;
+                    if (reader.Next() == EJsonToken::String) {
+                        bHasType = true;
+                        type     = ParseAssetType(reader.GetString());
+                    }
+                } else if (!bSeenPath
+                    && Core::Utility::String::EqualLiteralI(key, "VirtualPath")) {
+                    bSeenPath = true;
+                    if (reader.Next() == EJsonToken::String) {
+                        bHasPath          = true;
+                        desc.mVirtualPath = Core::Utility::String::FromUtf8(reader.GetString());
+                    }
+                } else if (!bSeenCooked
+                    && Core::Utility::String::EqualLiteralI(key, "CookedPath")) {
+                    bSeenCooked = true;
+                    if (reader.Next() == EJsonToken::String) {
+                        desc.mCookedPath = Core::Utility::String::FromUtf8(reader.GetString());
+                    }
+                } else if (!bSeenDeps
+                    && Core::Utility::String::EqualLiteralI(key, "Dependencies")) {
+                    bSeenDeps = true;
+                    if (reader.Next() == EJsonToken::BeginArray) {
+                        ParseDependencies(reader, desc.mDependencies);
+                    } else {
+                        bInvalidDeps = true;
+                    }
+                } else if (!bSeenDesc && Core::Utility::String::EqualLiteralI(key, "Desc")) {
+                    bSeenDesc = true;
+                    if (reader.Next() == EJsonToken::BeginObject) {
+                        if (bSeenType) {
+                            desc.mHandle.mType = type;
+                            ReadDescFields(reader, desc);
+                        } else {
+                            // The field set depends on Type, which comes later: revisit it.
+                            bDeferredDesc = true;
+                            descBegin     = reader.GetTokenOffset();
+                            (void)reader.SkipValue();
+                            descEnd = reader.GetOffset();
+                        }
                     }
-                    outDependencies.PushBack({ uuid, type });
                 }
+                (void)reader.SkipValue();
+            }
+            if (reader.GetToken() == EJsonToken::Error) {
+                return;
             }
 
-            return true;
-        }
+            if (!bHasUuid) {
+                outError = "Asset missing Uuid.";
+            } else if (!bHasType) {
+                outError = "Asset missing Type.";
+            } else if (!bHasPath) {
+                outError = "Asset missing VirtualPath.";
+            } else if (!bValidUuid) {
+                outError = "Asset Uuid invalid.";
+            } else if (type == EAssetType::Unknown) {
+                outError = "Asset Type invalid.";
+            } else if (bInvalidDeps) {
+                outError = "Asset Dependencies invalid.";
+            }
+            if (!outError.IsEmptyString()) {
+                return;
+            }
 
-        auto ParseAssets(const FJsonValue& root, TVector<FAssetDesc>& outAssets,
-            TVector<FAssetRedirector>& outRedirectors, FNativeString& outError) -> bool {
-            const FJsonValue* assetsValue = FindObjectValueInsensitive(root, "Assets");
-            if (assetsValue == nullptr || assetsValue->Type != EJsonType::Array) {
-                outError = "Assets array missing.";
-                return false;
+            desc.mHandle.mUuid = uuid;
+            desc.mHandle.mType = type;
+            if (bDeferredDesc) {
+                FJsonPullReader descReader(
+                    FNativeStringView(text.Data() + descBegin, descEnd - descBegin));
+                (void)descReader.Next();
+                ReadDescFields(descReader, desc);
             }
+            desc.mVirtualPath.ToLower();
+            outAssets.PushBack(Move(desc));
+        }
 
-            for (const auto* assetValue : assetsValue->Array) {
-                if (assetValue == nullptr || assetValue->Type != EJsonType::Object) {
+        // The reader is on the Assets array's '['. Parsing stops at the first invalid entry;
+        // the rest of the array is still stepped over so later syntax errors are reported.
+        void ParseAssets(FJsonPullReader& reader, FNativeStringView text,
+            TVector<FAssetDesc>& outAssets, FNativeString& outError) {
+            while (true) {
+                const EJsonToken token = reader.Next();
+                if (token == EJsonToken::EndArray || token == EJsonToken::Error) {
+                    return;
+                }
+                if (!outError.IsEmptyString()) {
+                    (void)reader.SkipValue();
+                } else if (token != EJsonToken::BeginObject) {
                     outError = "Asset entry must be an object.";
-                    return false;
+                    (void)reader.SkipValue();
+                } else {
+                    ParseAssetEntry(reader, text, outAssets, outError);
                 }
+            }
+        }
 
-                FNativeString uuidText;
-                FNativeString typeText;
-                FNativeString virtualPathText;
-                FNativeString cookedPathText;
-
-                if (!GetStringValue(FindObjectValueInsensitive(*assetValue, "Uuid"), uuidText)) {
-                    outError = "Asset missing Uuid.";
-                    return false;
+        // The reader is on the Redirectors array's '['.
+        void ParseRedirectors(FJsonPullReader& reader,
+            TVector<FAssetRedirector>& outRedirectors, FNativeString& outError) {
+            while (true) {
+                const EJsonToken token = reader.Next();
+                if (token == EJsonToken::EndArray || token == EJsonToken::Error) {
+                    return;
                 }
-                if (!GetStringValue(FindObjectValueInsensitive(*assetValue, "Type"), typeText)) {
-                    outError = "Asset missing Type.";
-                    return false;
-                }
-                if (!GetStringValue(
-                        FindObjectValueInsensitive(*assetValue, "VirtualPath"), virtualPathText)) {
-                    outError = "Asset missing VirtualPath.";
-                    return false;
+                if (!outError.IsEmptyString()) {
+                    (void)reader.SkipValue();
+                    continue;
                 }
-
-                FUuid uuid;
-                if (!Core::Utility::String::ParseUuid(uuidText, uuid)) {
-                    outError = "Asset Uuid invalid.";
-                    return false;
+                if (token != EJsonToken::BeginObject) {
+                    outError = "Redirector entry must be an object.";
+                    (void)reader.SkipValue();
+                    continue;
                 }
 
-                const EAssetType type =
-                    ParseAssetType(FNativeStringView(typeText.GetData(), typeText.Length()));
-                if (type == EAssetType::Unknown) {
-                    outError = "Asset Type invalid.";
-                    return false;
+                FAssetRedirector redirector;
+                bool             bSeenOldUuid  = false;
+                bool             bSeenNewUuid  = false;
+                bool             bSeenOldPath  = false;
+                bool             bHasOldUuid   = false;
+                bool             bHasNewUuid   = false;
+                bool             bHasOldPath   = false;
+                bool             bValidOldUuid = false;
+                bool             bValidNewUuid = false;
+                while (reader.Next() == EJsonToken::Key) {
+                    const FNativeStringView key = reader.GetString();
+                    if (!bSeenOldUuid && Core::Utility::String::EqualLiteralI(key, "OldUuid")) {
+                        bSeenOldUuid = true;
+                        if (reader.Next() == EJsonToken::String) {
+                            bHasOldUuid   = true;
+                            bValidOldUuid = Core::Utility::String::ParseUuid(
+                                reader.GetString(), redirector.mOldUuid);
+                        }
+                    } else if (!bSeenNewUuid
+                        && Core::Utility::String::EqualLiteralI(key, "NewUuid")) {
+                        bSeenNewUuid = true;
+                        if (reader.Next() == EJsonToken::String) {
+                            bHasNewUuid   = true;
+                            bValidNewUuid = Core::Utility::String::ParseUuid(
+                                reader.GetString(), redirector.mNewUuid);
+                        }
+                    } else if (!bSeenOldPath
+                        && Core::Utility::String::EqualLiteralI(key, "OldVirtualPath")) {
+                        bSeenOldPath = true;
+                        if (reader.Next() == EJsonToken::String) {
+                            bHasOldPath = true;
+                            redirector.mOldVirtualPath =
+                                Core::Utility::String::FromUtf8(reader.GetString());
+                        }
+                    }
+                    (void)reader.SkipValue();
                 }
-
-                FAssetDesc desc;
-                desc.mHandle.mUuid = uuid;
-                desc.mHandle.mType = type;
-                desc.mVirtualPath  = Core::Utility::String::FromUtf8(virtualPathText);
-
-                if (GetStringValue(
-                        FindObjectValueInsensitive(*assetValue, "CookedPath"), cookedPathText)) {
-                    desc.mCookedPath = Core::Utility::String::FromUtf8(cookedPathText);
+                if (reader.GetToken() == EJsonToken::Error) {
+                    return;
                 }
 
-                if (!ParseDependencies(*assetValue, desc.mDependencies)) {
-                    outError = "Asset Dependencies invalid.";
-                    return false;
+                if (!bHasOldUuid || !bHasNewUuid || !bHasOldPath) {
+                    outError = "Redirector missing required fields.";
+                    continue;
                 }
-
-                const FJsonValue* descValue = FindObjectValueInsensitive(*assetValue, "Desc");
-                if (descValue != nullptr && descValue->Type == EJsonType::Object) {
-                    ReadDescFields(*descValue, desc);
+                if (!bValidOldUuid || !bValidNewUuid) {
+                    outError = "Redirector UUID invalid.";
+                    continue;
                 }
-
-                desc.mVirtualPath.ToLower();
-                outAssets.PushBack(Move(desc));
+                redirector.mOldVirtualPath.ToLower();
+                outRedirectors.PushBack(Move(redirector));
             }
+        }
 
-            const FJsonValue* redirectorsValue = FindObjectValueInsensitive(root, "Redirectors");
-            if (redirectorsValue != nullptr) {
-                if (redirectorsValue->Type != EJsonType::Array) {
-                    outError = "Redirectors must be an array.";
-                    return false;
-                }
-
-                for (const auto* entry : redirectorsValue->Array) {
-                    if (entry == nullptr || entry->Type != EJsonType::Object) {
-                        outError = "Redirector entry must be an object.";
-                        return false;
-                    }
+        constexpr u32 kInvalidIndex = ~0U;
 
-                    FNativeString oldUuidText;
-                    FNativeString newUuidText;
-                    FNativeString oldPathText;
-
-                    if (!GetStringValue(FindObjectValueInsensitive(*entry, "OldUuid"), oldUuidText)
-                        || !GetStringValue(
-                            FindObjectValueInsensitive(*entry, "NewUuid"), newUuidText)
-                        || !GetStringValue(
-                            FindObjectValueInsensitive(*entry, "OldVirtualPath"), oldPathText)) {
-                        outError = "Redirector missing required fields.";
-                        return false;
-                    }
+        // Stored paths are already lower-case; folding here lets queries keep their casing.
+        auto          HashFoldedPath(FStringView path) noexcept -> u64 {
+            u64 hash = 1469598103934665603ULL;
+            for (usize index = 0; index < path.Length(); ++index) {
+                hash ^= static_cast<u64>(Core::Algorithm::ToLowerChar(path[index]));
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }
 
-                    FUuid oldUuid;
-                    FUuid newUuid;
-                    if (!Core::Utility::String::ParseUuid(oldUuidText, oldUuid)
-                        || !Core::Utility::String::ParseUuid(newUuidText, newUuid)) {
-                        outError = "Redirector UUID invalid.";
-                        return false;
-                    }
+        // `getPath(index)` returns the path of entry `index`. An entry whose path is already
+        // indexed is skipped, so the first registered entry for a path wins.
+        template <typename TGetPath>
+        void InsertPath(THashMap<u64, u32>& heads, TVector<u32>& next, u32 index,
+            TGetPath&& getPath) {
+            const FStringView path   = getPath(index);
+            auto              result = heads.TryEmplace(HashFoldedPath(path), index);
+            if (result.second) {
+                return;
+            }
 
-                    FAssetRedirector redirector;
-                    redirector.mOldUuid        = oldUuid;
-                    redirector.mNewUuid        = newUuid;
-                    redirector.mOldVirtualPath = Core::Utility::String::FromUtf8(oldPathText);
-                    redirector.mOldVirtualPath.ToLower();
-                    outRedirectors.PushBack(Move(redirector));
+            u32 current = result.first->second;
+            while (true) {
+                if (Core::Utility::String::EqualsIgnoreCase(getPath(current), path)) {
+                    return;
+                }
+                if (next[current] == kInvalidIndex) {
+                    next[current] = index;
+                    return;
                 }
+                current = next[current];
             }
+        }
 
-            return true;
+        template <typename TGetPath>
+        auto FindPath(const THashMap<u64, u32>& heads, const TVector<u32>& next, FStringView path,
+            TGetPath&& getPath) noexcept -> u32 {
+            const u32* head = heads.Find(HashFoldedPath(path));
+            for (u32 current = (head != nullptr) ? *head : kInvalidIndex;
+                current != kInvalidIndex; current = next[current]) {
+                if (Core::Utility::String::EqualsIgnoreCase(getPath(current), path)) {
+                    return current;
+                }
+            }
+            return kInvalidIndex;
         }
     } // namespace
 
     void FAssetRegistry::Clear() {
         mAssets.Clear();
         mRedirectors.Clear();
+        RebuildIndices();
         mLastError.Clear();
     }
 
@@ -361,30 +494,76 @@ namespace AltinaEngine::Asset {
     auto FAssetRegistry::LoadFromJsonText(FNativeStringView text) -> bool {
         mLastError.Clear();
 
-        FJsonDocument document;
-        if (!document.Parse(text)) {
-            mLastError = document.GetError();
-            return false;
+        // Single streaming pass over the text. Semantic errors are collected per section and
+        // reported only once the whole text is known to be well-formed, with syntax errors
+        // first, then the schema, then assets, then redirectors.
+        TVector<FAssetDesc>       assets;
+        TVector<FAssetRedirector> redirectors;
+        FNativeString             assetError;
+        FNativeString             redirectorError;
+        bool                      bRootIsObject     = false;
+        bool                      bSeenVersion      = false;
+        bool                      bHasVersion       = false;
+        bool                      bSeenAssets       = false;
+        bool                      bHasAssets        = false;
+        bool                      bSeenRedirectors  = false;
+        bool                      bValidRedirectors = true;
+
+        FJsonPullReader           reader(text);
+        if (reader.Next() == EJsonToken::BeginObject) {
+            bRootIsObject = true;
+            while (reader.Next() == EJsonToken::Key) {
+                const FNativeStringView key = reader.GetString();
+                if (!bSeenVersion
+                    && Core::Utility::String::EqualLiteralI(key, "SchemaVersion")) {
+                    bSeenVersion = true;
+                    bHasVersion  = reader.Next() == EJsonToken::Number;
+                } else if (!bSeenAssets && Core::Utility::String::EqualLiteralI(key, "Assets")) {
+                    bSeenAssets = true;
+                    if (reader.Next() == EJsonToken::BeginArray) {
+                        bHasAssets = true;
+                        ParseAssets(reader, text, assets, assetError);
+                    }
+                } else if (!bSeenRedirectors
+                    && Core::Utility::String::EqualLiteralI(key, "Redirectors")) {
+                    bSeenRedirectors = true;
+                    if (reader.Next() == EJsonToken::BeginArray) {
+                        ParseRedirectors(reader, redirectors, redirectorError);
+                    } else {
+                        bValidRedirectors = false;
+                    }
+                }
+                (void)reader.SkipValue();
+            }
+        } else {
+            (void)reader.SkipValue();
         }
-
-        const FJsonValue* root = document.GetRoot();
-        if (root == nullptr) {
-            mLastError = "Registry JSON missing root.";
-            return false;
+        if (reader.GetToken() != EJsonToken::Error) {
+            (void)reader.Next();
         }
 
-        if (!ValidateSchema(*root, mLastError)) {
-            return false;
+        if (reader.GetToken() == EJsonToken::Error) {
+            mLastError = reader.GetError();
+        } else if (!bRootIsObject) {
+            mLastError = "Root must be a JSON object.";
+        } else if (!bHasVersion) {
+            mLastError = "SchemaVersion is missing or not a number.";
+        } else if (!bHasAssets) {
+            mLastError = "Assets array is missing.";
+        } else if (!assetError.IsEmptyString()) {
+            mLastError = Move(assetError);
+        } else if (!bValidRedirectors) {
+            mLastError = "Redirectors must be an array.";
+        } else if (!redirectorError.IsEmptyString()) {
+            mLastError = Move(redirectorError);
         }
-
-        TVector<FAssetDesc>       assets;
-        TVector<FAssetRedirector> redirectors;
-        if (!ParseAssets(*root, assets, redirectors, mLastError)) {
+        if (!mLastError.IsEmptyString()) {
             return false;
         }
 
         mAssets      = Move(assets);
         mRedirectors = Move(redirectors);
+        RebuildIndices();
         return true;
     }
 
@@ -395,42 +574,34 @@ namespace AltinaEngine::Asset {
     void FAssetRegistry::AddAsset(FAssetDesc desc) {
         desc.mVirtualPath.ToLower();
         mAssets.PushBack(Move(desc));
+        IndexAsset(static_cast<u32>(mAssets.Size() - 1));
     }
 
     void FAssetRegistry::AddRedirector(FAssetRedirector redirector) {
         redirector.mOldVirtualPath.ToLower();
         mRedirectors.PushBack(Move(redirector));
+        IndexRedirector(static_cast<u32>(mRedirectors.Size() - 1));
     }
 
     auto FAssetRegistry::FindByPath(FStringView path) const noexcept -> FAssetHandle {
-        for (const auto& asset : mAssets) {
-            if (Core::Utility::String::EqualsIgnoreCase(path, asset.mVirtualPath.ToView())) {
-                return asset.mHandle;
-            }
+        const u32 assetIndex = FindPath(mAssetByPath, mAssetPathNext, path,
+            [this](u32 index) { return mAssets[index].mVirtualPath.ToView(); });
+        if (assetIndex != kInvalidIndex) {
+            return mAssets[assetIndex].mHandle;
         }
 
-        for (const auto& redirector : mRedirectors) {
-            if (Core::Utility::String::EqualsIgnoreCase(
-                    path, redirector.mOldVirtualPath.ToView())) {
-                return FindByUuid(redirector.mNewUuid);
-            }
+        const u32 redirectorIndex = FindPath(mRedirectorByPath, mRedirectorPathNext, path,
+            [this](u32 index) { return mRedirectors[index].mOldVirtualPath.ToView(); });
+        if (redirectorIndex != kInvalidIndex) {
+            return FindByUuid(GetRedirectorTarget(redirectorIndex));
         }
 
         return {};
     }
 
     auto FAssetRegistry::FindByUuid(const FUuid& uuid) const noexcept -> FAssetHandle {
-        if (uuid.IsNil()) {
-            return {};
-        }
-
-        for (const auto& asset : mAssets) {
-            if (asset.mHandle.mUuid == uuid) {
-                return asset.mHandle;
-            }
-        }
-
-        return {};
+        const u32 index = FindAssetIndex(uuid);
+        return (index != kInvalidIndex) ? mAssets[index].mHandle : FAssetHandle{};
     }
 
     auto FAssetRegistry::GetDesc(const FAssetHandle& handle) const noexcept -> const FAssetDesc* {
@@ -438,15 +609,16 @@ namespace AltinaEngine::Asset {
             return nullptr;
         }
 
-        for (const auto& asset : mAssets) {
-            if (asset.mHandle.mUuid == handle.mUuid) {
-                if (handle.mType == EAssetType::Unknown || asset.mHandle.mType == handle.mType) {
-                    return &asset;
-                }
-            }
+        const u32 index = FindAssetIndex(handle.mUuid);
+        if (index == kInvalidIndex) {
+            return nullptr;
         }
 
-        return nullptr;
+        const FAssetDesc& asset = mAssets[index];
+        if (handle.mType != EAssetType::Unknown && asset.mHandle.mType != handle.mType) {
+            return nullptr;
+        }
+        return &asset;
     }
 
     auto FAssetRegistry::GetDependencies(const FAssetHandle& handle) const noexcept
@@ -461,22 +633,142 @@ namespace AltinaEngine::Asset {
 
     auto FAssetRegistry::ResolveRedirector(const FAssetHandle& handle) const noexcept
         -> FAssetHandle {
-        if (!handle.IsValid()) {
+        if (handle.mUuid.IsNil()) {
             return handle;
         }
 
-        for (const auto& redirector : mRedirectors) {
-            if (redirector.mOldUuid == handle.mUuid) {
-                FAssetHandle resolved = FindByUuid(redirector.mNewUuid);
-                if (resolved.IsValid()) {
-                    return resolved;
-                }
-
-                return { redirector.mNewUuid, handle.mType };
+        if (const u32* redirectorIndex = mRedirectorByUuid.Find(handle.mUuid)) {
+            const FUuid&       target   = GetRedirectorTarget(*redirectorIndex);
+            const FAssetHandle resolved = FindByUuid(target);
+            if (resolved.IsValid()) {
+                return resolved;
             }
+
+            return { target, handle.mType };
         }
 
+        if (handle.mType == EAssetType::Unknown) {
+            const FAssetHandle typed = FindByUuid(handle.mUuid);
+            return typed.IsValid() ? typed : handle;
+        }
         return handle;
     }
 
+    void FAssetRegistry::IndexAsset(u32 index) {
+        const FAssetDesc& asset = mAssets[index];
+        if (!asset.mHandle.mUuid.IsNil()) {
+            mAssetByUuid.TryEmplace(asset.mHandle.mUuid, index);
+        }
+        mAssetPathNext.PushBack(kInvalidIndex);
+        InsertPath(mAssetByPath, mAssetPathNext, index,
+            [this](u32 entry) { return mAssets[entry].mVirtualPath.ToView(); });
+    }
+
+    void FAssetRegistry::RebuildIndices() {
+        mAssetByUuid.Clear();
+        mAssetByPath.Clear();
+        mAssetPathNext.Clear();
+        mAssetByUuid.Reserve(mAssets.Size());
+        mAssetByPath.Reserve(mAssets.Size());
+        mAssetPathNext.Reserve(mAssets.Size());
+        for (usize index = 0; index < mAssets.Size(); ++index) {
+            IndexAsset(static_cast<u32>(index));
+        }
+        RebuildRedirectorIndex();
+    }
+
+    void FAssetRegistry::IndexRedirector(u32 index) {
+        const FAssetRedirector& redirector = mRedirectors[index];
+        const bool              bIndexed =
+            mRedirectorByUuid.TryEmplace(redirector.mOldUuid, index).second;
+        mRedirectorPathNext.PushBack(kInvalidIndex);
+        InsertPath(mRedirectorByPath, mRedirectorPathNext, index,
+            [this](u32 other) { return mRedirectors[other].mOldVirtualPath.ToView(); });
+
+        // Indexed chains are already collapsed, so the next hop's end is this chain's end. An
+        // end that is itself a redirector means the chain runs into a cycle.
+        mRedirectorChainOf.PushBack(kInvalidIndex);
+        FUuid target = redirector.mNewUuid;
+        if (const u32* next = mRedirectorByUuid.Find(target)) {
+            target = GetRedirectorTarget(*next);
+        }
+        const bool bCycle = mRedirectorByUuid.Contains(target);
+        u32        chain  = kInvalidIndex;
+        if (!bCycle) {
+            const u32  newChain = static_cast<u32>(mRedirectorChains.Size());
+            const auto inserted = mRedirectorChainByEnd.TryEmplace(target, newChain);
+            chain               = inserted.first->second;
+            if (inserted.second) {
+                mRedirectorChains.PushBack({ target, {} });
+            }
+            mRedirectorChains[chain].mMembers.PushBack(index);
+            mRedirectorChainOf[index] = chain;
+        }
+        if (!bIndexed) {
+            return;
+        }
+
+        // Chains that ended at this redirector's old UUID now end where it does.
+        const u32* extendedIt = mRedirectorChainByEnd.Find(redirector.mOldUuid);
+        if (extendedIt == nullptr) {
+            return;
+        }
+        u32 extended = *extendedIt;
+        mRedirectorChainByEnd.Remove(redirector.mOldUuid);
+        if (bCycle) {
+            for (const u32 member : mRedirectorChains[extended].mMembers) {
+                mRedirectorChainOf[member] = kInvalidIndex;
+            }
+            mRedirectorChains[extended].mMembers.Clear();
+            return;
+        }
+
+        // Relabel the smaller chain so every redirector moves O(log n) times at most.
+        if (mRedirectorChains[extended].mMembers.Size()
+            > mRedirectorChains[chain].mMembers.Size()) {
+            mRedirectorChains[extended].mEnd = target;
+            mRedirectorChainByEnd[target]    = extended;
+            const u32 larger                 = extended;
+            extended                         = chain;
+            chain                            = larger;
+        }
+        auto& survivor = mRedirectorChains[chain].mMembers;
+        for (const u32 member : mRedirectorChains[extended].mMembers) {
+            mRedirectorChainOf[member] = chain;
+            survivor.PushBack(member);
+        }
+        mRedirectorChains[extended].mMembers.Clear();
+    }
+
+    void FAssetRegistry::RebuildRedirectorIndex() {
+        mRedirectorByUuid.Clear();
+        mRedirectorByPath.Clear();
+        mRedirectorPathNext.Clear();
+        mRedirectorChainOf.Clear();
+        mRedirectorChains.Clear();
+        mRedirectorChainByEnd.Clear();
+        mRedirectorByUuid.Reserve(mRedirectors.Size());
+        mRedirectorByPath.Reserve(mRedirectors.Size());
+        mRedirectorPathNext.Reserve(mRedirectors.Size());
+        mRedirectorChainOf.Reserve(mRedirectors.Size());
+        for (usize index = 0; index < mRedirectors.Size(); ++index) {
+            IndexRedirector(static_cast<u32>(index));
+        }
+    }
+
+    auto FAssetRegistry::GetRedirectorTarget(u32 index) const noexcept -> const FUuid& {
+        const u32 chain = mRedirectorChainOf[index];
+        return (chain != kInvalidIndex) ? mRedirectorChains[chain].mEnd
+                                        : mRedirectors[index].mNewUuid;
+    }
+
+    auto FAssetRegistry::FindAssetIndex(const FUuid& uuid) const noexcept -> u32 {
+        if (uuid.IsNil()) {
+            return kInvalidIndex;
+        }
+
+        const u32* index = mAssetByUuid.Find(uuid);
+        return (index != nullptr) ? *index : kInvalidIndex;
+    }
+
 } // namespace AltinaEngine::Asset
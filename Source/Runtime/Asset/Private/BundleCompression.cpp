@@ -0,0 +1,292 @@
+#include "BundleCompression.h"
+
+#include <cstring>
+
+#ifndef AE_ASSET_ENABLE_ZSTD
+    #define AE_ASSET_ENABLE_ZSTD 0
+#endif
+
+#if AE_ASSET_ENABLE_ZSTD
+    #include <zstd.h>
+#endif
+
+namespace AltinaEngine::Asset::Detail {
+    namespace {
+        constexpr usize kLz4MinMatch     = 4U;
+        // The format requires the last 5 bytes to be literals and the last match to start at
+        // least 12 bytes before the end of the block.
+        constexpr usize kLz4LastLiterals = 5U;
+        constexpr usize kLz4MatchLimit   = 12U;
+        constexpr usize kLz4MaxOffset    = 65535U;
+        constexpr u32   kLz4HashBits     = 12U;
+        // After 64 misses in a row the encoder starts skipping ahead, so incompressible input
+        // is rejected quickly.
+        constexpr u32   kLz4SkipTrigger  = 6U;
+
+        auto Read32(const u8* ptr) noexcept -> u32 {
+            u32 value = 0U;
+            std::memcpy(&value, ptr, sizeof(value));
+            return value;
+        }
+
+        auto HashLz4(u32 sequence) noexcept -> u32 {
+            return (sequence * 2654435761U) >> (32U - kLz4HashBits);
+        }
+
+        // Writes the 255-run continuation of a length that did not fit its 4-bit token field.
+        auto WriteLz4Length(usize length, u8* op, const u8* opEnd) noexcept -> u8* {
+            while (length >= 255U) {
+                if (op >= opEnd) {
+                    return nullptr;
+                }
+                *op++ = 255U;
+                length -= 255U;
+            }
+            if (op >= opEnd) {
+                return nullptr;
+            }
+            *op++ = static_cast<u8>(length);
+            return op;
+        }
+
+        auto ReadLz4Length(usize& length, const u8*& ip, const u8* ipEnd) noexcept -> bool {
+            u8 value = 0U;
+            do {
+                if (ip >= ipEnd) {
+                    return false;
+                }
+                value = *ip++;
+                length += value;
+            } while (value == 255U);
+            return true;
+        }
+
+        // Emits literals [anchor, anchor + literalCount) followed by a match, or only the
+        // literals when `matchLength` is 0 (the final sequence).
+        auto WriteLz4Sequence(const u8* anchor, usize literalCount, usize offset,
+            usize matchLength, u8* op, const u8* opEnd) noexcept -> u8* {
+            if (op >= opEnd) {
+                return nullptr;
+            }
+            u8* token = op++;
+            *token    = 0U;
+
+            if (literalCount >= 15U) {
+                *token = 15U << 4U;
+                op     = WriteLz4Length(literalCount - 15U, op, opEnd);
+                if (op == nullptr) {
+                    return nullptr;
+                }
+            } else {
+                *token = static_cast<u8>(literalCount << 4U);
+            }
+            if (static_cast<usize>(opEnd - op) < literalCount) {
+                return nullptr;
+            }
+            std::memcpy(op, anchor, literalCount);
+            op += literalCount;
+
+            if (matchLength == 0U) {
+                return op;
+            }
+            if (static_cast<usize>(opEnd - op) < 2U) {
+                return nullptr;
+            }
+            *op++ = static_cast<u8>(offset & 0xffU);
+            *op++ = static_cast<u8>(offset >> 8U);
+
+            const usize extra = matchLength - kLz4MinMatch;
+            if (extra >= 15U) {
+                *token |= 15U;
+                op = WriteLz4Length(extra - 15U, op, opEnd);
+            } else {
+                *token |= static_cast<u8>(extra);
+            }
+            return op;
+        }
+
+        auto CompressLz4(const u8* src, usize srcSize, u8* dst, usize dstCapacity) noexcept
+            -> usize {
+            const u8* opEnd  = dst + dstCapacity;
+            u8*       op     = dst;
+            usize     anchor = 0U;
+
+            if (srcSize > kLz4MatchLimit) {
+                // Positions are stored +1 so that 0 marks an empty slot.
+                u32         table[1U << kLz4HashBits]{};
+                const usize matchStartLimit = srcSize - kLz4MatchLimit;
+                const usize matchEndLimit   = srcSize - kLz4LastLiterals;
+                usize       ip              = 0U;
+                u32         misses          = 0U;
+
+                while (ip < matchStartLimit) {
+                    const u32   sequence = Read32(src + ip);
+                    const u32   hash     = HashLz4(sequence);
+                    const usize ref      = table[hash];
+                    table[hash]          = static_cast<u32>(ip + 1U);
+
+                    if (ref == 0U || ip - (ref - 1U) > kLz4MaxOffset
+                        || Read32(src + ref - 1U) != sequence) {
+                        ip += 1U + (misses++ >> kLz4SkipTrigger);
+                        continue;
+                    }
+
+                    const usize matchPos = ref - 1U;
+                    usize       length   = kLz4MinMatch;
+                    while (ip + length < matchEndLimit
+                        && src[matchPos + length] == src[ip + length]) {
+                        ++length;
+                    }
+
+                    op = WriteLz4Sequence(
+                        src + anchor, ip - anchor, ip - matchPos, length, op, opEnd);
+                    if (op == nullptr) {
+                        return 0U;
+                    }
+                    ip += length;
+                    anchor = ip;
+                    misses = 0U;
+                }
+            }
+
+            op = WriteLz4Sequence(src + anchor, srcSize - anchor, 0U, 0U, op, opEnd);
+            return (op == nullptr) ? 0U : static_cast<usize>(op - dst);
+        }
+
+        auto DecompressLz4(const u8* src, usize srcSize, u8* dst, usize rawSize) noexcept
+            -> bool {
+            const u8* ip    = src;
+            const u8* ipEnd = src + srcSize;
+            u8*       op    = dst;
+            u8* const opEnd = dst + rawSize;
+
+            while (ip < ipEnd) {
+                const u8 token        = *ip++;
+                usize    literalCount = token >> 4U;
+                if (literalCount == 15U && !ReadLz4Length(literalCount, ip, ipEnd)) {
+                    return false;
+                }
+                if (static_cast<usize>(ipEnd - ip) < literalCount
+                    || static_cast<usize>(opEnd - op) < literalCount) {
+                    return false;
+                }
+                std::memcpy(op, ip, literalCount);
+                ip += literalCount;
+                op += literalCount;
+
+                if (ip == ipEnd) {
+                    break;
+                }
+                if (ipEnd - ip < 2) {
+                    return false;
+                }
+                const usize offset =
+                    static_cast<usize>(ip[0]) | (static_cast<usize>(ip[1]) << 8U);
+                ip += 2;
+                if (offset == 0U || offset > static_cast<usize>(op - dst)) {
+                    return false;
+                }
+
+                usize matchLength = token & 15U;
+                if (matchLength == 15U && !ReadLz4Length(matchLength, ip, ipEnd)) {
+                    return false;
+                }
+                matchLength += kLz4MinMatch;
+                if (static_cast<usize>(opEnd - op) < matchLength) {
+                    return false;
+                }
+
+                // An overlapping match repeats the last `offset` bytes. Short periods (runs) are
+                // copied bytewise; longer ones one period at a time so every memcpy is disjoint.
+                if (offset < 8U) {
+                    const u8* match = op - offset;
+                    for (usize index = 0U; index < matchLength; ++index) {
+                        op[index] = match[index];
+                    }
+                    op += matchLength;
+                    matchLength = 0U;
+                }
+                while (matchLength > 0U) {
+                    const usize count = (offset < matchLength) ? offset : matchLength;
+                    std::memcpy(op, op - offset, count);
+                    op += count;
+                    matchLength -= count;
+                }
+            }
+            return op == opEnd;
+        }
+    } // namespace
+
+    auto IsCompressionSupported(EBundleCompression compression) noexcept -> bool {
+        switch (compression) {
+            case EBundleCompression::None:
+            case EBundleCompression::Lz4:
+                return true;
+            case EBundleCompression::Zstd:
+                return AE_ASSET_ENABLE_ZSTD != 0;
+            default:
+                return false;
+        }
+    }
+
+    auto GetCompressBound(EBundleCompression compression, usize rawSize) noexcept -> usize {
+        switch (compression) {
+            case EBundleCompression::None:
+                return rawSize;
+            case EBundleCompression::Lz4:
+                return rawSize + rawSize / 255U + 16U;
+#if AE_ASSET_ENABLE_ZSTD
+            case EBundleCompression::Zstd:
+                return ZSTD_compressBound(rawSize);
+#endif
+            default:
+                return 0U;
+        }
+    }
+
+    auto CompressBlock(EBundleCompression compression, const u8* src, usize srcSize, u8* dst,
+        usize dstCapacity) noexcept -> usize {
+        if (src == nullptr || dst == nullptr || srcSize == 0U) {
+            return 0U;
+        }
+        switch (compression) {
+            case EBundleCompression::Lz4:
+                return CompressLz4(src, srcSize, dst, dstCapacity);
+#if AE_ASSET_ENABLE_ZSTD
+            case EBundleCompression::Zstd:
+            {
+                const usize written = ZSTD_compress(dst, dstCapacity, src, srcSize, 3);
+                return ZSTD_isError(written) ? 0U : written;
+            }
+#endif
+            default:
+                return 0U;
+        }
+    }
+
+    auto DecompressBlock(EBundleCompression compression, const u8* src, usize srcSize, u8* dst,
+        usize rawSize) noexcept -> bool {
+        if (src == nullptr || dst == nullptr) {
+            return false;
+        }
+        switch (compression) {
+            case EBundleCompression::None:
+                if (srcSize != rawSize) {
+                    return false;
+                }
+                std::memcpy(dst, src, rawSize);
+                return true;
+            case EBundleCompression::Lz4:
+                return DecompressLz4(src, srcSize, dst, rawSize);
+#if AE_ASSET_ENABLE_ZSTD
+            case EBundleCompression::Zstd:
+            {
+                const usize written = ZSTD_decompress(dst, rawSize, src, srcSize);
+                return !ZSTD_isError(written) && written == rawSize;
+            }
+#endif
+            default:
+                return false;
+        }
+    }
+} // namespace AltinaEngine::Asset::Detail
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Asset/AssetBundle.h"
+#include "Types/Aliases.h"
+
+namespace AltinaEngine::Asset::Detail {
+    // Block codecs used for bundle chunks. Every chunk is compressed on its own, so chunks can be
+    // decoded independently and in any order.
+    //
+    // Lz4 uses the LZ4 block format (no frame header) and is always available. Zstd is only
+    // available when the module was built with AE_ASSET_ENABLE_ZSTD.
+    [[nodiscard]] auto IsCompressionSupported(EBundleCompression compression) noexcept -> bool;
+
+    // Upper bound of the compressed size of `rawSize` input bytes.
+    [[nodiscard]] auto GetCompressBound(EBundleCompression compression, usize rawSize) noexcept
+        -> usize;
+
+    // Returns the number of bytes written to `dst`, or 0 if the codec failed or `dstCapacity`
+    // was too small.
+    [[nodiscard]] auto CompressBlock(EBundleCompression compression, const u8* src, usize srcSize,
+        u8* dst, usize dstCapacity) noexcept -> usize;
+
+    // Succeeds only if `src` decodes to exactly `rawSize` bytes. Corrupt input never writes past
+    // `dst + rawSize`.
+    [[nodiscard]] auto DecompressBlock(EBundleCompression compression, const u8* src,
+        usize srcSize, u8* dst, usize rawSize) noexcept -> bool;
+} // namespace AltinaEngine::Asset::Detail
@@ -400,11 +400,10 @@ namespace AltinaEngine::Asset {
                     continue;
                 }
 
-                const Container::FNativeStringView key(pair.Key.GetData(), pair.Key.Length());
+                const Container::FNativeStringView key = pair.Key;
 
                 if (pair.Value->Type == EJsonType::String) {
-                    const Container::FNativeStringView text(
-                        pair.Value->String.GetData(), pair.Value->String.Length());
+                    const Container::FNativeStringView text = pair.Value->String;
 
                     if (KeyEquals(key, "fillmode")) {
                         EMaterialRasterFillMode mode{};
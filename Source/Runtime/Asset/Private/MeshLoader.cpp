@@ -5,6 +5,8 @@
 #include "Types/NumericProperties.h"
 #include "Types/Traits.h"
 
+#include <cstring>
+
 using AltinaEngine::Forward;
 using AltinaEngine::Move;
 using AltinaEngine::Core::Container::DestroyPolymorphic;
@@ -29,6 +31,27 @@ namespace AltinaEngine::Asset {
             return true;
         }
 
+        // Copies `size` payload bytes starting at `offset` into `out`. Memory-backed streams
+        // (mapped bundle entries, files read into memory) are copied straight from GetData();
+        // other streams are read through Seek/Read.
+        auto CopyPayload(IAssetStream& stream, usize offset, usize size, TVector<u8>& out)
+            -> bool {
+            out.Resize(size);
+            if (size == 0U) {
+                return true;
+            }
+            if (const u8* data = stream.GetData()) {
+                const usize streamSize = stream.Size();
+                if (offset > streamSize || size > streamSize - offset) {
+                    return false;
+                }
+                std::memcpy(out.Data(), data + offset, static_cast<size_t>(size));
+                return true;
+            }
+            stream.Seek(offset);
+            return ReadExact(stream, out.Data(), size);
+        }
+
         auto ReadHeader(IAssetStream& stream, FAssetBlobHeader& outHeader) -> bool {
             if (!ReadExact(stream, &outHeader, sizeof(FAssetBlobHeader))) {
                 return false;
@@ -180,19 +203,14 @@ namespace AltinaEngine::Asset {
         }
 
         TVector<u8> vertexData;
-        vertexData.Resize(static_cast<usize>(blobDesc.mVertexDataSize));
-        stream.Seek(baseOffset + static_cast<usize>(blobDesc.mVertexDataOffset));
-        if (blobDesc.mVertexDataSize > 0U
-            && !ReadExact(
-                stream, vertexData.Data(), static_cast<usize>(blobDesc.mVertexDataSize))) {
+        if (!CopyPayload(stream, baseOffset + static_cast<usize>(blobDesc.mVertexDataOffset),
+                static_cast<usize>(blobDesc.mVertexDataSize), vertexData)) {
             return {};
         }
 
         TVector<u8> indexData;
-        indexData.Resize(static_cast<usize>(blobDesc.mIndexDataSize));
-        stream.Seek(baseOffset + static_cast<usize>(blobDesc.mIndexDataOffset));
-        if (blobDesc.mIndexDataSize > 0U
-            && !ReadExact(stream, indexData.Data(), static_cast<usize>(blobDesc.mIndexDataSize))) {
+        if (!CopyPayload(stream, baseOffset + static_cast<usize>(blobDesc.mIndexDataOffset),
+                static_cast<usize>(blobDesc.mIndexDataSize), indexData)) {
             return {};
         }
 
@@ -31,6 +31,27 @@ namespace AltinaEngine::Asset {
             return true;
         }
 
+        // Copies `size` payload bytes starting at `offset` into `out`. Memory-backed streams
+        // (mapped bundle entries, files read into memory) are copied straight from GetData();
+        // other streams are read through Seek/Read.
+        auto CopyPayload(IAssetStream& stream, usize offset, usize size, TVector<u8>& out)
+            -> bool {
+            out.Resize(size);
+            if (size == 0U) {
+                return true;
+            }
+            if (const u8* data = stream.GetData()) {
+                const usize streamSize = stream.Size();
+                if (offset > streamSize || size > streamSize - offset) {
+                    return false;
+                }
+                std::memcpy(out.Data(), data + offset, static_cast<size_t>(size));
+                return true;
+            }
+            stream.Seek(offset);
+            return ReadExact(stream, out.Data(), size);
+        }
+
         auto HasCompleteTextureDesc(const FTexture2DDesc& desc) noexcept -> bool {
             return desc.Width > 0U && desc.Height > 0U && desc.MipCount > 0U && desc.Format > 0U;
         }
@@ -156,8 +177,7 @@ namespace AltinaEngine::Asset {
         }
 
         TVector<u8> pixels;
-        pixels.Resize(static_cast<usize>(header.mDataSize));
-        if (header.mDataSize > 0 && !ReadExact(stream, pixels.Data(), header.mDataSize)) {
+        if (!CopyPayload(stream, stream.Tell(), static_cast<usize>(header.mDataSize), pixels)) {
             return {};
         }
 
@@ -1,16 +1,17 @@
 #pragma once
 
 #include "Asset/AssetTypes.h"
+#include "Container/HashMap.h"
 #include "Container/String.h"
 #include "Container/Vector.h"
+#include "Platform/PlatformFileSystem.h"
 #include "Types/Aliases.h"
 #include "Utility/Uuid.h"
 
-#include <fstream>
-
 namespace AltinaEngine::Asset {
     namespace Container = Core::Container;
     using Container::FString;
+    using Container::THashMap;
     using Container::TVector;
 
     constexpr u32 kBundleMagic   = 0x31424541u; // "AEB1"
@@ -61,6 +62,9 @@ namespace AltinaEngine::Asset {
         u32 mChunkTableOffset = 0;
     };
 
+    // Chunk tables live in the index block after the entries; an entry's mChunkTableOffset is
+    // relative to the header's mIndexOffset. Chunk offsets are absolute file offsets, and a
+    // chunk whose Size equals its RawSize is stored uncompressed.
     struct AE_ASSET_API FBundleChunkDesc {
         u64 Offset  = 0;
         u64 Size    = 0;
@@ -68,11 +72,20 @@ namespace AltinaEngine::Asset {
     };
 #pragma pack(pop)
 
+    // Reads entries from a bundle file. After Open, ReadEntry may be called from any number of
+    // threads at once: every read is positional, and the chunks of a compressed entry are read
+    // and decoded in parallel on the job system.
+    //
+    // The file is also memory-mapped, so uncompressed entries can be used in place through
+    // GetEntryData without any copy.
     class AE_ASSET_API FAssetBundleReader final {
     public:
         FAssetBundleReader() = default;
         ~FAssetBundleReader();
 
+        FAssetBundleReader(const FAssetBundleReader&)                    = delete;
+        auto operator=(const FAssetBundleReader&) -> FAssetBundleReader& = delete;
+
         auto               Open(const FString& path) -> bool;
         void               Close();
         [[nodiscard]] auto IsOpen() const noexcept -> bool;
@@ -81,12 +94,59 @@ namespace AltinaEngine::Asset {
 
         auto GetEntry(const FUuid& uuid, FBundleIndexEntry& outEntry) const noexcept -> bool;
         auto ReadEntry(const FBundleIndexEntry& entry, TVector<u8>& outBytes) const -> bool;
+        // Pointer to the mSize bytes of an uncompressed, unchunked entry inside the mapped file,
+        // valid until Close. Null for compressed entries or when the file could not be mapped.
+        [[nodiscard]] auto GetEntryData(const FBundleIndexEntry& entry) const noexcept
+            -> const u8*;
+
+    private:
+        auto ReadChunk(const FBundleIndexEntry& entry, const FBundleChunkDesc& chunk, u8* dst,
+            TVector<u8>& scratch) const -> bool;
+
+        Core::Platform::FFileHandle  mFile = nullptr;
+        Core::Platform::FFileMapping mMapping{};
+        FBundleHeader                mHeader{};
+        TVector<FBundleIndexEntry>   mEntries;
+        THashMap<FUuid, u32>         mEntryByUuid;
+        // The whole index block, kept for the chunk tables.
+        TVector<u8>                  mIndexData;
+        u64                          mFileSize = 0;
+    };
+
+    // Builds a bundle. Entries are split into chunks of at most `chunkSize` raw bytes that are
+    // compressed independently (in parallel on the job system when adding an entry), so readers
+    // can decode them in parallel as well. Chunks that do not shrink are stored raw, and an
+    // entry where no chunk shrinks is written as a plain uncompressed entry.
+    class AE_ASSET_API FAssetBundleWriter final {
+    public:
+        static constexpr u32 kDefaultChunkSize = 256U * 1024U;
+
+        explicit FAssetBundleWriter(EBundleCompression compression = EBundleCompression::Lz4,
+            u32 chunkSize = kDefaultChunkSize) noexcept;
+
+        // Returns false for empty data, a UUID that was already added, or a compression the
+        // module was built without.
+        auto AddEntry(const FUuid& uuid, EAssetType type, const u8* data, usize size) -> bool;
+        [[nodiscard]] auto GetEntryCount() const noexcept -> usize { return mEntries.Size(); }
+        // Stored (on-disk) payload bytes over all entries added so far.
+        [[nodiscard]] auto GetPayloadSize() const noexcept -> u64 { return mPayloadSize; }
+
+        void               Build(TVector<u8>& outBytes) const;
+        auto               WriteToFile(const FString& path) const -> bool;
 
     private:
-        mutable std::ifstream      mFile;
-        FBundleHeader              mHeader{};
-        TVector<FBundleIndexEntry> mEntries;
-        u64                        mFileSize = 0;
+        struct FPendingEntry {
+            FBundleIndexEntry         mEntry{};
+            // Offsets are relative to the entry's payload until Build places it.
+            TVector<FBundleChunkDesc> mChunks;
+            TVector<u8>               mPayload;
+        };
+
+        EBundleCompression     mCompression = EBundleCompression::Lz4;
+        u32                    mChunkSize   = kDefaultChunkSize;
+        TVector<FPendingEntry> mEntries;
+        THashMap<FUuid, u32>   mEntryByUuid;
+        u64                    mPayloadSize = 0;
     };
 
 } // namespace AltinaEngine::Asset
@@ -20,6 +20,12 @@ namespace AltinaEngine::Asset {
         [[nodiscard]] virtual auto Tell() const noexcept -> usize                    = 0;
         virtual void               Seek(usize offset) noexcept                       = 0;
         virtual auto               Read(void* outBuffer, usize bytesToRead) -> usize = 0;
+
+        // Memory-backed streams (a mapped bundle entry, an in-memory blob) expose all Size()
+        // bytes here, so loaders can consume payloads in place instead of copying them out
+        // through Read. Valid for the duration of IAssetLoader::Load; null for streams that
+        // read from a file.
+        [[nodiscard]] virtual auto GetData() const noexcept -> const u8* { return nullptr; }
     };
 
     class AE_ASSET_API IAssetLoader {
@@ -1,42 +1,147 @@
 #pragma once
 
+#include "Asset/AssetBundle.h"
 #include "Asset/AssetLoader.h"
 #include "Asset/AssetRegistry.h"
+#include "Container/HashMap.h"
 #include "Container/SmartPtr.h"
 #include "Container/Vector.h"
+#include "Jobs/Parallel.h"
+#include "Threading/Mutex.h"
 
 namespace AltinaEngine::Asset {
     namespace Container = Core::Container;
+    using Container::THashMap;
     using Container::TShared;
     using Container::TVector;
 
+    class FAssetManager;
+    struct FAssetLoadRequest;
+
+    enum class EAssetLoadState : u8 {
+        Pending = 0, // Queued, or waiting for its dependencies.
+        Loading,     // File I/O and decode are running on a worker.
+        Loaded,
+        Failed,
+        Cancelled
+    };
+
+    // Future-like view of a load started by FAssetManager::LoadAsync. Copies refer to the same
+    // request; a default-constructed handle refers to none.
+    class AE_ASSET_API FAssetLoadHandle {
+    public:
+        FAssetLoadHandle() = default;
+
+        [[nodiscard]] auto IsValid() const noexcept -> bool;
+        [[nodiscard]] auto GetAssetHandle() const noexcept -> FAssetHandle;
+        [[nodiscard]] auto GetState() const noexcept -> EAssetLoadState;
+        [[nodiscard]] auto IsDone() const noexcept -> bool;
+
+        // Blocks until the request finished. Runs queued jobs on the calling thread meanwhile,
+        // so waiting from a job does not starve the pool.
+        void               Wait() const noexcept;
+        // Waits, then returns the asset (null if the load failed or was cancelled).
+        [[nodiscard]] auto Get() const -> TShared<IAsset>;
+
+        // Drops a request that has not started decoding yet. Dependencies pulled in only for
+        // this request are dropped with it. Returns false once decoding began, while another
+        // pending request still depends on this one, or while a blocking Load() waits on it.
+        auto               Cancel() -> bool;
+        // Changes the order in which pending requests are picked up (higher runs first). The
+        // request's pending dependencies are raised to at least the same priority.
+        void               SetPriority(i32 priority);
+
+    private:
+        friend class FAssetManager;
+
+        explicit FAssetLoadHandle(TShared<FAssetLoadRequest> request) noexcept;
+
+        TShared<FAssetLoadRequest> mRequest;
+    };
+
+    // Loads assets described by an FAssetRegistry and caches them by UUID.
+    //
+    // Load() decodes on the calling thread. LoadAsync() queues the asset and its registry
+    // dependencies; file I/O and decode run on the job system, and an asset is only decoded
+    // once all of its dependencies finished. Ready requests are picked up by priority, so a
+    // bump takes effect for everything that has not started yet.
+    //
+    // Assets found in a registered bundle are read from it instead of their cooked file.
+    // Uncompressed entries are handed to the loader straight from the mapped bundle, without
+    // copying the file into memory first.
+    //
+    // The manager may be used from any thread. The registry, the registered loaders and the
+    // registered bundles must not change while loads are in flight; loaders are called
+    // concurrently.
     class AE_ASSET_API FAssetManager {
     public:
         FAssetManager();
+        ~FAssetManager();
+
+        FAssetManager(const FAssetManager&)                    = delete;
+        auto operator=(const FAssetManager&) -> FAssetManager& = delete;
 
         void               SetRegistry(const FAssetRegistry* registry) noexcept;
 
         void               RegisterLoader(IAssetLoader* loader);
         void               UnregisterLoader(IAssetLoader* loader);
 
+        // The bundle must stay open while registered. When several bundles contain an asset,
+        // the one registered last wins.
+        void               RegisterBundle(const FAssetBundleReader* bundle);
+        void               UnregisterBundle(const FAssetBundleReader* bundle);
+
         [[nodiscard]] auto Load(const FAssetHandle& handle) -> TShared<IAsset>;
+        // Requesting an asset that is already in flight returns the existing request and raises
+        // its priority if `priority` is higher.
+        [[nodiscard]] auto LoadAsync(const FAssetHandle& handle, i32 priority = 0)
+            -> FAssetLoadHandle;
+        // Cancels every request that has not started decoding and waits for the rest.
+        void               FlushAsyncLoads();
+
         void               Unload(const FAssetHandle& handle);
         void               ClearCache();
 
         [[nodiscard]] auto FindLoaded(const FAssetHandle& handle) const -> TShared<IAsset>;
 
     private:
+        friend class FAssetLoadHandle;
+
+        using FRequestRef = TShared<FAssetLoadRequest>;
+
         struct FCacheEntry {
             FAssetHandle    mHandle;
             TShared<IAsset> mAsset;
         };
 
-        [[nodiscard]] auto     FindLoader(EAssetType type) const noexcept -> IAssetLoader*;
-        [[nodiscard]] auto     FindCacheIndex(const FAssetHandle& handle) const noexcept -> isize;
+        [[nodiscard]] auto FindLoader(EAssetType type) const noexcept -> IAssetLoader*;
+        [[nodiscard]] auto FindBundleLocked(const FUuid& uuid) const noexcept
+            -> const FAssetBundleReader*;
+        [[nodiscard]] auto FindLoadedLocked(const FAssetHandle& handle) const -> TShared<IAsset>;
+
+        auto               EnqueueLocked(const FAssetHandle& handle, i32 priority,
+            TVector<FUuid>& visiting, u32& outReadyCount) -> FRequestRef;
+        void               RaisePriorityLocked(FAssetLoadRequest& request, i32 priority);
+        auto               CancelLocked(const FRequestRef& request) -> bool;
+        void               CompleteLocked(
+            const FRequestRef& request, TShared<IAsset> asset, u32& outReadyCount);
+        auto               PopReadyLocked() -> FRequestRef;
+
+        void               SubmitLoadJobs(u32 count);
+        void               RunNextLoad();
+        auto               CancelRequest(const FRequestRef& request) -> bool;
+        void               SetRequestPriority(const FRequestRef& request, i32 priority);
+
+        const FAssetRegistry*              mRegistry = nullptr;
+        TVector<IAssetLoader*>             mLoaders;
+        TVector<const FAssetBundleReader*> mBundles;
+        THashMap<FUuid, FCacheEntry>       mCache;
 
-        const FAssetRegistry*  mRegistry = nullptr;
-        TVector<IAssetLoader*> mLoaders;
-        TVector<FCacheEntry>   mCache;
+        mutable Core::Threading::FMutex    mMutex;
+        THashMap<FUuid, FRequestRef>       mInFlight;
+        TVector<FRequestRef>               mReady;
+        u64                                mNextSequence = 0ULL;
+        Core::Jobs::FWaitGroup             mLoadJobs;
     };
 
 } // namespace AltinaEngine::Asset
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Asset/AssetTypes.h"
+#include "Container/HashMap.h"
 
 namespace AltinaEngine::Asset {
     namespace Container = Core::Container;
@@ -8,8 +9,12 @@ namespace AltinaEngine::Asset {
     using Container::FNativeStringView;
     using Container::FString;
     using Container::FStringView;
+    using Container::THashMap;
     using Container::TVector;
 
+    // Lookups by UUID and by virtual path (case-insensitive) go through hash indices that
+    // LoadFromJsonText rebuilds and AddAsset/AddRedirector keep current. Redirector chains are
+    // collapsed when indexed, so resolving one is a single lookup however often it moved.
     class AE_ASSET_API FAssetRegistry {
     public:
         [[nodiscard]] auto LoadFromJsonFile(const FString& path) -> bool;
@@ -25,13 +30,42 @@ namespace AltinaEngine::Asset {
         [[nodiscard]] auto GetDesc(const FAssetHandle& handle) const noexcept -> const FAssetDesc*;
         [[nodiscard]] auto GetDependencies(const FAssetHandle& handle) const noexcept
             -> const TVector<FAssetHandle>*;
+        // Follows redirectors to the final asset. A handle with an unknown type (as stored in
+        // dependency lists) gets the registered asset's type.
         [[nodiscard]] auto ResolveRedirector(const FAssetHandle& handle) const noexcept
             -> FAssetHandle;
 
     private:
+        void                      IndexAsset(u32 index);
+        void                      RebuildIndices();
+        void                      IndexRedirector(u32 index);
+        void                      RebuildRedirectorIndex();
+        [[nodiscard]] auto        GetRedirectorTarget(u32 index) const noexcept -> const FUuid&;
+        [[nodiscard]] auto        FindAssetIndex(const FUuid& uuid) const noexcept -> u32;
+
         TVector<FAssetDesc>       mAssets;
         TVector<FAssetRedirector> mRedirectors;
         FNativeString             mLastError;
+
+        // Path indices key on a hash of the lower-cased path; entries whose paths differ but
+        // share a hash are chained through the matching `*PathNext` array.
+        THashMap<FUuid, u32>      mAssetByUuid;
+        THashMap<u64, u32>        mAssetByPath;
+        TVector<u32>              mAssetPathNext;
+        THashMap<FUuid, u32>      mRedirectorByUuid;
+        THashMap<u64, u32>        mRedirectorByPath;
+        TVector<u32>              mRedirectorPathNext;
+
+        // Redirectors whose chains end at the same UUID share an FRedirectorChain, so a new hop
+        // at that UUID retargets them all at once. Redirectors running into a cycle have no
+        // chain and keep their own target.
+        struct FRedirectorChain {
+            FUuid        mEnd;
+            TVector<u32> mMembers;
+        };
+        TVector<FRedirectorChain> mRedirectorChains;
+        THashMap<FUuid, u32>      mRedirectorChainByEnd;
+        TVector<u32>              mRedirectorChainOf;
     };
 
 } // namespace AltinaEngine::Asset
@@ -242,21 +242,31 @@ namespace AltinaEngine::Core::Console {
 
     FConsoleVariable* FConsoleVariable::RegisterInternal(
         const FString& name, FConsoleValue&& value, EType type, ECVarFlags flags) noexcept {
+        // None would be shared by every variable whose name could not be interned.
+        const FName key(name.ToView());
+        if (key.IsNone()) {
+            return nullptr;
+        }
         FScopedLock lock(gRegistryMutex);
-        auto        it = gRegistry.FindIt(name);
+        auto        it = gRegistry.FindIt(key);
         if (it != gRegistry.end())
             return it->second.Get();
         auto var = MakeShared<FConsoleVariable>(name, Move(value), type, flags);
-        gRegistry.Emplace(name, Move(var));
-        return gRegistry.FindIt(name)->second.Get();
+        gRegistry.Emplace(key, Move(var));
+        return gRegistry.FindIt(key)->second.Get();
     }
 
     FConsoleVariable* FConsoleVariable::Find(const FString& name) noexcept {
         if (name.IsEmptyString()) {
             return nullptr;
         }
+        // A name that was never interned cannot belong to a registered variable.
+        const FName key = FName::Find(name.ToView());
+        if (key.IsNone()) {
+            return nullptr;
+        }
         FScopedLock lock(gRegistryMutex);
-        auto        it = gRegistry.FindIt(name);
+        auto        it = gRegistry.FindIt(key);
         return it != gRegistry.end() ? it->second.Get() : nullptr;
     }
 
@@ -345,27 +355,6 @@ namespace AltinaEngine::Core::Console {
         return FString();
     }
 
-    size_t FConsoleVariable::FStringHash::operator()(const FString& s) const noexcept {
-        size_t h    = 5381;
-        auto   view = s.ToView();
-        for (usize i = 0; i < view.Length(); ++i)
-            h = ((h << 5) + h) + static_cast<unsigned char>(view.Data()[i]);
-        return h;
-    }
-
-    bool FConsoleVariable::FStringEqual::operator()(
-        const FString& a, const FString& b) const noexcept {
-        if (a.Length() != b.Length())
-            return false;
-        auto va = a.ToView();
-        auto vb = b.ToView();
-        for (usize i = 0; i < va.Length(); ++i) {
-            if (va.Data()[i] != vb.Data()[i])
-                return false;
-        }
-        return true;
-    }
-
     // static definitions
     FConsoleVariable::RegistryMap FConsoleVariable::gRegistry;
     FMutex                        FConsoleVariable::gRegistryMutex;
@@ -0,0 +1,201 @@
+#include "Container/Name.h"
+
+#include "Logging/Log.h"
+#include "Platform/Generic/GenericPlatformDecl.h"
+
+#include <atomic>
+
+namespace AltinaEngine::Core::Container {
+    using Platform::GetGlobalMemoryAllocator;
+
+    namespace {
+        // Entries are packed into 64 KiB blocks at 4-byte granularity; a handle is the block
+        // index followed by 14 bits of offset. Byte 0 of block 0 is never handed out, which keeps
+        // handle 0 free for None.
+        constexpr u32 kOffsetBits = 14U;
+        constexpr u64 kBlockBytes = 1ULL << (kOffsetBits + 2U);
+        constexpr u32 kMaxBlocks  = 1024U;
+        constexpr u64 kEntryAlign = 4U;
+
+        // Open-addressed slots of (hash tag << 32 | handle), zero when empty. Adding stops at
+        // three quarters load so probe sequences stay short.
+        constexpr u64 kSlotCount  = 1ULL << 18U;
+        constexpr u64 kSlotMask   = kSlotCount - 1U;
+        constexpr u64 kMaxNames   = kSlotCount / 4U * 3U;
+
+        // Followed by the characters and a terminator.
+        struct FEntryHeader {
+            u32 mLength = 0U;
+        };
+
+        std::atomic<u64>  gSlots[kSlotCount];
+        std::atomic<u8*>  gBlocks[kMaxBlocks];
+        std::atomic<u64>  gCursor{ kEntryAlign };
+        std::atomic<u64>  gNameCount{ 0U };
+        std::atomic<bool> gReportedFull{ false };
+
+        // A name that cannot be added resolves to None, which callers keying maps by FName
+        // would silently share. Running out of space is logged once; every later name fails
+        // the same way.
+        void ReportTableFull() noexcept {
+            if (gReportedFull.exchange(true, std::memory_order_relaxed)) {
+                return;
+            }
+            LogErrorCat(TEXT("Core.Name"),
+                TEXT("Name table is out of space ({} names); new names resolve to None."),
+                static_cast<u64>(gNameCount.load(std::memory_order_relaxed)));
+        }
+
+        [[nodiscard]] constexpr auto GetEntryBytes(usize length) noexcept -> u64 {
+            return (sizeof(FEntryHeader) + (length + 1U) * sizeof(TChar) + kEntryAlign - 1U)
+                & ~(kEntryAlign - 1U);
+        }
+
+        auto GetEntry(u32 handle) noexcept -> const FEntryHeader* {
+            const u8* block  = gBlocks[handle >> kOffsetBits].load(std::memory_order_acquire);
+            const u64 offset = static_cast<u64>(handle & ((1U << kOffsetBits) - 1U)) << 2U;
+            return reinterpret_cast<const FEntryHeader*>(block + offset);
+        }
+
+        auto GetText(const FEntryHeader* entry) noexcept -> const TChar* {
+            return reinterpret_cast<const TChar*>(entry + 1);
+        }
+
+        auto EnsureBlock(u64 blockIndex) noexcept -> u8* {
+            std::atomic<u8*>& slot  = gBlocks[blockIndex];
+            u8*               block = slot.load(std::memory_order_acquire);
+            if (block != nullptr) {
+                return block;
+            }
+            auto* allocator = GetGlobalMemoryAllocator();
+            auto* fresh     = static_cast<u8*>(allocator->MemoryAllocate(kBlockBytes, kEntryAlign));
+            if (fresh == nullptr) {
+                return nullptr;
+            }
+            if (!slot.compare_exchange_strong(
+                    block, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                allocator->MemoryFree(fresh);
+                return block;
+            }
+            return fresh;
+        }
+
+        // Appends an entry for `text` to the pool and returns its handle, 0 when out of space.
+        // The caller has checked that the entry fits in a block.
+        auto AllocateEntry(FStringView text) noexcept -> u32 {
+            const u64 bytes = GetEntryBytes(text.Length());
+
+            // Entries never straddle blocks: one that does not fit starts the next block.
+            u64 cursor = gCursor.load(std::memory_order_relaxed);
+            u64 start  = 0U;
+            do {
+                start = cursor;
+                if ((start % kBlockBytes) + bytes > kBlockBytes) {
+                    start = (start / kBlockBytes + 1U) * kBlockBytes;
+                }
+                if (start / kBlockBytes >= kMaxBlocks) {
+                    return 0U;
+                }
+            } while (
+                !gCursor.compare_exchange_weak(cursor, start + bytes, std::memory_order_relaxed));
+
+            u8* block = EnsureBlock(start / kBlockBytes);
+            if (block == nullptr) {
+                return 0U;
+            }
+            auto* entry    = reinterpret_cast<FEntryHeader*>(block + (start % kBlockBytes));
+            entry->mLength = static_cast<u32>(text.Length());
+            auto* chars    = reinterpret_cast<TChar*>(entry + 1);
+            for (usize index = 0U; index < text.Length(); ++index) {
+                chars[index] = text[index];
+            }
+            chars[text.Length()] = static_cast<TChar>(0);
+            return static_cast<u32>(
+                ((start / kBlockBytes) << kOffsetBits) | ((start % kBlockBytes) >> 2U));
+        }
+
+        auto Matches(u32 handle, FStringView text) noexcept -> bool {
+            const FEntryHeader* entry = GetEntry(handle);
+            if (entry->mLength != text.Length()) {
+                return false;
+            }
+            const TChar* chars = GetText(entry);
+            for (usize index = 0U; index < text.Length(); ++index) {
+                if (chars[index] != text[index]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        auto Intern(FStringView text, bool bAdd) noexcept -> u32 {
+            if (text.IsEmpty()) {
+                return 0U;
+            }
+            if (GetEntryBytes(text.Length()) > kBlockBytes) {
+                if (bAdd) {
+                    LogErrorCat(TEXT("Core.Name"),
+                        TEXT("Name of {} characters exceeds the entry limit; it resolves to None."),
+                        static_cast<u64>(text.Length()));
+                }
+                return 0U;
+            }
+            const u64 hash = static_cast<u64>(
+                Detail::HashBytes(text.Data(), text.Length() * sizeof(TChar)));
+            const u64 tag     = (hash >> 32U) << 32U;
+            u32       pending = 0U;
+            for (u64 probe = 0U; probe < kSlotCount; ++probe) {
+                std::atomic<u64>& slot  = gSlots[(hash + probe) & kSlotMask];
+                u64               value = slot.load(std::memory_order_acquire);
+                while (value == 0U) {
+                    if (!bAdd) {
+                        return 0U;
+                    }
+                    if (gNameCount.load(std::memory_order_relaxed) >= kMaxNames) {
+                        ReportTableFull();
+                        return 0U;
+                    }
+                    if (pending == 0U) {
+                        pending = AllocateEntry(text);
+                        if (pending == 0U) {
+                            ReportTableFull();
+                            return 0U;
+                        }
+                    }
+                    // Release publishes the entry text together with the slot.
+                    if (slot.compare_exchange_strong(value, tag | pending,
+                            std::memory_order_release, std::memory_order_acquire)) {
+                        gNameCount.fetch_add(1U, std::memory_order_relaxed);
+                        return pending;
+                    }
+                }
+                // When another thread won the race for the same text, the pending entry is
+                // simply left unused in the pool.
+                const auto handle = static_cast<u32>(value);
+                if ((value & ~0xffffffffULL) == tag && Matches(handle, text)) {
+                    return handle;
+                }
+            }
+            return 0U;
+        }
+    } // namespace
+
+    FName::FName(FStringView text) noexcept : mIndex(Intern(text, true)) {}
+
+    FName::FName(const TChar* text) noexcept
+        : mIndex((text != nullptr) ? Intern(FStringView(text), true) : 0U) {}
+
+    auto FName::Find(FStringView text) noexcept -> FName {
+        FName name;
+        name.mIndex = Intern(text, false);
+        return name;
+    }
+
+    auto FName::ToView() const noexcept -> FStringView {
+        if (mIndex == 0U) {
+            return {};
+        }
+        const FEntryHeader* entry = GetEntry(mIndex);
+        return { GetText(entry), entry->mLength };
+    }
+} // namespace AltinaEngine::Core::Container
@@ -4,7 +4,12 @@
 #include "../../Public/Container/HashMap.h"
 #include "../../Public/Container/String.h"
 #include "../../Public/Container/SmartPtr.h"
+#include <atomic>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 
 using AltinaEngine::Move;
 
@@ -34,10 +39,13 @@ namespace AltinaEngine::Core::Instrumentation {
     // Per-thread name stored in thread_local for fast reads.
     thread_local const char*                          tThreadName = nullptr;
 
+    static void SetTraceThreadName(const char* name) noexcept;
+
     void SetCurrentThreadName(const char* name) noexcept {
         tThreadName = name;
         if (name == nullptr)
             return;
+        SetTraceThreadName(name);
 
         // Ensure a placeholder counter entry exists for visibility tools.
         Threading::FScopedLock lk(gMutex);
@@ -115,13 +123,313 @@ namespace AltinaEngine::Core::Instrumentation {
             duration_cast<milliseconds>(now.time_since_epoch()).count());
     }
 
-    FScopedTimer::FScopedTimer(const char* name) noexcept : mName(name), mStartMs(NowMs()) {}
+    // Timed scopes also show up in trace captures.
+    FScopedTimer::FScopedTimer(const char* name) noexcept
+        : mName(name), mStartMs(NowMs()), mTraced(name != nullptr && BeginTraceScope(name)) {}
 
     FScopedTimer::~FScopedTimer() noexcept {
+        if (mTraced)
+            EndTraceScope();
         if (!mName)
             return;
         const auto elapsed = NowMs() - mStartMs;
         RecordTimingMs(mName, elapsed);
     }
 
+    // -------------------------------------------------------------------------
+    // Trace capture
+    // -------------------------------------------------------------------------
+
+    namespace {
+        enum class ETraceEventType : u8 {
+            Begin,
+            End,
+        };
+
+        struct FTraceEvent {
+            u64             mTimestampNs = 0;
+            const char*     mName        = nullptr;
+            ETraceEventType mType        = ETraceEventType::Begin;
+        };
+
+        // Ring slot. The exporter may read a slot while the producer overwrites it after a lap,
+        // so every field is a relaxed atomic; lapped slots are detected and dropped afterwards.
+        struct FTraceEventSlot {
+            std::atomic<u64>             mTimestampNs{ 0 };
+            std::atomic<const char*>     mName{ nullptr };
+            std::atomic<ETraceEventType> mType{ ETraceEventType::Begin };
+        };
+
+        constexpr u64   kTraceBufferCapacity = 1ULL << 15; // events per thread, power of two
+        constexpr usize kTraceThreadNameMax  = 64;
+
+        // Single producer (the owning thread). `mCommitted` counts fully written events and is
+        // published with release; the exporter acquires it, reads only slots below it, and
+        // discards anything the producer may have overwritten while it was copying.
+        struct FTraceThreadBuffer {
+            FTraceEventSlot  mEvents[kTraceBufferCapacity];
+            std::atomic<u64> mCommitted{ 0 };
+            u32              mThreadId = 0;
+            char             mName[kTraceThreadNameMax]{}; // guarded by gTraceRegistryMutex
+        };
+
+        std::atomic<bool>                       gTraceActive{ false };
+        std::atomic<u64>                        gTraceCaptureStartNs{ 0 };
+        std::atomic<u64>                        gTraceCaptureEndNs{ ~0ULL };
+        Threading::FMutex                       gTraceRegistryMutex;
+        // Every buffer ever allocated, exported in order. Buffers of exited threads stay listed
+        // (their events remain exportable) until a new thread takes them from the free list.
+        Container::TVector<FTraceThreadBuffer*> gTraceBuffers;
+        Container::TVector<FTraceThreadBuffer*> gTraceFreeBuffers;
+        u32                                     gTraceNextThreadId  = 1;
+        thread_local FTraceThreadBuffer*        tTraceBuffer        = nullptr;
+        thread_local bool                       tTraceThreadExiting = false;
+
+        void ReleaseTraceBuffer(FTraceThreadBuffer* buffer) noexcept {
+            Threading::FScopedLock lock(gTraceRegistryMutex);
+            gTraceFreeBuffers.PushBack(buffer);
+        }
+
+        // Returns the thread's buffer to the free list when the thread exits, so worker threads
+        // that retire and respawn reuse buffers instead of growing the registry.
+        struct FTraceBufferReleaser {
+            bool mArmed = false; // written on acquire so the destructor gets registered
+            ~FTraceBufferReleaser() {
+                tTraceThreadExiting = true;
+                if (tTraceBuffer != nullptr) {
+                    ReleaseTraceBuffer(tTraceBuffer);
+                    tTraceBuffer = nullptr;
+                }
+            }
+        };
+        thread_local FTraceBufferReleaser tTraceBufferReleaser;
+
+        auto TraceNowNs() noexcept -> u64 {
+            static const auto kEpoch = std::chrono::steady_clock::now();
+            return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - kEpoch)
+                    .count());
+        }
+
+        void CopyThreadName(FTraceThreadBuffer& buffer, const char* name) noexcept {
+            const usize length = (name != nullptr) ? std::strlen(name) : 0;
+            const usize copy =
+                length < kTraceThreadNameMax - 1 ? length : kTraceThreadNameMax - 1;
+            if (copy > 0)
+                std::memcpy(buffer.mName, name, copy);
+            buffer.mName[copy] = '\0';
+        }
+
+        // Null once the thread is tearing down its thread_locals; tracing is dropped then.
+        auto AcquireTraceBuffer() noexcept -> FTraceThreadBuffer* {
+            if (tTraceBuffer != nullptr)
+                return tTraceBuffer;
+            if (tTraceThreadExiting)
+                return nullptr;
+
+            FTraceThreadBuffer* buffer = nullptr;
+            {
+                Threading::FScopedLock lock(gTraceRegistryMutex);
+                if (!gTraceFreeBuffers.IsEmpty()) {
+                    // The previous owner's events are discarded and the buffer gets a fresh
+                    // thread id below.
+                    buffer = gTraceFreeBuffers.Back();
+                    gTraceFreeBuffers.PopBack();
+                    buffer->mCommitted.store(0, std::memory_order_relaxed);
+                } else {
+                    buffer = new FTraceThreadBuffer();
+                    gTraceBuffers.PushBack(buffer);
+                }
+                buffer->mThreadId = gTraceNextThreadId++;
+                CopyThreadName(*buffer, tThreadName);
+            }
+            tTraceBufferReleaser.mArmed = true;
+            tTraceBuffer                = buffer;
+            return buffer;
+        }
+
+        void PushTraceEvent(FTraceThreadBuffer& buffer, const char* name, ETraceEventType type) {
+            const u64 committed = buffer.mCommitted.load(std::memory_order_relaxed);
+            auto&     slot      = buffer.mEvents[committed & (kTraceBufferCapacity - 1ULL)];
+            // An exporter that observes any of the stores below also observes `committed`, so
+            // it can tell the slot was being lapped.
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.mTimestampNs.store(TraceNowNs(), std::memory_order_relaxed);
+            slot.mName.store(name, std::memory_order_relaxed);
+            slot.mType.store(type, std::memory_order_relaxed);
+            buffer.mCommitted.store(committed + 1ULL, std::memory_order_release);
+        }
+
+        void AppendJsonString(FNativeString& out, const char* text) {
+            out.Append('"');
+            for (const char* c = (text != nullptr) ? text : ""; *c != '\0'; ++c) {
+                const auto ch = static_cast<unsigned char>(*c);
+                if (ch == '"' || ch == '\\') {
+                    out.Append('\\');
+                    out.Append(*c);
+                } else if (ch < 0x20U) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", ch);
+                    out.Append(escaped);
+                } else {
+                    out.Append(*c);
+                }
+            }
+            out.Append('"');
+        }
+
+        void AppendTraceEvent(FNativeString& out, bool& first, const char* name, char phase,
+            u64 timestampNs, u32 threadId) {
+            out.Append(first ? "\n" : ",\n");
+            first = false;
+            out.Append("{\"name\":");
+            AppendJsonString(out, name);
+            char fields[96];
+            // Chrome trace timestamps are microseconds; keep nanosecond precision as decimals.
+            std::snprintf(fields, sizeof(fields),
+                ",\"ph\":\"%c\",\"ts\":%llu.%03llu,\"pid\":1,\"tid\":%u}",
+                phase, static_cast<unsigned long long>(timestampNs / 1000ULL),
+                static_cast<unsigned long long>(timestampNs % 1000ULL), threadId);
+            out.Append(fields);
+        }
+    } // namespace
+
+    static void SetTraceThreadName(const char* name) noexcept {
+        if (tTraceBuffer == nullptr)
+            return;
+        Threading::FScopedLock lock(gTraceRegistryMutex);
+        CopyThreadName(*tTraceBuffer, name);
+    }
+
+    void BeginTraceCapture() noexcept {
+        gTraceCaptureEndNs.store(~0ULL, std::memory_order_relaxed);
+        gTraceCaptureStartNs.store(TraceNowNs(), std::memory_order_relaxed);
+        gTraceActive.store(true, std::memory_order_release);
+    }
+
+    void EndTraceCapture() noexcept {
+        gTraceActive.store(false, std::memory_order_release);
+        gTraceCaptureEndNs.store(TraceNowNs(), std::memory_order_relaxed);
+    }
+
+    auto IsTraceCaptureActive() noexcept -> bool {
+        return gTraceActive.load(std::memory_order_relaxed);
+    }
+
+    auto BeginTraceScope(const char* name) noexcept -> bool {
+        if (!gTraceActive.load(std::memory_order_relaxed))
+            return false;
+        FTraceThreadBuffer* buffer = AcquireTraceBuffer();
+        if (buffer == nullptr)
+            return false;
+        PushTraceEvent(*buffer, name, ETraceEventType::Begin);
+        return true;
+    }
+
+    void EndTraceScope() noexcept {
+        if (tTraceBuffer == nullptr)
+            return;
+        // Always close a scope that was opened, even if the capture ended in between.
+        PushTraceEvent(*tTraceBuffer, nullptr, ETraceEventType::End);
+    }
+
+    void WriteChromeTrace(FNativeString& outJson) noexcept {
+        const u64 startNs = gTraceCaptureStartNs.load(std::memory_order_relaxed);
+        const u64 endNs   = gTraceCaptureEndNs.load(std::memory_order_relaxed);
+
+        outJson.Clear();
+        outJson.Append("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+        bool first = true;
+
+        Threading::FScopedLock          lock(gTraceRegistryMutex);
+        Container::TVector<FTraceEvent> events;
+        Container::TVector<const char*> openScopes;
+        for (usize b = 0; b < gTraceBuffers.Size(); ++b) {
+            FTraceThreadBuffer& buffer = *gTraceBuffers[b];
+
+            // Snapshot the committed window, then drop whatever the producer lapped meanwhile.
+            const u64 committedBefore = buffer.mCommitted.load(std::memory_order_acquire);
+            const u64 begin           = committedBefore > kTraceBufferCapacity
+                          ? committedBefore - kTraceBufferCapacity
+                          : 0ULL;
+            events.Clear();
+            events.Reserve(static_cast<usize>(committedBefore - begin));
+            for (u64 i = begin; i < committedBefore; ++i) {
+                const FTraceEventSlot& slot = buffer.mEvents[i & (kTraceBufferCapacity - 1ULL)];
+                FTraceEvent            event;
+                event.mTimestampNs = slot.mTimestampNs.load(std::memory_order_relaxed);
+                event.mName        = slot.mName.load(std::memory_order_relaxed);
+                event.mType        = slot.mType.load(std::memory_order_relaxed);
+                events.PushBack(event);
+            }
+            // Orders the slot reads above before the re-read of the committed count.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // The slot at `committedAfter` may be mid-write, which laps position
+            // `committedAfter - capacity`; only later positions are known intact.
+            const u64 committedAfter = buffer.mCommitted.load(std::memory_order_relaxed);
+            const u64 firstValid     = committedAfter >= kTraceBufferCapacity
+                    ? committedAfter - kTraceBufferCapacity + 1ULL
+                    : 0ULL;
+            const usize skip =
+                firstValid > begin ? static_cast<usize>(firstValid - begin) : static_cast<usize>(0);
+
+            {
+                outJson.Append(first ? "\n" : ",\n");
+                first = false;
+                char meta[96];
+                std::snprintf(meta, sizeof(meta),
+                    "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                    "\"args\":{\"name\":",
+                    buffer.mThreadId);
+                outJson.Append(meta);
+                AppendJsonString(outJson, buffer.mName[0] != '\0' ? buffer.mName : "Thread");
+                outJson.Append("}}");
+            }
+
+            openScopes.Clear();
+            u64 lastNs = startNs;
+            for (usize i = skip; i < events.Size(); ++i) {
+                const FTraceEvent& e = events[i];
+                if (e.mTimestampNs < startNs || e.mTimestampNs > endNs)
+                    continue;
+                if (e.mType == ETraceEventType::Begin) {
+                    openScopes.PushBack(e.mName);
+                    AppendTraceEvent(
+                        outJson, first, e.mName, 'B', e.mTimestampNs, buffer.mThreadId);
+                } else {
+                    // An end whose begin was overwritten or predates the capture.
+                    if (openScopes.IsEmpty())
+                        continue;
+                    AppendTraceEvent(
+                        outJson, first, openScopes.Back(), 'E', e.mTimestampNs, buffer.mThreadId);
+                    openScopes.PopBack();
+                }
+                lastNs = e.mTimestampNs;
+            }
+            // Scopes still open at export time are closed at the last recorded timestamp.
+            while (!openScopes.IsEmpty()) {
+                AppendTraceEvent(
+                    outJson, first, openScopes.Back(), 'E', lastNs, buffer.mThreadId);
+                openScopes.PopBack();
+            }
+        }
+
+        outJson.Append("\n]}\n");
+    }
+
+    auto SaveChromeTrace(const FString& path) noexcept -> bool {
+        FNativeString json;
+        WriteChromeTrace(json);
+        try {
+            std::ofstream file(
+                std::filesystem::path(path.CStr()), std::ios::binary | std::ios::trunc);
+            if (!file)
+                return false;
+            file.write(json.GetData(), static_cast<std::streamsize>(json.Length()));
+            return static_cast<bool>(file);
+        } catch (...) {
+            return false;
+        }
+    }
+
 } // namespace AltinaEngine::Core::Instrumentation
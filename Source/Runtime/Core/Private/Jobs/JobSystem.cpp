@@ -3,32 +3,151 @@
 #include "../../Public/Threading/Atomic.h"
 #include "../../Public/Container/Vector.h"
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <thread>
 #include <iostream>
 #include "../../Public/Instrumentation/Instrumentation.h"
+#include "WorkStealingDeque.h"
 
 using AltinaEngine::Core::Container::TFunction;
 using AltinaEngine::Core::Container::TThreadSafeQueue;
 
 // Use engine public mutex header already included above (relative include present)
 #include "../../Public/Threading/ConditionVariable.h"
-#include "../../Public/Container/SmartPtr.h"
-#include "../../Public/Container/HashMap.h"
-#include "../../Public/Container/HashSet.h"
 #include "../../Public/Container/ThreadSafeQueue.h"
 
 namespace AltinaEngine::Core::Jobs {
 
-    FWorkerPool::FWorkerPool(const FWorkerPoolConfig& InConfig) noexcept : mConfig(InConfig) {}
+    namespace {
+        auto NowSteadyMs() noexcept -> u64 {
+            return static_cast<u64>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+        }
+
+        // Failed steal rounds before an idle worker goes to sleep on the wake event.
+        constexpr u32 kStealSpinRounds = 64;
+        // A worker above `mMinThreads` that finds nothing to do for this long retires.
+        constexpr u64 kStealRetireIdleMs = 2000;
+
+        auto NextRandom(u64& state) noexcept -> u64 {
+            // xorshift64*
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 0x2545F4914F6CDD1DULL;
+        }
+    } // namespace
+
+    // Per-pool state for work-stealing mode. Lives in the private module so the public header
+    // doesn't have to expose std::atomic/std::thread.
+    struct FWorkerPool::FStealContext {
+        struct FWorkerSlot {
+            Detail::TWorkStealingDeque<FJobEntry> mDeque;
+            std::thread*                          mThread = nullptr;
+            u64                                   mRngState = 0;
+        };
+
+        explicit FStealContext(usize maxThreads)
+            : mSlotCount(maxThreads), mSlots(new FWorkerSlot[maxThreads]) {
+            for (usize i = 0; i < mSlotCount; ++i) {
+                mSlots[i].mRngState = 0x9E3779B97F4A7C15ULL * static_cast<u64>(i + 1);
+            }
+        }
+        ~FStealContext() { delete[] mSlots; }
+
+        FStealContext(const FStealContext&)                    = delete;
+        auto operator=(const FStealContext&) -> FStealContext& = delete;
+
+        usize                                 mSlotCount;
+        FWorkerSlot*                          mSlots;
+        // Shared injector queues for work submitted from non-worker threads. Positive-priority
+        // jobs are drained first.
+        TThreadSafeQueue<FJobEntry*>          mHighPriorityInjector;
+        TThreadSafeQueue<FJobEntry*>          mInjector;
+        std::atomic<usize>                    mWorkerCount{ 0 };
+        std::atomic<usize>                    mIdleWorkers{ 0 };
+        std::atomic<i64>                      mPendingJobs{ 0 };
+        // Lets workers skip the delayed-job mutex on the hot path.
+        std::atomic<bool>                     mHasDelayedJobs{ false };
+        // Guards spawning/retiring so `mWorkerCount` and the thread slots stay consistent.
+        FMutex                                mSpawnMutex;
+        bool                                  mSpawnClosed = true; // opened by Start()
+
+        // Own deque first (pass mSlotCount as `selfIndex` for non-worker threads), then the
+        // injectors, then one sweep over the other workers starting at a random victim.
+        auto FindWork(usize selfIndex, u64& rngState) -> FJobEntry* {
+            if (selfIndex < mSlotCount) {
+                if (FJobEntry* local = mSlots[selfIndex].mDeque.Pop())
+                    return local;
+            }
+
+            FJobEntry* injected = nullptr;
+            if (mHighPriorityInjector.TryPop(injected))
+                return injected;
+            if (mInjector.TryPop(injected))
+                return injected;
+
+            // Randomized victim selection spreads contention across deques.
+            const usize count = mWorkerCount.load();
+            if (count == 0)
+                return nullptr;
+            const usize start = static_cast<usize>(NextRandom(rngState) % count);
+            for (usize i = 0; i < count; ++i) {
+                const usize victim = (start + i) % count;
+                if (victim == selfIndex)
+                    continue;
+                if (FJobEntry* stolen = mSlots[victim].mDeque.Steal())
+                    return stolen;
+            }
+            return nullptr;
+        }
+    };
+
+    namespace {
+        // Identifies the pool/slot the current thread works for so nested submissions go to the
+        // local deque instead of the shared injector.
+        struct FStealWorkerTls {
+            const void* mPool  = nullptr;
+            usize       mIndex = 0;
+        };
+        thread_local FStealWorkerTls tStealWorker;
+        // Victim selection state for non-worker threads that help out (see TryExecuteOne).
+        thread_local u64             tHelperRngState = 0;
+    } // namespace
+
+    FWorkerPool::FWorkerPool(const FWorkerPoolConfig& InConfig) noexcept : mConfig(InConfig) {
+        if (mConfig.mMinThreads == 0)
+            mConfig.mMinThreads = 1;
+        if (mConfig.mMaxThreads < mConfig.mMinThreads)
+            mConfig.mMaxThreads = mConfig.mMinThreads;
+        if (mConfig.mAllowSteal)
+            mSteal = new FStealContext(mConfig.mMaxThreads);
+    }
 
-    FWorkerPool::~FWorkerPool() noexcept { Stop(); }
+    FWorkerPool::~FWorkerPool() noexcept {
+        Stop();
+        delete mSteal;
+        mSteal = nullptr;
+    }
 
     void FWorkerPool::Start() {
         if (mRunning.Exchange(1) != 0)
             return;
 
-        const usize count = mConfig.mMinThreads > 0 ? mConfig.mMinThreads : 1;
+        const usize count = mConfig.mMinThreads;
+        if (mSteal) {
+            {
+                Threading::FScopedLock lock(mSteal->mSpawnMutex);
+                mSteal->mSpawnClosed = false;
+            }
+            for (usize i = 0; i < count; ++i) {
+                TrySpawnStealWorker();
+            }
+            return;
+        }
+
         mThreads.Reserve(count);
         for (usize i = 0; i < count; ++i) {
             // allocate std::thread on heap and store opaque pointer in public TVector<void*>
@@ -47,6 +166,24 @@ namespace AltinaEngine::Core::Jobs {
         // Wake all workers so they exit promptly
         mWakeEvent.Set();
 
+        if (mSteal) {
+            // Close spawning first, then join without holding the lock: a worker that is still
+            // draining may try to spawn and must not deadlock against us.
+            {
+                Threading::FScopedLock lock(mSteal->mSpawnMutex);
+                mSteal->mSpawnClosed = true;
+            }
+            for (usize i = 0; i < mSteal->mSlotCount; ++i) {
+                auto* tptr = mSteal->mSlots[i].mThread;
+                if (tptr && tptr->joinable())
+                    tptr->join();
+                delete tptr;
+                mSteal->mSlots[i].mThread = nullptr;
+            }
+            mSteal->mWorkerCount.store(0);
+            return;
+        }
+
         for (usize i = 0; i < mThreads.Size(); ++i) {
             auto* tptr = reinterpret_cast<std::thread*>(mThreads[i]);
             if (tptr && tptr->joinable())
@@ -56,13 +193,53 @@ namespace AltinaEngine::Core::Jobs {
         mThreads.Clear();
     }
 
+    auto FWorkerPool::GetWorkerCount() const noexcept -> usize {
+        if (mSteal)
+            return mSteal->mWorkerCount.load();
+        return mThreads.Size();
+    }
+
+    auto FWorkerPool::TryExecuteOne() -> bool {
+        if (mSteal) {
+            const bool isOwnWorker = tStealWorker.mPool == this;
+            if (!isOwnWorker && tHelperRngState == 0)
+                tHelperRngState = reinterpret_cast<u64>(&tHelperRngState) | 1ULL;
+            const usize self  = isOwnWorker ? tStealWorker.mIndex : mSteal->mSlotCount;
+            u64&        rng   = isOwnWorker ? mSteal->mSlots[self].mRngState : tHelperRngState;
+            FJobEntry*  entry = mSteal->FindWork(self, rng);
+            if (entry == nullptr)
+                return false;
+            mSteal->mPendingJobs.fetch_sub(1);
+            try {
+                entry->mTask();
+            } catch (...) {}
+            delete entry;
+            return true;
+        }
+
+        FJobEntry entry{};
+        if (!mJobQueue.TryPop(entry))
+            return false;
+        if (entry.mExecuteAtMs > NowSteadyMs()) {
+            Threading::FScopedLock lock(mDelayedJobsMutex);
+            mDelayedJobs.PushBack(Move(entry));
+            return false;
+        }
+        try {
+            entry.mTask();
+        } catch (...) {}
+        return true;
+    }
+
     void FWorkerPool::Submit(TFunction<void()> Job) {
+        if (mSteal) {
+            PushStealJob(Move(Job), 0);
+            return;
+        }
         FJobEntry e;
         e.mTask        = Move(Job);
         e.mPriority    = 0;
-        e.mExecuteAtMs = static_cast<u64>(std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::steady_clock::now().time_since_epoch())
-                .count());
+        e.mExecuteAtMs = NowSteadyMs();
         mJobQueue.Push(Move(e));
         mWakeEvent.Set();
     }
@@ -70,50 +247,63 @@ namespace AltinaEngine::Core::Jobs {
         FJobEntry e;
         e.mTask        = Move(Job);
         e.mPriority    = 0;
-        e.mExecuteAtMs = std::chrono::duration_cast<std::chrono::milliseconds>(
-                             std::chrono::steady_clock::now().time_since_epoch())
-                             .count()
-            + DelayMs;
+        e.mExecuteAtMs = NowSteadyMs() + DelayMs;
 
         {
             AltinaEngine::Core::Threading::FScopedLock lock(mDelayedJobsMutex);
             mDelayedJobs.PushBack(Move(e));
+            if (mSteal)
+                mSteal->mHasDelayedJobs.store(true);
         }
         mWakeEvent.Set();
     }
     void FWorkerPool::SubmitWithPriority(TFunction<void()> Job, int Priority) {
+        if (mSteal) {
+            PushStealJob(Move(Job), Priority);
+            return;
+        }
         FJobEntry e;
         e.mTask        = Move(Job);
         e.mPriority    = Priority;
-        e.mExecuteAtMs = static_cast<u64>(std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::steady_clock::now().time_since_epoch())
-                .count());
+        e.mExecuteAtMs = NowSteadyMs();
         mJobQueue.Push(Move(e));
         mWakeEvent.Set();
     }
 
+    void FWorkerPool::PromoteDueDelayedJobs() {
+        if (mSteal && !mSteal->mHasDelayedJobs.load(std::memory_order_relaxed))
+            return;
+
+        Threading::FScopedLock lock(mDelayedJobsMutex);
+        if (mDelayedJobs.IsEmpty())
+            return;
+
+        const u64 nowMs = NowSteadyMs();
+        for (usize idx = 0; idx < mDelayedJobs.Size();) {
+            if (mDelayedJobs[idx].mExecuteAtMs <= nowMs) {
+                if (mSteal) {
+                    mSteal->mPendingJobs.fetch_add(1);
+                    mSteal->mInjector.Push(new FJobEntry(Move(mDelayedJobs[idx])));
+                } else {
+                    mJobQueue.Push(Move(mDelayedJobs[idx]));
+                }
+                // remove current by swapping with last
+                if (idx + 1 < mDelayedJobs.Size()) {
+                    mDelayedJobs[idx] = Move(mDelayedJobs.Back());
+                }
+                mDelayedJobs.PopBack();
+            } else {
+                ++idx;
+            }
+        }
+        if (mSteal && mDelayedJobs.IsEmpty())
+            mSteal->mHasDelayedJobs.store(false);
+    }
+
     void FWorkerPool::WorkerMain() {
         while (mRunning.Load() != 0 || !mJobQueue.IsEmpty()) {
             // Move due delayed jobs into the main queue
-            {
-                Threading::FScopedLock lock(mDelayedJobsMutex);
-                auto nowMs = static_cast<u64>(std::chrono::duration_cast<std::chrono::milliseconds>(
-                    std::chrono::steady_clock::now().time_since_epoch())
-                        .count());
-
-                for (usize idx = 0; idx < mDelayedJobs.Size();) {
-                    if (mDelayedJobs[idx].mExecuteAtMs <= nowMs) {
-                        mJobQueue.Push(Move(mDelayedJobs[idx]));
-                        // remove current by swapping with last
-                        if (idx + 1 < mDelayedJobs.Size()) {
-                            mDelayedJobs[idx] = Move(mDelayedJobs.Back());
-                        }
-                        mDelayedJobs.PopBack();
-                    } else {
-                        ++idx;
-                    }
-                }
-            }
+            PromoteDueDelayedJobs();
 
             // Drain jobs into local vector to allow priority sorting
             TVector<FJobEntry> batch;
@@ -131,10 +321,7 @@ namespace AltinaEngine::Core::Jobs {
                         return a.mPriority > b.mPriority;
                     });
 
-                auto now   = std::chrono::steady_clock::now();
-                auto nowMs = static_cast<u64>(
-                    std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch())
-                        .count());
+                const u64 nowMs = NowSteadyMs();
                 // Execute ready tasks; re-queue delayed ones
                 for (usize i = 0; i < batch.Size(); ++i) {
                     auto& j = batch[i];
@@ -157,23 +344,127 @@ namespace AltinaEngine::Core::Jobs {
     }
 
     // -------------------------------------------------------------------------
-    // Basic job manager implementation (private runtime glue)
+    // Work-stealing mode
     // -------------------------------------------------------------------------
 
-    struct JobState {
-        FMutex                        mtx;
-        Threading::FConditionVariable cv;
-        bool                          completed = false;
-    };
+    void FWorkerPool::PushStealJob(TFunction<void()> Job, int Priority) {
+        auto* entry         = new FJobEntry();
+        entry->mTask        = Move(Job);
+        entry->mPriority    = Priority;
+        entry->mExecuteAtMs = 0;
+
+        mSteal->mPendingJobs.fetch_add(1);
+        if (Priority <= 0 && tStealWorker.mPool == this) {
+            mSteal->mSlots[tStealWorker.mIndex].mDeque.Push(entry);
+        } else if (Priority > 0) {
+            mSteal->mHighPriorityInjector.Push(entry);
+        } else {
+            mSteal->mInjector.Push(entry);
+        }
+
+        if (mSteal->mIdleWorkers.load() > 0) {
+            mWakeEvent.Set();
+        } else if (mSteal->mWorkerCount.load() < mSteal->mSlotCount) {
+            // Everybody is busy: grow towards mMaxThreads.
+            TrySpawnStealWorker();
+        }
+    }
+
+    void FWorkerPool::TrySpawnStealWorker() {
+        Threading::FScopedLock lock(mSteal->mSpawnMutex);
+        if (mSteal->mSpawnClosed)
+            return;
+
+        const usize index = mSteal->mWorkerCount.load();
+        if (index >= mSteal->mSlotCount)
+            return;
+
+        auto& slot = mSteal->mSlots[index];
+        if (slot.mThread != nullptr) {
+            // A previously retired worker used this slot; it has already left its loop.
+            if (slot.mThread->joinable())
+                slot.mThread->join();
+            delete slot.mThread;
+            slot.mThread = nullptr;
+        }
+
+        mSteal->mWorkerCount.store(index + 1);
+        slot.mThread = new std::thread([this, index]() -> void {
+            AltinaEngine::Core::Instrumentation::SetCurrentThreadName("JobWorker");
+            StealWorkerMain(index);
+        });
+    }
+
+    void FWorkerPool::StealWorkerMain(usize workerIndex) {
+        FStealContext& ctx  = *mSteal;
+        auto&          self = ctx.mSlots[workerIndex];
+        tStealWorker.mPool  = this;
+        tStealWorker.mIndex = workerIndex;
+
+        const auto FindWork = [&]() -> FJobEntry* {
+            return ctx.FindWork(workerIndex, self.mRngState);
+        };
+
+        u64 idleSinceMs = 0;
+        for (;;) {
+            PromoteDueDelayedJobs();
 
-    static TAtomic<u64> gNextJobId{ 1 };
-    static FMutex       gJobsMutex;
-    using Container::MakeShared;
-    using Container::THashMap;
-    using Container::THashSet;
-    using Container::TShared;
-    static THashMap<u64, TShared<JobState>> gJobs;
-    static FWorkerPool*                     gDefaultPool = nullptr;
+            FJobEntry* entry = FindWork();
+            for (u32 spin = 0; entry == nullptr && spin < kStealSpinRounds; ++spin) {
+                std::this_thread::yield();
+                entry = FindWork();
+            }
+
+            if (entry != nullptr) {
+                idleSinceMs = 0;
+                // More work is queued and someone is asleep: hand the wake-up on.
+                if (ctx.mPendingJobs.fetch_sub(1) > 1 && ctx.mIdleWorkers.load() > 0)
+                    mWakeEvent.Set();
+                try {
+                    entry->mTask();
+                } catch (...) {}
+                delete entry;
+                continue;
+            }
+
+            if (mRunning.Load() == 0) {
+                if (ctx.mPendingJobs.load() <= 0)
+                    break;
+                continue;
+            }
+
+            // Surplus workers retire once they have been idle for a while. Only the highest
+            // slot may retire so live workers always occupy [0, mWorkerCount).
+            const u64 nowMs = NowSteadyMs();
+            if (idleSinceMs == 0) {
+                idleSinceMs = nowMs;
+            } else if (workerIndex >= mConfig.mMinThreads
+                && nowMs - idleSinceMs >= kStealRetireIdleMs) {
+                Threading::FScopedLock lock(ctx.mSpawnMutex);
+                if (!ctx.mSpawnClosed && ctx.mWorkerCount.load() == workerIndex + 1
+                    && self.mDeque.IsEmpty()) {
+                    ctx.mWorkerCount.store(workerIndex);
+                    break;
+                }
+            }
+
+            ctx.mIdleWorkers.fetch_add(1);
+            if (ctx.mPendingJobs.load() <= 0)
+                mWakeEvent.Wait(kStealRetireIdleMs / 2);
+            ctx.mIdleWorkers.fetch_sub(1);
+        }
+
+        tStealWorker = FStealWorkerTls{};
+        // Pass the stop/wake signal on to the next sleeper.
+        mWakeEvent.Set();
+    }
+
+    // -------------------------------------------------------------------------
+    // Basic job manager implementation (private runtime glue)
+    // -------------------------------------------------------------------------
+
+    static std::atomic<FWorkerPool*> gDefaultPool{ nullptr };
+    static FMutex                    gDefaultPoolMutex;
 
     struct NamedThreadState {
         TThreadSafeQueue<TFunction<void()>> mQueue;
@@ -231,12 +522,24 @@ namespace AltinaEngine::Core::Jobs {
 
     // Helper to ensure a default pool exists
     static auto EnsureDefaultPool() -> FWorkerPool* {
-        AltinaEngine::Core::Threading::FScopedLock lg(gJobsMutex);
-        if (!gDefaultPool) {
-            gDefaultPool = new FWorkerPool(FWorkerPoolConfig{});
-            gDefaultPool->Start();
+        if (FWorkerPool* pool = gDefaultPool.load(std::memory_order_acquire))
+            return pool;
+
+        AltinaEngine::Core::Threading::FScopedLock lg(gDefaultPoolMutex);
+        FWorkerPool* pool = gDefaultPool.load(std::memory_order_relaxed);
+        if (!pool) {
+            // Leave one core for the thread that submits (usually the game thread) and let the
+            // pool grow towards the rest of the machine as load requires.
+            const usize hw = static_cast<usize>(std::thread::hardware_concurrency());
+            FWorkerPoolConfig cfg{};
+            cfg.mAllowSteal = true;
+            cfg.mMaxThreads = hw > 1 ? hw - 1 : 1;
+            cfg.mMinThreads = cfg.mMaxThreads < 2 ? cfg.mMaxThreads : 2;
+            pool            = new FWorkerPool(cfg);
+            pool->Start();
+            gDefaultPool.store(pool, std::memory_order_release);
         }
-        return gDefaultPool;
+        return pool;
     }
 
     // JobFence implementation
@@ -280,91 +583,259 @@ namespace AltinaEngine::Core::Jobs {
         return mImpl->mSignalled;
     }
 
-    // Dependency nodes were removed; dependencies are declared on FJobDescriptor
-    // and handled below in Submit/SubmitWithFence by waiting on `desc.Prerequisites`.
+    // -------------------------------------------------------------------------
+    // Job slot table and dependency graph
+    //
+    // Every submitted job owns a slot in a paged, never-freed table. A handle encodes
+    // (generation << 32 | slot index); the generation is bumped whenever the slot is recycled, so
+    // a stale handle simply reads as "completed". Prerequisites are resolved with an atomic
+    // counter per job: each unfinished prerequisite pushes a continuation edge onto its own
+    // lock-free list, and the job that finishes last dispatches the dependent. No worker ever
+    // blocks on a prerequisite and no global lock is taken on submit/complete.
+    // -------------------------------------------------------------------------
 
-    // JobSystem API
-    auto FJobSystem::Submit(FJobDescriptor desc) noexcept -> FJobHandle {
-        const u64         id    = static_cast<u64>(gNextJobId.FetchAdd(1));
-        TShared<JobState> state = MakeShared<JobState>();
+    namespace {
+        struct FJobEdge {
+            u32       mDependent = 0;
+            FJobEdge* mNext      = nullptr;
+        };
 
-        {
-            Threading::FScopedLock lg(gJobsMutex);
-            gJobs.Emplace(id, state);
+        // Sentinel marking a continuation list as closed (the owning job has completed).
+        FJobEdge  gClosedEdgeList;
+        FJobEdge* const kClosedEdges = &gClosedEdgeList;
+
+        // Slot state word: [63..32] generation, [31] completed, [30..0] reference count. The
+        // running job holds one reference; submitters registering a continuation take a
+        // temporary one so the slot can't be recycled underneath them.
+        constexpr u64 kSlotCompletedBit = 1ULL << 31;
+        constexpr u64 kSlotRefMask      = kSlotCompletedBit - 1ULL;
+
+        constexpr auto MakeSlotState(u32 generation, u64 refs) noexcept -> u64 {
+            return (static_cast<u64>(generation) << 32) | refs;
+        }
+        constexpr auto SlotGeneration(u64 state) noexcept -> u32 {
+            return static_cast<u32>(state >> 32);
         }
 
-        // Wrap the user's callback to mark completion.
-        // Allocate the callback on the heap to keep the runtime lambda small
-        // (TFunction uses a fixed small-buffer optimization without heap fallback).
-        TShared<TFunction<void()>> cbptr = MakeShared<TFunction<void()>>(Move(desc.Callback));
-        TVector<FJobHandle>        prereqHandles = Move(desc.Prerequisites);
+        struct FJobSlot {
+            std::atomic<u64>       mState{ MakeSlotState(1U, 0ULL) };
+            std::atomic<i32>       mUnresolved{ 0 };
+            std::atomic<u32>       mWaiters{ 0 };
+            std::atomic<FJobEdge*> mDependents{ nullptr };
+            std::atomic<u32>       mNextFree{ 0 };
+            TFunction<void()>      mCallback;
+            FJobFence*             mFence        = nullptr;
+            const char*            mDebugLabel   = nullptr;
+            u32                    mAffinityMask = 0U;
+            int                    mPriority     = 0;
+        };
 
-        TFunction<void()>          wrapper = [cbptr, id, state, prereqHandles]() mutable -> void {
-            // Wait for declared prerequisites
-            for (usize i = 0; i < prereqHandles.Size(); ++i) {
-                Wait(prereqHandles[i]);
-            }
+        constexpr u32 kJobSlotPageBits = 10U;
+        constexpr u32 kJobSlotPageSize = 1U << kJobSlotPageBits;
+        constexpr u32 kJobSlotMaxPages = 256U; // 256K jobs in flight
 
-            try {
-                if (cbptr && static_cast<bool>(*cbptr))
-                    (*cbptr)();
-            } catch (...) {}
+        std::atomic<FJobSlot*> gJobSlotPages[kJobSlotMaxPages]{};
+        std::atomic<u32>       gJobSlotHighWater{ 0 };
+        // Treiber free list: [63..32] ABA tag, [31..0] slot index + 1 (0 == empty).
+        std::atomic<u64>       gJobSlotFreeHead{ 0 };
 
-            {
-                Threading::FScopedLock lg(state->mtx);
-                state->completed = true;
-            }
-            state->cv.NotifyAll();
-        };
+        auto GetJobSlot(u32 index) noexcept -> FJobSlot& {
+            return gJobSlotPages[index >> kJobSlotPageBits].load(std::memory_order_acquire)
+                [index & (kJobSlotPageSize - 1U)];
+        }
 
-        if (TryEnqueueNamedThread(desc.AffinityMask, wrapper)) {
-            return FJobHandle(id);
+        auto IsJobSlotIndexLive(u32 index) noexcept -> bool {
+            return index < kJobSlotPageSize * kJobSlotMaxPages
+                && index < gJobSlotHighWater.load(std::memory_order_acquire)
+                && gJobSlotPages[index >> kJobSlotPageBits].load(std::memory_order_acquire)
+                != nullptr;
         }
 
-        // Ensure pool
-        FWorkerPool* pool = EnsureDefaultPool();
-        pool->Submit(Move(wrapper));
-        return FJobHandle(id);
-    }
+        auto EnsureJobSlotPage(u32 pageIndex) -> void {
+            auto& page = gJobSlotPages[pageIndex];
+            if (page.load(std::memory_order_acquire) != nullptr)
+                return;
+            auto*     fresh    = new FJobSlot[kJobSlotPageSize];
+            FJobSlot* expected = nullptr;
+            if (!page.compare_exchange_strong(expected, fresh, std::memory_order_acq_rel))
+                delete[] fresh;
+        }
 
-    auto FJobSystem::SubmitWithFence(FJobDescriptor desc, FJobFence& outFence) noexcept
-        -> FJobHandle {
-        const u64         id    = static_cast<u64>(gNextJobId.FetchAdd(1));
-        TShared<JobState> state = MakeShared<JobState>();
+        void FreeJobSlot(u32 index) noexcept {
+            FJobSlot& slot = GetJobSlot(index);
+            u64       head = gJobSlotFreeHead.load(std::memory_order_relaxed);
+            for (;;) {
+                slot.mNextFree.store(static_cast<u32>(head), std::memory_order_relaxed);
+                const u64 next = (((head >> 32) + 1ULL) << 32) | static_cast<u64>(index + 1U);
+                if (gJobSlotFreeHead.compare_exchange_weak(
+                        head, next, std::memory_order_release, std::memory_order_relaxed))
+                    return;
+            }
+        }
 
-        {
-            Threading::FScopedLock lg(gJobsMutex);
-            gJobs.Emplace(id, state);
+        auto AllocJobSlot() -> u32 {
+            for (;;) {
+                u64 head = gJobSlotFreeHead.load(std::memory_order_acquire);
+                while (static_cast<u32>(head) != 0U) {
+                    const u32 index = static_cast<u32>(head) - 1U;
+                    const u64 next  = (((head >> 32) + 1ULL) << 32)
+                        | GetJobSlot(index).mNextFree.load(std::memory_order_relaxed);
+                    if (gJobSlotFreeHead.compare_exchange_weak(
+                            head, next, std::memory_order_acquire, std::memory_order_acquire))
+                        return index;
+                }
+
+                const u32 fresh = gJobSlotHighWater.fetch_add(1U, std::memory_order_relaxed);
+                if (fresh < kJobSlotPageSize * kJobSlotMaxPages) {
+                    EnsureJobSlotPage(fresh >> kJobSlotPageBits);
+                    return fresh;
+                }
+                // Table exhausted: give running jobs a chance to retire and retry.
+                gJobSlotHighWater.fetch_sub(1U, std::memory_order_relaxed);
+                std::this_thread::yield();
+            }
+        }
+
+        // Called when the last reference of a completed job goes away.
+        void RecycleJobSlot(u32 index, u64 lastState) noexcept {
+            FJobSlot& slot       = GetJobSlot(index);
+            u32       generation = SlotGeneration(lastState) + 1U;
+            if (generation == 0U)
+                generation = 1U;
+            slot.mState.store(MakeSlotState(generation, 0ULL));
+            if (slot.mWaiters.load() != 0U)
+                slot.mState.notify_all();
+            FreeJobSlot(index);
         }
 
-        TShared<TFunction<void()>> cbptr = MakeShared<TFunction<void()>>(Move(desc.Callback));
-        TVector<FJobHandle>        prereqHandles2 = Move(desc.Prerequisites);
+        void ReleaseJobSlotRef(u32 index) noexcept {
+            const u64 prev = GetJobSlot(index).mState.fetch_sub(1ULL, std::memory_order_acq_rel);
+            if ((prev & kSlotRefMask) == 1ULL && (prev & kSlotCompletedBit) != 0ULL)
+                RecycleJobSlot(index, prev - 1ULL);
+        }
 
-        TFunction<void()> wrapper = [cbptr, state, &outFence, prereqHandles2]() mutable -> void {
-            for (usize i = 0; i < prereqHandles2.Size(); ++i) {
-                Wait(prereqHandles2[i]);
+        // Takes a temporary reference if `handle` still names a job that hasn't completed.
+        auto TryAcquireJobSlot(FJobHandle handle, u32& outIndex) noexcept -> bool {
+            const u32 index      = static_cast<u32>(handle.mId);
+            const u32 generation = static_cast<u32>(handle.mId >> 32);
+            if (!IsJobSlotIndexLive(index))
+                return false;
+
+            auto& state = GetJobSlot(index).mState;
+            u64   cur   = state.load(std::memory_order_acquire);
+            for (;;) {
+                if (SlotGeneration(cur) != generation || (cur & kSlotCompletedBit) != 0ULL)
+                    return false;
+                if (state.compare_exchange_weak(
+                        cur, cur + 1ULL, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    outIndex = index;
+                    return true;
+                }
             }
+        }
+
+        void DispatchJob(u32 index);
 
+        void RunJob(u32 index) {
+            FJobSlot& slot = GetJobSlot(index);
             try {
-                if (cbptr && static_cast<bool>(*cbptr))
-                    (*cbptr)();
+                if (static_cast<bool>(slot.mCallback)) {
+                    Instrumentation::FScopedTraceEvent trace(
+                        slot.mDebugLabel != nullptr ? slot.mDebugLabel : "Job");
+                    slot.mCallback();
+                }
             } catch (...) {}
+            slot.mCallback.Reset();
 
-            {
-                Threading::FScopedLock lg(state->mtx);
-                state->completed = true;
+            if (slot.mFence != nullptr) {
+                slot.mFence->Signal();
+                slot.mFence = nullptr;
             }
-            state->cv.NotifyAll();
-            outFence.Signal();
-        };
 
-        if (TryEnqueueNamedThread(desc.AffinityMask, wrapper)) {
-            return FJobHandle(id);
+            // Close the continuation list first so late registrations see the job as done, then
+            // publish completion and drop the job's own reference.
+            FJobEdge* edges = slot.mDependents.exchange(kClosedEdges, std::memory_order_acq_rel);
+            const u64 prev = slot.mState.fetch_add(kSlotCompletedBit - 1ULL);
+            if (slot.mWaiters.load() != 0U)
+                slot.mState.notify_all();
+            if ((prev & kSlotRefMask) == 1ULL)
+                RecycleJobSlot(index, prev + kSlotCompletedBit - 1ULL);
+
+            while (edges != nullptr) {
+                FJobEdge* next = edges->mNext;
+                if (GetJobSlot(edges->mDependent).mUnresolved.fetch_sub(1) == 1)
+                    DispatchJob(edges->mDependent);
+                delete edges;
+                edges = next;
+            }
         }
 
-        FWorkerPool* pool = EnsureDefaultPool();
-        pool->Submit(Move(wrapper));
-        return FJobHandle(id);
+        void DispatchJob(u32 index) {
+            FJobSlot&         slot = GetJobSlot(index);
+            TFunction<void()> run  = [index]() -> void { RunJob(index); };
+            if (TryEnqueueNamedThread(slot.mAffinityMask, run))
+                return;
+            EnsureDefaultPool()->SubmitWithPriority(Move(run), slot.mPriority);
+        }
+
+        auto SubmitJob(FJobDescriptor& desc, FJobFence* fence) -> FJobHandle {
+            const u32 index = AllocJobSlot();
+            FJobSlot& slot  = GetJobSlot(index);
+
+            slot.mCallback     = Move(desc.Callback);
+            slot.mFence        = fence;
+            slot.mDebugLabel   = desc.DebugLabel;
+            slot.mAffinityMask = desc.AffinityMask;
+            slot.mPriority     = desc.Priority;
+            slot.mDependents.store(nullptr, std::memory_order_relaxed);
+            // One extra count guards against dispatch while prerequisites are still being wired.
+            slot.mUnresolved.store(1, std::memory_order_relaxed);
+
+            // Take the job's own reference; the slot is free so only the generation is set.
+            const u32 generation = SlotGeneration(slot.mState.load(std::memory_order_relaxed));
+            slot.mState.store(MakeSlotState(generation, 1ULL), std::memory_order_release);
+            const FJobHandle handle((static_cast<u64>(generation) << 32) | index);
+
+            for (usize i = 0; i < desc.Prerequisites.Size(); ++i) {
+                u32 prereqIndex = 0U;
+                if (!TryAcquireJobSlot(desc.Prerequisites[i], prereqIndex))
+                    continue; // already complete
+
+                FJobSlot& prereq = GetJobSlot(prereqIndex);
+                auto*     edge   = new FJobEdge();
+                edge->mDependent = index;
+                slot.mUnresolved.fetch_add(1, std::memory_order_relaxed);
+
+                FJobEdge* head = prereq.mDependents.load(std::memory_order_acquire);
+                for (;;) {
+                    if (head == kClosedEdges) {
+                        // Completed while we were wiring the edge.
+                        delete edge;
+                        slot.mUnresolved.fetch_sub(1, std::memory_order_relaxed);
+                        break;
+                    }
+                    edge->mNext = head;
+                    if (prereq.mDependents.compare_exchange_weak(
+                            head, edge, std::memory_order_acq_rel, std::memory_order_acquire))
+                        break;
+                }
+                ReleaseJobSlotRef(prereqIndex);
+            }
+
+            if (slot.mUnresolved.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                DispatchJob(index);
+            return handle;
+        }
+    } // namespace
+
+    // JobSystem API
+    auto FJobSystem::Submit(FJobDescriptor desc) noexcept -> FJobHandle {
+        return SubmitJob(desc, nullptr);
+    }
+
+    auto FJobSystem::SubmitWithFence(FJobDescriptor desc, FJobFence& outFence) noexcept
+        -> FJobHandle {
+        return SubmitJob(desc, &outFence);
     }
 
     void RegisterNamedThread(ENamedThread thread, const char* name) noexcept {
@@ -419,21 +890,24 @@ namespace AltinaEngine::Core::Jobs {
     void FJobSystem::Wait(FJobHandle h) noexcept {
         if (!h.IsValid())
             return;
-        TShared<JobState> state;
-        {
-            Threading::FScopedLock lg(gJobsMutex);
-            auto                   it = gJobs.FindIt(h.mId);
-            if (it == gJobs.end())
-                return;
-            state = it->second;
-        }
+        const u32 index      = static_cast<u32>(h.mId);
+        const u32 generation = static_cast<u32>(h.mId >> 32);
+        if (!IsJobSlotIndexLive(index))
+            return;
 
-        Threading::FScopedLock lk(state->mtx);
-        while (!state->completed) {
-            state->cv.Wait(state->mtx);
+        FJobSlot& slot = GetJobSlot(index);
+        // Waiter count and state are both seq_cst so completion can't miss a sleeping waiter.
+        slot.mWaiters.fetch_add(1U);
+        u64 state = slot.mState.load();
+        while (SlotGeneration(state) == generation && (state & kSlotCompletedBit) == 0ULL) {
+            slot.mState.wait(state, std::memory_order_acquire);
+            state = slot.mState.load(std::memory_order_acquire);
         }
+        slot.mWaiters.fetch_sub(1U);
     }
 
+    auto FJobSystem::GetDefaultWorkerPool() noexcept -> FWorkerPool* { return EnsureDefaultPool(); }
+
     auto FJobSystem::CreateWorkerPool(const FWorkerPoolConfig& cfg) noexcept -> FWorkerPool* {
         auto* p = new FWorkerPool(cfg);
         p->Start();
@@ -0,0 +1,121 @@
+#include "../../Public/Jobs/Parallel.h"
+
+#include <chrono>
+#include <exception>
+#include <thread>
+
+namespace AltinaEngine::Core::Jobs {
+
+    namespace {
+        // Failed help attempts before a waiter starts sleeping between polls.
+        constexpr u32 kWaitSpinRounds = 64;
+
+        struct FParallelForContext {
+            TFunction<void(usize, usize)>* mBody  = nullptr;
+            usize                          mGrain = 1;
+            FWorkerPool*                   mPool  = nullptr;
+            FWaitGroup                     mGroup;
+            TAtomic<i32>                   mFailed{ static_cast<i32>(0) };
+            std::exception_ptr             mException;
+
+            [[nodiscard]] auto HasFailed() const noexcept -> bool { return mFailed.Load() != 0; }
+
+            // Keeps the first exception; later ones are dropped. Ranges not yet started are
+            // skipped once any body has thrown.
+            void CaptureException() noexcept {
+                if (mFailed.Exchange(1) == 0) {
+                    mException = std::current_exception();
+                }
+            }
+        };
+
+        // Marks a stolen half as finished however it exits, so Wait() cannot hang and the
+        // caller's context outlives every job that references it.
+        struct FWaitGroupDoneGuard {
+            FWaitGroup& mGroup;
+            ~FWaitGroupDoneGuard() { mGroup.Done(); }
+        };
+
+        void RunParallelRange(FParallelForContext* ctx, usize begin, usize end) noexcept {
+            try {
+                // Lazy binary splitting: keep the lower half, publish the upper half. Idle
+                // workers steal the oldest (largest) halves first.
+                while (end - begin > ctx->mGrain) {
+                    if (ctx->HasFailed()) {
+                        return;
+                    }
+                    const usize mid = begin + (end - begin) / 2;
+                    ctx->mGroup.Add(1);
+                    try {
+                        ctx->mPool->Submit([ctx, mid, end]() -> void {
+                            FWaitGroupDoneGuard done{ ctx->mGroup };
+                            RunParallelRange(ctx, mid, end);
+                        });
+                    } catch (...) {
+                        ctx->mGroup.Done();
+                        throw;
+                    }
+                    end = mid;
+                }
+                if (!ctx->HasFailed()) {
+                    (*ctx->mBody)(begin, end);
+                }
+            } catch (...) {
+                ctx->CaptureException();
+            }
+        }
+    } // namespace
+
+    void FWaitGroup::Add(i64 count) noexcept { mPending.FetchAdd(count); }
+
+    void FWaitGroup::Done() noexcept { mPending.FetchSub(1); }
+
+    auto FWaitGroup::IsDone() const noexcept -> bool { return mPending.Load() <= 0; }
+
+    void FWaitGroup::Wait() noexcept {
+        FWorkerPool* pool   = FJobSystem::GetDefaultWorkerPool();
+        u32          misses = 0;
+        while (!IsDone()) {
+            if (pool != nullptr && pool->TryExecuteOne()) {
+                misses = 0;
+                continue;
+            }
+            if (++misses < kWaitSpinRounds) {
+                std::this_thread::yield();
+            } else {
+                // The remaining work is running elsewhere; stop burning the core.
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+
+    auto GetDefaultParallelGrain(usize count) noexcept -> usize {
+        FWorkerPool* pool    = FJobSystem::GetDefaultWorkerPool();
+        const usize  workers = (pool != nullptr ? pool->GetWorkerCount() : 0) + 1;
+        const usize  grain   = count / (workers * 4);
+        return grain > 0 ? grain : 1;
+    }
+
+    void ParallelForRange(
+        usize count, usize grainSize, TFunction<void(usize, usize)> body) {
+        if (count == 0)
+            return;
+
+        const usize grain = grainSize > 0 ? grainSize : GetDefaultParallelGrain(count);
+        if (count <= grain) {
+            body(0, count);
+            return;
+        }
+
+        FParallelForContext ctx;
+        ctx.mBody  = &body;
+        ctx.mGrain = grain;
+        ctx.mPool  = FJobSystem::GetDefaultWorkerPool();
+        RunParallelRange(&ctx, 0, count);
+        ctx.mGroup.Wait();
+        if (ctx.mException) {
+            std::rethrow_exception(ctx.mException);
+        }
+    }
+
+} // namespace AltinaEngine::Core::Jobs
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "../../Public/Types/Aliases.h"
+#include "../../Public/Container/Vector.h"
+
+#include <atomic>
+
+namespace AltinaEngine::Core::Jobs::Detail {
+
+    // Chase-Lev work-stealing deque ("Correct and Efficient Work-Stealing for Weak Memory
+    // Models", Le et al. 2013). The owning worker pushes and pops at the bottom (LIFO, keeps
+    // caches warm); any other thread may steal from the top (FIFO, takes the oldest and usually
+    // largest piece of work). Items are raw pointers; ownership stays with the caller.
+    template <typename T> class TWorkStealingDeque {
+    public:
+        explicit TWorkStealingDeque(i64 initialCapacity = 256)
+            : mRing(new FRing(initialCapacity)) {}
+
+        ~TWorkStealingDeque() {
+            delete mRing.load(std::memory_order_relaxed);
+            for (usize i = 0; i < mRetired.Size(); ++i) {
+                delete mRetired[i];
+            }
+        }
+
+        TWorkStealingDeque(const TWorkStealingDeque&)                    = delete;
+        auto operator=(const TWorkStealingDeque&) -> TWorkStealingDeque& = delete;
+
+        // Owner thread only.
+        void Push(T* item) {
+            const i64 bottom = mBottom.load(std::memory_order_relaxed);
+            const i64 top    = mTop.load(std::memory_order_acquire);
+            FRing*    ring   = mRing.load(std::memory_order_relaxed);
+            if (bottom - top > ring->mCapacity - 1) {
+                // Thieves may still be reading the old ring; keep it alive until destruction.
+                FRing* grown = ring->Grow(bottom, top);
+                mRetired.PushBack(ring);
+                mRing.store(grown, std::memory_order_release);
+                ring = grown;
+            }
+            ring->Put(bottom, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            mBottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        // Owner thread only. Returns nullptr when empty or when a thief won the last item.
+        auto Pop() -> T* {
+            const i64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+            FRing*    ring   = mRing.load(std::memory_order_relaxed);
+            mBottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            i64 top = mTop.load(std::memory_order_relaxed);
+
+            if (top > bottom) {
+                mBottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T* item = ring->Get(bottom);
+            if (top == bottom) {
+                // Last item: race against thieves for it.
+                if (!mTop.compare_exchange_strong(
+                        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+                mBottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        // Any thread. Returns nullptr when empty or when the steal lost a race.
+        auto Steal() -> T* {
+            i64 top = mTop.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const i64 bottom = mBottom.load(std::memory_order_acquire);
+            if (top >= bottom) {
+                return nullptr;
+            }
+
+            FRing* ring = mRing.load(std::memory_order_acquire);
+            T*     item = ring->Get(top);
+            if (!mTop.compare_exchange_strong(
+                    top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return item;
+        }
+
+        // Approximate; only meaningful as a hint.
+        [[nodiscard]] auto IsEmpty() const noexcept -> bool {
+            return mBottom.load(std::memory_order_relaxed)
+                <= mTop.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct FRing {
+            explicit FRing(i64 capacity)
+                : mCapacity(capacity), mMask(capacity - 1), mSlots(new std::atomic<T*>[capacity]) {}
+            ~FRing() { delete[] mSlots; }
+
+            FRing(const FRing&)                    = delete;
+            auto operator=(const FRing&) -> FRing& = delete;
+
+            [[nodiscard]] auto Get(i64 index) const noexcept -> T* {
+                return mSlots[index & mMask].load(std::memory_order_relaxed);
+            }
+            void Put(i64 index, T* item) noexcept {
+                mSlots[index & mMask].store(item, std::memory_order_relaxed);
+            }
+            [[nodiscard]] auto Grow(i64 bottom, i64 top) const -> FRing* {
+                auto* grown = new FRing(mCapacity * 2);
+                for (i64 i = top; i < bottom; ++i) {
+                    grown->Put(i, Get(i));
+                }
+                return grown;
+            }
+
+            i64              mCapacity;
+            i64              mMask;
+            std::atomic<T*>* mSlots;
+        };
+
+        alignas(64) std::atomic<i64> mTop{ 0 };
+        alignas(64) std::atomic<i64> mBottom{ 0 };
+        std::atomic<FRing*>      mRing;
+        Container::TVector<FRing*> mRetired; // owner only
+    };
+
+} // namespace AltinaEngine::Core::Jobs::Detail
@@ -0,0 +1,163 @@
+#include "Memory/FrameAllocator.h"
+
+#include "Platform/Generic/GenericPlatformDecl.h"
+
+namespace AltinaEngine::Core::Memory {
+    using Platform::GetGlobalMemoryAllocator;
+
+    struct alignas(16) FFrameArena::FChunk {
+        FChunk* mNext = nullptr;
+        usize   mSize = 0U;
+    };
+
+    namespace {
+        // Learned chunk sizes are rounded so small variations between frames do not matter.
+        constexpr usize kChunkGranularity = 64U * 1024U;
+
+        struct FThreadFrameMemory {
+            FFrameArena mArenas[2];
+            u64         mFrameCount = 0ULL;
+        };
+
+        thread_local FThreadFrameMemory tFrameMemory;
+    } // namespace
+
+    FFrameArena::FFrameArena(usize chunkSize) noexcept
+        : mChunkSize(chunkSize), mMinChunkSize(chunkSize), mNextChunkSize(chunkSize) {}
+
+    FFrameArena::~FFrameArena() { FreeChunks(); }
+
+    FFrameArena::FFrameArena(FFrameArena&& other) noexcept
+        : mChunks(other.mChunks)
+        , mCursor(other.mCursor)
+        , mEnd(other.mEnd)
+        , mUsedBytes(other.mUsedBytes)
+        , mReservedBytes(other.mReservedBytes)
+        , mChunkSize(other.mChunkSize)
+        , mMinChunkSize(other.mMinChunkSize)
+        , mNextChunkSize(other.mNextChunkSize)
+        , mChunkCount(other.mChunkCount) {
+        other.mChunks        = nullptr;
+        other.mCursor        = nullptr;
+        other.mEnd           = nullptr;
+        other.mUsedBytes     = 0U;
+        other.mReservedBytes = 0U;
+        other.mChunkCount    = 0U;
+    }
+
+    auto FFrameArena::operator=(FFrameArena&& other) noexcept -> FFrameArena& {
+        if (this != &other) {
+            FreeChunks();
+            mChunks              = other.mChunks;
+            mCursor              = other.mCursor;
+            mEnd                 = other.mEnd;
+            mUsedBytes           = other.mUsedBytes;
+            mReservedBytes       = other.mReservedBytes;
+            mChunkSize           = other.mChunkSize;
+            mMinChunkSize        = other.mMinChunkSize;
+            mNextChunkSize       = other.mNextChunkSize;
+            mChunkCount          = other.mChunkCount;
+            other.mChunks        = nullptr;
+            other.mCursor        = nullptr;
+            other.mEnd           = nullptr;
+            other.mUsedBytes     = 0U;
+            other.mReservedBytes = 0U;
+            other.mChunkCount    = 0U;
+        }
+        return *this;
+    }
+
+    auto FFrameArena::AllocateSlow(usize sizeBytes, usize alignment) noexcept -> void* {
+        const usize header = sizeof(FChunk);
+        if (sizeBytes > ~static_cast<usize>(0) - header - alignment) {
+            return nullptr;
+        }
+        const usize needed     = header + alignment + sizeBytes;
+        const usize chunkBytes = (needed > mNextChunkSize) ? needed : mNextChunkSize;
+        void*       memory     = GetGlobalMemoryAllocator()->MemoryAllocate(chunkBytes, 0U);
+        if (memory == nullptr) {
+            return nullptr;
+        }
+        // A frame that outgrew its chunk is likely to keep growing; double instead of creeping.
+        if (mNextChunkSize <= (~static_cast<usize>(0) >> 1U)) {
+            mNextChunkSize *= 2U;
+        }
+
+        auto* chunk  = static_cast<FChunk*>(memory);
+        chunk->mNext = mChunks;
+        chunk->mSize = chunkBytes;
+        mChunks      = chunk;
+        ++mChunkCount;
+        mReservedBytes += chunkBytes;
+        mCursor = static_cast<u8*>(memory) + header;
+        mEnd    = static_cast<u8*>(memory) + chunkBytes;
+        return Allocate(sizeBytes, alignment);
+    }
+
+    void FFrameArena::Reset() noexcept {
+        mUsedBytes = 0U;
+        if (mChunkCount > 1U) {
+            // One chunk of the combined size holds the same frame without spilling next time.
+            // Small arenas round to their own size so they stay small.
+            const usize granularity = (mMinChunkSize != 0U && mMinChunkSize < kChunkGranularity)
+                ? mMinChunkSize
+                : kChunkGranularity;
+            const usize learned =
+                (mReservedBytes + granularity - 1U) / granularity * granularity;
+            FreeChunks();
+            mChunkSize     = (learned > mChunkSize) ? learned : mChunkSize;
+            mNextChunkSize = mChunkSize;
+            return;
+        }
+        mNextChunkSize = mChunkSize;
+        if (mChunks != nullptr) {
+            mCursor = reinterpret_cast<u8*>(mChunks) + sizeof(FChunk);
+        }
+    }
+
+    void FFrameArena::Release() noexcept {
+        FreeChunks();
+        mUsedBytes     = 0U;
+        mChunkSize     = mMinChunkSize;
+        mNextChunkSize = mChunkSize;
+    }
+
+    void FFrameArena::GrowChunkSize(usize chunkSize) noexcept {
+        mChunkSize     = (chunkSize > mChunkSize) ? chunkSize : mChunkSize;
+        mNextChunkSize = (chunkSize > mNextChunkSize) ? chunkSize : mNextChunkSize;
+    }
+
+    void FFrameArena::FreeChunks() noexcept {
+        auto* allocator = GetGlobalMemoryAllocator();
+        while (mChunks != nullptr) {
+            FChunk* next = mChunks->mNext;
+            allocator->MemoryFree(mChunks);
+            mChunks = next;
+        }
+        mCursor        = nullptr;
+        mEnd           = nullptr;
+        mReservedBytes = 0U;
+        mChunkCount    = 0U;
+    }
+
+    void FFrameMemory::BeginFrame() noexcept {
+        FThreadFrameMemory& memory = tFrameMemory;
+        ++memory.mFrameCount;
+        memory.mArenas[memory.mFrameCount & 1ULL].Reset();
+    }
+
+    void FFrameMemory::ShutdownThread() noexcept {
+        FThreadFrameMemory& memory = tFrameMemory;
+        memory.mArenas[0].Release();
+        memory.mArenas[1].Release();
+        memory.mFrameCount = 0ULL;
+    }
+
+    auto FFrameMemory::GetThreadArena() noexcept -> FFrameArena* {
+        FThreadFrameMemory& memory = tFrameMemory;
+        return (memory.mFrameCount == 0ULL) ? nullptr
+                                            : &memory.mArenas[memory.mFrameCount & 1ULL];
+    }
+
+    auto FFrameMemory::GetThreadFrameCount() noexcept -> u64 { return tFrameMemory.mFrameCount; }
+} // namespace AltinaEngine::Core::Memory
@@ -27,9 +27,13 @@
     #else
         #define TEXT(str) str
     #endif
-#elif AE_PLATFORM_MACOS
-    #include <mach-o/dyld.h>
 #else
+    #if AE_PLATFORM_MACOS
+        #include <mach-o/dyld.h>
+    #endif
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
     #include <unistd.h>
 #endif
 
@@ -163,11 +167,174 @@ namespace AltinaEngine::Core::Platform {
         return file.good() || file.eof();
     }
 
+    auto WriteFileBytes(const FString& path, const void* data, usize sizeBytes) -> bool {
+        if (path.IsEmptyString() || (data == nullptr && sizeBytes > 0)) {
+            return false;
+        }
+        std::error_code ec;
+        const auto      fsPath  = ToPath(path);
+        auto            tmpPath = fsPath;
+        tmpPath += ".tmp";
+        {
+            std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                return false;
+            }
+            if (sizeBytes > 0) {
+                file.write(
+                    static_cast<const char*>(data), static_cast<std::streamsize>(sizeBytes));
+            }
+            if (!file.good()) {
+                file.close();
+                std::filesystem::remove(tmpPath, ec);
+                return false;
+            }
+        }
+        std::filesystem::rename(tmpPath, fsPath, ec);
+        if (ec) {
+            std::filesystem::remove(tmpPath, ec);
+            return false;
+        }
+        return true;
+    }
+
     void RemoveFileIfExists(const FString& path) {
         std::error_code ec;
         std::filesystem::remove(ToPath(path), ec);
     }
 
+    auto OpenFileForRead(const FString& path) -> FFileHandle {
+        if (path.IsEmptyString()) {
+            return nullptr;
+        }
+#if AE_PLATFORM_WIN
+        const auto   widePath = ToPath(path).wstring();
+        const HANDLE file     = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        return (file == INVALID_HANDLE_VALUE) ? nullptr : static_cast<FFileHandle>(file);
+#else
+    #if defined(AE_UNICODE) || defined(UNICODE) || defined(_UNICODE)
+        const auto utf8 = Utility::String::ToUtf8Bytes(path);
+        const int  fd   = open(utf8.CStr(), O_RDONLY | O_CLOEXEC);
+    #else
+        const int fd = open(path.CStr(), O_RDONLY | O_CLOEXEC);
+    #endif
+        if (fd < 0) {
+            return nullptr;
+        }
+        // Offset by one so that descriptor 0 does not read as a null handle.
+        return reinterpret_cast<FFileHandle>(static_cast<intptr_t>(fd) + 1);
+#endif
+    }
+
+    void CloseFile(FFileHandle handle) {
+        if (handle == nullptr) {
+            return;
+        }
+#if AE_PLATFORM_WIN
+        CloseHandle(static_cast<HANDLE>(handle));
+#else
+        close(static_cast<int>(reinterpret_cast<intptr_t>(handle) - 1));
+#endif
+    }
+
+    auto GetFileSize(FFileHandle handle) -> u64 {
+        if (handle == nullptr) {
+            return 0ULL;
+        }
+#if AE_PLATFORM_WIN
+        LARGE_INTEGER size{};
+        if (GetFileSizeEx(static_cast<HANDLE>(handle), &size) == 0) {
+            return 0ULL;
+        }
+        return static_cast<u64>(size.QuadPart);
+#else
+        struct stat info{};
+        if (fstat(static_cast<int>(reinterpret_cast<intptr_t>(handle) - 1), &info) != 0) {
+            return 0ULL;
+        }
+        return static_cast<u64>(info.st_size);
+#endif
+    }
+
+    auto ReadFileAt(FFileHandle handle, u64 offset, void* outBuffer, usize sizeBytes) -> bool {
+        if (handle == nullptr || (outBuffer == nullptr && sizeBytes > 0)) {
+            return false;
+        }
+        auto* dst = static_cast<u8*>(outBuffer);
+        while (sizeBytes > 0) {
+#if AE_PLATFORM_WIN
+            // An explicit OVERLAPPED offset makes ReadFile positional on synchronous handles.
+            const DWORD request = (sizeBytes > 0x40000000U) ? 0x40000000U
+                                                           : static_cast<DWORD>(sizeBytes);
+            OVERLAPPED  overlapped{};
+            overlapped.Offset     = static_cast<DWORD>(offset & 0xffffffffULL);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32U);
+            DWORD read            = 0;
+            if (ReadFile(static_cast<HANDLE>(handle), dst, request, &read, &overlapped) == 0
+                || read == 0) {
+                return false;
+            }
+#else
+            const ssize_t read =
+                pread(static_cast<int>(reinterpret_cast<intptr_t>(handle) - 1), dst, sizeBytes,
+                    static_cast<off_t>(offset));
+            if (read < 0 && errno == EINTR) {
+                continue;
+            }
+            if (read <= 0) {
+                return false;
+            }
+#endif
+            dst += static_cast<usize>(read);
+            offset += static_cast<u64>(read);
+            sizeBytes -= static_cast<usize>(read);
+        }
+        return true;
+    }
+
+    auto MapFile(FFileHandle handle, FFileMapping& outMapping) -> bool {
+        outMapping     = {};
+        const u64 size = GetFileSize(handle);
+        if (size == 0ULL || size > static_cast<u64>(static_cast<usize>(-1))) {
+            return false;
+        }
+#if AE_PLATFORM_WIN
+        HANDLE mapping =
+            CreateFileMappingW(static_cast<HANDLE>(handle), nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr) {
+            return false;
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            CloseHandle(mapping);
+            return false;
+        }
+        outMapping.mNative = mapping;
+#else
+        void* view = mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_SHARED,
+            static_cast<int>(reinterpret_cast<intptr_t>(handle) - 1), 0);
+        if (view == MAP_FAILED) {
+            return false;
+        }
+#endif
+        outMapping.mData = static_cast<const u8*>(view);
+        outMapping.mSize = size;
+        return true;
+    }
+
+    void UnmapFile(FFileMapping& mapping) {
+        if (mapping.mData != nullptr) {
+#if AE_PLATFORM_WIN
+            UnmapViewOfFile(mapping.mData);
+            CloseHandle(static_cast<HANDLE>(mapping.mNative));
+#else
+            munmap(const_cast<u8*>(mapping.mData), static_cast<size_t>(mapping.mSize));
+#endif
+        }
+        mapping = {};
+    }
+
     auto IsPathExist(const FString& path) -> bool {
         std::error_code ec;
         return std::filesystem::exists(ToPath(path), ec);
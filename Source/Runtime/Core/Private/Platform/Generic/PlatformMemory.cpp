@@ -1,20 +1,66 @@
 #include "Platform/Generic/GenericPlatformDecl.h"
+#include "Platform/PlatformMemory.h"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#ifndef AE_CORE_USE_SYSTEM_ALLOCATOR
+    #define AE_CORE_USE_SYSTEM_ALLOCATOR 0
+#endif
 
 #if AE_PLATFORM_WIN
+    #ifdef TEXT
+        #undef TEXT
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
     #include <malloc.h>
+    #include <windows.h>
+    #ifdef TEXT
+        #undef TEXT
+    #endif
+    #if defined(AE_UNICODE) || defined(UNICODE) || defined(_UNICODE)
+        #define TEXT(str) L##str
+    #else
+        #define TEXT(str) str
+    #endif
+#else
+    #include <sys/mman.h>
+    #include <unistd.h>
 #endif
 
 namespace AltinaEngine::Core::Platform {
 
     namespace {
+        constexpr usize kMinAlignment = alignof(std::max_align_t);
+        constexpr usize kTagCount     = static_cast<usize>(EMemoryTag::Count);
+
+        struct FThreadHeap;
+
+        // One thread_local for everything the hot path needs; in a shared library every
+        // distinct thread_local costs a TLS lookup.
+        struct FThreadMemoryState {
+            FThreadHeap* mHeap         = nullptr;
+            EMemoryTag   mTag          = EMemoryTag::Default;
+            bool         mHeapReleased = false;
+        };
+
+        thread_local FThreadMemoryState tThreadState;
+
         // Normalize alignment to a sensible power-of-two minimum.
         [[nodiscard]] constexpr auto NormalizeAlignment(usize Alignment) noexcept -> usize {
             if (Alignment == 0U) {
-                return alignof(std::max_align_t);
+                return kMinAlignment;
             }
 
             if ((Alignment & (Alignment - 1U)) != 0U) {
@@ -25,32 +71,896 @@ namespace AltinaEngine::Core::Platform {
                 Alignment = powerOfTwo;
             }
 
-            return std::max<usize>(Alignment, alignof(std::max_align_t));
+            return std::max<usize>(Alignment, kMinAlignment);
         }
+
+        [[nodiscard]] constexpr auto AlignUp(usize value, usize alignment) noexcept -> usize {
+            return (value + alignment - 1U) & ~(alignment - 1U);
+        }
+
+        [[nodiscard]] auto TagIndex(EMemoryTag tag) noexcept -> usize {
+            const auto index = static_cast<usize>(tag);
+            return (index < kTagCount) ? index : 0U;
+        }
+
+        struct FTagCounters {
+            std::atomic<i64> mBytes{ 0 };
+            std::atomic<i64> mAllocations{ 0 };
+            std::atomic<i64> mTotalAllocations{ 0 };
+        };
     } // namespace
 
-    class FDefaultMemoryAllocator final : public FMemoryAllocator {
+#if AE_CORE_USE_SYSTEM_ALLOCATOR
+    namespace {
+        FTagCounters gTagCounters[kTagCount];
+
+        // Sits right before the user pointer so free and realloc know the block's size and tag.
+        struct FSystemBlockHeader {
+            usize      mSize;
+            u32        mOffset;
+            EMemoryTag mTag;
+        };
+
+        [[nodiscard]] auto GetSystemHeader(void* ptr) noexcept -> FSystemBlockHeader* {
+            return static_cast<FSystemBlockHeader*>(ptr) - 1;
+        }
+    } // namespace
+
+    // Plain malloc with a small header; meant for sanitizer and leak-checker runs, where the
+    // engine allocator would hide individual blocks from the tool.
+    class FSystemMemoryAllocator final : public FMemoryAllocator {
     public:
         auto MemoryAllocate(usize Size, usize Alignment) -> void* override {
-            if (Size == 0U) {
+            return Allocate(Size, Alignment, tThreadState.mTag);
+        }
+
+        auto MemoryReallocate(void* Ptr, usize NewSize, usize Alignment) -> void* override {
+            if (Ptr == nullptr) {
+                return MemoryAllocate(NewSize, Alignment);
+            }
+
+            if (NewSize == 0U) {
+                MemoryFree(Ptr);
                 return nullptr;
             }
 
-            const usize normalizedAlignment = NormalizeAlignment(Alignment);
+            const FSystemBlockHeader* header = GetSystemHeader(Ptr);
+            void* result = Allocate(NewSize, Alignment, header->mTag);
+            if (result != nullptr) {
+                std::memcpy(result, Ptr, std::min(header->mSize, NewSize));
+                MemoryFree(Ptr);
+            }
+            return result;
+        }
+
+        void MemoryFree(void* Ptr) override {
+            if (Ptr == nullptr) {
+                return;
+            }
+
+            const FSystemBlockHeader* header   = GetSystemHeader(Ptr);
+            FTagCounters&             counters = gTagCounters[TagIndex(header->mTag)];
+            counters.mBytes.fetch_sub(static_cast<i64>(header->mSize), std::memory_order_relaxed);
+            counters.mAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+            void* base = static_cast<u8*>(Ptr) - header->mOffset;
+#if AE_PLATFORM_WIN
+            _aligned_free(base);
+#else
+            std::free(base);
+#endif
+        }
+
+    private:
+        static auto Allocate(usize size, usize alignment, EMemoryTag tag) -> void* {
+            if (size == 0U) {
+                return nullptr;
+            }
+
+            const usize normalizedAlignment = NormalizeAlignment(alignment);
+            const usize offset = AlignUp(sizeof(FSystemBlockHeader), normalizedAlignment);
+
+#if AE_PLATFORM_WIN
+            void* base = _aligned_malloc(offset + size, normalizedAlignment);
+#else
+            void* base = nullptr;
+            if (normalizedAlignment <= kMinAlignment) {
+                base = std::malloc(offset + size);
+            } else if (posix_memalign(&base, normalizedAlignment, offset + size) != 0) {
+                base = nullptr;
+            }
+#endif
+            if (base == nullptr) {
+                return nullptr;
+            }
+
+            void*               result = static_cast<u8*>(base) + offset;
+            FSystemBlockHeader* header = GetSystemHeader(result);
+            header->mSize              = size;
+            header->mOffset            = static_cast<u32>(offset);
+            header->mTag               = tag;
+
+            FTagCounters& counters = gTagCounters[TagIndex(tag)];
+            counters.mBytes.fetch_add(static_cast<i64>(size), std::memory_order_relaxed);
+            counters.mAllocations.fetch_add(1, std::memory_order_relaxed);
+            counters.mTotalAllocations.fetch_add(1, std::memory_order_relaxed);
+            return result;
+        }
+    };
+
+    auto GetMemoryTagStats(EMemoryTag tag) noexcept -> FMemoryTagStats {
+        const FTagCounters& counters = gTagCounters[TagIndex(tag)];
+        FMemoryTagStats     stats{};
+        stats.mLiveBytes = static_cast<u64>(
+            std::max<i64>(counters.mBytes.load(std::memory_order_relaxed), 0));
+        stats.mLiveAllocations = static_cast<u64>(
+            std::max<i64>(counters.mAllocations.load(std::memory_order_relaxed), 0));
+        stats.mTotalAllocations =
+            static_cast<u64>(counters.mTotalAllocations.load(std::memory_order_relaxed));
+        return stats;
+    }
+
+    auto GetGlobalMemoryAllocator() noexcept -> FMemoryAllocator* {
+        static FSystemMemoryAllocator gSystemAllocator;
+        return &gSystemAllocator;
+    }
+#else
+    namespace {
+        // Small blocks are carved out of 256 KiB spans. The span header sits at the start of the
+        // span, so the owner of any small block is found by masking its address. Large blocks
+        // get their own mapping with a span header at a span-aligned address right below the
+        // user pointer, so the same lookup works for them.
+        constexpr usize kSpanSize           = 256U * 1024U;
+        constexpr usize kSpanHeaderSize     = 256U;
+        constexpr usize kChunkSpanCount     = 16U;
+        constexpr usize kMaxSmallSize       = 32U * 1024U;
+        constexpr usize kMaxSmallAlignment  = kSpanHeaderSize;
+        // 16-byte steps up to 256 bytes, then four classes per power of two up to 32 KiB.
+        constexpr u32   kSmallClassCount    = 16U + 7U * 4U;
+        constexpr u32   kSpanScanLimit      = 8U;
+        constexpr usize kLargeCacheSlots    = 64U;
+        constexpr usize kLargeCacheMaxBlock = 4U * 1024U * 1024U;
+        constexpr usize kLargeCacheCapacity = 64U * 1024U * 1024U;
+
+        [[nodiscard]] constexpr auto GetClassSize(u32 classIndex) noexcept -> usize {
+            if (classIndex < 16U) {
+                return (static_cast<usize>(classIndex) + 1U) * 16U;
+            }
+            const u32 range = (classIndex - 16U) / 4U;
+            const u32 step  = (classIndex - 16U) % 4U;
+            return (usize{ 256U } << range) + (step + 1U) * (usize{ 64U } << range);
+        }
+
+        [[nodiscard]] constexpr auto GetClassIndex(usize size) noexcept -> u32 {
+            if (size <= 256U) {
+                return static_cast<u32>((size + 15U) / 16U) - 1U;
+            }
+            const usize value = size - 1U;
+            const auto  msb   = static_cast<u32>(std::bit_width(value)) - 1U;
+            return 16U + (msb - 8U) * 4U + static_cast<u32>((value >> (msb - 2U)) & 3U);
+        }
+
+        static_assert(GetClassSize(kSmallClassCount - 1U) == kMaxSmallSize);
+        static_assert(GetClassIndex(kMaxSmallSize) == kSmallClassCount - 1U);
+        static_assert(GetClassSize(GetClassIndex(257U)) == 320U);
+        static_assert(GetClassSize(GetClassIndex(513U)) == 640U);
+
+        // Returns kSmallClassCount when the request needs a large block. Class sizes above the
+        // alignment are multiples of it only every few classes, so aligned requests may round up
+        // further than plain ones.
+        [[nodiscard]] auto FindSmallClass(usize size, usize alignment) noexcept -> u32 {
+            if (size > kMaxSmallSize || alignment > kMaxSmallAlignment) {
+                return kSmallClassCount;
+            }
+            if (alignment <= kMinAlignment) {
+                return GetClassIndex(size);
+            }
+            u32 classIndex = GetClassIndex(std::max(size, alignment));
+            while (classIndex < kSmallClassCount
+                && (GetClassSize(classIndex) & (alignment - 1U)) != 0U) {
+                ++classIndex;
+            }
+            return classIndex;
+        }
+
+        class FSpinLock {
+        public:
+            void Lock() noexcept {
+                for (u32 spin = 0U; mFlag.test_and_set(std::memory_order_acquire); ++spin) {
+                    if (spin >= 64U) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+            void Unlock() noexcept { mFlag.clear(std::memory_order_release); }
+
+        private:
+            std::atomic_flag mFlag{};
+        };
 
+        class FSpinLockGuard {
+        public:
+            explicit FSpinLockGuard(FSpinLock& lock) noexcept : mLock(lock) { mLock.Lock(); }
+            ~FSpinLockGuard() noexcept { mLock.Unlock(); }
+
+            FSpinLockGuard(const FSpinLockGuard&)                    = delete;
+            auto operator=(const FSpinLockGuard&) -> FSpinLockGuard& = delete;
+
+        private:
+            FSpinLock& mLock;
+        };
+
+        [[nodiscard]] auto GetPageSize() noexcept -> usize {
+            static const usize pageSize = [] {
 #if AE_PLATFORM_WIN
-            return _aligned_malloc(Size, normalizedAlignment);
+                SYSTEM_INFO info{};
+                GetSystemInfo(&info);
+                return static_cast<usize>(info.dwPageSize);
 #else
-            if (NormalizedAlignment <= alignof(std::max_align_t)) {
-                return std::malloc(Size);
+                const long value = sysconf(_SC_PAGESIZE);
+                return (value > 0) ? static_cast<usize>(value) : usize{ 4096U };
+#endif
+            }();
+            return pageSize;
+        }
+
+        // Maps `size` bytes of zeroed, committed memory starting at a multiple of `alignment`
+        // (a power of two no smaller than the page size).
+        [[nodiscard]] auto MapPages(usize size, usize alignment) noexcept -> void* {
+#if AE_PLATFORM_WIN
+            // Reserve an oversized range to find an aligned address, then map exactly there.
+            // Another thread may grab the address in between, so retry a few times.
+            for (u32 attempt = 0U; attempt < 8U; ++attempt) {
+                void* probe = VirtualAlloc(nullptr, size + alignment, MEM_RESERVE, PAGE_NOACCESS);
+                if (probe == nullptr) {
+                    return nullptr;
+                }
+                const usize aligned = AlignUp(reinterpret_cast<usize>(probe), alignment);
+                VirtualFree(probe, 0, MEM_RELEASE);
+                void* result = VirtualAlloc(reinterpret_cast<void*>(aligned), size,
+                    MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+                if (result != nullptr) {
+                    return result;
+                }
+            }
+            return nullptr;
+#else
+            void* raw = mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED) {
+                return nullptr;
+            }
+            const auto  rawAddress = reinterpret_cast<usize>(raw);
+            const usize aligned    = AlignUp(rawAddress, alignment);
+            const usize head       = aligned - rawAddress;
+            const usize tail       = alignment - head;
+            if (head != 0U) {
+                munmap(raw, head);
+            }
+            if (tail != 0U) {
+                munmap(reinterpret_cast<void*>(aligned + size), tail);
             }
+            return reinterpret_cast<void*>(aligned);
+#endif
+        }
 
-            void*     Result = nullptr;
-            const int Error  = posix_memalign(&Result, NormalizedAlignment, Size);
-            return (Error == 0) ? Result : nullptr;
+        void UnmapPages(void* ptr, usize size) noexcept {
+#if AE_PLATFORM_WIN
+            (void)size;
+            VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+            munmap(ptr, size);
 #endif
         }
 
+        enum class ESpanKind : u32 {
+            Small = 1,
+            Large = 2
+        };
+
+        // Fields above mRemoteFree are only touched by the owning heap (or under a global lock
+        // while the span has no owner); other threads only read mKind/mTag/mBlockSize/mOwner and
+        // push onto mRemoteFree.
+        struct FSpan {
+            ESpanKind                 mKind       = ESpanKind::Small;
+            u32                       mClassIndex = 0U;
+            u32                       mBlockSize  = 0U;
+            u32                       mCapacity   = 0U;
+            u32                       mCarved     = 0U;
+            u32                       mUsed       = 0U;
+            EMemoryTag                mTag        = EMemoryTag::Default;
+            bool                      mExhausted  = false;
+            std::atomic<FThreadHeap*> mOwner{ nullptr };
+            void*                     mLocalFree = nullptr;
+            FSpan*                    mPrev      = nullptr;
+            FSpan*                    mNext      = nullptr;
+
+            // Large blocks only.
+            u8*                       mMapBase  = nullptr;
+            usize                     mMapSize  = 0U;
+            usize                     mUserSize = 0U;
+
+            alignas(64) std::atomic<void*> mRemoteFree{ nullptr };
+        };
+        static_assert(sizeof(FSpan) <= kSpanHeaderSize);
+
+        [[nodiscard]] auto GetSpan(const void* ptr) noexcept -> FSpan* {
+            const auto address = reinterpret_cast<usize>(ptr);
+            usize      base    = address & ~(kSpanSize - 1U);
+            // Only a large block aligned to the span size starts exactly on a span boundary; its
+            // header lives in the span right below.
+            if (base == address) {
+                base -= kSpanSize;
+            }
+            return reinterpret_cast<FSpan*>(base);
+        }
+
+        [[nodiscard]] auto GetSpanData(FSpan* span) noexcept -> u8* {
+            return reinterpret_cast<u8*>(span) + kSpanHeaderSize;
+        }
+
+        [[nodiscard]] auto NextBlock(void* block) noexcept -> void*& {
+            return *static_cast<void**>(block);
+        }
+
+        // Block counters live next to the list heads the hot path touches anyway; bytes are
+        // derived from the class size when stats are queried. They are written only by the
+        // owning thread (plain load + store) and summed up by readers. Frees are counted by the
+        // freeing thread, so a single heap's count may go negative.
+        struct FBin {
+            FSpan*           mActive = nullptr;
+            FSpan*           mHead   = nullptr;
+            FSpan*           mTail   = nullptr;
+            std::atomic<i64> mLiveBlocks{ 0 };
+            std::atomic<i64> mTotalBlocks{ 0 };
+        };
+
+        // Per-thread cache. Bins are split by tag so a block's tag is a property of its span
+        // and frees never need a per-block header.
+        struct FThreadHeap {
+            FBin         mBins[kTagCount][kSmallClassCount];
+            FTagCounters mLargeStats[kTagCount];
+            FThreadHeap* mPrevHeap = nullptr;
+            FThreadHeap* mNextHeap = nullptr;
+        };
+
+        FSpinLock    gSpanPoolLock;
+        FSpan*       gSpanPool = nullptr;
+
+        FSpinLock    gAbandonedLock;
+        FSpan*       gAbandoned[kTagCount][kSmallClassCount]{};
+
+        FSpinLock    gHeapLock;
+        FThreadHeap* gHeaps        = nullptr;
+        FThreadHeap* gRetiredHeaps = nullptr;
+        // Counters of exited threads, and of frees made by threads without a heap.
+        FTagCounters gOrphanStats[kTagCount];
+
+        FSpinLock    gFallbackLock;
+        FThreadHeap* gFallbackHeap = nullptr;
+
+        struct FLargeCacheEntry {
+            u8*   mBase = nullptr;
+            usize mSize = 0U;
+        };
+        FSpinLock        gLargeCacheLock;
+        FLargeCacheEntry gLargeCache[kLargeCacheSlots]{};
+        usize            gLargeCacheBytes = 0U;
+
+        void AddOwned(std::atomic<i64>& counter, i64 delta) noexcept {
+            counter.store(counter.load(std::memory_order_relaxed) + delta,
+                std::memory_order_relaxed);
+        }
+
+        void RecordOrphan(EMemoryTag tag, i64 bytes, i64 allocations, i64 total) noexcept {
+            FTagCounters& counters = gOrphanStats[TagIndex(tag)];
+            counters.mBytes.fetch_add(bytes, std::memory_order_relaxed);
+            counters.mAllocations.fetch_add(allocations, std::memory_order_relaxed);
+            counters.mTotalAllocations.fetch_add(total, std::memory_order_relaxed);
+        }
+
+        void RecordLarge(FThreadHeap* heap, EMemoryTag tag, i64 bytes, i64 allocations) noexcept {
+            const i64 total = (allocations > 0) ? allocations : 0;
+            if (heap == nullptr) {
+                RecordOrphan(tag, bytes, allocations, total);
+                return;
+            }
+            FTagCounters& counters = heap->mLargeStats[TagIndex(tag)];
+            AddOwned(counters.mBytes, bytes);
+            AddOwned(counters.mAllocations, allocations);
+            AddOwned(counters.mTotalAllocations, total);
+        }
+
+        struct FStatsSum {
+            i64 mBytes       = 0;
+            i64 mAllocations = 0;
+            i64 mTotal       = 0;
+
+            void Add(const FTagCounters& counters) noexcept {
+                mBytes += counters.mBytes.load(std::memory_order_relaxed);
+                mAllocations += counters.mAllocations.load(std::memory_order_relaxed);
+                mTotal += counters.mTotalAllocations.load(std::memory_order_relaxed);
+            }
+
+            void Add(const FThreadHeap& heap, usize tagIndex) noexcept {
+                Add(heap.mLargeStats[tagIndex]);
+                for (u32 classIndex = 0U; classIndex < kSmallClassCount; ++classIndex) {
+                    const FBin& bin  = heap.mBins[tagIndex][classIndex];
+                    const i64   live = bin.mLiveBlocks.load(std::memory_order_relaxed);
+                    mBytes += live * static_cast<i64>(GetClassSize(classIndex));
+                    mAllocations += live;
+                    mTotal += bin.mTotalBlocks.load(std::memory_order_relaxed);
+                }
+            }
+        };
+
+        void RecordSmallFree(FThreadHeap* heap, const FSpan* span) noexcept {
+            if (heap == nullptr) {
+                RecordOrphan(span->mTag, -static_cast<i64>(span->mBlockSize), -1, 0);
+                return;
+            }
+            AddOwned(heap->mBins[TagIndex(span->mTag)][span->mClassIndex].mLiveBlocks, -1);
+        }
+
+        // ---- Span pool -------------------------------------------------------------------
+
+        [[nodiscard]] auto AcquireSpan() noexcept -> FSpan* {
+            {
+                FSpinLockGuard lock(gSpanPoolLock);
+                if (FSpan* span = gSpanPool; span != nullptr) {
+                    gSpanPool = span->mNext;
+                    return span;
+                }
+            }
+
+            auto* chunk = static_cast<u8*>(MapPages(kSpanSize * kChunkSpanCount, kSpanSize));
+            if (chunk == nullptr) {
+                return nullptr;
+            }
+            FSpinLockGuard lock(gSpanPoolLock);
+            for (usize index = 1U; index < kChunkSpanCount; ++index) {
+                auto* span  = reinterpret_cast<FSpan*>(chunk + index * kSpanSize);
+                span->mNext = gSpanPool;
+                gSpanPool   = span;
+            }
+            return reinterpret_cast<FSpan*>(chunk);
+        }
+
+        // Spans are recycled but never unmapped; their pages stay committed.
+        void ReleaseSpan(FSpan* span) noexcept {
+            FSpinLockGuard lock(gSpanPoolLock);
+            span->mNext = gSpanPool;
+            gSpanPool   = span;
+        }
+
+        // ---- Bin lists ---------------------------------------------------------------------
+
+        void LinkFront(FBin& bin, FSpan* span) noexcept {
+            span->mPrev = nullptr;
+            span->mNext = bin.mHead;
+            if (bin.mHead != nullptr) {
+                bin.mHead->mPrev = span;
+            } else {
+                bin.mTail = span;
+            }
+            bin.mHead = span;
+        }
+
+        void LinkBack(FBin& bin, FSpan* span) noexcept {
+            span->mNext = nullptr;
+            span->mPrev = bin.mTail;
+            if (bin.mTail != nullptr) {
+                bin.mTail->mNext = span;
+            } else {
+                bin.mHead = span;
+            }
+            bin.mTail = span;
+        }
+
+        void Unlink(FBin& bin, FSpan* span) noexcept {
+            if (span->mPrev != nullptr) {
+                span->mPrev->mNext = span->mNext;
+            } else {
+                bin.mHead = span->mNext;
+            }
+            if (span->mNext != nullptr) {
+                span->mNext->mPrev = span->mPrev;
+            } else {
+                bin.mTail = span->mPrev;
+            }
+            span->mPrev = nullptr;
+            span->mNext = nullptr;
+        }
+
+        // ---- Small blocks ------------------------------------------------------------------
+
+        [[nodiscard]] auto HasFreeBlock(const FSpan* span) noexcept -> bool {
+            return span->mLocalFree != nullptr || span->mCarved < span->mCapacity;
+        }
+
+        [[nodiscard]] auto PopBlock(FSpan* span) noexcept -> void* {
+            if (void* block = span->mLocalFree; block != nullptr) {
+                span->mLocalFree = NextBlock(block);
+                ++span->mUsed;
+                return block;
+            }
+            if (span->mCarved < span->mCapacity) {
+                void* block = GetSpanData(span)
+                    + static_cast<usize>(span->mCarved) * span->mBlockSize;
+                ++span->mCarved;
+                ++span->mUsed;
+                return block;
+            }
+            return nullptr;
+        }
+
+        // Moves blocks freed by other threads onto the local list. Returns how many.
+        auto CollectRemoteFrees(FSpan* span) noexcept -> u32 {
+            void* list = span->mRemoteFree.exchange(nullptr, std::memory_order_acquire);
+            if (list == nullptr) {
+                return 0U;
+            }
+            u32   count = 1U;
+            void* tail  = list;
+            while (NextBlock(tail) != nullptr) {
+                tail = NextBlock(tail);
+                ++count;
+            }
+            NextBlock(tail)  = span->mLocalFree;
+            span->mLocalFree = list;
+            span->mUsed -= count;
+            return count;
+        }
+
+        void PushRemoteFree(FSpan* span, void* block) noexcept {
+            void* head = span->mRemoteFree.load(std::memory_order_relaxed);
+            do {
+                NextBlock(block) = head;
+            } while (!span->mRemoteFree.compare_exchange_weak(
+                head, block, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        void InitSmallSpan(FSpan* span, FThreadHeap* heap, EMemoryTag tag, u32 classIndex) {
+            ::new (static_cast<void*>(span)) FSpan();
+            const usize blockSize = GetClassSize(classIndex);
+            span->mKind           = ESpanKind::Small;
+            span->mClassIndex     = classIndex;
+            span->mBlockSize      = static_cast<u32>(blockSize);
+            span->mCapacity       = static_cast<u32>((kSpanSize - kSpanHeaderSize) / blockSize);
+            span->mTag            = tag;
+            span->mOwner.store(heap, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto PopAbandonedSpan(usize tagIndex, u32 classIndex) noexcept -> FSpan* {
+            FSpinLockGuard lock(gAbandonedLock);
+            FSpan*         span = gAbandoned[tagIndex][classIndex];
+            if (span != nullptr) {
+                gAbandoned[tagIndex][classIndex] = span->mNext;
+            }
+            return span;
+        }
+
+        auto AllocateSmallSlow(FThreadHeap& heap, EMemoryTag tag, u32 classIndex) noexcept
+            -> void* {
+            const usize tagIndex = TagIndex(tag);
+            FBin&       bin      = heap.mBins[tagIndex][classIndex];
+
+            if (FSpan* active = bin.mActive; active != nullptr) {
+                if (CollectRemoteFrees(active) != 0U) {
+                    return PopBlock(active);
+                }
+                // Full spans rotate to the back; a local free moves them to the front again.
+                active->mExhausted = true;
+                Unlink(bin, active);
+                LinkBack(bin, active);
+                bin.mActive = nullptr;
+            }
+
+            // Other spans of this bin may have received frees meanwhile. The scan is bounded, so
+            // a bin full of busy spans costs a few checks per fresh span, not a full walk.
+            for (u32 scanned = 0U; scanned < kSpanScanLimit && bin.mHead != nullptr; ++scanned) {
+                FSpan* span = bin.mHead;
+                CollectRemoteFrees(span);
+                if (HasFreeBlock(span)) {
+                    span->mExhausted = false;
+                    bin.mActive      = span;
+                    return PopBlock(span);
+                }
+                span->mExhausted = true;
+                if (span == bin.mTail) {
+                    break;
+                }
+                Unlink(bin, span);
+                LinkBack(bin, span);
+            }
+
+            // Spans left behind by exited threads.
+            while (FSpan* span = PopAbandonedSpan(tagIndex, classIndex)) {
+                span->mOwner.store(&heap, std::memory_order_relaxed);
+                CollectRemoteFrees(span);
+                span->mExhausted = !HasFreeBlock(span);
+                if (span->mExhausted) {
+                    LinkBack(bin, span);
+                    continue;
+                }
+                LinkFront(bin, span);
+                bin.mActive = span;
+                return PopBlock(span);
+            }
+
+            FSpan* span = AcquireSpan();
+            if (span == nullptr) {
+                return nullptr;
+            }
+            InitSmallSpan(span, &heap, tag, classIndex);
+            LinkFront(bin, span);
+            bin.mActive = span;
+            return PopBlock(span);
+        }
+
+        [[nodiscard]] auto AllocateSmall(FThreadHeap& heap, EMemoryTag tag, u32 classIndex) noexcept
+            -> void* {
+            FBin& bin   = heap.mBins[TagIndex(tag)][classIndex];
+            void* block = (bin.mActive != nullptr) ? PopBlock(bin.mActive) : nullptr;
+            if (block == nullptr) {
+                block = AllocateSmallSlow(heap, tag, classIndex);
+                if (block == nullptr) {
+                    return nullptr;
+                }
+            }
+            AddOwned(bin.mLiveBlocks, 1);
+            AddOwned(bin.mTotalBlocks, 1);
+            return block;
+        }
+
+        void FreeSmallLocal(FThreadHeap& heap, FSpan* span, void* block) noexcept {
+            NextBlock(block) = span->mLocalFree;
+            span->mLocalFree = block;
+            --span->mUsed;
+
+            FBin& bin = heap.mBins[TagIndex(span->mTag)][span->mClassIndex];
+            if (span == bin.mActive) {
+                return;
+            }
+            if (span->mUsed == 0U) {
+                Unlink(bin, span);
+                ReleaseSpan(span);
+                return;
+            }
+            if (span->mExhausted) {
+                span->mExhausted = false;
+                Unlink(bin, span);
+                LinkFront(bin, span);
+            }
+        }
+
+        // ---- Large blocks ------------------------------------------------------------------
+
+        [[nodiscard]] auto TakeCachedMapping(usize minSize) noexcept -> FLargeCacheEntry {
+            FSpinLockGuard    lock(gLargeCacheLock);
+            FLargeCacheEntry* best = nullptr;
+            for (FLargeCacheEntry& entry : gLargeCache) {
+                // Best fit, and never more than twice the request; the slack stays unusable
+                // until the block is freed.
+                if (entry.mBase != nullptr && entry.mSize >= minSize
+                    && entry.mSize - minSize <= minSize
+                    && (best == nullptr || entry.mSize < best->mSize)) {
+                    best = &entry;
+                }
+            }
+            if (best == nullptr) {
+                return {};
+            }
+            const FLargeCacheEntry result = *best;
+            *best                         = {};
+            gLargeCacheBytes -= result.mSize;
+            return result;
+        }
+
+        // Returns the mapping the caller has to unmap: `mapping` itself if it was not cached,
+        // the smaller mapping it displaced from a full cache, or nothing.
+        [[nodiscard]] auto CacheMapping(FLargeCacheEntry mapping) noexcept -> FLargeCacheEntry {
+            if (mapping.mSize > kLargeCacheMaxBlock) {
+                return mapping;
+            }
+            FSpinLockGuard    lock(gLargeCacheLock);
+            FLargeCacheEntry* slot = nullptr;
+            for (FLargeCacheEntry& entry : gLargeCache) {
+                if (entry.mBase == nullptr) {
+                    slot = &entry;
+                    break;
+                }
+                if (slot == nullptr || entry.mSize < slot->mSize) {
+                    slot = &entry;
+                }
+            }
+            const FLargeCacheEntry evicted = *slot;
+            if ((evicted.mBase != nullptr && evicted.mSize >= mapping.mSize)
+                || gLargeCacheBytes - evicted.mSize + mapping.mSize > kLargeCacheCapacity) {
+                return mapping;
+            }
+            gLargeCacheBytes += mapping.mSize - evicted.mSize;
+            *slot = mapping;
+            return evicted;
+        }
+
+        [[nodiscard]] auto AllocateLarge(usize size, usize alignment, EMemoryTag tag) noexcept
+            -> void* {
+            const usize pageSize = GetPageSize();
+            // Below span alignment the header takes the first page of the mapping; above it the
+            // user pointer is the first aligned address past one span.
+            const bool  spanAligned = alignment >= kSpanSize;
+            const usize userOffset =
+                spanAligned ? alignment : AlignUp(kSpanHeaderSize, alignment);
+            if (size > ~usize{ 0U } - userOffset - pageSize) {
+                return nullptr;
+            }
+            const usize mapSize = AlignUp(userOffset + size, pageSize);
+
+            u8*   base      = nullptr;
+            usize baseSize  = mapSize;
+            if (!spanAligned) {
+                const FLargeCacheEntry cached = TakeCachedMapping(mapSize);
+                base                          = cached.mBase;
+                baseSize                      = cached.mSize;
+            }
+            if (base == nullptr) {
+                baseSize = mapSize;
+                base     = static_cast<u8*>(MapPages(mapSize, std::max(alignment, kSpanSize)));
+                if (base == nullptr) {
+                    return nullptr;
+                }
+            }
+
+            u8*    user   = base + userOffset;
+            auto*  header = reinterpret_cast<FSpan*>(user - (spanAligned ? kSpanSize : userOffset));
+            ::new (static_cast<void*>(header)) FSpan();
+            header->mKind     = ESpanKind::Large;
+            header->mTag      = tag;
+            header->mMapBase  = base;
+            header->mMapSize  = baseSize;
+            header->mUserSize = size;
+            return user;
+        }
+
+        void FreeLarge(FSpan* header) noexcept {
+            FLargeCacheEntry unmap{ header->mMapBase, header->mMapSize };
+            // Span-aligned blocks keep their header inside the mapping; only mappings whose
+            // header sits at the base can be reused for the default layout.
+            if (reinterpret_cast<u8*>(header) == unmap.mBase) {
+                unmap = CacheMapping(unmap);
+            }
+            if (unmap.mBase != nullptr) {
+                UnmapPages(unmap.mBase, unmap.mSize);
+            }
+        }
+
+        [[nodiscard]] auto GetLargeCapacity(const FSpan* header, const void* user) noexcept
+            -> usize {
+            return static_cast<usize>(header->mMapBase + header->mMapSize
+                - static_cast<const u8*>(user));
+        }
+
+        // ---- Thread heaps ------------------------------------------------------------------
+
+        [[nodiscard]] auto CreateHeap() noexcept -> FThreadHeap* {
+            void* memory = nullptr;
+            {
+                FSpinLockGuard lock(gHeapLock);
+                if (gRetiredHeaps != nullptr) {
+                    memory        = gRetiredHeaps;
+                    gRetiredHeaps = gRetiredHeaps->mNextHeap;
+                }
+            }
+            if (memory == nullptr) {
+                memory = MapPages(AlignUp(sizeof(FThreadHeap), GetPageSize()), GetPageSize());
+                if (memory == nullptr) {
+                    return nullptr;
+                }
+            }
+
+            auto*          heap = ::new (memory) FThreadHeap();
+            FSpinLockGuard lock(gHeapLock);
+            heap->mNextHeap = gHeaps;
+            if (gHeaps != nullptr) {
+                gHeaps->mPrevHeap = heap;
+            }
+            gHeaps = heap;
+            return heap;
+        }
+
+        // Hands the heap's spans to other threads and folds its counters into the orphan stats.
+        void RetireHeap(FThreadHeap* heap) noexcept {
+            for (usize tagIndex = 0U; tagIndex < kTagCount; ++tagIndex) {
+                for (u32 classIndex = 0U; classIndex < kSmallClassCount; ++classIndex) {
+                    FSpan* span = heap->mBins[tagIndex][classIndex].mHead;
+                    while (span != nullptr) {
+                        FSpan* next = span->mNext;
+                        CollectRemoteFrees(span);
+                        if (span->mUsed == 0U) {
+                            ReleaseSpan(span);
+                        } else {
+                            span->mExhausted = false;
+                            span->mPrev      = nullptr;
+                            FSpinLockGuard lock(gAbandonedLock);
+                            span->mOwner.store(nullptr, std::memory_order_relaxed);
+                            span->mNext                      = gAbandoned[tagIndex][classIndex];
+                            gAbandoned[tagIndex][classIndex] = span;
+                        }
+                        span = next;
+                    }
+                }
+            }
+
+            FSpinLockGuard lock(gHeapLock);
+            for (usize tagIndex = 0U; tagIndex < kTagCount; ++tagIndex) {
+                FStatsSum sum{};
+                sum.Add(*heap, tagIndex);
+                RecordOrphan(static_cast<EMemoryTag>(tagIndex), sum.mBytes, sum.mAllocations,
+                    sum.mTotal);
+            }
+            if (heap->mPrevHeap != nullptr) {
+                heap->mPrevHeap->mNextHeap = heap->mNextHeap;
+            } else {
+                gHeaps = heap->mNextHeap;
+            }
+            if (heap->mNextHeap != nullptr) {
+                heap->mNextHeap->mPrevHeap = heap->mPrevHeap;
+            }
+            heap->mNextHeap = gRetiredHeaps;
+            gRetiredHeaps   = heap;
+        }
+
+        struct FThreadHeapReleaser {
+            FThreadHeapReleaser() noexcept = default;
+            ~FThreadHeapReleaser() noexcept {
+                FThreadMemoryState& state = tThreadState;
+                FThreadHeap*        heap  = state.mHeap;
+                state.mHeap               = nullptr;
+                state.mHeapReleased       = true;
+                if (heap != nullptr) {
+                    RetireHeap(heap);
+                }
+            }
+
+            FThreadHeapReleaser(const FThreadHeapReleaser&)                    = delete;
+            auto operator=(const FThreadHeapReleaser&) -> FThreadHeapReleaser& = delete;
+        };
+
+        // Returns nullptr once the thread's heap has been retired (thread-exit destructors).
+        [[nodiscard]] auto GetThreadHeap() noexcept -> FThreadHeap* {
+            FThreadMemoryState& state = tThreadState;
+            if (state.mHeap != nullptr || state.mHeapReleased) {
+                return state.mHeap;
+            }
+            // First use of the thread_local registers its destructor for this thread.
+            thread_local FThreadHeapReleaser releaser;
+            static_cast<void>(releaser);
+            state.mHeap = CreateHeap();
+            return state.mHeap;
+        }
+
+        [[nodiscard]] auto GetFallbackHeapLocked() noexcept -> FThreadHeap* {
+            if (gFallbackHeap == nullptr) {
+                gFallbackHeap = CreateHeap();
+            }
+            return gFallbackHeap;
+        }
+
+        [[nodiscard]] auto GetUsableSize(const FSpan* span) noexcept -> usize {
+            return (span->mKind == ESpanKind::Large) ? span->mUserSize : span->mBlockSize;
+        }
+    } // namespace
+
+    // Thread-caching allocator. Requests up to 32 KiB are served from per-thread size-class bins
+    // without locks; frees from other threads go to a lock-free list on the owning span. Larger
+    // requests get their own page mapping; mappings up to 4 MiB are kept in a bounded cache.
+    class FEngineMemoryAllocator final : public FMemoryAllocator {
+    public:
+        auto MemoryAllocate(usize Size, usize Alignment) -> void* override {
+            return Allocate(Size, NormalizeAlignment(Alignment), tThreadState.mTag);
+        }
+
         auto MemoryReallocate(void* Ptr, usize NewSize, usize Alignment) -> void* override {
             if (Ptr == nullptr) {
                 return MemoryAllocate(NewSize, Alignment);
@@ -61,40 +971,112 @@ namespace AltinaEngine::Core::Platform {
                 return nullptr;
             }
 
-            const usize normalizedAlignment = NormalizeAlignment(Alignment);
+            const usize  normalizedAlignment = NormalizeAlignment(Alignment);
+            FSpan* const span                = GetSpan(Ptr);
+            const bool   aligned =
+                (reinterpret_cast<usize>(Ptr) & (normalizedAlignment - 1U)) == 0U;
 
-#if AE_PLATFORM_WIN
-            return _aligned_realloc(Ptr, NewSize, normalizedAlignment);
-#else
-            if (NormalizedAlignment <= alignof(std::max_align_t)) {
-                return std::realloc(Ptr, NewSize);
+            if (aligned) {
+                if (span->mKind == ESpanKind::Large) {
+                    const usize capacity = GetLargeCapacity(span, Ptr);
+                    if (NewSize <= capacity && NewSize > kMaxSmallSize
+                        && NewSize >= capacity / 2U) {
+                        span->mUserSize = NewSize;
+                        return Ptr;
+                    }
+                } else if (NewSize <= span->mBlockSize
+                    && (NewSize >= span->mBlockSize / 2U
+                        || FindSmallClass(NewSize, normalizedAlignment) == span->mClassIndex)) {
+                    return Ptr;
+                }
             }
 
-            void*     Result = nullptr;
-            const int Error  = posix_memalign(&Result, NormalizedAlignment, NewSize);
+            void* result = Allocate(NewSize, normalizedAlignment, span->mTag);
+            if (result != nullptr) {
+                std::memcpy(result, Ptr, std::min(GetUsableSize(span), NewSize));
+                MemoryFree(Ptr);
+            }
+            return result;
+        }
 
-            if (Error != 0) {
-                return nullptr;
+        void MemoryFree(void* Ptr) override {
+            if (Ptr == nullptr) {
+                return;
             }
 
-            // Without size information we cannot preserve the previous contents.
-            std::free(Ptr);
-            return Result;
-#endif
+            FSpan* const span = GetSpan(Ptr);
+            FThreadHeap* heap = tThreadState.mHeap;
+            if (span->mKind == ESpanKind::Large) {
+                RecordLarge(heap, span->mTag, -static_cast<i64>(span->mMapSize), -1);
+                FreeLarge(span);
+                return;
+            }
+
+            RecordSmallFree(heap, span);
+            if (heap != nullptr && span->mOwner.load(std::memory_order_relaxed) == heap) {
+                FreeSmallLocal(*heap, span, Ptr);
+            } else {
+                PushRemoteFree(span, Ptr);
+            }
         }
 
-        void MemoryFree(void* Ptr) override {
-#if AE_PLATFORM_WIN
-            _aligned_free(Ptr);
-#else
-            std::free(Ptr);
-#endif
+    private:
+        static auto Allocate(usize size, usize alignment, EMemoryTag tag) -> void* {
+            if (size == 0U) {
+                return nullptr;
+            }
+
+            FThreadHeap* heap       = GetThreadHeap();
+            const u32    classIndex = FindSmallClass(size, alignment);
+            if (classIndex >= kSmallClassCount) {
+                void* result = AllocateLarge(size, alignment, tag);
+                if (result != nullptr) {
+                    RecordLarge(heap, tag, static_cast<i64>(GetSpan(result)->mMapSize), 1);
+                }
+                return result;
+            }
+
+            if (heap != nullptr) {
+                return AllocateSmall(*heap, tag, classIndex);
+            }
+
+            // Thread-exit destructors run after the thread's heap is gone.
+            FSpinLockGuard lock(gFallbackLock);
+            FThreadHeap*   fallback = GetFallbackHeapLocked();
+            return (fallback != nullptr) ? AllocateSmall(*fallback, tag, classIndex) : nullptr;
         }
     };
 
+    auto GetMemoryTagStats(EMemoryTag tag) noexcept -> FMemoryTagStats {
+        const usize index = TagIndex(tag);
+        FStatsSum   sum{};
+        {
+            FSpinLockGuard lock(gHeapLock);
+            sum.Add(gOrphanStats[index]);
+            for (const FThreadHeap* heap = gHeaps; heap != nullptr; heap = heap->mNextHeap) {
+                sum.Add(*heap, index);
+            }
+        }
+
+        FMemoryTagStats stats{};
+        stats.mLiveBytes        = static_cast<u64>(std::max<i64>(sum.mBytes, 0));
+        stats.mLiveAllocations  = static_cast<u64>(std::max<i64>(sum.mAllocations, 0));
+        stats.mTotalAllocations = static_cast<u64>(std::max<i64>(sum.mTotal, 0));
+        return stats;
+    }
+
     auto GetGlobalMemoryAllocator() noexcept -> FMemoryAllocator* {
-        static FDefaultMemoryAllocator gDefaultAllocator;
-        return &gDefaultAllocator;
+        static FEngineMemoryAllocator gEngineAllocator;
+        return &gEngineAllocator;
+    }
+#endif
+
+    auto GetCurrentMemoryTag() noexcept -> EMemoryTag { return tThreadState.mTag; }
+
+    auto SetCurrentMemoryTag(EMemoryTag tag) noexcept -> EMemoryTag {
+        const EMemoryTag previous = tThreadState.mTag;
+        tThreadState.mTag         = tag;
+        return previous;
     }
 
 } // namespace AltinaEngine::Core::Platform
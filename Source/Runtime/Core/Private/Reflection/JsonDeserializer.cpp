@@ -3,97 +3,123 @@
 #include "Platform/Generic/GenericPlatformDecl.h"
 
 namespace AltinaEngine::Core::Reflection {
+    using Json::EJsonToken;
+
     namespace {
         auto ToChar(TChar c) -> char { return (c <= 0x7f) ? static_cast<char>(c) : '?'; }
+
+        auto IsContainerStart(EJsonToken token) noexcept -> bool {
+            return token == EJsonToken::BeginObject || token == EJsonToken::BeginArray;
+        }
     } // namespace
 
     auto FJsonDeserializer::SetText(FNativeStringView text) -> bool {
         mError.Clear();
-        mDocument.Clear();
-        mRoot              = nullptr;
+        mText              = FNativeString(text);
+        mRootReader        = Json::FJsonPullReader();
+        mRootArrayReader   = Json::FJsonPullReader();
+        mHasRoot           = false;
+        mRootIsArray       = false;
+        mRootArrayEnded    = false;
         mRootConsumed      = false;
         mForceUseRootValue = false;
         mImplicitRootArray = false;
-        mRootArrayIndex    = 0;
         mStack.Clear();
+        mEscapedKeys.Reset();
 
-        if (!mDocument.Parse(text)) {
-            mError = FNativeString(mDocument.GetError());
+        // Reads never see malformed text: the whole input is checked once here.
+        Json::FJsonPullReader validator(mText.ToView());
+        if (!validator.SkipValue() || validator.Next() != EJsonToken::End) {
+            mError = FNativeString(validator.GetError());
             return false;
         }
 
-        mRoot = mDocument.GetRoot();
-        if (mRoot == nullptr) {
-            mError = "Json: empty root";
-            return false;
-        }
+        mRootReader      = Json::FJsonPullReader(mText.ToView());
+        mRootArrayReader = mRootReader;
+        mRootIsArray     = mRootArrayReader.Next() == EJsonToken::BeginArray;
+        mHasRoot         = true;
         return true;
     }
 
     auto FJsonDeserializer::ReadBool() -> bool {
-        const auto* value = NextValue();
+        const auto* value = NextScalar();
         if (value == nullptr) {
             return false;
         }
-        if (value->Type == Json::EJsonType::Bool) {
-            return value->Bool;
+        if (value->GetToken() == EJsonToken::Bool) {
+            return value->GetBool();
         }
-        if (value->Type == Json::EJsonType::Number) {
-            return value->Number != 0.0;
+        if (value->GetToken() == EJsonToken::Number) {
+            return value->GetNumber() != 0.0;
         }
         return false;
     }
 
-    void FJsonDeserializer::BeginObject() {
-        mForceUseRootValue = true;
-        const auto* value  = NextValue();
-        mForceUseRootValue = false;
-        if (value == nullptr || value->Type != Json::EJsonType::Object) {
-            return;
-        }
-        mStack.PushBack({ EScopeType::Object, value, 0U, nullptr });
-    }
+    void FJsonDeserializer::BeginObject() { (void)BeginScope(EScopeType::Object); }
 
-    void FJsonDeserializer::EndObject() {
-        if (!mStack.IsEmpty()) {
-            mStack.PopBack();
-        }
-    }
+    void FJsonDeserializer::EndObject() { EndScope(); }
 
     void FJsonDeserializer::BeginArray(usize& outSize) {
-        outSize            = 0;
-        mForceUseRootValue = true;
-        const auto* value  = NextValue();
-        mForceUseRootValue = false;
-        if (value == nullptr || value->Type != Json::EJsonType::Array) {
+        outSize = 0;
+        if (!BeginScope(EScopeType::Array)) {
             return;
         }
-        outSize = value->Array.Size();
-        mStack.PushBack({ EScopeType::Array, value, 0U, nullptr });
-    }
-
-    void FJsonDeserializer::EndArray() {
-        if (!mStack.IsEmpty()) {
-            mStack.PopBack();
+        // Count on a copy of the cursor; skipped elements are validated, not converted.
+        Json::FJsonPullReader counter = mStack.Back().Reader;
+        while (true) {
+            const EJsonToken token = counter.Next();
+            if (token == EJsonToken::EndArray || token == EJsonToken::Error) {
+                break;
+            }
+            ++outSize;
+            (void)counter.SkipValue();
         }
     }
 
+    void FJsonDeserializer::EndArray() { EndScope(); }
+
     auto FJsonDeserializer::TryReadFieldName(FStringView expectedName) -> bool {
         if (mStack.IsEmpty()) {
             return false;
         }
         auto& scope = mStack.Back();
-        if (scope.Type != EScopeType::Object || scope.Value == nullptr) {
+        if (scope.Type != EScopeType::Object) {
             return false;
         }
 
-        const auto  key   = ToNativeString(expectedName);
-        const auto* value = Json::FindObjectValue(*scope.Value, key.CStr());
-        if (value == nullptr) {
-            return false;
+        const auto key = ToNativeString(expectedName);
+        if (const auto* offset = scope.Fields.Find(key.ToView())) {
+            (void)scope.Pending.SeekValue(scope.Search, *offset, scope.MemberDepth);
+            scope.HasPending = true;
+            return true;
         }
-        scope.Pending = value;
-        return true;
+
+        // Misses only resume the key scan, which every lookup in this object shares.
+        while (!scope.Scanned) {
+            if (scope.Search.Next() != EJsonToken::Key) {
+                scope.Scanned = true;
+                break;
+            }
+            // An escaped key is decoded into the scan cursor's scratch, which reading the
+            // value reuses, so it is stored first.
+            FNativeStringView name;
+            const bool        bStored = StoreKey(scope.Search.GetString(), name);
+            const bool        bMatch  = scope.Search.GetString() == key.ToView();
+            (void)scope.Search.Next();
+            usize offset = scope.Search.GetTokenOffset();
+            if (bStored) {
+                // With duplicate keys the first occurrence wins.
+                offset = scope.Fields.TryEmplace(name, offset).first->second;
+            }
+            if (bMatch) {
+                (void)scope.Pending.SeekValue(scope.Search, offset, scope.MemberDepth);
+                scope.HasPending = true;
+                (void)scope.Search.SkipValue();
+                return true;
+            }
+            (void)scope.Search.SkipValue();
+        }
+        return false;
     }
 
     void FJsonDeserializer::ReadBytes(void* data, usize size) {
@@ -101,37 +127,43 @@ namespace AltinaEngine::Core::Reflection {
             return;
         }
 
-        const auto* value = NextValue();
-        if (value == nullptr || value->Type != Json::EJsonType::String) {
+        const auto* value = NextScalar();
+        if (value == nullptr || value->GetToken() != EJsonToken::String) {
             Platform::Generic::Memset(data, 0, size);
             return;
         }
 
-        const usize copySize = (value->String.Length() < size) ? value->String.Length() : size;
-        Platform::Generic::Memcpy(data, value->String.GetData(), copySize);
+        const FNativeStringView text     = value->GetString();
+        const usize             copySize = (text.Length() < size) ? text.Length() : size;
+        Platform::Generic::Memcpy(data, text.Data(), copySize);
         if (copySize < size) {
             Platform::Generic::Memset(static_cast<u8*>(data) + copySize, 0, size - copySize);
         }
     }
 
-    const Json::FJsonValue* FJsonDeserializer::NextValue() {
+    auto FJsonDeserializer::NextValue(bool& outAttached) -> Json::FJsonPullReader* {
+        outAttached = false;
         if (mStack.IsEmpty()) {
-            if (mForceUseRootValue) {
-                mRootConsumed = true;
-                return mRoot;
+            if (!mHasRoot) {
+                return nullptr;
             }
 
-            if (mRoot == nullptr) {
-                return nullptr;
+            if (mForceUseRootValue) {
+                mRootConsumed = true;
+                mDetached     = mRootReader;
+                (void)mDetached.Next();
+                return &mDetached;
             }
 
-            if (mImplicitRootArray || (mRoot->Type == Json::EJsonType::Array && !mRootConsumed)) {
+            if (mImplicitRootArray || (mRootIsArray && !mRootConsumed)) {
                 mImplicitRootArray = true;
-                if (mRootArrayIndex < mRoot->Array.Size()) {
-                    mRootConsumed = true;
-                    return mRoot->Array[mRootArrayIndex++];
+                if (mRootArrayEnded || mRootArrayReader.Next() == EJsonToken::EndArray) {
+                    mRootArrayEnded = true;
+                    return nullptr;
                 }
-                return nullptr;
+                mRootConsumed = true;
+                outAttached   = true;
+                return &mRootArrayReader;
             }
 
             if (mRootConsumed) {
@@ -139,27 +171,116 @@ namespace AltinaEngine::Core::Reflection {
             }
 
             mRootConsumed = true;
-            return mRoot;
+            mDetached     = mRootReader;
+            (void)mDetached.Next();
+            return &mDetached;
         }
 
         auto& scope = mStack.Back();
-        if (scope.Pending != nullptr) {
-            const auto* value = scope.Pending;
-            scope.Pending     = nullptr;
-            return value;
+        if (scope.HasPending) {
+            scope.HasPending = false;
+            return &scope.Pending;
         }
 
+        if (scope.Ended) {
+            return nullptr;
+        }
         if (scope.Type == EScopeType::Array) {
-            if (scope.Value == nullptr || scope.Index >= scope.Value->Array.Size()) {
-                return nullptr;
+            if (scope.Reader.Next() != EJsonToken::EndArray) {
+                outAttached = true;
+                return &scope.Reader;
             }
-            return scope.Value->Array[scope.Index++];
+        } else if (scope.Reader.Next() == EJsonToken::Key) {
+            // Positional reads within an object ignore the keys.
+            (void)scope.Reader.Next();
+            outAttached = true;
+            return &scope.Reader;
         }
+        scope.Ended = true;
+        return nullptr;
+    }
 
-        if (scope.Value == nullptr || scope.Index >= scope.Value->Object.Size()) {
-            return nullptr;
+    auto FJsonDeserializer::NextScalar() -> Json::FJsonPullReader* {
+        bool  attached = false;
+        auto* value    = NextValue(attached);
+        if (value == nullptr || !IsContainerStart(value->GetToken())) {
+            return value;
+        }
+        // A container where a scalar was expected reads as zero and is stepped over.
+        if (attached) {
+            (void)value->SkipValue();
+        }
+        return nullptr;
+    }
+
+    auto FJsonDeserializer::BeginScope(EScopeType type) -> bool {
+        mForceUseRootValue = true;
+        bool  attached     = false;
+        auto* value        = NextValue(attached);
+        mForceUseRootValue = false;
+        if (value == nullptr) {
+            return false;
+        }
+
+        const EJsonToken expected =
+            (type == EScopeType::Object) ? EJsonToken::BeginObject : EJsonToken::BeginArray;
+        if (value->GetToken() != expected) {
+            if (attached && IsContainerStart(value->GetToken())) {
+                (void)value->SkipValue();
+            }
+            return false;
         }
-        return scope.Value->Object[scope.Index++].Value;
+
+        // `value` may live in mStack, so it is moved out before the stack grows.
+        FScope scope;
+        scope.Type      = type;
+        scope.WriteBack = attached;
+        scope.Reader    = Move(*value);
+        if (type == EScopeType::Object) {
+            scope.Search      = scope.Reader;
+            scope.MemberDepth = scope.Reader.GetDepth();
+        }
+        mStack.PushBack(Move(scope));
+        return true;
+    }
+
+    void FJsonDeserializer::EndScope() {
+        if (mStack.IsEmpty()) {
+            return;
+        }
+        auto& scope = mStack.Back();
+        if (!scope.WriteBack) {
+            mStack.PopBack();
+            return;
+        }
+
+        // Hand the cursor back to the enclosing container, positioned after this one.
+        if (!scope.Ended) {
+            (void)scope.Reader.SkipToContainerEnd();
+        }
+        Json::FJsonPullReader reader = Move(scope.Reader);
+        mStack.PopBack();
+        if (mStack.IsEmpty()) {
+            mRootArrayReader = Move(reader);
+        } else {
+            mStack.Back().Reader = Move(reader);
+        }
+    }
+
+    auto FJsonDeserializer::StoreKey(FNativeStringView key, FNativeStringView& outKey) -> bool {
+        // Unescaped keys are views into mText already; only decoded ones need a stable copy.
+        const char* text = mText.GetData();
+        if (key.IsEmpty() || (key.Data() >= text && key.Data() < text + mText.Length())) {
+            outKey = key;
+            return true;
+        }
+        auto* copy = static_cast<char*>(mEscapedKeys.Allocate(key.Length(), alignof(char)));
+        if (copy == nullptr) {
+            return false;
+        }
+        Platform::Generic::Memcpy(copy, key.Data(), key.Length());
+        outKey = FNativeStringView(copy, key.Length());
+        return true;
     }
 
     auto FJsonDeserializer::ToNativeString(FStringView text) -> FNativeString {
@@ -175,15 +296,15 @@ namespace AltinaEngine::Core::Reflection {
     }
 
     template <typename T> T FJsonDeserializer::ReadNumber() {
-        const auto* value = NextValue();
+        const auto* value = NextScalar();
         if (value == nullptr) {
             return static_cast<T>(0);
         }
-        if (value->Type == Json::EJsonType::Number) {
-            return static_cast<T>(value->Number);
+        if (value->GetToken() == EJsonToken::Number) {
+            return static_cast<T>(value->GetNumber());
         }
-        if (value->Type == Json::EJsonType::Bool) {
-            return static_cast<T>(value->Bool ? 1 : 0);
+        if (value->GetToken() == EJsonToken::Bool) {
+            return static_cast<T>(value->GetBool() ? 1 : 0);
         }
         return static_cast<T>(0);
     }
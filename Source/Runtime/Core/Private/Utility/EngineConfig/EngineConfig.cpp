@@ -563,7 +563,7 @@ namespace AltinaEngine::Core::Utility::EngineConfig {
         }
         if (value->Type == EJsonType::String) {
             i64 out = 0;
-            if (ParseInt64Override(value->String.ToView(), out)) {
+            if (ParseInt64Override(value->String, out)) {
                 return out;
             }
         }
@@ -617,7 +617,7 @@ namespace AltinaEngine::Core::Utility::EngineConfig {
         }
         if (value->Type == EJsonType::String) {
             f64 out = 0.0;
-            if (ParseFloat64Override(value->String.ToView(), out)) {
+            if (ParseFloat64Override(value->String, out)) {
                 return out;
             }
         }
@@ -678,7 +678,7 @@ namespace AltinaEngine::Core::Utility::EngineConfig {
         }
         if (value->Type == EJsonType::String) {
             u64 out = 0;
-            if (ParseUint64Override(value->String.ToView(), out)) {
+            if (ParseUint64Override(value->String, out)) {
                 return out;
             }
         }
@@ -1,384 +1,634 @@
 #include "Utility/Json.h"
 
 #include "Algorithm/CStringUtils.h"
+#include "Container/HashUtility.h"
 #include "Types/Traits.h"
 
-#include <cctype>
+#include <bit>
 #include <cstdlib>
 #include <cstring>
+#include <new>
 
 using AltinaEngine::Move;
 namespace AltinaEngine::Core::Utility::Json {
     namespace {
-        class FJsonReader {
-        public:
-            FJsonReader(FNativeStringView text, TVector<FJsonValue*>& owned, FNativeString& error)
-                : mText(text), mOwned(owned), mError(error) {}
-
-            auto Parse(FJsonValue& out) -> bool {
-                ResetValue(out);
-                SkipWhitespace();
-                if (!ParseValue(out)) {
-                    return false;
-                }
-                SkipWhitespace();
-                if (!IsEnd()) {
-                    SetError("Trailing characters after JSON.");
-                    return false;
-                }
-                return true;
-            }
+        // Objects with at least this many members get a hashed key index.
+        constexpr usize kIndexedObjectMinSize = 16U;
+
+        // The text copy and the values of registry-shaped documents take about six bytes of
+        // arena per byte of text, so most documents fit in their first chunk.
+        constexpr usize kMinArenaChunkSize     = 4U * 1024U;
+        constexpr usize kArenaBytesPerTextByte = 8U;
+
+        [[nodiscard]] constexpr auto ArenaChunkSizeFor(usize length) noexcept -> usize {
+            const usize estimate = (length <= ~static_cast<usize>(0) / kArenaBytesPerTextByte)
+                ? length * kArenaBytesPerTextByte
+                : length;
+            return (estimate > kMinArenaChunkSize) ? estimate : kMinArenaChunkSize;
+        }
 
-        private:
-            static void ResetValue(FJsonValue& value) {
-                value.Type   = EJsonType::Null;
-                value.Number = 0.0;
-                value.Bool   = false;
-                value.String.Clear();
-                value.Array.Clear();
-                value.Object.Clear();
-            }
+        // Longest decimal mantissa that always fits in a u64, and the powers of ten that are
+        // exact in a double. Within both limits mantissa * 10^e rounds exactly once.
+        constexpr u32    kMaxFastDigits    = 19U;
+        constexpr u64    kMaxExactMantissa = 1ULL << 53U;
+        constexpr i32    kMaxExactPow10    = 22;
+        constexpr double kPow10[]          = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+            1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
 
-            [[nodiscard]] auto IsEnd() const noexcept -> bool { return mIndex >= mText.Length(); }
+        constexpr u64 kLowBytes  = 0x0101010101010101ULL;
+        constexpr u64 kHighBytes = 0x8080808080808080ULL;
 
-            [[nodiscard]] auto Peek() const noexcept -> char {
-                return IsEnd() ? '\0' : mText.Data()[mIndex];
-            }
+        [[nodiscard]] constexpr auto HasZeroByte(u64 word) noexcept -> bool {
+            return ((word - kLowBytes) & ~word & kHighBytes) != 0ULL;
+        }
 
-            auto Get() noexcept -> char {
-                if (IsEnd()) {
-                    return '\0';
-                }
-                return mText.Data()[mIndex++];
-            }
+        [[nodiscard]] constexpr auto IsDigit(char ch) noexcept -> bool {
+            return ch >= '0' && ch <= '9';
+        }
 
-            void SkipWhitespace() noexcept {
-                while (!IsEnd()) {
-                    const char ch = Peek();
-                    if (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r') {
-                        ++mIndex;
-                        continue;
-                    }
+        // Index of the first '"' or '\\' at or after `index`, or `length` when there is none.
+        auto FindStringSpecial(const char* text, usize index, usize length) noexcept -> usize {
+            while (index + sizeof(u64) <= length) {
+                u64 word = 0ULL;
+                std::memcpy(&word, text + index, sizeof(u64));
+                if (HasZeroByte(word ^ (kLowBytes * '"'))
+                    || HasZeroByte(word ^ (kLowBytes * '\\'))) {
                     break;
                 }
+                index += sizeof(u64);
+            }
+            while (index < length && text[index] != '"' && text[index] != '\\') {
+                ++index;
             }
+            return index;
+        }
 
-            void SetError(const char* message) {
-                if (!mError.IsEmptyString()) {
-                    return;
-                }
-                if (message != nullptr) {
-                    mError.Append(message);
-                }
+        auto EncodeUtf8(u32 codepoint, char* out) noexcept -> usize {
+            if (codepoint <= 0x7FU) {
+                out[0] = static_cast<char>(codepoint);
+                return 1U;
+            }
+            if (codepoint <= 0x7FFU) {
+                out[0] = static_cast<char>(0xC0U | (codepoint >> 6U));
+                out[1] = static_cast<char>(0x80U | (codepoint & 0x3FU));
+                return 2U;
+            }
+            if (codepoint <= 0xFFFFU) {
+                out[0] = static_cast<char>(0xE0U | (codepoint >> 12U));
+                out[1] = static_cast<char>(0x80U | ((codepoint >> 6U) & 0x3FU));
+                out[2] = static_cast<char>(0x80U | (codepoint & 0x3FU));
+                return 3U;
             }
+            out[0] = static_cast<char>(0xF0U | (codepoint >> 18U));
+            out[1] = static_cast<char>(0x80U | ((codepoint >> 12U) & 0x3FU));
+            out[2] = static_cast<char>(0x80U | ((codepoint >> 6U) & 0x3FU));
+            out[3] = static_cast<char>(0x80U | (codepoint & 0x3FU));
+            return 4U;
+        }
 
-            [[nodiscard]] auto ParseValue(FJsonValue& out) -> bool {
-                SkipWhitespace();
-                const char ch = Peek();
-                if (ch == '{') {
-                    return ParseObject(out);
-                }
-                if (ch == '[') {
-                    return ParseArray(out);
-                }
-                if (ch == '"') {
-                    out.Type = EJsonType::String;
-                    return ParseString(out.String);
-                }
-                if ((ch == '-') || (ch >= '0' && ch <= '9')) {
-                    out.Type = EJsonType::Number;
-                    return ParseNumber(out.Number);
-                }
-                if (MatchLiteral("true")) {
-                    out.Type = EJsonType::Bool;
-                    out.Bool = true;
-                    return true;
+        auto KeysEqual(FNativeStringView lhs, FNativeStringView rhs) noexcept -> bool {
+            return lhs.Length() == rhs.Length()
+                && (lhs.Length() == 0U
+                    || std::memcmp(lhs.Data(), rhs.Data(), lhs.Length()) == 0);
+        }
+
+        auto HashKey(FNativeStringView key) noexcept -> u32 {
+            return static_cast<u32>(Container::Detail::HashBytes(key.Data(), key.Length()));
+        }
+    } // namespace
+
+    FJsonPullReader::FJsonPullReader(FNativeStringView text) noexcept
+        : mText(text.Data()), mLength(text.Length()) {}
+
+    FJsonPullReader::FJsonPullReader(char* text, usize length) noexcept
+        : mText(text), mInSitu(text), mLength(length) {}
+
+    FJsonPullReader::FJsonPullReader(const FJsonPullReader& other) { *this = other; }
+
+    FJsonPullReader::FJsonPullReader(FJsonPullReader&& other) noexcept { *this = Move(other); }
+
+    auto FJsonPullReader::operator=(const FJsonPullReader& other) -> FJsonPullReader& {
+        if (this != &other) {
+            CopyCursor(other);
+            mScratch = other.mScratch;
+            RebaseString(other.mScratch.GetData(), other.mScratch.Length());
+        }
+        return *this;
+    }
+
+    auto FJsonPullReader::operator=(FJsonPullReader&& other) noexcept -> FJsonPullReader& {
+        if (this != &other) {
+            // Short scratch strings live inline, so moving can relocate the bytes too.
+            const char* scratch       = other.mScratch.GetData();
+            const usize scratchLength = other.mScratch.Length();
+            CopyCursor(other);
+            mScratch = Move(other.mScratch);
+            RebaseString(scratch, scratchLength);
+        }
+        return *this;
+    }
+
+    void FJsonPullReader::CopyCursor(const FJsonPullReader& other) noexcept {
+        mText       = other.mText;
+        mInSitu     = other.mInSitu;
+        mLength     = other.mLength;
+        mIndex      = other.mIndex;
+        mTokenStart = other.mTokenStart;
+        mString     = other.mString;
+        mNumber     = other.mNumber;
+        mError      = other.mError;
+        std::memcpy(mObjectBits, other.mObjectBits, sizeof(mObjectBits));
+        mDepth    = other.mDepth;
+        mToken    = other.mToken;
+        mState    = other.mState;
+        mBool     = other.mBool;
+        mSkipping = other.mSkipping;
+    }
+
+    void FJsonPullReader::RebaseString(const char* scratch, usize scratchLength) noexcept {
+        // A decoded escaped string points into the source's scratch; point it at ours instead.
+        const auto address = reinterpret_cast<usize>(mString.Data());
+        const auto base    = reinterpret_cast<usize>(scratch);
+        if (scratchLength == 0U || address < base || address >= base + scratchLength) {
+            return;
+        }
+        mString = FNativeStringView(mScratch.GetData() + (address - base), mString.Length());
+    }
+
+    auto FJsonPullReader::Next() -> EJsonToken {
+        if (mToken == EJsonToken::Error) {
+            return mToken;
+        }
+        SkipWhitespace();
+        mTokenStart   = mIndex;
+        const char ch = (mIndex < mLength) ? mText[mIndex] : '\0';
+        switch (mState) {
+            case EState::Value:
+                return ReadValue();
+            case EState::ValueOrEndArray:
+                if (ch == ']') {
+                    ++mIndex;
+                    return CloseContainer(EJsonToken::EndArray);
+                }
+                return ReadValue();
+            case EState::KeyOrEndObject:
+                if (ch == '}') {
+                    ++mIndex;
+                    return CloseContainer(EJsonToken::EndObject);
+                }
+                return ReadKey();
+            case EState::AfterValue:
+            {
+                const bool bObject = IsInObject();
+                if (ch == ',') {
+                    ++mIndex;
+                    SkipWhitespace();
+                    mTokenStart = mIndex;
+                    return bObject ? ReadKey() : ReadValue();
                 }
-                if (MatchLiteral("false")) {
-                    out.Type = EJsonType::Bool;
-                    out.Bool = false;
-                    return true;
+                if (bObject && ch == '}') {
+                    ++mIndex;
+                    return CloseContainer(EJsonToken::EndObject);
                 }
-                if (MatchLiteral("null")) {
-                    out.Type = EJsonType::Null;
-                    return true;
+                if (!bObject && ch == ']') {
+                    ++mIndex;
+                    return CloseContainer(EJsonToken::EndArray);
                 }
-
-                SetError("Invalid JSON token.");
-                return false;
+                return Fail(bObject ? "Expected ',' or '}' in object."
+                                    : "Expected ',' or ']' in array.");
             }
-
-            auto ParseObject(FJsonValue& out) -> bool {
-                if (Get() != '{') {
-                    SetError("Expected '{'.");
-                    return false;
+            case EState::Done:
+            default:
+                if (mIndex < mLength) {
+                    return Fail("Trailing characters after JSON.");
                 }
+                mToken = EJsonToken::End;
+                return mToken;
+        }
+    }
 
-                out.Type = EJsonType::Object;
-                SkipWhitespace();
-                if (Peek() == '}') {
-                    Get();
-                    return true;
-                }
+    auto FJsonPullReader::SkipValue() -> bool {
+        EJsonToken token = mToken;
+        if (token == EJsonToken::None || token == EJsonToken::Key) {
+            mSkipping = true;
+            token      = Next();
+            mSkipping = false;
+        }
+        if (token == EJsonToken::BeginObject || token == EJsonToken::BeginArray) {
+            return SkipToContainerEnd();
+        }
+        return token != EJsonToken::Error;
+    }
 
-                while (true) {
-                    FJsonPair pair;
-                    if (!ParseString(pair.Key)) {
-                        return false;
-                    }
+    auto FJsonPullReader::SkipToContainerEnd() -> bool {
+        if (mToken == EJsonToken::Error || mDepth == 0U) {
+            return mToken != EJsonToken::Error;
+        }
+        const u32 target = mDepth - 1U;
+        mSkipping       = true;
+        while (mDepth > target && Next() != EJsonToken::Error) {}
+        mSkipping = false;
+        return mToken != EJsonToken::Error;
+    }
 
-                    SkipWhitespace();
-                    if (Get() != ':') {
-                        SetError("Expected ':' after object key.");
-                        return false;
-                    }
+    auto FJsonPullReader::SeekValue(const FJsonPullReader& other, usize offset, u32 depth)
+        -> EJsonToken {
+        // The container bits below `depth` are shared with `other`; the scratch is not needed
+        // since the token is read again.
+        CopyCursor(other);
+        mIndex    = offset;
+        mDepth    = depth;
+        mState    = EState::Value;
+        mToken    = EJsonToken::None;
+        mError    = nullptr;
+        mSkipping = false;
+        mString   = {};
+        return Next();
+    }
 
-                    FJsonValue* value = CreateValue();
-                    if (!ParseValue(*value)) {
-                        return false;
-                    }
-                    pair.Value = value;
-                    out.Object.PushBack(Move(pair));
+    auto FJsonPullReader::GetError() const noexcept -> FNativeStringView {
+        return (mError != nullptr) ? FNativeStringView(mError) : FNativeStringView();
+    }
 
-                    SkipWhitespace();
-                    if (Peek() == ',') {
-                        Get();
-                        SkipWhitespace();
-                        continue;
-                    }
-                    if (Peek() == '}') {
-                        Get();
-                        return true;
-                    }
+    auto FJsonPullReader::ReadValue() -> EJsonToken {
+        const char ch = (mIndex < mLength) ? mText[mIndex] : '\0';
+        switch (ch) {
+            case '{':
+                ++mIndex;
+                return OpenContainer(true);
+            case '[':
+                ++mIndex;
+                return OpenContainer(false);
+            case '"':
+                return ReadString() ? FinishValue(EJsonToken::String) : mToken;
+            case 't':
+                if (MatchLiteral("true", 4U)) {
+                    mBool = true;
+                    return FinishValue(EJsonToken::Bool);
+                }
+                break;
+            case 'f':
+                if (MatchLiteral("false", 5U)) {
+                    mBool = false;
+                    return FinishValue(EJsonToken::Bool);
+                }
+                break;
+            case 'n':
+                if (MatchLiteral("null", 4U)) {
+                    return FinishValue(EJsonToken::Null);
+                }
+                break;
+            default:
+                if (ch == '-' || IsDigit(ch)) {
+                    return ReadNumber() ? FinishValue(EJsonToken::Number) : mToken;
+                }
+                break;
+        }
+        return Fail("Invalid JSON token.");
+    }
 
-                    SetError("Expected ',' or '}' in object.");
-                    return false;
-                }
-            }
+    auto FJsonPullReader::ReadKey() -> EJsonToken {
+        if (mIndex >= mLength || mText[mIndex] != '"') {
+            return Fail("Expected '\"' to begin string.");
+        }
+        if (!ReadString()) {
+            return mToken;
+        }
+        SkipWhitespace();
+        if (mIndex >= mLength || mText[mIndex] != ':') {
+            return Fail("Expected ':' after object key.");
+        }
+        ++mIndex;
+        mState = EState::Value;
+        mToken = EJsonToken::Key;
+        return mToken;
+    }
 
-            auto ParseArray(FJsonValue& out) -> bool {
-                if (Get() != '[') {
-                    SetError("Expected '['.");
-                    return false;
-                }
+    auto FJsonPullReader::ReadString() -> bool {
+        const usize start = mIndex + 1U;
+        const usize end   = FindStringSpecial(mText, start, mLength);
+        if (end >= mLength) {
+            Fail("Unterminated string.");
+            return false;
+        }
+        if (mText[end] == '\\') {
+            return ReadEscapedString(start, end);
+        }
+        mString = FNativeStringView(mText + start, end - start);
+        mIndex  = end + 1U;
+        return true;
+    }
 
-                out.Type = EJsonType::Array;
-                SkipWhitespace();
-                if (Peek() == ']') {
-                    Get();
-                    return true;
+    auto FJsonPullReader::ReadEscapedString(usize start, usize escape) -> bool {
+        // In place, the decoded text never outgrows the escapes it replaces, so the write
+        // cursor always trails the read cursor.
+        usize write = escape;
+        if (!mSkipping && mInSitu == nullptr) {
+            mScratch.Clear();
+            mScratch.Append(mText + start, escape - start);
+        }
+
+        usize index = escape;
+        while (index < mLength) {
+            const char ch = mText[index];
+            if (ch == '"') {
+                if (mSkipping) {
+                    mString = {};
+                } else if (mInSitu != nullptr) {
+                    mString = FNativeStringView(mInSitu + start, write - start);
+                } else {
+                    mString = FNativeStringView(mScratch.GetData(), mScratch.Length());
                 }
+                mIndex = index + 1U;
+                return true;
+            }
+            if (ch != '\\') {
+                const usize end = FindStringSpecial(mText, index, mLength);
+                Emit(mText + index, end - index, write);
+                index = end;
+                continue;
+            }
 
-                while (true) {
-                    FJsonValue* value = CreateValue();
-                    if (!ParseValue(*value)) {
+            ++index;
+            const char esc     = (index < mLength) ? mText[index++] : '\0';
+            char       out[4]  = {};
+            usize      outSize = 1U;
+            switch (esc) {
+                case '"':
+                case '\\':
+                case '/':
+                    out[0] = esc;
+                    break;
+                case 'b':
+                    out[0] = '\b';
+                    break;
+                case 'f':
+                    out[0] = '\f';
+                    break;
+                case 'n':
+                    out[0] = '\n';
+                    break;
+                case 'r':
+                    out[0] = '\r';
+                    break;
+                case 't':
+                    out[0] = '\t';
+                    break;
+                case 'u':
+                {
+                    u32 codepoint = 0U;
+                    if (!ReadUnicodeEscape(index, codepoint)) {
                         return false;
                     }
-                    out.Array.PushBack(value);
-
-                    SkipWhitespace();
-                    if (Peek() == ',') {
-                        Get();
-                        SkipWhitespace();
-                        continue;
+                    if (codepoint >= 0xD800U && codepoint <= 0xDBFFU && index + 1U < mLength
+                        && mText[index] == '\\' && mText[index + 1U] == 'u') {
+                        usize next = index + 2U;
+                        u32   low  = 0U;
+                        if (!ReadUnicodeEscape(next, low)) {
+                            return false;
+                        }
+                        if (low >= 0xDC00U && low <= 0xDFFFU) {
+                            codepoint = 0x10000U + ((codepoint - 0xD800U) << 10U)
+                                + (low - 0xDC00U);
+                            index = next;
+                        }
                     }
-                    if (Peek() == ']') {
-                        Get();
-                        return true;
+                    // Unpaired surrogates have no UTF-8 encoding.
+                    if (codepoint >= 0xD800U && codepoint <= 0xDFFFU) {
+                        codepoint = '?';
                     }
-
-                    SetError("Expected ',' or ']' in array.");
-                    return false;
+                    outSize = EncodeUtf8(codepoint, out);
+                    break;
                 }
+                default:
+                    Fail("Invalid escape sequence.");
+                    return false;
             }
+            Emit(out, outSize, write);
+        }
 
-            auto ParseString(FNativeString& out) -> bool {
-                if (Get() != '"') {
-                    SetError("Expected '\"' to begin string.");
-                    return false;
-                }
+        Fail("Unterminated string.");
+        return false;
+    }
 
-                out.Clear();
-                while (!IsEnd()) {
-                    const char ch = Get();
-                    if (ch == '"') {
-                        return true;
-                    }
+    auto FJsonPullReader::ReadUnicodeEscape(usize& index, u32& codepoint) -> bool {
+        codepoint = 0U;
+        for (u32 digit = 0U; digit < 4U; ++digit) {
+            if (index >= mLength) {
+                Fail("Unexpected end in unicode escape.");
+                return false;
+            }
+            const char ch = mText[index++];
+            codepoint <<= 4U;
+            if (ch >= '0' && ch <= '9') {
+                codepoint |= static_cast<u32>(ch - '0');
+            } else if (ch >= 'a' && ch <= 'f') {
+                codepoint |= static_cast<u32>(10 + (ch - 'a'));
+            } else if (ch >= 'A' && ch <= 'F') {
+                codepoint |= static_cast<u32>(10 + (ch - 'A'));
+            } else {
+                Fail("Invalid unicode escape.");
+                return false;
+            }
+        }
+        return true;
+    }
 
-                    if (ch == '\\') {
-                        const char esc = Get();
-                        switch (esc) {
-                            case '"':
-                                out.Append('"');
-                                break;
-                            case '\\':
-                                out.Append('\\');
-                                break;
-                            case '/':
-                                out.Append('/');
-                                break;
-                            case 'b':
-                                out.Append('\b');
-                                break;
-                            case 'f':
-                                out.Append('\f');
-                                break;
-                            case 'n':
-                                out.Append('\n');
-                                break;
-                            case 'r':
-                                out.Append('\r');
-                                break;
-                            case 't':
-                                out.Append('\t');
-                                break;
-                            case 'u':
-                                if (!ParseUnicodeEscape(out)) {
-                                    return false;
-                                }
-                                break;
-                            default:
-                                SetError("Invalid escape sequence.");
-                                return false;
-                        }
-                        continue;
-                    }
+    void FJsonPullReader::Emit(const char* data, usize size, usize& write) {
+        if (mSkipping) {
+            return;
+        }
+        if (mInSitu != nullptr) {
+            std::memmove(mInSitu + write, data, size);
+            write += size;
+            return;
+        }
+        mScratch.Append(data, size);
+    }
 
-                    out.Append(ch);
-                }
+    auto FJsonPullReader::ReadNumber() -> bool {
+        const usize start     = mIndex;
+        usize       index     = mIndex;
+        const bool  bNegative = mText[index] == '-';
+        if (bNegative) {
+            ++index;
+        }
 
-                SetError("Unterminated string.");
-                return false;
+        // Significant digits accumulate into the mantissa; past kMaxFastDigits only strtod can
+        // round correctly, so the conversion falls back to it.
+        u64  mantissa   = 0ULL;
+        u32  digits     = 0U;
+        i32  exponent   = 0;
+        bool bHasDigits = false;
+        bool bExact     = true;
+        while (index < mLength && IsDigit(mText[index])) {
+            bHasDigits = true;
+            if (mantissa != 0ULL || mText[index] != '0') {
+                if (digits < kMaxFastDigits) {
+                    mantissa = mantissa * 10ULL + static_cast<u64>(mText[index] - '0');
+                    ++digits;
+                } else {
+                    bExact = false;
+                }
             }
-
-            auto ParseUnicodeEscape(FNativeString& out) -> bool {
-                u32 codepoint = 0;
-                for (int i = 0; i < 4; ++i) {
-                    if (IsEnd()) {
-                        SetError("Unexpected end in unicode escape.");
-                        return false;
-                    }
-                    const char ch = Get();
-                    codepoint <<= 4;
-                    if (ch >= '0' && ch <= '9') {
-                        codepoint |= static_cast<u32>(ch - '0');
-                    } else if (ch >= 'a' && ch <= 'f') {
-                        codepoint |= static_cast<u32>(10 + (ch - 'a'));
-                    } else if (ch >= 'A' && ch <= 'F') {
-                        codepoint |= static_cast<u32>(10 + (ch - 'A'));
+            ++index;
+        }
+        if (index < mLength && mText[index] == '.') {
+            ++index;
+            while (index < mLength && IsDigit(mText[index])) {
+                bHasDigits = true;
+                if (mantissa != 0ULL || mText[index] != '0') {
+                    if (digits < kMaxFastDigits) {
+                        mantissa = mantissa * 10ULL + static_cast<u64>(mText[index] - '0');
+                        ++digits;
                     } else {
-                        SetError("Invalid unicode escape.");
-                        return false;
+                        bExact = false;
                     }
                 }
+                --exponent;
+                ++index;
+            }
+        }
+        if (!bHasDigits) {
+            Fail("Invalid number.");
+            return false;
+        }
 
-                if (codepoint <= 0x7FU) {
-                    out.Append(static_cast<char>(codepoint));
-                } else {
-                    out.Append('?');
-                }
-                return true;
+        if (index < mLength && (mText[index] == 'e' || mText[index] == 'E')) {
+            ++index;
+            bool bNegativeExponent = false;
+            if (index < mLength && (mText[index] == '+' || mText[index] == '-')) {
+                bNegativeExponent = mText[index] == '-';
+                ++index;
+            }
+            i32  value        = 0;
+            bool bHasExponent = false;
+            while (index < mLength && IsDigit(mText[index])) {
+                bHasExponent = true;
+                if (value < 100000) {
+                    value = value * 10 + (mText[index] - '0');
+                }
+                ++index;
+            }
+            if (!bHasExponent) {
+                Fail("Invalid exponent.");
+                return false;
             }
+            exponent += bNegativeExponent ? -value : value;
+        }
+        mIndex = index;
+        if (mSkipping) {
+            return true;
+        }
 
-            auto ParseNumber(double& out) -> bool {
-                const usize start = mIndex;
-                if (Peek() == '-' || Peek() == '+') {
-                    Get();
-                }
+        if (mantissa == 0ULL && bExact) {
+            mNumber = bNegative ? -0.0 : 0.0;
+            return true;
+        }
+        if (bExact && mantissa <= kMaxExactMantissa && exponent >= -kMaxExactPow10
+            && exponent <= kMaxExactPow10) {
+            double value = static_cast<double>(mantissa);
+            value        = (exponent < 0) ? value / kPow10[-exponent] : value * kPow10[exponent];
+            mNumber      = bNegative ? -value : value;
+            return true;
+        }
 
-                bool hasDigits = false;
-                while (std::isdigit(static_cast<unsigned char>(Peek())) != 0) {
-                    hasDigits = true;
-                    Get();
-                }
+        const usize   length = index - start;
+        char          buffer[64];
+        FNativeString heapToken;
+        const char*   token = buffer;
+        if (length < sizeof(buffer)) {
+            std::memcpy(buffer, mText + start, length);
+            buffer[length] = '\0';
+        } else {
+            heapToken.Append(mText + start, length);
+            token = heapToken.CStr();
+        }
+        char* endPtr = nullptr;
+        mNumber      = std::strtod(token, &endPtr);
+        if (endPtr == token) {
+            Fail("Invalid number.");
+            return false;
+        }
+        return true;
+    }
 
-                if (Peek() == '.') {
-                    Get();
-                    while (std::isdigit(static_cast<unsigned char>(Peek())) != 0) {
-                        hasDigits = true;
-                        Get();
-                    }
-                }
+    auto FJsonPullReader::MatchLiteral(const char* literal, usize length) noexcept -> bool {
+        if (mIndex + length > mLength || std::memcmp(mText + mIndex, literal, length) != 0) {
+            return false;
+        }
+        mIndex += length;
+        return true;
+    }
 
-                if (!hasDigits) {
-                    SetError("Invalid number.");
-                    return false;
-                }
+    auto FJsonPullReader::FinishValue(EJsonToken token) noexcept -> EJsonToken {
+        mState = (mDepth == 0U) ? EState::Done : EState::AfterValue;
+        mToken = token;
+        return token;
+    }
 
-                if (Peek() == 'e' || Peek() == 'E') {
-                    Get();
-                    if (Peek() == '+' || Peek() == '-') {
-                        Get();
-                    }
-                    bool hasExp = false;
-                    while (std::isdigit(static_cast<unsigned char>(Peek())) != 0) {
-                        hasExp = true;
-                        Get();
-                    }
-                    if (!hasExp) {
-                        SetError("Invalid exponent.");
-                        return false;
-                    }
-                }
+    auto FJsonPullReader::OpenContainer(bool bObject) noexcept -> EJsonToken {
+        if (mDepth >= kMaxDepth) {
+            return Fail("JSON nesting is too deep.");
+        }
+        const u64 bit = 1ULL << (mDepth & 63U);
+        if (bObject) {
+            mObjectBits[mDepth >> 6U] |= bit;
+        } else {
+            mObjectBits[mDepth >> 6U] &= ~bit;
+        }
+        ++mDepth;
+        mState = bObject ? EState::KeyOrEndObject : EState::ValueOrEndArray;
+        mToken = bObject ? EJsonToken::BeginObject : EJsonToken::BeginArray;
+        return mToken;
+    }
 
-                const usize   end = mIndex;
-                FNativeString token;
-                if (end > start) {
-                    token.Append(mText.Data() + start, end - start);
-                }
-                const char* cstr   = token.CStr();
-                char*       endPtr = nullptr;
-                out                = std::strtod(cstr, &endPtr);
-                if (endPtr == cstr) {
-                    SetError("Invalid number.");
-                    return false;
-                }
-                return true;
-            }
+    auto FJsonPullReader::CloseContainer(EJsonToken token) noexcept -> EJsonToken {
+        --mDepth;
+        return FinishValue(token);
+    }
 
-            auto MatchLiteral(const char* literal) -> bool {
-                if (literal == nullptr) {
-                    return false;
-                }
-                const usize length = static_cast<usize>(std::strlen(literal));
-                if ((mIndex + length) > mText.Length()) {
-                    return false;
-                }
-                for (usize i = 0; i < length; ++i) {
-                    if (mText.Data()[mIndex + i] != literal[i]) {
-                        return false;
-                    }
-                }
-                mIndex += length;
-                return true;
-            }
+    auto FJsonPullReader::Fail(const char* message) noexcept -> EJsonToken {
+        if (mError == nullptr) {
+            mError = message;
+        }
+        mString = {};
+        mState  = EState::Done;
+        mToken  = EJsonToken::Error;
+        return mToken;
+    }
 
-            auto CreateValue() -> FJsonValue* {
-                auto* value = new FJsonValue();
-                mOwned.PushBack(value);
-                return value;
+    void FJsonPullReader::SkipWhitespace() noexcept {
+        while (mIndex < mLength) {
+            const char ch = mText[mIndex];
+            if (ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r') {
+                break;
             }
+            ++mIndex;
+        }
+    }
 
-        private:
-            FNativeStringView     mText;
-            usize                 mIndex = 0;
-            TVector<FJsonValue*>& mOwned;
-            FNativeString&        mError;
-        };
-    } // namespace
+    FJsonDocument::FJsonDocument() : mArena(kMinArenaChunkSize) {}
 
-    FJsonDocument::~FJsonDocument() { DestroyValues(); }
+    FJsonDocument::~FJsonDocument() = default;
 
     FJsonDocument::FJsonDocument(FJsonDocument&& other) noexcept
-        : mRoot(other.mRoot), mOwned(Move(other.mOwned)), mError(Move(other.mError)) {
+        : mArena(Move(other.mArena))
+        , mRoot(other.mRoot)
+        , mValueStack(Move(other.mValueStack))
+        , mKeyStack(Move(other.mKeyStack))
+        , mFrameStack(Move(other.mFrameStack))
+        , mError(Move(other.mError)) {
         other.mRoot = nullptr;
     }
 
     auto FJsonDocument::operator=(FJsonDocument&& other) noexcept -> FJsonDocument& {
         if (this != &other) {
-            DestroyValues();
+            mArena      = Move(other.mArena);
             mRoot       = other.mRoot;
-            mOwned      = Move(other.mOwned);
+            mValueStack = Move(other.mValueStack);
+            mKeyStack   = Move(other.mKeyStack);
+            mFrameStack = Move(other.mFrameStack);
             mError      = Move(other.mError);
             other.mRoot = nullptr;
         }
@@ -387,22 +637,31 @@ namespace AltinaEngine::Core::Utility::Json {
 
     auto FJsonDocument::Parse(FNativeStringView text) -> bool {
         Clear();
-
-        auto* root = new FJsonValue();
-        mOwned.PushBack(root);
-
-        FJsonReader reader(text, mOwned, mError);
-        if (!reader.Parse(*root)) {
-            DestroyValues();
+        mArena.GrowChunkSize(ArenaChunkSizeFor(text.Length()));
+        auto* copy = static_cast<char*>(mArena.Allocate(text.Length() + 1U, alignof(char)));
+        if (copy == nullptr) {
+            mError.Append("Out of memory while parsing JSON.");
             return false;
         }
+        if (!text.IsEmpty()) {
+            std::memcpy(copy, text.Data(), text.Length());
+        }
+        copy[text.Length()] = '\0';
+        return Build(copy, text.Length());
+    }
 
-        mRoot = root;
-        return true;
+    auto FJsonDocument::ParseInSitu(char* text, usize length) -> bool {
+        Clear();
+        mArena.GrowChunkSize(ArenaChunkSizeFor(length));
+        return Build(text, length);
     }
 
     void FJsonDocument::Clear() {
-        DestroyValues();
+        mArena.Reset();
+        mRoot = nullptr;
+        mValueStack.Clear();
+        mKeyStack.Clear();
+        mFrameStack.Clear();
         mError.Clear();
     }
 
@@ -410,40 +669,170 @@ namespace AltinaEngine::Core::Utility::Json {
         return { mError.GetData(), mError.Length() };
     }
 
-    void FJsonDocument::DestroyValues() {
-        for (auto* value : mOwned) {
-            delete value;
+    auto FJsonDocument::Build(char* text, usize length) -> bool {
+        FJsonPullReader reader(text, length);
+        while (true) {
+            FJsonValue value;
+            switch (reader.Next()) {
+                case EJsonToken::BeginObject:
+                case EJsonToken::BeginArray:
+                    mFrameStack.PushBack({ mValueStack.Size(), mKeyStack.Size() });
+                    continue;
+                case EJsonToken::Key:
+                    mKeyStack.PushBack(reader.GetString());
+                    continue;
+                case EJsonToken::EndObject:
+                    if (!CloseObject(value)) {
+                        return false;
+                    }
+                    break;
+                case EJsonToken::EndArray:
+                    if (!CloseArray(value)) {
+                        return false;
+                    }
+                    break;
+                case EJsonToken::String:
+                    value.Type   = EJsonType::String;
+                    value.String = reader.GetString();
+                    break;
+                case EJsonToken::Number:
+                    value.Type   = EJsonType::Number;
+                    value.Number = reader.GetNumber();
+                    break;
+                case EJsonToken::Bool:
+                    value.Type = EJsonType::Bool;
+                    value.Bool = reader.GetBool();
+                    break;
+                case EJsonToken::Null:
+                    break;
+                case EJsonToken::End:
+                {
+                    auto* root = static_cast<FJsonValue*>(
+                        mArena.Allocate(sizeof(FJsonValue), alignof(FJsonValue)));
+                    if (root == nullptr) {
+                        mError.Append("Out of memory while parsing JSON.");
+                        return false;
+                    }
+                    ::new (static_cast<void*>(root)) FJsonValue(mValueStack[0]);
+                    mValueStack.Clear();
+                    mRoot = root;
+                    return true;
+                }
+                default:
+                    mError.Append(reader.GetError().Data(), reader.GetError().Length());
+                    mValueStack.Clear();
+                    mKeyStack.Clear();
+                    mFrameStack.Clear();
+                    return false;
+            }
+            mValueStack.PushBack(value);
         }
-        mOwned.Clear();
-        mRoot = nullptr;
     }
 
-    auto FindObjectValue(const FJsonValue& object, const char* key) -> const FJsonValue* {
-        if (object.Type != EJsonType::Object) {
-            return nullptr;
+    auto FJsonDocument::CloseArray(FJsonValue& out) -> bool {
+        const usize base  = mFrameStack.Back().mValueBase;
+        const usize count = mValueStack.Size() - base;
+        mFrameStack.PopBack();
+
+        out.Type = EJsonType::Array;
+        if (count == 0U) {
+            return true;
         }
-        if (key == nullptr) {
-            return nullptr;
+        auto* elements = static_cast<FJsonValue*>(
+            mArena.Allocate(count * sizeof(FJsonValue), alignof(FJsonValue)));
+        if (elements == nullptr) {
+            mError.Append("Out of memory while parsing JSON.");
+            return false;
         }
-        for (const auto& pair : object.Object) {
-            FNativeStringView keyView(pair.Key.GetData(), pair.Key.Length());
-            if (keyView.Length() != std::strlen(key)) {
-                continue;
+        std::memcpy(static_cast<void*>(elements), &mValueStack[base], count * sizeof(FJsonValue));
+        mValueStack.Resize(base);
+        out.Array = FJsonArray(elements, count);
+        return true;
+    }
+
+    auto FJsonDocument::CloseObject(FJsonValue& out) -> bool {
+        const FBuildFrame frame = mFrameStack.Back();
+        const usize       count = mValueStack.Size() - frame.mValueBase;
+        mFrameStack.PopBack();
+
+        out.Type = EJsonType::Object;
+        if (count == 0U) {
+            return true;
+        }
+
+        // One block: the member values, then the pairs, then the index slots if any.
+        const usize slotCount  = (count >= kIndexedObjectMinSize) ? std::bit_ceil(count * 2U) : 0U;
+        const usize valueBytes = count * sizeof(FJsonValue);
+        const usize pairBytes  = count * sizeof(FJsonPair);
+        auto*       block      = static_cast<u8*>(mArena.Allocate(
+            valueBytes + pairBytes + slotCount * sizeof(u32), alignof(FJsonValue)));
+        if (block == nullptr) {
+            mError.Append("Out of memory while parsing JSON.");
+            return false;
+        }
+        auto* values = reinterpret_cast<FJsonValue*>(block);
+        auto* pairs  = reinterpret_cast<FJsonPair*>(block + valueBytes);
+        std::memcpy(static_cast<void*>(values), &mValueStack[frame.mValueBase], valueBytes);
+        for (usize index = 0U; index < count; ++index) {
+            ::new (static_cast<void*>(pairs + index))
+                FJsonPair{ mKeyStack[frame.mKeyBase + index], values + index };
+        }
+
+        u32 indexMask = 0U;
+        if (slotCount != 0U) {
+            auto* slots = reinterpret_cast<u32*>(block + valueBytes + pairBytes);
+            std::memset(slots, 0, slotCount * sizeof(u32));
+            indexMask = static_cast<u32>(slotCount - 1U);
+            for (usize index = 0U; index < count; ++index) {
+                // Lookups return the first of duplicate keys, like a scan would.
+                u32 slot = HashKey(pairs[index].Key) & indexMask;
+                while (slots[slot] != 0U
+                    && !KeysEqual(pairs[slots[slot] - 1U].Key, pairs[index].Key)) {
+                    slot = (slot + 1U) & indexMask;
+                }
+                if (slots[slot] == 0U) {
+                    slots[slot] = static_cast<u32>(index + 1U);
+                }
             }
-            bool match = true;
-            for (usize i = 0; i < keyView.Length(); ++i) {
-                if (keyView[i] != key[i]) {
-                    match = false;
-                    break;
+        }
+
+        mValueStack.Resize(frame.mValueBase);
+        mKeyStack.Resize(frame.mKeyBase);
+        out.Object = FJsonObject(pairs, static_cast<u32>(count), indexMask);
+        return true;
+    }
+
+    auto FindObjectValue(const FJsonValue& object, FNativeStringView key) -> const FJsonValue* {
+        if (object.Type != EJsonType::Object) {
+            return nullptr;
+        }
+        const FJsonObject& members = object.Object;
+        if (members.HasIndex()) {
+            const u32* slots = members.GetIndexSlots();
+            const u32  mask  = members.GetIndexMask();
+            for (u32 slot = HashKey(key) & mask; slots[slot] != 0U; slot = (slot + 1U) & mask) {
+                const FJsonPair& pair = members[slots[slot] - 1U];
+                if (KeysEqual(pair.Key, key)) {
+                    return pair.Value;
                 }
             }
-            if (match) {
+            return nullptr;
+        }
+        for (const auto& pair : members) {
+            if (KeysEqual(pair.Key, key)) {
                 return pair.Value;
             }
         }
         return nullptr;
     }
 
+    auto FindObjectValue(const FJsonValue& object, const char* key) -> const FJsonValue* {
+        if (key == nullptr) {
+            return nullptr;
+        }
+        return FindObjectValue(object, FNativeStringView(key));
+    }
+
     auto FindObjectValueInsensitive(const FJsonValue& object, const char* key)
         -> const FJsonValue* {
         if (object.Type != EJsonType::Object) {
@@ -454,7 +843,7 @@ namespace AltinaEngine::Core::Utility::Json {
         }
         const usize keyLength = static_cast<usize>(std::strlen(key));
         for (const auto& pair : object.Object) {
-            FNativeStringView keyView(pair.Key.GetData(), pair.Key.Length());
+            const FNativeStringView keyView = pair.Key;
             if (keyView.Length() != keyLength) {
                 continue;
             }
@@ -474,6 +863,14 @@ namespace AltinaEngine::Core::Utility::Json {
     }
 
     auto GetStringValue(const FJsonValue* value, FNativeString& out) -> bool {
+        if (value == nullptr || value->Type != EJsonType::String) {
+            return false;
+        }
+        out = FNativeString(value->String);
+        return true;
+    }
+
+    auto GetStringView(const FJsonValue* value, FNativeStringView& out) -> bool {
         if (value == nullptr || value->Type != EJsonType::String) {
             return false;
         }
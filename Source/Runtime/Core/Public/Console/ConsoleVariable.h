@@ -3,6 +3,7 @@
 #include "../Container/String.h"
 #include "../Container/Variant.h"
 #include "../Container/HashMap.h"
+#include "../Container/Name.h"
 #include "../Container/SmartPtr.h"
 #include "../Container/Function.h"
 #include "../Threading/Mutex.h"
@@ -21,6 +22,7 @@ using AltinaEngine::TTypeSet;
 using AltinaEngine::Core::Container::TVariant;
 namespace AltinaEngine::Core::Console {
 
+    using Container::FName;
     using Container::FString;
     using Container::TFunction;
     using Container::THashMap;
@@ -308,16 +310,8 @@ namespace AltinaEngine::Core::Console {
         EType          mType;
         ECVarFlags     mFlags = ECVarFlags::None;
 
-        // Hash / equality helpers for FString as THashMap key
-        struct FStringHash {
-            auto operator()(const FString& s) const noexcept -> size_t;
-        };
-
-        struct FStringEqual {
-            auto operator()(const FString& a, const FString& b) const noexcept -> bool;
-        };
-
-        using RegistryMap = THashMap<FString, TShared<FConsoleVariable>, FStringHash, FStringEqual>;
+        // Keyed by the interned name: lookups hash a handle instead of the text.
+        using RegistryMap = THashMap<FName, TShared<FConsoleVariable>>;
 
         static RegistryMap gRegistry;
         static FMutex      gRegistryMutex;
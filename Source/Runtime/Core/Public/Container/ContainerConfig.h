@@ -3,4 +3,7 @@
 namespace AltinaEngine::Core::Container {
     // Controls whether smart pointers default to the engine-managed allocator.
     constexpr bool kSmartPtrUseManagedAllocator = true;
+
+    // Selects the map behind THashMap: TSwissHashMap when true, TRobinHoodHashMap otherwise.
+    constexpr bool kHashMapUseSwissTable = true;
 } // namespace AltinaEngine::Core::Container
@@ -1,13 +1,16 @@
 #ifndef ALTINAENGINE_CORE_PUBLIC_CONTAINER_HASHMAP_H
 #define ALTINAENGINE_CORE_PUBLIC_CONTAINER_HASHMAP_H
 
+#include "ContainerConfig.h"
 #include "HashUtility.h"
 #include "RobinHoodHashMap.h"
+#include "SwissHashMap.h"
 
 namespace AltinaEngine::Core::Container {
     template <typename Key, typename T, typename Hash = THashFunc<Key>,
         typename KeyEqual = TEqual<Key>, typename Allocator = void>
-    using THashMap = TRobinHoodHashMap<Key, T, Hash, KeyEqual>;
+    using THashMap = typename TTypeSelect<kHashMapUseSwissTable,
+        TSwissHashMap<Key, T, Hash, KeyEqual>, TRobinHoodHashMap<Key, T, Hash, KeyEqual>>::Type;
 } // namespace AltinaEngine::Core::Container
 
 #endif // ALTINAENGINE_CORE_PUBLIC_CONTAINER_HASHMAP_H
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Base/CoreAPI.h"
+#include "Container/HashUtility.h"
+#include "Container/String.h"
+#include "Container/StringView.h"
+#include "Types/Aliases.h"
+
+namespace AltinaEngine::Core::Container {
+    /**
+     * FName
+     * Interned, case-sensitive identifier: a 32-bit handle into a process-wide name table.
+     * Constructing an FName hashes the text once and looks it up in (or adds it to) the table;
+     * afterwards copies, comparisons and hashing only touch the handle. The table is lock-free
+     * and append-only, so names can be created and resolved from any thread and their text
+     * stays valid for the lifetime of the process.
+     *
+     * Ordering follows the handle, not the text; sort ToView() when a lexical order matters.
+     */
+    class AE_CORE_API FName {
+    public:
+        constexpr FName() noexcept = default;
+        // Interns `text`. An empty text yields None; so does a name that cannot be added (too long,
+        // or the table is full), which is logged.
+        explicit FName(FStringView text) noexcept;
+        explicit FName(const TChar* text) noexcept;
+
+        // Returns the name for `text` if it was interned before, None otherwise. Never adds.
+        [[nodiscard]] static auto    Find(FStringView text) noexcept -> FName;
+
+        [[nodiscard]] constexpr auto IsNone() const noexcept -> bool { return mIndex == 0U; }
+        [[nodiscard]] constexpr auto GetIndex() const noexcept -> u32 { return mIndex; }
+
+        // The interned text, null-terminated. Empty for None.
+        [[nodiscard]] auto           ToView() const noexcept -> FStringView;
+        [[nodiscard]] auto           ToString() const -> FString { return FString(ToView()); }
+
+        [[nodiscard]] constexpr auto operator==(FName other) const noexcept -> bool {
+            return mIndex == other.mIndex;
+        }
+        [[nodiscard]] constexpr auto operator!=(FName other) const noexcept -> bool {
+            return mIndex != other.mIndex;
+        }
+        [[nodiscard]] constexpr auto operator<(FName other) const noexcept -> bool {
+            return mIndex < other.mIndex;
+        }
+
+    private:
+        u32 mIndex = 0U;
+    };
+
+    template <> struct THashFunc<FName> {
+        auto operator()(FName name) const noexcept -> usize {
+            return Detail::FoldToUsize(Detail::MixU64(static_cast<u64>(name.GetIndex())));
+        }
+    };
+} // namespace AltinaEngine::Core::Container
@@ -19,18 +19,31 @@ namespace AltinaEngine::Core::Container::Detail {
 
 namespace AltinaEngine::Core::Container {
 
-    template <typename T> class TBasicString : public TVector<T> {
+    /**
+     * TBasicString<T>
+     * Null-terminated string with inline storage for short contents. Up to kInlineCapacity
+     * characters live inside the object (23 for char), so most names, keys and labels never
+     * touch the heap; longer strings switch to a heap buffer that grows geometrically. The
+     * object is 32 bytes and also offers the TVector-style interface (Size, Reserve, PushBack,
+     * iteration). Lengths are stored as u32.
+     */
+    template <typename T> class TBasicString {
     public:
-        using TSuper = TVector<T>;
-        using typename TSuper::TConstReference;
-        using typename TSuper::TReference;
-        using typename TSuper::TSizeType;
-        using typename TSuper::TValueType;
-        using TView = TBasicStringView<TValueType>;
+        using TValueType      = T;
+        using TSizeType       = usize;
+        using TPointer        = TValueType*;
+        using TConstPointer   = const TValueType*;
+        using TReference      = TValueType&;
+        using TConstReference = const TValueType&;
+        using TIterator       = TValueType*;
+        using TConstIterator  = const TValueType*;
+        using TView           = TBasicStringView<TValueType>;
 
         static constexpr TSizeType npos = static_cast<TSizeType>(-1);
+        static constexpr TSizeType kInlineCapacity =
+            (24U / sizeof(TValueType) > 1U) ? (24U / sizeof(TValueType) - 1U) : 1U;
 
-        TBasicString() = default;
+        TBasicString() noexcept {}
 
         explicit TBasicString(const TValueType* Text) { Append(Text); }
 
@@ -38,25 +51,129 @@ namespace AltinaEngine::Core::Container {
 
         TBasicString(TBasicStringView<T> strView) { Append(strView.Data(), strView.Length()); }
 
+        TBasicString(const TBasicString& other) { Append(other.GetData(), other.Length()); }
+
+        TBasicString(TBasicString&& other) noexcept { StealFrom(other); }
+
+        ~TBasicString() { ReleaseHeap(); }
+
+        auto operator=(const TBasicString& other) -> TBasicString& {
+            if (this != &other) {
+                Clear();
+                Append(other.GetData(), other.Length());
+            }
+            return *this;
+        }
+
+        auto operator=(TBasicString&& other) noexcept -> TBasicString& {
+            if (this != &other) {
+                ReleaseHeap();
+                StealFrom(other);
+            }
+            return *this;
+        }
+
         auto operator=(const TValueType* Text) -> TBasicString& {
-            TSuper::Clear();
-            Append(Text);
+            Assign(Text);
             return *this;
         }
 
         void Assign(const TValueType* Text) {
-            TSuper::Clear();
-            Append(Text);
+            if (Text == nullptr) {
+                Clear();
+                return;
+            }
+            Assign(TBasicStringView<T>(Text, ComputeLength(Text)));
         }
 
         void Assign(TBasicStringView<T> Text) {
-            TSuper::Clear();
+            if (IsAliased(Text.Data())) {
+                // A substring of this string starts at or after the buffer, so a forward copy
+                // never overwrites characters it still has to read.
+                CopyCharacters(Data(), Text.Data(), Text.Length());
+                SetSize(Text.Length());
+                return;
+            }
+            Clear();
             Append(Text);
         }
 
         void Assign(const TBasicString& Text) {
-            TSuper::Clear();
-            Append(Text);
+            if (this != &Text) {
+                Clear();
+                Append(Text);
+            }
+        }
+
+        [[nodiscard]] auto operator[](TSizeType index) noexcept -> TReference {
+            return Data()[index];
+        }
+        [[nodiscard]] auto operator[](TSizeType index) const noexcept -> TConstReference {
+            return Data()[index];
+        }
+
+        [[nodiscard]] auto Front() noexcept -> TReference { return Data()[0]; }
+        [[nodiscard]] auto Front() const noexcept -> TConstReference { return Data()[0]; }
+        [[nodiscard]] auto Back() noexcept -> TReference { return Data()[mSize - 1U]; }
+        [[nodiscard]] auto Back() const noexcept -> TConstReference { return Data()[mSize - 1U]; }
+
+        // Never null: an empty string points at its (terminated) inline buffer.
+        [[nodiscard]] auto Data() noexcept -> TPointer { return IsInline() ? mInline : mHeap; }
+        [[nodiscard]] auto Data() const noexcept -> TConstPointer {
+            return IsInline() ? mInline : mHeap;
+        }
+
+        [[nodiscard]] auto begin() noexcept -> TIterator { return Data(); }
+        [[nodiscard]] auto begin() const noexcept -> TConstIterator { return Data(); }
+        [[nodiscard]] auto cbegin() const noexcept -> TConstIterator { return Data(); }
+        [[nodiscard]] auto end() noexcept -> TIterator { return Data() + mSize; }
+        [[nodiscard]] auto end() const noexcept -> TConstIterator { return Data() + mSize; }
+        [[nodiscard]] auto cend() const noexcept -> TConstIterator { return Data() + mSize; }
+
+        [[nodiscard]] auto IsEmpty() const noexcept -> bool { return mSize == 0U; }
+        [[nodiscard]] auto Size() const noexcept -> TSizeType { return mSize; }
+        [[nodiscard]] auto Capacity() const noexcept -> TSizeType { return mCapacity; }
+        [[nodiscard]] auto IsInline() const noexcept -> bool {
+            return mCapacity <= kInlineCapacity;
+        }
+
+        void Reserve(TSizeType newCapacity) {
+            if (newCapacity > mCapacity) {
+                Reallocate(newCapacity);
+            }
+        }
+
+        // New characters are zero, matching TVector::Resize.
+        void Resize(TSizeType newSize) {
+            Reserve(newSize);
+            TValueType* data = Data();
+            for (TSizeType index = mSize; index < newSize; ++index) {
+                data[index] = static_cast<TValueType>(0);
+            }
+            SetSize(newSize);
+        }
+
+        // Keeps the buffer, so a cleared string is refilled without allocating.
+        void Clear() noexcept { SetSize(0U); }
+
+        void PushBack(TConstReference Character) {
+            if (mSize == mCapacity) {
+                Reallocate(GrowCapacity(mSize + 1U));
+            }
+            TValueType* data = Data();
+            data[mSize]      = Character;
+            data[++mSize]    = static_cast<TValueType>(0);
+        }
+
+        template <typename... Args> auto EmplaceBack(Args&&... args) -> TReference {
+            PushBack(TValueType(Forward<Args>(args)...));
+            return Back();
+        }
+
+        void PopBack() noexcept {
+            if (mSize > 0U) {
+                SetSize(mSize - 1U);
+            }
         }
 
         void Append(const TValueType* Text) {
@@ -72,28 +189,23 @@ namespace AltinaEngine::Core::Container {
                 return;
             }
 
-            this->Reserve(this->Size() + Length);
-            for (usize index = 0; index < Length; ++index) {
-                this->PushBack(Text[index]);
+            const usize newSize = mSize + Length;
+            if (newSize > mCapacity) {
+                // Text may point into this string, so it is copied before the old buffer goes.
+                const usize capacity = GrowCapacity(newSize);
+                TValueType* buffer   = AllocateBuffer(capacity);
+                CopyCharacters(buffer, Data(), mSize);
+                CopyCharacters(buffer + mSize, Text, Length);
+                AdoptBuffer(buffer, capacity);
+            } else {
+                CopyCharacters(Data() + mSize, Text, Length);
             }
+            SetSize(newSize);
         }
 
-        void Append(TConstReference Character) { this->PushBack(Character); }
+        void Append(TConstReference Character) { PushBack(Character); }
 
-        void Append(TBasicStringView<T> Text) {
-            if (Text.Length() == 0) {
-                return;
-            }
-            const auto* data   = Text.Data();
-            const auto  length = Text.Length();
-            const auto* base   = this->GetData();
-            if (base != nullptr && data >= base && data < (base + this->Length())) {
-                TBasicString temp(Text);
-                Append(temp.GetData(), temp.Length());
-                return;
-            }
-            Append(data, length);
-        }
+        void Append(TBasicStringView<T> Text) { Append(Text.Data(), Text.Length()); }
 
         void                             Append(const TBasicString& Text) { Append(Text.ToView()); }
 
@@ -115,41 +227,20 @@ namespace AltinaEngine::Core::Container {
             return out;
         }
 
-        [[nodiscard]] auto GetData() const noexcept -> const TValueType* { return TSuper::Data(); }
-        auto               GetData() noexcept -> TValueType* { return TSuper::Data(); }
+        [[nodiscard]] auto GetData() const noexcept -> const TValueType* { return Data(); }
+        auto               GetData() noexcept -> TValueType* { return Data(); }
 
-        [[nodiscard]] auto Length() const noexcept -> usize { return this->Size(); }
+        [[nodiscard]] auto Length() const noexcept -> usize { return mSize; }
 
-        [[nodiscard]] auto IsEmptyString() const noexcept -> bool { return this->IsEmpty(); }
+        [[nodiscard]] auto IsEmptyString() const noexcept -> bool { return mSize == 0U; }
 
-        [[nodiscard]] auto ToView() const noexcept -> TView {
-            return { this->GetData(), this->Length() };
-        }
+        [[nodiscard]] auto ToView() const noexcept -> TView { return { Data(), mSize }; }
 
         [[nodiscard]]      operator TView() const noexcept { return ToView(); }
 
-        [[nodiscard]] auto CStr() const noexcept -> const TValueType* {
-            if (this->IsEmpty()) {
-                return EmptyString();
-            }
-            const_cast<TBasicString*>(this)->EnsureNullTerminated();
-            return this->GetData();
-        }
-
-        [[nodiscard]] auto CStr() noexcept -> TValueType* {
-            EnsureNullTerminated();
-            return this->GetData();
-        }
-
-        void EnsureNullTerminated() {
-            const TSizeType length = this->Size();
-            if (this->Capacity() < length + 1) {
-                this->Reserve(length + 1);
-            }
-            if (this->GetData() != nullptr) {
-                this->GetData()[length] = static_cast<TValueType>(0);
-            }
-        }
+        // The buffer is always terminated, so this never allocates.
+        [[nodiscard]] auto CStr() const noexcept -> const TValueType* { return Data(); }
+        [[nodiscard]] auto CStr() noexcept -> TValueType* { return Data(); }
 
         [[nodiscard]] auto Compare(TView other) const noexcept -> int {
             return ToView().Compare(other);
@@ -281,14 +372,68 @@ namespace AltinaEngine::Core::Container {
         }
 
     private:
-        static constexpr auto EmptyString() noexcept -> const TValueType* {
-            static constexpr TValueType kEmpty[1] = { static_cast<TValueType>(0) };
-            return kEmpty;
+        [[nodiscard]] static auto GrowCapacity(TSizeType required) noexcept -> TSizeType {
+            return (required < kInlineCapacity * 2U + 1U) ? (kInlineCapacity * 2U + 1U)
+                                                          : required + required / 2U;
+        }
+
+        [[nodiscard]] static auto AllocateBuffer(TSizeType capacity) -> TValueType* {
+            return TAllocator<TValueType>().Allocate(capacity + 1U);
+        }
+
+        static void CopyCharacters(
+            TValueType* destination, const TValueType* source, TSizeType count) noexcept {
+            for (TSizeType index = 0U; index < count; ++index) {
+                destination[index] = source[index];
+            }
+        }
+
+        [[nodiscard]] auto IsAliased(const TValueType* Text) const noexcept -> bool {
+            const TValueType* data = Data();
+            return Text >= data && Text < data + mSize;
+        }
+
+        void SetSize(TSizeType size) noexcept {
+            mSize         = static_cast<u32>(size);
+            Data()[mSize] = static_cast<TValueType>(0);
+        }
+
+        void Reallocate(TSizeType capacity) {
+            TValueType* buffer = AllocateBuffer(capacity);
+            CopyCharacters(buffer, Data(), mSize + 1U);
+            AdoptBuffer(buffer, capacity);
+        }
+
+        // Replaces the current storage with a heap buffer that already holds the contents.
+        void AdoptBuffer(TValueType* buffer, TSizeType capacity) noexcept {
+            ReleaseHeap();
+            mHeap     = buffer;
+            mCapacity = static_cast<u32>(capacity);
+        }
+
+        void ReleaseHeap() noexcept {
+            if (!IsInline()) {
+                TAllocator<TValueType>().Deallocate(mHeap, mCapacity + 1U);
+            }
+        }
+
+        void StealFrom(TBasicString& other) noexcept {
+            mSize     = other.mSize;
+            mCapacity = other.mCapacity;
+            if (other.IsInline()) {
+                CopyCharacters(mInline, other.mInline, kInlineCapacity + 1U);
+            } else {
+                mHeap = other.mHeap;
+            }
+            other.mCapacity   = static_cast<u32>(kInlineCapacity);
+            other.mSize       = 0U;
+            other.mInline[0U] = static_cast<TValueType>(0);
         }
 
         template <typename Func> void TransformCharacters(Func&& Transformer) {
-            for (usize index = 0; index < this->Size(); ++index) {
-                (*this)[index] = Transformer((*this)[index]);
+            TValueType* data = Data();
+            for (usize index = 0; index < mSize; ++index) {
+                data[index] = Transformer(data[index]);
             }
         }
 
@@ -360,13 +505,20 @@ namespace AltinaEngine::Core::Container {
                 if constexpr (AltinaEngine::CSameAs<TValueType, char>) {
                     Append(buffer, static_cast<usize>(written));
                 } else {
-                    this->Reserve(this->Size() + static_cast<usize>(written));
+                    Reserve(mSize + static_cast<usize>(written));
                     for (int i = 0; i < written; ++i) {
-                        this->PushBack(static_cast<TValueType>(buffer[i]));
+                        PushBack(static_cast<TValueType>(buffer[i]));
                     }
                 }
             }
         }
+
+        union {
+            TValueType  mInline[kInlineCapacity + 1U] = {};
+            TValueType* mHeap;
+        };
+        u32 mSize     = 0U;
+        u32 mCapacity = static_cast<u32>(kInlineCapacity);
     };
     using FString       = TBasicString<TChar>;
     using FNativeString = TBasicString<char>;
@@ -0,0 +1,729 @@
+#ifndef ALTINAENGINE_CORE_PUBLIC_CONTAINER_SWISSHASHMAP_H
+#define ALTINAENGINE_CORE_PUBLIC_CONTAINER_SWISSHASHMAP_H
+
+#include "../Types/Aliases.h"
+#include "../Types/Traits.h"
+#include "Allocator.h"
+#include "HashUtility.h"
+#include "Pair.h"
+
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define AE_SWISS_HASH_MAP_SSE2 1
+#else
+    #include <cstring>
+    #define AE_SWISS_HASH_MAP_SSE2 0
+#endif
+
+namespace AltinaEngine::Core::Container {
+    namespace Detail {
+        // Control byte states. Full slots store the low 7 bits of their hash (high bit clear),
+        // so "empty or deleted" is exactly the sign bit.
+        inline constexpr i8 kSwissEmpty   = static_cast<i8>(-128);
+        inline constexpr i8 kSwissDeleted = static_cast<i8>(-2);
+
+        struct alignas(16) FSwissControlGroup {
+            i8 Bytes[16];
+        };
+
+        /**
+         * FSwissGroup
+         * Sixteen control bytes compared at once. Each Match* call returns a 16-bit mask with
+         * one bit per slot of the group.
+         */
+        struct FSwissGroup {
+            static constexpr u32 kWidth = 16U;
+
+#if AE_SWISS_HASH_MAP_SSE2
+            explicit FSwissGroup(const i8* control) noexcept
+                : mControl(_mm_load_si128(reinterpret_cast<const __m128i*>(control))) {}
+
+            [[nodiscard]] auto Match(i8 h2) const noexcept -> u32 {
+                return static_cast<u32>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), mControl)));
+            }
+            [[nodiscard]] auto MatchEmpty() const noexcept -> u32 { return Match(kSwissEmpty); }
+            [[nodiscard]] auto MatchEmptyOrDeleted() const noexcept -> u32 {
+                return static_cast<u32>(_mm_movemask_epi8(mControl));
+            }
+
+            __m128i mControl;
+#else
+            // Portable path: each half of the group is handled as eight bytes in one u64.
+            // Match may report a false positive next to a real match; callers compare keys
+            // anyway. MatchEmpty and MatchEmptyOrDeleted are exact.
+            explicit FSwissGroup(const i8* control) noexcept {
+                std::memcpy(mHalves, control, sizeof(mHalves));
+            }
+
+            [[nodiscard]] auto Match(i8 h2) const noexcept -> u32 {
+                const u64 pattern = kLsbs * static_cast<u8>(h2);
+                return Collect([pattern](u64 bytes) {
+                    const u64 x = bytes ^ pattern;
+                    return (x - kLsbs) & ~x & kMsbs;
+                });
+            }
+            [[nodiscard]] auto MatchEmpty() const noexcept -> u32 {
+                return Collect([](u64 bytes) { return bytes & ~(bytes << 6U) & kMsbs; });
+            }
+            [[nodiscard]] auto MatchEmptyOrDeleted() const noexcept -> u32 {
+                return Collect([](u64 bytes) { return bytes & kMsbs; });
+            }
+
+        private:
+            static constexpr u64 kLsbs = 0x0101010101010101ULL;
+            static constexpr u64 kMsbs = 0x8080808080808080ULL;
+
+            // Gathers the per-byte high bits of both halves into one bit per slot.
+            template <typename TFunc>
+            [[nodiscard]] auto Collect(TFunc func) const noexcept -> u32 {
+                const u64 low  = ((func(mHalves[0]) >> 7U) * 0x0102040810204080ULL) >> 56U;
+                const u64 high = ((func(mHalves[1]) >> 7U) * 0x0102040810204080ULL) >> 56U;
+                return static_cast<u32>(low | (high << 8U));
+            }
+
+            u64 mHalves[2];
+#endif
+        };
+    } // namespace Detail
+
+    /**
+     * Open-addressing hash map in the "Swiss table" layout: one control byte per slot holding
+     * 7 bits of the hash, probed a 16-slot group at a time (SSE2 where available), and a flat
+     * array of key/value slots. A lookup usually reads one control group and one slot. Erase
+     * leaves a tombstone unless the slot's group never filled up; tombstones are dropped on
+     * the next rehash. API-compatible with TRobinHoodHashMap.
+     */
+    template <typename TKey, typename TValue, typename THasher = THashFunc<TKey>,
+        typename TKeyEqual = TEqual<TKey>>
+    class TSwissHashMap {
+    public:
+        using key_type    = TKey;      // NOLINT(*-identifier-naming)
+        using mapped_type = TValue;    // NOLINT(*-identifier-naming)
+        using size_type   = usize;     // NOLINT(*-identifier-naming)
+        using hasher      = THasher;   // NOLINT(*-identifier-naming)
+        using key_equal   = TKeyEqual; // NOLINT(*-identifier-naming)
+
+        struct value_type {
+            TKey   first;
+            TValue second;
+        };
+
+        class iterator {
+        public:
+            using value_type        = TSwissHashMap::value_type; // NOLINT(*-identifier-naming)
+            using difference_type   = isize;                     // NOLINT(*-identifier-naming)
+            using pointer           = value_type*;               // NOLINT(*-identifier-naming)
+            using reference         = value_type&;               // NOLINT(*-identifier-naming)
+            using iterator_category = void;                      // NOLINT(*-identifier-naming)
+
+            iterator() = default;
+            iterator(TSwissHashMap* owner, size_type index) : mOwner(owner), mIndex(index) {}
+
+            auto operator*() const -> reference { return *mOwner->EntryAt(mIndex); }
+            auto operator->() const -> pointer { return mOwner->EntryAt(mIndex); }
+
+            auto operator++() -> iterator& {
+                ++mIndex;
+                SkipToOccupied();
+                return *this;
+            }
+            auto operator++(int) -> iterator {
+                iterator copy(*this);
+                ++(*this);
+                return copy;
+            }
+
+            [[nodiscard]] auto operator==(const iterator& rhs) const -> bool {
+                return mOwner == rhs.mOwner && mIndex == rhs.mIndex;
+            }
+            [[nodiscard]] auto operator!=(const iterator& rhs) const -> bool {
+                return !(*this == rhs);
+            }
+
+            [[nodiscard]] auto Index() const -> size_type { return mIndex; }
+
+        private:
+            void SkipToOccupied() {
+                if (mOwner != nullptr) {
+                    mIndex = mOwner->NextOccupied(mIndex);
+                }
+            }
+
+            TSwissHashMap* mOwner = nullptr;
+            size_type      mIndex = 0;
+
+            friend class TSwissHashMap;
+        };
+
+        class const_iterator {
+        public:
+            using value_type      = const TSwissHashMap::value_type; // NOLINT(*-identifier-naming)
+            using difference_type = isize;                           // NOLINT(*-identifier-naming)
+            using pointer         = const TSwissHashMap::value_type*; // NOLINT(*-identifier-naming)
+            using reference       = const TSwissHashMap::value_type&; // NOLINT(*-identifier-naming)
+            using iterator_category = void;                           // NOLINT(*-identifier-naming)
+
+            const_iterator() = default;
+            const_iterator(const TSwissHashMap* owner, size_type index)
+                : mOwner(owner), mIndex(index) {}
+            const_iterator(iterator it) : mOwner(it.mOwner), mIndex(it.mIndex) {}
+
+            auto operator*() const -> reference { return *mOwner->EntryAt(mIndex); }
+            auto operator->() const -> pointer { return mOwner->EntryAt(mIndex); }
+
+            auto operator++() -> const_iterator& {
+                ++mIndex;
+                SkipToOccupied();
+                return *this;
+            }
+            auto operator++(int) -> const_iterator {
+                const_iterator copy(*this);
+                ++(*this);
+                return copy;
+            }
+
+            [[nodiscard]] auto operator==(const const_iterator& rhs) const -> bool {
+                return mOwner == rhs.mOwner && mIndex == rhs.mIndex;
+            }
+            [[nodiscard]] auto operator!=(const const_iterator& rhs) const -> bool {
+                return !(*this == rhs);
+            }
+
+            [[nodiscard]] auto Index() const -> size_type { return mIndex; }
+
+        private:
+            void SkipToOccupied() {
+                if (mOwner != nullptr) {
+                    mIndex = mOwner->NextOccupied(mIndex);
+                }
+            }
+
+            const TSwissHashMap* mOwner = nullptr;
+            size_type            mIndex = 0;
+
+            friend class TSwissHashMap;
+        };
+
+        using InsertResult = TPair<iterator, bool>;
+
+        TSwissHashMap() = default;
+        explicit TSwissHashMap(size_type initialCapacity) { Reserve(initialCapacity); }
+
+        TSwissHashMap(const TSwissHashMap& other) { CopyFrom(other); }
+
+        auto operator=(const TSwissHashMap& other) -> TSwissHashMap& {
+            if (this != &other) {
+                Clear();
+                ReleaseStorage();
+                CopyFrom(other);
+            }
+            return *this;
+        }
+
+        TSwissHashMap(TSwissHashMap&& other) noexcept { MoveFrom(Move(other)); }
+
+        auto operator=(TSwissHashMap&& other) noexcept -> TSwissHashMap& {
+            if (this != &other) {
+                Clear();
+                ReleaseStorage();
+                MoveFrom(Move(other));
+            }
+            return *this;
+        }
+
+        ~TSwissHashMap() {
+            Clear();
+            ReleaseStorage();
+        }
+
+        [[nodiscard]] auto begin() -> iterator {
+            iterator it(this, 0);
+            it.SkipToOccupied();
+            return it;
+        }
+        [[nodiscard]] auto begin() const -> const_iterator {
+            const_iterator it(this, 0);
+            it.SkipToOccupied();
+            return it;
+        }
+        [[nodiscard]] auto cbegin() const -> const_iterator { return begin(); }
+        [[nodiscard]] auto end() -> iterator { return iterator(this, mBucketCount); }
+        [[nodiscard]] auto end() const -> const_iterator {
+            return const_iterator(this, mBucketCount);
+        }
+        [[nodiscard]] auto cend() const -> const_iterator { return end(); }
+
+        [[nodiscard]] auto IsEmpty() const noexcept -> bool { return mSize == 0; }
+        [[nodiscard]] auto Num() const noexcept -> size_type { return mSize; }
+
+        [[nodiscard]] auto LoadFactor() const noexcept -> f32 {
+            if (mBucketCount == 0) {
+                return 0.0F;
+            }
+            return static_cast<f32>(mSize) / static_cast<f32>(mBucketCount);
+        }
+
+        // Capped at 7/8: a group probe needs at least one empty slot somewhere in the table.
+        // Takes effect at once; a table already past the new limit is rehashed.
+        [[nodiscard]] auto GetMaxLoadFactor() const noexcept -> f32 { return mMaxLoadFactor; }
+        void               SetMaxLoadFactor(f32 value) {
+            // Slots holding entries or tombstones; they stay taken under the new limit.
+            const size_type used = (mBucketCount == 0) ? 0 : GrowthLimit() - mGrowthLeft;
+            if (value < 0.10F) {
+                mMaxLoadFactor = 0.10F;
+            } else if (value > 0.875F) {
+                mMaxLoadFactor = 0.875F;
+            } else {
+                mMaxLoadFactor = value;
+            }
+            if (mBucketCount == 0) {
+                return;
+            }
+            const size_type limit = GrowthLimit();
+            if (used <= limit) {
+                mGrowthLeft = limit - used;
+                return;
+            }
+            const size_type minBuckets = MinimumBucketsForSize(mSize);
+            Resize((minBuckets > mBucketCount) ? minBuckets : mBucketCount);
+        }
+
+        [[nodiscard]] auto FindIt(const TKey& key) -> iterator {
+            const size_type index = FindIndex(key, HashOf(key));
+            if (index == kInvalidIndex) {
+                return end();
+            }
+            return iterator(this, index);
+        }
+
+        [[nodiscard]] auto FindIt(const TKey& key) const -> const_iterator {
+            const size_type index = FindIndex(key, HashOf(key));
+            if (index == kInvalidIndex) {
+                return end();
+            }
+            return const_iterator(this, index);
+        }
+
+        [[nodiscard]] auto Find(const TKey& key) -> TValue* {
+            const size_type index = FindIndex(key, HashOf(key));
+            return (index == kInvalidIndex) ? nullptr : &EntryAt(index)->second;
+        }
+        [[nodiscard]] auto Find(const TKey& key) const -> const TValue* {
+            const size_type index = FindIndex(key, HashOf(key));
+            return (index == kInvalidIndex) ? nullptr : &EntryAt(index)->second;
+        }
+
+        [[nodiscard]] auto Count(const TKey& key) const -> size_type {
+            return Contains(key) ? 1 : 0;
+        }
+        [[nodiscard]] auto Contains(const TKey& key) const -> bool {
+            return FindIndex(key, HashOf(key)) != kInvalidIndex;
+        }
+        [[nodiscard]] auto HasKey(const TKey& key) const -> bool { return Contains(key); }
+
+        auto               At(const TKey& key) -> TValue& {
+            iterator it = FindIt(key);
+            return it->second;
+        }
+        auto At(const TKey& key) const -> const TValue& {
+            const_iterator it = FindIt(key);
+            return it->second;
+        }
+
+        auto operator[](const TKey& key) -> TValue& { return TryEmplace(key).first->second; }
+        auto operator[](TKey&& key) -> TValue& { return TryEmplace(Move(key)).first->second; }
+
+        auto Insert(const value_type& value) -> InsertResult {
+            return InsertImpl(value.first, value.second);
+        }
+        auto Insert(value_type&& value) -> InsertResult {
+            return InsertImpl(Move(value.first), Move(value.second));
+        }
+        template <typename TKeyArg, typename TValueArg>
+        auto Emplace(TKeyArg&& key, TValueArg&& value) -> InsertResult {
+            return InsertImpl(Forward<TKeyArg>(key), Forward<TValueArg>(value));
+        }
+        template <typename... TArgs>
+        auto TryEmplace(const TKey& key, TArgs&&... args) -> InsertResult {
+            return TryEmplaceImpl(key, Forward<TArgs>(args)...);
+        }
+        template <typename... TArgs> auto TryEmplace(TKey&& key, TArgs&&... args) -> InsertResult {
+            return TryEmplaceImpl(Move(key), Forward<TArgs>(args)...);
+        }
+
+        auto InsertOrAssign(const TKey& key, const TValue& value) -> InsertResult {
+            InsertResult result = TryEmplaceImpl(key, value);
+            if (!result.second) {
+                result.first->second = value;
+            }
+            return result;
+        }
+        auto InsertOrAssign(TKey&& key, TValue&& value) -> InsertResult {
+            const u64       hash  = HashOf(key);
+            const size_type index = FindIndex(key, hash);
+            if (index != kInvalidIndex) {
+                EntryAt(index)->second = Move(value);
+                return { iterator(this, index), false };
+            }
+            return { iterator(this, InsertNew(hash, Move(key), Move(value))), true };
+        }
+
+        auto Erase(const TKey& key) -> size_type { return Remove(key) ? 1 : 0; }
+        // Returns the iterator to the next element.
+        auto Erase(iterator position) -> iterator {
+            if (position == end()) {
+                return end();
+            }
+            const size_type index = position.Index();
+            RemoveAtIndex(index);
+            iterator next(this, index);
+            next.SkipToOccupied();
+            return next;
+        }
+        auto Remove(const TKey& key) -> bool {
+            const size_type index = FindIndex(key, HashOf(key));
+            if (index == kInvalidIndex) {
+                return false;
+            }
+            RemoveAtIndex(index);
+            return true;
+        }
+
+        void Clear() noexcept {
+            if (mSize != 0) {
+                for (size_type i = 0; i < mBucketCount; ++i) {
+                    if (IsFull(ControlAt(i))) {
+                        DestroyEntry(i);
+                    }
+                }
+            }
+            ResetControl();
+            mSize = 0;
+        }
+
+        void Reserve(size_type expectedCount) {
+            if (expectedCount == 0) {
+                return;
+            }
+            const size_type minBuckets =
+                static_cast<size_type>(static_cast<f32>(expectedCount) / mMaxLoadFactor) + 1;
+            if (minBuckets > mBucketCount) {
+                Rehash(minBuckets);
+            }
+        }
+
+        void Rehash(size_type requestedBuckets) {
+            size_type newBucketCount = NormalizeBucketCount(requestedBuckets);
+            if (newBucketCount < MinimumBucketsForSize(mSize)) {
+                newBucketCount = MinimumBucketsForSize(mSize);
+            }
+            if (newBucketCount == mBucketCount && mGrowthLeft + mSize == GrowthLimit()) {
+                return; // Same size and no tombstones to drop.
+            }
+            Resize(newBucketCount);
+        }
+
+    private:
+        using FControlGroup = Detail::FSwissControlGroup;
+        using FGroup        = Detail::FSwissGroup;
+
+        struct FEntryStorage {
+            alignas(value_type) u8 Bytes[sizeof(value_type)];
+        };
+
+        static constexpr size_type kGroupWidth         = FGroup::kWidth;
+        static constexpr size_type kDefaultBucketCount = kGroupWidth;
+        static constexpr size_type kInvalidIndex       = static_cast<size_type>(-1);
+
+        using FControlAllocator = TAllocator<FControlGroup>;
+        using FStoreAllocator   = TAllocator<FEntryStorage>;
+
+        FControlGroup*    mControl       = nullptr;
+        FEntryStorage*    mStorage       = nullptr;
+        size_type         mBucketCount   = 0;
+        size_type         mSize          = 0;
+        // Empty slots that may still be filled before the load limit forces a rehash.
+        size_type         mGrowthLeft    = 0;
+        f32               mMaxLoadFactor = 0.875F;
+        THasher           mHasher{};
+        TKeyEqual         mKeyEqual{};
+        FControlAllocator mControlAllocator{};
+        FStoreAllocator   mStorageAllocator{};
+
+        [[nodiscard]] static auto IsFull(i8 control) noexcept -> bool { return control >= 0; }
+
+        // One multiply spreads weak hashers (identity, small ranges) over both the group index
+        // and the 7-bit tag.
+        [[nodiscard]] auto HashOf(const TKey& key) const -> u64 {
+            u64 h = static_cast<u64>(mHasher(key)) * 0x9e3779b97f4a7c15ULL;
+            return h ^ (h >> 32U);
+        }
+
+        [[nodiscard]] static auto H1(u64 hash) noexcept -> size_type {
+            return static_cast<size_type>(hash >> 7U);
+        }
+        [[nodiscard]] static auto H2(u64 hash) noexcept -> i8 {
+            return static_cast<i8>(hash & 0x7FU);
+        }
+
+        [[nodiscard]] auto ControlBytes() const noexcept -> i8* {
+            return reinterpret_cast<i8*>(mControl);
+        }
+        [[nodiscard]] auto ControlAt(size_type index) const noexcept -> i8 {
+            return ControlBytes()[index];
+        }
+        void SetControl(size_type index, i8 value) noexcept { ControlBytes()[index] = value; }
+
+        [[nodiscard]] auto GroupCount() const noexcept -> size_type {
+            return mBucketCount / kGroupWidth;
+        }
+
+        [[nodiscard]] auto GrowthLimit() const noexcept -> size_type {
+            const auto limit =
+                static_cast<size_type>(static_cast<f32>(mBucketCount) * mMaxLoadFactor);
+            return (limit < mBucketCount) ? limit : mBucketCount - 1;
+        }
+
+        [[nodiscard]] static auto NextPow2(size_type value) -> size_type {
+            return (value <= 1) ? 1 : std::bit_ceil(value);
+        }
+
+        [[nodiscard]] auto NormalizeBucketCount(size_type requested) const -> size_type {
+            const size_type normalized = NextPow2(requested);
+            return (normalized < kDefaultBucketCount) ? kDefaultBucketCount : normalized;
+        }
+
+        [[nodiscard]] auto MinimumBucketsForSize(size_type elementCount) const -> size_type {
+            if (elementCount == 0) {
+                return kDefaultBucketCount;
+            }
+            const size_type minBuckets =
+                static_cast<size_type>(static_cast<f32>(elementCount) / mMaxLoadFactor) + 1;
+            return NormalizeBucketCount(minBuckets);
+        }
+
+        // Groups are probed in triangular order, which visits every group of a power-of-two
+        // table exactly once.
+        [[nodiscard]] auto FindIndex(const TKey& key, u64 hash) const -> size_type {
+            if (mSize == 0) {
+                return kInvalidIndex;
+            }
+            const i8        h2        = H2(hash);
+            const size_type groupMask = GroupCount() - 1;
+            size_type       group     = H1(hash) & groupMask;
+            for (size_type step = 1; step <= GroupCount(); ++step) {
+                const size_type base = group * kGroupWidth;
+                const FGroup    probe(ControlBytes() + base);
+                for (u32 mask = probe.Match(h2); mask != 0U; mask &= mask - 1U) {
+                    const size_type index = base + static_cast<size_type>(std::countr_zero(mask));
+                    if (mKeyEqual(EntryAt(index)->first, key)) {
+                        return index;
+                    }
+                }
+                if (probe.MatchEmpty() != 0U) {
+                    return kInvalidIndex;
+                }
+                group = (group + step) & groupMask;
+            }
+            return kInvalidIndex;
+        }
+
+        [[nodiscard]] auto FindFirstNonFull(u64 hash) const -> size_type {
+            const size_type groupMask = GroupCount() - 1;
+            size_type       group     = H1(hash) & groupMask;
+            for (size_type step = 1;; ++step) {
+                const u32 mask = FGroup(ControlBytes() + group * kGroupWidth).MatchEmptyOrDeleted();
+                if (mask != 0U) {
+                    return group * kGroupWidth + static_cast<size_type>(std::countr_zero(mask));
+                }
+                group = (group + step) & groupMask;
+            }
+        }
+
+        template <typename TKeyArg, typename... TArgs>
+        auto TryEmplaceImpl(TKeyArg&& key, TArgs&&... args) -> InsertResult {
+            const u64       hash  = HashOf(key);
+            const size_type index = FindIndex(key, hash);
+            if (index != kInvalidIndex) {
+                return { iterator(this, index), false };
+            }
+            TValue value(Forward<TArgs>(args)...);
+            return { iterator(this, InsertNew(hash, TKey(Forward<TKeyArg>(key)), Move(value))),
+                true };
+        }
+
+        template <typename TKeyArg, typename TValueArg>
+        auto InsertImpl(TKeyArg&& key, TValueArg&& value) -> InsertResult {
+            TKey            candidateKey(Forward<TKeyArg>(key));
+            const u64       hash  = HashOf(candidateKey);
+            const size_type index = FindIndex(candidateKey, hash);
+            if (index != kInvalidIndex) {
+                return { iterator(this, index), false };
+            }
+            TValue candidateValue(Forward<TValueArg>(value));
+            return { iterator(this, InsertNew(hash, Move(candidateKey), Move(candidateValue))),
+                true };
+        }
+
+        // Places a key known to be absent and returns its slot.
+        auto InsertNew(u64 hash, TKey&& key, TValue&& value) -> size_type {
+            if (mBucketCount == 0) {
+                Resize(kDefaultBucketCount);
+            }
+            size_type index = FindFirstNonFull(hash);
+            if (mGrowthLeft == 0 && ControlAt(index) != Detail::kSwissDeleted) {
+                // Mostly tombstones: rebuild at the same size. Otherwise grow.
+                Resize((mSize * 2 <= GrowthLimit()) ? mBucketCount : mBucketCount * 2);
+                index = FindFirstNonFull(hash);
+            }
+            if (ControlAt(index) == Detail::kSwissEmpty) {
+                --mGrowthLeft;
+            }
+            ::new (static_cast<void*>(mStorage[index].Bytes)) value_type{ Move(key), Move(value) };
+            SetControl(index, H2(hash));
+            ++mSize;
+            return index;
+        }
+
+        void RemoveAtIndex(size_type index) {
+            DestroyEntry(index);
+            --mSize;
+
+            // A probe stops at the first group with an empty slot. If this slot's group still
+            // has one, no probe ever walked past it and the slot can become empty again
+            // instead of a tombstone.
+            if (WasNeverFull(index)) {
+                SetControl(index, Detail::kSwissEmpty);
+                ++mGrowthLeft;
+            } else {
+                SetControl(index, Detail::kSwissDeleted);
+            }
+        }
+
+        // Probing is group-aligned, so only the slot's own group matters.
+        [[nodiscard]] auto WasNeverFull(size_type index) const noexcept -> bool {
+            const size_type base = index - (index % kGroupWidth);
+            return FGroup(ControlBytes() + base).MatchEmpty() != 0U;
+        }
+
+        [[nodiscard]] auto NextOccupied(size_type index) const noexcept -> size_type {
+            while (index < mBucketCount) {
+                if ((index % kGroupWidth) == 0 && index + kGroupWidth <= mBucketCount) {
+                    const u32 full =
+                        ~FGroup(ControlBytes() + index).MatchEmptyOrDeleted() & 0xFFFFU;
+                    if (full == 0U) {
+                        index += kGroupWidth;
+                        continue;
+                    }
+                    return index + static_cast<size_type>(std::countr_zero(full));
+                }
+                if (IsFull(ControlAt(index))) {
+                    return index;
+                }
+                ++index;
+            }
+            return mBucketCount;
+        }
+
+        void Resize(size_type newBucketCount) {
+            FControlGroup* oldControl = mControl;
+            FEntryStorage* oldStorage = mStorage;
+            const size_type oldBuckets = mBucketCount;
+
+            mControl     = mControlAllocator.Allocate(newBucketCount / kGroupWidth);
+            mStorage     = mStorageAllocator.Allocate(newBucketCount);
+            mBucketCount = newBucketCount;
+            ResetControl();
+
+            if (oldControl != nullptr) {
+                const auto* oldBytes = reinterpret_cast<const i8*>(oldControl);
+                for (size_type i = 0; i < oldBuckets; ++i) {
+                    if (!IsFull(oldBytes[i])) {
+                        continue;
+                    }
+                    value_type*     entry = reinterpret_cast<value_type*>(oldStorage[i].Bytes);
+                    const u64       hash  = HashOf(entry->first);
+                    const size_type index = FindFirstNonFull(hash);
+                    ::new (static_cast<void*>(mStorage[index].Bytes))
+                        value_type{ Move(entry->first), Move(entry->second) };
+                    entry->~value_type();
+                    SetControl(index, H2(hash));
+                    --mGrowthLeft;
+                }
+                mControlAllocator.Deallocate(oldControl, oldBuckets / kGroupWidth);
+            }
+            if (oldStorage != nullptr) {
+                mStorageAllocator.Deallocate(oldStorage, oldBuckets);
+            }
+        }
+
+        void ResetControl() noexcept {
+            i8* bytes = ControlBytes();
+            for (size_type i = 0; i < mBucketCount; ++i) {
+                bytes[i] = Detail::kSwissEmpty;
+            }
+            mGrowthLeft = (mBucketCount == 0) ? 0 : GrowthLimit();
+        }
+
+        void DestroyEntry(size_type index) noexcept { EntryAt(index)->~value_type(); }
+
+        [[nodiscard]] auto EntryAt(size_type index) -> value_type* {
+            return reinterpret_cast<value_type*>(mStorage[index].Bytes);
+        }
+        [[nodiscard]] auto EntryAt(size_type index) const -> const value_type* {
+            return reinterpret_cast<const value_type*>(mStorage[index].Bytes);
+        }
+
+        void ReleaseStorage() noexcept {
+            if (mControl != nullptr) {
+                mControlAllocator.Deallocate(mControl, mBucketCount / kGroupWidth);
+                mControl = nullptr;
+            }
+            if (mStorage != nullptr) {
+                mStorageAllocator.Deallocate(mStorage, mBucketCount);
+                mStorage = nullptr;
+            }
+            mBucketCount = 0;
+            mGrowthLeft  = 0;
+        }
+
+        void MoveFrom(TSwissHashMap&& other) noexcept {
+            mControl       = other.mControl;
+            mStorage       = other.mStorage;
+            mBucketCount   = other.mBucketCount;
+            mSize          = other.mSize;
+            mGrowthLeft    = other.mGrowthLeft;
+            mMaxLoadFactor = other.mMaxLoadFactor;
+            mHasher        = Move(other.mHasher);
+            mKeyEqual      = Move(other.mKeyEqual);
+
+            other.mControl     = nullptr;
+            other.mStorage     = nullptr;
+            other.mBucketCount = 0;
+            other.mSize        = 0;
+            other.mGrowthLeft  = 0;
+        }
+
+        void CopyFrom(const TSwissHashMap& other) {
+            mMaxLoadFactor = other.mMaxLoadFactor;
+            mHasher        = other.mHasher;
+            mKeyEqual      = other.mKeyEqual;
+            if (other.mSize == 0) {
+                return;
+            }
+
+            Resize(MinimumBucketsForSize(other.mSize));
+            for (size_type i = other.NextOccupied(0); i < other.mBucketCount;
+                i              = other.NextOccupied(i + 1)) {
+                const value_type* src = other.EntryAt(i);
+                InsertNew(HashOf(src->first), TKey(src->first), TValue(src->second));
+            }
+        }
+    };
+
+} // namespace AltinaEngine::Core::Container
+
+#endif // ALTINAENGINE_CORE_PUBLIC_CONTAINER_SWISSHASHMAP_H
@@ -35,6 +35,51 @@ namespace AltinaEngine::Core::Instrumentation {
     private:
         const char*        mName;
         unsigned long long mStartMs;
+        bool               mTraced;
     };
 
+    // ---------------------------------------------------------------------------------------
+    // Hierarchical trace capture
+    //
+    // Each thread records nanosecond begin/end events into its own fixed-size ring buffer; the
+    // hot path takes no lock. Event names are stored by pointer and must outlive the capture
+    // (string literals, `FJobDescriptor::DebugLabel`, ...). Threads appear under the name set
+    // with `SetCurrentThreadName`. While no capture is active, scopes cost one relaxed load.
+    // ---------------------------------------------------------------------------------------
+
+    AE_CORE_API void BeginTraceCapture() noexcept;
+    AE_CORE_API void EndTraceCapture() noexcept;
+    AE_CORE_API auto IsTraceCaptureActive() noexcept -> bool;
+
+    // Returns false (and records nothing) when no capture is active.
+    AE_CORE_API auto BeginTraceScope(const char* name) noexcept -> bool;
+    AE_CORE_API void EndTraceScope() noexcept;
+
+    // Serialize every event recorded since the last `BeginTraceCapture` as Chrome trace JSON
+    // (loadable in chrome://tracing and ui.perfetto.dev). Unbalanced scopes at the edges of a
+    // wrapped ring buffer are trimmed or closed so nesting stays valid.
+    AE_CORE_API void WriteChromeTrace(Container::FNativeString& outJson) noexcept;
+    AE_CORE_API auto SaveChromeTrace(const FString& path) noexcept -> bool;
+
+    class FScopedTraceEvent {
+    public:
+        explicit FScopedTraceEvent(const char* name) noexcept : mActive(BeginTraceScope(name)) {}
+        ~FScopedTraceEvent() noexcept {
+            if (mActive)
+                EndTraceScope();
+        }
+
+        FScopedTraceEvent(const FScopedTraceEvent&)                    = delete;
+        auto operator=(const FScopedTraceEvent&) -> FScopedTraceEvent& = delete;
+
+    private:
+        bool mActive;
+    };
+
+#define AE_TRACE_CONCAT_INNER(a, b) a##b
+#define AE_TRACE_CONCAT(a, b) AE_TRACE_CONCAT_INNER(a, b)
+#define AE_TRACE_SCOPE(name)                                                 \
+    ::AltinaEngine::Core::Instrumentation::FScopedTraceEvent AE_TRACE_CONCAT( \
+        aeTraceScope_, __LINE__)(name)
+
 } // namespace AltinaEngine::Core::Instrumentation
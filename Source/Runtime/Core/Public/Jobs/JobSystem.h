@@ -6,6 +6,7 @@
 #include "../Threading/Event.h"
 #include "../Container/Function.h"
 #include "../Container/String.h"
+#include "../Container/Name.h"
 
 using AltinaEngine::i16;
 using AltinaEngine::i32;
@@ -33,6 +34,7 @@ namespace std {
 namespace AltinaEngine::Core::Jobs {
 
     // Shorten commonly used engine types in this header to keep declarations concise.
+    using Container::FName;
     using Container::FString;
     using Container::TFunction;
     using Container::TThreadSafeQueue;
@@ -44,7 +46,11 @@ namespace AltinaEngine::Core::Jobs {
     struct FWorkerPoolConfig {
         usize mMinThreads = 1;
         usize mMaxThreads = 4;
-        bool  mAllowSteal = false; // reserved for future
+        // When set, every worker owns a Chase-Lev deque and idle workers steal from random
+        // victims. Jobs submitted from a worker land on its own deque; external submissions go
+        // through a shared injector queue. The pool starts `mMinThreads` workers and grows up to
+        // `mMaxThreads` while no worker is idle; surplus workers retire after idling.
+        bool  mAllowSteal = false;
     };
 
     // Named thread identifiers (used as affinity mask bits). Consumers can set
@@ -71,6 +77,8 @@ namespace AltinaEngine::Core::Jobs {
 
     // A lightweight opaque handle to a submitted job. Handles are cheap value types
     // that can be used to wait for completion, query state, or form dependencies.
+    // The id packs a recycled slot index with its generation; once the job has completed
+    // the slot may be reused and the stale handle keeps reporting "completed".
     struct FJobHandle {
         u64 mId = 0ULL;
 
@@ -119,12 +127,12 @@ namespace AltinaEngine::Core::Jobs {
         TFunction<void()> Callback;
         void*             Payload    = nullptr; // optional user data
         const char*       DebugLabel = nullptr;
-        FString           TaskName;
+        FName             TaskName;
         AltinaEngine::u32 AffinityMask =
             0; // mapping to named thread / pool ids (implementation-defined)
         int                 Priority = 0; // advisory priority
-        // List of job handles this job depends on. The runtime will wait for
-        // each prerequisite to complete before executing this job's callback.
+        // List of job handles this job depends on. The job is only dispatched once every
+        // prerequisite has completed; no thread blocks while it waits.
         TVector<FJobHandle> Prerequisites;
     };
 
@@ -152,6 +160,9 @@ namespace AltinaEngine::Core::Jobs {
         // registered game thread to execute pending tasks targeted at it.
         AE_CORE_API void ProcessGameThreadJobs() noexcept;
 
+        // The pool `Submit` dispatches to. Created on first use.
+        AE_CORE_API auto GetDefaultWorkerPool() noexcept -> FWorkerPool*;
+
         // Create/destroy worker pools (optional convenience)
         AE_CORE_API auto CreateWorkerPool(const FWorkerPoolConfig& cfg) noexcept -> FWorkerPool*;
         AE_CORE_API void DestroyWorkerPool(FWorkerPool* pool) noexcept;
@@ -176,8 +187,21 @@ namespace AltinaEngine::Core::Jobs {
 
         auto IsRunning() const noexcept -> bool { return mRunning.Load() != 0; }
 
+        // Number of live worker threads (varies between min/max in work-stealing mode).
+        [[nodiscard]] auto GetWorkerCount() const noexcept -> usize;
+
+        // Run one queued job on the calling thread, if any is available. Lets a thread that
+        // waits on pool work help out instead of blocking. Returns false if nothing ran.
+        auto               TryExecuteOne() -> bool;
+
     private:
+        struct FStealContext;
+
         void              WorkerMain();
+        void              StealWorkerMain(usize workerIndex);
+        void              PromoteDueDelayedJobs();
+        void              PushStealJob(TFunction<void()> Job, int Priority);
+        void              TrySpawnStealWorker();
 
         FWorkerPoolConfig mConfig;
         struct FJobEntry {
@@ -193,6 +217,7 @@ namespace AltinaEngine::Core::Jobs {
         FEvent                      mWakeEvent{ false, Threading::EEventResetMode::Auto };
         TVector<void*> mThreads; // opaque thread pointers (implementation hides std::thread)
         TAtomic<i32>   mRunning{ static_cast<i32>(0) };
+        FStealContext* mSteal = nullptr; // only allocated when mConfig.mAllowSteal is set
     };
 
 } // namespace AltinaEngine::Core::Jobs
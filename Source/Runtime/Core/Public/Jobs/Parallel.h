@@ -0,0 +1,78 @@
+#pragma once
+
+#include "JobSystem.h"
+
+namespace AltinaEngine::Core::Jobs {
+
+    // Counts outstanding pieces of work. `Wait` runs queued pool jobs on the calling thread
+    // while the count is non-zero instead of blocking, so waiting from a worker (nested
+    // parallelism) never deadlocks the pool.
+    class AE_CORE_API FWaitGroup {
+    public:
+        FWaitGroup() noexcept = default;
+
+        void               Add(i64 count = 1) noexcept;
+        void               Done() noexcept;
+        void               Wait() noexcept;
+        [[nodiscard]] auto IsDone() const noexcept -> bool;
+
+        FWaitGroup(const FWaitGroup&)                    = delete;
+        auto operator=(const FWaitGroup&) -> FWaitGroup& = delete;
+
+    private:
+        TAtomic<i64> mPending{ static_cast<i64>(0) };
+    };
+
+    // Grain used when callers pass 0: roughly four chunks per worker plus the caller.
+    AE_CORE_API auto GetDefaultParallelGrain(usize count) noexcept -> usize;
+
+    // Run `body(begin, end)` over [0, count). Ranges larger than `grainSize` are split in
+    // half recursively; the upper half becomes a stealable job and the caller keeps the lower
+    // half, so splitting adapts to how many workers are actually free. The calling thread
+    // participates and returns once every index has been processed. `grainSize == 0` picks a
+    // grain from the pool size. If `body` throws, ranges that have not started yet are skipped,
+    // and the first exception is rethrown on the caller after every running range has finished.
+    AE_CORE_API void ParallelForRange(
+        usize count, usize grainSize, TFunction<void(usize, usize)> body);
+
+    // Per-index convenience wrapper over ParallelForRange.
+    template <typename Fn> void ParallelFor(usize count, usize grainSize, Fn&& fn) {
+        ParallelForRange(count, grainSize, [&fn](usize begin, usize end) -> void {
+            for (usize i = begin; i < end; ++i) {
+                fn(i);
+            }
+        });
+    }
+
+    // Reduce [0, count) with `map(begin, end) -> T` per chunk and an associative
+    // `reduce(T, T) -> T`. Chunks are `grainSize` wide and folded left-to-right from
+    // `identity`, so the result is deterministic for a given grain.
+    template <typename T, typename MapFn, typename ReduceFn>
+    auto ParallelReduce(usize count, usize grainSize, T identity, MapFn&& map, ReduceFn&& reduce)
+        -> T {
+        if (count == 0) {
+            return identity;
+        }
+        const usize grain      = grainSize > 0 ? grainSize : GetDefaultParallelGrain(count);
+        const usize chunkCount = (count + grain - 1) / grain;
+        if (chunkCount == 1) {
+            return reduce(Move(identity), map(static_cast<usize>(0), count));
+        }
+
+        TVector<T> partials(chunkCount, identity);
+        ParallelForRange(chunkCount, 1, [&](usize chunkBegin, usize chunkEnd) -> void {
+            for (usize chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+                const usize begin = chunk * grain;
+                const usize end   = (begin + grain < count) ? begin + grain : count;
+                partials[chunk]   = map(begin, end);
+            }
+        });
+
+        T result = Move(identity);
+        for (usize chunk = 0; chunk < chunkCount; ++chunk) {
+            result = reduce(Move(result), Move(partials[chunk]));
+        }
+        return result;
+    }
+
+} // namespace AltinaEngine::Core::Jobs
@@ -58,6 +58,16 @@ namespace AltinaEngine::Core::Logging {
         static void Dispatch(ELogLevel Level, FStringView Category, FStringView Message);
     };
 
+    template <typename... Args>
+    void LogDebugCategory(FStringView Category, TFormatString<Args...> Format, Args&&... args) {
+        FLogger::Logf(ELogLevel::Debug, Category, Format, Forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    void LogDebugCat(FStringView Category, TFormatString<Args...> Format, Args&&... args) {
+        LogDebugCategory(Category, Format, Forward<Args>(args)...);
+    }
+
     template <typename... Args>
     void LogInfoCategory(FStringView Category, TFormatString<Args...> Format, Args&&... args) {
         FLogger::Logf(ELogLevel::Info, Category, Format, Forward<Args>(args)...);
@@ -107,6 +117,8 @@ namespace AltinaEngine {
 
     using Logging::ELogLevel;
     using Logging::FLogger;
+    using Logging::LogDebugCat;
+    using Logging::LogDebugCategory;
     using Logging::LogError;
     using Logging::LogErrorCat;
     using Logging::LogErrorCategory;
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Base/CoreAPI.h"
+#include "Container/Allocator.h"
+#include "Container/Vector.h"
+#include "Types/Aliases.h"
+#include "Types/Traits.h"
+
+using AltinaEngine::Forward;
+namespace AltinaEngine::Core::Memory {
+    namespace Container = Core::Container;
+
+    /**
+     * FFrameArena
+     * Bump allocator over chunks taken from the global allocator. Individual blocks are never
+     * freed; Reset() rewinds the whole arena. Chunks taken after the first one in a frame double
+     * in size. When a frame needed more than one chunk, Reset() replaces them with a single
+     * chunk large enough for that frame, so a steady workload stops touching the heap after a
+     * few frames. Not thread-safe: only the owning thread allocates.
+     */
+    class AE_CORE_API FFrameArena {
+    public:
+        static constexpr usize kDefaultChunkSize = 256U * 1024U;
+
+        FFrameArena() noexcept = default;
+        explicit FFrameArena(usize chunkSize) noexcept;
+        ~FFrameArena();
+
+        FFrameArena(const FFrameArena&)                    = delete;
+        auto operator=(const FFrameArena&) -> FFrameArena& = delete;
+
+        // Moving transfers every chunk; the source is left empty with its chunk size settings.
+        FFrameArena(FFrameArena&& other) noexcept;
+        auto operator=(FFrameArena&& other) noexcept -> FFrameArena&;
+
+        // Returns nullptr for zero sizes, alignments that are not a power of two, or when the
+        // heap is exhausted. An alignment of 0 means 16.
+        [[nodiscard]] auto Allocate(usize sizeBytes, usize alignment) noexcept -> void* {
+            const usize align = (alignment == 0U) ? 16U : alignment;
+            if (sizeBytes == 0U || (align & (align - 1U)) != 0U) {
+                return nullptr;
+            }
+            const usize cursor  = reinterpret_cast<usize>(mCursor);
+            const usize end     = reinterpret_cast<usize>(mEnd);
+            const usize address = (cursor + align - 1U) & ~(align - 1U);
+            if (address < cursor || address > end || sizeBytes > end - address) {
+                return AllocateSlow(sizeBytes, align);
+            }
+            mUsedBytes += address + sizeBytes - cursor;
+            mCursor = reinterpret_cast<u8*>(address + sizeBytes);
+            return reinterpret_cast<void*>(address);
+        }
+
+        void               Reset() noexcept;
+        // Returns every chunk to the heap and forgets the learned chunk size.
+        void               Release() noexcept;
+        // Raises the size of chunks taken from now on to at least `chunkSize`, as if a frame
+        // of that size had been learned. Chunks already held are kept.
+        void               GrowChunkSize(usize chunkSize) noexcept;
+
+        // Bytes handed out since the last Reset(), including alignment padding.
+        [[nodiscard]] auto GetUsedBytes() const noexcept -> usize { return mUsedBytes; }
+        [[nodiscard]] auto GetReservedBytes() const noexcept -> usize { return mReservedBytes; }
+        [[nodiscard]] auto GetChunkCount() const noexcept -> u32 { return mChunkCount; }
+
+    private:
+        struct FChunk;
+
+        auto    AllocateSlow(usize sizeBytes, usize alignment) noexcept -> void*;
+        void    FreeChunks() noexcept;
+
+        FChunk* mChunks        = nullptr;
+        u8*     mCursor        = nullptr;
+        u8*     mEnd           = nullptr;
+        usize   mUsedBytes     = 0U;
+        usize   mReservedBytes = 0U;
+        usize   mChunkSize     = kDefaultChunkSize;
+        usize   mMinChunkSize  = kDefaultChunkSize;
+        // Size of the next chunk within the current frame.
+        usize   mNextChunkSize = kDefaultChunkSize;
+        u32     mChunkCount    = 0U;
+    };
+
+    /**
+     * FFrameMemory
+     * Two arenas per thread, used in alternating frames. The engine loop calls BeginFrame() on
+     * every thread that runs frame work; it rewinds the arena of the frame before last, so a
+     * block stays valid until its thread has begun two more frames. Threads that never call
+     * BeginFrame() have no arena and TFrameAllocator falls back to the heap there.
+     */
+    class AE_CORE_API FFrameMemory {
+    public:
+        static void               BeginFrame() noexcept;
+        // Frees both arenas of the calling thread and returns it to the heap fallback.
+        static void               ShutdownThread() noexcept;
+
+        [[nodiscard]] static auto GetThreadArena() noexcept -> FFrameArena*;
+        // Number of BeginFrame() calls made by the calling thread.
+        [[nodiscard]] static auto GetThreadFrameCount() noexcept -> u64;
+    };
+
+    /**
+     * TFrameAllocator<T>
+     * Stateful container allocator over the calling thread's current frame arena, captured at
+     * construction. Deallocate is a no-op for arena blocks, so containers may be read and
+     * destroyed on any thread, but must only grow on the thread that created them and must not
+     * outlive the next frame of that thread.
+     */
+    template <typename T> struct TFrameAllocator {
+        using TValueType      = T;
+        using TPointer        = TValueType*;
+        using TConstPointer   = const TValueType*;
+        using TReference      = TValueType&;
+        using TConstReference = const TValueType&;
+        using TSizeType       = unsigned long long;
+
+        TFrameAllocator() noexcept : mArena(FFrameMemory::GetThreadArena()) {}
+        explicit TFrameAllocator(FFrameArena* arena) noexcept : mArena(arena) {}
+
+        template <typename U>
+        TFrameAllocator(const TFrameAllocator<U>& other) noexcept : mArena(other.GetArena()) {}
+
+        template <typename U> struct Rebind {
+            using TOther = TFrameAllocator<U>;
+        };
+
+        inline auto Allocate(const TSizeType n) -> TPointer {
+            if (n == 0) {
+                return nullptr;
+            }
+            if (mArena == nullptr) {
+                return Container::TAllocator<T>().Allocate(n);
+            }
+            return static_cast<TPointer>(
+                mArena->Allocate(static_cast<usize>(n) * sizeof(TValueType), alignof(TValueType)));
+        }
+
+        inline auto Allocate(const TSizeType n, TConstPointer /*hint*/) -> TPointer {
+            return Allocate(n);
+        }
+
+        inline void Deallocate(TPointer p, TSizeType n) noexcept {
+            if (mArena == nullptr) {
+                Container::TAllocator<T>().Deallocate(p, n);
+            }
+        }
+
+        template <typename... Args> void Construct(TPointer p, Args&&... args) {
+            ::new (static_cast<void*>(p)) TValueType(Forward<Args>(args)...);
+        }
+
+        void Destroy(TPointer p) noexcept {
+            if (p) {
+                p->~TValueType();
+            }
+        }
+
+        [[nodiscard]] constexpr auto MaxSize() const noexcept -> TSizeType {
+            return ~static_cast<TSizeType>(0) / sizeof(TValueType);
+        }
+
+        [[nodiscard]] auto GetArena() const noexcept -> FFrameArena* { return mArena; }
+
+        auto operator==(const TFrameAllocator& other) const noexcept -> bool {
+            return mArena == other.mArena;
+        }
+        auto operator!=(const TFrameAllocator& other) const noexcept -> bool {
+            return mArena != other.mArena;
+        }
+
+    private:
+        FFrameArena* mArena;
+    };
+
+    template <typename T> using TFrameVector = Container::TVector<T, TFrameAllocator<T>>;
+} // namespace AltinaEngine::Core::Memory
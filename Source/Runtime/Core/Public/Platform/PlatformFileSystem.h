@@ -14,7 +14,34 @@ namespace AltinaEngine::Core::Platform {
 
     AE_CORE_API auto ReadFileBytes(const FString& path, TVector<u8>& outBytes) -> bool;
     AE_CORE_API auto ReadFileTextUtf8(const FString& path, FNativeString& outText) -> bool;
+    // Writes to a sibling temp file and renames it over `path`, so readers never see a torn file.
+    AE_CORE_API auto WriteFileBytes(const FString& path, const void* data, usize sizeBytes)
+        -> bool;
     AE_CORE_API void RemoveFileIfExists(const FString& path);
+
+    // Read-only file opened for positional reads. ReadFileAt does not move a shared file
+    // pointer, so one handle may be read from any number of threads at once.
+    using FFileHandle = void*;
+
+    AE_CORE_API auto OpenFileForRead(const FString& path) -> FFileHandle;
+    AE_CORE_API void CloseFile(FFileHandle handle);
+    AE_CORE_API auto GetFileSize(FFileHandle handle) -> u64;
+    // Fails unless exactly `sizeBytes` bytes could be read at `offset`.
+    AE_CORE_API auto ReadFileAt(FFileHandle handle, u64 offset, void* outBuffer, usize sizeBytes)
+        -> bool;
+
+    // Read-only view of a whole file mapped into the address space. Pages are loaded on first
+    // access and shared with the OS file cache, so nothing is copied up front.
+    struct FFileMapping {
+        const u8* mData   = nullptr;
+        u64       mSize   = 0;
+        void*     mNative = nullptr; // Windows file-mapping object; unused elsewhere.
+    };
+
+    // The mapping stays valid after `handle` is closed. Fails for empty files.
+    AE_CORE_API auto MapFile(FFileHandle handle, FFileMapping& outMapping) -> bool;
+    AE_CORE_API void UnmapFile(FFileMapping& mapping);
+
     AE_CORE_API auto GetExecutableDir() -> FString;
     AE_CORE_API auto GetCurrentWorkingDir() -> FString;
     AE_CORE_API auto SetCurrentWorkingDir(const FString& path) -> bool;
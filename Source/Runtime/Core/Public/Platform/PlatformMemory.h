@@ -0,0 +1,50 @@
+#pragma once
+
+#include "../Base/CoreAPI.h"
+#include "../Types/Aliases.h"
+#include "Generic/GenericPlatformDecl.h"
+
+namespace AltinaEngine::Core::Platform {
+    // Every allocation made through GetGlobalMemoryAllocator() is charged to the calling thread's
+    // current tag. Frees and reallocations keep the tag the block was allocated with, no matter
+    // which thread or scope releases it.
+    enum class EMemoryTag : u8 {
+        Default = 0,
+        Core,
+        Asset,
+        Rendering,
+        Rhi,
+        Scripting,
+        Gameplay,
+        Tools,
+        Count
+    };
+
+    struct FMemoryTagStats {
+        // Bytes held by live allocations, including size-class rounding.
+        u64 mLiveBytes        = 0ULL;
+        u64 mLiveAllocations  = 0ULL;
+        // Allocations made since startup (reallocations that move count as new allocations).
+        u64 mTotalAllocations = 0ULL;
+    };
+
+    // Sums the per-thread counters. The result is a snapshot; other threads keep allocating.
+    [[nodiscard]] AE_CORE_API auto GetMemoryTagStats(EMemoryTag tag) noexcept -> FMemoryTagStats;
+
+    [[nodiscard]] AE_CORE_API auto GetCurrentMemoryTag() noexcept -> EMemoryTag;
+    // Returns the previous tag of the calling thread.
+    AE_CORE_API auto               SetCurrentMemoryTag(EMemoryTag tag) noexcept -> EMemoryTag;
+
+    class FScopedMemoryTag {
+    public:
+        explicit FScopedMemoryTag(EMemoryTag tag) noexcept
+            : mPrevious(SetCurrentMemoryTag(tag)) {}
+        ~FScopedMemoryTag() noexcept { SetCurrentMemoryTag(mPrevious); }
+
+        FScopedMemoryTag(const FScopedMemoryTag&)                    = delete;
+        auto operator=(const FScopedMemoryTag&) -> FScopedMemoryTag& = delete;
+
+    private:
+        EMemoryTag mPrevious;
+    };
+} // namespace AltinaEngine::Core::Platform
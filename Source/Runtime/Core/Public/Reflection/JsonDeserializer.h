@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Reflection/Serializer.h"
+#include "Container/HashMap.h"
 #include "Container/String.h"
 #include "Container/StringView.h"
 #include "Container/Vector.h"
@@ -8,6 +9,7 @@
 
 namespace AltinaEngine::Core::Reflection {
     using Container::FNativeString;
+    using Container::THashMap;
     using Container::FNativeStringView;
     using Container::TVector;
     namespace Json = Core::Utility::Json;
@@ -15,7 +17,10 @@ namespace AltinaEngine::Core::Reflection {
     /**
      * @brief JSON deserializer backed by Utility::Json.
      *
-     * Supports object/array traversal with field lookups and ordered reads.
+     * Supports object/array traversal with field lookups and ordered reads. Reads stream over
+     * the text with FJsonPullReader cursors; no document tree is built. Each object scope scans
+     * its keys at most once, remembering where every value starts, so lookups in any order and
+     * misses stay linear in the object size. With duplicate keys the first occurrence wins.
      */
     class AE_CORE_API FJsonDeserializer final : public IDeserializer {
     public:
@@ -54,26 +59,48 @@ namespace AltinaEngine::Core::Reflection {
             Object,
             Array
         };
+        // Reader sits on the last token consumed in this container. Search and Fields are only
+        // used by objects: the key scan cursor, and the offset of the value of every key it has
+        // passed. Keys are views into mText, or into mEscapedKeys once decoded. Pending holds
+        // the value found by TryReadFieldName, positioned on its first token.
         struct FScope {
-            EScopeType              Type    = EScopeType::Object;
-            const Json::FJsonValue* Value   = nullptr;
-            usize                   Index   = 0;
-            const Json::FJsonValue* Pending = nullptr;
+            EScopeType                         Type = EScopeType::Object;
+            Json::FJsonPullReader              Reader;
+            Json::FJsonPullReader              Search;
+            Json::FJsonPullReader              Pending;
+            THashMap<FNativeStringView, usize> Fields;
+            // Containers open around each member value.
+            u32                                MemberDepth = 0U;
+            bool                               HasPending  = false;
+            bool                               Scanned     = false;
+            bool                               Ended       = false;
+            // Whether Reader came from the enclosing cursor and must be handed back on close.
+            bool                               WriteBack = false;
         };
 
-        const Json::FJsonValue* NextValue();
-        static auto             ToNativeString(FStringView text) -> FNativeString;
+        auto                  NextValue(bool& outAttached) -> Json::FJsonPullReader*;
+        auto                  NextScalar() -> Json::FJsonPullReader*;
+        auto                  BeginScope(EScopeType type) -> bool;
+        void                  EndScope();
+        auto                  StoreKey(FNativeStringView key, FNativeStringView& outKey) -> bool;
+        static auto           ToNativeString(FStringView text) -> FNativeString;
 
         template <typename T> T ReadNumber();
 
-        Json::FJsonDocument     mDocument;
-        const Json::FJsonValue* mRoot              = nullptr;
-        bool                    mRootConsumed      = false;
-        bool                    mForceUseRootValue = false;
-        bool                    mImplicitRootArray = false;
-        usize                   mRootArrayIndex    = 0;
-        TVector<FScope>         mStack;
-        FNativeString           mError;
+        FNativeString         mText;
+        Json::FJsonPullReader mRootReader;
+        Json::FJsonPullReader mRootArrayReader;
+        Json::FJsonPullReader mDetached;
+        bool                  mHasRoot           = false;
+        bool                  mRootIsArray       = false;
+        bool                  mRootArrayEnded    = false;
+        bool                  mRootConsumed      = false;
+        bool                  mForceUseRootValue = false;
+        bool                  mImplicitRootArray = false;
+        TVector<FScope>       mStack;
+        FNativeString         mError;
+        // Decoded copies of escaped keys. Escapes in keys are rare, so its chunks stay small.
+        Memory::FFrameArena   mEscapedKeys{ 1024U };
     };
 
 } // namespace AltinaEngine::Core::Reflection
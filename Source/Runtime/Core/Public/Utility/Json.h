@@ -4,6 +4,7 @@
 #include "Container/String.h"
 #include "Container/StringView.h"
 #include "Container/Vector.h"
+#include "Memory/FrameAllocator.h"
 #include "Types/Aliases.h"
 
 namespace AltinaEngine::Core::Utility::Json {
@@ -23,22 +24,282 @@ namespace AltinaEngine::Core::Utility::Json {
     struct FJsonValue;
 
     struct FJsonPair {
-        FNativeString Key;
-        FJsonValue*   Value = nullptr;
+        FNativeStringView Key;
+        const FJsonValue* Value = nullptr;
     };
 
+    /**
+     * FJsonArray
+     * Elements of an array value, stored contiguously in the document arena. Indexing and
+     * iteration yield element pointers.
+     */
+    class FJsonArray {
+    public:
+        class FIterator {
+        public:
+            explicit FIterator(const FJsonValue* value) noexcept : mValue(value) {}
+
+            auto operator*() const noexcept -> const FJsonValue* { return mValue; }
+            auto operator++() noexcept -> FIterator&;
+            auto operator==(const FIterator& rhs) const noexcept -> bool {
+                return mValue == rhs.mValue;
+            }
+            auto operator!=(const FIterator& rhs) const noexcept -> bool {
+                return mValue != rhs.mValue;
+            }
+
+        private:
+            const FJsonValue* mValue;
+        };
+
+        FJsonArray() noexcept = default;
+        FJsonArray(const FJsonValue* elements, usize size) noexcept
+            : mElements(elements), mSize(size) {}
+
+        [[nodiscard]] auto Size() const noexcept -> usize { return mSize; }
+        [[nodiscard]] auto IsEmpty() const noexcept -> bool { return mSize == 0U; }
+        [[nodiscard]] auto operator[](usize index) const noexcept -> const FJsonValue*;
+        [[nodiscard]] auto begin() const noexcept -> FIterator { return FIterator(mElements); }
+        [[nodiscard]] auto end() const noexcept -> FIterator;
+
+    private:
+        const FJsonValue* mElements = nullptr;
+        usize             mSize     = 0U;
+    };
+
+    /**
+     * FJsonObject
+     * Members of an object value in document order, stored contiguously in the document arena.
+     * Objects with many members are followed by an open-addressed index of member slots that
+     * FindObjectValue uses instead of scanning the keys.
+     */
+    class FJsonObject {
+    public:
+        FJsonObject() noexcept = default;
+        FJsonObject(const FJsonPair* pairs, u32 size, u32 indexMask) noexcept
+            : mPairs(pairs), mSize(size), mIndexMask(indexMask) {}
+
+        [[nodiscard]] auto Size() const noexcept -> usize { return mSize; }
+        [[nodiscard]] auto IsEmpty() const noexcept -> bool { return mSize == 0U; }
+        [[nodiscard]] auto operator[](usize index) const noexcept -> const FJsonPair& {
+            return mPairs[index];
+        }
+        [[nodiscard]] auto begin() const noexcept -> const FJsonPair* { return mPairs; }
+        [[nodiscard]] auto end() const noexcept -> const FJsonPair* { return mPairs + mSize; }
+
+        // Slot i holds a member index + 1, 0 when empty. Only valid when HasIndex().
+        [[nodiscard]] auto HasIndex() const noexcept -> bool { return mIndexMask != 0U; }
+        [[nodiscard]] auto GetIndexMask() const noexcept -> u32 { return mIndexMask; }
+        [[nodiscard]] auto GetIndexSlots() const noexcept -> const u32* {
+            return reinterpret_cast<const u32*>(mPairs + mSize);
+        }
+
+    private:
+        const FJsonPair* mPairs     = nullptr;
+        u32              mSize      = 0U;
+        u32              mIndexMask = 0U;
+    };
+
+    // Trivially copyable; every value lives in the arena of the document that parsed it.
     struct AE_CORE_API FJsonValue {
-        EJsonType            Type   = EJsonType::Null;
-        double               Number = 0.0;
-        bool                 Bool   = false;
-        FNativeString        String;
-        TVector<FJsonValue*> Array;
-        TVector<FJsonPair>   Object;
+        EJsonType         Type   = EJsonType::Null;
+        bool              Bool   = false;
+        double            Number = 0.0;
+        // Points into the document's copy of the source text, with escapes decoded in place.
+        FNativeStringView String;
+        FJsonArray        Array;
+        FJsonObject       Object;
     };
 
+    inline auto FJsonArray::FIterator::operator++() noexcept -> FIterator& {
+        ++mValue;
+        return *this;
+    }
+    inline auto FJsonArray::operator[](usize index) const noexcept -> const FJsonValue* {
+        return mElements + index;
+    }
+    inline auto FJsonArray::end() const noexcept -> FIterator {
+        return FIterator(mElements + mSize);
+    }
+
+    enum class EJsonToken : u8 {
+        None,
+        BeginObject,
+        EndObject,
+        BeginArray,
+        EndArray,
+        Key,
+        String,
+        Number,
+        Bool,
+        Null,
+        End,
+        Error,
+    };
+
+    /**
+     * FJsonPullReader
+     * Streaming tokenizer over JSON text in memory. Each Next() validates and returns one token;
+     * nothing is allocated unless a string contains escapes. Key and String tokens are views
+     * into the source text, or, for strings with escapes, into a scratch buffer that the next
+     * call reuses. A reader over a mutable buffer decodes escapes in the buffer itself instead,
+     * so all of its views stay valid as long as the buffer.
+     *
+     * Readers are plain values: a copy is an independent cursor over the same text, and its
+     * current string refers to its own scratch buffer. Over a mutable buffer, only one cursor
+     * may pass each escaped string, since decoding rewrites it.
+     */
+    class AE_CORE_API FJsonPullReader {
+    public:
+        static constexpr u32 kMaxDepth = 512U;
+
+        FJsonPullReader() noexcept = default;
+        explicit FJsonPullReader(FNativeStringView text) noexcept;
+        FJsonPullReader(char* text, usize length) noexcept;
+
+        FJsonPullReader(const FJsonPullReader& other);
+        FJsonPullReader(FJsonPullReader&& other) noexcept;
+        auto operator=(const FJsonPullReader& other) -> FJsonPullReader&;
+        auto operator=(FJsonPullReader&& other) noexcept -> FJsonPullReader&;
+        ~FJsonPullReader() = default;
+
+        // Returns End once after the root value, then keeps returning End. Error is sticky.
+        auto               Next() -> EJsonToken;
+        // Skips the value starting at the current token: the whole container after Begin*, the
+        // member value after Key, nothing after a scalar. Returns false on malformed input.
+        auto               SkipValue() -> bool;
+        // Skips the rest of the innermost open container, through its closing token.
+        auto               SkipToContainerEnd() -> bool;
+        // Moves this reader onto the value whose first token starts at `offset` in the text of
+        // `other`, with `depth` containers open around it, and reads that token again. `other`
+        // must have passed that value, so a saved offset and depth can stand in for a copy of
+        // the whole cursor. Not for readers over a mutable buffer, which decode escapes once.
+        auto               SeekValue(const FJsonPullReader& other, usize offset, u32 depth)
+            -> EJsonToken;
+
+        [[nodiscard]] auto GetToken() const noexcept -> EJsonToken { return mToken; }
+        [[nodiscard]] auto GetString() const noexcept -> FNativeStringView { return mString; }
+        [[nodiscard]] auto GetNumber() const noexcept -> double { return mNumber; }
+        [[nodiscard]] auto GetBool() const noexcept -> bool { return mBool; }
+        // Number of containers open after the current token.
+        [[nodiscard]] auto GetDepth() const noexcept -> u32 { return mDepth; }
+        // Byte offsets of the current token's first character and of the first one after it.
+        [[nodiscard]] auto GetTokenOffset() const noexcept -> usize { return mTokenStart; }
+        [[nodiscard]] auto GetOffset() const noexcept -> usize { return mIndex; }
+        [[nodiscard]] auto GetError() const noexcept -> FNativeStringView;
+
+    private:
+        enum class EState : u8 {
+            Value,
+            ValueOrEndArray,
+            KeyOrEndObject,
+            AfterValue,
+            Done,
+        };
+
+        auto               ReadValue() -> EJsonToken;
+        auto               ReadKey() -> EJsonToken;
+        auto               ReadString() -> bool;
+        auto               ReadEscapedString(usize start, usize escape) -> bool;
+        auto               ReadUnicodeEscape(usize& index, u32& codepoint) -> bool;
+        auto               ReadNumber() -> bool;
+        auto               MatchLiteral(const char* literal, usize length) noexcept -> bool;
+        void               Emit(const char* data, usize size, usize& write);
+        auto               FinishValue(EJsonToken token) noexcept -> EJsonToken;
+        auto               OpenContainer(bool bObject) noexcept -> EJsonToken;
+        auto               CloseContainer(EJsonToken token) noexcept -> EJsonToken;
+        auto               Fail(const char* message) noexcept -> EJsonToken;
+        void               SkipWhitespace() noexcept;
+        void               CopyCursor(const FJsonPullReader& other) noexcept;
+        void               RebaseString(const char* scratch, usize scratchLength) noexcept;
+
+        [[nodiscard]] auto IsInObject() const noexcept -> bool {
+            const u32 level = mDepth - 1U;
+            return (mObjectBits[level >> 6U] & (1ULL << (level & 63U))) != 0ULL;
+        }
+
+        const char*        mText       = nullptr;
+        char*              mInSitu     = nullptr;
+        usize              mLength     = 0U;
+        usize              mIndex      = 0U;
+        usize              mTokenStart = 0U;
+        FNativeStringView  mString;
+        double             mNumber = 0.0;
+        const char*        mError  = nullptr;
+        u64                mObjectBits[kMaxDepth / 64U]{};
+        u32                mDepth    = 0U;
+        EJsonToken         mToken    = EJsonToken::None;
+        EState             mState    = EState::Value;
+        bool               mBool     = false;
+        bool               mSkipping = false;
+        FNativeString      mScratch;
+    };
+
+    /**
+     * SAX-style driver over FJsonPullReader. THandler provides OnNull(), OnBool(bool),
+     * OnNumber(double), OnString(FNativeStringView), OnKey(FNativeStringView), OnBeginObject(),
+     * OnEndObject(), OnBeginArray() and OnEndArray(), each returning false to stop early.
+     * Views passed to the handler are only valid during the call.
+     */
+    template <typename THandler>
+    auto ParseJsonSax(FNativeStringView text, THandler& handler, FNativeString* outError = nullptr)
+        -> bool {
+        FJsonPullReader reader(text);
+        while (true) {
+            bool bContinue = true;
+            switch (reader.Next()) {
+                case EJsonToken::BeginObject:
+                    bContinue = handler.OnBeginObject();
+                    break;
+                case EJsonToken::EndObject:
+                    bContinue = handler.OnEndObject();
+                    break;
+                case EJsonToken::BeginArray:
+                    bContinue = handler.OnBeginArray();
+                    break;
+                case EJsonToken::EndArray:
+                    bContinue = handler.OnEndArray();
+                    break;
+                case EJsonToken::Key:
+                    bContinue = handler.OnKey(reader.GetString());
+                    break;
+                case EJsonToken::String:
+                    bContinue = handler.OnString(reader.GetString());
+                    break;
+                case EJsonToken::Number:
+                    bContinue = handler.OnNumber(reader.GetNumber());
+                    break;
+                case EJsonToken::Bool:
+                    bContinue = handler.OnBool(reader.GetBool());
+                    break;
+                case EJsonToken::Null:
+                    bContinue = handler.OnNull();
+                    break;
+                case EJsonToken::End:
+                    return true;
+                default:
+                    if (outError != nullptr) {
+                        *outError = FNativeString(reader.GetError());
+                    }
+                    return false;
+            }
+            if (!bContinue) {
+                return false;
+            }
+        }
+    }
+
+    /**
+     * FJsonDocument
+     * DOM built on FJsonPullReader. Parse() copies the text into the document's arena once and
+     * parses it in place: strings and keys are views into that copy, and each array or object
+     * is a single arena block. The first arena chunk is sized from the input, so small documents
+     * stay small. Parsing again or Clear() rewinds the arena, so a reused document stops touching
+     * the heap once it has seen its largest input.
+     */
     class AE_CORE_API FJsonDocument {
     public:
-        FJsonDocument() = default;
+        FJsonDocument();
         ~FJsonDocument();
 
         FJsonDocument(const FJsonDocument&)                    = delete;
@@ -48,24 +309,41 @@ namespace AltinaEngine::Core::Utility::Json {
         auto               operator=(FJsonDocument&& other) noexcept -> FJsonDocument&;
 
         [[nodiscard]] auto Parse(FNativeStringView text) -> bool;
+        // Parses without copying: escapes are decoded inside `text`, which must outlive the
+        // values of this document.
+        [[nodiscard]] auto ParseInSitu(char* text, usize length) -> bool;
         void               Clear();
 
         [[nodiscard]] auto GetRoot() const noexcept -> const FJsonValue* { return mRoot; }
         [[nodiscard]] auto GetError() const noexcept -> FNativeStringView;
 
     private:
-        void                 DestroyValues();
+        struct FBuildFrame {
+            usize mValueBase = 0U;
+            usize mKeyBase   = 0U;
+        };
 
-        FJsonValue*          mRoot = nullptr;
-        TVector<FJsonValue*> mOwned;
-        FNativeString        mError;
+        auto                       Build(char* text, usize length) -> bool;
+        auto                       CloseArray(FJsonValue& out) -> bool;
+        auto                       CloseObject(FJsonValue& out) -> bool;
+
+        Memory::FFrameArena        mArena;
+        const FJsonValue*          mRoot = nullptr;
+        // Scratch for Build(): finished values and keys wait here until their container closes.
+        TVector<FJsonValue>        mValueStack;
+        TVector<FNativeStringView> mKeyStack;
+        TVector<FBuildFrame>       mFrameStack;
+        FNativeString              mError;
     };
 
+    AE_CORE_API auto FindObjectValue(const FJsonValue& object, FNativeStringView key)
+        -> const FJsonValue*;
     AE_CORE_API auto FindObjectValue(const FJsonValue& object, const char* key)
         -> const FJsonValue*;
     AE_CORE_API auto FindObjectValueInsensitive(const FJsonValue& object, const char* key)
         -> const FJsonValue*;
     AE_CORE_API auto GetStringValue(const FJsonValue* value, FNativeString& out) -> bool;
+    AE_CORE_API auto GetStringView(const FJsonValue* value, FNativeStringView& out) -> bool;
     AE_CORE_API auto GetNumberValue(const FJsonValue* value, double& out) -> bool;
     AE_CORE_API auto GetNumberAsU32(const FJsonValue* value, u32& out) -> bool;
     AE_CORE_API auto GetBoolValue(const FJsonValue* value, bool& out) -> bool;
@@ -2,6 +2,7 @@
 
 #include "Base/AltinaBase.h"
 #include "Container/String.h"
+#include "Container/StringView.h"
 #include "Types/Aliases.h"
 
 #include <string>
@@ -28,39 +29,43 @@
 #endif
 
 namespace AltinaEngine::Core::Utility::String {
-    [[nodiscard]] inline auto FromUtf8(const Core::Container::FNativeString& value)
+    [[nodiscard]] inline auto FromUtf8(Core::Container::FNativeStringView value)
         -> Core::Container::FString {
         Core::Container::FString out;
-        if (value.IsEmptyString()) {
+        if (value.IsEmpty()) {
             return out;
         }
 #if defined(AE_UNICODE) || defined(UNICODE) || defined(_UNICODE)
     #if AE_PLATFORM_WIN
         int wideCount = MultiByteToWideChar(
-            CP_UTF8, 0, value.GetData(), static_cast<int>(value.Length()), nullptr, 0);
+            CP_UTF8, 0, value.Data(), static_cast<int>(value.Length()), nullptr, 0);
         if (wideCount <= 0) {
             return out;
         }
         std::wstring wide(static_cast<size_t>(wideCount), L'\0');
         MultiByteToWideChar(
-            CP_UTF8, 0, value.GetData(), static_cast<int>(value.Length()), wide.data(), wideCount);
+            CP_UTF8, 0, value.Data(), static_cast<int>(value.Length()), wide.data(), wideCount);
         out.Append(wide.c_str(), wide.size());
     #else
-        out.Append(value.GetData(), value.Length());
+        out.Append(value.Data(), value.Length());
     #endif
 #else
-        out.Append(value.GetData(), value.Length());
+        out.Append(value.Data(), value.Length());
 #endif
         return out;
     }
 
+    [[nodiscard]] inline auto FromUtf8(const Core::Container::FNativeString& value)
+        -> Core::Container::FString {
+        return FromUtf8(value.ToView());
+    }
+
     [[nodiscard]] inline auto FromUtf8Bytes(const char* data, usize length)
         -> Core::Container::FString {
         if (data == nullptr || length == 0) {
             return {};
         }
-        Core::Container::FNativeString temp(data, length);
-        return FromUtf8(temp);
+        return FromUtf8(Core::Container::FNativeStringView(data, length));
     }
 
     [[nodiscard]] inline auto ToUtf8Bytes(const Core::Container::FString& value)
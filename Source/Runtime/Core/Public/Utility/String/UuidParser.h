@@ -5,12 +5,16 @@
 #include "Utility/Uuid.h"
 
 namespace AltinaEngine::Core::Utility::String {
-    [[nodiscard]] inline auto ParseUuid(const Core::Container::FNativeString& text,
-        FUuid& out) -> bool {
-        if (text.IsEmptyString()) {
+    [[nodiscard]] inline auto ParseUuid(Core::Container::FNativeStringView text, FUuid& out)
+        -> bool {
+        if (text.IsEmpty()) {
             return false;
         }
-        return FUuid::TryParse(Core::Container::FNativeStringView(text.GetData(), text.Length()),
-            out);
+        return FUuid::TryParse(text, out);
+    }
+
+    [[nodiscard]] inline auto ParseUuid(const Core::Container::FNativeString& text,
+        FUuid& out) -> bool {
+        return ParseUuid(Core::Container::FNativeStringView(text.GetData(), text.Length()), out);
     }
 } // namespace AltinaEngine::Core::Utility::String
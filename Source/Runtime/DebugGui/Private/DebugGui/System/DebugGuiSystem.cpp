@@ -8,6 +8,7 @@
 #include "Container/Vector.h"
 #include "Logging/Log.h"
 #include "Console/ConsoleVariable.h"
+#include "Instrumentation/Instrumentation.h"
 #include "Threading/Mutex.h"
 
 #include "Input/InputSystem.h"
@@ -492,6 +493,20 @@ namespace AltinaEngine::DebugGui {
                 line.AppendNumber(ext.mSceneBatchCount);
                 gui.Text(line.ToView());
 
+                if (ext.mDrawListCacheLookups > 0U) {
+                    line.Clear();
+                    line.Assign(TEXT("DrawListCache: hits="));
+                    line.AppendNumber(ext.mDrawListCacheHits);
+                    line.Append(TEXT("/"));
+                    line.AppendNumber(ext.mDrawListCacheLookups);
+                    line.Append(TEXT(" ("));
+                    line.AppendNumber(static_cast<u32>(
+                        (static_cast<u64>(ext.mDrawListCacheHits) * 100ULL)
+                        / ext.mDrawListCacheLookups));
+                    line.Append(TEXT("%)"));
+                    gui.Text(line.ToView());
+                }
+
                 const auto draw = GetLastFrameStats();
                 line.Clear();
                 line.Assign(TEXT("Draw: vtx="));
@@ -596,7 +611,13 @@ namespace AltinaEngine::DebugGui {
                 auto       cmd      = (spacePos == FString::npos) ? view : view.Substr(0, spacePos);
                 if (cmd == FStringView(TEXT("help"))) {
                     AppendLogLine(ELogLevel::Info, TEXT("DebugGui"),
-                        TEXT("Commands: help, set <cvar> <value>"));
+                        TEXT("Commands: help, set <cvar> <value>, trace start|stop|dump <file>"));
+                    return;
+                }
+
+                if (cmd == FStringView(TEXT("trace"))) {
+                    ExecuteTraceCommand(
+                        (spacePos == FString::npos) ? FStringView() : view.Substr(spacePos + 1));
                     return;
                 }
 
@@ -633,6 +654,46 @@ namespace AltinaEngine::DebugGui {
                     ELogLevel::Warning, TEXT("DebugGui"), TEXT("Unknown command. Type 'help'."));
             }
 
+            // trace start | trace stop | trace dump <file>: drive the Core trace profiler and
+            // export a Chrome/Perfetto JSON capture.
+            void ExecuteTraceCommand(FStringView args) {
+                namespace Instr = Core::Instrumentation;
+                const auto spacePos = args.Find(TEXT(' '), 0);
+                auto       sub      = (spacePos == FString::npos) ? args : args.Substr(0, spacePos);
+                if (sub == FStringView(TEXT("start"))) {
+                    Instr::BeginTraceCapture();
+                    AppendLogLine(
+                        ELogLevel::Info, TEXT("DebugGui"), TEXT("Trace capture started."));
+                    return;
+                }
+                if (sub == FStringView(TEXT("stop"))) {
+                    Instr::EndTraceCapture();
+                    AppendLogLine(
+                        ELogLevel::Info, TEXT("DebugGui"), TEXT("Trace capture stopped."));
+                    return;
+                }
+                if (sub == FStringView(TEXT("dump"))) {
+                    FString path(TEXT("AltinaTrace.json"));
+                    if (spacePos != FString::npos) {
+                        path = FString(args.Substr(spacePos + 1, FString::npos));
+                    }
+                    if (Instr::IsTraceCaptureActive()) {
+                        Instr::EndTraceCapture();
+                    }
+                    if (Instr::SaveChromeTrace(path)) {
+                        FString line(TEXT("Trace written to "));
+                        line.Append(path);
+                        AppendLogLine(ELogLevel::Info, TEXT("DebugGui"), line.ToView());
+                    } else {
+                        AppendLogLine(ELogLevel::Warning, TEXT("DebugGui"),
+                            TEXT("Failed to write trace file."));
+                    }
+                    return;
+                }
+                AppendLogLine(ELogLevel::Warning, TEXT("DebugGui"),
+                    TEXT("Usage: trace start|stop|dump <file>"));
+            }
+
             void DrawCVarsWindow(FDebugGuiContext& gui, const FGuiInput& input) {
                 if (!gui.BeginWindow(TEXT("DebugGui CVars"), nullptr)) {
                     return;
@@ -63,11 +63,13 @@ namespace AltinaEngine::DebugGui {
     };
 
     struct FDebugGuiExternalStats {
-        u64 mFrameIndex      = 0ULL;
-        u32 mViewCount       = 0U;
-        u32 mSceneBatchCount = 0U;
-        u32 mDpi             = 96U;
-        f32 mDpiScale        = 1.0f;
+        u64 mFrameIndex           = 0ULL;
+        u32 mViewCount            = 0U;
+        u32 mSceneBatchCount      = 0U;
+        u32 mDrawListCacheHits    = 0U; // visible meshes whose retained draw items were reused
+        u32 mDrawListCacheLookups = 0U; // visible meshes over all retained passes
+        u32 mDpi                  = 96U;
+        f32 mDpiScale             = 1.0f;
     };
 
     struct FTreeViewItemDesc {
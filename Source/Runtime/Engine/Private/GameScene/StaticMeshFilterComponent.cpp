@@ -41,6 +41,11 @@ namespace AltinaEngine::GameScene {
         return 0ULL;
     }
 
+    auto FStaticMeshFilterComponent::GetStaticMeshRevision() const noexcept -> u64 {
+        ResolveStaticMesh();
+        return mMeshRevision;
+    }
+
     void FStaticMeshFilterComponent::SetStaticMeshAsset(Asset::FAssetHandle handle) noexcept {
         ReleaseStaticMeshGpuResources(mStaticMesh);
         mMeshAsset          = Move(handle);
@@ -49,6 +54,7 @@ namespace AltinaEngine::GameScene {
         mStaticMesh         = {};
         mStaticMeshEntry.Reset();
         mResolvedAsset = {};
+        ++mMeshRevision;
     }
 
     void FStaticMeshFilterComponent::SetStaticMeshData(
@@ -60,6 +66,7 @@ namespace AltinaEngine::GameScene {
         mMeshResolved       = true;
         mStaticMesh         = Move(InMesh);
         mStaticMeshEntry.Reset();
+        ++mMeshRevision;
 
         // Mirror the mesh-asset conversion path: ensure GPU buffers exist so the procedural mesh is
         // drawable immediately.
@@ -86,6 +93,7 @@ namespace AltinaEngine::GameScene {
         mMeshResolved       = false;
         mStaticMesh         = {};
         mStaticMeshEntry.Reset();
+        ++mMeshRevision;
     }
 
     void FStaticMeshFilterComponent::ResolveStaticMesh() const noexcept {
@@ -110,6 +118,7 @@ namespace AltinaEngine::GameScene {
         ReleaseStaticMeshGpuResources(mStaticMesh);
         mStaticMesh = {};
         mStaticMeshEntry.Reset();
+        ++mMeshRevision;
 
         if (!mMeshAsset.IsValid()) {
             return;
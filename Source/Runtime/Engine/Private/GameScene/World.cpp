@@ -7,6 +7,7 @@
 #include "Engine/GameScene/PointLightComponent.h"
 #include "Engine/GameScene/SkyCubeComponent.h"
 #include "Engine/GameScene/StaticMeshFilterComponent.h"
+#include "Jobs/Parallel.h"
 #include "Reflection/Serializer.h"
 #include "Utility/Json.h"
 #include "Utility/Assert.h"
@@ -282,6 +283,7 @@ namespace AltinaEngine::GameScene {
         obj->SetId(id);
         obj->SetName(name);
         obj->SetActive(true);
+        MarkTransformHierarchyDirty();
         return id;
     }
 
@@ -313,6 +315,7 @@ namespace AltinaEngine::GameScene {
         obj->SetWorld(this);
         obj->SetId(fixedId);
         obj->SetActive(true);
+        MarkTransformHierarchyDirty();
 
         const auto count = static_cast<u32>(mFreeGameObjects.Size());
         for (u32 i = 0U; i < count; ++i) {
@@ -353,6 +356,7 @@ namespace AltinaEngine::GameScene {
             slot.Generation = 1;
         }
         mFreeGameObjects.PushBack(id.Index);
+        MarkTransformHierarchyDirty();
     }
 
     auto FWorld::IsAlive(FGameObjectId id) const noexcept -> bool {
@@ -478,20 +482,168 @@ namespace AltinaEngine::GameScene {
     }
 
     void FWorld::UpdateTransforms() {
-        ++mTransformUpdateId;
-        if (mTransformUpdateId == 0) {
-            mTransformUpdateId = 1;
+        if (mTransformHierarchyDirty) {
+            RebuildTransformHierarchy();
+        }
+
+        // Levels narrower than this are cheaper to walk inline than to split across workers.
+        constexpr usize kParallelLevelThreshold = 4096U;
+        constexpr usize kParallelGrain          = 1024U;
+
+        auto&       hierarchy  = mTransformHierarchy;
+        const usize levelCount = hierarchy.LevelOffsets.IsEmpty()
+                  ? 0U
+                  : hierarchy.LevelOffsets.Size() - 1U;
+        for (usize level = 0U; level < levelCount; ++level) {
+            const usize levelBegin = hierarchy.LevelOffsets[level];
+            const usize levelEnd   = hierarchy.LevelOffsets[level + 1U];
+
+            auto updateRange = [&hierarchy, levelBegin](usize first, usize last) -> void {
+                for (usize node = levelBegin + first; node < levelBegin + last; ++node) {
+                    FGameObject* obj          = hierarchy.Objects[node];
+                    const u32    parent       = hierarchy.Parents[node];
+                    const bool   parentMoved  = parent != FTransformHierarchy::kNoParent
+                          && hierarchy.Changed[parent] != 0U;
+                    const bool   shouldUpdate = obj->IsTransformDirty() || parentMoved;
+                    if (shouldUpdate) {
+                        if (parent != FTransformHierarchy::kNoParent) {
+                            obj->UpdateWorldTransform(hierarchy.WorldTransforms[parent]);
+                        } else {
+                            obj->UpdateWorldTransform();
+                        }
+                        hierarchy.WorldTransforms[node] = obj->GetWorldTransform();
+                    }
+                    hierarchy.Changed[node] = shouldUpdate ? 1U : 0U;
+                }
+            };
+
+            const usize levelSize = levelEnd - levelBegin;
+            if (levelSize >= kParallelLevelThreshold) {
+                Core::Jobs::ParallelForRange(levelSize, kParallelGrain, updateRange);
+            } else {
+                updateRange(0U, levelSize);
+            }
         }
+    }
 
-        for (u32 index = 0; index < static_cast<u32>(mGameObjects.Size()); ++index) {
-            if (!mGameObjects[index].Alive) {
+    void FWorld::RebuildTransformHierarchy() {
+        constexpr u32 kNoSlot     = ~0U;
+        constexpr u32 kUnvisited  = ~0U;
+        constexpr u32 kInProgress = ~0U - 1U;
+
+        const u32     slotCount = static_cast<u32>(mGameObjects.Size());
+        TVector<u32>  parentSlots;
+        TVector<u32>  depths;
+        parentSlots.Resize(slotCount);
+        depths.Resize(slotCount);
+
+        u32 aliveCount = 0U;
+        for (u32 slot = 0U; slot < slotCount; ++slot) {
+            depths[slot]      = kUnvisited;
+            parentSlots[slot] = kNoSlot;
+            if (!mGameObjects[slot].Alive) {
                 continue;
             }
-            FGameObjectId id{};
-            id.Index      = index;
-            id.Generation = mGameObjects[index].Generation;
-            id.WorldId    = mWorldId;
-            (void)UpdateTransformRecursive(id, mTransformUpdateId);
+            ++aliveCount;
+            const auto parent = mGameObjects[slot].Handle.Get()->GetParent();
+            if (parent.IsValid() && IsAlive(parent)) {
+                parentSlots[slot] = parent.Index;
+            }
+        }
+
+        // Resolve depths iteratively so deep chains cannot overflow the stack. A parent cycle
+        // is broken by treating the node that closes it as a root.
+        u32          maxDepth = 0U;
+        TVector<u32> path;
+        for (u32 slot = 0U; slot < slotCount; ++slot) {
+            if (!mGameObjects[slot].Alive || depths[slot] != kUnvisited) {
+                continue;
+            }
+
+            path.Clear();
+            u32 current   = slot;
+            u32 baseDepth = 0U;
+            while (true) {
+                depths[current] = kInProgress;
+                path.PushBack(current);
+
+                const u32 parentSlot = parentSlots[current];
+                if (parentSlot == kNoSlot) {
+                    break;
+                }
+                if (depths[parentSlot] == kInProgress) {
+                    parentSlots[current] = kNoSlot;
+                    break;
+                }
+                if (depths[parentSlot] != kUnvisited) {
+                    baseDepth = depths[parentSlot] + 1U;
+                    break;
+                }
+                current = parentSlot;
+            }
+
+            for (usize i = path.Size(); i > 0U; --i) {
+                depths[path[i - 1U]] = baseDepth;
+                maxDepth             = (baseDepth > maxDepth) ? baseDepth : maxDepth;
+                ++baseDepth;
+            }
+        }
+
+        auto& hierarchy = mTransformHierarchy;
+        hierarchy.LevelOffsets.Clear();
+        hierarchy.Objects.Clear();
+        hierarchy.Parents.Clear();
+        hierarchy.WorldTransforms.Clear();
+        hierarchy.Changed.Clear();
+        mTransformHierarchyDirty = false;
+        if (aliveCount == 0U) {
+            return;
+        }
+
+        // Counting sort by depth; slot order is kept within a level.
+        hierarchy.LevelOffsets.Resize(static_cast<usize>(maxDepth) + 2U);
+        for (auto& offset : hierarchy.LevelOffsets) {
+            offset = 0U;
+        }
+        for (u32 slot = 0U; slot < slotCount; ++slot) {
+            if (mGameObjects[slot].Alive) {
+                ++hierarchy.LevelOffsets[depths[slot] + 1U];
+            }
+        }
+        for (usize level = 1U; level < hierarchy.LevelOffsets.Size(); ++level) {
+            hierarchy.LevelOffsets[level] += hierarchy.LevelOffsets[level - 1U];
+        }
+
+        TVector<u32> cursor;
+        TVector<u32> nodeOfSlot;
+        cursor.Resize(static_cast<usize>(maxDepth) + 1U);
+        nodeOfSlot.Resize(slotCount);
+        for (u32 level = 0U; level <= maxDepth; ++level) {
+            cursor[level] = hierarchy.LevelOffsets[level];
+        }
+        for (u32 slot = 0U; slot < slotCount; ++slot) {
+            if (mGameObjects[slot].Alive) {
+                nodeOfSlot[slot] = cursor[depths[slot]]++;
+            }
+        }
+
+        hierarchy.Objects.Resize(aliveCount);
+        hierarchy.Parents.Resize(aliveCount);
+        hierarchy.WorldTransforms.Resize(aliveCount);
+        hierarchy.Changed.Resize(aliveCount);
+        for (u32 slot = 0U; slot < slotCount; ++slot) {
+            if (!mGameObjects[slot].Alive) {
+                continue;
+            }
+            const u32 node       = nodeOfSlot[slot];
+            const u32 parentSlot = parentSlots[slot];
+            auto*     obj        = mGameObjects[slot].Handle.Get();
+
+            hierarchy.Objects[node] = obj;
+            hierarchy.Parents[node] =
+                (parentSlot == kNoSlot) ? FTransformHierarchy::kNoParent : nodeOfSlot[parentSlot];
+            hierarchy.WorldTransforms[node] = obj->GetWorldTransform();
+            hierarchy.Changed[node]         = 0U;
         }
     }
 
@@ -1414,6 +1566,10 @@ namespace AltinaEngine::GameScene {
     }
 
     void FWorld::OnComponentEnabledChanged(FComponentId id, FGameObjectId owner, bool enabled) {
+        if (auto* storage = FindComponentStorage(id.Type)) {
+            storage->RefreshTickState(*this, id);
+        }
+
         if (id.Type == kCameraComponentType) {
             if (enabled && IsGameObjectActive(owner)) {
                 AddActiveComponent(mActiveCameraComponents, id);
@@ -1489,6 +1645,10 @@ namespace AltinaEngine::GameScene {
                 continue;
             }
 
+            if (auto* storage = FindComponentStorage(id.Type)) {
+                storage->RefreshTickState(*this, id);
+            }
+
             if (id.Type == kCameraComponentType) {
                 if (active && ResolveComponent<FCameraComponent>(id).IsEnabled()) {
                     AddActiveComponent(mActiveCameraComponents, id);
@@ -1605,38 +1765,6 @@ namespace AltinaEngine::GameScene {
         return storage->ResolveBase(id);
     }
 
-    auto FWorld::UpdateTransformRecursive(FGameObjectId id, u32 updateId) -> bool {
-        auto* obj = ResolveGameObject(id);
-        if (obj == nullptr) {
-            return false;
-        }
-
-        if (obj->mTransformUpdateId == updateId) {
-            return obj->mTransformChangedId == updateId;
-        }
-
-        bool               parentChanged = false;
-        const auto         parentId      = obj->mParent;
-        const FGameObject* parentObj     = nullptr;
-        if (parentId.IsValid()) {
-            parentChanged = UpdateTransformRecursive(parentId, updateId);
-            parentObj     = ResolveGameObject(parentId);
-        }
-
-        const bool shouldUpdate = obj->mTransformDirty || parentChanged;
-        if (shouldUpdate) {
-            if (parentObj != nullptr) {
-                obj->UpdateWorldTransform(parentObj->GetWorldTransform());
-            } else {
-                obj->UpdateWorldTransform();
-            }
-            obj->mTransformChangedId = updateId;
-        }
-
-        obj->mTransformUpdateId = updateId;
-        return shouldUpdate;
-    }
-
     auto FWorld::FindComponentStorage(FComponentTypeHash type) const -> FComponentStorageBase* {
         auto it = mComponentStorage.FindIt(type);
         if (it == mComponentStorage.end()) {
@@ -1647,6 +1775,24 @@ namespace AltinaEngine::GameScene {
 
     void FGameObject::SetName(FStringView name) { mName = FString(name); }
 
+    void FGameObject::SetParent(FGameObjectId parent) noexcept {
+        mParent         = parent;
+        mTransformDirty = true;
+        if (mWorld != nullptr) {
+            mWorld->MarkTransformHierarchyDirty();
+        }
+    }
+
+    void FGameObject::ClearParent() noexcept {
+        mParent         = {};
+        mWorldTransform = mLocalTransform;
+        mTransformDirty = true;
+        ++mWorldTransformRevision;
+        if (mWorld != nullptr) {
+            mWorld->MarkTransformHierarchyDirty();
+        }
+    }
+
     auto FGameObject::AddComponentByType(FComponentTypeHash type) -> FComponentId {
         if (mWorld == nullptr) {
             return {};
@@ -1715,6 +1861,14 @@ namespace AltinaEngine::GameScene {
         return obj->GetWorldTransform();
     }
 
+    auto FGameObjectView::GetWorldTransformRevision() const noexcept -> u64 {
+        if (mWorld == nullptr) {
+            return 0ULL;
+        }
+        const auto* obj = mWorld->ResolveGameObject(mId);
+        return (obj != nullptr) ? obj->GetWorldTransformRevision() : 0ULL;
+    }
+
     void FGameObjectView::SetLocalTransform(const LinAlg::FSpatialTransform& transform) {
         if (mWorld == nullptr) {
             return;
@@ -69,5 +69,6 @@ namespace AltinaEngine::Engine {
 
         mFallbackMaterial.Reset();
         mMaterialCache.Clear();
+        ++mGeneration;
     }
 } // namespace AltinaEngine::Engine
@@ -1,13 +1,18 @@
 #include "Engine/Runtime/SceneBatching.h"
 
 #include "Engine/GameScene/MeshMaterialComponent.h"
+#include "Engine/Runtime/SceneCulling.h"
+#include "Engine/Runtime/SceneSpatialIndex.h"
 #include "Material/Material.h"
 #include "Material/MaterialPass.h"
 #include "Types/Conversion.h"
 #include "Algorithm/Sort.h"
 #include "Container/HashUtility.h"
 #include "Logging/Log.h"
-#include "Math/LinAlg/RenderingMath.h"
+#include "Math/Common.h"
+#include "Memory/FrameAllocator.h"
+
+#include <bit>
 
 using AltinaEngine::Move;
 namespace AltinaEngine::Engine {
@@ -15,7 +20,8 @@ namespace AltinaEngine::Engine {
         using Core::Math::FMatrix4x4f;
         using Core::Math::FVector3f;
         using Core::Math::FVector4f;
-        using RenderCore::Render::FDrawItem;
+        using Core::Memory::TFrameVector;
+        using RenderCore::Render::FDrawInstanceData;
         using RenderCore::Render::FDrawKey;
 
         auto BuildGeometryKey(const RenderCore::Geometry::FStaticMeshData* mesh, u64 geometryKey,
@@ -35,27 +41,32 @@ namespace AltinaEngine::Engine {
             return bucketKey;
         }
 
+        // Everything a mesh's cached draw items depend on besides the pass settings.
+        [[nodiscard]] auto BuildMeshSignature(const FSceneStaticMesh& entry) noexcept -> u64 {
+            u64 hash = GetInternalHash(entry.Mesh);
+            hash     = InternalHashCombine(hash, entry.MeshGeometryKey);
+            hash     = InternalHashCombine(hash, GetInternalHash(entry.Materials));
+            if (entry.Materials != nullptr) {
+                for (const auto& slot : entry.Materials->GetMaterials()) {
+                    hash = InternalHashCombine(hash, GetInternalHash(slot.Template.mUuid));
+                    hash = InternalHashCombine(hash, static_cast<u64>(slot.Template.mType));
+                    hash = InternalHashCombine(hash, slot.Parameters.GetHash());
+                }
+            }
+            return hash;
+        }
+
+        struct FSortRef {
+            FDrawKey Key{};
+            u32      Ordinal = 0U; // index into the visible meshes
+            u32      Section = 0U; // index into that mesh's cached sections
+        };
+
         struct FFrustumCullContext {
             FMatrix4x4f mViewProj = FMatrix4x4f(0.0f);
             bool        mEnabled  = false;
         };
 
-        [[nodiscard]] auto TryBuildWorldBounds(const RenderCore::Geometry::FStaticMeshData* mesh,
-            u32 lodIndex, const FMatrix4x4f& worldMatrix, FVector3f& outMinWS,
-            FVector3f& outMaxWS) noexcept -> bool {
-            if (mesh == nullptr || lodIndex >= mesh->mLods.Size()) {
-                return false;
-            }
-
-            const auto& lodBounds = mesh->mLods[lodIndex].mBounds;
-            if (!lodBounds.IsValid()) {
-                return false;
-            }
-
-            return Core::Math::LinAlg::TransformAabbToWorld(
-                worldMatrix, lodBounds.Max, lodBounds.Min, outMinWS, outMaxWS);
-        }
-
         [[nodiscard]] auto BuildFrustumCullContext(const FSceneView& view,
             const FSceneBatchBuildParams& params) noexcept -> FFrustumCullContext {
             FFrustumCullContext context{};
@@ -70,167 +81,122 @@ namespace AltinaEngine::Engine {
             return context;
         }
 
-        [[nodiscard]] auto IsVisibleInFrustum(const FVector3f& minWS, const FVector3f& maxWS,
-            const FFrustumCullContext& context) noexcept -> bool {
-            if (!context.mEnabled) {
-                return true;
-            }
-
-            const f32 xs[2] = { minWS[0], maxWS[0] };
-            const f32 ys[2] = { minWS[1], maxWS[1] };
-            const f32 zs[2] = { minWS[2], maxWS[2] };
-
-            bool      outLeft   = true;
-            bool      outRight  = true;
-            bool      outBottom = true;
-            bool      outTop    = true;
-            bool      outNear   = true;
-            bool      outFar    = true;
-
-            for (u32 xi = 0U; xi < 2U; ++xi) {
-                for (u32 yi = 0U; yi < 2U; ++yi) {
-                    for (u32 zi = 0U; zi < 2U; ++zi) {
-                        const FVector4f clip = Core::Math::MatMul(
-                            context.mViewProj, FVector4f(xs[xi], ys[yi], zs[zi], 1.0f));
-
-                        outLeft   = outLeft && (clip[0] < -clip[3]);
-                        outRight  = outRight && (clip[0] > clip[3]);
-                        outBottom = outBottom && (clip[1] < -clip[3]);
-                        outTop    = outTop && (clip[1] > clip[3]);
-                        outNear   = outNear && (clip[2] < 0.0f);
-                        outFar    = outFar && (clip[2] > clip[3]);
-                    }
-                }
-            }
-
-            if (outLeft || outRight || outBottom || outTop || outNear || outFar) {
-                return false;
-            }
-            return true;
+        [[nodiscard]] auto BuildShadowDistancePlane(
+            const FSceneView& view, const FSceneBatchBuildParams& params) noexcept -> FVector4f {
+            // View-space depth of a box's nearest point exceeds the limit exactly when the box is
+            // outside the plane -z_vs + limit >= 0.
+            const FMatrix4x4f& viewMatrix      = view.View.Matrices.View;
+            const f32          maxAllowedDepth = params.mShadowCullMaxViewDepth
+                + Core::Math::Max(params.mShadowCullViewDepthPadding, 0.0f);
+            return FVector4f(-viewMatrix(2, 0), -viewMatrix(2, 1), -viewMatrix(2, 2),
+                maxAllowedDepth - viewMatrix(2, 3));
         }
 
-        [[nodiscard]] auto IsBeyondShadowCullDistance(const FSceneView& view,
-            const FVector3f& minWS, const FVector3f& maxWS,
-            const FSceneBatchBuildParams& params) noexcept -> bool {
-            if (!params.bEnableShadowDistanceCulling || params.mShadowCullMaxViewDepth <= 0.0f) {
-                return false;
+        [[nodiscard]] auto BucketKeyLess(const RenderCore::Render::FDrawMaterialBucketKey& lhs,
+            const RenderCore::Render::FDrawMaterialBucketKey& rhs) noexcept -> bool {
+            // Same order as the leading fields of FDrawKey.
+            if (lhs.mPassKey != rhs.mPassKey) {
+                return lhs.mPassKey < rhs.mPassKey;
             }
-
-            FVector3f minVS(0.0f);
-            FVector3f maxVS(0.0f);
-            if (!Core::Math::LinAlg::TransformAabbToWorld(
-                    view.View.Matrices.View, maxWS, minWS, minVS, maxVS)) {
-                return false;
+            if (lhs.mPipelineKey != rhs.mPipelineKey) {
+                return lhs.mPipelineKey < rhs.mPipelineKey;
             }
-
-            const f32 maxAllowedDepth = params.mShadowCullMaxViewDepth
-                + Core::Math::Max(params.mShadowCullViewDepthPadding, 0.0f);
-            return minVS[2] > maxAllowedDepth;
+            return lhs.mMaterialKey < rhs.mMaterialKey;
         }
 
-        [[nodiscard]] auto ComputeWorldBoundsRadius(
-            const FVector3f& minWS, const FVector3f& maxWS) noexcept -> f32 {
-            const FVector3f extents((maxWS[0] - minWS[0]) * 0.5f, (maxWS[1] - minWS[1]) * 0.5f,
-                (maxWS[2] - minWS[2]) * 0.5f);
-            return Core::Math::Sqrt(
-                extents[0] * extents[0] + extents[1] * extents[1] + extents[2] * extents[2]);
-        }
+        struct FCullSummary {
+            u32 StaticMeshes             = 0U;
+            u32 FrustumCandidates        = 0U;
+            u32 FrustumCulled            = 0U;
+            u32 ShadowDistanceCandidates = 0U;
+            u32 ShadowDistanceCulled     = 0U;
+            u32 SmallCasterCandidates    = 0U;
+            u32 SmallCasterCulled        = 0U;
+            u32 VisibleMeshes            = 0U;
+        };
 
-        [[nodiscard]] auto IsSmallShadowCaster(const FVector3f& minWS, const FVector3f& maxWS,
-            const FSceneBatchBuildParams& params) noexcept -> bool {
-            if (!params.bEnableShadowSmallCasterCulling
-                || params.mShadowMinCasterRadiusWs <= 0.0f) {
-                return false;
+        // Scene indices of the meshes that survive culling, in ascending order.
+        void CollectVisibleMeshes(const FRenderScene& scene, const FSceneView& view,
+            const FSceneBatchBuildParams& params, FCullSummary& outSummary,
+            TFrameVector<u32>& outVisible) {
+            outSummary              = {};
+            outSummary.StaticMeshes = static_cast<u32>(scene.StaticMeshes.Size());
+            if (scene.StaticMeshes.IsEmpty()) {
+                return;
             }
 
-            return ComputeWorldBoundsRadius(minWS, maxWS) < params.mShadowMinCasterRadiusWs;
-        }
-    } // namespace
-
-    void FSceneBatchBuilder::Build(const FRenderScene& scene, const FSceneView& view,
-        const FSceneBatchBuildParams& params, FMaterialCache& materialCache,
-        RenderCore::Render::FDrawList& outDrawList) const {
-        outDrawList.Clear();
-        const TChar* debugName =
-            params.mDebugName.IsEmptyString() ? TEXT("Unnamed") : params.mDebugName.CStr();
-
-        const u32 totalStaticMeshes = static_cast<u32>(scene.StaticMeshes.Size());
-        if (scene.StaticMeshes.IsEmpty()) {
-            LogInfoCat(TEXT("Engine.SceneBatching"),
-                "Build summary: name={}, pass={}, frustumEnabled={}, shadowDistanceEnabled={}, smallCasterEnabled={}, staticMeshes=0, frustumCandidates=0, frustumCulled=0, shadowDistanceCandidates=0, shadowDistanceCulled=0, smallCasterCandidates=0, smallCasterCulled=0, visibleMeshes=0, buckets=0, batches=0, instances=0.",
-                debugName, static_cast<u32>(params.Pass), params.bEnableFrustumCulling ? 1U : 0U,
-                params.bEnableShadowDistanceCulling ? 1U : 0U,
-                params.bEnableShadowSmallCasterCulling ? 1U : 0U);
-            return;
-        }
-
-        u32        visibleMeshCount          = 0U;
-        u32        frustumCandidateCount     = 0U;
-        u32        frustumCulledCount        = 0U;
-        u32        shadowDistanceCandidates  = 0U;
-        u32        shadowDistanceCulledCount = 0U;
-        u32        smallCasterCandidates     = 0U;
-        u32        smallCasterCulledCount    = 0U;
-
-        const auto frustumContext = BuildFrustumCullContext(view, params);
-
-        usize      totalSections = 0;
-        for (const auto& entry : scene.StaticMeshes) {
-            if (entry.Mesh == nullptr) {
-                continue;
+            const auto frustumContext = BuildFrustumCullContext(view, params);
+
+            // World bounds are computed once per scene and shared by every pass; build them
+            // here only for scenes that were not produced by FSceneViewBuilder (or use another
+            // LOD).
+            FSceneBoundsSoA        localBounds{};
+            const FSceneBoundsSoA& sceneBounds = scene.GetStaticMeshBounds();
+            const FSceneBoundsSoA* bounds      = &sceneBounds;
+            if (!bounds->IsBuiltFor(scene, params.LodIndex)) {
+                BuildSceneBounds(scene, params.LodIndex, localBounds);
+                bounds = &localBounds;
             }
-            const auto& lods = entry.Mesh->mLods;
-            if (params.LodIndex >= lods.Size()) {
-                continue;
-            }
-            totalSections += lods[params.LodIndex].mSections.Size();
-        }
 
-        TVector<FDrawItem> items;
-        items.Reserve(totalSections);
-
-        for (const auto& entry : scene.StaticMeshes) {
-            if (entry.Mesh == nullptr) {
-                continue;
+            // The persistent hierarchy answers the frustum query in time proportional to what
+            // is visible; it indexes LOD 0 bounds of this exact scene build only.
+            const FSceneSpatialIndex* spatialIndex = nullptr;
+            if (bounds == &sceneBounds && scene.SpatialIndex != nullptr
+                && scene.SpatialIndex->IsSyncedWith(scene)) {
+                spatialIndex = scene.SpatialIndex;
             }
-            if (params.LodIndex >= entry.Mesh->mLods.Size()) {
-                continue;
-            }
-
-            FVector3f  minWS(0.0f);
-            FVector3f  maxWS(0.0f);
-            const bool bHasWorldBounds =
-                TryBuildWorldBounds(entry.Mesh, params.LodIndex, entry.WorldMatrix, minWS, maxWS);
 
+            FSceneVisibility visibility{};
+            InitSceneVisibility(*bounds, visibility);
             if (params.bEnableFrustumCulling) {
-                ++frustumCandidateCount;
-                if (bHasWorldBounds && !IsVisibleInFrustum(minWS, maxWS, frustumContext)) {
-                    ++frustumCulledCount;
-                    continue;
+                outSummary.FrustumCandidates = visibility.CountVisible();
+                if (frustumContext.mEnabled) {
+                    FVector4f planes[6] = { FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f),
+                        FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f) };
+                    ExtractFrustumPlanes(frustumContext.mViewProj, planes);
+                    if (spatialIndex != nullptr) {
+                        spatialIndex->QueryPlanes(planes, 6U, visibility);
+                    } else {
+                        CullSceneBoundsAgainstPlanes(*bounds, planes, 6U, visibility);
+                    }
                 }
+                outSummary.FrustumCulled = outSummary.FrustumCandidates - visibility.CountVisible();
             }
             if (params.bEnableShadowDistanceCulling) {
-                ++shadowDistanceCandidates;
-                if (bHasWorldBounds && IsBeyondShadowCullDistance(view, minWS, maxWS, params)) {
-                    ++shadowDistanceCulledCount;
-                    continue;
+                outSummary.ShadowDistanceCandidates = visibility.CountVisible();
+                if (params.mShadowCullMaxViewDepth > 0.0f) {
+                    const FVector4f plane = BuildShadowDistancePlane(view, params);
+                    CullSceneBoundsAgainstPlanes(*bounds, &plane, 1U, visibility);
                 }
+                outSummary.ShadowDistanceCulled =
+                    outSummary.ShadowDistanceCandidates - visibility.CountVisible();
             }
             if (params.bEnableShadowSmallCasterCulling) {
-                ++smallCasterCandidates;
-                if (bHasWorldBounds && IsSmallShadowCaster(minWS, maxWS, params)) {
-                    ++smallCasterCulledCount;
-                    continue;
-                }
+                outSummary.SmallCasterCandidates = visibility.CountVisible();
+                CullSceneBoundsBelowRadius(*bounds, params.mShadowMinCasterRadiusWs, visibility);
+                outSummary.SmallCasterCulled =
+                    outSummary.SmallCasterCandidates - visibility.CountVisible();
             }
-            ++visibleMeshCount;
-
-            const auto& lod = entry.Mesh->mLods[params.LodIndex];
-            if (lod.mSections.IsEmpty()) {
-                continue;
+            outSummary.VisibleMeshes = visibility.CountVisible();
+
+            outVisible.Reserve(outSummary.VisibleMeshes);
+            for (u32 word = 0U; word < static_cast<u32>(visibility.Words.Size()); ++word) {
+                u64 bits = visibility.Words[word];
+                while (bits != 0ULL) {
+                    outVisible.PushBack((word << 6U) + static_cast<u32>(std::countr_zero(bits)));
+                    bits &= bits - 1ULL;
+                }
             }
+        }
 
-            const u32 sectionCount = static_cast<u32>(lod.mSections.Size());
+        // Appends one cached section per mesh section of `entry`.
+        template <typename TSections>
+        void BuildSections(const FSceneStaticMesh& entry, const FSceneBatchBuildParams& params,
+            FMaterialCache& materialCache, TSections& outSections) {
+            const auto& lod          = entry.Mesh->mLods[params.LodIndex];
+            const u64   geometryKey  = BuildGeometryKey(
+                entry.Mesh, entry.MeshGeometryKey, params.LodIndex, lod.mPrimitiveTopology);
+            const u32   sectionCount = static_cast<u32>(lod.mSections.Size());
             for (u32 sectionIndex = 0U; sectionIndex < sectionCount; ++sectionIndex) {
                 const auto&            section  = lod.mSections[sectionIndex];
                 RenderCore::FMaterial* material = nullptr;
@@ -244,84 +210,503 @@ namespace AltinaEngine::Engine {
                     material = materialCache.ResolveDefault();
                 }
 
-                FDrawItem item{};
-                item.mMeshType             = RenderCore::Render::EDrawMeshType::StaticMesh;
-                item.mPass                 = params.Pass;
-                item.mMaterial             = material;
-                item.mStatic.mMesh         = entry.Mesh;
-                item.mStatic.mLodIndex     = params.LodIndex;
-                item.mStatic.mSectionIndex = sectionIndex;
-                item.mInstance.mWorld      = entry.WorldMatrix;
-                item.mInstance.mPrevWorld  = entry.PrevWorldMatrix;
-                item.mInstance.mObjectId   = entry.OwnerId.IsValid() ? entry.OwnerId.Index : 0U;
-
-                item.mKey.mPassKey     = static_cast<u64>(params.Pass);
-                item.mKey.mPipelineKey = GetInternalHash(
+                typename TSections::TValueType cached{};
+                cached.Key.mPassKey     = static_cast<u64>(params.Pass);
+                cached.Key.mPipelineKey = GetInternalHash(
                     material != nullptr ? material->FindPassDesc(params.Pass) : nullptr);
-                item.mKey.mMaterialKey = GetInternalHash(material);
-                item.mKey.mGeometryKey = BuildGeometryKey(
-                    entry.Mesh, entry.MeshGeometryKey, params.LodIndex, lod.mPrimitiveTopology);
-                item.mKey.mSectionKey = GetInternalHash(section);
+                cached.Key.mMaterialKey = GetInternalHash(material);
+                cached.Key.mGeometryKey = geometryKey;
+                cached.Key.mSectionKey  = GetInternalHash(section);
+                cached.Material         = material;
+                cached.SectionIndex     = sectionIndex;
+                outSections.PushBack(cached);
+            }
+        }
+
+        [[nodiscard]] auto MakeInstance(const FSceneStaticMesh& entry) -> FDrawInstanceData {
+            FDrawInstanceData instance{};
+            instance.mWorld     = entry.WorldMatrix;
+            instance.mPrevWorld = entry.PrevWorldMatrix;
+            instance.mObjectId  = entry.OwnerId.IsValid() ? entry.OwnerId.Index : 0U;
+            return instance;
+        }
 
-                items.PushBack(Move(item));
+        // Copies `source` into `target`, reusing the storage `target` already owns.
+        void CopyDrawList(
+            const RenderCore::Render::FDrawList& source, RenderCore::Render::FDrawList& target) {
+            target.mBuckets.Resize(source.mBuckets.Size());
+            for (usize b = 0U; b < source.mBuckets.Size(); ++b) {
+                const auto& sourceBucket = source.mBuckets[b];
+                auto&       targetBucket = target.mBuckets[b];
+                targetBucket.mBucketKey  = sourceBucket.mBucketKey;
+                targetBucket.mPass       = sourceBucket.mPass;
+                targetBucket.mMaterial   = sourceBucket.mMaterial;
+                targetBucket.mBatches.Resize(sourceBucket.mBatches.Size());
+                for (usize i = 0U; i < sourceBucket.mBatches.Size(); ++i) {
+                    const auto& sourceBatch = sourceBucket.mBatches[i];
+                    auto&       targetBatch = targetBucket.mBatches[i];
+                    targetBatch.mBatchKey   = sourceBatch.mBatchKey;
+                    targetBatch.mPass       = sourceBatch.mPass;
+                    targetBatch.mMaterial   = sourceBatch.mMaterial;
+                    targetBatch.mStatic     = sourceBatch.mStatic;
+                    targetBatch.mInstances.Resize(sourceBatch.mInstances.Size());
+                    for (usize n = 0U; n < sourceBatch.mInstances.Size(); ++n) {
+                        targetBatch.mInstances[n] = sourceBatch.mInstances[n];
+                    }
+                }
             }
         }
 
-        if (items.IsEmpty()) {
-            LogInfoCat(TEXT("Engine.SceneBatching"),
-                "Build summary: name={}, pass={}, frustumEnabled={}, shadowDistanceEnabled={}, smallCasterEnabled={}, staticMeshes={}, frustumCandidates={}, frustumCulled={}, shadowDistanceCandidates={}, shadowDistanceCulled={}, smallCasterCandidates={}, smallCasterCulled={}, visibleMeshes={}, buckets=0, batches=0, instances=0.",
+        void LogBuildSummary(const FSceneBatchBuildParams& params, const FCullSummary& summary,
+            const RenderCore::Render::FDrawList& drawList, u32 instanceCount) {
+            const TChar* debugName =
+                params.mDebugName.IsEmptyString() ? TEXT("Unnamed") : params.mDebugName.CStr();
+            LogDebugCat(TEXT("Engine.SceneBatching"),
+                "Build summary: name={}, pass={}, frustumEnabled={}, shadowDistanceEnabled={}, smallCasterEnabled={}, staticMeshes={}, frustumCandidates={}, frustumCulled={}, shadowDistanceCandidates={}, shadowDistanceCulled={}, smallCasterCandidates={}, smallCasterCulled={}, visibleMeshes={}, buckets={}, batches={}, instances={}.",
                 debugName, static_cast<u32>(params.Pass), params.bEnableFrustumCulling ? 1U : 0U,
                 params.bEnableShadowDistanceCulling ? 1U : 0U,
-                params.bEnableShadowSmallCasterCulling ? 1U : 0U, totalStaticMeshes,
-                frustumCandidateCount, frustumCulledCount, shadowDistanceCandidates,
-                shadowDistanceCulledCount, smallCasterCandidates, smallCasterCulledCount,
-                visibleMeshCount);
-            return;
+                params.bEnableShadowSmallCasterCulling ? 1U : 0U, summary.StaticMeshes,
+                summary.FrustumCandidates, summary.FrustumCulled, summary.ShadowDistanceCandidates,
+                summary.ShadowDistanceCulled, summary.SmallCasterCandidates,
+                summary.SmallCasterCulled, summary.VisibleMeshes, drawList.GetBucketCount(),
+                drawList.GetBatchCount(), instanceCount);
         }
+    } // namespace
+
+    void FSceneDrawListCache::Reset() {
+        mMeshes.Clear();
+        mFreeMeshes.Clear();
+        mMeshByKey.Clear();
+        // A list still shared keeps its contents for its holders.
+        if (mRetained && mRetained.UseCount() == 1U) {
+            mRetained->Clear();
+        } else {
+            mRetained.Reset();
+        }
+        mDraws.Clear();
+        mStats = {};
+    }
+
+    auto FSceneDrawListCache::GetDrawList() const noexcept -> const RenderCore::Render::FDrawList& {
+        static const RenderCore::Render::FDrawList kEmptyDrawList{};
+        return mRetained ? *mRetained : kEmptyDrawList;
+    }
 
-        Core::Algorithm::Sort(
-            items, [](const FDrawItem& lhs, const FDrawItem& rhs) { return lhs.mKey < rhs.mKey; });
+    void FSceneBatchBuilder::Build(const FRenderScene& scene, const FSceneView& view,
+        const FSceneBatchBuildParams& params, FMaterialCache& materialCache,
+        RenderCore::Render::FDrawList& outDrawList) const {
+        outDrawList.Clear();
 
-        outDrawList.mBuckets.Reserve(items.Size());
-        for (const auto& item : items) {
-            const auto bucketKey = BuildMaterialBucketKey(item.mKey);
+        // Scratch arrays below live for this build only and come from the frame arena.
+        FCullSummary      summary{};
+        TFrameVector<u32> visibleIndices;
+        CollectVisibleMeshes(scene, view, params, summary, visibleIndices);
+        const u32 visibleCount = static_cast<u32>(visibleIndices.Size());
+
+        // Visible mesh i draws transientSections[sectionOffsets[i], sectionOffsets[i + 1]).
+        using FCachedSection = FSceneDrawListCache::FCachedSection;
+        TFrameVector<FCachedSection> transientSections;
+        TFrameVector<u32>            sectionOffsets;
+        sectionOffsets.Resize(visibleCount + 1U);
+        for (u32 ordinal = 0U; ordinal < visibleCount; ++ordinal) {
+            sectionOffsets[ordinal] = static_cast<u32>(transientSections.Size());
+            BuildSections(scene.StaticMeshes[visibleIndices[ordinal]], params, materialCache,
+                transientSections);
+        }
+        sectionOffsets[visibleCount] = static_cast<u32>(transientSections.Size());
+
+        TFrameVector<FSortRef> refs;
+        refs.Reserve(transientSections.Size());
+        for (u32 ordinal = 0U; ordinal < visibleCount; ++ordinal) {
+            const u32 begin = sectionOffsets[ordinal];
+            for (u32 section = 0U; section < sectionOffsets[ordinal + 1U] - begin; ++section) {
+                refs.PushBack({ transientSections[begin + section].Key, ordinal, section });
+            }
+        }
+
+        // Ties break on scene order so the output does not depend on the sort algorithm.
+        Core::Algorithm::Sort(refs, [](const FSortRef& lhs, const FSortRef& rhs) {
+            if (lhs.Key < rhs.Key) {
+                return true;
+            }
+            if (rhs.Key < lhs.Key) {
+                return false;
+            }
+            return (lhs.Ordinal != rhs.Ordinal) ? (lhs.Ordinal < rhs.Ordinal)
+                                                : (lhs.Section < rhs.Section);
+        });
+
+        outDrawList.mBuckets.Reserve(refs.Size());
+        for (usize refIndex = 0U; refIndex < refs.Size(); ++refIndex) {
+            const auto& ref       = refs[refIndex];
+            const auto& entry     = scene.StaticMeshes[visibleIndices[ref.Ordinal]];
+            const auto& cached    = transientSections[sectionOffsets[ref.Ordinal] + ref.Section];
+            const auto  bucketKey = BuildMaterialBucketKey(cached.Key);
             if (outDrawList.mBuckets.IsEmpty()
                 || !(bucketKey == outDrawList.mBuckets.Back().mBucketKey)) {
                 RenderCore::Render::FDrawMaterialBucket bucket{};
                 bucket.mBucketKey = bucketKey;
-                bucket.mPass      = item.mPass;
-                bucket.mMaterial  = item.mMaterial;
+                bucket.mPass      = params.Pass;
+                bucket.mMaterial  = cached.Material;
                 outDrawList.mBuckets.PushBack(Move(bucket));
             }
 
             auto& bucket = outDrawList.mBuckets.Back();
             if (bucket.mBatches.IsEmpty() || !params.bAllowInstancing
-                || !(item.mKey == bucket.mBatches.Back().mBatchKey)) {
+                || !(cached.Key == bucket.mBatches.Back().mBatchKey)) {
                 RenderCore::Render::FDrawBatch batch{};
-                batch.mBatchKey = item.mKey;
-                batch.mPass     = item.mPass;
-                batch.mMaterial = item.mMaterial;
-                batch.mStatic   = item.mStatic;
-                batch.mInstances.PushBack(item.mInstance);
+                batch.mBatchKey             = cached.Key;
+                batch.mPass                 = params.Pass;
+                batch.mMaterial             = cached.Material;
+                batch.mStatic.mMesh         = entry.Mesh;
+                batch.mStatic.mLodIndex     = params.LodIndex;
+                batch.mStatic.mSectionIndex = cached.SectionIndex;
+                // The instances of a batch are adjacent in sorted order; size it once.
+                usize instanceCount         = 1U;
+                while (params.bAllowInstancing && refIndex + instanceCount < refs.Size()
+                    && refs[refIndex + instanceCount].Key == cached.Key) {
+                    ++instanceCount;
+                }
+                batch.mInstances.Reserve(instanceCount);
                 bucket.mBatches.PushBack(Move(batch));
+            }
+            bucket.mBatches.Back().mInstances.PushBack(MakeInstance(entry));
+        }
+
+        LogBuildSummary(params, summary, outDrawList, static_cast<u32>(refs.Size()));
+    }
+
+    auto FSceneBatchBuilder::Build(const FRenderScene& scene, const FSceneView& view,
+        const FSceneBatchBuildParams& params, FMaterialCache& materialCache,
+        FSceneDrawListCache& cache) const -> const RenderCore::Render::FDrawList& {
+        using FRetainedDraw = FSceneDrawListCache::FRetainedDraw;
+
+        // Scratch arrays below live for this build only and come from the frame arena; arrays
+        // kept in the cache stay on the heap.
+        FCullSummary      summary{};
+        TFrameVector<u32> visibleIndices;
+        CollectVisibleMeshes(scene, view, params, summary, visibleIndices);
+        const u32 visibleCount = static_cast<u32>(visibleIndices.Size());
+
+        if (cache.mPass != params.Pass || cache.mLodIndex != params.LodIndex
+            || cache.bAllowInstancing != params.bAllowInstancing
+            || cache.mMaterialGeneration != materialCache.GetGeneration()) {
+            cache.Reset();
+            cache.mPass               = params.Pass;
+            cache.mLodIndex           = params.LodIndex;
+            cache.bAllowInstancing    = params.bAllowInstancing;
+            cache.mMaterialGeneration = materialCache.GetGeneration();
+        }
+        if (!cache.mRetained) {
+            cache.mRetained = Container::MakeShared<RenderCore::Render::FDrawList>();
+        }
+        const u64 serial    = ++cache.mSerial;
+        auto&     stats     = cache.mStats;
+        stats               = {};
+        stats.VisibleMeshes = visibleCount;
+
+        const auto acquireMesh = [&cache](const GameScene::FComponentId& key) -> u32 {
+            u32 slot = 0U;
+            if (!cache.mFreeMeshes.IsEmpty()) {
+                slot = cache.mFreeMeshes.Back();
+                cache.mFreeMeshes.PopBack();
             } else {
-                bucket.mBatches.Back().mInstances.PushBack(item.mInstance);
+                slot = static_cast<u32>(cache.mMeshes.Size());
+                cache.mMeshes.PushBack({});
             }
+            auto& mesh             = cache.mMeshes[slot];
+            mesh.Key               = key;
+            mesh.TransformRevision = 0ULL;
+            mesh.bRetained         = false;
+            mesh.Sections.Clear();
+            return slot;
+        };
+
+        // 1. Resolve the draw state of every visible mesh, rebuilding only what changed.
+        TFrameVector<u32> slots;
+        TFrameVector<u32> transientMeshes;
+        u32               dirtyMeshes = 0U;
+        slots.Resize(visibleCount);
+        for (u32 ordinal = 0U; ordinal < visibleCount; ++ordinal) {
+            const u32   sceneIndex = visibleIndices[ordinal];
+            const auto& entry      = scene.StaticMeshes[sceneIndex];
+            const u64   signature  = BuildMeshSignature(entry);
+            const u32*  found      = entry.MeshComponentId.IsValid()
+                      ? cache.mMeshByKey.Find(entry.MeshComponentId)
+                      : nullptr;
+            // A key seen twice in one build cannot tell its meshes apart next frame.
+            const bool  bUnique    = entry.MeshComponentId.IsValid()
+                && (found == nullptr || cache.mMeshes[*found].LastUsedSerial != serial);
+            u32         slot       = 0U;
+            if (bUnique && found != nullptr && cache.mMeshes[*found].Signature == signature) {
+                slot = *found;
+                ++stats.Hits;
+            } else {
+                if (bUnique && found != nullptr) {
+                    slot = *found;
+                    cache.mMeshes[slot].Sections.Clear();
+                    ++stats.Misses;
+                } else if (bUnique) {
+                    slot                                    = acquireMesh(entry.MeshComponentId);
+                    cache.mMeshByKey[entry.MeshComponentId] = slot;
+                    ++stats.Misses;
+                } else {
+                    slot = acquireMesh(GameScene::FComponentId{});
+                    transientMeshes.PushBack(slot);
+                    ++stats.Uncached;
+                }
+                BuildSections(entry, params, materialCache, cache.mMeshes[slot].Sections);
+                cache.mMeshes[slot].BuiltSerial = serial;
+            }
+
+            // Scenes assembled by hand carry no transform revisions; rewrite those every build.
+            auto& mesh          = cache.mMeshes[slot];
+            mesh.bInstanceDirty = entry.TransformRevision == 0ULL
+                || entry.TransformRevision != mesh.TransformRevision
+                || sceneIndex != mesh.SceneIndex;
+            dirtyMeshes += mesh.bInstanceDirty ? 1U : 0U;
+            mesh.Signature         = signature;
+            mesh.LastUsedSerial    = serial;
+            mesh.TransformRevision = entry.TransformRevision;
+            mesh.SceneIndex        = sceneIndex;
+            slots[ordinal]         = slot;
         }
 
-        u32 totalInstanceCount = 0U;
-        outDrawList.ForEachBatch([&totalInstanceCount](const auto& batch) {
-            totalInstanceCount += static_cast<u32>(batch.mInstances.Size());
-        });
+        const auto drawLess = [](const FRetainedDraw& lhs, const FRetainedDraw& rhs) {
+            if (lhs.Key < rhs.Key) {
+                return true;
+            }
+            if (rhs.Key < lhs.Key) {
+                return false;
+            }
+            return (lhs.SceneIndex != rhs.SceneIndex) ? (lhs.SceneIndex < rhs.SceneIndex)
+                                                      : (lhs.Section < rhs.Section);
+        };
+
+        // 2. Keep the draws of meshes that are still visible and unchanged, in order.
+        TFrameVector<FRetainedDraw> draws;
+        bool                        bOrderKept = true;
+        draws.Reserve(cache.mDraws.Size());
+        for (const auto& draw : cache.mDraws) {
+            auto& mesh = cache.mMeshes[draw.Mesh];
+            if (mesh.LastUsedSerial != serial || mesh.BuiltSerial == serial) {
+                mesh.bRetained = false;
+                ++stats.RemovedDraws;
+                continue;
+            }
+            FRetainedDraw kept = draw;
+            kept.SceneIndex    = mesh.SceneIndex;
+            bOrderKept         = bOrderKept && (draws.IsEmpty() || !drawLess(kept, draws.Back()));
+            draws.PushBack(kept);
+        }
+
+        // 3. Draws of meshes that came into view or were rebuilt.
+        TFrameVector<FRetainedDraw> added;
+        for (u32 ordinal = 0U; ordinal < visibleCount; ++ordinal) {
+            auto& mesh = cache.mMeshes[slots[ordinal]];
+            if (mesh.bRetained && mesh.BuiltSerial != serial) {
+                continue;
+            }
+            for (u32 section = 0U; section < static_cast<u32>(mesh.Sections.Size()); ++section) {
+                added.PushBack({ mesh.Sections[section].Key, slots[ordinal], section,
+                    mesh.SceneIndex });
+            }
+            mesh.bRetained = true;
+        }
+        stats.AddedDraws       = static_cast<u32>(added.Size());
+        stats.bStructureReused = stats.RemovedDraws == 0U && added.IsEmpty() && bOrderKept;
+
+        if (!stats.bStructureReused) {
+            Core::Algorithm::Sort(added, drawLess);
+            if (!bOrderKept) {
+                for (const auto& draw : added) {
+                    draws.PushBack(draw);
+                }
+                Core::Algorithm::Sort(draws, drawLess);
+            } else if (!added.IsEmpty()) {
+                TFrameVector<FRetainedDraw> merged;
+                merged.Reserve(draws.Size() + added.Size());
+                usize keptIndex  = 0U;
+                usize addedIndex = 0U;
+                while (keptIndex < draws.Size() || addedIndex < added.Size()) {
+                    const bool bTakeAdded = keptIndex == draws.Size()
+                        || (addedIndex < added.Size()
+                            && drawLess(added[addedIndex], draws[keptIndex]));
+                    merged.PushBack(bTakeAdded ? added[addedIndex++] : draws[keptIndex++]);
+                }
+                draws = Move(merged);
+            }
+        }
+
+        // Transient meshes go back to the free list; their sections stay readable until the
+        // slot is acquired again, so this build can still emit them.
+        for (const u32 slot : transientMeshes) {
+            cache.mFreeMeshes.PushBack(slot);
+        }
+        // Culled meshes keep their entries so they hit again when they come back into view.
+        if ((serial % FSceneDrawListCache::kEvictAfterBuilds) == 0ULL) {
+            TFrameVector<GameScene::FComponentId> staleKeys;
+            for (const auto& pair : cache.mMeshByKey) {
+                const auto& mesh = cache.mMeshes[pair.second];
+                if (serial - mesh.LastUsedSerial >= FSceneDrawListCache::kEvictAfterBuilds) {
+                    staleKeys.PushBack(pair.first);
+                }
+            }
+            for (const auto& key : staleKeys) {
+                const u32 slot = *cache.mMeshByKey.Find(key);
+                cache.mMeshes[slot].Sections.Clear();
+                cache.mFreeMeshes.PushBack(slot);
+                cache.mMeshByKey.Remove(key);
+            }
+            stats.Evicted = static_cast<u32>(staleKeys.Size());
+        }
+        stats.CachedMeshes = static_cast<u32>(cache.mMeshByKey.Num());
+
+        // 4. Patch the retained list. Nothing to do when no draw moved, appeared or vanished.
+        if (stats.bStructureReused && dirtyMeshes == 0U) {
+            LogBuildSummary(params, summary, *cache.mRetained, static_cast<u32>(draws.Size()));
+            return *cache.mRetained;
+        }
+
+        if (cache.mRetained.UseCount() > 1U) {
+            // Someone still reads the last list; patch a copy of it that nobody holds anymore.
+            FSceneDrawListCache::FSharedDrawList target{};
+            for (auto& spare : cache.mSpareLists) {
+                if (spare.UseCount() == 1U) {
+                    target = Move(spare);
+                    spare  = cache.mRetained;
+                    break;
+                }
+            }
+            if (!target) {
+                target = Container::MakeShared<RenderCore::Render::FDrawList>();
+                if (cache.mSpareLists.Size() < FSceneDrawListCache::kMaxSpareDrawLists) {
+                    cache.mSpareLists.PushBack(cache.mRetained);
+                }
+            }
+            CopyDrawList(*cache.mRetained, *target);
+            cache.mRetained     = Move(target);
+            stats.bCopiedShared = true;
+        }
+
+        auto&       drawList  = *cache.mRetained;
+        const auto* oldDraws  = cache.mDraws.Data();
+        const usize drawCount = draws.Size();
+        usize       oldCursor = 0U; // first old draw of the next old batch not yet consumed
+
+        // Rewrites the instances of `batch` for draws [begin, end), skipping instances whose
+        // draw sat at the same position before and did not move.
+        const auto patchBatch = [&](RenderCore::Render::FDrawBatch& batch, usize begin, usize end,
+                                    usize oldBegin, usize oldCount) {
+            const auto& first           = draws[begin];
+            const auto& cached          = cache.mMeshes[first.Mesh].Sections[first.Section];
+            batch.mBatchKey             = first.Key;
+            batch.mPass                 = params.Pass;
+            batch.mMaterial             = cached.Material;
+            batch.mStatic.mMesh         = scene.StaticMeshes[first.SceneIndex].Mesh;
+            batch.mStatic.mLodIndex     = params.LodIndex;
+            batch.mStatic.mSectionIndex = cached.SectionIndex;
+            batch.mInstances.Resize(end - begin);
+            for (usize i = 0U; i < end - begin; ++i) {
+                const auto& draw = draws[begin + i];
+                if (i < oldCount && oldDraws[oldBegin + i].Mesh == draw.Mesh
+                    && oldDraws[oldBegin + i].Section == draw.Section
+                    && !cache.mMeshes[draw.Mesh].bInstanceDirty) {
+                    continue;
+                }
+                batch.mInstances[i] = MakeInstance(scene.StaticMeshes[draw.SceneIndex]);
+                ++stats.WrittenInstances;
+            }
+        };
+
+        // Both the old buckets/batches and the new draws are sorted by key: walk them together,
+        // moving every old bucket and batch whose key survives into place.
+        auto oldBuckets   = Move(drawList.mBuckets);
+        drawList.mBuckets = Move(cache.mScratchBuckets);
+        drawList.mBuckets.Clear();
+        usize               oldBucket = 0U;
+        TFrameVector<usize> runEnds;
+        for (usize begin = 0U; begin < drawCount;) {
+            const auto bucketKey = BuildMaterialBucketKey(draws[begin].Key);
+
+            // Batches of this bucket: runs of equal keys (single draws without instancing).
+            runEnds.Clear();
+            usize bucketEnd = begin;
+            while (bucketEnd < drawCount
+                && BuildMaterialBucketKey(draws[bucketEnd].Key) == bucketKey) {
+                usize runEnd = bucketEnd + 1U;
+                while (params.bAllowInstancing && runEnd < drawCount
+                    && draws[runEnd].Key == draws[bucketEnd].Key) {
+                    ++runEnd;
+                }
+                runEnds.PushBack(runEnd);
+                bucketEnd = runEnd;
+            }
+
+            while (oldBucket < oldBuckets.Size()
+                && BucketKeyLess(oldBuckets[oldBucket].mBucketKey, bucketKey)) {
+                for (const auto& batch : oldBuckets[oldBucket].mBatches) {
+                    oldCursor += batch.mInstances.Size();
+                }
+                ++oldBucket;
+            }
+            RenderCore::Render::FDrawMaterialBucket bucket{};
+            if (oldBucket < oldBuckets.Size() && oldBuckets[oldBucket].mBucketKey == bucketKey) {
+                bucket = Move(oldBuckets[oldBucket++]);
+            }
+            bucket.mBucketKey = bucketKey;
+            bucket.mPass      = params.Pass;
+            bucket.mMaterial  = cache.mMeshes[draws[begin].Mesh].Sections[draws[begin].Section]
+                                   .Material;
+
+            bool bSameBatches = bucket.mBatches.Size() == runEnds.Size();
+            for (usize run = 0U; bSameBatches && run < runEnds.Size(); ++run) {
+                const usize runBegin = (run == 0U) ? begin : runEnds[run - 1U];
+                bSameBatches         = bucket.mBatches[run].mBatchKey == draws[runBegin].Key;
+            }
+            if (bSameBatches) {
+                for (usize run = 0U; run < runEnds.Size(); ++run) {
+                    const usize runBegin = (run == 0U) ? begin : runEnds[run - 1U];
+                    const usize oldCount = bucket.mBatches[run].mInstances.Size();
+                    patchBatch(bucket.mBatches[run], runBegin, runEnds[run], oldCursor, oldCount);
+                    oldCursor += oldCount;
+                }
+            } else {
+                auto oldBatches = Move(bucket.mBatches);
+                bucket.mBatches.Reserve(runEnds.Size());
+                usize oldBatch = 0U;
+                for (usize run = 0U; run < runEnds.Size(); ++run) {
+                    const usize runBegin = (run == 0U) ? begin : runEnds[run - 1U];
+                    const auto& key      = draws[runBegin].Key;
+                    while (oldBatch < oldBatches.Size() && oldBatches[oldBatch].mBatchKey < key) {
+                        oldCursor += oldBatches[oldBatch++].mInstances.Size();
+                    }
+                    RenderCore::Render::FDrawBatch batch{};
+                    usize                          oldCount = 0U;
+                    if (oldBatch < oldBatches.Size() && oldBatches[oldBatch].mBatchKey == key) {
+                        oldCount = oldBatches[oldBatch].mInstances.Size();
+                        batch    = Move(oldBatches[oldBatch++]);
+                    }
+                    patchBatch(batch, runBegin, runEnds[run], oldCursor, oldCount);
+                    oldCursor += oldCount;
+                    bucket.mBatches.PushBack(Move(batch));
+                }
+                while (oldBatch < oldBatches.Size()) {
+                    oldCursor += oldBatches[oldBatch++].mInstances.Size();
+                }
+            }
+            drawList.mBuckets.PushBack(Move(bucket));
+            begin = bucketEnd;
+        }
+        oldBuckets.Clear();
+        cache.mScratchBuckets = Move(oldBuckets);
+
+        cache.mDraws.Resize(drawCount);
+        for (usize i = 0U; i < drawCount; ++i) {
+            cache.mDraws[i] = draws[i];
+        }
 
-        LogInfoCat(TEXT("Engine.SceneBatching"),
-            "Build summary: name={}, pass={}, frustumEnabled={}, shadowDistanceEnabled={}, smallCasterEnabled={}, staticMeshes={}, frustumCandidates={}, frustumCulled={}, shadowDistanceCandidates={}, shadowDistanceCulled={}, smallCasterCandidates={}, smallCasterCulled={}, visibleMeshes={}, buckets={}, batches={}, instances={}.",
-            debugName, static_cast<u32>(params.Pass), params.bEnableFrustumCulling ? 1U : 0U,
-            params.bEnableShadowDistanceCulling ? 1U : 0U,
-            params.bEnableShadowSmallCasterCulling ? 1U : 0U, totalStaticMeshes,
-            frustumCandidateCount, frustumCulledCount, shadowDistanceCandidates,
-            shadowDistanceCulledCount, smallCasterCandidates, smallCasterCulledCount,
-            visibleMeshCount, outDrawList.GetBucketCount(), outDrawList.GetBatchCount(),
-            totalInstanceCount);
+        LogBuildSummary(params, summary, drawList, static_cast<u32>(drawCount));
+        return drawList;
     }
 } // namespace AltinaEngine::Engine
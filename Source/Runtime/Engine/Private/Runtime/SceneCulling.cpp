@@ -0,0 +1,314 @@
+#include "Engine/Runtime/SceneCulling.h"
+
+#include "Geometry/StaticMeshData.h"
+#include "Math/Common.h"
+#include "Math/LinAlg/RenderingMath.h"
+
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <xmmintrin.h>
+    #define AE_SCENE_CULLING_SSE 1
+#else
+    #define AE_SCENE_CULLING_SSE 0
+#endif
+
+namespace AltinaEngine::Engine {
+    namespace {
+        using Core::Math::FMatrix4x4f;
+        using Core::Math::FVector3f;
+        using Core::Math::FVector4f;
+
+        constexpr u32 kLanes = FSceneBoundsSoA::kLaneCount;
+
+        [[nodiscard]] auto GetLaneBits(const TVector<u64>& words, u32 first) noexcept -> u32 {
+            return static_cast<u32>((words[first >> 6U] >> (first & 63U)) & 0xFULL);
+        }
+
+        void ClearLaneBits(TVector<u64>& words, u32 first, u32 laneMask) noexcept {
+            words[first >> 6U] &= ~(static_cast<u64>(laneMask) << (first & 63U));
+        }
+
+        [[nodiscard]] auto IsAffine(const FMatrix4x4f& m) noexcept -> bool {
+            return m(3, 0) == 0.0f && m(3, 1) == 0.0f && m(3, 2) == 0.0f && m(3, 3) == 1.0f;
+        }
+
+        [[nodiscard]] auto PlaneFromRows(const FMatrix4x4f& m, u32 row, f32 sign) noexcept
+            -> FVector4f {
+            return FVector4f(m(3, 0) + sign * m(row, 0), m(3, 1) + sign * m(row, 1),
+                m(3, 2) + sign * m(row, 2), m(3, 3) + sign * m(row, 3));
+        }
+
+        // Bit i set when box i of the lane group is completely outside some plane.
+        [[nodiscard]] auto ComputeOutsideMask(const FSceneBoundsSoA& bounds, u32 first,
+            const FVector4f* planes, u32 planeCount) noexcept -> u32 {
+#if AE_SCENE_CULLING_SSE
+            const __m128 cx       = _mm_loadu_ps(bounds.CenterX.Data() + first);
+            const __m128 cy       = _mm_loadu_ps(bounds.CenterY.Data() + first);
+            const __m128 cz       = _mm_loadu_ps(bounds.CenterZ.Data() + first);
+            const __m128 ex       = _mm_loadu_ps(bounds.ExtentX.Data() + first);
+            const __m128 ey       = _mm_loadu_ps(bounds.ExtentY.Data() + first);
+            const __m128 ez       = _mm_loadu_ps(bounds.ExtentZ.Data() + first);
+            const __m128 zero     = _mm_setzero_ps();
+            __m128       outside  = zero;
+            for (u32 planeIndex = 0U; planeIndex < planeCount; ++planeIndex) {
+                const FVector4f& plane = planes[planeIndex];
+                const __m128     nx    = _mm_set1_ps(plane[0]);
+                const __m128     ny    = _mm_set1_ps(plane[1]);
+                const __m128     nz    = _mm_set1_ps(plane[2]);
+
+                // Signed distance of the box's most positive corner: dot(n, c) + d + dot(|n|, e).
+                __m128           dist  = _mm_add_ps(_mm_mul_ps(nx, cx), _mm_set1_ps(plane[3]));
+                dist                   = _mm_add_ps(dist, _mm_mul_ps(ny, cy));
+                dist                   = _mm_add_ps(dist, _mm_mul_ps(nz, cz));
+                __m128 radius = _mm_mul_ps(_mm_set1_ps(Core::Math::Abs(plane[0])), ex);
+                radius = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(Core::Math::Abs(plane[1])), ey));
+                radius = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(Core::Math::Abs(plane[2])), ez));
+                outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dist, radius), zero));
+            }
+            return static_cast<u32>(_mm_movemask_ps(outside));
+#else
+            u32 mask = 0U;
+            for (u32 lane = 0U; lane < kLanes; ++lane) {
+                const u32 i = first + lane;
+                for (u32 planeIndex = 0U; planeIndex < planeCount; ++planeIndex) {
+                    const FVector4f& plane = planes[planeIndex];
+                    const f32 dist = plane[0] * bounds.CenterX[i] + plane[1] * bounds.CenterY[i]
+                        + plane[2] * bounds.CenterZ[i] + plane[3];
+                    const f32 radius = Core::Math::Abs(plane[0]) * bounds.ExtentX[i]
+                        + Core::Math::Abs(plane[1]) * bounds.ExtentY[i]
+                        + Core::Math::Abs(plane[2]) * bounds.ExtentZ[i];
+                    if (dist + radius < 0.0f) {
+                        mask |= 1U << lane;
+                        break;
+                    }
+                }
+            }
+            return mask;
+#endif
+        }
+
+        [[nodiscard]] auto ComputeSmallMask(
+            const FSceneBoundsSoA& bounds, u32 first, f32 minRadius) noexcept -> u32 {
+#if AE_SCENE_CULLING_SSE
+            const __m128 ex     = _mm_loadu_ps(bounds.ExtentX.Data() + first);
+            const __m128 ey     = _mm_loadu_ps(bounds.ExtentY.Data() + first);
+            const __m128 ez     = _mm_loadu_ps(bounds.ExtentZ.Data() + first);
+            __m128       radius = _mm_mul_ps(ex, ex);
+            radius              = _mm_add_ps(radius, _mm_mul_ps(ey, ey));
+            radius              = _mm_add_ps(radius, _mm_mul_ps(ez, ez));
+            const __m128 limit  = _mm_set1_ps(minRadius * minRadius);
+            return static_cast<u32>(_mm_movemask_ps(_mm_cmplt_ps(radius, limit)));
+#else
+            u32 mask = 0U;
+            for (u32 lane = 0U; lane < kLanes; ++lane) {
+                const u32 i      = first + lane;
+                const f32 radius = bounds.ExtentX[i] * bounds.ExtentX[i]
+                    + bounds.ExtentY[i] * bounds.ExtentY[i] + bounds.ExtentZ[i] * bounds.ExtentZ[i];
+                if (radius < minRadius * minRadius) {
+                    mask |= 1U << lane;
+                }
+            }
+            return mask;
+#endif
+        }
+
+        // Size `bounds` for `count` entries. Existing entries are kept; the padding lanes and
+        // the bits past `count` are cleared.
+        void ResizeBounds(FSceneBoundsSoA& bounds, u32 count) {
+            const u32 padded = (count + kLanes - 1U) / kLanes * kLanes;
+            const u32 words  = (padded + 63U) / 64U;
+
+            bounds.Count = count;
+            for (auto* column : { &bounds.CenterX, &bounds.CenterY, &bounds.CenterZ,
+                     &bounds.ExtentX, &bounds.ExtentY, &bounds.ExtentZ }) {
+                column->Resize(padded);
+                for (u32 i = count; i < padded; ++i) {
+                    (*column)[i] = 0.0f;
+                }
+            }
+
+            const usize oldWords = bounds.Renderable.Size();
+            bounds.Renderable.Resize(words);
+            bounds.HasBounds.Resize(words);
+            for (usize word = oldWords; word < words; ++word) {
+                bounds.Renderable[word] = 0ULL;
+                bounds.HasBounds[word]  = 0ULL;
+            }
+            if ((count & 63U) != 0U) {
+                const u64 keep = (1ULL << (count & 63U)) - 1ULL;
+                bounds.Renderable[count >> 6U] &= keep;
+                bounds.HasBounds[count >> 6U] &= keep;
+            }
+        }
+
+        void ComputeEntryBounds(
+            const FSceneStaticMesh& entry, u32 lodIndex, u32 i, FSceneBoundsSoA& outBounds) {
+            const u64 bit = 1ULL << (i & 63U);
+            outBounds.Renderable[i >> 6U] &= ~bit;
+            outBounds.HasBounds[i >> 6U] &= ~bit;
+            outBounds.CenterX[i] = outBounds.CenterY[i] = outBounds.CenterZ[i] = 0.0f;
+            outBounds.ExtentX[i] = outBounds.ExtentY[i] = outBounds.ExtentZ[i] = 0.0f;
+            if (entry.Mesh == nullptr || lodIndex >= entry.Mesh->mLods.Size()) {
+                return;
+            }
+            outBounds.Renderable[i >> 6U] |= bit;
+
+            const auto& lodBounds = entry.Mesh->mLods[lodIndex].mBounds;
+            if (!lodBounds.IsValid()) {
+                return;
+            }
+            outBounds.HasBounds[i >> 6U] |= bit;
+
+            const FMatrix4x4f& m = entry.WorldMatrix;
+            if (!IsAffine(m)) {
+                FVector3f minWS(0.0f);
+                FVector3f maxWS(0.0f);
+                (void)Core::Math::LinAlg::TransformAabbToWorld(
+                    m, lodBounds.Max, lodBounds.Min, minWS, maxWS);
+                outBounds.CenterX[i] = (minWS[0] + maxWS[0]) * 0.5f;
+                outBounds.CenterY[i] = (minWS[1] + maxWS[1]) * 0.5f;
+                outBounds.CenterZ[i] = (minWS[2] + maxWS[2]) * 0.5f;
+                outBounds.ExtentX[i] = (maxWS[0] - minWS[0]) * 0.5f;
+                outBounds.ExtentY[i] = (maxWS[1] - minWS[1]) * 0.5f;
+                outBounds.ExtentZ[i] = (maxWS[2] - minWS[2]) * 0.5f;
+                return;
+            }
+
+            // Affine world matrix: transform the center and take |M| * extents (Arvo).
+            const f32 lcx = (lodBounds.Min[0] + lodBounds.Max[0]) * 0.5f;
+            const f32 lcy = (lodBounds.Min[1] + lodBounds.Max[1]) * 0.5f;
+            const f32 lcz = (lodBounds.Min[2] + lodBounds.Max[2]) * 0.5f;
+            const f32 lex = (lodBounds.Max[0] - lodBounds.Min[0]) * 0.5f;
+            const f32 ley = (lodBounds.Max[1] - lodBounds.Min[1]) * 0.5f;
+            const f32 lez = (lodBounds.Max[2] - lodBounds.Min[2]) * 0.5f;
+
+            outBounds.CenterX[i] = m(0, 0) * lcx + m(0, 1) * lcy + m(0, 2) * lcz + m(0, 3);
+            outBounds.CenterY[i] = m(1, 0) * lcx + m(1, 1) * lcy + m(1, 2) * lcz + m(1, 3);
+            outBounds.CenterZ[i] = m(2, 0) * lcx + m(2, 1) * lcy + m(2, 2) * lcz + m(2, 3);
+            outBounds.ExtentX[i] = Core::Math::Abs(m(0, 0)) * lex
+                + Core::Math::Abs(m(0, 1)) * ley + Core::Math::Abs(m(0, 2)) * lez;
+            outBounds.ExtentY[i] = Core::Math::Abs(m(1, 0)) * lex
+                + Core::Math::Abs(m(1, 1)) * ley + Core::Math::Abs(m(1, 2)) * lez;
+            outBounds.ExtentZ[i] = Core::Math::Abs(m(2, 0)) * lex
+                + Core::Math::Abs(m(2, 1)) * ley + Core::Math::Abs(m(2, 2)) * lez;
+        }
+    } // namespace
+
+    auto FSceneVisibility::CountVisible() const noexcept -> u32 {
+        u32 count = 0U;
+        for (const u64 word : Words) {
+            count += static_cast<u32>(std::popcount(word));
+        }
+        return count;
+    }
+
+    void BuildSceneBounds(const FRenderScene& scene, u32 lodIndex, FSceneBoundsSoA& outBounds) {
+        const u32 count = static_cast<u32>(scene.StaticMeshes.Size());
+        ResizeBounds(outBounds, count);
+        for (u32 word = 0U; word < static_cast<u32>(outBounds.Renderable.Size()); ++word) {
+            outBounds.Renderable[word] = 0ULL;
+            outBounds.HasBounds[word]  = 0ULL;
+        }
+        outBounds.LodIndex    = lodIndex;
+        outBounds.SceneSerial = scene.BuildSerial;
+        for (u32 i = 0U; i < count; ++i) {
+            ComputeEntryBounds(scene.StaticMeshes[i], lodIndex, i, outBounds);
+        }
+    }
+
+    void FSceneBoundsCache::Update(FRenderScene& scene, u32 lodIndex) {
+        const u32  count       = static_cast<u32>(scene.StaticMeshes.Size());
+        // Component ids and revisions are only unique within one world.
+        const bool bInvalidated = mBounds.LodIndex != lodIndex || mWorldId != scene.WorldId;
+        const u32  keptEntries  = bInvalidated ? 0U : Core::Math::Min(count, mBounds.Count);
+
+        ResizeBounds(mBounds, count);
+        mKeys.Resize(count);
+        mWorldId            = scene.WorldId;
+        mBounds.LodIndex    = lodIndex;
+        mBounds.SceneSerial = scene.BuildSerial;
+        mLastUpdate         = {};
+        for (u32 i = 0U; i < count; ++i) {
+            const auto& entry = scene.StaticMeshes[i];
+            FEntryKey&  key   = mKeys[i];
+            if (i < keptEntries && entry.TransformRevision != 0ULL && entry.MeshRevision != 0ULL
+                && key.MeshComponentId == entry.MeshComponentId && key.Mesh == entry.Mesh
+                && key.TransformRevision == entry.TransformRevision
+                && key.MeshRevision == entry.MeshRevision) {
+                ++mLastUpdate.Reused;
+                continue;
+            }
+
+            key.MeshComponentId   = entry.MeshComponentId;
+            key.Mesh              = entry.Mesh;
+            key.TransformRevision = entry.TransformRevision;
+            key.MeshRevision      = entry.MeshRevision;
+            ComputeEntryBounds(entry, lodIndex, i, mBounds);
+            ++mLastUpdate.Updated;
+        }
+        scene.CachedStaticMeshBounds = &mBounds;
+    }
+
+    void FSceneBoundsCache::Reset() {
+        mBounds = {};
+        mKeys.Clear();
+        mWorldId    = 0U;
+        mLastUpdate = {};
+    }
+
+    void InitSceneVisibility(const FSceneBoundsSoA& bounds, FSceneVisibility& outVisibility) {
+        outVisibility.Count = bounds.Count;
+        outVisibility.Words = bounds.Renderable;
+    }
+
+    void ExtractFrustumPlanes(const FMatrix4x4f& viewProj, FVector4f (&outPlanes)[6]) {
+        outPlanes[0] = PlaneFromRows(viewProj, 0U, 1.0f);  // left:   x >= -w
+        outPlanes[1] = PlaneFromRows(viewProj, 0U, -1.0f); // right:  x <= w
+        outPlanes[2] = PlaneFromRows(viewProj, 1U, 1.0f);  // bottom: y >= -w
+        outPlanes[3] = PlaneFromRows(viewProj, 1U, -1.0f); // top:    y <= w
+        outPlanes[4] = FVector4f(
+            viewProj(2, 0), viewProj(2, 1), viewProj(2, 2), viewProj(2, 3)); // near: z >= 0
+        outPlanes[5] = PlaneFromRows(viewProj, 2U, -1.0f);                 // far:  z <= w
+    }
+
+    void CullSceneBoundsAgainstPlanes(const FSceneBoundsSoA& bounds, const FVector4f* planes,
+        u32 planeCount, FSceneVisibility& inOutVisibility) {
+        if (planeCount == 0U) {
+            return;
+        }
+        for (u32 first = 0U; first < bounds.Count; first += kLanes) {
+            if ((first & 63U) == 0U && inOutVisibility.Words[first >> 6U] == 0ULL) {
+                first += 64U - kLanes; // nothing left to cull in this word
+                continue;
+            }
+            const u32 candidates = GetLaneBits(inOutVisibility.Words, first)
+                & GetLaneBits(bounds.HasBounds, first);
+            if (candidates == 0U) {
+                continue;
+            }
+            const u32 outside = ComputeOutsideMask(bounds, first, planes, planeCount);
+            ClearLaneBits(inOutVisibility.Words, first, outside & candidates);
+        }
+    }
+
+    void CullSceneBoundsBelowRadius(
+        const FSceneBoundsSoA& bounds, f32 minRadius, FSceneVisibility& inOutVisibility) {
+        if (minRadius <= 0.0f) {
+            return;
+        }
+        for (u32 first = 0U; first < bounds.Count; first += kLanes) {
+            if ((first & 63U) == 0U && inOutVisibility.Words[first >> 6U] == 0ULL) {
+                first += 64U - kLanes; // nothing left to cull in this word
+                continue;
+            }
+            const u32 candidates = GetLaneBits(inOutVisibility.Words, first)
+                & GetLaneBits(bounds.HasBounds, first);
+            if (candidates == 0U) {
+                continue;
+            }
+            const u32 small = ComputeSmallMask(bounds, first, minRadius);
+            ClearLaneBits(inOutVisibility.Words, first, small & candidates);
+        }
+    }
+} // namespace AltinaEngine::Engine
@@ -0,0 +1,500 @@
+#include "Engine/Runtime/SceneSpatialIndex.h"
+
+#include "Math/Common.h"
+
+#include <bit>
+
+namespace AltinaEngine::Engine {
+    namespace {
+        using Core::Math::FVector3f;
+        using Core::Math::FVector4f;
+
+        // Leaf boxes are enlarged so small movements do not touch the hierarchy.
+        constexpr f32 kFatMarginScale = 0.1f;
+        constexpr f32 kFatMarginMin   = 0.05f;
+        constexpr u32 kMaxPlanes      = 32U;
+
+        template <typename TBox> [[nodiscard]] auto Union(const TBox& a, const TBox& b) -> TBox {
+            TBox out{};
+            for (u32 axis = 0U; axis < 3U; ++axis) {
+                out.Min[axis] = Core::Math::Min(a.Min[axis], b.Min[axis]);
+                out.Max[axis] = Core::Math::Max(a.Max[axis], b.Max[axis]);
+            }
+            return out;
+        }
+
+        // Half the surface area; only used to compare insertion costs.
+        template <typename TBox> [[nodiscard]] auto Area(const TBox& box) noexcept -> f32 {
+            const f32 dx = box.Max[0] - box.Min[0];
+            const f32 dy = box.Max[1] - box.Min[1];
+            const f32 dz = box.Max[2] - box.Min[2];
+            return dx * dy + dy * dz + dz * dx;
+        }
+
+        template <typename TBox>
+        [[nodiscard]] auto Contains(const TBox& outer, const TBox& inner) noexcept -> bool {
+            for (u32 axis = 0U; axis < 3U; ++axis) {
+                if (inner.Min[axis] < outer.Min[axis] || inner.Max[axis] > outer.Max[axis]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template <typename TBox> [[nodiscard]] auto Fatten(const TBox& box) noexcept -> TBox {
+            const f32 size = Core::Math::Max(box.Max[0] - box.Min[0],
+                Core::Math::Max(box.Max[1] - box.Min[1], box.Max[2] - box.Min[2]));
+            const f32 margin = size * kFatMarginScale + kFatMarginMin;
+            TBox      out    = box;
+            for (u32 axis = 0U; axis < 3U; ++axis) {
+                out.Min[axis] -= margin;
+                out.Max[axis] += margin;
+            }
+            return out;
+        }
+
+        enum class EPlaneClass : u8 {
+            Outside,
+            Intersecting,
+            Inside,
+        };
+
+        // Classify a box against the planes in `inOutMask`; planes the box is fully inside of are
+        // removed from the mask so children skip them.
+        template <typename TBox>
+        [[nodiscard]] auto ClassifyBox(const TBox& box, const FVector4f* planes,
+            u32& inOutMask) noexcept -> EPlaneClass {
+            const f32 cx   = (box.Min[0] + box.Max[0]) * 0.5f;
+            const f32 cy   = (box.Min[1] + box.Max[1]) * 0.5f;
+            const f32 cz   = (box.Min[2] + box.Max[2]) * 0.5f;
+            const f32 ex   = (box.Max[0] - box.Min[0]) * 0.5f;
+            const f32 ey   = (box.Max[1] - box.Min[1]) * 0.5f;
+            const f32 ez   = (box.Max[2] - box.Min[2]) * 0.5f;
+            u32       mask = inOutMask;
+            while (mask != 0U) {
+                const u32 planeIndex = static_cast<u32>(std::countr_zero(mask));
+                mask &= mask - 1U;
+
+                const FVector4f& plane = planes[planeIndex];
+                const f32 dist   = plane[0] * cx + plane[1] * cy + plane[2] * cz + plane[3];
+                const f32 radius = Core::Math::Abs(plane[0]) * ex
+                    + Core::Math::Abs(plane[1]) * ey + Core::Math::Abs(plane[2]) * ez;
+                if (dist + radius < 0.0f) {
+                    return EPlaneClass::Outside;
+                }
+                if (dist - radius >= 0.0f) {
+                    inOutMask &= ~(1U << planeIndex);
+                }
+            }
+            return (inOutMask == 0U) ? EPlaneClass::Inside : EPlaneClass::Intersecting;
+        }
+
+        void SetBit(FSceneVisibility& visibility, u32 index) noexcept {
+            visibility.Words[index >> 6U] |= 1ULL << (index & 63U);
+        }
+
+        [[nodiscard]] auto IsBitSet(const TVector<u64>& words, u32 index) noexcept -> bool {
+            return ((words[index >> 6U] >> (index & 63U)) & 1ULL) != 0ULL;
+        }
+
+        struct FStackEntry {
+            u32 Node      = 0U;
+            u32 PlaneMask = 0U;
+        };
+    } // namespace
+
+    void FSceneSpatialIndex::Reset() {
+        mNodes.Clear();
+        mProxies.Clear();
+        mUnindexed.Clear();
+        mProxyByKey.Clear();
+        mRoot            = kInvalidIndex;
+        mFreeList        = kInvalidIndex;
+        mSyncedMeshCount = 0U;
+        mLastSync        = {};
+    }
+
+    void FSceneSpatialIndex::Sync(FRenderScene& scene) {
+        const FSceneBoundsSoA& bounds = scene.GetStaticMeshBounds();
+        const u32              count  = static_cast<u32>(scene.StaticMeshes.Size());
+
+        ++mSerial;
+        mLastSync = {};
+        mUnindexed.Clear();
+        for (u32 i = 0U; i < count && i < bounds.Count; ++i) {
+            if (!IsBitSet(bounds.Renderable, i)) {
+                continue;
+            }
+
+            FUnindexedEntry entry{};
+            entry.SceneIndex = i;
+            entry.bHasBounds = IsBitSet(bounds.HasBounds, i);
+            if (entry.bHasBounds) {
+                entry.Bounds.Min[0] = bounds.CenterX[i] - bounds.ExtentX[i];
+                entry.Bounds.Min[1] = bounds.CenterY[i] - bounds.ExtentY[i];
+                entry.Bounds.Min[2] = bounds.CenterZ[i] - bounds.ExtentZ[i];
+                entry.Bounds.Max[0] = bounds.CenterX[i] + bounds.ExtentX[i];
+                entry.Bounds.Max[1] = bounds.CenterY[i] + bounds.ExtentY[i];
+                entry.Bounds.Max[2] = bounds.CenterZ[i] + bounds.ExtentZ[i];
+            }
+
+            const auto& key = scene.StaticMeshes[i].MeshComponentId;
+            if (!entry.bHasBounds || !key.IsValid()) {
+                mUnindexed.PushBack(entry);
+                continue;
+            }
+
+            if (u32* existing = mProxyByKey.Find(key); existing != nullptr) {
+                FProxy& proxy = mProxies[*existing];
+                if (proxy.SeenSerial == mSerial) {
+                    // Two entries share a mesh component; keep the second one out of the tree.
+                    mUnindexed.PushBack(entry);
+                    continue;
+                }
+                proxy.SeenSerial = mSerial;
+                proxy.SceneIndex = i;
+                proxy.Bounds     = entry.Bounds;
+                if (!Contains(mNodes[proxy.Leaf].Box, entry.Bounds)) {
+                    const u32 leaf = proxy.Leaf;
+                    RemoveLeaf(leaf);
+                    mNodes[leaf].Box = Fatten(entry.Bounds);
+                    InsertLeaf(leaf);
+                    ++mLastSync.Moved;
+                }
+                continue;
+            }
+
+            const u32 proxyIndex = static_cast<u32>(mProxies.Size());
+            const u32 leaf       = AllocateNode();
+            mNodes[leaf].Box     = Fatten(entry.Bounds);
+            mNodes[leaf].Proxy   = proxyIndex;
+
+            FProxy proxy{};
+            proxy.Key        = key;
+            proxy.Bounds     = entry.Bounds;
+            proxy.Leaf       = leaf;
+            proxy.SceneIndex = i;
+            proxy.SeenSerial = mSerial;
+            mProxies.PushBack(proxy);
+            mProxyByKey[key] = proxyIndex;
+            InsertLeaf(leaf);
+            ++mLastSync.Inserted;
+        }
+
+        for (u32 proxy = static_cast<u32>(mProxies.Size()); proxy > 0U; --proxy) {
+            if (mProxies[proxy - 1U].SeenSerial != mSerial) {
+                RemoveProxy(proxy - 1U);
+                ++mLastSync.Removed;
+            }
+        }
+
+        mSyncedMeshCount         = count;
+        scene.SpatialIndex       = this;
+        scene.SpatialIndexSerial = mSerial;
+    }
+
+    auto FSceneSpatialIndex::IsSyncedWith(const FRenderScene& scene) const noexcept -> bool {
+        return scene.SpatialIndex == this && scene.SpatialIndexSerial == mSerial
+            && mSyncedMeshCount == scene.StaticMeshes.Size();
+    }
+
+    auto FSceneSpatialIndex::GetStats() const noexcept -> FSceneSpatialIndexStats {
+        FSceneSpatialIndexStats stats = mLastSync;
+        stats.ProxyCount              = static_cast<u32>(mProxies.Size());
+        stats.Unindexed               = static_cast<u32>(mUnindexed.Size());
+        stats.NodeCount               = 0U;
+        for (const auto& node : mNodes) {
+            stats.NodeCount += (node.Height >= 0) ? 1U : 0U;
+        }
+        stats.TreeHeight =
+            (mRoot != kInvalidIndex) ? static_cast<u32>(mNodes[mRoot].Height) + 1U : 0U;
+        return stats;
+    }
+
+    void FSceneSpatialIndex::QueryPlanes(
+        const FVector4f* planes, u32 planeCount, FSceneVisibility& outVisibility) const {
+        outVisibility.Count = mSyncedMeshCount;
+        outVisibility.Words.Resize((mSyncedMeshCount + 63U) / 64U);
+        for (auto& word : outVisibility.Words) {
+            word = 0ULL;
+        }
+
+        planeCount          = Core::Math::Min(planeCount, kMaxPlanes);
+        const u32 planeMask = (planeCount == kMaxPlanes) ? ~0U : ((1U << planeCount) - 1U);
+        for (const auto& entry : mUnindexed) {
+            u32 mask = planeMask;
+            if (!entry.bHasBounds
+                || ClassifyBox(entry.Bounds, planes, mask) != EPlaneClass::Outside) {
+                SetBit(outVisibility, entry.SceneIndex);
+            }
+        }
+        if (mRoot == kInvalidIndex) {
+            return;
+        }
+
+        TVector<FStackEntry> stack;
+        stack.Reserve(64U);
+        stack.PushBack({ mRoot, planeMask });
+        while (!stack.IsEmpty()) {
+            FStackEntry current = stack.Back();
+            stack.PopBack();
+
+            const FNode& node = mNodes[current.Node];
+            if (ClassifyBox(node.Box, planes, current.PlaneMask) == EPlaneClass::Outside) {
+                continue;
+            }
+            if (node.IsLeaf()) {
+                // The enlarged leaf box straddles a plane: decide on the tight bounds.
+                const FProxy& proxy = mProxies[node.Proxy];
+                if (current.PlaneMask == 0U
+                    || ClassifyBox(proxy.Bounds, planes, current.PlaneMask)
+                        != EPlaneClass::Outside) {
+                    SetBit(outVisibility, proxy.SceneIndex);
+                }
+                continue;
+            }
+            // A zero mask means the subtree is fully inside and is only walked to collect leaves.
+            stack.PushBack({ node.Child0, current.PlaneMask });
+            stack.PushBack({ node.Child1, current.PlaneMask });
+        }
+    }
+
+    void FSceneSpatialIndex::QueryBox(
+        const FVector3f& min, const FVector3f& max, TVector<u32>& outSceneIndices) const {
+        Query(
+            [&min, &max](const FBox& box) {
+                for (u32 axis = 0U; axis < 3U; ++axis) {
+                    if (box.Max[axis] < min[axis] || box.Min[axis] > max[axis]) {
+                        return false;
+                    }
+                }
+                return true;
+            },
+            outSceneIndices);
+    }
+
+    void FSceneSpatialIndex::QuerySphere(
+        const FVector3f& center, f32 radius, TVector<u32>& outSceneIndices) const {
+        Query(
+            [&center, radius](const FBox& box) {
+                f32 distanceSq = 0.0f;
+                for (u32 axis = 0U; axis < 3U; ++axis) {
+                    const f32 clamped =
+                        Core::Math::Clamp(center[axis], box.Min[axis], box.Max[axis]);
+                    const f32 delta = center[axis] - clamped;
+                    distanceSq += delta * delta;
+                }
+                return distanceSq <= radius * radius;
+            },
+            outSceneIndices);
+    }
+
+    template <typename TOverlap>
+    void FSceneSpatialIndex::Query(
+        const TOverlap& overlaps, TVector<u32>& outSceneIndices) const {
+        for (const auto& entry : mUnindexed) {
+            if (!entry.bHasBounds || overlaps(entry.Bounds)) {
+                outSceneIndices.PushBack(entry.SceneIndex);
+            }
+        }
+        if (mRoot == kInvalidIndex) {
+            return;
+        }
+
+        TVector<u32> stack;
+        stack.Reserve(64U);
+        stack.PushBack(mRoot);
+        while (!stack.IsEmpty()) {
+            const FNode& node = mNodes[stack.Back()];
+            stack.PopBack();
+            if (!overlaps(node.Box)) {
+                continue;
+            }
+            if (node.IsLeaf()) {
+                const FProxy& proxy = mProxies[node.Proxy];
+                if (overlaps(proxy.Bounds)) {
+                    outSceneIndices.PushBack(proxy.SceneIndex);
+                }
+                continue;
+            }
+            stack.PushBack(node.Child0);
+            stack.PushBack(node.Child1);
+        }
+    }
+
+    auto FSceneSpatialIndex::AllocateNode() -> u32 {
+        u32 index = mFreeList;
+        if (index != kInvalidIndex) {
+            mFreeList = mNodes[index].Parent;
+        } else {
+            index = static_cast<u32>(mNodes.Size());
+            mNodes.PushBack(FNode{});
+        }
+        mNodes[index] = FNode{};
+        return index;
+    }
+
+    void FSceneSpatialIndex::FreeNode(u32 node) {
+        mNodes[node]        = FNode{};
+        mNodes[node].Height = -1;
+        mNodes[node].Parent = mFreeList;
+        mFreeList           = node;
+    }
+
+    void FSceneSpatialIndex::RemoveProxy(u32 proxy) {
+        const u32 leaf = mProxies[proxy].Leaf;
+        RemoveLeaf(leaf);
+        FreeNode(leaf);
+        (void)mProxyByKey.Remove(mProxies[proxy].Key);
+
+        const u32 last = static_cast<u32>(mProxies.Size()) - 1U;
+        if (proxy != last) {
+            mProxies[proxy]                    = mProxies[last];
+            mNodes[mProxies[proxy].Leaf].Proxy = proxy;
+            mProxyByKey[mProxies[proxy].Key]   = proxy;
+        }
+        mProxies.PopBack();
+    }
+
+    void FSceneSpatialIndex::InsertLeaf(u32 leaf) {
+        if (mRoot == kInvalidIndex) {
+            mRoot               = leaf;
+            mNodes[leaf].Parent = kInvalidIndex;
+            return;
+        }
+
+        // Descend towards the sibling with the cheapest surface-area increase.
+        const FBox box   = mNodes[leaf].Box;
+        u32        index = mRoot;
+        while (!mNodes[index].IsLeaf()) {
+            const FNode& node         = mNodes[index];
+            const f32    area         = Area(node.Box);
+            const f32    combinedArea = Area(Union(node.Box, box));
+            const f32    cost         = 2.0f * combinedArea;
+            const f32    inheritance  = 2.0f * (combinedArea - area);
+
+            const auto   childCost    = [&](u32 child) {
+                const FNode& childNode = mNodes[child];
+                const f32    grown     = Area(Union(box, childNode.Box));
+                return (childNode.IsLeaf() ? grown : grown - Area(childNode.Box)) + inheritance;
+            };
+            const f32 cost0 = childCost(node.Child0);
+            const f32 cost1 = childCost(node.Child1);
+            if (cost < cost0 && cost < cost1) {
+                break;
+            }
+            index = (cost0 < cost1) ? node.Child0 : node.Child1;
+        }
+
+        const u32 sibling   = index;
+        const u32 oldParent = mNodes[sibling].Parent;
+        const u32 newParent = AllocateNode();
+        mNodes[newParent].Parent = oldParent;
+        mNodes[newParent].Box    = Union(box, mNodes[sibling].Box);
+        mNodes[newParent].Height = mNodes[sibling].Height + 1;
+        mNodes[newParent].Child0 = sibling;
+        mNodes[newParent].Child1 = leaf;
+        if (oldParent != kInvalidIndex) {
+            if (mNodes[oldParent].Child0 == sibling) {
+                mNodes[oldParent].Child0 = newParent;
+            } else {
+                mNodes[oldParent].Child1 = newParent;
+            }
+        } else {
+            mRoot = newParent;
+        }
+        mNodes[sibling].Parent = newParent;
+        mNodes[leaf].Parent    = newParent;
+
+        RefitFrom(newParent);
+    }
+
+    void FSceneSpatialIndex::RemoveLeaf(u32 leaf) {
+        if (leaf == mRoot) {
+            mRoot = kInvalidIndex;
+            return;
+        }
+
+        const u32 parent      = mNodes[leaf].Parent;
+        const u32 grandParent = mNodes[parent].Parent;
+        const u32 sibling =
+            (mNodes[parent].Child0 == leaf) ? mNodes[parent].Child1 : mNodes[parent].Child0;
+        mNodes[leaf].Parent = kInvalidIndex;
+
+        if (grandParent == kInvalidIndex) {
+            mRoot                  = sibling;
+            mNodes[sibling].Parent = kInvalidIndex;
+            FreeNode(parent);
+            return;
+        }
+
+        if (mNodes[grandParent].Child0 == parent) {
+            mNodes[grandParent].Child0 = sibling;
+        } else {
+            mNodes[grandParent].Child1 = sibling;
+        }
+        mNodes[sibling].Parent = grandParent;
+        FreeNode(parent);
+        RefitFrom(grandParent);
+    }
+
+    void FSceneSpatialIndex::RefitFrom(u32 node) {
+        while (node != kInvalidIndex) {
+            node            = Balance(node);
+            FNode&    entry = mNodes[node];
+            const u32 c0    = entry.Child0;
+            const u32 c1    = entry.Child1;
+            entry.Height    = 1 + Core::Math::Max(mNodes[c0].Height, mNodes[c1].Height);
+            entry.Box       = Union(mNodes[c0].Box, mNodes[c1].Box);
+            node            = entry.Parent;
+        }
+    }
+
+    // Rotate the taller grandchild up when the subtree heights differ by more than one.
+    auto FSceneSpatialIndex::Balance(u32 a) -> u32 {
+        if (mNodes[a].IsLeaf() || mNodes[a].Height < 2) {
+            return a;
+        }
+
+        const u32 b       = mNodes[a].Child0;
+        const u32 c       = mNodes[a].Child1;
+        const i32 balance = mNodes[c].Height - mNodes[b].Height;
+        if (balance >= -1 && balance <= 1) {
+            return a;
+        }
+
+        // `up` replaces `a`; `stay` remains a child of `a`.
+        const u32 up        = (balance > 1) ? c : b;
+        const u32 stay      = (balance > 1) ? b : c;
+        const u32 f         = mNodes[up].Child0;
+        const u32 g         = mNodes[up].Child1;
+        const u32 oldParent = mNodes[a].Parent;
+
+        mNodes[up].Child0 = a;
+        mNodes[up].Parent = oldParent;
+        mNodes[a].Parent  = up;
+        if (oldParent != kInvalidIndex) {
+            if (mNodes[oldParent].Child0 == a) {
+                mNodes[oldParent].Child0 = up;
+            } else {
+                mNodes[oldParent].Child1 = up;
+            }
+        } else {
+            mRoot = up;
+        }
+
+        // The taller grandchild stays under `up`, the shorter one moves under `a`.
+        const u32 keep = (mNodes[f].Height > mNodes[g].Height) ? f : g;
+        const u32 move = (keep == f) ? g : f;
+        mNodes[up].Child1   = keep;
+        mNodes[a].Child0    = stay;
+        mNodes[a].Child1    = move;
+        mNodes[move].Parent = a;
+
+        mNodes[a].Box     = Union(mNodes[stay].Box, mNodes[move].Box);
+        mNodes[a].Height  = 1 + Core::Math::Max(mNodes[stay].Height, mNodes[move].Height);
+        mNodes[up].Box    = Union(mNodes[a].Box, mNodes[keep].Box);
+        mNodes[up].Height = 1 + Core::Math::Max(mNodes[a].Height, mNodes[keep].Height);
+        return up;
+    }
+} // namespace AltinaEngine::Engine
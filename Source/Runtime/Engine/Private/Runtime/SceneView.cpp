@@ -1,4 +1,6 @@
 #include "Engine/Runtime/SceneView.h"
+#include "Engine/Runtime/SceneCulling.h"
+#include "Engine/Runtime/SceneSpatialIndex.h"
 
 #include "Engine/GameScene/CameraComponent.h"
 #include "Engine/GameScene/DirectionalLightComponent.h"
@@ -14,6 +16,8 @@
 using AltinaEngine::Move;
 namespace AltinaEngine::Engine {
     namespace {
+        TAtomic<u64> gNextSceneBuildSerial(1ULL);
+
         auto BuildPbrSkyParameters(const GameScene::FPbrSkyComponent& component)
             -> FPbrSkySceneParameters {
             FPbrSkySceneParameters out{};
@@ -44,6 +48,11 @@ namespace AltinaEngine::Engine {
         const FSceneViewBuildParams& params, FRenderScene& outScene) const {
         outScene.Views.Clear();
         outScene.StaticMeshes.Clear();
+        outScene.BuildSerial            = gNextSceneBuildSerial.FetchAdd(1ULL);
+        outScene.WorldId                = world.GetWorldId();
+        outScene.CachedStaticMeshBounds = nullptr;
+        outScene.SpatialIndex           = nullptr;
+        outScene.SpatialIndexSerial     = 0ULL;
         outScene.Lights.Clear();
         outScene.SkyProvider  = ESkyProviderType::None;
         outScene.SkyCubeAsset = {};
@@ -134,11 +143,21 @@ namespace AltinaEngine::Engine {
             entry.MeshGeometryKey     = meshComponent.GetStaticMeshGeometryKey();
             entry.Mesh                = &meshData;
             entry.Materials           = &materialComponent;
-            const auto worldTransform = world.Object(owner).GetWorldTransform();
-            entry.WorldMatrix         = worldTransform.ToMatrix();
+            const auto  ownerObject   = world.Object(owner);
+            entry.WorldMatrix         = ownerObject.GetWorldTransform().ToMatrix();
             entry.PrevWorldMatrix     = entry.WorldMatrix;
+            entry.TransformRevision   = ownerObject.GetWorldTransformRevision();
+            entry.MeshRevision        = meshComponent.GetStaticMeshRevision();
             outScene.StaticMeshes.PushBack(entry);
         }
+        if (params.BoundsCache != nullptr) {
+            params.BoundsCache->Update(outScene, 0U);
+        } else {
+            BuildSceneBounds(outScene, 0U, outScene.StaticMeshBounds);
+        }
+        if (params.SpatialIndex != nullptr) {
+            params.SpatialIndex->Sync(outScene);
+        }
 
         // Lights (Phase1: single main directional + N points).
         const auto& dirLightIds = world.GetActiveDirectionalLightComponents();
@@ -56,4 +56,16 @@ namespace AltinaEngine::GameScene {
         APROPERTY()
         bool mEnabled = true;
     };
+
+    /**
+     * @brief Components that opt into parallel ticking.
+     *
+     * A component type declares `static constexpr bool kTickInParallel = true;` when its Tick
+     * only touches its own state (no world structural changes, no shared mutable data). The
+     * world may then tick instances of that type concurrently from job system workers.
+     */
+    template <typename T>
+    concept CParallelTickComponent = requires {
+        requires T::kTickInParallel;
+    };
 } // namespace AltinaEngine::GameScene
@@ -29,15 +29,8 @@ namespace AltinaEngine::GameScene {
         void               SetName(FStringView name);
 
         [[nodiscard]] auto GetParent() const noexcept -> FGameObjectId { return mParent; }
-        void               SetParent(FGameObjectId parent) noexcept {
-            mParent         = parent;
-            mTransformDirty = true;
-        }
-        void ClearParent() noexcept {
-            mParent         = {};
-            mWorldTransform = mLocalTransform;
-            mTransformDirty = true;
-        }
+        void               SetParent(FGameObjectId parent) noexcept;
+        void               ClearParent() noexcept;
 
         [[nodiscard]] auto GetLocalTransform() const noexcept -> const LinAlg::FSpatialTransform& {
             return mLocalTransform;
@@ -50,6 +43,7 @@ namespace AltinaEngine::GameScene {
             mLocalTransform = transform;
             if (!mParent.IsValid()) {
                 mWorldTransform = transform;
+                ++mWorldTransformRevision;
             }
             mTransformDirty = true;
         }
@@ -59,19 +53,26 @@ namespace AltinaEngine::GameScene {
             }
             mWorldTransform = transform;
             mTransformDirty = true;
+            ++mWorldTransformRevision;
         }
 
         void UpdateWorldTransform() noexcept {
             mWorldTransform = mLocalTransform;
             mTransformDirty = false;
+            ++mWorldTransformRevision;
         }
         void UpdateWorldTransform(const LinAlg::FSpatialTransform& parentWorld) noexcept {
             mWorldTransform = parentWorld * mLocalTransform;
             mTransformDirty = false;
+            ++mWorldTransformRevision;
         }
 
         [[nodiscard]] auto IsTransformDirty() const noexcept -> bool { return mTransformDirty; }
         void               MarkTransformDirty() noexcept { mTransformDirty = true; }
+        // Bumped whenever the world transform is written; never 0.
+        [[nodiscard]] auto GetWorldTransformRevision() const noexcept -> u64 {
+            return mWorldTransformRevision;
+        }
 
         template <typename T> [[nodiscard]] auto AddComponent() -> FComponentId;
         [[nodiscard]] auto AddComponentByType(FComponentTypeHash type) -> FComponentId;
@@ -92,11 +93,10 @@ namespace AltinaEngine::GameScene {
         FWorld*                   mWorld = nullptr;
         FGameObjectId             mId{};
         FGameObjectId             mParent{};
-        LinAlg::FSpatialTransform mLocalTransform     = LinAlg::FSpatialTransform::Identity();
-        LinAlg::FSpatialTransform mWorldTransform     = LinAlg::FSpatialTransform::Identity();
-        bool                      mTransformDirty     = false;
-        u32                       mTransformUpdateId  = 0;
-        u32                       mTransformChangedId = 0;
+        LinAlg::FSpatialTransform mLocalTransform         = LinAlg::FSpatialTransform::Identity();
+        LinAlg::FSpatialTransform mWorldTransform         = LinAlg::FSpatialTransform::Identity();
+        bool                      mTransformDirty         = false;
+        u64                       mWorldTransformRevision = 1ULL;
         FString                   mName{};
         bool                      mActive = true;
         TVector<FComponentId>     mComponents{};
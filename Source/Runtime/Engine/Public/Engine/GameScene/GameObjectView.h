@@ -35,6 +35,8 @@ namespace AltinaEngine::GameScene {
 
         [[nodiscard]] auto GetLocalTransform() const noexcept -> LinAlg::FSpatialTransform;
         [[nodiscard]] auto GetWorldTransform() const noexcept -> LinAlg::FSpatialTransform;
+        // 0 when the object cannot be resolved.
+        [[nodiscard]] auto GetWorldTransformRevision() const noexcept -> u64;
         void               SetLocalTransform(const LinAlg::FSpatialTransform& transform);
         void               SetWorldTransform(const LinAlg::FSpatialTransform& transform);
 
@@ -30,6 +30,8 @@ namespace AltinaEngine::GameScene {
         [[nodiscard]] auto GetStaticMesh() noexcept -> Geometry::FStaticMeshData&;
         [[nodiscard]] auto GetStaticMesh() const noexcept -> const Geometry::FStaticMeshData&;
         [[nodiscard]] auto GetStaticMeshGeometryKey() const noexcept -> u64;
+        // Bumped whenever the resolved mesh data is replaced; never 0.
+        [[nodiscard]] auto GetStaticMeshRevision() const noexcept -> u64;
 
         void               SetStaticMeshAsset(Asset::FAssetHandle handle) noexcept;
         void               SetStaticMeshData(Geometry::FStaticMeshData&& InMesh) noexcept;
@@ -56,6 +58,7 @@ namespace AltinaEngine::GameScene {
         mutable Geometry::FStaticMeshData                         mStaticMesh{};
         mutable Container::TShared<Engine::FStaticMeshCacheEntry> mStaticMeshEntry{};
         mutable Asset::FAssetHandle                               mResolvedAsset{};
+        mutable u64                                               mMeshRevision       = 1ULL;
         mutable bool                                              mMeshResolved       = false;
         mutable bool                                              mProceduralOverride = false;
     };
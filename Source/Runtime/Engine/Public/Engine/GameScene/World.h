@@ -9,6 +9,7 @@
 #include "Container/HashMap.h"
 #include "Container/SmartPtr.h"
 #include "Container/Vector.h"
+#include "Jobs/Parallel.h"
 #include "Memory/ObjectPool.h"
 #include "Reflection/Serialization.h"
 #include "Threading/Atomic.h"
@@ -143,32 +144,29 @@ namespace AltinaEngine::GameScene {
             virtual void               DestroyAll(FWorld& world)                               = 0;
             [[nodiscard]] virtual auto ResolveBase(FComponentId id) -> FComponent*             = 0;
             [[nodiscard]] virtual auto ResolveBase(FComponentId id) const -> const FComponent* = 0;
+            // Re-evaluate whether `id` belongs on the tick list (enabled, owner active).
+            virtual void RefreshTickState(FWorld& world, FComponentId id) = 0;
         };
 
+        /**
+         * @brief Per-type component storage.
+         *
+         * Components live in a thread-safe object pool so references stay valid across
+         * creation. `FComponentId::Index` addresses a generation-checked sparse slot that maps
+         * to a packed dense array (swap-removed on destroy), and a separate tick list holds
+         * only components that are alive, enabled and owned by an active game object, so Tick
+         * never visits anything it would skip. Types satisfying `CParallelTickComponent` are
+         * ticked with ParallelFor once the tick list is large enough.
+         */
         template <typename T> class TComponentStorage final : public FComponentStorageBase {
         public:
             auto Create(FWorld& world, FGameObjectId owner) -> FComponentId {
-                auto handle = mPool.Allocate();
-                if (!handle) {
+                auto* component = Allocate(world, owner);
+                if (component == nullptr) {
                     return {};
                 }
 
-                const u32 index = AcquireSlot();
-                auto&     slot  = mSlots[index];
-                slot.Handle     = Move(handle);
-                slot.Alive      = true;
-                if (slot.Generation == 0) {
-                    slot.Generation = 1;
-                }
-                slot.Owner = owner;
-
-                FComponentId id{};
-                id.Index      = index;
-                id.Generation = slot.Generation;
-                id.Type       = mTypeHash;
-
-                auto* component = slot.Handle.Get();
-                world.InitializeComponent(*component, id, owner);
+                const FComponentId id = component->GetId();
                 if (world.ShouldInvokeComponentLifecycles()) {
                     component->OnCreate();
                     if (component->IsEnabled()) {
@@ -178,33 +176,19 @@ namespace AltinaEngine::GameScene {
 
                 world.LinkComponentToOwner(owner, id);
                 world.OnComponentCreated(id, owner);
+                RefreshTickState(world, id);
                 return id;
             }
 
             template <typename InitFn>
                 requires requires(InitFn&& fn, T& component) { fn(component); }
             auto Create(FWorld& world, FGameObjectId owner, InitFn&& init) -> FComponentId {
-                auto handle = mPool.Allocate();
-                if (!handle) {
+                auto* component = Allocate(world, owner);
+                if (component == nullptr) {
                     return {};
                 }
 
-                const u32 index = AcquireSlot();
-                auto&     slot  = mSlots[index];
-                slot.Handle     = Move(handle);
-                slot.Alive      = true;
-                if (slot.Generation == 0) {
-                    slot.Generation = 1;
-                }
-                slot.Owner = owner;
-
-                FComponentId id{};
-                id.Index      = index;
-                id.Generation = slot.Generation;
-                id.Type       = mTypeHash;
-
-                auto* component = slot.Handle.Get();
-                world.InitializeComponent(*component, id, owner);
+                const FComponentId id = component->GetId();
                 init(*component);
 
                 if (world.ShouldInvokeComponentLifecycles()) {
@@ -216,6 +200,7 @@ namespace AltinaEngine::GameScene {
 
                 world.LinkComponentToOwner(owner, id);
                 world.OnComponentCreated(id, owner);
+                RefreshTickState(world, id);
                 return id;
             }
 
@@ -224,21 +209,38 @@ namespace AltinaEngine::GameScene {
                     return;
                 }
 
-                auto& slot  = mSlots[id.Index];
-                auto  owner = slot.Owner;
+                const auto owner     = mDenseOwners[mSlots[id.Index].DenseIndex];
+                auto*      component = mSlots[id.Index].Component;
+                if (component->IsEnabled()) {
+                    component->OnDisable();
+                }
+                component->OnDestroy();
+                world.OnComponentDestroyed(id, owner);
 
-                if (slot.Handle) {
-                    auto* component = slot.Handle.Get();
-                    if (component->IsEnabled()) {
-                        component->OnDisable();
+                // Callbacks may have created or destroyed other components; re-read the slot.
+                auto&     slot  = mSlots[id.Index];
+                const u32 dense = slot.DenseIndex;
+                RemoveFromTickList(dense);
+                mPool.Deallocate(Move(mDenseHandles[dense]));
+
+                const u32 last = static_cast<u32>(mDenseHandles.Size()) - 1U;
+                if (dense != last) {
+                    mDenseHandles[dense]   = Move(mDenseHandles[last]);
+                    mDenseOwners[dense]    = mDenseOwners[last];
+                    mDenseSlots[dense]     = mDenseSlots[last];
+                    mDenseTickIndex[dense] = mDenseTickIndex[last];
+                    mSlots[mDenseSlots[dense]].DenseIndex = dense;
+                    if (mDenseTickIndex[dense] != kInvalidIndex) {
+                        mTickDense[mDenseTickIndex[dense]] = dense;
                     }
-                    component->OnDestroy();
                 }
+                mDenseHandles.PopBack();
+                mDenseOwners.PopBack();
+                mDenseSlots.PopBack();
+                mDenseTickIndex.PopBack();
 
-                world.OnComponentDestroyed(id, owner);
-                mPool.Deallocate(Move(slot.Handle));
-                slot.Owner = {};
-                slot.Alive = false;
+                slot.Component  = nullptr;
+                slot.DenseIndex = kInvalidIndex;
                 slot.Generation++;
                 if (slot.Generation == 0) {
                     slot.Generation = 1;
@@ -256,14 +258,13 @@ namespace AltinaEngine::GameScene {
                     return false;
                 }
                 const auto& slot = mSlots[id.Index];
-                return slot.Alive && slot.Generation == id.Generation && slot.Handle;
+                return slot.DenseIndex != kInvalidIndex && slot.Generation == id.Generation;
             }
 
             void DestroyAll(FWorld& world) override {
-                for (u32 index = 0; index < static_cast<u32>(mSlots.Size()); ++index) {
-                    if (!mSlots[index].Alive) {
-                        continue;
-                    }
+                // Destroy swap-removes, so always take the last dense entry.
+                while (!mDenseSlots.IsEmpty()) {
+                    const u32    index = mDenseSlots.Back();
                     FComponentId id{};
                     id.Index      = index;
                     id.Generation = mSlots[index].Generation;
@@ -272,45 +273,153 @@ namespace AltinaEngine::GameScene {
                 }
             }
 
-            void Tick(FWorld& world, float deltaTime) override {
-                const u32 count = static_cast<u32>(mSlots.Size());
-                for (u32 index = 0; index < count; ++index) {
-                    auto& slot = mSlots[index];
-                    if (!slot.Alive || !slot.Handle) {
-                        continue;
-                    }
-                    if (!world.IsGameObjectActive(slot.Owner)) {
-                        continue;
+            void Tick(FWorld& /*world*/, float deltaTime) override {
+                const usize count = mTickList.Size();
+                if (count == 0U) {
+                    return;
+                }
+
+                ++mTickDepth;
+                if constexpr (CParallelTickComponent<T>) {
+                    if (count >= kParallelTickThreshold) {
+                        T* const* components = mTickList.Data();
+                        Core::Jobs::ParallelFor(
+                            count, kParallelTickGrain, [components, deltaTime](usize i) -> void {
+                                T* component = components[i];
+                                if (component != nullptr && component->IsEnabled()) {
+                                    component->Tick(deltaTime);
+                                }
+                            });
+                        --mTickDepth;
+                        CompactTickList();
+                        return;
                     }
-                    auto* component = slot.Handle.Get();
-                    if (component == nullptr || !component->IsEnabled()) {
-                        continue;
+                }
+
+                // Components created during this pass are appended past `count` and first tick
+                // next frame; ones removed during it are left as null holes until compaction.
+                for (usize index = 0; index < count; ++index) {
+                    T* component = mTickList[index];
+                    if (component != nullptr && component->IsEnabled()) {
+                        component->Tick(deltaTime);
                     }
-                    component->Tick(deltaTime);
+                }
+                --mTickDepth;
+                CompactTickList();
+            }
+
+            void RefreshTickState(FWorld& world, FComponentId id) override {
+                if (!IsAlive(id)) {
+                    return;
+                }
+                const auto& slot  = mSlots[id.Index];
+                const u32   dense = slot.DenseIndex;
+                const bool  shouldTick =
+                    slot.Component->IsEnabled() && world.IsGameObjectActive(mDenseOwners[dense]);
+                if (!shouldTick) {
+                    RemoveFromTickList(dense);
+                    return;
+                }
+                if (mDenseTickIndex[dense] == kInvalidIndex) {
+                    mDenseTickIndex[dense] = static_cast<u32>(mTickList.Size());
+                    mTickList.PushBack(slot.Component);
+                    mTickDense.PushBack(dense);
                 }
             }
 
             [[nodiscard]] auto Resolve(FComponentId id) -> T& {
-                return *mSlots[id.Index].Handle.Get();
+                return *mSlots[id.Index].Component;
             }
             [[nodiscard]] auto Resolve(FComponentId id) const -> const T& {
-                return *mSlots[id.Index].Handle.Get();
+                return *mSlots[id.Index].Component;
             }
             [[nodiscard]] auto ResolveBase(FComponentId id) -> FComponent* override {
-                return mSlots[id.Index].Handle.Get();
+                return mSlots[id.Index].Component;
             }
             [[nodiscard]] auto ResolveBase(FComponentId id) const -> const FComponent* override {
-                return mSlots[id.Index].Handle.Get();
+                return mSlots[id.Index].Component;
             }
 
         private:
+            static constexpr u32   kInvalidIndex          = ~0U;
+            static constexpr usize kParallelTickThreshold = 256U;
+            static constexpr usize kParallelTickGrain     = 64U;
+
             struct FSlot {
-                Core::Memory::TObjectPoolHandle<T> Handle{};
-                u32                                Generation = 1;
-                bool                               Alive      = false;
-                FGameObjectId                      Owner{};
+                T*  Component  = nullptr;
+                u32 Generation = 1;
+                u32 DenseIndex = kInvalidIndex;
             };
 
+            auto Allocate(FWorld& world, FGameObjectId owner) -> T* {
+                auto handle = mPool.Allocate();
+                if (!handle) {
+                    return nullptr;
+                }
+
+                const u32 index = AcquireSlot();
+                auto&     slot  = mSlots[index];
+                if (slot.Generation == 0) {
+                    slot.Generation = 1;
+                }
+                slot.Component  = handle.Get();
+                slot.DenseIndex = static_cast<u32>(mDenseHandles.Size());
+                mDenseHandles.PushBack(Move(handle));
+                mDenseOwners.PushBack(owner);
+                mDenseSlots.PushBack(index);
+                mDenseTickIndex.PushBack(kInvalidIndex);
+
+                FComponentId id{};
+                id.Index      = index;
+                id.Generation = slot.Generation;
+                id.Type       = mTypeHash;
+                world.InitializeComponent(*slot.Component, id, owner);
+                return slot.Component;
+            }
+
+            void RemoveFromTickList(u32 dense) {
+                const u32 tickIndex = mDenseTickIndex[dense];
+                if (tickIndex == kInvalidIndex) {
+                    return;
+                }
+                mDenseTickIndex[dense] = kInvalidIndex;
+                if (mTickDepth > 0U) {
+                    // Ticking is iterating the list; leave a hole and compact afterwards.
+                    mTickList[tickIndex]  = nullptr;
+                    mTickDense[tickIndex] = kInvalidIndex;
+                    mTickListHasHoles     = true;
+                    return;
+                }
+
+                const u32 last = static_cast<u32>(mTickList.Size()) - 1U;
+                if (tickIndex != last) {
+                    mTickList[tickIndex]              = mTickList[last];
+                    mTickDense[tickIndex]             = mTickDense[last];
+                    mDenseTickIndex[mTickDense[last]] = tickIndex;
+                }
+                mTickList.PopBack();
+                mTickDense.PopBack();
+            }
+
+            void CompactTickList() {
+                if (!mTickListHasHoles || mTickDepth > 0U) {
+                    return;
+                }
+                usize write = 0U;
+                for (usize read = 0U; read < mTickList.Size(); ++read) {
+                    if (mTickList[read] == nullptr) {
+                        continue;
+                    }
+                    mTickList[write]                   = mTickList[read];
+                    mTickDense[write]                  = mTickDense[read];
+                    mDenseTickIndex[mTickDense[write]] = static_cast<u32>(write);
+                    ++write;
+                }
+                mTickList.Resize(write);
+                mTickDense.Resize(write);
+                mTickListHasHoles = false;
+            }
+
             auto AcquireSlot() -> u32 {
                 if (!mFreeList.IsEmpty()) {
                     const u32 index = mFreeList.Back();
@@ -321,16 +430,25 @@ namespace AltinaEngine::GameScene {
                 return static_cast<u32>(mSlots.Size() - 1);
             }
 
-            Core::Memory::TThreadSafeObjectPool<T> mPool{};
-            TVector<FSlot>                         mSlots{};
-            TVector<u32>                           mFreeList{};
-            const FComponentTypeHash               mTypeHash = GetComponentTypeHash<T>();
+            Core::Memory::TThreadSafeObjectPool<T>      mPool{};
+            TVector<FSlot>                              mSlots{};
+            TVector<u32>                                mFreeList{};
+            TVector<Core::Memory::TObjectPoolHandle<T>> mDenseHandles{};
+            TVector<FGameObjectId>                      mDenseOwners{};
+            TVector<u32>                                mDenseSlots{};
+            TVector<u32>                                mDenseTickIndex{};
+            TVector<T*>                                 mTickList{};
+            TVector<u32>                                mTickDense{};
+            u32                                         mTickDepth        = 0U;
+            bool                                        mTickListHasHoles = false;
+            const FComponentTypeHash                    mTypeHash = GetComponentTypeHash<T>();
         };
 
         using FComponentStoragePtr =
             TOwner<FComponentStorageBase, TPolymorphicDeleter<FComponentStorageBase>>;
 
         friend class FComponent;
+        friend class FGameObject;
         friend class FGameObjectView;
         template <typename T> friend class TComponentStorage;
 
@@ -354,7 +472,25 @@ namespace AltinaEngine::GameScene {
         [[nodiscard]] auto ResolveComponentBase(FComponentId id) -> FComponent*;
         [[nodiscard]] auto ResolveComponentBase(FComponentId id) const -> const FComponent*;
 
-        [[nodiscard]] auto UpdateTransformRecursive(FGameObjectId id, u32 updateId) -> bool;
+        /**
+         * @brief Depth-sorted structure-of-arrays view of the transform hierarchy.
+         *
+         * Nodes are grouped by depth (roots first) and `Parents` holds node indices, so a
+         * parent's world transform is always final before any child in the next level reads
+         * it. Rebuilt only when objects are created, destroyed or reparented.
+         */
+        struct FTransformHierarchy {
+            static constexpr u32 kNoParent = ~0U;
+
+            TVector<FGameObject*>              Objects{};
+            TVector<u32>                       Parents{};
+            TVector<LinAlg::FSpatialTransform> WorldTransforms{};
+            TVector<u8>                        Changed{};
+            TVector<u32>                       LevelOffsets{}; // level count + 1 entries
+        };
+
+        void MarkTransformHierarchyDirty() noexcept { mTransformHierarchyDirty = true; }
+        void RebuildTransformHierarchy();
         [[nodiscard]] auto IsDescendantOfPrefabRoot(FGameObjectId id) const -> bool;
         [[nodiscard]] auto GetSerializableGameObjects() const -> TVector<FGameObjectId>;
 
@@ -383,8 +519,9 @@ namespace AltinaEngine::GameScene {
         TVector<FComponentId>                              mActivePbrSkyComponents{};
         THashMap<FGameObjectId, Engine::GameSceneAsset::FPrefabDescriptor, FGameObjectIdHash>
                               mPrefabRoots{};
-        u32                   mTransformUpdateId = 0;
-        EWorldDeserializeMode mDeserializeMode   = EWorldDeserializeMode::NormalRuntime;
+        FTransformHierarchy   mTransformHierarchy{};
+        bool                  mTransformHierarchyDirty = true;
+        EWorldDeserializeMode mDeserializeMode         = EWorldDeserializeMode::NormalRuntime;
     };
 
     namespace Detail {
@@ -23,7 +23,10 @@ namespace AltinaEngine::Engine {
     class AE_ENGINE_API FMaterialCache {
     public:
         void SetDefaultMaterial(Render::FMaterial* material) noexcept {
-            mDefaultMaterial = material;
+            if (mDefaultMaterial != material) {
+                mDefaultMaterial = material;
+                ++mGeneration;
+            }
         }
         void SetDefaultTemplate(Container::TShared<Render::FMaterialTemplate> templ) noexcept {
             mDefaultTemplate = Move(templ);
@@ -36,6 +39,9 @@ namespace AltinaEngine::Engine {
 
         void               Clear();
 
+        // Changes whenever previously resolved material pointers may be stale.
+        [[nodiscard]] auto GetGeneration() const noexcept -> u64 { return mGeneration; }
+
     private:
         struct FMaterialCacheKey {
             Asset::FAssetHandle Handle{};
@@ -71,5 +77,6 @@ namespace AltinaEngine::Engine {
         Container::THashMap<FMaterialCacheKey, Container::TShared<Render::FMaterial>,
             FMaterialCacheKeyHash>
             mMaterialCache;
+        u64 mGeneration = 1ULL;
     };
 } // namespace AltinaEngine::Engine
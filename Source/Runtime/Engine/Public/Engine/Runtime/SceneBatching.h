@@ -1,7 +1,11 @@
 #pragma once
 
 #include "Engine/EngineAPI.h"
+#include "Container/HashMap.h"
+#include "Container/SmartPtr.h"
 #include "Container/String.h"
+#include "Container/Vector.h"
+#include "Engine/GameScene/Ids.h"
 #include "Engine/Runtime/MaterialCache.h"
 #include "Engine/Runtime/SceneView.h"
 #include "Render/DrawList.h"
@@ -22,6 +26,110 @@ namespace AltinaEngine::Engine {
         bool                      bUseCustomCullMatrix = false;
     };
 
+    struct AE_ENGINE_API FSceneDrawListCacheStats {
+        u32                VisibleMeshes    = 0U;
+        u32                Hits             = 0U; // visible meshes whose draw items were reused
+        u32                Misses           = 0U; // visible meshes whose draw items were rebuilt
+        u32                Uncached         = 0U; // invalid or duplicate mesh component ids
+        u32                Evicted          = 0U;
+        u32                CachedMeshes     = 0U;
+        u32                AddedDraws       = 0U; // instances inserted into the retained list
+        u32                RemovedDraws     = 0U; // instances removed from the retained list
+        u32                WrittenInstances = 0U; // instance transforms rewritten
+        bool               bStructureReused = false; // buckets/batches kept, instances patched
+        bool               bCopiedShared    = false; // list was still shared; patched a copy
+
+        [[nodiscard]] auto GetHitRate() const noexcept -> f32 {
+            return (VisibleMeshes > 0U)
+                ? static_cast<f32>(Hits) / static_cast<f32>(VisibleMeshes)
+                : 1.0f;
+        }
+    };
+
+    /**
+     * @brief Draw state of one pass retained across frames.
+     *
+     * Keeps the resolved material and sort keys of every mesh section keyed by
+     * `FSceneStaticMesh::MeshComponentId`, so a mesh whose mesh data and material slots did
+     * not change skips material resolution and key hashing. The sorted draw list itself is
+     * kept as well: each build removes the draws of meshes that left the view or changed,
+     * merges in the draws of meshes that entered the view or changed, and rewrites only the
+     * instances whose transform moved. Buckets and batches that are not touched keep their
+     * storage.
+     *
+     * The list is shared rather than copied out. A build never modifies a list that is still
+     * shared (e.g. by a frame in flight on the render thread); it patches a recycled copy
+     * instead, and only when something changed.
+     *
+     * Owned by the game thread; pass the same cache to every build of the same pass.
+     */
+    class AE_ENGINE_API FSceneDrawListCache {
+    public:
+        using FSharedDrawList = Container::TShared<RenderCore::Render::FDrawList>;
+
+        // Meshes not seen by this many builds are dropped.
+        static constexpr u64 kEvictAfterBuilds = 120ULL;
+
+        // Copies of the list kept for reuse while earlier builds are still shared.
+        static constexpr u32 kMaxSpareDrawLists = 4U;
+
+        void                 Reset();
+        [[nodiscard]] auto   GetStats() const noexcept -> FSceneDrawListCacheStats {
+            return mStats;
+        }
+
+        // Draw list of the last build; changes with the next build.
+        [[nodiscard]] auto GetDrawList() const noexcept -> const RenderCore::Render::FDrawList&;
+        // Draw list of the last build; later builds leave it unchanged while it is held.
+        [[nodiscard]] auto ShareDrawList() const noexcept -> FSharedDrawList { return mRetained; }
+
+    private:
+        friend class FSceneBatchBuilder;
+
+        struct FCachedSection {
+            RenderCore::Render::FDrawKey Key{};
+            const RenderCore::FMaterial* Material     = nullptr;
+            u32                          SectionIndex = 0U;
+        };
+
+        struct FCachedMesh {
+            GameScene::FComponentId Key{};
+            u64                     Signature         = 0ULL;
+            u64                     LastUsedSerial    = 0ULL;
+            u64                     BuiltSerial       = 0ULL; // build that resolved Sections
+            u64                     TransformRevision = 0ULL;
+            u32                     SceneIndex        = 0U;
+            bool                    bRetained         = false; // has draws in mRetained
+            bool                    bInstanceDirty    = false; // instance data must be rewritten
+            TVector<FCachedSection> Sections{};
+        };
+
+        // One per instance of `mRetained`, in ForEachBatch order.
+        struct FRetainedDraw {
+            RenderCore::Render::FDrawKey Key{};
+            u32                          Mesh       = 0U; // index into mMeshes
+            u32                          Section    = 0U; // index into that mesh's Sections
+            u32                          SceneIndex = 0U;
+        };
+
+        TVector<FCachedMesh>                                                      mMeshes{};
+        TVector<u32>                                                              mFreeMeshes{};
+        Core::Container::THashMap<GameScene::FComponentId, u32, GameScene::FComponentIdHash>
+                                      mMeshByKey{};
+
+        FSharedDrawList                                  mRetained{};
+        TVector<FRetainedDraw>                           mDraws{};
+        TVector<FSharedDrawList>                         mSpareLists{};
+        TVector<RenderCore::Render::FDrawMaterialBucket> mScratchBuckets{}; // reused storage
+
+        RenderCore::EMaterialPass     mPass               = RenderCore::EMaterialPass::BasePass;
+        u32                           mLodIndex           = 0U;
+        bool                          bAllowInstancing    = true;
+        u64                           mMaterialGeneration = 0ULL;
+        u64                           mSerial             = 0ULL;
+        FSceneDrawListCacheStats      mStats{};
+    };
+
     /**
      * @brief Build draw lists from a render scene (StaticMesh only).
      */
@@ -30,5 +138,15 @@ namespace AltinaEngine::Engine {
         void Build(const FRenderScene& scene, const FSceneView& view,
             const FSceneBatchBuildParams& params, FMaterialCache& materialCache,
             RenderCore::Render::FDrawList& outDrawList) const;
+
+        /**
+         * @brief Bring the draw list retained by `cache` up to date and return it.
+         *
+         * Produces the same list as the overload above without copying it; use one cache per
+         * pass. See FSceneDrawListCache.
+         */
+        auto Build(const FRenderScene& scene, const FSceneView& view,
+            const FSceneBatchBuildParams& params, FMaterialCache& materialCache,
+            FSceneDrawListCache& cache) const -> const RenderCore::Render::FDrawList&;
     };
 } // namespace AltinaEngine::Engine
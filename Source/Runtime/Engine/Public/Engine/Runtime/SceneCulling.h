@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Engine/EngineAPI.h"
+#include "Engine/Runtime/SceneView.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+namespace AltinaEngine::Engine {
+    /**
+     * @brief Visibility bitset over `FRenderScene::StaticMeshes` (bit i == StaticMeshes[i]).
+     */
+    struct AE_ENGINE_API FSceneVisibility {
+        TVector<u64>       Words{};
+        u32                Count = 0U;
+
+        [[nodiscard]] auto IsVisible(u32 index) const noexcept -> bool {
+            return index < Count && ((Words[index >> 6U] >> (index & 63U)) & 1ULL) != 0ULL;
+        }
+        [[nodiscard]] auto CountVisible() const noexcept -> u32;
+    };
+
+    /**
+     * @brief Compute world-space SoA bounds for every static mesh in `scene` at `lodIndex`.
+     */
+    AE_ENGINE_API void BuildSceneBounds(
+        const FRenderScene& scene, u32 lodIndex, FSceneBoundsSoA& outBounds);
+
+    struct AE_ENGINE_API FSceneBoundsCacheStats {
+        u32 Updated = 0U; // entries recomputed during the last Update
+        u32 Reused  = 0U; // entries carried over unchanged during the last Update
+    };
+
+    /**
+     * @brief World-space SoA bounds kept alive across scene builds.
+     *
+     * Each entry remembers the mesh component, mesh data and transform/mesh revisions it was
+     * computed from, so an Update only recomputes the boxes of meshes that moved, changed mesh
+     * or were added, and reuses the rest in place. Entries are matched by index; inserting or
+     * removing meshes recomputes the entries that shifted.
+     *
+     * Owned by the game thread. `FSceneViewBuilder` updates it when
+     * `FSceneViewBuildParams::BoundsCache` is set and links it from the built scene.
+     */
+    class AE_ENGINE_API FSceneBoundsCache {
+    public:
+        /**
+         * @brief Bring the bounds in line with `scene.StaticMeshes` and link them from `scene`.
+         */
+        void               Update(FRenderScene& scene, u32 lodIndex);
+        void               Reset();
+
+        [[nodiscard]] auto GetBounds() const noexcept -> const FSceneBoundsSoA& { return mBounds; }
+        [[nodiscard]] auto GetStats() const noexcept -> FSceneBoundsCacheStats {
+            return mLastUpdate;
+        }
+
+    private:
+        struct FEntryKey {
+            GameScene::FComponentId                      MeshComponentId{};
+            const RenderCore::Geometry::FStaticMeshData* Mesh              = nullptr;
+            u64                                          TransformRevision = 0ULL;
+            u64                                          MeshRevision      = 0ULL;
+        };
+
+        FSceneBoundsSoA        mBounds{};
+        TVector<FEntryKey>     mKeys{};
+        u32                    mWorldId = 0U;
+        FSceneBoundsCacheStats mLastUpdate{};
+    };
+
+    /**
+     * @brief Start a visibility set with every renderable entry of `bounds` visible.
+     */
+    AE_ENGINE_API void InitSceneVisibility(
+        const FSceneBoundsSoA& bounds, FSceneVisibility& outVisibility);
+
+    /**
+     * @brief Extract the six clip planes of `viewProj` (x, y in [-w, w], z in [0, w]).
+     *
+     * Each plane is (nx, ny, nz, d); a point p is inside when dot(n, p) + d >= 0.
+     */
+    AE_ENGINE_API void ExtractFrustumPlanes(
+        const Core::Math::FMatrix4x4f& viewProj, Core::Math::FVector4f (&outPlanes)[6]);
+
+    /**
+     * @brief Clear entries whose box lies entirely outside any of `planes`.
+     *
+     * Boxes are tested four at a time with SSE when available. Entries without valid bounds
+     * are never culled.
+     */
+    AE_ENGINE_API void CullSceneBoundsAgainstPlanes(const FSceneBoundsSoA& bounds,
+        const Core::Math::FVector4f* planes, u32 planeCount, FSceneVisibility& inOutVisibility);
+
+    /**
+     * @brief Clear entries whose bounding-sphere radius is below `minRadius`.
+     */
+    AE_ENGINE_API void CullSceneBoundsBelowRadius(
+        const FSceneBoundsSoA& bounds, f32 minRadius, FSceneVisibility& inOutVisibility);
+} // namespace AltinaEngine::Engine
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Engine/EngineAPI.h"
+#include "Engine/GameScene/Ids.h"
+#include "Engine/Runtime/SceneCulling.h"
+#include "Container/HashMap.h"
+#include "Container/Vector.h"
+#include "Math/Vector.h"
+
+namespace AltinaEngine::Engine {
+    struct AE_ENGINE_API FSceneSpatialIndexStats {
+        u32 ProxyCount = 0U;
+        u32 Unindexed  = 0U; // entries without bounds or with a duplicate key
+        u32 Inserted   = 0U; // during the last Sync
+        u32 Moved      = 0U; // during the last Sync (bounds escaped their fat box)
+        u32 Removed    = 0U; // during the last Sync
+        u32 NodeCount  = 0U;
+        u32 TreeHeight = 0U;
+    };
+
+    /**
+     * @brief Persistent bounding-volume hierarchy over the static meshes of a render scene.
+     *
+     * Leaves are keyed by `FSceneStaticMesh::MeshComponentId` and survive across frames: each
+     * Sync only inserts new meshes, reinserts meshes whose bounds left their (enlarged) leaf
+     * box and removes meshes that disappeared, so per-view queries cost roughly the number of
+     * visible objects instead of the number of objects in the scene.
+     *
+     * The index is owned by the game thread. `FSceneViewBuilder` syncs it when
+     * `FSceneViewBuildParams::SpatialIndex` is set and links it from the built scene, where
+     * `FSceneBatchBuilder` uses it for frustum culling.
+     */
+    class AE_ENGINE_API FSceneSpatialIndex {
+    public:
+        static constexpr u32 kInvalidIndex = ~0U;
+
+        /**
+         * @brief Bring the hierarchy in line with `scene.StaticMeshes` and link it from `scene`.
+         *
+         * Uses `scene.GetStaticMeshBounds()`, which must already be built for the current entries.
+         */
+        void               Sync(FRenderScene& scene);
+        void               Reset();
+
+        [[nodiscard]] auto IsSyncedWith(const FRenderScene& scene) const noexcept -> bool;
+        [[nodiscard]] auto GetStats() const noexcept -> FSceneSpatialIndexStats;
+
+        /**
+         * @brief Mark every entry whose box is not entirely outside one of `planes`.
+         *
+         * `outVisibility` is indexed like the synced scene's StaticMeshes. Entries without valid
+         * bounds are always marked. At most 32 planes are supported.
+         */
+        void QueryPlanes(const Core::Math::FVector4f* planes, u32 planeCount,
+            FSceneVisibility& outVisibility) const;
+
+        /**
+         * @brief Append the scene indices of entries overlapping an axis-aligned box / sphere.
+         *
+         * Entries without valid bounds are always reported.
+         */
+        void QueryBox(const Core::Math::FVector3f& min, const Core::Math::FVector3f& max,
+            TVector<u32>& outSceneIndices) const;
+        void QuerySphere(const Core::Math::FVector3f& center, f32 radius,
+            TVector<u32>& outSceneIndices) const;
+
+    private:
+        struct FBox {
+            f32 Min[3] = { 0.0f, 0.0f, 0.0f };
+            f32 Max[3] = { 0.0f, 0.0f, 0.0f };
+        };
+
+        struct FNode {
+            FBox Box{}; // enlarged box for leaves, union of children otherwise
+            u32  Parent = kInvalidIndex;
+            u32  Child0 = kInvalidIndex;
+            u32  Child1 = kInvalidIndex;
+            u32  Proxy  = kInvalidIndex; // leaves only
+            i32  Height = 0;             // 0 for leaves, -1 for free nodes
+
+            [[nodiscard]] auto IsLeaf() const noexcept -> bool { return Child0 == kInvalidIndex; }
+        };
+
+        struct FProxy {
+            GameScene::FComponentId Key{};
+            FBox                    Bounds{};
+            u32                     Leaf       = kInvalidIndex;
+            u32                     SceneIndex = 0U;
+            u64                     SeenSerial = 0ULL;
+        };
+
+        struct FUnindexedEntry {
+            FBox Bounds{};
+            u32  SceneIndex = 0U;
+            bool bHasBounds = false;
+        };
+
+        [[nodiscard]] auto AllocateNode() -> u32;
+        void               FreeNode(u32 node);
+        void               InsertLeaf(u32 leaf);
+        void               RemoveLeaf(u32 leaf);
+        void               RefitFrom(u32 node);
+        [[nodiscard]] auto Balance(u32 node) -> u32;
+        void               RemoveProxy(u32 proxy);
+
+        template <typename TOverlap>
+        void Query(const TOverlap& overlaps, TVector<u32>& outSceneIndices) const;
+
+        TVector<FNode>                                                            mNodes{};
+        TVector<FProxy>                                                           mProxies{};
+        TVector<FUnindexedEntry>                                                  mUnindexed{};
+        Core::Container::THashMap<GameScene::FComponentId, u32, GameScene::FComponentIdHash>
+                                mProxyByKey{};
+        u32                     mRoot            = kInvalidIndex;
+        u32                     mFreeList        = kInvalidIndex;
+        u32                     mSyncedMeshCount = 0U;
+        u64                     mSerial          = 0ULL;
+        FSceneSpatialIndexStats mLastSync{};
+    };
+} // namespace AltinaEngine::Engine
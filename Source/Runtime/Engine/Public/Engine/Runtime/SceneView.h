@@ -27,6 +27,10 @@ namespace AltinaEngine::Engine {
     namespace Container = Core::Container;
     using Container::TVector;
 
+    class FSceneSpatialIndex;
+    class FSceneBoundsCache;
+    struct FRenderScene;
+
     enum class ESkyProviderType : u8 {
         None = 0,
         SkyCube,
@@ -100,11 +104,55 @@ namespace AltinaEngine::Engine {
         const GameScene::FMeshMaterialComponent*     Materials       = nullptr;
         Core::Math::FMatrix4x4f                      WorldMatrix{};
         Core::Math::FMatrix4x4f                      PrevWorldMatrix{};
+        // Revisions of the owner's world transform and of the mesh data this entry was built
+        // from (0 when unknown). FSceneBoundsCache reuses bounds while both are unchanged.
+        u64                                          TransformRevision = 0ULL;
+        u64                                          MeshRevision      = 0ULL;
+    };
+
+    /**
+     * @brief World-space bounds of `FRenderScene::StaticMeshes` in structure-of-arrays form.
+     *
+     * Entry i describes StaticMeshes[i] as a center/half-extent box for `LodIndex`. Arrays are
+     * padded with empty boxes to a multiple of `kLaneCount` so culling can always load full
+     * SIMD lanes. `Renderable` marks entries with a mesh and the LOD; `HasBounds` marks
+     * entries whose LOD bounds are valid (others are never culled). `SceneSerial` records the
+     * `FRenderScene::BuildSerial` the bounds were built for.
+     */
+    struct AE_ENGINE_API FSceneBoundsSoA {
+        static constexpr u32 kLaneCount = 4U;
+
+        u32                  LodIndex    = 0U;
+        u32                  Count       = 0U;
+        u64                  SceneSerial = 0ULL;
+        TVector<f32>         CenterX{};
+        TVector<f32>         CenterY{};
+        TVector<f32>         CenterZ{};
+        TVector<f32>         ExtentX{};
+        TVector<f32>         ExtentY{};
+        TVector<f32>         ExtentZ{};
+        TVector<u64>         Renderable{};
+        TVector<u64>         HasBounds{};
+
+        [[nodiscard]] auto   IsBuiltFor(const FRenderScene& scene, u32 lodIndex) const noexcept
+            -> bool;
     };
 
     struct AE_ENGINE_API FRenderScene {
         TVector<FSceneView>                   Views{};
         TVector<FSceneStaticMesh>             StaticMeshes{};
+        // Unique per FSceneViewBuilder::Build (0 for scenes assembled by hand).
+        u64                                   BuildSerial = 0ULL;
+        u32                                   WorldId     = 0U;
+        // LOD 0 world bounds shared by every batch pass (base pass and all shadow cascades).
+        // Use GetStaticMeshBounds(): with a FSceneBoundsCache the bounds live in the cache
+        // (game thread only, like SpatialIndex) and are only patched for changed entries.
+        FSceneBoundsSoA                       StaticMeshBounds{};
+        const FSceneBoundsSoA*                CachedStaticMeshBounds = nullptr;
+        // Persistent hierarchy synced with StaticMeshes by FSceneViewBuilder (game thread only;
+        // not to be used once the scene has been handed to the render thread).
+        const FSceneSpatialIndex*             SpatialIndex           = nullptr;
+        u64                                   SpatialIndexSerial     = 0ULL;
         RenderCore::Lighting::FLightSceneData Lights{};
 
         ESkyProviderType                      SkyProvider = ESkyProviderType::None;
@@ -112,8 +160,20 @@ namespace AltinaEngine::Engine {
         bool                                  bHasSkyCube = false;
         FPbrSkySceneParameters                PbrSky{};
         bool                                  bHasPbrSky = false;
+
+        [[nodiscard]] auto                    GetStaticMeshBounds() const noexcept
+            -> const FSceneBoundsSoA& {
+            return (CachedStaticMeshBounds != nullptr) ? *CachedStaticMeshBounds
+                                                       : StaticMeshBounds;
+        }
     };
 
+    inline auto FSceneBoundsSoA::IsBuiltFor(const FRenderScene& scene, u32 lodIndex) const noexcept
+        -> bool {
+        return Count == scene.StaticMeshes.Size() && LodIndex == lodIndex
+            && SceneSerial == scene.BuildSerial && Count > 0U;
+    }
+
     struct AE_ENGINE_API FSceneViewBuildParams {
         RenderCore::View::FViewRect             ViewRect{};
         RenderCore::View::FRenderTargetExtent2D RenderTargetExtent{};
@@ -123,6 +183,8 @@ namespace AltinaEngine::Engine {
         bool                                    bReverseZ           = true;
         FSceneView::FTargetHandle               ViewTarget{};
         const RenderCore::View::FCameraData*    PrimaryCameraOverride = nullptr;
+        FSceneSpatialIndex*                     SpatialIndex          = nullptr;
+        FSceneBoundsCache*                      BoundsCache           = nullptr;
     };
 
     class AE_ENGINE_API FSceneViewBuilder {
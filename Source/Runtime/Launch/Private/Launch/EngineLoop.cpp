@@ -24,7 +24,9 @@
 #endif
 
 #include "Console/ConsoleVariable.h"
+#include "Instrumentation/Instrumentation.h"
 #include "Logging/Log.h"
+#include "Memory/FrameAllocator.h"
 #include "Platform/PlatformFileSystem.h"
 #include "Utility/EngineConfig/EngineConfig.h"
 #include "Utility/Filesystem/Path.h"
@@ -122,8 +124,11 @@ namespace AltinaEngine::Launch {
     }
 
     namespace {
+        // Draw lists are shared with the retained caches that built them; see
+        // Engine::FSceneDrawListCache.
+        using FSharedDrawList = Engine::FSceneDrawListCache::FSharedDrawList;
         using FShadowCascadeDrawListArray =
-            TArray<RenderCore::Render::FDrawList, RenderCore::Shadow::kMaxCascades>;
+            TArray<FSharedDrawList, RenderCore::Shadow::kMaxCascades>;
 
         constexpr auto     kFrameTimingCategory = TEXT("FrameTiming");
 
@@ -535,11 +540,6 @@ namespace AltinaEngine::Launch {
             return nullptr;
         }
 
-        void ExecuteFrameGraph(Rhi::FRhiDevice& device, RenderCore::FFrameGraph& graph) {
-            RenderCore::FFrameGraphExecutor executor(device);
-            executor.Execute(graph);
-        }
-
         struct FSceneRenderCaches {
             Asset::FAssetHandle                                SkyCubeAsset{};
             GameScene::FSkyCubeComponent::FSkyCubeRhiResources SkyCubeRhi{};
@@ -556,6 +556,13 @@ namespace AltinaEngine::Launch {
             Asset::FAssetHandle                                BrdfLutAsset{};
             Rhi::FRhiTextureRef                                BrdfLutTexture{};
             bool                                               HasBrdfLutTexture = false;
+
+            // Shared by the per-view frame graphs so their transients survive across frames.
+            RenderCore::FFrameGraphTransientPool               FrameGraphTransientPool{};
+            // Compile results of the per-view graph declarations seen in recent frames.
+            RenderCore::FFrameGraphCompileCache                FrameGraphCompileCache{};
+            // Keeps the per-queue command contexts and timelines across frames.
+            TOwner<RenderCore::FFrameGraphExecutor>            FrameGraphExecutor{};
         };
 
         auto GetSceneRenderCaches() -> FSceneRenderCaches& {
@@ -577,6 +584,17 @@ namespace AltinaEngine::Launch {
             caches.BrdfLutAsset        = {};
             caches.BrdfLutTexture.Reset();
             caches.HasBrdfLutTexture = false;
+            caches.FrameGraphTransientPool.Reset();
+            caches.FrameGraphCompileCache.Reset();
+            caches.FrameGraphExecutor.Reset();
+        }
+
+        void ExecuteFrameGraph(Rhi::FRhiDevice& device, RenderCore::FFrameGraph& graph) {
+            auto& executor = GetSceneRenderCaches().FrameGraphExecutor;
+            if (!executor || executor->GetDevice() != &device) {
+                executor = MakeUnique<RenderCore::FFrameGraphExecutor>(device);
+            }
+            executor->Execute(graph);
         }
 
         void EnsureFallbackBrdfLutTexture(Rhi::FRhiTextureRef& outTexture, bool& outHasTexture) {
@@ -627,7 +645,7 @@ namespace AltinaEngine::Launch {
         }
 
         void SendSceneRenderingRequest(Rhi::FRhiDevice& device, Rhi::FRhiViewport* defaultViewport,
-            Engine::FRenderScene& scene, const TVector<RenderCore::Render::FDrawList>& drawLists,
+            Engine::FRenderScene& scene, const TVector<FSharedDrawList>& drawLists,
             const TVector<FShadowCascadeDrawListArray>& shadowDrawLists,
             Rendering::ERendererType rendererType, const Asset::FAssetRegistry* assetRegistry,
             Asset::FAssetManager* assetManager, Rhi::FRhiTexture* primaryViewOutputOverride) {
@@ -948,12 +966,12 @@ namespace AltinaEngine::Launch {
                 Rendering::FRenderViewContext viewContext{};
                 viewContext.ViewKey  = viewKey;
                 viewContext.View     = &view.View;
-                viewContext.DrawList = (i < drawLists.Size()) ? &drawLists[i] : nullptr;
+                viewContext.DrawList = (i < drawLists.Size()) ? drawLists[i].Get() : nullptr;
                 if (i < shadowDrawLists.Size()) {
                     for (u32 cascadeIndex = 0U; cascadeIndex < RenderCore::Shadow::kMaxCascades;
                         ++cascadeIndex) {
                         viewContext.ShadowDrawLists[cascadeIndex] =
-                            &shadowDrawLists[i][cascadeIndex];
+                            shadowDrawLists[i][cascadeIndex].Get();
                     }
                 }
                 viewContext.OutputTarget = outputTarget;
@@ -979,7 +997,8 @@ namespace AltinaEngine::Launch {
                 renderer->SetViewContext(viewContext);
 
                 const auto              renderBuildStart = std::chrono::steady_clock::now();
-                RenderCore::FFrameGraph graph(device);
+                RenderCore::FFrameGraph graph(
+                    device, &cache.FrameGraphTransientPool, &cache.FrameGraphCompileCache);
                 renderer->Render(graph);
                 const f64  renderBuildMs = ElapsedMilliseconds(renderBuildStart);
 
@@ -993,10 +1012,24 @@ namespace AltinaEngine::Launch {
                 const f64 viewMs         = ElapsedMilliseconds(viewStart);
                 renderViewsMs += viewMs;
 
+                const auto& transientStats = graph.GetTransientStats();
+                const auto& compileStats   = graph.GetCompileStats();
+                const auto& recordStats    = graph.GetRecordStats();
+                const auto& executorStats  = cache.FrameGraphExecutor->GetStats();
                 LogInfoCat(kFrameTimingCategory,
                     TEXT(
-                        "RenderThread.View index={} buildMs={:.3f} compileMs={:.3f} executeMs={:.3f} totalMs={:.3f}"),
-                    static_cast<u32>(i), renderBuildMs, graphCompileMs, graphExecuteMs, viewMs);
+                        "RenderThread.View index={} buildMs={:.3f} compileMs={:.3f} executeMs={:.3f} totalMs={:.3f} transientKB naive={} peak={} allocated={} created={} passes={} culled={} merged={} cacheHit={} barriersReused={} viewsCreated={} compileSavedUs={:.1f} parallelPasses={} recordLists={} recordUs={:.1f} async={} hoisted={} submits={} waits={}"),
+                    static_cast<u32>(i), renderBuildMs, graphCompileMs, graphExecuteMs, viewMs,
+                    transientStats.NaiveBytes / 1024ULL, transientStats.PeakLiveBytes / 1024ULL,
+                    transientStats.AllocatedBytes / 1024ULL, transientStats.Created,
+                    compileStats.Passes, compileStats.CulledPasses, compileStats.MergedPasses,
+                    compileStats.CacheHit ? 1U : 0U, compileStats.TransitionsReused ? 1U : 0U,
+                    compileStats.ViewsCreated,
+                    static_cast<f64>(compileStats.SavedNanoseconds) / 1000.0,
+                    recordStats.ParallelPasses, recordStats.RecordedLists,
+                    static_cast<f64>(recordStats.RecordNanoseconds) / 1000.0,
+                    executorStats.AsyncPasses, executorStats.HoistedPasses, executorStats.Submits,
+                    executorStats.Waits);
 
                 Rendering::TemporalAA::FinalizeViewForFrame(
                     viewKey, view.View, bEnableJitter, sampleCount);
@@ -1227,6 +1260,7 @@ namespace AltinaEngine::Launch {
             initDesc = ResolveRhiInitDesc(config, backend);
 
             Rhi::FRhiDeviceDesc deviceDesc = ResolveRhiDeviceDesc(initDesc);
+            deviceDesc.mPipelineCacheDir   = ResolveRhiPipelineCacheDir(config);
             mRhiDevice                     = Rhi::RHIInit(*mRhiContext, initDesc, deviceDesc);
             return mRhiDevice != nullptr;
         };
@@ -1358,6 +1392,9 @@ namespace AltinaEngine::Launch {
             return false;
         }
 
+        AE_TRACE_SCOPE("EngineLoop.BeginFrame");
+        // Frame scratch of the game thread; the rendering thread flips its own in RenderFrame.
+        Core::Memory::FFrameMemory::BeginFrame();
         mFrameActive          = true;
         mHostFrameIndex       = frameContext.FrameIndex;
         mLastDeltaTimeSeconds = frameContext.DeltaSeconds;
@@ -1386,6 +1423,7 @@ namespace AltinaEngine::Launch {
             return;
         }
 
+        AE_TRACE_SCOPE("EngineLoop.TickSimulation");
         const f32 scaledDelta = tick.DeltaSeconds * tick.TimeScale;
         if (auto* world = mEngineRuntime.GetWorldManager().GetActiveWorld()) {
             world->Tick(scaledDelta);
@@ -1396,6 +1434,7 @@ namespace AltinaEngine::Launch {
         if (!mFrameActive || !mIsRunning || !mRhiDevice) {
             return;
         }
+        AE_TRACE_SCOPE("EngineLoop.RenderFrame");
         Draw(tick);
     }
 
@@ -1505,8 +1544,14 @@ namespace AltinaEngine::Launch {
         }
 
         Engine::FRenderScene                   renderScene;
-        TVector<RenderCore::Render::FDrawList> drawLists;
+        TVector<FSharedDrawList>               drawLists;
         TVector<FShadowCascadeDrawListArray>   shadowDrawLists;
+        u32                                    drawListCacheHits    = 0U;
+        u32                                    drawListCacheLookups = 0U;
+        const auto accumulateDrawListCacheStats = [&](const Engine::FSceneDrawListCache& cache) {
+            drawListCacheHits += cache.GetStats().Hits;
+            drawListCacheLookups += cache.GetStats().VisibleMeshes;
+        };
 
         if (renderWidth > 0U && renderHeight > 0U) {
             if (auto* world = mEngineRuntime.GetWorldManager().GetActiveWorld()) {
@@ -1521,6 +1566,8 @@ namespace AltinaEngine::Launch {
                 viewParams.ViewTarget.Viewport = viewport.Get();
                 viewParams.PrimaryCameraOverride =
                     tick.bUseExternalPrimaryCamera ? &tick.ExternalPrimaryCamera : nullptr;
+                viewParams.BoundsCache  = &mSceneBoundsCache;
+                viewParams.SpatialIndex = &mSceneSpatialIndex;
 
                 Engine::FSceneViewBuilder viewBuilder;
                 viewBuilder.Build(*world, viewParams, renderScene);
@@ -1532,11 +1579,16 @@ namespace AltinaEngine::Launch {
                     batchParams.bEnableFrustumCulling = true;
                     drawLists.Resize(renderScene.Views.Size());
                     shadowDrawLists.Resize(renderScene.Views.Size());
+                    constexpr usize kDrawListCachesPerView = 1U + RenderCore::Shadow::kMaxCascades;
+                    mDrawListCaches.Resize(renderScene.Views.Size() * kDrawListCachesPerView);
                     for (usize i = 0; i < renderScene.Views.Size(); ++i) {
+                        auto* viewDrawListCaches = &mDrawListCaches[i * kDrawListCachesPerView];
                         batchParams.mDebugName.Assign(TEXT("BasePass.View"));
                         batchParams.mDebugName.AppendNumber(static_cast<u32>(i));
                         batchBuilder.Build(renderScene, renderScene.Views[i], batchParams,
-                            mMaterialCache, drawLists[i]);
+                            mMaterialCache, viewDrawListCaches[0]);
+                        drawLists[i] = viewDrawListCaches[0].ShareDrawList();
+                        accumulateDrawListCacheStats(viewDrawListCaches[0]);
 
                         // Shadow pass draw list (Directional CSM).
                         Engine::FSceneBatchBuildParams shadowParams = batchParams;
@@ -1590,12 +1642,15 @@ namespace AltinaEngine::Launch {
                             shadowParams.mDebugName.AppendNumber(static_cast<u32>(i));
                             shadowParams.mDebugName.Append(TEXT(".Cascade"));
                             shadowParams.mDebugName.AppendNumber(cascadeIndex);
+                            auto& shadowCache = viewDrawListCaches[1U + cascadeIndex];
                             batchBuilder.Build(renderScene, renderScene.Views[i], shadowParams,
-                                mMaterialCache, shadowDrawLists[i][cascadeIndex]);
+                                mMaterialCache, shadowCache);
+                            shadowDrawLists[i][cascadeIndex] = shadowCache.ShareDrawList();
+                            accumulateDrawListCacheStats(shadowCache);
                         }
                     }
-                    for (auto& drawList : drawLists) {
-                        for (const auto& bucket : drawList.mBuckets) {
+                    for (const auto& drawList : drawLists) {
+                        for (const auto& bucket : drawList->mBuckets) {
                             if (bucket.mMaterial != nullptr) {
                                 auto* material =
                                     const_cast<RenderCore::FMaterial*>(bucket.mMaterial);
@@ -1604,8 +1659,11 @@ namespace AltinaEngine::Launch {
                         }
                     }
                     for (auto& shadowViewDrawLists : shadowDrawLists) {
-                        for (auto& drawList : shadowViewDrawLists) {
-                            for (const auto& bucket : drawList.mBuckets) {
+                        for (const auto& drawList : shadowViewDrawLists) {
+                            if (!drawList) {
+                                continue; // cascade not in use
+                            }
+                            for (const auto& bucket : drawList->mBuckets) {
                                 if (bucket.mMaterial != nullptr) {
                                     auto* material =
                                         const_cast<RenderCore::FMaterial*>(bucket.mMaterial);
@@ -1624,16 +1682,18 @@ namespace AltinaEngine::Launch {
 
         u32 totalBatches = 0U;
         for (const auto& drawList : drawLists) {
-            totalBatches += drawList.GetBatchCount();
+            totalBatches += drawList ? drawList->GetBatchCount() : 0U;
         }
 
         if (mDebugGui && mInputSystem) {
             DebugGui::FDebugGuiExternalStats stats{};
-            stats.mFrameIndex      = frameIndex;
-            stats.mViewCount       = static_cast<u32>(renderScene.Views.Size());
-            stats.mSceneBatchCount = totalBatches;
-            stats.mDpi             = windowDpi;
-            stats.mDpiScale        = windowDpiScale;
+            stats.mFrameIndex           = frameIndex;
+            stats.mViewCount            = static_cast<u32>(renderScene.Views.Size());
+            stats.mSceneBatchCount      = totalBatches;
+            stats.mDrawListCacheHits    = drawListCacheHits;
+            stats.mDrawListCacheLookups = drawListCacheLookups;
+            stats.mDpi                  = windowDpi;
+            stats.mDpiScale             = windowDpiScale;
             mDebugGui->SetExternalStats(stats);
             mDebugGui->TickGameThread(
                 *mInputSystem.Get(), mLastDeltaTimeSeconds, windowWidth, windowHeight);
@@ -1642,7 +1702,8 @@ namespace AltinaEngine::Launch {
         auto* assetRegistry = &mAssetRegistry;
         auto* assetManager  = &mAssetManager;
 
-        auto  handle = RenderCore::EnqueueRenderTask(Container::FString(TEXT("RenderFrame")),
+        static const Container::FName kRenderFrameTaskName(TEXT("RenderFrame"));
+        auto  handle = RenderCore::EnqueueRenderTask(kRenderFrameTaskName,
              [this, device, viewport, callback, debugGui, frameIndex, windowWidth, windowHeight,
                 renderWidth, renderHeight, shouldResize,
                 bRedirectPrimaryViewToOffscreen = tick.bRedirectPrimaryViewToOffscreen,
@@ -1650,6 +1711,7 @@ namespace AltinaEngine::Launch {
                 drawLists = Move(drawLists), shadowDrawLists = Move(shadowDrawLists), rendererType,
                 assetRegistry, assetManager]() mutable -> void {
                 const auto renderThreadFrameStart = std::chrono::steady_clock::now();
+                Core::Memory::FFrameMemory::BeginFrame();
                 Assert(static_cast<bool>(device), TEXT("Launch.EngineLoop"),
                      "RenderFrame: RHI device is null at frame {}.", static_cast<u64>(frameIndex));
                 if (!device)
@@ -1,6 +1,8 @@
 #include "Launch/RhiLaunchConfig.h"
 
+#include "Platform/PlatformFileSystem.h"
 #include "Utility/EngineConfig/EngineConfig.h"
+#include "Utility/Filesystem/Path.h"
 
 namespace AltinaEngine::Launch {
     auto ResolveRhiInitDesc(const Core::Utility::EngineConfig::FConfigCollection& config,
@@ -24,4 +26,26 @@ namespace AltinaEngine::Launch {
         desc.mEnableGpuValidation = initDesc.mEnableGpuValidation;
         return desc;
     }
+
+    auto ResolveRhiPipelineCacheDir(const Core::Utility::EngineConfig::FConfigCollection& config)
+        -> Core::Container::FString {
+        if (config.GetBool(TEXT("Rhi/DisablePipelineCache"))) {
+            return {};
+        }
+        auto dir = config.GetString(TEXT("Rhi/PipelineCacheDir"));
+        if (dir.IsEmptyString()) {
+            dir.Assign(TEXT("Saved/PipelineCache"));
+        }
+        if (Core::Platform::IsAbsolutePath(dir.ToView())) {
+            return dir;
+        }
+        const auto exeDir = Core::Platform::GetExecutableDir();
+        if (exeDir.IsEmptyString()) {
+            return {};
+        }
+        return Core::Utility::Filesystem::FPath(exeDir)
+            .Append(dir.ToView())
+            .Normalized()
+            .GetString();
+    }
 } // namespace AltinaEngine::Launch
@@ -30,6 +30,9 @@
 #include "Rhi/RhiViewport.h"
 #include "Engine/Runtime/EngineRuntime.h"
 #include "Engine/Runtime/MaterialCache.h"
+#include "Engine/Runtime/SceneBatching.h"
+#include "Engine/Runtime/SceneCulling.h"
+#include "Engine/Runtime/SceneSpatialIndex.h"
 #include "Engine/Runtime/StaticMeshCache.h"
 #include "Engine/GameScene/MeshMaterialComponent.h"
 #include "Engine/GameScene/SkyCubeComponent.h"
@@ -299,6 +302,10 @@ namespace AltinaEngine::Launch {
         Asset::FCubeMapLoader                mCubeMapLoader;
         Engine::FMaterialCache               mMaterialCache;
         Engine::FStaticMeshCache             mStaticMeshCache;
+        Engine::FSceneBoundsCache            mSceneBoundsCache;
+        Engine::FSceneSpatialIndex           mSceneSpatialIndex;
+        // Per view: base pass followed by one cache per shadow cascade.
+        TVector<Engine::FSceneDrawListCache> mDrawListCaches;
         TOwner<RenderCore::FRenderingThread> mRenderingThread;
         TOwner<DebugGui::IDebugGuiSystem, TPolymorphicDeleter<DebugGui::IDebugGuiSystem>> mDebugGui;
         FEditorOffscreenCache          mEditorOffscreenCache{};
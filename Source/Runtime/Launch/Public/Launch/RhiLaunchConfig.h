@@ -14,4 +14,9 @@ namespace AltinaEngine::Launch {
 
     AE_LAUNCH_API auto ResolveRhiDeviceDesc(const Rhi::FRhiInitDesc& initDesc) noexcept
         -> Rhi::FRhiDeviceDesc;
+
+    // Rhi/PipelineCacheDir, resolved against the executable directory (default
+    // Saved/PipelineCache). Empty when Rhi/DisablePipelineCache is set.
+    AE_LAUNCH_API auto ResolveRhiPipelineCacheDir(
+        const Core::Utility::EngineConfig::FConfigCollection& config) -> Core::Container::FString;
 } // namespace AltinaEngine::Launch
@@ -1,12 +1,17 @@
 #include "FrameGraph/FrameGraph.h"
 
+#include "Container/HashUtility.h"
+#include "Jobs/Parallel.h"
+#include "Memory/FrameAllocator.h"
 #include "Rhi/Command/RhiCmdContext.h"
+#include "Rhi/Command/RhiCmdListContext.h"
 #include "Rhi/RhiDevice.h"
 #include "Rhi/RhiResourceView.h"
 #include "Logging/Log.h"
 #include "Utility/String/CodeConvert.h"
 #include "Utility/Assert.h"
 
+#include <chrono>
 #include <cstring>
 #include <string>
 
@@ -19,6 +24,47 @@ namespace AltinaEngine::RenderCore {
             bool                   mInitialized = false;
             Rhi::ERhiResourceState mState       = Rhi::ERhiResourceState::Unknown;
         };
+
+        constexpr u32 kInvalidTransientSlot = ~0U;
+        constexpr u32 kNoPass               = ~0U;
+        constexpr u32 kNoRecordedList       = ~0U;
+
+        struct FTransientLifetime {
+            u32                    mFirstPass  = kNoPass;
+            u32                    mLastPass   = 0U;
+            Rhi::ERhiResourceState mFinalState = Rhi::ERhiResourceState::Unknown;
+            u64                    mSizeBytes  = 0ULL;
+            bool                   mPoolable   = true;
+        };
+
+        // CPU-visible resources may still be read back or mapped by a previous frame.
+        auto IsCpuVisible(Rhi::ERhiResourceUsage usage, Rhi::ERhiCpuAccess cpuAccess) noexcept
+            -> bool {
+            return cpuAccess != Rhi::ERhiCpuAccess::None || usage == Rhi::ERhiResourceUsage::Dynamic
+                || usage == Rhi::ERhiResourceUsage::Staging;
+        }
+
+        [[nodiscard]] auto ElapsedNanoseconds(
+            const std::chrono::steady_clock::time_point& startTime) noexcept -> u64 {
+            using namespace std::chrono;
+            return static_cast<u64>(
+                duration_cast<nanoseconds>(steady_clock::now() - startTime).count());
+        }
+
+        void FinalizeLifetime(FTransientLifetime& lifetime, u32 lastPass, bool isExternalOutput,
+            Rhi::ERhiResourceState outputState) {
+            // Resources no pass declared an access for stay alive for the whole graph.
+            if (lifetime.mFirstPass == kNoPass) {
+                lifetime.mFirstPass = 0U;
+                lifetime.mLastPass  = lastPass;
+            }
+            if (isExternalOutput) {
+                lifetime.mLastPass = lastPass;
+                if (outputState != Rhi::ERhiResourceState::Unknown) {
+                    lifetime.mFinalState = outputState;
+                }
+            }
+        }
     } // namespace
 
     auto FFrameGraphPassResources::GetTexture(FFrameGraphTextureRef ref) const
@@ -137,7 +183,15 @@ namespace AltinaEngine::RenderCore {
 
     void FFrameGraphPassBuilder::SetSideEffect() { mGraph.SetSideEffectInternal(mPassIndex); }
 
-    FFrameGraph::FFrameGraph(Rhi::FRhiDevice& device) : mDevice(&device) {}
+    void FFrameGraphPassBuilder::SetRecordChunks(u32 chunkCount) {
+        mGraph.SetRecordChunksInternal(mPassIndex, chunkCount);
+    }
+
+    FFrameGraph::FFrameGraph(Rhi::FRhiDevice& device, FFrameGraphTransientPool* transientPool,
+        FFrameGraphCompileCache* compileCache)
+        : mDevice(&device)
+        , mTransientPool((transientPool != nullptr) ? transientPool : &mOwnedTransientPool)
+        , mCompileCache((compileCache != nullptr) ? compileCache : &mOwnedCompileCache) {}
 
     FFrameGraph::~FFrameGraph() { ResetGraph(); }
 
@@ -172,32 +226,74 @@ namespace AltinaEngine::RenderCore {
             return;
         }
 
-        for (auto& texture : mTextures) {
-            if (texture.mIsExternal || texture.mTexture) {
-                continue;
-            }
-            texture.mTexture = mDevice->CreateTexture(texture.mDesc.mDesc);
-            DebugAssert(static_cast<bool>(texture.mTexture), TEXT("RenderCore.FrameGraph"),
-                "CreateTexture failed: debugName='{}', width={}, height={}, format={}, bindFlags={}.",
-                texture.mDesc.mDesc.mDebugName.ToView(), texture.mDesc.mDesc.mWidth,
-                texture.mDesc.mDesc.mHeight, static_cast<u32>(texture.mDesc.mDesc.mFormat),
-                static_cast<u32>(texture.mDesc.mDesc.mBindFlags));
+        const auto compileStart = std::chrono::steady_clock::now();
+        mCompileStats           = {};
+        mCompileStats.Passes    = static_cast<u32>(mPasses.Size());
+
+        // Culling and merging only depend on the declaration; the barriers also depend on the
+        // states the bound resources start in, which are checked once they are allocated.
+        auto&     cache  = *mCompileCache;
+        const u64 hash   = HashDeclaration();
+        auto*     cached = cache.Find(hash, static_cast<u32>(mPasses.Size()),
+                static_cast<u32>(mTextures.Size()), static_cast<u32>(mBuffers.Size()));
+
+        u64       cullNanoseconds = 0ULL;
+        if (cached != nullptr) {
+            ApplyCachedCulling(*cached);
+        } else {
+            const auto cullStart = std::chrono::steady_clock::now();
+            CullPasses();
+            cullNanoseconds = ElapsedNanoseconds(cullStart);
         }
 
-        for (auto& buffer : mBuffers) {
-            if (buffer.mIsExternal || buffer.mBuffer) {
-                continue;
-            }
-            buffer.mBuffer = mDevice->CreateBuffer(buffer.mDesc.mDesc);
-            DebugAssert(static_cast<bool>(buffer.mBuffer), TEXT("RenderCore.FrameGraph"),
-                "CreateBuffer failed: debugName='{}', sizeBytes={}, usage={}, bindFlags={}, cpuAccess={}.",
-                buffer.mDesc.mDesc.mDebugName.ToView(), buffer.mDesc.mDesc.mSizeBytes,
-                static_cast<u32>(buffer.mDesc.mDesc.mUsage),
-                static_cast<u32>(buffer.mDesc.mDesc.mBindFlags),
-                static_cast<u32>(buffer.mDesc.mDesc.mCpuAccess));
+        AllocateTransientResources();
+        CreateViews();
+        CompileAttachments();
+
+        const bool bReuseTransitions = (cached != nullptr) && HasCachedStartStates(*cached);
+        if (cached == nullptr) {
+            auto& entry = cache.Add(hash);
+            StoreCulling(entry);
+            entry.mCullNanoseconds = cullNanoseconds;
+            CompileTransitions(&entry);
+            ++cache.mStats.Misses;
+        } else if (bReuseTransitions) {
+            RestoreTransitions(*cached);
+            mCompileStats.TransitionsReused = true;
+            mCompileStats.SavedNanoseconds  = cached->mCullNanoseconds
+                + cached->mTransitionNanoseconds;
+            ++cache.mStats.TransitionHits;
+        } else {
+            CompileTransitions(cached);
+            mCompileStats.SavedNanoseconds = cached->mCullNanoseconds;
+        }
+        if (cached != nullptr) {
+            mCompileStats.CacheHit = true;
+            ++cache.mStats.Hits;
+            cache.mStats.SavedNanoseconds += mCompileStats.SavedNanoseconds;
         }
 
+        mCompileStats.CompileNanoseconds = ElapsedNanoseconds(compileStart);
+        mCompiled                        = true;
+    }
+
+    void FFrameGraph::CreateViews() {
+        // Views of pooled transients stay with the pooled object, so a steady-state frame finds
+        // them there instead of creating new ones.
+        auto& pool      = *mTransientPool;
+        auto  countView = [this](bool bReused) {
+            if (bReused) {
+                ++mCompileStats.ViewsReused;
+            } else {
+                ++mCompileStats.ViewsCreated;
+            }
+        };
+
         for (auto& SRV : mSRVs) {
+            if (IsCulledResource(SRV.mIsTexture, SRV.mResourceId)) {
+                SRV.mView.Reset();
+                continue;
+            }
             auto desc = SRV.mDesc;
             if (SRV.mIsTexture) {
                 desc.mTexture = ResolveTexture(FFrameGraphTextureRef{ SRV.mResourceId });
@@ -210,13 +306,22 @@ namespace AltinaEngine::RenderCore {
                 TEXT("RenderCore.FrameGraph"),
                 "CreateSRV failed precondition: resource is null (isTexture={}, resourceId={}).",
                 SRV.mIsTexture ? 1U : 0U, SRV.mResourceId);
-            SRV.mView = mDevice->CreateShaderResourceView(desc);
+            const u32 slot    = GetTransientSlot(SRV.mIsTexture, SRV.mResourceId);
+            bool      bReused = false;
+            SRV.mView         = (slot != kInvalidTransientSlot)
+                        ? pool.GetSRV(SRV.mIsTexture, slot, desc, bReused)
+                        : mDevice->CreateShaderResourceView(desc);
+            countView(bReused);
             DebugAssert(static_cast<bool>(SRV.mView), TEXT("RenderCore.FrameGraph"),
                 "CreateSRV failed: isTexture={}, resourceId={}, debugName='{}'.",
                 SRV.mIsTexture ? 1U : 0U, SRV.mResourceId, desc.mDebugName.ToView());
         }
 
         for (auto& UAV : mUAVs) {
+            if (IsCulledResource(UAV.mIsTexture, UAV.mResourceId)) {
+                UAV.mView.Reset();
+                continue;
+            }
             auto desc = UAV.mDesc;
             if (UAV.mIsTexture) {
                 desc.mTexture = ResolveTexture(FFrameGraphTextureRef{ UAV.mResourceId });
@@ -229,58 +334,67 @@ namespace AltinaEngine::RenderCore {
                 TEXT("RenderCore.FrameGraph"),
                 "CreateUAV failed precondition: resource is null (isTexture={}, resourceId={}).",
                 UAV.mIsTexture ? 1U : 0U, UAV.mResourceId);
-            UAV.mView = mDevice->CreateUnorderedAccessView(desc);
+            const u32 slot    = GetTransientSlot(UAV.mIsTexture, UAV.mResourceId);
+            bool      bReused = false;
+            UAV.mView         = (slot != kInvalidTransientSlot)
+                        ? pool.GetUAV(UAV.mIsTexture, slot, desc, bReused)
+                        : mDevice->CreateUnorderedAccessView(desc);
+            countView(bReused);
             DebugAssert(static_cast<bool>(UAV.mView), TEXT("RenderCore.FrameGraph"),
                 "CreateUAV failed: isTexture={}, resourceId={}, debugName='{}'.",
                 UAV.mIsTexture ? 1U : 0U, UAV.mResourceId, desc.mDebugName.ToView());
         }
 
         for (auto& RTV : mRTVs) {
+            if (IsCulledResource(true, RTV.mResourceId)) {
+                RTV.mView.Reset();
+                continue;
+            }
             auto desc     = RTV.mDesc;
             desc.mTexture = ResolveTexture(FFrameGraphTextureRef{ RTV.mResourceId });
             DebugAssert(desc.mTexture != nullptr, TEXT("RenderCore.FrameGraph"),
                 "CreateRTV failed precondition: texture is null (resourceId={}, debugName='{}').",
                 RTV.mResourceId, desc.mDebugName.ToView());
-            RTV.mView = mDevice->CreateRenderTargetView(desc);
+            const u32 slot    = GetTransientSlot(true, RTV.mResourceId);
+            bool      bReused = false;
+            RTV.mView         = (slot != kInvalidTransientSlot)
+                        ? pool.GetRTV(slot, desc, bReused)
+                        : mDevice->CreateRenderTargetView(desc);
+            countView(bReused);
             DebugAssert(static_cast<bool>(RTV.mView), TEXT("RenderCore.FrameGraph"),
                 "CreateRTV failed: resourceId={}, debugName='{}', format={}.", RTV.mResourceId,
                 desc.mDebugName.ToView(), static_cast<u32>(desc.mFormat));
         }
 
         for (auto& DSV : mDSVs) {
+            if (IsCulledResource(true, DSV.mResourceId)) {
+                DSV.mView.Reset();
+                continue;
+            }
             auto desc     = DSV.mDesc;
             desc.mTexture = ResolveTexture(FFrameGraphTextureRef{ DSV.mResourceId });
             DebugAssert(desc.mTexture != nullptr, TEXT("RenderCore.FrameGraph"),
                 "CreateDSV failed precondition: texture is null (resourceId={}, debugName='{}').",
                 DSV.mResourceId, desc.mDebugName.ToView());
-            DSV.mView = mDevice->CreateDepthStencilView(desc);
+            const u32 slot    = GetTransientSlot(true, DSV.mResourceId);
+            bool      bReused = false;
+            DSV.mView         = (slot != kInvalidTransientSlot)
+                        ? pool.GetDSV(slot, desc, bReused)
+                        : mDevice->CreateDepthStencilView(desc);
+            countView(bReused);
             DebugAssert(static_cast<bool>(DSV.mView), TEXT("RenderCore.FrameGraph"),
                 "CreateDSV failed: resourceId={}, debugName='{}', format={}.", DSV.mResourceId,
                 desc.mDebugName.ToView(), static_cast<u32>(desc.mFormat));
         }
+    }
 
-        mCompiledBeginTransitions.Clear();
-        mCompiledFinalTransitions.Clear();
-        TVector<FCompiledResourceState> textureStates;
-        TVector<FCompiledResourceState> bufferStates;
-        TVector<bool>                   externalBeginTransitionEmitted;
-        textureStates.Resize(mTextures.Size());
-        bufferStates.Resize(mBuffers.Size());
-        externalBeginTransitionEmitted.Resize(mTextures.Size());
-        for (usize i = 0; i < mTextures.Size(); ++i) {
-            textureStates[i].mInitialized     = true;
-            textureStates[i].mState           = mTextures[i].mDesc.mInitialState;
-            externalBeginTransitionEmitted[i] = false;
-        }
-        for (usize i = 0; i < mBuffers.Size(); ++i) {
-            bufferStates[i].mInitialized = true;
-            bufferStates[i].mState       = mBuffers[i].mDesc.mInitialState;
-        }
-
+    void FFrameGraph::CompileAttachments() {
         for (auto& pass : mPasses) {
             pass.mCompiledColorAttachments.Clear();
             pass.mHasCompiledDepth = false;
-            pass.mCompiledPreTransitions.Clear();
+            if (pass.mIsCulled) {
+                continue;
+            }
 
             if (!pass.mRenderTargets.IsEmpty()) {
                 pass.mCompiledColorAttachments.Reserve(pass.mRenderTargets.Size());
@@ -298,7 +412,6 @@ namespace AltinaEngine::RenderCore {
                 }
             }
 
-            pass.mHasCompiledDepth = false;
             if (pass.mHasDepthStencil) {
                 const auto& binding         = pass.mDepthStencil;
                 auto&       depthAtt        = pass.mCompiledDepthAttachment;
@@ -310,6 +423,70 @@ namespace AltinaEngine::RenderCore {
                 depthAtt.mClearDepthStencil = binding.mClearDepthStencil;
                 pass.mHasCompiledDepth      = (depthAtt.mView != nullptr);
             }
+        }
+    }
+
+    void FFrameGraph::CompileTransitions(FFrameGraphCompileCache::FEntry* record) {
+        const auto compileStart = std::chrono::steady_clock::now();
+
+        mCompiledBeginTransitions.Clear();
+        mCompiledFinalTransitions.Clear();
+        TFrameVector<FCompiledResourceState> textureStates;
+        TFrameVector<FCompiledResourceState> bufferStates;
+        TFrameVector<bool>                   externalBeginTransitionEmitted;
+        textureStates.Resize(mTextures.Size());
+        bufferStates.Resize(mBuffers.Size());
+        externalBeginTransitionEmitted.Resize(mTextures.Size());
+        for (usize i = 0; i < mTextures.Size(); ++i) {
+            textureStates[i].mInitialized     = true;
+            textureStates[i].mState           = mTextures[i].mStartState;
+            externalBeginTransitionEmitted[i] = false;
+        }
+        for (usize i = 0; i < mBuffers.Size(); ++i) {
+            bufferStates[i].mInitialized = true;
+            bufferStates[i].mState       = mBuffers[i].mStartState;
+        }
+
+        // Every barrier is also recorded by resource handle, so a cache hit can rebind it to
+        // whatever object the resource resolves to in that frame.
+        if (record != nullptr) {
+            record->mBeginTransitions.Clear();
+            record->mFinalTransitions.Clear();
+            record->mTextureStartStates.Resize(mTextures.Size());
+            record->mBufferStartStates.Resize(mBuffers.Size());
+            for (usize i = 0; i < mTextures.Size(); ++i) {
+                record->mTextureStartStates[i] = mTextures[i].mStartState;
+            }
+            for (usize i = 0; i < mBuffers.Size(); ++i) {
+                record->mBufferStartStates[i] = mBuffers[i].mStartState;
+            }
+        }
+        const auto recordTransition = [](TVector<FFrameGraphCompileCache::FTransition>* list,
+                                          bool isTexture, u32 resourceId,
+                                          const Rhi::FRhiTransitionInfo& info) {
+            if (list == nullptr) {
+                return;
+            }
+            auto& transition           = list->EmplaceBack();
+            transition.mIsTexture      = isTexture;
+            transition.mResourceId     = resourceId;
+            transition.mInfo           = info;
+            transition.mInfo.mResource = nullptr;
+        };
+
+        for (usize passIndex = 0; passIndex < mPasses.Size(); ++passIndex) {
+            auto& pass = mPasses[passIndex];
+            pass.mCompiledPreTransitions.Clear();
+            pass.mMergesWithPrevious = false;
+            pass.mMergesWithNext     = false;
+            TVector<FFrameGraphCompileCache::FTransition>* recordPre = nullptr;
+            if (record != nullptr) {
+                recordPre = &record->mPasses[passIndex].mPreTransitions;
+                recordPre->Clear();
+            }
+            if (pass.mIsCulled) {
+                continue;
+            }
 
             for (const auto& access : pass.mAccesses) {
                 if (access.mType == EFrameGraphResourceType::Texture) {
@@ -344,9 +521,13 @@ namespace AltinaEngine::RenderCore {
                         && !externalBeginTransitionEmitted[texIndex];
                     if (isFirstExternalTransition) {
                         mCompiledBeginTransitions.PushBack(info);
+                        recordTransition((record != nullptr) ? &record->mBeginTransitions
+                                                             : nullptr,
+                            true, access.mResourceId, info);
                         externalBeginTransitionEmitted[texIndex] = true;
                     } else {
                         pass.mCompiledPreTransitions.PushBack(info);
+                        recordTransition(recordPre, true, access.mResourceId, info);
                     }
                     state.mState = access.mState;
                     continue;
@@ -377,6 +558,7 @@ namespace AltinaEngine::RenderCore {
                 info.mBefore   = state.mState;
                 info.mAfter    = access.mState;
                 pass.mCompiledPreTransitions.PushBack(info);
+                recordTransition(recordPre, false, access.mResourceId, info);
                 state.mState = access.mState;
             }
         }
@@ -393,7 +575,8 @@ namespace AltinaEngine::RenderCore {
             if (!state.mInitialized || state.mState == entry.mFinalState) {
                 continue;
             }
-            auto* texture = ResolveTexture(FFrameGraphTextureRef{ static_cast<u32>(i + 1U) });
+            const u32 resourceId = static_cast<u32>(i + 1U);
+            auto*     texture    = ResolveTexture(FFrameGraphTextureRef{ resourceId });
             if (texture == nullptr) {
                 continue;
             }
@@ -402,9 +585,185 @@ namespace AltinaEngine::RenderCore {
             info.mBefore   = state.mState;
             info.mAfter    = entry.mFinalState;
             mCompiledFinalTransitions.PushBack(info);
+            recordTransition(
+                (record != nullptr) ? &record->mFinalTransitions : nullptr, true, resourceId, info);
+        }
+
+        MergeRenderPasses();
+
+        if (record != nullptr) {
+            for (usize passIndex = 0; passIndex < mPasses.Size(); ++passIndex) {
+                auto&       cachedPass         = record->mPasses[passIndex];
+                const auto& pass               = mPasses[passIndex];
+                cachedPass.mMergesWithPrevious = pass.mMergesWithPrevious;
+                cachedPass.mMergesWithNext     = pass.mMergesWithNext;
+            }
+            record->mMergedPasses          = mCompileStats.MergedPasses;
+            record->mTransitionNanoseconds = ElapsedNanoseconds(compileStart);
+        }
+    }
+
+    auto FFrameGraph::HashDeclaration() const noexcept -> u64 {
+        const auto hashRange = [](u64 hash, const Rhi::FRhiTextureViewRange& range) {
+            hash = InternalHashCombine(hash, range.mBaseMip);
+            hash = InternalHashCombine(hash, range.mMipCount);
+            hash = InternalHashCombine(hash, range.mBaseArrayLayer);
+            hash = InternalHashCombine(hash, range.mLayerCount);
+            hash = InternalHashCombine(hash, range.mBaseDepthSlice);
+            return InternalHashCombine(hash, range.mDepthSliceCount);
+        };
+        const auto hashResource = [](u64 hash, bool isExternal, bool isExternalOutput,
+                                      Rhi::ERhiResourceState finalState) {
+            hash = InternalHashCombine(
+                hash, (isExternal ? 1ULL : 0ULL) | (isExternalOutput ? 2ULL : 0ULL));
+            return InternalHashCombine(hash, static_cast<u64>(finalState));
+        };
+
+        // Descriptions and bound objects are left out: they only reach the barriers through the
+        // start states, which a hit compares separately.
+        u64 hash = InternalHashCombine(mPasses.Size(), mTextures.Size());
+        hash     = InternalHashCombine(hash, mBuffers.Size());
+        for (const auto& entry : mTextures) {
+            hash =
+                hashResource(hash, entry.mIsExternal, entry.mIsExternalOutput, entry.mFinalState);
+        }
+        for (const auto& entry : mBuffers) {
+            hash =
+                hashResource(hash, entry.mIsExternal, entry.mIsExternalOutput, entry.mFinalState);
+        }
+        for (const auto& RTV : mRTVs) {
+            hash = InternalHashCombine(hash, RTV.mResourceId);
+            hash = InternalHashCombine(hash, static_cast<u64>(RTV.mDesc.mFormat));
+            hash = hashRange(hash, RTV.mDesc.mRange);
+        }
+        for (const auto& DSV : mDSVs) {
+            hash = InternalHashCombine(hash, DSV.mResourceId);
+            hash = InternalHashCombine(hash, static_cast<u64>(DSV.mDesc.mFormat));
+            hash = hashRange(hash, DSV.mDesc.mRange);
+            hash = InternalHashCombine(hash,
+                (DSV.mDesc.mReadOnlyDepth ? 1ULL : 0ULL)
+                    | (DSV.mDesc.mReadOnlyStencil ? 2ULL : 0ULL));
+        }
+
+        for (const auto& pass : mPasses) {
+            hash = InternalHashCombine(hash, static_cast<u64>(pass.mDesc.mType));
+            hash = InternalHashCombine(hash, static_cast<u64>(pass.mDesc.mQueue));
+            hash = InternalHashCombine(hash, static_cast<u64>(pass.mDesc.mFlags));
+            hash = InternalHashCombine(hash, pass.mHasSideEffect ? 1ULL : 0ULL);
+            hash = InternalHashCombine(hash, pass.mAccesses.Size());
+            for (const auto& access : pass.mAccesses) {
+                hash = InternalHashCombine(hash, static_cast<u64>(access.mType));
+                hash = InternalHashCombine(hash, access.mResourceId);
+                hash = InternalHashCombine(hash, static_cast<u64>(access.mState));
+                hash = InternalHashCombine(hash,
+                    (access.mIsWrite ? 1ULL : 0ULL) | (access.mHasRange ? 2ULL : 0ULL));
+                if (access.mHasRange) {
+                    hash = hashRange(hash, access.mRange);
+                }
+            }
+            hash = InternalHashCombine(hash, pass.mRenderTargets.Size());
+            for (const auto& binding : pass.mRenderTargets) {
+                hash = InternalHashCombine(hash, binding.mRTV.mId);
+                hash = InternalHashCombine(hash, static_cast<u64>(binding.mLoadOp));
+                hash = InternalHashCombine(hash, static_cast<u64>(binding.mStoreOp));
+            }
+            hash = InternalHashCombine(hash, pass.mHasDepthStencil ? 1ULL : 0ULL);
+            if (pass.mHasDepthStencil) {
+                const auto& binding = pass.mDepthStencil;
+                hash                = InternalHashCombine(hash, binding.mDSV.mId);
+                hash = InternalHashCombine(hash, static_cast<u64>(binding.mDepthLoadOp));
+                hash = InternalHashCombine(hash, static_cast<u64>(binding.mDepthStoreOp));
+                hash = InternalHashCombine(hash, static_cast<u64>(binding.mStencilLoadOp));
+                hash = InternalHashCombine(hash, static_cast<u64>(binding.mStencilStoreOp));
+            }
+        }
+        return hash;
+    }
+
+    void FFrameGraph::StoreCulling(FFrameGraphCompileCache::FEntry& entry) const {
+        entry.mTextureCount = static_cast<u32>(mTextures.Size());
+        entry.mBufferCount  = static_cast<u32>(mBuffers.Size());
+        entry.mPasses.Resize(mPasses.Size());
+        entry.mCulledTextures.Resize(mTextures.Size());
+        entry.mCulledBuffers.Resize(mBuffers.Size());
+        for (usize i = 0; i < mPasses.Size(); ++i) {
+            entry.mPasses[i].mIsCulled = mPasses[i].mIsCulled;
+        }
+        for (usize i = 0; i < mTextures.Size(); ++i) {
+            entry.mCulledTextures[i] = mTextures[i].mIsCulled;
+        }
+        for (usize i = 0; i < mBuffers.Size(); ++i) {
+            entry.mCulledBuffers[i] = mBuffers[i].mIsCulled;
+        }
+        entry.mCulledPasses       = mCompileStats.CulledPasses;
+        entry.mCulledTextureCount = mCompileStats.CulledTextures;
+        entry.mCulledBufferCount  = mCompileStats.CulledBuffers;
+    }
+
+    void FFrameGraph::ApplyCachedCulling(const FFrameGraphCompileCache::FEntry& entry) {
+        for (usize i = 0; i < mPasses.Size(); ++i) {
+            mPasses[i].mIsCulled = entry.mPasses[i].mIsCulled;
+        }
+        for (usize i = 0; i < mTextures.Size(); ++i) {
+            mTextures[i].mIsCulled = entry.mCulledTextures[i];
+        }
+        for (usize i = 0; i < mBuffers.Size(); ++i) {
+            mBuffers[i].mIsCulled = entry.mCulledBuffers[i];
+        }
+        mCompileStats.CulledPasses   = entry.mCulledPasses;
+        mCompileStats.CulledTextures = entry.mCulledTextureCount;
+        mCompileStats.CulledBuffers  = entry.mCulledBufferCount;
+    }
+
+    auto FFrameGraph::HasCachedStartStates(const FFrameGraphCompileCache::FEntry& entry) const
+        noexcept -> bool {
+        if (entry.mTextureStartStates.Size() != mTextures.Size()
+            || entry.mBufferStartStates.Size() != mBuffers.Size()) {
+            return false;
         }
+        for (usize i = 0; i < mTextures.Size(); ++i) {
+            if (entry.mTextureStartStates[i] != mTextures[i].mStartState) {
+                return false;
+            }
+        }
+        for (usize i = 0; i < mBuffers.Size(); ++i) {
+            if (entry.mBufferStartStates[i] != mBuffers[i].mStartState) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void FFrameGraph::RestoreTransitions(const FFrameGraphCompileCache::FEntry& entry) {
+        const auto restore = [this](const TVector<FFrameGraphCompileCache::FTransition>& cached,
+                                 auto&                                                compiled) {
+            compiled.Clear();
+            compiled.Reserve(cached.Size());
+            for (const auto& transition : cached) {
+                Rhi::FRhiResource* resource = transition.mIsTexture
+                    ? static_cast<Rhi::FRhiResource*>(
+                          ResolveTexture(FFrameGraphTextureRef{ transition.mResourceId }))
+                    : static_cast<Rhi::FRhiResource*>(
+                          ResolveBuffer(FFrameGraphBufferRef{ transition.mResourceId }));
+                if (resource == nullptr) {
+                    continue;
+                }
+                auto& info     = compiled.EmplaceBack();
+                info           = transition.mInfo;
+                info.mResource = resource;
+            }
+        };
 
-        mCompiled = true;
+        restore(entry.mBeginTransitions, mCompiledBeginTransitions);
+        restore(entry.mFinalTransitions, mCompiledFinalTransitions);
+        for (usize i = 0; i < mPasses.Size(); ++i) {
+            auto&       pass       = mPasses[i];
+            const auto& cachedPass = entry.mPasses[i];
+            restore(cachedPass.mPreTransitions, pass.mCompiledPreTransitions);
+            pass.mMergesWithPrevious = cachedPass.mMergesWithPrevious;
+            pass.mMergesWithNext     = cachedPass.mMergesWithNext;
+        }
+        mCompileStats.MergedPasses = entry.mMergedPasses;
     }
 
     void FFrameGraph::Execute(Rhi::FRhiCmdContext& cmdContext) {
@@ -412,6 +771,8 @@ namespace AltinaEngine::RenderCore {
             Compile();
         }
 
+        RecordParallelPasses();
+
         FFrameGraphPassResources resources(*this);
 
         static bool              sLoggedOnce = false;
@@ -422,10 +783,11 @@ namespace AltinaEngine::RenderCore {
                 const std::string name =
                     (pass.mDesc.mName != nullptr) ? std::string(pass.mDesc.mName) : "<null>";
                 LogInfoCat(TEXT("RenderCore.FrameGraph"),
-                    TEXT("FG Pass[{}]: {} type={} rtvs={} depth={}"), passIndex, name.c_str(),
-                    static_cast<u32>(pass.mDesc.mType),
+                    TEXT("FG Pass[{}]: {} type={} rtvs={} depth={} culled={} merged={}"),
+                    passIndex, name.c_str(), static_cast<u32>(pass.mDesc.mType),
                     static_cast<u32>(pass.mCompiledColorAttachments.Size()),
-                    pass.mHasCompiledDepth ? 1U : 0U);
+                    pass.mHasCompiledDepth ? 1U : 0U, pass.mIsCulled ? 1U : 0U,
+                    pass.mMergesWithPrevious ? 1U : 0U);
                 ++passIndex;
             }
         }
@@ -438,7 +800,18 @@ namespace AltinaEngine::RenderCore {
             cmdContext.RHIBeginTransition(transition);
         }
 
+        bool renderPassOpen = false;
         for (auto& pass : mPasses) {
+            if (pass.mIsCulled) {
+                continue;
+            }
+            // Merged passes never carry pre-transitions, so the open render pass is kept.
+            const bool continuesRenderPass = renderPassOpen && pass.mMergesWithPrevious;
+            if (renderPassOpen && !continuesRenderPass) {
+                cmdContext.RHIEndRenderPass();
+                renderPassOpen = false;
+            }
+
             if (!pass.mCompiledPreTransitions.IsEmpty()) {
                 Rhi::FRhiTransitionCreateInfo transition{};
                 transition.mTransitions     = pass.mCompiledPreTransitions.Data();
@@ -448,13 +821,12 @@ namespace AltinaEngine::RenderCore {
                 cmdContext.RHIBeginTransition(transition);
             }
 
-            const bool hasRenderPass = pass.mDesc.mType == EFrameGraphPassType::Raster
-                && (!pass.mCompiledColorAttachments.IsEmpty() || pass.mHasCompiledDepth);
+            const bool hasRenderPass = pass.HasRenderPass();
             if (pass.mDesc.mType == EFrameGraphPassType::Raster && !hasRenderPass) {
                 continue;
             }
 
-            if (hasRenderPass) {
+            if (hasRenderPass && !continuesRenderPass) {
                 Rhi::FRhiRenderPassDesc renderPassDesc;
                 if (pass.mDesc.mName != nullptr) {
                     renderPassDesc.mDebugName.Assign(Core::Utility::String::FromUtf8Bytes(
@@ -468,16 +840,16 @@ namespace AltinaEngine::RenderCore {
                 cmdContext.RHIBeginRenderPass(renderPassDesc);
             }
 
-            if (pass.mExecute) {
-                pass.mExecute(cmdContext, resources, pass.mPassData, pass.mExecuteUserData);
-            } else if (pass.mDesc.mExecute) {
-                pass.mDesc.mExecute(cmdContext, resources);
-            }
+            ExecutePassBody(pass, cmdContext);
 
-            if (hasRenderPass) {
+            renderPassOpen = hasRenderPass && pass.mMergesWithNext;
+            if (hasRenderPass && !renderPassOpen) {
                 cmdContext.RHIEndRenderPass();
             }
         }
+        if (renderPassOpen) {
+            cmdContext.RHIEndRenderPass();
+        }
 
         if (!mCompiledFinalTransitions.IsEmpty()) {
             Rhi::FRhiTransitionCreateInfo transition{};
@@ -489,6 +861,91 @@ namespace AltinaEngine::RenderCore {
         }
     }
 
+    void FFrameGraph::RecordParallelPasses() {
+        mRecordStats = {};
+        for (auto& pass : mPasses) {
+            pass.mFirstRecordedList = kNoRecordedList;
+        }
+
+        struct FRecordJob {
+            u32 mPassIndex = 0U;
+            u32 mChunk     = 0U;
+        };
+        TFrameVector<FRecordJob> jobs;
+        u32                      parallelPasses = 0U;
+        for (u32 passIndex = 0U; passIndex < static_cast<u32>(mPasses.Size()); ++passIndex) {
+            auto& pass = mPasses[passIndex];
+            if (pass.mIsCulled
+                || !HasAnyFlags(pass.mDesc.mFlags, EFrameGraphPassFlags::ParallelRecord)
+                || (!pass.mExecute && !pass.mDesc.mExecute)
+                || (pass.mDesc.mType == EFrameGraphPassType::Raster && !pass.HasRenderPass())) {
+                continue;
+            }
+            pass.mFirstRecordedList = static_cast<u32>(jobs.Size());
+            for (u32 chunk = 0U; chunk < pass.mRecordChunkCount; ++chunk) {
+                jobs.PushBack({ passIndex, chunk });
+            }
+            ++parallelPasses;
+        }
+
+        // A single list is recorded faster on the calling thread than replayed from a worker.
+        auto* pool = Core::Jobs::FJobSystem::GetDefaultWorkerPool();
+        if (jobs.Size() < 2U || pool == nullptr || pool->GetWorkerCount() == 0U) {
+            for (auto& pass : mPasses) {
+                pass.mFirstRecordedList = kNoRecordedList;
+            }
+            return;
+        }
+
+        while (mRecordedLists.Size() < jobs.Size()) {
+            mRecordedLists.PushBack(Container::MakeUnique<Rhi::FRhiCmdList>());
+        }
+        for (usize listIndex = 0U; listIndex < jobs.Size(); ++listIndex) {
+            mRecordedLists[listIndex]->Reset();
+        }
+
+        const auto recordStart = std::chrono::steady_clock::now();
+        Core::Jobs::ParallelForRange(jobs.Size(), 1U, [this, &jobs](usize begin, usize end) {
+            for (usize jobIndex = begin; jobIndex < end; ++jobIndex) {
+                const auto&             job  = jobs[jobIndex];
+                auto&                   pass = mPasses[job.mPassIndex];
+                Rhi::FRhiCmdListContext listContext(*mRecordedLists[jobIndex]);
+                const FFrameGraphPassResources resources(
+                    *this, job.mChunk, pass.mRecordChunkCount);
+                if (pass.mExecute) {
+                    pass.mExecute(listContext, resources, pass.mPassData, pass.mExecuteUserData);
+                } else {
+                    pass.mDesc.mExecute(listContext, resources);
+                }
+            }
+        });
+
+        mRecordStats.ParallelPasses    = parallelPasses;
+        mRecordStats.RecordedLists     = static_cast<u32>(jobs.Size());
+        mRecordStats.RecordNanoseconds = ElapsedNanoseconds(recordStart);
+        for (usize listIndex = 0U; listIndex < jobs.Size(); ++listIndex) {
+            mRecordStats.RecordedCommands += mRecordedLists[listIndex]->GetCommandCount();
+        }
+    }
+
+    void FFrameGraph::ExecutePassBody(FRdgPass& pass, Rhi::FRhiCmdContext& cmdContext) {
+        if (pass.mFirstRecordedList != kNoRecordedList) {
+            for (u32 chunk = 0U; chunk < pass.mRecordChunkCount; ++chunk) {
+                mRecordedLists[pass.mFirstRecordedList + chunk]->Execute(cmdContext);
+            }
+            return;
+        }
+
+        for (u32 chunk = 0U; chunk < pass.mRecordChunkCount; ++chunk) {
+            const FFrameGraphPassResources resources(*this, chunk, pass.mRecordChunkCount);
+            if (pass.mExecute) {
+                pass.mExecute(cmdContext, resources, pass.mPassData, pass.mExecuteUserData);
+            } else if (pass.mDesc.mExecute) {
+                pass.mDesc.mExecute(cmdContext, resources);
+            }
+        }
+    }
+
     FFrameGraphTextureRef FFrameGraph::ImportTexture(
         const Rhi::FRhiTextureRef& external, Rhi::ERhiResourceState state) {
         if (!external) {
@@ -520,6 +977,7 @@ namespace AltinaEngine::RenderCore {
         entry.mIsExternal         = true;
         entry.mExternalTexture    = external;
         entry.mDesc.mInitialState = state;
+        entry.mStartState         = state;
         if (state == Rhi::ERhiResourceState::Present) {
             // Treat imported presentable textures (swapchain backbuffer) as implicit external
             // outputs so FrameGraph always transitions them back to Present at frame end.
@@ -564,6 +1022,7 @@ namespace AltinaEngine::RenderCore {
         entry.mIsExternal         = true;
         entry.mExternalBuffer     = external;
         entry.mDesc.mInitialState = state;
+        entry.mStartState         = state;
         mBuffers.PushBack(entry);
         mCompiled = false;
         return FFrameGraphBufferRef{ static_cast<u32>(mBuffers.Size()) };
@@ -600,12 +1059,370 @@ namespace AltinaEngine::RenderCore {
         mCompiledBeginTransitions.Clear();
         mCompiledFinalTransitions.Clear();
         mCompiled = false;
+        // Views and entries are gone, so the pool only sees references held outside the graph.
+        if (mHasTransientGraph) {
+            mTransientPool->EndGraph();
+            mHasTransientGraph = false;
+        }
+    }
+
+    void FFrameGraph::AllocateTransientResources() {
+        // Recompiling rewinds the pool to the state it had before this graph.
+        mTransientPool->BeginGraph(*mDevice);
+        mHasTransientGraph = true;
+        mTransientStats    = {};
+        for (auto& texture : mTextures) {
+            if (!texture.mIsExternal) {
+                texture.mTexture.Reset();
+                texture.mTransientSlot = kInvalidTransientSlot;
+            }
+        }
+        for (auto& buffer : mBuffers) {
+            if (!buffer.mIsExternal) {
+                buffer.mBuffer.Reset();
+                buffer.mTransientSlot = kInvalidTransientSlot;
+            }
+        }
+
+        const u32 passCount = static_cast<u32>(mPasses.Size());
+        const u32 lastPass  = (passCount > 0U) ? (passCount - 1U) : 0U;
+
+        TFrameVector<FTransientLifetime> textureLifetimes;
+        TFrameVector<FTransientLifetime> bufferLifetimes;
+        textureLifetimes.Resize(mTextures.Size());
+        bufferLifetimes.Resize(mBuffers.Size());
+        for (u32 passIndex = 0U; passIndex < passCount; ++passIndex) {
+            const auto& pass = mPasses[passIndex];
+            if (pass.mIsCulled) {
+                continue;
+            }
+            // The executor may overlap other queues with graphics work, so a hand-over would need
+            // cross-queue synchronisation; keep those resources out of the pool instead.
+            const bool  isGraphicsQueue = pass.mDesc.mQueue == EFrameGraphQueue::Graphics;
+            for (const auto& access : pass.mAccesses) {
+                auto& lifetimes = (access.mType == EFrameGraphResourceType::Texture)
+                    ? textureLifetimes
+                    : bufferLifetimes;
+                if (access.mResourceId == 0U || access.mResourceId > lifetimes.Size()) {
+                    continue;
+                }
+                auto& lifetime = lifetimes[access.mResourceId - 1U];
+                if (lifetime.mFirstPass == kNoPass) {
+                    lifetime.mFirstPass = passIndex;
+                }
+                lifetime.mLastPass   = passIndex;
+                lifetime.mFinalState = access.mState;
+                lifetime.mPoolable   = lifetime.mPoolable && isGraphicsQueue;
+            }
+        }
+
+        for (usize i = 0; i < mTextures.Size(); ++i) {
+            const auto& entry    = mTextures[i];
+            auto&       lifetime = textureLifetimes[i];
+            if (entry.mIsExternal || entry.mIsCulled) {
+                continue;
+            }
+            FinalizeLifetime(lifetime, lastPass, entry.mIsExternalOutput, entry.mFinalState);
+            lifetime.mSizeBytes = EstimateTextureSizeBytes(entry.mDesc.mDesc);
+            lifetime.mPoolable  = lifetime.mPoolable
+                && !IsCpuVisible(entry.mDesc.mDesc.mUsage, entry.mDesc.mDesc.mCpuAccess);
+            ++mTransientStats.TransientTextures;
+            mTransientStats.NaiveBytes += lifetime.mSizeBytes;
+        }
+        for (usize i = 0; i < mBuffers.Size(); ++i) {
+            const auto& entry    = mBuffers[i];
+            auto&       lifetime = bufferLifetimes[i];
+            if (entry.mIsExternal || entry.mIsCulled) {
+                continue;
+            }
+            FinalizeLifetime(lifetime, lastPass, entry.mIsExternalOutput, entry.mFinalState);
+            lifetime.mSizeBytes = entry.mDesc.mDesc.mSizeBytes;
+            lifetime.mPoolable  = lifetime.mPoolable
+                && !IsCpuVisible(entry.mDesc.mDesc.mUsage, entry.mDesc.mDesc.mCpuAccess);
+            ++mTransientStats.TransientBuffers;
+            mTransientStats.NaiveBytes += lifetime.mSizeBytes;
+        }
+
+        // Walk the passes in order: bind every transient when its first pass starts and give its
+        // object back to the pool after its last pass, so later transients with the same
+        // description reuse it.
+        auto& pool      = *mTransientPool;
+        u64   liveBytes = 0ULL;
+        for (u32 passIndex = 0U; passIndex <= lastPass; ++passIndex) {
+            for (usize i = 0; i < mTextures.Size(); ++i) {
+                auto&       entry    = mTextures[i];
+                const auto& lifetime = textureLifetimes[i];
+                if (entry.mIsExternal || entry.mIsCulled || lifetime.mFirstPass != passIndex) {
+                    continue;
+                }
+                liveBytes += lifetime.mSizeBytes;
+                if (lifetime.mPoolable) {
+                    entry.mTransientSlot = pool.AcquireTexture(
+                        entry.mDesc.mDesc, entry.mDesc.mInitialState, mTransientStats);
+                }
+                if (entry.mTransientSlot != kInvalidTransientSlot) {
+                    const auto& slot  = pool.mTextures[entry.mTransientSlot];
+                    entry.mTexture    = slot.mResource;
+                    entry.mStartState = slot.mState;
+                } else {
+                    entry.mTexture    = mDevice->CreateTexture(entry.mDesc.mDesc);
+                    entry.mStartState = entry.mDesc.mInitialState;
+                    ++mTransientStats.Unpooled;
+                    ++mTransientStats.PhysicalTextures;
+                    mTransientStats.AllocatedBytes += lifetime.mSizeBytes;
+                }
+                DebugAssert(static_cast<bool>(entry.mTexture), TEXT("RenderCore.FrameGraph"),
+                    "CreateTexture failed: debugName='{}', width={}, height={}, format={}, bindFlags={}.",
+                    entry.mDesc.mDesc.mDebugName.ToView(), entry.mDesc.mDesc.mWidth,
+                    entry.mDesc.mDesc.mHeight, static_cast<u32>(entry.mDesc.mDesc.mFormat),
+                    static_cast<u32>(entry.mDesc.mDesc.mBindFlags));
+            }
+            for (usize i = 0; i < mBuffers.Size(); ++i) {
+                auto&       entry    = mBuffers[i];
+                const auto& lifetime = bufferLifetimes[i];
+                if (entry.mIsExternal || entry.mIsCulled || lifetime.mFirstPass != passIndex) {
+                    continue;
+                }
+                liveBytes += lifetime.mSizeBytes;
+                if (lifetime.mPoolable) {
+                    entry.mTransientSlot = pool.AcquireBuffer(
+                        entry.mDesc.mDesc, entry.mDesc.mInitialState, mTransientStats);
+                }
+                if (entry.mTransientSlot != kInvalidTransientSlot) {
+                    const auto& slot  = pool.mBuffers[entry.mTransientSlot];
+                    entry.mBuffer     = slot.mResource;
+                    entry.mStartState = slot.mState;
+                } else {
+                    entry.mBuffer     = mDevice->CreateBuffer(entry.mDesc.mDesc);
+                    entry.mStartState = entry.mDesc.mInitialState;
+                    ++mTransientStats.Unpooled;
+                    ++mTransientStats.PhysicalBuffers;
+                    mTransientStats.AllocatedBytes += lifetime.mSizeBytes;
+                }
+                DebugAssert(static_cast<bool>(entry.mBuffer), TEXT("RenderCore.FrameGraph"),
+                    "CreateBuffer failed: debugName='{}', sizeBytes={}, usage={}, bindFlags={}, cpuAccess={}.",
+                    entry.mDesc.mDesc.mDebugName.ToView(), entry.mDesc.mDesc.mSizeBytes,
+                    static_cast<u32>(entry.mDesc.mDesc.mUsage),
+                    static_cast<u32>(entry.mDesc.mDesc.mBindFlags),
+                    static_cast<u32>(entry.mDesc.mDesc.mCpuAccess));
+            }
+            if (liveBytes > mTransientStats.PeakLiveBytes) {
+                mTransientStats.PeakLiveBytes = liveBytes;
+            }
+
+            for (usize i = 0; i < mTextures.Size(); ++i) {
+                const auto& entry    = mTextures[i];
+                const auto& lifetime = textureLifetimes[i];
+                if (entry.mIsExternal || entry.mIsCulled || lifetime.mLastPass != passIndex) {
+                    continue;
+                }
+                liveBytes -= lifetime.mSizeBytes;
+                if (entry.mTransientSlot != kInvalidTransientSlot) {
+                    pool.ReleaseTexture(entry.mTransientSlot, lifetime.mFinalState);
+                }
+            }
+            for (usize i = 0; i < mBuffers.Size(); ++i) {
+                const auto& entry    = mBuffers[i];
+                const auto& lifetime = bufferLifetimes[i];
+                if (entry.mIsExternal || entry.mIsCulled || lifetime.mLastPass != passIndex) {
+                    continue;
+                }
+                liveBytes -= lifetime.mSizeBytes;
+                if (entry.mTransientSlot != kInvalidTransientSlot) {
+                    pool.ReleaseBuffer(entry.mTransientSlot, lifetime.mFinalState);
+                }
+            }
+        }
+
+        mTransientStats.PooledObjects = pool.GetPooledObjectCount();
+        mTransientStats.PooledBytes   = pool.GetPooledBytes();
+    }
+
+    void FFrameGraph::CullPasses() {
+        TFrameVector<bool> textureNeeded;
+        TFrameVector<bool> bufferNeeded;
+        TFrameVector<bool> textureTouched;
+        TFrameVector<bool> bufferTouched;
+        textureNeeded.Resize(mTextures.Size());
+        bufferNeeded.Resize(mBuffers.Size());
+        textureTouched.Resize(mTextures.Size());
+        bufferTouched.Resize(mBuffers.Size());
+        for (usize i = 0; i < mTextures.Size(); ++i) {
+            textureNeeded[i]  = false;
+            textureTouched[i] = false;
+        }
+        for (usize i = 0; i < mBuffers.Size(); ++i) {
+            bufferNeeded[i]  = false;
+            bufferTouched[i] = false;
+        }
+
+        // Walk backwards from the passes whose results leave the graph; a pass is kept when a
+        // kept pass later uses anything it writes.
+        for (usize passIndex = mPasses.Size(); passIndex-- > 0U;) {
+            auto& pass      = mPasses[passIndex];
+            bool  isRoot    = pass.mHasSideEffect
+                || HasAnyFlags(pass.mDesc.mFlags,
+                    EFrameGraphPassFlags::NeverCull | EFrameGraphPassFlags::ExternalOutput);
+            bool  hasWrites = false;
+            bool  isNeeded  = false;
+            for (const auto& access : pass.mAccesses) {
+                const bool isTexture = access.mType == EFrameGraphResourceType::Texture;
+                auto&      touched   = isTexture ? textureTouched : bufferTouched;
+                if (access.mResourceId == 0U || access.mResourceId > touched.Size()) {
+                    continue;
+                }
+                const usize index = access.mResourceId - 1U;
+                touched[index]    = true;
+                if (!access.mIsWrite) {
+                    continue;
+                }
+                hasWrites = true;
+                if (isTexture) {
+                    const auto& entry = mTextures[index];
+                    isRoot            = isRoot || entry.mIsExternal || entry.mIsExternalOutput;
+                    isNeeded          = isNeeded || textureNeeded[index];
+                } else {
+                    const auto& entry = mBuffers[index];
+                    isRoot            = isRoot || entry.mIsExternal || entry.mIsExternalOutput;
+                    isNeeded          = isNeeded || bufferNeeded[index];
+                }
+            }
+
+            // Passes that declare no writes may still produce results the graph cannot see.
+            pass.mIsCulled = !isRoot && !isNeeded && hasWrites;
+            if (pass.mIsCulled) {
+                ++mCompileStats.CulledPasses;
+                continue;
+            }
+            for (const auto& access : pass.mAccesses) {
+                auto& needed = (access.mType == EFrameGraphResourceType::Texture) ? textureNeeded
+                                                                                  : bufferNeeded;
+                if (access.mResourceId != 0U && access.mResourceId <= needed.Size()) {
+                    needed[access.mResourceId - 1U] = true;
+                }
+            }
+        }
+
+        // Transients nobody declared an access for are kept, as before culling existed.
+        for (usize i = 0; i < mTextures.Size(); ++i) {
+            auto& entry     = mTextures[i];
+            entry.mIsCulled = !entry.mIsExternal && textureTouched[i] && !textureNeeded[i];
+            mCompileStats.CulledTextures += entry.mIsCulled ? 1U : 0U;
+        }
+        for (usize i = 0; i < mBuffers.Size(); ++i) {
+            auto& entry     = mBuffers[i];
+            entry.mIsCulled = !entry.mIsExternal && bufferTouched[i] && !bufferNeeded[i];
+            mCompileStats.CulledBuffers += entry.mIsCulled ? 1U : 0U;
+        }
+    }
+
+    void FFrameGraph::MergeRenderPasses() {
+        mCompileStats.MergedPasses = 0U;
+        FRdgPass* previous         = nullptr;
+        for (auto& pass : mPasses) {
+            if (pass.mIsCulled) {
+                continue;
+            }
+            if (!pass.HasRenderPass()) {
+                previous = nullptr;
+                continue;
+            }
+            if (previous != nullptr && CanMergeRenderPasses(*previous, pass)) {
+                previous->mMergesWithNext = true;
+                pass.mMergesWithPrevious  = true;
+                ++mCompileStats.MergedPasses;
+            }
+            previous = &pass;
+        }
+    }
+
+    auto FFrameGraph::CanMergeRenderPasses(const FRdgPass& previous, const FRdgPass& next) const
+        -> bool {
+        // The render pass is begun with the first pass's attachments and ended with its store
+        // ops, so later passes may neither clear nor need anything stored that it would drop.
+        if (previous.mDesc.mQueue != EFrameGraphQueue::Graphics
+            || next.mDesc.mQueue != EFrameGraphQueue::Graphics
+            || !next.mCompiledPreTransitions.IsEmpty()
+            || previous.mRenderTargets.Size() != next.mRenderTargets.Size()
+            || previous.mCompiledColorAttachments.Size() != next.mCompiledColorAttachments.Size()
+            || previous.mHasCompiledDepth != next.mHasCompiledDepth) {
+            return false;
+        }
+
+        const auto isSameTarget = [](const auto& lhs, const auto& rhs) {
+            return lhs.mResourceId == rhs.mResourceId && lhs.mDesc.mFormat == rhs.mDesc.mFormat
+                && lhs.mDesc.mRange.mBaseMip == rhs.mDesc.mRange.mBaseMip
+                && lhs.mDesc.mRange.mMipCount == rhs.mDesc.mRange.mMipCount
+                && lhs.mDesc.mRange.mBaseArrayLayer == rhs.mDesc.mRange.mBaseArrayLayer
+                && lhs.mDesc.mRange.mLayerCount == rhs.mDesc.mRange.mLayerCount
+                && lhs.mDesc.mRange.mBaseDepthSlice == rhs.mDesc.mRange.mBaseDepthSlice
+                && lhs.mDesc.mRange.mDepthSliceCount == rhs.mDesc.mRange.mDepthSliceCount;
+        };
+
+        for (usize i = 0; i < next.mRenderTargets.Size(); ++i) {
+            const auto& lhs = previous.mRenderTargets[i];
+            const auto& rhs = next.mRenderTargets[i];
+            if (!lhs.mRTV.IsValid() || !rhs.mRTV.IsValid()
+                || lhs.mStoreOp != Rhi::ERhiStoreOp::Store
+                || rhs.mLoadOp == Rhi::ERhiLoadOp::Clear) {
+                return false;
+            }
+            if (lhs.mRTV.mId != rhs.mRTV.mId
+                && !isSameTarget(mRTVs[lhs.mRTV.mId - 1U], mRTVs[rhs.mRTV.mId - 1U])) {
+                return false;
+            }
+        }
+
+        if (previous.mHasCompiledDepth) {
+            const auto& lhs = previous.mDepthStencil;
+            const auto& rhs = next.mDepthStencil;
+            if (lhs.mDepthStoreOp != Rhi::ERhiStoreOp::Store
+                || lhs.mStencilStoreOp != Rhi::ERhiStoreOp::Store
+                || rhs.mDepthLoadOp == Rhi::ERhiLoadOp::Clear
+                || rhs.mStencilLoadOp == Rhi::ERhiLoadOp::Clear) {
+                return false;
+            }
+            if (lhs.mDSV.mId != rhs.mDSV.mId) {
+                const auto& lhsEntry = mDSVs[lhs.mDSV.mId - 1U];
+                const auto& rhsEntry = mDSVs[rhs.mDSV.mId - 1U];
+                if (!isSameTarget(lhsEntry, rhsEntry)
+                    || lhsEntry.mDesc.mReadOnlyDepth != rhsEntry.mDesc.mReadOnlyDepth
+                    || lhsEntry.mDesc.mReadOnlyStencil != rhsEntry.mDesc.mReadOnlyStencil) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    auto FFrameGraph::GetTransientSlot(bool isTexture, u32 resourceId) const noexcept -> u32 {
+        if (resourceId == 0U) {
+            return kInvalidTransientSlot;
+        }
+        const usize index = resourceId - 1U;
+        if (isTexture) {
+            return (index < mTextures.Size()) ? mTextures[index].mTransientSlot
+                                              : kInvalidTransientSlot;
+        }
+        return (index < mBuffers.Size()) ? mBuffers[index].mTransientSlot : kInvalidTransientSlot;
+    }
+
+    auto FFrameGraph::IsCulledResource(bool isTexture, u32 resourceId) const noexcept -> bool {
+        if (resourceId == 0U) {
+            return false;
+        }
+        const usize index = resourceId - 1U;
+        if (isTexture) {
+            return index < mTextures.Size() && mTextures[index].mIsCulled;
+        }
+        return index < mBuffers.Size() && mBuffers[index].mIsCulled;
     }
 
     auto FFrameGraph::CreateTextureInternal(const FFrameGraphTextureDesc& desc)
         -> FFrameGraphTextureRef {
         FRdgTextureEntry entry;
-        entry.mDesc = desc;
+        entry.mDesc       = desc;
+        entry.mStartState = desc.mInitialState;
         mTextures.PushBack(entry);
         mCompiled = false;
         return FFrameGraphTextureRef{ static_cast<u32>(mTextures.Size()) };
@@ -614,7 +1431,8 @@ namespace AltinaEngine::RenderCore {
     auto FFrameGraph::CreateBufferInternal(const FFrameGraphBufferDesc& desc)
         -> FFrameGraphBufferRef {
         FRdgBufferEntry entry;
-        entry.mDesc = desc;
+        entry.mDesc       = desc;
+        entry.mStartState = desc.mInitialState;
         mBuffers.PushBack(entry);
         mCompiled = false;
         return FFrameGraphBufferRef{ static_cast<u32>(mBuffers.Size()) };
@@ -800,6 +1618,14 @@ namespace AltinaEngine::RenderCore {
         mCompiled = false;
     }
 
+    void FFrameGraph::SetRecordChunksInternal(u32 passIndex, u32 chunkCount) {
+        if (passIndex >= mPasses.Size()) {
+            return;
+        }
+        // Chunking only changes how execute is called, so the compiled graph stays valid.
+        mPasses[passIndex].mRecordChunkCount = (chunkCount > 0U) ? chunkCount : 1U;
+    }
+
     auto FFrameGraph::ResolveTexture(FFrameGraphTextureRef ref) const -> Rhi::FRhiTexture* {
         if (!ref.IsValid()) {
             return nullptr;
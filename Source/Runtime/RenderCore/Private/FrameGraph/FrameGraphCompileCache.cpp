@@ -0,0 +1,41 @@
+#include "FrameGraph/FrameGraphCompileCache.h"
+
+namespace AltinaEngine::RenderCore {
+    void FFrameGraphCompileCache::Reset() {
+        mEntries.Clear();
+        mUseSerial = 0ULL;
+        mStats     = {};
+    }
+
+    auto FFrameGraphCompileCache::Find(u64 hash, u32 passCount, u32 textureCount, u32 bufferCount)
+        -> FEntry* {
+        for (auto& entry : mEntries) {
+            // The counts guard against hash collisions between differently sized graphs.
+            if (entry.mHash != hash || entry.mPasses.Size() != passCount
+                || entry.mTextureCount != textureCount || entry.mBufferCount != bufferCount) {
+                continue;
+            }
+            entry.mLastUsed = ++mUseSerial;
+            return &entry;
+        }
+        return nullptr;
+    }
+
+    auto FFrameGraphCompileCache::Add(u64 hash) -> FEntry& {
+        FEntry* target = nullptr;
+        if (mEntries.Size() < kMaxEntries) {
+            target = &mEntries.EmplaceBack();
+        } else {
+            target = &mEntries[0];
+            for (auto& entry : mEntries) {
+                if (entry.mLastUsed < target->mLastUsed) {
+                    target = &entry;
+                }
+            }
+            *target = FEntry{};
+        }
+        target->mHash     = hash;
+        target->mLastUsed = ++mUseSerial;
+        return *target;
+    }
+} // namespace AltinaEngine::RenderCore
@@ -30,19 +30,34 @@ namespace AltinaEngine::RenderCore {
         using AltinaEngine::Rhi::FRhiQueue;
         using AltinaEngine::Rhi::FRhiQueueSignal;
         using AltinaEngine::Rhi::FRhiQueueWait;
-        using AltinaEngine::Rhi::FRhiTransition;
         using AltinaEngine::Rhi::FRhiTransitionCreateInfo;
         using AltinaEngine::Rhi::FRhiTransitionInfo;
         using AltinaEngine::Rhi::IRhiCmdContextOps;
 
+        constexpr u32 kQueueCount = 3U;
+        constexpr u32 kNoPass     = ~0U;
+
         struct FQueueState {
-            ERhiQueueType                            mType = ERhiQueueType::Graphics;
-            AltinaEngine::Rhi::FRhiQueueRef          mQueue;
-            AltinaEngine::Rhi::FRhiCommandContextRef mContext;
-            IRhiCmdContextOps*                       mOps         = nullptr;
-            bool                                     mRecording   = false;
-            bool                                     mHasCommands = false;
-            Core::Container::TVector<FRhiQueueWait>  mPendingWaits;
+            AltinaEngine::Rhi::FRhiCommandContext*  mContext     = nullptr;
+            bool                                    mRecording   = false;
+            bool                                    mHasCommands = false;
+            Core::Container::TVector<FRhiQueueWait> mPendingWaits;
+            // Passes recorded since the last submit; they complete with its timeline value.
+            Core::Container::TVector<u32>           mBatch;
+            // Timeline values of the other queues this queue has already waited for.
+            u64                                     mKnown[kQueueCount]{};
+        };
+
+        // Knowledge carried by a submitted timeline value: whatever its queue had waited for.
+        struct FSubmitRecord {
+            u32 mQueue = 0U;
+            u64 mValue = 0ULL;
+            u64 mKnown[kQueueCount]{};
+        };
+
+        struct FHazardState {
+            u32                           mLastWriter = kNoPass;
+            Core::Container::TVector<u32> mReaders;
         };
 
         struct FTransitionEdge {
@@ -51,7 +66,6 @@ namespace AltinaEngine::RenderCore {
             ERhiQueueType                                mSrcQueue = ERhiQueueType::Graphics;
             ERhiQueueType                                mDstQueue = ERhiQueueType::Graphics;
             Core::Container::TVector<FRhiTransitionInfo> mInfos;
-            AltinaEngine::Rhi::FRhiTransitionRef         mTransition;
             FRhiTransitionCreateInfo                     mCreateInfo{};
             bool                                         mCrossQueue = false;
         };
@@ -88,7 +102,7 @@ namespace AltinaEngine::RenderCore {
         }
 
         void BeginQueueIfNeeded(FQueueState& state) {
-            if (state.mRecording || !state.mContext || state.mOps == nullptr) {
+            if (state.mRecording || state.mContext == nullptr) {
                 return;
             }
             state.mRecording   = true;
@@ -100,7 +114,7 @@ namespace AltinaEngine::RenderCore {
             if (!state.mRecording) {
                 return;
             }
-            if (!state.mContext) {
+            if (state.mContext == nullptr) {
                 state.mPendingWaits.Clear();
                 state.mRecording   = false;
                 state.mHasCommands = false;
@@ -123,8 +137,6 @@ namespace AltinaEngine::RenderCore {
             state.mHasCommands = false;
         }
 
-        void               SubmitQueue(FQueueState& state) { SubmitQueue(state, nullptr); }
-
         [[nodiscard]] auto ElapsedMilliseconds(
             const std::chrono::steady_clock::time_point& startTime) noexcept -> double {
             using namespace std::chrono;
@@ -135,6 +147,62 @@ namespace AltinaEngine::RenderCore {
 
     FFrameGraphExecutor::FFrameGraphExecutor(Rhi::FRhiDevice& device) : mDevice(&device) {}
 
+    void FFrameGraphExecutor::InitQueueSlot(u32 queueIndex) {
+        auto& slot = mQueueSlots[queueIndex];
+        if (slot.mInitialized) {
+            return;
+        }
+        slot.mInitialized = true;
+
+        const auto type = static_cast<ERhiQueueType>(queueIndex);
+        slot.mQueue     = mDevice->GetQueue(type);
+        if (!slot.mQueue) {
+            return;
+        }
+        FRhiCommandContextDesc desc{};
+        desc.mQueueType = type;
+        auto context    = mDevice->CreateCommandContext(desc);
+        if (!context) {
+            return;
+        }
+        auto* ops = dynamic_cast<IRhiCmdContextOps*>(context.Get());
+        Core::Utility::Assert(ops != nullptr, TEXT("RenderCore"),
+            "Command context does not implement IRhiCmdContextOps.");
+        slot.mContext = Move(context);
+        slot.mOps     = ops;
+        ++mStats.ContextsCreated;
+    }
+
+    auto FFrameGraphExecutor::GetTimeline(u32 queueIndex) -> Rhi::FRhiSemaphore* {
+        auto& slot = mQueueSlots[queueIndex];
+        if (!slot.mTimeline) {
+            slot.mTimeline = mDevice->CreateSemaphore(true, 0ULL);
+            if (!slot.mTimeline) {
+                Core::Logging::LogErrorCat(
+                    TEXT("RenderCore"), "Failed to create the frame graph queue timeline.");
+                return nullptr;
+            }
+            slot.mSignaledValue = 0ULL;
+        }
+        return slot.mTimeline.Get();
+    }
+
+    auto FFrameGraphExecutor::GetQueueTransition(u32 srcQueue, u32 dstQueue)
+        -> Rhi::FRhiTransition* {
+        auto& transition = mQueueTransitions[srcQueue * kQueueCount + dstQueue];
+        if (!transition) {
+            Rhi::FRhiTransitionDesc desc{};
+            desc.mSrcQueue = static_cast<ERhiQueueType>(srcQueue);
+            desc.mDstQueue = static_cast<ERhiQueueType>(dstQueue);
+            transition     = mDevice->CreateTransition(desc);
+            if (!transition) {
+                Core::Logging::LogErrorCat(TEXT("RenderCore"),
+                    "Failed to create FRhiTransition for cross-queue edge.");
+            }
+        }
+        return transition.Get();
+    }
+
     void FFrameGraphExecutor::Execute(FFrameGraph& graph) {
         if (mDevice == nullptr) {
             return;
@@ -143,33 +211,25 @@ namespace AltinaEngine::RenderCore {
             graph.Compile();
         }
 
-        const auto&                             caps = mDevice->GetQueueCapabilities();
+        mStats                = {};
+        const auto& caps      = mDevice->GetQueueCapabilities();
+        const u32   passCount = static_cast<u32>(graph.mPasses.Size());
 
         Core::Container::TVector<ERhiQueueType> passQueues;
-        passQueues.Resize(graph.mPasses.Size());
-        for (usize i = 0; i < graph.mPasses.Size(); ++i) {
+        passQueues.Resize(passCount);
+        bool usesAsyncQueues = false;
+        for (u32 i = 0U; i < passCount; ++i) {
             passQueues[i] = ToRhiQueue(graph.mPasses[i].mDesc.mQueue, caps);
+            if (!graph.mPasses[i].mIsCulled) {
+                InitQueueSlot(GetQueueIndex(passQueues[i]));
+                usesAsyncQueues = usesAsyncQueues || passQueues[i] != ERhiQueueType::Graphics;
+            }
         }
+        InitQueueSlot(GetQueueIndex(ERhiQueueType::Graphics));
 
-        FQueueState queues[3]{};
-        for (u32 i = 0U; i < 3U; ++i) {
-            ERhiQueueType type = static_cast<ERhiQueueType>(i);
-            queues[i].mType    = type;
-            queues[i].mQueue   = mDevice->GetQueue(type);
-            if (!queues[i].mQueue) {
-                continue;
-            }
-            FRhiCommandContextDesc desc{};
-            desc.mQueueType = type;
-            auto context    = mDevice->CreateCommandContext(desc);
-            if (!context) {
-                continue;
-            }
-            auto* ops = dynamic_cast<IRhiCmdContextOps*>(context.Get());
-            Core::Utility::Assert(ops != nullptr, TEXT("RenderCore"),
-                "Command context does not implement IRhiCmdContextOps.");
-            queues[i].mContext = Move(context);
-            queues[i].mOps     = ops;
+        FQueueState queues[kQueueCount]{};
+        for (u32 i = 0U; i < kQueueCount; ++i) {
+            queues[i].mContext = mQueueSlots[i].mContext.Get();
         }
 
         Core::Container::TVector<FTransitionEdge>  edges;
@@ -182,15 +242,18 @@ namespace AltinaEngine::RenderCore {
         bufferStates.Resize(graph.mBuffers.Size());
 
         for (usize i = 0; i < graph.mTextures.Size(); ++i) {
-            textureStates[i].mState = graph.mTextures[i].mDesc.mInitialState;
+            textureStates[i].mState = graph.mTextures[i].mStartState;
         }
         for (usize i = 0; i < graph.mBuffers.Size(); ++i) {
-            bufferStates[i].mState = graph.mBuffers[i].mDesc.mInitialState;
+            bufferStates[i].mState = graph.mBuffers[i].mStartState;
         }
 
         for (u32 passIndex = 0U; passIndex < static_cast<u32>(graph.mPasses.Size()); ++passIndex) {
             const auto& pass  = graph.mPasses[passIndex];
             const auto  queue = passQueues[passIndex];
+            if (pass.mIsCulled) {
+                continue;
+            }
 
             for (const auto& access : pass.mAccesses) {
                 if (access.mType == FFrameGraph::EFrameGraphResourceType::Texture) {
@@ -340,41 +403,283 @@ namespace AltinaEngine::RenderCore {
             edge.mCreateInfo.mSrcQueue        = edge.mSrcQueue;
             edge.mCreateInfo.mDstQueue        = edge.mDstQueue;
             edge.mCreateInfo.mFlags           = 0U;
-
             if (edge.mCrossQueue) {
-                Rhi::FRhiTransitionDesc desc{};
-                desc.mSrcQueue   = edge.mSrcQueue;
-                desc.mDstQueue   = edge.mDstQueue;
-                edge.mTransition = mDevice->CreateTransition(desc);
-                if (!edge.mTransition) {
-                    Core::Logging::LogErrorCat(TEXT("RenderCore"),
-                        "Failed to create FRhiTransition for cross-queue edge.");
-                } else {
-                    edge.mTransition->SetSignalValue(1ULL);
+                // Backends only need the queue pair; synchronization uses the queue timelines.
+                edge.mCreateInfo.mTransition = GetQueueTransition(
+                    GetQueueIndex(edge.mSrcQueue), GetQueueIndex(edge.mDstQueue));
+            }
+        }
+
+        // Dependencies: the last writer before an access, the readers before a write, and the
+        // source of every state transition (which covers ownership transfers between readers).
+        Core::Container::TVector<Core::Container::TVector<u32>> passDeps;
+        passDeps.Resize(passCount);
+        {
+            Core::Container::TVector<FHazardState> textureHazards;
+            Core::Container::TVector<FHazardState> bufferHazards;
+            textureHazards.Resize(graph.mTextures.Size());
+            bufferHazards.Resize(graph.mBuffers.Size());
+            for (u32 passIndex = 0U; passIndex < passCount; ++passIndex) {
+                const auto& pass = graph.mPasses[passIndex];
+                if (pass.mIsCulled) {
+                    continue;
+                }
+                auto& deps = passDeps[passIndex];
+                for (const auto& access : pass.mAccesses) {
+                    const bool bIsTexture =
+                        access.mType == FFrameGraph::EFrameGraphResourceType::Texture;
+                    auto&      hazards  = bIsTexture ? textureHazards : bufferHazards;
+                    const auto resIndex = static_cast<usize>(access.mResourceId - 1U);
+                    if (resIndex >= hazards.Size()) {
+                        continue;
+                    }
+                    auto& hazard = hazards[resIndex];
+                    if (hazard.mLastWriter != kNoPass && hazard.mLastWriter != passIndex) {
+                        deps.PushBack(hazard.mLastWriter);
+                    }
+                    if (access.mIsWrite) {
+                        for (u32 reader : hazard.mReaders) {
+                            if (reader != passIndex) {
+                                deps.PushBack(reader);
+                            }
+                        }
+                        hazard.mReaders.Clear();
+                        hazard.mLastWriter = passIndex;
+                    } else {
+                        hazard.mReaders.PushBack(passIndex);
+                    }
+                }
+            }
+            for (const auto& edge : edges) {
+                if (edge.mSrcPass != edge.mDstPass) {
+                    passDeps[edge.mDstPass].PushBack(edge.mSrcPass);
                 }
-                edge.mCreateInfo.mTransition = edge.mTransition.Get();
             }
         }
 
-        FFrameGraphPassResources resources(graph);
+        // Recording order: every queue keeps its declaration order, and passes on the async
+        // queues are taken as soon as their dependencies are recorded, ahead of the graphics
+        // passes declared before them.
+        Core::Container::TVector<u32> queuePasses[kQueueCount];
+        for (u32 passIndex = 0U; passIndex < passCount; ++passIndex) {
+            if (!graph.mPasses[passIndex].mIsCulled) {
+                queuePasses[GetQueueIndex(passQueues[passIndex])].PushBack(passIndex);
+            }
+        }
 
-        for (u32 passIndex = 0U; passIndex < static_cast<u32>(graph.mPasses.Size()); ++passIndex) {
+        Core::Container::TVector<u32>  order;
+        Core::Container::TVector<bool> recorded;
+        order.Reserve(passCount);
+        recorded.Resize(passCount);
+        for (u32 i = 0U; i < passCount; ++i) {
+            recorded[i] = false;
+        }
+        {
+            usize      heads[kQueueCount]{};
+            const auto isReady = [&](u32 passIndex) {
+                for (u32 dep : passDeps[passIndex]) {
+                    if (!recorded[dep]) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+            const auto record = [&](u32 queueIndex) {
+                const u32 passIndex = queuePasses[queueIndex][heads[queueIndex]++];
+                recorded[passIndex] = true;
+                order.PushBack(passIndex);
+            };
+
+            const u32 graphicsIndex  = GetQueueIndex(ERhiQueueType::Graphics);
+            auto&     graphicsPasses = queuePasses[graphicsIndex];
+            for (;;) {
+                bool progressed = false;
+                for (u32 queueIndex = 0U; queueIndex < kQueueCount; ++queueIndex) {
+                    if (queueIndex == graphicsIndex) {
+                        continue;
+                    }
+                    auto& passes = queuePasses[queueIndex];
+                    while (heads[queueIndex] < passes.Size()
+                        && isReady(passes[heads[queueIndex]])) {
+                        if (heads[graphicsIndex] < graphicsPasses.Size()
+                            && graphicsPasses[heads[graphicsIndex]] < passes[heads[queueIndex]]) {
+                            ++mStats.HoistedPasses;
+                        }
+                        record(queueIndex);
+                        progressed = true;
+                    }
+                }
+                if (heads[graphicsIndex] < graphicsPasses.Size()
+                    && isReady(graphicsPasses[heads[graphicsIndex]])) {
+                    record(graphicsIndex);
+                    continue;
+                }
+                if (progressed) {
+                    continue;
+                }
+
+                // Declaration order is always a valid order; fall back to the earliest head.
+                u32 earliestQueue = kQueueCount;
+                for (u32 queueIndex = 0U; queueIndex < kQueueCount; ++queueIndex) {
+                    if (heads[queueIndex] < queuePasses[queueIndex].Size()
+                        && (earliestQueue == kQueueCount
+                            || queuePasses[queueIndex][heads[queueIndex]]
+                                < queuePasses[earliestQueue][heads[earliestQueue]])) {
+                        earliestQueue = queueIndex;
+                    }
+                }
+                if (earliestQueue == kQueueCount) {
+                    break;
+                }
+                record(earliestQueue);
+            }
+        }
+
+        // Record ParallelRecord passes on job workers; the loop below replays them in order.
+        graph.RecordParallelPasses();
+
+        // Timeline value each pass completes with, once its batch has been submitted.
+        Core::Container::TVector<u64> passValues;
+        passValues.Resize(passCount);
+        for (u32 i = 0U; i < passCount; ++i) {
+            passValues[i] = 0ULL;
+        }
+        Core::Container::TVector<FSubmitRecord> submitRecords;
+
+        // Render pass left open on the graphics queue for the next (merged) pass.
+        auto&      graphicsState     = queues[GetQueueIndex(ERhiQueueType::Graphics)];
+        auto&      graphicsSlot      = mQueueSlots[GetQueueIndex(ERhiQueueType::Graphics)];
+        bool       renderPassOpen    = false;
+        const auto endOpenRenderPass = [&]() {
+            if (renderPassOpen) {
+                FRhiCmdContextAdapter(*graphicsState.mContext, *graphicsSlot.mOps)
+                    .RHIEndRenderPass();
+                renderPassOpen = false;
+            }
+        };
+
+        // Every submit signals its queue timeline while async queues are in use, so any pass
+        // can be waited for once its batch is submitted.
+        const auto submitQueue = [&](u32 queueIndex) {
+            auto& state = queues[queueIndex];
+            if (!state.mRecording) {
+                return;
+            }
+            if (queueIndex == GetQueueIndex(ERhiQueueType::Graphics)) {
+                endOpenRenderPass();
+            }
+
+            Core::Container::TVector<FRhiQueueSignal> signals;
+            u64                                       value = 0ULL;
+            auto* timeline = usesAsyncQueues ? GetTimeline(queueIndex) : nullptr;
+            if (timeline != nullptr) {
+                value = ++mQueueSlots[queueIndex].mSignaledValue;
+                FRhiQueueSignal signal{};
+                signal.mSemaphore = timeline;
+                signal.mValue     = value;
+                signals.PushBack(signal);
+
+                FSubmitRecord submitRecord{};
+                submitRecord.mQueue = queueIndex;
+                submitRecord.mValue = value;
+                for (u32 i = 0U; i < kQueueCount; ++i) {
+                    submitRecord.mKnown[i] = state.mKnown[i];
+                }
+                submitRecords.PushBack(submitRecord);
+            }
+            for (u32 passIndex : state.mBatch) {
+                passValues[passIndex] = value;
+            }
+            state.mBatch.Clear();
+            SubmitQueue(state, &signals);
+            ++mStats.Submits;
+        };
+
+        for (u32 passIndex : order) {
             const auto passStart  = std::chrono::steady_clock::now();
             auto&      pass       = graph.mPasses[passIndex];
             const auto queue      = passQueues[passIndex];
-            auto&      queueState = queues[GetQueueIndex(queue)];
+            const u32  queueIndex = GetQueueIndex(queue);
+            auto&      queueState = queues[queueIndex];
+            auto&      queueSlot  = mQueueSlots[queueIndex];
 
-            if (!queueState.mQueue || !queueState.mContext || queueState.mOps == nullptr) {
+            if (queueState.mContext == nullptr || queueSlot.mOps == nullptr) {
                 continue;
             }
 
             const auto& transitions = passTransitions[passIndex];
-            if (!transitions.mAcquireEdges.IsEmpty() && queueState.mHasCommands) {
-                SubmitQueue(queueState);
+            // The compiler only merges passes without transitions; re-check against the edges
+            // computed here and fall back to a separate render pass otherwise.
+            const bool  continuesRenderPass = renderPassOpen && pass.mMergesWithPrevious
+                && queue == ERhiQueueType::Graphics && transitions.mAcquireEdges.IsEmpty()
+                && transitions.mSameQueueEdges.IsEmpty();
+            if (queue == ERhiQueueType::Graphics && !continuesRenderPass) {
+                endOpenRenderPass();
+            }
+
+            // Producers on other queues are submitted lazily, when the first consumer needs them.
+            // Keep only the newest value per source queue that this queue has not covered yet.
+            u64 waitValues[kQueueCount]{};
+            for (u32 edgeIndex : transitions.mAcquireEdges) {
+                const auto& edge     = edges[edgeIndex];
+                const u32   srcIndex = GetQueueIndex(edge.mSrcQueue);
+                if (passValues[edge.mSrcPass] == 0ULL) {
+                    submitQueue(srcIndex);
+                }
+                const u64 value = passValues[edge.mSrcPass];
+                if (value == 0ULL) {
+                    continue;
+                }
+                if (value <= queueState.mKnown[srcIndex] || value <= waitValues[srcIndex]) {
+                    ++mStats.RedundantWaits;
+                    continue;
+                }
+                if (waitValues[srcIndex] != 0ULL) {
+                    ++mStats.RedundantWaits;
+                }
+                waitValues[srcIndex] = value;
+            }
+
+            bool needsWait = false;
+            for (u32 srcIndex = 0U; srcIndex < kQueueCount; ++srcIndex) {
+                needsWait = needsWait || waitValues[srcIndex] != 0ULL;
+            }
+            if (needsWait) {
+                // Work already recorded on this queue does not have to wait.
+                if (queueState.mHasCommands) {
+                    submitQueue(queueIndex);
+                }
+                for (u32 srcIndex = 0U; srcIndex < kQueueCount; ++srcIndex) {
+                    const u64 value = waitValues[srcIndex];
+                    if (value == 0ULL) {
+                        continue;
+                    }
+                    FRhiQueueWait wait{};
+                    wait.mSemaphore = mQueueSlots[srcIndex].mTimeline.Get();
+                    wait.mValue     = value;
+                    queueState.mPendingWaits.PushBack(wait);
+                    ++mStats.Waits;
+
+                    // Waiting for a value also covers everything its batch waited for.
+                    for (const auto& submitRecord : submitRecords) {
+                        if (submitRecord.mQueue != srcIndex || submitRecord.mValue != value) {
+                            continue;
+                        }
+                        for (u32 i = 0U; i < kQueueCount; ++i) {
+                            if (submitRecord.mKnown[i] > queueState.mKnown[i]) {
+                                queueState.mKnown[i] = submitRecord.mKnown[i];
+                            }
+                        }
+                        break;
+                    }
+                    if (value > queueState.mKnown[srcIndex]) {
+                        queueState.mKnown[srcIndex] = value;
+                    }
+                }
             }
 
             BeginQueueIfNeeded(queueState);
-            FRhiCmdContextAdapter    adapter(*queueState.mContext.Get(), *queueState.mOps);
+            FRhiCmdContextAdapter    adapter(*queueState.mContext, *queueSlot.mOps);
             Core::Container::FString passMarkerText;
             passMarkerText.Assign(TEXT("FrameGraph.Pass"));
             if (pass.mDesc.mName != nullptr && pass.mDesc.mName[0] != '\0') {
@@ -383,35 +688,26 @@ namespace AltinaEngine::RenderCore {
                     pass.mDesc.mName, static_cast<usize>(std::strlen(pass.mDesc.mName))));
             }
             FRhiDebugMarker passMarker(adapter, passMarkerText.ToView());
-
-            for (u32 edgeIndex : transitions.mAcquireEdges) {
-                auto& edge = edges[edgeIndex];
-                if (!edge.mTransition) {
-                    continue;
-                }
-                FRhiQueueWait wait{};
-                wait.mSemaphore = edge.mTransition->GetSemaphore();
-                wait.mValue     = edge.mTransition->GetSignalValue();
-                queueState.mPendingWaits.PushBack(wait);
+            queueState.mBatch.PushBack(passIndex);
+            ++mStats.Passes;
+            if (queue != ERhiQueueType::Graphics) {
+                ++mStats.AsyncPasses;
             }
 
             for (u32 edgeIndex : transitions.mAcquireEdges) {
-                auto& edge = edges[edgeIndex];
-                adapter.RHIEndTransition(edge.mCreateInfo);
+                adapter.RHIEndTransition(edges[edgeIndex].mCreateInfo);
             }
 
             for (u32 edgeIndex : transitions.mSameQueueEdges) {
-                auto& edge = edges[edgeIndex];
-                adapter.RHIBeginTransition(edge.mCreateInfo);
+                adapter.RHIBeginTransition(edges[edgeIndex].mCreateInfo);
             }
 
-            const bool hasRenderPass = pass.mDesc.mType == EFrameGraphPassType::Raster
-                && (!pass.mCompiledColorAttachments.IsEmpty() || pass.mHasCompiledDepth);
+            const bool hasRenderPass = pass.HasRenderPass();
             if (pass.mDesc.mType == EFrameGraphPassType::Raster && !hasRenderPass) {
                 continue;
             }
 
-            if (hasRenderPass) {
+            if (hasRenderPass && !continuesRenderPass) {
                 Rhi::FRhiRenderPassDesc renderPassDesc;
                 if (pass.mDesc.mName != nullptr) {
                     renderPassDesc.mDebugName.Assign(Core::Utility::String::FromUtf8Bytes(
@@ -425,40 +721,17 @@ namespace AltinaEngine::RenderCore {
                 adapter.RHIBeginRenderPass(renderPassDesc);
             }
 
-            if (pass.mExecute) {
-                pass.mExecute(adapter, resources, pass.mPassData, pass.mExecuteUserData);
-            } else if (pass.mDesc.mExecute) {
-                pass.mDesc.mExecute(adapter, resources);
-            }
+            graph.ExecutePassBody(pass, adapter);
 
-            if (hasRenderPass) {
+            renderPassOpen = hasRenderPass && pass.mMergesWithNext
+                && queue == ERhiQueueType::Graphics && transitions.mReleaseEdges.IsEmpty();
+            if (hasRenderPass && !renderPassOpen) {
                 adapter.RHIEndRenderPass();
             }
 
-            if (!transitions.mReleaseEdges.IsEmpty()) {
-                for (u32 edgeIndex : transitions.mReleaseEdges) {
-                    auto& edge = edges[edgeIndex];
-                    adapter.RHIBeginTransition(edge.mCreateInfo);
-                }
-
-                Core::Container::TVector<FRhiQueueSignal> signals;
-                signals.Reserve(transitions.mReleaseEdges.Size());
-                for (u32 edgeIndex : transitions.mReleaseEdges) {
-                    auto& edge = edges[edgeIndex];
-                    if (!edge.mTransition) {
-                        continue;
-                    }
-                    FRhiQueueSignal signal{};
-                    signal.mSemaphore = edge.mTransition->GetSemaphore();
-                    signal.mValue     = edge.mTransition->GetSignalValue();
-                    signals.PushBack(signal);
-                }
-                SubmitQueue(queueState, &signals);
-                LogInfoCat(kFrameTimingCategory,
-                    TEXT("FrameGraph.Pass index={} name={} queue={} ms={:.3f}"), passIndex,
-                    (pass.mDesc.mName != nullptr) ? pass.mDesc.mName : "<unnamed>",
-                    static_cast<u32>(queue), ElapsedMilliseconds(passStart));
-                continue;
+            // Releases are recorded right away; the submit waits for the first consumer.
+            for (u32 edgeIndex : transitions.mReleaseEdges) {
+                adapter.RHIBeginTransition(edges[edgeIndex].mCreateInfo);
             }
             queueState.mHasCommands = true;
             LogInfoCat(kFrameTimingCategory,
@@ -467,14 +740,16 @@ namespace AltinaEngine::RenderCore {
                 static_cast<u32>(queue), ElapsedMilliseconds(passStart));
         }
 
+        endOpenRenderPass();
+
         // Apply external-output final transitions (for example backbuffer RenderTarget->Present).
         // The non-executor FrameGraph::Execute path performs these explicitly; keep executor
         // behavior consistent so presentable images are finalized reliably.
         if (!graph.mCompiledFinalTransitions.IsEmpty()) {
-            auto& graphicsQueue = queues[GetQueueIndex(ERhiQueueType::Graphics)];
-            if (graphicsQueue.mQueue && graphicsQueue.mContext && graphicsQueue.mOps != nullptr) {
-                BeginQueueIfNeeded(graphicsQueue);
-                FRhiCmdContextAdapter adapter(*graphicsQueue.mContext.Get(), *graphicsQueue.mOps);
+            if (graphicsSlot.mQueue && graphicsState.mContext != nullptr
+                && graphicsSlot.mOps != nullptr) {
+                BeginQueueIfNeeded(graphicsState);
+                FRhiCmdContextAdapter    adapter(*graphicsState.mContext, *graphicsSlot.mOps);
                 FRhiTransitionCreateInfo transition{};
                 transition.mTransitions = graph.mCompiledFinalTransitions.Data();
                 transition.mTransitionCount =
@@ -482,13 +757,13 @@ namespace AltinaEngine::RenderCore {
                 transition.mSrcQueue = ERhiQueueType::Graphics;
                 transition.mDstQueue = ERhiQueueType::Graphics;
                 adapter.RHIBeginTransition(transition);
-                graphicsQueue.mHasCommands = true;
+                graphicsState.mHasCommands = true;
             }
         }
 
-        for (auto& queueState : queues) {
-            if (queueState.mRecording && queueState.mHasCommands) {
-                SubmitQueue(queueState);
+        for (u32 queueIndex = 0U; queueIndex < kQueueCount; ++queueIndex) {
+            if (queues[queueIndex].mRecording && queues[queueIndex].mHasCommands) {
+                submitQueue(queueIndex);
             }
         }
     }
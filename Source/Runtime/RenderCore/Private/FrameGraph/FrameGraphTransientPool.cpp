@@ -0,0 +1,393 @@
+#include "FrameGraph/FrameGraphTransientPool.h"
+
+#include "Container/HashUtility.h"
+#include "Rhi/RhiBuffer.h"
+#include "Rhi/RhiDevice.h"
+#include "Rhi/RhiResourceView.h"
+#include "Rhi/RhiTexture.h"
+
+namespace AltinaEngine::RenderCore {
+    namespace {
+        constexpr u32 kInvalidSlot = ~0U;
+
+        // Bytes per 4x4 block for block-compressed formats, bytes per texel otherwise.
+        struct FFormatFootprint {
+            u32  mBytes        = 4U;
+            bool mIsCompressed = false;
+        };
+
+        auto GetFormatFootprint(Rhi::ERhiFormat format) noexcept -> FFormatFootprint {
+            switch (format) {
+                case Rhi::ERhiFormat::BC1Unorm:
+                case Rhi::ERhiFormat::BC1UnormSrgb:
+                case Rhi::ERhiFormat::BC4Unorm:
+                    return { 8U, true };
+                case Rhi::ERhiFormat::BC2Unorm:
+                case Rhi::ERhiFormat::BC2UnormSrgb:
+                case Rhi::ERhiFormat::BC3Unorm:
+                case Rhi::ERhiFormat::BC3UnormSrgb:
+                case Rhi::ERhiFormat::BC5Unorm:
+                case Rhi::ERhiFormat::BC6HUfloat:
+                case Rhi::ERhiFormat::BC6HSfloat:
+                case Rhi::ERhiFormat::BC7Unorm:
+                case Rhi::ERhiFormat::BC7UnormSrgb:
+                    return { 16U, true };
+                case Rhi::ERhiFormat::R16G16B16A16Float:
+                case Rhi::ERhiFormat::R32G32Float:
+                    return { 8U, false };
+                case Rhi::ERhiFormat::R32G32B32Float:
+                    return { 12U, false };
+                default:
+                    return { 4U, false };
+            }
+        }
+
+        auto MakeTextureKey(const Rhi::FRhiTextureDesc& desc) noexcept -> u64 {
+            u64 key = static_cast<u64>(desc.mDimension);
+            key     = InternalHashCombine(key, desc.mWidth);
+            key     = InternalHashCombine(key, desc.mHeight);
+            key     = InternalHashCombine(key, desc.mDepth);
+            key     = InternalHashCombine(key, desc.mMipLevels);
+            key     = InternalHashCombine(key, desc.mArrayLayers);
+            key     = InternalHashCombine(key, desc.mSampleCount);
+            key     = InternalHashCombine(key, static_cast<u64>(desc.mFormat));
+            key     = InternalHashCombine(key, static_cast<u64>(desc.mUsage));
+            key     = InternalHashCombine(key, static_cast<u64>(desc.mBindFlags));
+            return InternalHashCombine(key, static_cast<u64>(desc.mCpuAccess));
+        }
+
+        auto MakeBufferKey(const Rhi::FRhiBufferDesc& desc) noexcept -> u64 {
+            u64 key = desc.mSizeBytes;
+            key     = InternalHashCombine(key, static_cast<u64>(desc.mUsage));
+            key     = InternalHashCombine(key, static_cast<u64>(desc.mBindFlags));
+            return InternalHashCombine(key, static_cast<u64>(desc.mCpuAccess));
+        }
+
+        // Debug names are deliberately not compared.
+        auto IsCompatible(const Rhi::FRhiTextureDesc& lhs, const Rhi::FRhiTextureDesc& rhs) noexcept
+            -> bool {
+            return lhs.mDimension == rhs.mDimension && lhs.mWidth == rhs.mWidth
+                && lhs.mHeight == rhs.mHeight && lhs.mDepth == rhs.mDepth
+                && lhs.mMipLevels == rhs.mMipLevels && lhs.mArrayLayers == rhs.mArrayLayers
+                && lhs.mSampleCount == rhs.mSampleCount && lhs.mFormat == rhs.mFormat
+                && lhs.mUsage == rhs.mUsage && lhs.mBindFlags == rhs.mBindFlags
+                && lhs.mCpuAccess == rhs.mCpuAccess;
+        }
+
+        auto IsCompatible(const Rhi::FRhiBufferDesc& lhs, const Rhi::FRhiBufferDesc& rhs) noexcept
+            -> bool {
+            return lhs.mSizeBytes == rhs.mSizeBytes && lhs.mUsage == rhs.mUsage
+                && lhs.mBindFlags == rhs.mBindFlags && lhs.mCpuAccess == rhs.mCpuAccess;
+        }
+
+        auto IsSameRange(
+            const Rhi::FRhiTextureViewRange& lhs, const Rhi::FRhiTextureViewRange& rhs) noexcept
+            -> bool {
+            return lhs.mBaseMip == rhs.mBaseMip && lhs.mMipCount == rhs.mMipCount
+                && lhs.mBaseArrayLayer == rhs.mBaseArrayLayer && lhs.mLayerCount == rhs.mLayerCount
+                && lhs.mBaseDepthSlice == rhs.mBaseDepthSlice
+                && lhs.mDepthSliceCount == rhs.mDepthSliceCount;
+        }
+
+        auto IsSameRange(
+            const Rhi::FRhiBufferViewRange& lhs, const Rhi::FRhiBufferViewRange& rhs) noexcept
+            -> bool {
+            return lhs.mOffsetBytes == rhs.mOffsetBytes && lhs.mSizeBytes == rhs.mSizeBytes;
+        }
+
+        // Views are only compared within the slot of the object they were created on.
+        auto IsSameView(const Rhi::FRhiShaderResourceViewDesc& lhs,
+            const Rhi::FRhiShaderResourceViewDesc&             rhs) noexcept -> bool {
+            return lhs.mFormat == rhs.mFormat && IsSameRange(lhs.mTextureRange, rhs.mTextureRange)
+                && IsSameRange(lhs.mBufferRange, rhs.mBufferRange);
+        }
+
+        auto IsSameView(const Rhi::FRhiUnorderedAccessViewDesc& lhs,
+            const Rhi::FRhiUnorderedAccessViewDesc&             rhs) noexcept -> bool {
+            return lhs.mFormat == rhs.mFormat && IsSameRange(lhs.mTextureRange, rhs.mTextureRange)
+                && IsSameRange(lhs.mBufferRange, rhs.mBufferRange);
+        }
+
+        auto IsSameView(const Rhi::FRhiRenderTargetViewDesc& lhs,
+            const Rhi::FRhiRenderTargetViewDesc&             rhs) noexcept -> bool {
+            return lhs.mFormat == rhs.mFormat && IsSameRange(lhs.mRange, rhs.mRange);
+        }
+
+        auto IsSameView(const Rhi::FRhiDepthStencilViewDesc& lhs,
+            const Rhi::FRhiDepthStencilViewDesc&             rhs) noexcept -> bool {
+            return lhs.mFormat == rhs.mFormat && IsSameRange(lhs.mRange, rhs.mRange)
+                && lhs.mReadOnlyDepth == rhs.mReadOnlyDepth
+                && lhs.mReadOnlyStencil == rhs.mReadOnlyStencil;
+        }
+
+        template <typename TCachedViewType, typename TDesc, typename TCreate>
+        auto FindOrCreateView(TVector<TCachedViewType>& views, const TDesc& desc, bool& bReused,
+            TCreate&& create) -> decltype(create(desc)) {
+            for (const auto& cached : views) {
+                if (IsSameView(cached.mDesc, desc)) {
+                    bReused = true;
+                    return cached.mView;
+                }
+            }
+            bReused   = false;
+            auto view = create(desc);
+            if (!view) {
+                return view;
+            }
+            if (views.Size() >= FFrameGraphTransientPool::kMaxViewsPerObject) {
+                for (usize i = 1U; i < views.Size(); ++i) {
+                    views[i - 1U] = Move(views[i]);
+                }
+                views.PopBack();
+            }
+            auto& cached = views.EmplaceBack();
+            cached.mDesc = desc;
+            cached.mView = view;
+            return view;
+        }
+
+        template <typename TSlotType> auto GetCachedViewCount(const TSlotType& slot) noexcept
+            -> usize {
+            return slot.mSRVs.Size() + slot.mUAVs.Size() + slot.mRTVs.Size() + slot.mDSVs.Size();
+        }
+
+        template <typename TSlotType, typename TDesc, typename TCreate>
+        auto AcquireSlot(TVector<TSlotType>& slots, const TDesc& desc, u64 key, u64 sizeBytes,
+            Rhi::ERhiResourceState initialState, u64 graphSerial, u32& physicalCount,
+            FFrameGraphTransientStats& stats, TCreate&& create) -> u32 {
+            for (u32 i = 0U; i < static_cast<u32>(slots.Size()); ++i) {
+                auto& slot = slots[i];
+                if (slot.mInUse || slot.mKey != key || !IsCompatible(slot.mDesc, desc)) {
+                    continue;
+                }
+                if (slot.mAcquireCount > 0U) {
+                    ++stats.Aliased;
+                } else {
+                    ++physicalCount;
+                    stats.AllocatedBytes += slot.mSizeBytes;
+                    if (slot.mCreatedGraph == graphSerial) {
+                        ++stats.Created; // created by an earlier compile of this graph
+                    } else {
+                        ++stats.ReusedFromPool;
+                    }
+                }
+                slot.mInUse = true;
+                ++slot.mAcquireCount;
+                return i;
+            }
+
+            auto resource = create(desc);
+            if (!resource) {
+                return kInvalidSlot;
+            }
+            auto& slot         = slots.EmplaceBack();
+            slot.mResource     = Move(resource);
+            slot.mDesc         = desc;
+            slot.mKey          = key;
+            slot.mSizeBytes    = sizeBytes;
+            slot.mState        = initialState;
+            slot.mCommitted    = initialState;
+            slot.mCreatedGraph = graphSerial;
+            slot.mAcquireCount = 1U;
+            slot.mInUse        = true;
+            ++physicalCount;
+            ++stats.Created;
+            stats.AllocatedBytes += sizeBytes;
+            return static_cast<u32>(slots.Size() - 1U);
+        }
+
+        template <typename TSlotType> void RewindSlots(TVector<TSlotType>& slots) {
+            for (auto& slot : slots) {
+                slot.mState        = slot.mCommitted;
+                slot.mAcquireCount = 0U;
+                slot.mInUse        = false;
+            }
+        }
+
+        template <typename TSlotType> void CommitSlots(TVector<TSlotType>& slots, u64 graphSerial) {
+            usize index = 0U;
+            while (index < slots.Size()) {
+                auto& slot      = slots[index];
+                slot.mCommitted = slot.mState;
+                slot.mInUse     = false;
+                if (slot.mAcquireCount > 0U) {
+                    slot.mLastUsedGraph = graphSerial;
+                    slot.mAcquireCount  = 0U;
+                }
+                // Objects still referenced outside the pool and its cached views were extracted
+                // from the graph; stop recycling them.
+                const bool bStale = (graphSerial - slot.mLastUsedGraph)
+                    >= FFrameGraphTransientPool::kEvictAfterGraphs;
+                const usize poolRefs = 1U + GetCachedViewCount(slot);
+                if (bStale || slot.mResource.GetRefCount() > poolRefs) {
+                    if (index + 1U != slots.Size()) {
+                        slot = Move(slots.Back());
+                    }
+                    slots.PopBack();
+                    continue;
+                }
+                ++index;
+            }
+        }
+    } // namespace
+
+    auto EstimateTextureSizeBytes(const Rhi::FRhiTextureDesc& desc) noexcept -> u64 {
+        const auto footprint = GetFormatFootprint(desc.mFormat);
+        const bool bIs3D     = desc.mDimension == Rhi::ERhiTextureDimension::Tex3D;
+        // Cube faces are already counted in the array layers.
+        const u64  layers    = (desc.mArrayLayers > 0U) ? desc.mArrayLayers : 1U;
+        const u32 mips    = (desc.mMipLevels > 0U) ? desc.mMipLevels : 1U;
+        const u64 samples = (desc.mSampleCount > 0U) ? desc.mSampleCount : 1U;
+
+        u64       total = 0ULL;
+        for (u32 mip = 0U; mip < mips; ++mip) {
+            u64 width  = desc.mWidth >> mip;
+            u64 height = desc.mHeight >> mip;
+            u64 depth  = bIs3D ? (desc.mDepth >> mip) : 1ULL;
+            width      = (width > 0ULL) ? width : 1ULL;
+            height     = (height > 0ULL) ? height : 1ULL;
+            depth      = (depth > 0ULL) ? depth : 1ULL;
+            if (footprint.mIsCompressed) {
+                width  = (width + 3ULL) / 4ULL;
+                height = (height + 3ULL) / 4ULL;
+            }
+            total += width * height * depth * footprint.mBytes;
+        }
+        return total * layers * samples;
+    }
+
+    FFrameGraphTransientPool::FFrameGraphTransientPool()  = default;
+    FFrameGraphTransientPool::~FFrameGraphTransientPool() = default;
+
+    void FFrameGraphTransientPool::Reset() {
+        mTextures.Clear();
+        mBuffers.Clear();
+        mDevice = nullptr;
+    }
+
+    auto FFrameGraphTransientPool::GetPooledObjectCount() const noexcept -> u32 {
+        return static_cast<u32>(mTextures.Size() + mBuffers.Size());
+    }
+
+    auto FFrameGraphTransientPool::GetPooledBytes() const noexcept -> u64 {
+        u64 bytes = 0ULL;
+        for (const auto& slot : mTextures) {
+            bytes += slot.mSizeBytes;
+        }
+        for (const auto& slot : mBuffers) {
+            bytes += slot.mSizeBytes;
+        }
+        return bytes;
+    }
+
+    void FFrameGraphTransientPool::BeginGraph(Rhi::FRhiDevice& device) {
+        if (mDevice != &device) {
+            Reset();
+            mDevice = &device;
+        }
+        RewindSlots(mTextures);
+        RewindSlots(mBuffers);
+    }
+
+    void FFrameGraphTransientPool::EndGraph() {
+        CommitSlots(mTextures, mGraphSerial);
+        CommitSlots(mBuffers, mGraphSerial);
+        ++mGraphSerial;
+    }
+
+    auto FFrameGraphTransientPool::AcquireTexture(const Rhi::FRhiTextureDesc& desc,
+        Rhi::ERhiResourceState initialState, FFrameGraphTransientStats& stats) -> u32 {
+        if (mDevice == nullptr) {
+            return kInvalidSlot;
+        }
+        return AcquireSlot(mTextures, desc, MakeTextureKey(desc), EstimateTextureSizeBytes(desc),
+            initialState, mGraphSerial, stats.PhysicalTextures, stats,
+            [this](const Rhi::FRhiTextureDesc& createDesc) {
+                return mDevice->CreateTexture(createDesc);
+            });
+    }
+
+    auto FFrameGraphTransientPool::AcquireBuffer(const Rhi::FRhiBufferDesc& desc,
+        Rhi::ERhiResourceState initialState, FFrameGraphTransientStats& stats) -> u32 {
+        if (mDevice == nullptr) {
+            return kInvalidSlot;
+        }
+        return AcquireSlot(mBuffers, desc, MakeBufferKey(desc), desc.mSizeBytes, initialState,
+            mGraphSerial, stats.PhysicalBuffers, stats,
+            [this](const Rhi::FRhiBufferDesc& createDesc) {
+                return mDevice->CreateBuffer(createDesc);
+            });
+    }
+
+    void FFrameGraphTransientPool::ReleaseTexture(u32 slot, Rhi::ERhiResourceState finalState) {
+        if (slot < mTextures.Size()) {
+            mTextures[slot].mState = finalState;
+            mTextures[slot].mInUse = false;
+        }
+    }
+
+    void FFrameGraphTransientPool::ReleaseBuffer(u32 slot, Rhi::ERhiResourceState finalState) {
+        if (slot < mBuffers.Size()) {
+            mBuffers[slot].mState = finalState;
+            mBuffers[slot].mInUse = false;
+        }
+    }
+
+    auto FFrameGraphTransientPool::GetSRV(bool isTexture, u32 slot,
+        const Rhi::FRhiShaderResourceViewDesc& desc, bool& bReused)
+        -> Rhi::FRhiShaderResourceViewRef {
+        const auto create = [this](const Rhi::FRhiShaderResourceViewDesc& createDesc) {
+            return mDevice->CreateShaderResourceView(createDesc);
+        };
+        bReused = false;
+        if (isTexture) {
+            return (slot < mTextures.Size())
+                ? FindOrCreateView(mTextures[slot].mSRVs, desc, bReused, create)
+                : Rhi::FRhiShaderResourceViewRef{};
+        }
+        return (slot < mBuffers.Size())
+            ? FindOrCreateView(mBuffers[slot].mSRVs, desc, bReused, create)
+            : Rhi::FRhiShaderResourceViewRef{};
+    }
+
+    auto FFrameGraphTransientPool::GetUAV(bool isTexture, u32 slot,
+        const Rhi::FRhiUnorderedAccessViewDesc& desc, bool& bReused)
+        -> Rhi::FRhiUnorderedAccessViewRef {
+        const auto create = [this](const Rhi::FRhiUnorderedAccessViewDesc& createDesc) {
+            return mDevice->CreateUnorderedAccessView(createDesc);
+        };
+        bReused = false;
+        if (isTexture) {
+            return (slot < mTextures.Size())
+                ? FindOrCreateView(mTextures[slot].mUAVs, desc, bReused, create)
+                : Rhi::FRhiUnorderedAccessViewRef{};
+        }
+        return (slot < mBuffers.Size())
+            ? FindOrCreateView(mBuffers[slot].mUAVs, desc, bReused, create)
+            : Rhi::FRhiUnorderedAccessViewRef{};
+    }
+
+    auto FFrameGraphTransientPool::GetRTV(u32 slot, const Rhi::FRhiRenderTargetViewDesc& desc,
+        bool& bReused) -> Rhi::FRhiRenderTargetViewRef {
+        bReused = false;
+        if (slot >= mTextures.Size()) {
+            return {};
+        }
+        return FindOrCreateView(mTextures[slot].mRTVs, desc, bReused,
+            [this](const Rhi::FRhiRenderTargetViewDesc& createDesc) {
+                return mDevice->CreateRenderTargetView(createDesc);
+            });
+    }
+
+    auto FFrameGraphTransientPool::GetDSV(u32 slot, const Rhi::FRhiDepthStencilViewDesc& desc,
+        bool& bReused) -> Rhi::FRhiDepthStencilViewRef {
+        bReused = false;
+        if (slot >= mTextures.Size()) {
+            return {};
+        }
+        return FindOrCreateView(mTextures[slot].mDSVs, desc, bReused,
+            [this](const Rhi::FRhiDepthStencilViewDesc& createDesc) {
+                return mDevice->CreateDepthStencilView(createDesc);
+            });
+    }
+} // namespace AltinaEngine::RenderCore
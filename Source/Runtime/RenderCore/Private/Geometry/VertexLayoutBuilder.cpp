@@ -133,23 +133,6 @@ namespace AltinaEngine::RenderCore::Geometry {
             // Integer-valued vertex inputs are not representable with current runtime formats.
             return false;
         }
-
-        auto BuildVertexLayoutHash(const Rhi::FRhiVertexLayoutDesc& layout) -> u64 {
-            u64  hash = kHashOffset64;
-            auto mix  = [&hash](u64 value) { hash = (hash ^ value) * kHashPrime64; };
-
-            mix(static_cast<u64>(layout.mAttributes.Size()));
-            for (const auto& attr : layout.mAttributes) {
-                mix(HashVertexSemanticName(attr.mSemanticName.ToView()));
-                mix(static_cast<u64>(attr.mSemanticIndex));
-                mix(static_cast<u64>(attr.mFormat));
-                mix(static_cast<u64>(attr.mInputSlot));
-                mix(static_cast<u64>(attr.mAlignedByteOffset));
-                mix(attr.mPerInstance ? 1ULL : 0ULL);
-                mix(static_cast<u64>(attr.mInstanceStepRate));
-            }
-            return hash;
-        }
     } // namespace
 
     auto HashVertexSemanticName(FStringView semanticName) noexcept -> u32 {
@@ -169,6 +152,23 @@ namespace AltinaEngine::RenderCore::Geometry {
         return hash;
     }
 
+    auto HashVertexLayout(const Rhi::FRhiVertexLayoutDesc& layout) noexcept -> u64 {
+        u64  hash = kHashOffset64;
+        auto mix  = [&hash](u64 value) { hash = (hash ^ value) * kHashPrime64; };
+
+        mix(static_cast<u64>(layout.mAttributes.Size()));
+        for (const auto& attr : layout.mAttributes) {
+            mix(HashVertexSemanticName(attr.mSemanticName.ToView()));
+            mix(static_cast<u64>(attr.mSemanticIndex));
+            mix(static_cast<u64>(attr.mFormat));
+            mix(static_cast<u64>(attr.mInputSlot));
+            mix(static_cast<u64>(attr.mAlignedByteOffset));
+            mix(attr.mPerInstance ? 1ULL : 0ULL);
+            mix(static_cast<u64>(attr.mInstanceStepRate));
+        }
+        return hash;
+    }
+
     auto MakeVertexSemanticKey(FStringView semanticName, u32 semanticIndex) noexcept
         -> FVertexSemanticKey {
         return FVertexSemanticKey{
@@ -353,7 +353,7 @@ namespace AltinaEngine::RenderCore::Geometry {
             outResolved.mVertexLayout.mAttributes.PushBack(outAttr);
         }
 
-        outResolved.mLayoutHash = BuildVertexLayoutHash(outResolved.mVertexLayout);
+        outResolved.mLayoutHash = HashVertexLayout(outResolved.mVertexLayout);
         return true;
     }
 } // namespace AltinaEngine::RenderCore::Geometry
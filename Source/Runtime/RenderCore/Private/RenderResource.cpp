@@ -6,7 +6,7 @@
 #include "Rhi/RhiDevice.h"
 #include "Rhi/RhiInit.h"
 
-using AltinaEngine::Core::Container::FString;
+using AltinaEngine::Core::Container::FName;
 using AltinaEngine::Core::Container::TVector;
 namespace AltinaEngine::RenderCore {
     namespace {
@@ -48,7 +48,8 @@ namespace AltinaEngine::RenderCore {
             return;
         }
 
-        mInitHandle = EnqueueRenderTask(FString(TEXT("RenderResource.Init")), [this]() -> void {
+        static const FName kTaskName(TEXT("RenderResource.Init"));
+        mInitHandle = EnqueueRenderTask(kTaskName, [this]() -> void {
             InitRHI();
             mState.Store(static_cast<i32>(EState::Initialized));
             OnInitComplete();
@@ -62,12 +63,12 @@ namespace AltinaEngine::RenderCore {
             return;
         }
 
+        static const FName kTaskName(TEXT("RenderResource.Release"));
         mState.Store(static_cast<i32>(EState::ReleasePending));
-        mReleaseHandle =
-            EnqueueRenderTask(FString(TEXT("RenderResource.Release")), [this]() -> void {
-                ReleaseRHI();
-                mState.Store(static_cast<i32>(EState::Uninitialized));
-            });
+        mReleaseHandle = EnqueueRenderTask(kTaskName, [this]() -> void {
+            ReleaseRHI();
+            mState.Store(static_cast<i32>(EState::Uninitialized));
+        });
     }
 
     void FRenderResource::UpdateResource() noexcept {
@@ -75,8 +76,8 @@ namespace AltinaEngine::RenderCore {
             return;
         }
 
-        EnqueueRenderTask(
-            FString(TEXT("RenderResource.Update")), [this]() -> void { UpdateRHI(); });
+        static const FName kTaskName(TEXT("RenderResource.Update"));
+        EnqueueRenderTask(kTaskName, [this]() -> void { UpdateRHI(); });
     }
 
     void FRenderResource::WaitForInit() noexcept {
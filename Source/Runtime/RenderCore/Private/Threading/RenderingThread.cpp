@@ -6,16 +6,16 @@
 #include <thread>
 
 using AltinaEngine::Move;
-using AltinaEngine::Core::Container::FString;
+using AltinaEngine::Core::Container::FName;
 using AltinaEngine::Core::Container::TFunction;
 namespace AltinaEngine::RenderCore {
     Core::Console::TConsoleVariable<i32> gRenderingThreadLagFrames(
         TEXT("rc.RenderingThread.LagFrames"), 1);
 
-    auto EnqueueRenderTask(FString TaskName, TFunction<void()> task) noexcept
+    auto EnqueueRenderTask(FName TaskName, TFunction<void()> task) noexcept
         -> Core::Jobs::FJobHandle {
         Core::Jobs::FJobDescriptor desc{};
-        desc.TaskName     = Move(TaskName);
+        desc.TaskName     = TaskName;
         desc.AffinityMask = static_cast<u32>(Core::Jobs::ENamedThread::Rendering);
         desc.Callback     = Move(task);
         return Core::Jobs::FJobSystem::Submit(Move(desc));
@@ -2,7 +2,11 @@
 
 #include "RenderCoreAPI.h"
 
+#include "FrameGraph/FrameGraphCompileCache.h"
+#include "FrameGraph/FrameGraphTransientPool.h"
+#include "Container/SmartPtr.h"
 #include "Container/Vector.h"
+#include "Memory/FrameAllocator.h"
 #include "Types/Aliases.h"
 #include "Types/Traits.h"
 #include "Rhi/RhiRefs.h"
@@ -13,6 +17,7 @@ using AltinaEngine::TDecay;
 namespace AltinaEngine::RenderCore {
     namespace Container = Core::Container;
     using Container::TVector;
+    using Core::Memory::TFrameVector;
 
     enum class EFrameGraphQueue : u8 {
         Graphics = 0,
@@ -29,7 +34,10 @@ namespace AltinaEngine::RenderCore {
     enum class EFrameGraphPassFlags : u8 {
         None           = 0,
         NeverCull      = 1u << 0,
-        ExternalOutput = 1u << 1
+        ExternalOutput = 1u << 1,
+        // Execute only records commands and touches no state shared with other passes, so it
+        // may run on a job worker, concurrently with other ParallelRecord passes.
+        ParallelRecord = 1u << 2
     };
 
     [[nodiscard]] constexpr auto operator|(
@@ -103,6 +111,45 @@ namespace AltinaEngine::RenderCore {
         [[nodiscard]] constexpr auto IsValid() const noexcept -> bool { return mId != 0U; }
     };
 
+    /**
+     * @brief Pass culling and render pass merging done by the last compile.
+     *
+     * A pass is culled when nothing that outlives the graph depends on it: it has no side
+     * effect, is not flagged NeverCull/ExternalOutput, writes no imported or external-output
+     * resource and none of the resources it writes is used by a pass that is kept. Transients
+     * only used by culled passes are not allocated.
+     *
+     * The saved time is what the stages taken from the `FFrameGraphCompileCache` cost when they
+     * last ran for the same declaration.
+     */
+    struct FFrameGraphCompileStats {
+        u32  Passes             = 0U;
+        u32  CulledPasses       = 0U;
+        u32  CulledTextures     = 0U;
+        u32  CulledBuffers      = 0U;
+        u32  MergedPasses       = 0U; // raster passes recorded into the previous pass's render pass
+        u32  ViewsCreated       = 0U;
+        u32  ViewsReused        = 0U; // views kept on pooled transients by an earlier graph
+        bool CacheHit           = false; // culling and merging taken from the compile cache
+        bool TransitionsReused  = false; // barriers taken from the compile cache as well
+        u64  CompileNanoseconds = 0ULL;
+        u64  SavedNanoseconds   = 0ULL;
+    };
+
+    /**
+     * @brief Command recording done by the last `Execute`.
+     *
+     * ParallelRecord passes (one entry per record chunk) are recorded on job workers into
+     * command lists before the first pass is submitted, then replayed in declaration order
+     * between the barriers and render passes recorded on the calling thread.
+     */
+    struct FFrameGraphRecordStats {
+        u32 ParallelPasses    = 0U;
+        u32 RecordedLists     = 0U;
+        u32 RecordedCommands  = 0U;
+        u64 RecordNanoseconds = 0ULL; // wall time of the parallel recording
+    };
+
     class FFrameGraph;
     class FFrameGraphExecutor;
 
@@ -115,12 +162,22 @@ namespace AltinaEngine::RenderCore {
         [[nodiscard]] auto GetRTV(FFrameGraphRTVRef ref) const -> Rhi::FRhiRenderTargetView*;
         [[nodiscard]] auto GetDSV(FFrameGraphDSVRef ref) const -> Rhi::FRhiDepthStencilView*;
 
+        // Chunk of the pass being recorded, see FFrameGraphPassBuilder::SetRecordChunks.
+        [[nodiscard]] auto GetRecordChunk() const noexcept -> u32 { return mRecordChunk; }
+        [[nodiscard]] auto GetRecordChunkCount() const noexcept -> u32 {
+            return mRecordChunkCount;
+        }
+
     private:
         friend class FFrameGraph;
         friend class FFrameGraphExecutor;
         explicit FFrameGraphPassResources(const FFrameGraph& graph) : mGraph(&graph) {}
+        FFrameGraphPassResources(const FFrameGraph& graph, u32 chunk, u32 chunkCount)
+            : mGraph(&graph), mRecordChunk(chunk), mRecordChunkCount(chunkCount) {}
 
-        const FFrameGraph* mGraph = nullptr;
+        const FFrameGraph* mGraph            = nullptr;
+        u32                mRecordChunk      = 0U;
+        u32                mRecordChunkCount = 1U;
     };
 
     struct FRdgRenderTargetBinding {
@@ -172,6 +229,9 @@ namespace AltinaEngine::RenderCore {
             const FRdgRenderTargetBinding* RTVs, u32 RTVCount, const FRdgDepthStencilBinding* DSV);
         void SetExternalOutput(FFrameGraphTextureRef tex, Rhi::ERhiResourceState finalState);
         void SetSideEffect();
+        // Runs execute once per chunk, in chunk order, so a large draw list can be split; with
+        // ParallelRecord every chunk is recorded into a list of its own.
+        void SetRecordChunks(u32 chunkCount);
 
     private:
         friend class FFrameGraph;
@@ -199,7 +259,16 @@ namespace AltinaEngine::RenderCore {
 
     class AE_RENDER_CORE_API FFrameGraph {
     public:
-        explicit FFrameGraph(Rhi::FRhiDevice& device);
+        /**
+         * @param transientPool Pool that outlives the graph and recycles its transient
+         *        resources; when null the graph uses a pool of its own, which still aliases
+         *        transients within the graph and across BeginFrame/EndFrame.
+         * @param compileCache Cache of compile results keyed by the graph declaration; when null
+         *        the graph uses a cache of its own.
+         */
+        explicit FFrameGraph(Rhi::FRhiDevice& device,
+            FFrameGraphTransientPool* transientPool = nullptr,
+            FFrameGraphCompileCache*  compileCache  = nullptr);
         ~FFrameGraph();
 
         FFrameGraph(const FFrameGraph&)                    = delete;
@@ -261,6 +330,17 @@ namespace AltinaEngine::RenderCore {
         FFrameGraphBufferRef ImportBufferLegacy(
             Rhi::FRhiBuffer* external, Rhi::ERhiResourceState state);
 
+        [[nodiscard]] auto GetTransientStats() const noexcept
+            -> const FFrameGraphTransientStats& {
+            return mTransientStats;
+        }
+        [[nodiscard]] auto GetCompileStats() const noexcept -> const FFrameGraphCompileStats& {
+            return mCompileStats;
+        }
+        [[nodiscard]] auto GetRecordStats() const noexcept -> const FFrameGraphRecordStats& {
+            return mRecordStats;
+        }
+
     private:
         friend class FFrameGraphPassResources;
         friend class FFrameGraphPassBuilder;
@@ -287,6 +367,11 @@ namespace AltinaEngine::RenderCore {
             bool                   mIsExternal       = false;
             bool                   mIsExternalOutput = false;
             Rhi::ERhiResourceState mFinalState       = Rhi::ERhiResourceState::Unknown;
+            // State the resource is in when the graph starts; differs from the desc when a
+            // recycled transient is bound.
+            Rhi::ERhiResourceState mStartState       = Rhi::ERhiResourceState::Common;
+            u32                    mTransientSlot    = ~0U;
+            bool                   mIsCulled         = false; // only used by culled passes
         };
 
         struct FRdgBufferEntry {
@@ -296,6 +381,9 @@ namespace AltinaEngine::RenderCore {
             bool                   mIsExternal       = false;
             bool                   mIsExternalOutput = false;
             Rhi::ERhiResourceState mFinalState       = Rhi::ERhiResourceState::Unknown;
+            Rhi::ERhiResourceState mStartState       = Rhi::ERhiResourceState::Common;
+            u32                    mTransientSlot    = ~0U;
+            bool                   mIsCulled         = false;
         };
 
         struct FRdgSRVEntry {
@@ -324,26 +412,42 @@ namespace AltinaEngine::RenderCore {
             Rhi::FRhiDepthStencilViewRef  mView;
         };
 
+        // Passes only live between BeginFrame() and EndFrame() of the graph, so their arrays come
+        // from the frame arena of the thread that declares them.
         struct FRdgPass {
-            FFrameGraphPassDesc              mDesc;
-            TVector<FRdgResourceAccess>      mAccesses;
-            TVector<Rhi::FRhiTransitionInfo> mCompiledPreTransitions;
-            TVector<FRdgRenderTargetBinding> mRenderTargets;
-            bool                             mHasDepthStencil = false;
-            FRdgDepthStencilBinding          mDepthStencil;
-            bool                             mHasSideEffect = false;
+            FFrameGraphPassDesc                   mDesc;
+            TFrameVector<FRdgResourceAccess>      mAccesses;
+            TFrameVector<Rhi::FRhiTransitionInfo> mCompiledPreTransitions;
+            TFrameVector<FRdgRenderTargetBinding> mRenderTargets;
+            bool                                  mHasDepthStencil = false;
+            FRdgDepthStencilBinding               mDepthStencil;
+            bool                                  mHasSideEffect = false;
 
-            void*                            mPassData = nullptr;
-            void (*mDestroyPassData)(void* data)       = nullptr;
+            void*                                 mPassData = nullptr;
+            void (*mDestroyPassData)(void* data)            = nullptr;
 
             void* mExecuteUserData                       = nullptr;
             void (*mExecute)(Rhi::FRhiCmdContext& ctx, const FFrameGraphPassResources& res,
                 const void* passData, void* executeData) = nullptr;
             void (*mDestroyExecute)(void* executeData)   = nullptr;
 
-            TVector<Rhi::FRhiRenderPassColorAttachment> mCompiledColorAttachments;
-            Rhi::FRhiRenderPassDepthStencilAttachment   mCompiledDepthAttachment;
-            bool                                        mHasCompiledDepth = false;
+            TFrameVector<Rhi::FRhiRenderPassColorAttachment> mCompiledColorAttachments;
+            Rhi::FRhiRenderPassDepthStencilAttachment        mCompiledDepthAttachment;
+            bool                                             mHasCompiledDepth = false;
+
+            bool                                             mIsCulled = false;
+            // Merged passes share one render pass: the first one begins it, the last one ends it.
+            bool                                             mMergesWithPrevious = false;
+            bool                                             mMergesWithNext     = false;
+
+            u32 mRecordChunkCount = 1U;
+            // First of the lists this pass was recorded into by RecordParallelPasses, if any.
+            u32 mFirstRecordedList = ~0U;
+
+            [[nodiscard]] auto HasRenderPass() const noexcept -> bool {
+                return mDesc.mType == EFrameGraphPassType::Raster
+                    && (!mCompiledColorAttachments.IsEmpty() || mHasCompiledDepth);
+            }
         };
 
         TVector<Rhi::FRhiTransitionInfo>         mCompiledBeginTransitions;
@@ -377,6 +481,26 @@ namespace AltinaEngine::RenderCore {
         auto AllocatePass(const FFrameGraphPassDesc& desc) -> u32;
 
         void ResetGraph();
+        void CullPasses();
+        void AllocateTransientResources();
+        void CreateViews();
+        void CompileAttachments();
+        // Also records the barriers and merge decisions into `record` when given.
+        void CompileTransitions(FFrameGraphCompileCache::FEntry* record);
+        void MergeRenderPasses();
+        [[nodiscard]] auto HashDeclaration() const noexcept -> u64;
+        void               StoreCulling(FFrameGraphCompileCache::FEntry& entry) const;
+        void               ApplyCachedCulling(const FFrameGraphCompileCache::FEntry& entry);
+        [[nodiscard]] auto HasCachedStartStates(
+            const FFrameGraphCompileCache::FEntry& entry) const noexcept -> bool;
+        void               RestoreTransitions(const FFrameGraphCompileCache::FEntry& entry);
+        void               RecordParallelPasses();
+        // Replays the lists recorded for `pass`, or runs its execute for every chunk.
+        void               ExecutePassBody(FRdgPass& pass, Rhi::FRhiCmdContext& cmdContext);
+        [[nodiscard]] auto CanMergeRenderPasses(
+            const FRdgPass& previous, const FRdgPass& next) const -> bool;
+        [[nodiscard]] auto IsCulledResource(bool isTexture, u32 resourceId) const noexcept -> bool;
+        [[nodiscard]] auto GetTransientSlot(bool isTexture, u32 resourceId) const noexcept -> u32;
 
         auto CreateTextureInternal(const FFrameGraphTextureDesc& desc) -> FFrameGraphTextureRef;
         auto CreateBufferInternal(const FFrameGraphBufferDesc& desc) -> FFrameGraphBufferRef;
@@ -404,6 +528,7 @@ namespace AltinaEngine::RenderCore {
         void SetExternalOutputInternal(
             u32 passIndex, FFrameGraphTextureRef tex, Rhi::ERhiResourceState finalState);
         void               SetSideEffectInternal(u32 passIndex);
+        void               SetRecordChunksInternal(u32 passIndex, u32 chunkCount);
 
         [[nodiscard]] auto ResolveTexture(FFrameGraphTextureRef ref) const -> Rhi::FRhiTexture*;
         [[nodiscard]] auto ResolveBuffer(FFrameGraphBufferRef ref) const -> Rhi::FRhiBuffer*;
@@ -418,6 +543,17 @@ namespace AltinaEngine::RenderCore {
         bool                      mInFrame    = false;
         bool                      mCompiled   = false;
 
+        FFrameGraphTransientPool  mOwnedTransientPool;
+        FFrameGraphTransientPool* mTransientPool     = nullptr;
+        bool                      mHasTransientGraph = false;
+        FFrameGraphCompileCache   mOwnedCompileCache;
+        FFrameGraphCompileCache*  mCompileCache = nullptr;
+        FFrameGraphTransientStats mTransientStats;
+        FFrameGraphCompileStats   mCompileStats;
+        FFrameGraphRecordStats    mRecordStats;
+        // Command lists of ParallelRecord passes; kept for the graph's lifetime and reused.
+        TVector<Container::TOwner<Rhi::FRhiCmdList>> mRecordedLists;
+
         TVector<FRdgTextureEntry> mTextures;
         TVector<FRdgBufferEntry>  mBuffers;
         TVector<FRdgSRVEntry>     mSRVs;
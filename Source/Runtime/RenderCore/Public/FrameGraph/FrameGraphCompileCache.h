@@ -0,0 +1,96 @@
+#pragma once
+
+#include "RenderCoreAPI.h"
+
+#include "Container/Vector.h"
+#include "Types/Aliases.h"
+#include "Rhi/RhiStructs.h"
+
+namespace AltinaEngine::RenderCore {
+    namespace Container = Core::Container;
+    using Container::TVector;
+
+    /**
+     * @brief Totals of every compile that went through a `FFrameGraphCompileCache`.
+     */
+    struct FFrameGraphCompileCacheStats {
+        u64 Hits             = 0ULL; // declaration seen before: culling and merging reused
+        u64 TransitionHits   = 0ULL; // hits whose cached transitions matched the start states
+        u64 Misses           = 0ULL;
+        u64 SavedNanoseconds = 0ULL; // last measured cost of the stages hits skipped
+    };
+
+    /**
+     * @brief Compile results of recently seen frame graph declarations.
+     *
+     * A graph hashes what it was declared with (passes, accesses, render targets and the
+     * external/output flags of its resources, but not the RHI objects bound to them) and looks
+     * the hash up before compiling. On a hit the pass/resource culling and render pass merging
+     * are taken from the cache, and so are the barrier lists when every resource starts in the
+     * state it started in when they were compiled; otherwise the barriers are recompiled and the
+     * entry refreshed. Cached barriers refer to resources by graph handle, so a different
+     * swapchain image or recycled transient does not invalidate them.
+     *
+     * Like `FFrameGraphTransientPool`, keep one next to the code that builds the graphs and pass
+     * it to every `FFrameGraph` created there; it is not thread-safe.
+     */
+    class AE_RENDER_CORE_API FFrameGraphCompileCache {
+    public:
+        // Declarations kept; the least recently used one is dropped beyond this.
+        static constexpr u32 kMaxEntries = 8U;
+
+        void               Reset();
+
+        [[nodiscard]] auto GetEntryCount() const noexcept -> u32 {
+            return static_cast<u32>(mEntries.Size());
+        }
+        [[nodiscard]] auto GetStats() const noexcept -> const FFrameGraphCompileCacheStats& {
+            return mStats;
+        }
+
+    private:
+        friend class FFrameGraph;
+
+        struct FTransition {
+            bool                    mIsTexture  = true;
+            u32                     mResourceId = 0U;
+            Rhi::FRhiTransitionInfo mInfo; // mResource is resolved again on every hit
+        };
+
+        struct FPass {
+            TVector<FTransition> mPreTransitions;
+            bool                 mIsCulled           = false;
+            bool                 mMergesWithPrevious = false;
+            bool                 mMergesWithNext     = false;
+        };
+
+        struct FEntry {
+            u64                             mHash                  = 0ULL;
+            u64                             mLastUsed              = 0ULL;
+            u32                             mTextureCount          = 0U;
+            u32                             mBufferCount           = 0U;
+            TVector<FPass>                  mPasses;
+            TVector<bool>                   mCulledTextures;
+            TVector<bool>                   mCulledBuffers;
+            TVector<Rhi::ERhiResourceState> mTextureStartStates;
+            TVector<Rhi::ERhiResourceState> mBufferStartStates;
+            TVector<FTransition>            mBeginTransitions;
+            TVector<FTransition>            mFinalTransitions;
+            u32                             mCulledPasses          = 0U;
+            u32                             mCulledTextureCount    = 0U;
+            u32                             mCulledBufferCount     = 0U;
+            u32                             mMergedPasses          = 0U;
+            u64                             mCullNanoseconds       = 0ULL;
+            u64                             mTransitionNanoseconds = 0ULL;
+        };
+
+        [[nodiscard]] auto Find(u64 hash, u32 passCount, u32 textureCount, u32 bufferCount)
+            -> FEntry*;
+        // Returns a cleared entry for `hash`, evicting the least recently used one when full.
+        [[nodiscard]] auto Add(u64 hash) -> FEntry&;
+
+        TVector<FEntry>              mEntries;
+        u64                          mUseSerial = 0ULL;
+        FFrameGraphCompileCacheStats mStats;
+    };
+} // namespace AltinaEngine::RenderCore
@@ -3,16 +3,67 @@
 #include "RenderCoreAPI.h"
 
 #include "FrameGraph/FrameGraph.h"
+#include "Rhi/Command/RhiCmdContextOps.h"
 #include "Rhi/RhiDevice.h"
+#include "Rhi/RhiRefs.h"
 
 namespace AltinaEngine::RenderCore {
+    /**
+     * @brief Scheduling and synchronization of the last `FFrameGraphExecutor::Execute` call.
+     */
+    struct FFrameGraphExecutorStats {
+        u32 Passes          = 0U;
+        u32 AsyncPasses     = 0U; // passes recorded on a dedicated compute/copy queue
+        u32 HoistedPasses   = 0U; // passes recorded ahead of graphics passes declared before them
+        u32 Submits         = 0U;
+        u32 Waits           = 0U;
+        u32 RedundantWaits  = 0U; // cross-queue dependencies already covered by an earlier wait
+        u32 ContextsCreated = 0U; // 0 once the per-queue contexts are pooled
+    };
+
+    /**
+     * @brief Records and submits compiled frame graphs.
+     *
+     * Passes on a dedicated compute or copy queue are recorded as soon as the passes they depend
+     * on have been, so they overlap the graphics passes declared around them; each queue keeps
+     * its declaration order. Queues synchronize through one timeline semaphore per queue, and a
+     * queue only waits when no earlier wait already covers the dependency. ParallelRecord passes
+     * are recorded on job workers up front and replayed into their queue's context in order.
+     *
+     * Command contexts, semaphores and cross-queue transitions are kept across calls; keep one
+     * executor per device on the render thread.
+     */
     class AE_RENDER_CORE_API FFrameGraphExecutor {
     public:
         explicit FFrameGraphExecutor(Rhi::FRhiDevice& device);
 
-        void Execute(FFrameGraph& graph);
+        void               Execute(FFrameGraph& graph);
+
+        [[nodiscard]] auto GetDevice() const noexcept -> Rhi::FRhiDevice* { return mDevice; }
+        [[nodiscard]] auto GetStats() const noexcept -> const FFrameGraphExecutorStats& {
+            return mStats;
+        }
 
     private:
-        Rhi::FRhiDevice* mDevice = nullptr;
+        static constexpr u32 kQueueCount = 3U;
+
+        struct FQueueSlot {
+            Rhi::FRhiQueueRef          mQueue;
+            Rhi::FRhiCommandContextRef mContext;
+            Rhi::IRhiCmdContextOps*    mOps = nullptr;
+            Rhi::FRhiSemaphoreRef      mTimeline;
+            u64                        mSignaledValue = 0ULL;
+            bool                       mInitialized   = false;
+        };
+
+        void                 InitQueueSlot(u32 queueIndex);
+        [[nodiscard]] auto   GetTimeline(u32 queueIndex) -> Rhi::FRhiSemaphore*;
+        [[nodiscard]] auto   GetQueueTransition(u32 srcQueue, u32 dstQueue) -> Rhi::FRhiTransition*;
+
+        Rhi::FRhiDevice*         mDevice = nullptr;
+        FQueueSlot               mQueueSlots[kQueueCount]{};
+        // Ownership-transfer tokens, one per (source, destination) queue pair.
+        Rhi::FRhiTransitionRef   mQueueTransitions[kQueueCount * kQueueCount]{};
+        FFrameGraphExecutorStats mStats{};
     };
 } // namespace AltinaEngine::RenderCore
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "RenderCoreAPI.h"
+
+#include "Container/Vector.h"
+#include "Types/Aliases.h"
+#include "Rhi/RhiRefs.h"
+#include "Rhi/RhiStructs.h"
+
+namespace AltinaEngine::RenderCore {
+    namespace Container = Core::Container;
+    using Container::TVector;
+
+    /**
+     * @brief Transient resource usage of the last compiled frame graph.
+     *
+     * "Naive" is what the graph would cost with one allocation per transient resource, "peak
+     * live" is the largest set of transients alive during the same pass, and "allocated" is the
+     * size of the pooled RHI objects actually bound to them.
+     */
+    struct FFrameGraphTransientStats {
+        u32                TransientTextures = 0U;
+        u32                TransientBuffers  = 0U;
+        u32                PhysicalTextures  = 0U;
+        u32                PhysicalBuffers   = 0U;
+        u32                Created           = 0U; // new RHI objects created by the compile
+        u32                ReusedFromPool    = 0U; // objects kept from a previous graph
+        u32                Aliased           = 0U; // objects handed over within the same graph
+        u32                Unpooled          = 0U; // CPU-visible or async-queue resources
+        u32                PooledObjects     = 0U;
+        u64                NaiveBytes        = 0ULL;
+        u64                PeakLiveBytes     = 0ULL;
+        u64                AllocatedBytes    = 0ULL;
+        u64                PooledBytes       = 0ULL;
+
+        [[nodiscard]] auto GetSavedBytes() const noexcept -> u64 {
+            return (NaiveBytes > AllocatedBytes) ? (NaiveBytes - AllocatedBytes) : 0ULL;
+        }
+    };
+
+    /**
+     * @brief Rough GPU footprint of a texture (all mips, layers and samples).
+     */
+    [[nodiscard]] AE_RENDER_CORE_API auto EstimateTextureSizeBytes(
+        const Rhi::FRhiTextureDesc& desc) noexcept -> u64;
+
+    /**
+     * @brief Recycles frame graph transient textures and buffers across graphs.
+     *
+     * Objects are matched by their RHI description (the debug name is ignored) and carry the
+     * resource state they were left in, so a recycled texture starts the next graph with a
+     * transition from its previous final state. Within one graph, an object is handed to the
+     * next transient with the same description once the last pass using it has run.
+     *
+     * Views created on a pooled object are kept with it and handed out again when a later graph
+     * asks for the same format and range, so steady-state frames create no views for transients.
+     *
+     * A pool is bound to one device and is not thread-safe; keep it next to the code that builds
+     * the graphs (the render thread) and pass it to every `FFrameGraph` created there.
+     */
+    class AE_RENDER_CORE_API FFrameGraphTransientPool {
+    public:
+        // Objects not used by this many graphs in a row are released.
+        static constexpr u32 kEvictAfterGraphs = 120U;
+        // Views kept per pooled object; the oldest one is dropped beyond this.
+        static constexpr u32 kMaxViewsPerObject = 8U;
+
+        FFrameGraphTransientPool();
+        ~FFrameGraphTransientPool();
+
+        void               Reset();
+
+        [[nodiscard]] auto GetPooledObjectCount() const noexcept -> u32;
+        [[nodiscard]] auto GetPooledBytes() const noexcept -> u64;
+
+    private:
+        friend class FFrameGraph;
+
+        template <typename TViewRef, typename TViewDesc> struct TCachedView {
+            TViewDesc mDesc;
+            TViewRef  mView;
+        };
+        using FCachedSRV = TCachedView<Rhi::FRhiShaderResourceViewRef,
+            Rhi::FRhiShaderResourceViewDesc>;
+        using FCachedUAV = TCachedView<Rhi::FRhiUnorderedAccessViewRef,
+            Rhi::FRhiUnorderedAccessViewDesc>;
+        using FCachedRTV = TCachedView<Rhi::FRhiRenderTargetViewRef, Rhi::FRhiRenderTargetViewDesc>;
+        using FCachedDSV = TCachedView<Rhi::FRhiDepthStencilViewRef, Rhi::FRhiDepthStencilViewDesc>;
+
+        template <typename TRef, typename TDesc> struct TSlot {
+            TRef                   mResource;
+            TDesc                  mDesc;
+            // Each cached view holds one reference to mResource.
+            TVector<FCachedSRV>    mSRVs;
+            TVector<FCachedUAV>    mUAVs;
+            TVector<FCachedRTV>    mRTVs;
+            TVector<FCachedDSV>    mDSVs;
+            u64                    mKey           = 0ULL;
+            u64                    mSizeBytes     = 0ULL;
+            Rhi::ERhiResourceState mState         = Rhi::ERhiResourceState::Common;
+            Rhi::ERhiResourceState mCommitted     = Rhi::ERhiResourceState::Common;
+            u64                    mCreatedGraph  = 0ULL;
+            u64                    mLastUsedGraph = 0ULL;
+            u32                    mAcquireCount  = 0U; // within the current graph
+            bool                   mInUse         = false;
+        };
+        using FTextureSlot = TSlot<Rhi::FRhiTextureRef, Rhi::FRhiTextureDesc>;
+        using FBufferSlot  = TSlot<Rhi::FRhiBufferRef, Rhi::FRhiBufferDesc>;
+
+        // Start (or restart, when a graph is recompiled) the acquisitions of the current graph.
+        void BeginGraph(Rhi::FRhiDevice& device);
+        // Commit resource states once the graph is done and evict stale objects.
+        void EndGraph();
+
+        [[nodiscard]] auto AcquireTexture(const Rhi::FRhiTextureDesc& desc,
+            Rhi::ERhiResourceState initialState, FFrameGraphTransientStats& stats) -> u32;
+        [[nodiscard]] auto AcquireBuffer(const Rhi::FRhiBufferDesc& desc,
+            Rhi::ERhiResourceState initialState, FFrameGraphTransientStats& stats) -> u32;
+        void ReleaseTexture(u32 slot, Rhi::ERhiResourceState finalState);
+        void ReleaseBuffer(u32 slot, Rhi::ERhiResourceState finalState);
+
+        // Return a view of a pooled object, creating it on first use. `desc` must already point
+        // at the pooled resource; bReused tells whether an existing view was handed out.
+        [[nodiscard]] auto GetSRV(bool isTexture, u32 slot,
+            const Rhi::FRhiShaderResourceViewDesc& desc, bool& bReused)
+            -> Rhi::FRhiShaderResourceViewRef;
+        [[nodiscard]] auto GetUAV(bool isTexture, u32 slot,
+            const Rhi::FRhiUnorderedAccessViewDesc& desc, bool& bReused)
+            -> Rhi::FRhiUnorderedAccessViewRef;
+        [[nodiscard]] auto GetRTV(u32 slot, const Rhi::FRhiRenderTargetViewDesc& desc,
+            bool& bReused) -> Rhi::FRhiRenderTargetViewRef;
+        [[nodiscard]] auto GetDSV(u32 slot, const Rhi::FRhiDepthStencilViewDesc& desc,
+            bool& bReused) -> Rhi::FRhiDepthStencilViewRef;
+
+        Rhi::FRhiDevice*      mDevice = nullptr;
+        TVector<FTextureSlot> mTextures;
+        TVector<FBufferSlot>  mBuffers;
+        u64                   mGraphSerial = 1ULL;
+    };
+} // namespace AltinaEngine::RenderCore
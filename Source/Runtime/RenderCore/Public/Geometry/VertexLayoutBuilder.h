@@ -73,6 +73,9 @@ namespace AltinaEngine::RenderCore::Geometry {
     AE_RENDER_CORE_API auto MakeVertexSemanticKey(
         FStringView semanticName, u32 semanticIndex) noexcept -> FVertexSemanticKey;
     AE_RENDER_CORE_API auto EncodeVertexSemanticKey(const FVertexSemanticKey& key) noexcept -> u64;
+    // Semantic names hash case-insensitively, like HashVertexSemanticName.
+    AE_RENDER_CORE_API auto HashVertexLayout(const Rhi::FRhiVertexLayoutDesc& layout) noexcept
+        -> u64;
 
     // Bootstrap helper for migration: build requirement from an existing manual vertex layout.
     AE_RENDER_CORE_API auto BuildShaderVertexInputRequirementFromVertexLayout(
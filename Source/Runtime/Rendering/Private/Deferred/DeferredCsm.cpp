@@ -189,6 +189,9 @@ namespace AltinaEngine::Rendering::Deferred {
         RenderCore::FFrameGraphPassDesc shadowPassDesc{};
         shadowPassDesc.mType  = RenderCore::EFrameGraphPassType::Raster;
         shadowPassDesc.mQueue = RenderCore::EFrameGraphQueue::Graphics;
+        // Cascades write disjoint layers and bind their own per-frame data, so they record
+        // concurrently; ExecuteCascadeFn must not touch state shared between cascades.
+        shadowPassDesc.mFlags = RenderCore::EFrameGraphPassFlags::ParallelRecord;
 
         for (u32 cascade = 0U; cascade < csmData.mCascadeCount; ++cascade) {
             struct FShadowPassData {
@@ -26,6 +26,7 @@ namespace AltinaEngine::Rendering::Deferred {
     void               FillPerFrameCsmConstants(
                       const FCsmBuildResult& csm, FPerFrameConstants& outPerFrameConstants);
 
+    // Called once per cascade, possibly on job workers and for several cascades at once.
     using FCsmExecuteCascadeFn = void (*)(Rhi::FRhiCmdContext& ctx, u32 cascadeIndex,
         const Core::Math::FMatrix4x4f& lightViewProj, u32 shadowMapSize, void* userData);
 
@@ -70,18 +70,14 @@ namespace AltinaEngine::Rendering::PostProcess::Builtin {
             cmd.RHISetScissor(scissor);
         }
 
-        [[nodiscard]] auto FindParamValue(const FPostProcessParams& params,
-            Container::FStringView name) -> const FPostProcessParamValue* {
-            for (const auto& it : params) {
-                if (it.first.ToView() == name) {
-                    return &it.second;
-                }
-            }
-            return nullptr;
+        [[nodiscard]] auto FindParamValue(const FPostProcessParams& params, Container::FName name)
+            -> const FPostProcessParamValue* {
+            const auto it = params.FindIt(name);
+            return (it != params.end()) ? &it->second : nullptr;
         }
 
-        [[nodiscard]] auto GetParamF32(const FPostProcessParams& params,
-            Container::FStringView name, f32 defaultValue) -> f32 {
+        [[nodiscard]] auto GetParamF32(const FPostProcessParams& params, Container::FName name,
+            f32 defaultValue) -> f32 {
             const auto* v = FindParamValue(params, name);
             if (v == nullptr) {
                 return defaultValue;
@@ -98,8 +94,8 @@ namespace AltinaEngine::Rendering::PostProcess::Builtin {
             return defaultValue;
         }
 
-        [[nodiscard]] auto GetParamI32(const FPostProcessParams& params,
-            Container::FStringView name, i32 defaultValue) -> i32 {
+        [[nodiscard]] auto GetParamI32(const FPostProcessParams& params, Container::FName name,
+            i32 defaultValue) -> i32 {
             const auto* v = FindParamValue(params, name);
             if (v == nullptr) {
                 return defaultValue;
@@ -340,14 +336,15 @@ namespace AltinaEngine::Rendering::PostProcess::Builtin {
             return;
         }
 
+        const auto&  names = Detail::GetPostProcessNames();
         FBloomParams params{};
-        params.Threshold    = GetParamF32(node.Params, TEXT("Threshold"), 1.0f);
-        params.Knee         = GetParamF32(node.Params, TEXT("Knee"), 0.5f);
-        params.Intensity    = GetParamF32(node.Params, TEXT("Intensity"), 0.05f);
-        params.KawaseOffset = GetParamF32(node.Params, TEXT("KawaseOffset"), 1.0f);
-        params.Iterations   = GetParamI32(node.Params, TEXT("Iterations"), 5);
+        params.Threshold    = GetParamF32(node.Params, names.BloomThreshold, 1.0f);
+        params.Knee         = GetParamF32(node.Params, names.BloomKnee, 0.5f);
+        params.Intensity    = GetParamF32(node.Params, names.BloomIntensity, 0.05f);
+        params.KawaseOffset = GetParamF32(node.Params, names.BloomKawaseOffset, 1.0f);
+        params.Iterations   = GetParamI32(node.Params, names.BloomIterations, 5);
         params.bFirstDownsampleLumaWeight =
-            (GetParamI32(node.Params, TEXT("FirstDownsampleLumaWeight"), 0) != 0);
+            (GetParamI32(node.Params, names.BloomFirstDownsampleLumaWeight, 0) != 0);
 
         if (params.Iterations < 1) {
             params.Iterations = 1;
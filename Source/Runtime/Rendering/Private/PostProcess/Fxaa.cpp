@@ -29,18 +29,14 @@ namespace AltinaEngine::Rendering::PostProcess::Builtin {
             buffer->Unlock(lock);
         }
 
-        [[nodiscard]] auto FindParamValue(const FPostProcessParams& params,
-            Container::FStringView name) -> const FPostProcessParamValue* {
-            for (const auto& it : params) {
-                if (it.first.ToView() == name) {
-                    return &it.second;
-                }
-            }
-            return nullptr;
+        [[nodiscard]] auto FindParamValue(const FPostProcessParams& params, Container::FName name)
+            -> const FPostProcessParamValue* {
+            const auto it = params.FindIt(name);
+            return (it != params.end()) ? &it->second : nullptr;
         }
 
-        [[nodiscard]] auto GetParamF32(const FPostProcessParams& params,
-            Container::FStringView name, f32 defaultValue) -> f32 {
+        [[nodiscard]] auto GetParamF32(const FPostProcessParams& params, Container::FName name,
+            f32 defaultValue) -> f32 {
             const auto* v = FindParamValue(params, name);
             if (v == nullptr) {
                 return defaultValue;
@@ -91,9 +87,11 @@ namespace AltinaEngine::Rendering::PostProcess::Builtin {
         outDesc.mDesc.mBindFlags =
             Rhi::ERhiTextureBindFlags::RenderTarget | Rhi::ERhiTextureBindFlags::ShaderResource;
 
-        const f32 edgeThreshold    = GetParamF32(node.Params, TEXT("EdgeThreshold"), 0.125f);
-        const f32 edgeThresholdMin = GetParamF32(node.Params, TEXT("EdgeThresholdMin"), 0.0312f);
-        const f32 subpix           = GetParamF32(node.Params, TEXT("Subpix"), 0.75f);
+        const auto& names            = Detail::GetPostProcessNames();
+        const f32   edgeThreshold    = GetParamF32(node.Params, names.FxaaEdgeThreshold, 0.125f);
+        const f32   edgeThresholdMin =
+            GetParamF32(node.Params, names.FxaaEdgeThresholdMin, 0.0312f);
+        const f32   subpix           = GetParamF32(node.Params, names.FxaaSubpix, 0.75f);
 
         RenderCore::FFrameGraphTextureRef outRef{};
 
@@ -36,10 +36,10 @@ namespace AltinaEngine::Rendering {
         };
 
         struct FRegistryState {
-            std::mutex                      Mutex;
-            THashMap<FString, FEffectEntry> Effects;
-            THashMap<FString, bool>         MissingLoggedOnce;
-            bool                            bBuiltinsRegistered = false;
+            std::mutex                    Mutex;
+            THashMap<FName, FEffectEntry> Effects;
+            THashMap<FName, bool>         MissingLoggedOnce;
+            bool                          bBuiltinsRegistered = false;
         };
 
         auto GetRegistryState() -> FRegistryState& {
@@ -59,13 +59,14 @@ namespace AltinaEngine::Rendering {
             }
 
             // Built-ins.
-            s.Effects[FString(TEXT("TAA"))]     = FEffectEntry{ &PostProcess::Builtin::AddTaa };
-            s.Effects[FString(TEXT("Bloom"))]   = FEffectEntry{ &PostProcess::Builtin::AddBloom };
-            s.Effects[FString(TEXT("Tonemap"))] = FEffectEntry{ &PostProcess::Builtin::AddTonemap };
-            s.Effects[FString(TEXT("Fxaa"))]    = FEffectEntry{ &PostProcess::Builtin::AddFxaa };
+            const auto& names        = PostProcess::Detail::GetPostProcessNames();
+            s.Effects[names.Taa]     = FEffectEntry{ &PostProcess::Builtin::AddTaa };
+            s.Effects[names.Bloom]   = FEffectEntry{ &PostProcess::Builtin::AddBloom };
+            s.Effects[names.Tonemap] = FEffectEntry{ &PostProcess::Builtin::AddTonemap };
+            s.Effects[names.Fxaa]    = FEffectEntry{ &PostProcess::Builtin::AddFxaa };
             // Common alias.
-            s.Effects[FString(TEXT("FXAA"))]  = FEffectEntry{ &PostProcess::Builtin::AddFxaa };
-            s.Effects[FString(TEXT("BLOOM"))] = FEffectEntry{ &PostProcess::Builtin::AddBloom };
+            s.Effects[FName(TEXT("FXAA"))]  = FEffectEntry{ &PostProcess::Builtin::AddFxaa };
+            s.Effects[FName(TEXT("BLOOM"))] = FEffectEntry{ &PostProcess::Builtin::AddBloom };
 
             s.bBuiltinsRegistered = true;
         }
@@ -207,7 +208,7 @@ namespace AltinaEngine::Rendering {
 
         auto&            s = GetRegistryState();
         std::scoped_lock lock(s.Mutex);
-        s.Effects[FString(effectId)] = FEffectEntry{ fn };
+        s.Effects[FName(effectId)] = FEffectEntry{ fn };
         return true;
     }
 
@@ -217,7 +218,7 @@ namespace AltinaEngine::Rendering {
         }
         auto&            s = GetRegistryState();
         std::scoped_lock lock(s.Mutex);
-        const auto       it = s.Effects.FindIt(FString(effectId));
+        const auto       it = s.Effects.FindIt(FName::Find(effectId));
         if (it == s.Effects.end()) {
             return false;
         }
@@ -238,7 +239,7 @@ namespace AltinaEngine::Rendering {
                 if (!node.bEnabled) {
                     continue;
                 }
-                if (node.EffectId.IsEmptyString()) {
+                if (node.EffectId.IsNone()) {
                     continue;
                 }
 
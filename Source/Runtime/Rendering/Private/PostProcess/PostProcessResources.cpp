@@ -690,6 +690,11 @@ namespace AltinaEngine::Rendering::PostProcess::Detail {
         }
     } // namespace
 
+    auto GetPostProcessNames() -> const FPostProcessNames& {
+        static const FPostProcessNames sNames{};
+        return sNames;
+    }
+
     auto GetPostProcessSharedResources() -> FPostProcessSharedResources& {
         static FPostProcessSharedResources sResources{};
         return sResources;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Container/Name.h"
 #include "Container/SmartPtr.h"
 #include "Container/StringView.h"
 #include "Math/Matrix.h"
@@ -24,6 +25,30 @@ namespace AltinaEngine::Rendering::PostProcess::Detail {
     inline constexpr auto kNameHistoryColor     = TEXT("HistoryColor");
     inline constexpr auto kNameSceneDepth       = TEXT("SceneDepth");
 
+    // Built-in effect ids and the parameter names each effect reads, interned once so per-frame
+    // parameter lookups are handle compares.
+    struct FPostProcessNames {
+        Core::Container::FName Taa{ TEXT("TAA") };
+        Core::Container::FName TaaAlpha{ TEXT("Alpha") };
+        Core::Container::FName TaaClampK{ TEXT("ClampK") };
+        Core::Container::FName Bloom{ TEXT("Bloom") };
+        Core::Container::FName BloomThreshold{ TEXT("Threshold") };
+        Core::Container::FName BloomKnee{ TEXT("Knee") };
+        Core::Container::FName BloomIntensity{ TEXT("Intensity") };
+        Core::Container::FName BloomKawaseOffset{ TEXT("KawaseOffset") };
+        Core::Container::FName BloomIterations{ TEXT("Iterations") };
+        Core::Container::FName BloomFirstDownsampleLumaWeight{ TEXT("FirstDownsampleLumaWeight") };
+        Core::Container::FName Tonemap{ TEXT("Tonemap") };
+        Core::Container::FName TonemapExposure{ TEXT("Exposure") };
+        Core::Container::FName TonemapGamma{ TEXT("Gamma") };
+        Core::Container::FName Fxaa{ TEXT("Fxaa") };
+        Core::Container::FName FxaaEdgeThreshold{ TEXT("EdgeThreshold") };
+        Core::Container::FName FxaaEdgeThresholdMin{ TEXT("EdgeThresholdMin") };
+        Core::Container::FName FxaaSubpix{ TEXT("Subpix") };
+    };
+
+    [[nodiscard]] auto GetPostProcessNames() -> const FPostProcessNames&;
+
     // Constant buffer layouts (b0) for each post-process pass. Keep each struct size a multiple of
     // 16 bytes to match HLSL packing and avoid /WX padding warnings.
 
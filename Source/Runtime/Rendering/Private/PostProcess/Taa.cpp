@@ -34,18 +34,14 @@ namespace AltinaEngine::Rendering::PostProcess::Builtin {
             buffer->Unlock(lock);
         }
 
-        [[nodiscard]] auto FindParamValue(const FPostProcessParams& params,
-            Container::FStringView name) -> const FPostProcessParamValue* {
-            for (const auto& it : params) {
-                if (it.first.ToView() == name) {
-                    return &it.second;
-                }
-            }
-            return nullptr;
+        [[nodiscard]] auto FindParamValue(const FPostProcessParams& params, Container::FName name)
+            -> const FPostProcessParamValue* {
+            const auto it = params.FindIt(name);
+            return (it != params.end()) ? &it->second : nullptr;
         }
 
-        [[nodiscard]] auto GetParamF32(const FPostProcessParams& params,
-            Container::FStringView name, f32 defaultValue) -> f32 {
+        [[nodiscard]] auto GetParamF32(const FPostProcessParams& params, Container::FName name,
+            f32 defaultValue) -> f32 {
             const auto* v = FindParamValue(params, name);
             if (v == nullptr) {
                 return defaultValue;
@@ -139,8 +135,9 @@ namespace AltinaEngine::Rendering::PostProcess::Builtin {
             graph.ImportTexture(historyWrite, Rhi::ERhiResourceState::RenderTarget);
 
         // Params.
-        const f32                         alpha  = GetParamF32(node.Params, TEXT("Alpha"), 0.9f);
-        const f32                         clampK = GetParamF32(node.Params, TEXT("ClampK"), 1.0f);
+        const auto&                       names  = Detail::GetPostProcessNames();
+        const f32                         alpha  = GetParamF32(node.Params, names.TaaAlpha, 0.9f);
+        const f32                         clampK = GetParamF32(node.Params, names.TaaClampK, 1.0f);
 
         RenderCore::FFrameGraphTextureRef outRef{};
 
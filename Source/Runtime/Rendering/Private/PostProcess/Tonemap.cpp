@@ -29,18 +29,14 @@ namespace AltinaEngine::Rendering::PostProcess::Builtin {
             buffer->Unlock(lock);
         }
 
-        [[nodiscard]] auto FindParamValue(const FPostProcessParams& params,
-            Container::FStringView name) -> const FPostProcessParamValue* {
-            for (const auto& it : params) {
-                if (it.first.ToView() == name) {
-                    return &it.second;
-                }
-            }
-            return nullptr;
+        [[nodiscard]] auto FindParamValue(const FPostProcessParams& params, Container::FName name)
+            -> const FPostProcessParamValue* {
+            const auto it = params.FindIt(name);
+            return (it != params.end()) ? &it->second : nullptr;
         }
 
-        [[nodiscard]] auto GetParamF32(const FPostProcessParams& params,
-            Container::FStringView name, f32 defaultValue) -> f32 {
+        [[nodiscard]] auto GetParamF32(const FPostProcessParams& params, Container::FName name,
+            f32 defaultValue) -> f32 {
             const auto* v = FindParamValue(params, name);
             if (v == nullptr) {
                 return defaultValue;
@@ -85,8 +81,9 @@ namespace AltinaEngine::Rendering::PostProcess::Builtin {
         outDesc.mDesc.mBindFlags =
             Rhi::ERhiTextureBindFlags::RenderTarget | Rhi::ERhiTextureBindFlags::ShaderResource;
 
-        const f32 exposure = GetParamF32(node.Params, TEXT("Exposure"), 1.0f);
-        const f32 gamma    = GetParamF32(node.Params, TEXT("Gamma"), 2.2f);
+        const auto& names    = Detail::GetPostProcessNames();
+        const f32   exposure = GetParamF32(node.Params, names.TonemapExposure, 1.0f);
+        const f32   gamma    = GetParamF32(node.Params, names.TonemapGamma, 2.2f);
 
         RenderCore::FFrameGraphTextureRef outRef{};
 
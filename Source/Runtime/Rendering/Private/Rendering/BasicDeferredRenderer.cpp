@@ -8,6 +8,7 @@
 #include "Deferred/DeferredTypes.h"
 #include "Deferred/DeferredScenePasses.h"
 #include "Deferred/DeferredCsm.h"
+#include "PostProcess/PostProcessResources.h"
 
 #include "FrameGraph/FrameGraph.h"
 #include "Geometry/StaticMeshVertexFactory.h"
@@ -25,6 +26,7 @@
 #include "Container/HashMap.h"
 #include "Container/SmartPtr.h"
 #include "Container/Vector.h"
+#include "Jobs/JobSystem.h"
 #include "Logging/Log.h"
 #include "Platform/Generic/GenericPlatformDecl.h"
 #include "Rhi/Command/RhiCmdContext.h"
@@ -69,6 +71,8 @@ namespace AltinaEngine::Rendering {
         using Deferred::FInstanceDrawData;
         using Deferred::FPerFrameConstants;
         constexpr u32 kPerDrawConstantsStrideBytes = 256U;
+        // Smallest base pass chunk worth recording on a worker of its own.
+        constexpr u32 kMinBatchesPerRecordChunk    = 64U;
 
         struct FBasePassPipelineStats {
             u32 mBaseHits             = 0U;
@@ -902,12 +906,19 @@ namespace AltinaEngine::Rendering {
             Core::Platform::Generic::Memcpy(lock.mData, data, static_cast<usize>(sizeBytes));
             buffer->Unlock(lock);
         }
+        using FResolvedPipelineMap =
+            THashMap<const RenderCore::Render::FDrawBatch*, Rhi::FRhiPipeline*>;
+
         struct FBasePassPipelineData {
             Rhi::FRhiDevice*                     Device          = nullptr;
             RenderCore::FShaderRegistry*         Registry        = nullptr;
             THashMap<u64, Rhi::FRhiPipelineRef>* PipelineCache   = nullptr;
             const RenderCore::FMaterialPassDesc* DefaultPassDesc = nullptr;
             Rhi::FRhiVertexLayoutDesc            VertexLayout;
+            // Filled on the render thread before recording; passes recording on job workers
+            // only read these and never touch the shared pipeline caches.
+            const FResolvedPipelineMap*          ResolvedPipelines = nullptr;
+            Rhi::FRhiPipeline*                   ShadowPipeline    = nullptr;
         };
 
         auto ResolveBasePassPipeline(const RenderCore::Render::FDrawBatch& batch,
@@ -1054,6 +1065,42 @@ namespace AltinaEngine::Rendering {
             return ResolveBasePassPipeline(synthetic, &shadowDesc, &shadowData);
         }
 
+        // Resolves the pipeline of every bucket on the calling thread, keyed by the batch the
+        // executor hands to its resolver for that bucket.
+        void PreResolvePipelines(const RenderCore::Render::FDrawList& drawList,
+            FDrawPipelineResolver resolver, FBasePassPipelineData& pipelineData,
+            FResolvedPipelineMap& outPipelines) {
+            outPipelines.Reserve(drawList.mBuckets.Size());
+            for (const auto& bucket : drawList.mBuckets) {
+                if (bucket.mBatches.IsEmpty()) {
+                    continue;
+                }
+                const auto* passDesc = (bucket.mMaterial != nullptr)
+                    ? bucket.mMaterial->FindPassDesc(bucket.mPass)
+                    : nullptr;
+                outPipelines[&bucket.mBatches[0]] =
+                    resolver(bucket.mBatches[0], passDesc, &pipelineData);
+            }
+        }
+
+        auto FindResolvedPipeline(const RenderCore::Render::FDrawBatch& batch,
+            const RenderCore::FMaterialPassDesc* /*passDesc*/, void* userData)
+            -> Rhi::FRhiPipeline* {
+            const auto* data = static_cast<const FBasePassPipelineData*>(userData);
+            if (data == nullptr || data->ResolvedPipelines == nullptr) {
+                return nullptr;
+            }
+            const auto it = data->ResolvedPipelines->FindIt(&batch);
+            return (it != data->ResolvedPipelines->end()) ? it->second : nullptr;
+        }
+
+        auto FindResolvedShadowPipeline(const RenderCore::Render::FDrawBatch& /*batch*/,
+            const RenderCore::FMaterialPassDesc* /*passDesc*/, void* userData)
+            -> Rhi::FRhiPipeline* {
+            const auto* data = static_cast<const FBasePassPipelineData*>(userData);
+            return (data != nullptr) ? data->ShadowPipeline : nullptr;
+        }
+
         struct FBasePassBindingData {
             Rhi::FRhiBuffer* PerDrawBuffer                   = nullptr;
             Rhi::FRhiBuffer* PerDrawConstantsBuffer          = nullptr;
@@ -1259,58 +1306,60 @@ namespace AltinaEngine::Rendering {
         }
 
         [[nodiscard]] auto BuildDefaultPostProcessStack() -> FPostProcessStack {
+            const auto& names = PostProcess::Detail::GetPostProcessNames();
+
             FPostProcessStack stack{};
             stack.bEnable = (rPostProcessEnable.GetRenderValue() != 0);
 
             const bool bEnableTaa = (rPostProcessTaa.GetRenderValue() != 0);
             if (bEnableTaa) {
                 FPostProcessNode node{};
-                node.EffectId.Assign(TEXT("TAA"));
+                node.EffectId = names.Taa;
                 node.bEnabled = true;
-                node.Params[FString(TEXT("Alpha"))] =
+                node.Params[names.TaaAlpha] =
                     FPostProcessParamValue(rPostProcessTaaAlpha.GetRenderValue());
-                node.Params[FString(TEXT("ClampK"))] =
+                node.Params[names.TaaClampK] =
                     FPostProcessParamValue(rPostProcessTaaClampK.GetRenderValue());
                 stack.Stack.PushBack(Move(node));
             }
 
             if (rPostProcessBloom.GetRenderValue() != 0) {
                 FPostProcessNode node{};
-                node.EffectId.Assign(TEXT("Bloom"));
+                node.EffectId = names.Bloom;
                 node.bEnabled = true;
-                node.Params[FString(TEXT("Threshold"))] =
+                node.Params[names.BloomThreshold] =
                     FPostProcessParamValue(rPostProcessBloomThreshold.GetRenderValue());
-                node.Params[FString(TEXT("Knee"))] =
+                node.Params[names.BloomKnee] =
                     FPostProcessParamValue(rPostProcessBloomKnee.GetRenderValue());
-                node.Params[FString(TEXT("Intensity"))] =
+                node.Params[names.BloomIntensity] =
                     FPostProcessParamValue(rPostProcessBloomIntensity.GetRenderValue());
-                node.Params[FString(TEXT("KawaseOffset"))] =
+                node.Params[names.BloomKawaseOffset] =
                     FPostProcessParamValue(rPostProcessBloomKawaseOffset.GetRenderValue());
-                node.Params[FString(TEXT("Iterations"))] =
+                node.Params[names.BloomIterations] =
                     FPostProcessParamValue(rPostProcessBloomIterations.GetRenderValue());
-                node.Params[FString(TEXT("FirstDownsampleLumaWeight"))] = FPostProcessParamValue(
+                node.Params[names.BloomFirstDownsampleLumaWeight] = FPostProcessParamValue(
                     rPostProcessBloomFirstDownsampleLumaWeight.GetRenderValue());
                 stack.Stack.PushBack(Move(node));
             }
 
             if (rPostProcessTonemap.GetRenderValue() != 0) {
                 FPostProcessNode node{};
-                node.EffectId.Assign(TEXT("Tonemap"));
-                node.bEnabled                          = true;
-                node.Params[FString(TEXT("Exposure"))] = FPostProcessParamValue(1.0f);
-                node.Params[FString(TEXT("Gamma"))]    = FPostProcessParamValue(2.2f);
+                node.EffectId                      = names.Tonemap;
+                node.bEnabled                      = true;
+                node.Params[names.TonemapExposure] = FPostProcessParamValue(1.0f);
+                node.Params[names.TonemapGamma]    = FPostProcessParamValue(2.2f);
                 stack.Stack.PushBack(Move(node));
             }
 
             if (!bEnableTaa && rPostProcessFxaa.GetRenderValue() != 0) {
                 FPostProcessNode node{};
-                node.EffectId.Assign(TEXT("Fxaa"));
+                node.EffectId = names.Fxaa;
                 node.bEnabled = true;
-                node.Params[FString(TEXT("EdgeThreshold"))] =
+                node.Params[names.FxaaEdgeThreshold] =
                     FPostProcessParamValue(rPostProcessFxaaEdgeThreshold.GetRenderValue());
-                node.Params[FString(TEXT("EdgeThresholdMin"))] =
+                node.Params[names.FxaaEdgeThresholdMin] =
                     FPostProcessParamValue(rPostProcessFxaaEdgeThresholdMin.GetRenderValue());
-                node.Params[FString(TEXT("Subpix"))] =
+                node.Params[names.FxaaSubpix] =
                     FPostProcessParamValue(rPostProcessFxaaSubpix.GetRenderValue());
                 stack.Stack.PushBack(Move(node));
             }
@@ -1793,6 +1842,7 @@ namespace AltinaEngine::Rendering {
         basePassDesc.mName  = "BasicDeferred.BasePass";
         basePassDesc.mType  = RenderCore::EFrameGraphPassType::Raster;
         basePassDesc.mQueue = RenderCore::EFrameGraphQueue::Graphics;
+        basePassDesc.mFlags = RenderCore::EFrameGraphPassFlags::ParallelRecord;
 
         auto&       resources = GetSharedResources();
         auto*       device    = Rhi::RHIGetDevice();
@@ -1920,6 +1970,22 @@ namespace AltinaEngine::Rendering {
 
         const RenderCore::View::FViewRect viewRect = view->ViewRect;
 
+        // One chunk per worker plus the render thread, so the base pass records in parallel.
+        TVector<FDrawListChunk> recordChunks;
+        if (drawList != nullptr) {
+            auto*     pool      = Core::Jobs::FJobSystem::GetDefaultWorkerPool();
+            const u32 maxChunks = (pool != nullptr) ? static_cast<u32>(pool->GetWorkerCount()) + 1U
+                                                    : 1U;
+            recordChunks =
+                FDrawListExecutor::SplitDrawList(*drawList, maxChunks, kMinBatchesPerRecordChunk);
+        }
+        // Chunks record on job workers, so every bucket's pipeline is resolved here first.
+        FResolvedPipelineMap resolvedPipelines;
+        if (drawList != nullptr) {
+            PreResolvePipelines(
+                *drawList, ResolveBasePassPipeline, pipelineData, resolvedPipelines);
+        }
+
         graph.AddPass<FBasePassData>(
             basePassDesc,
             [&](RenderCore::FFrameGraphPassBuilder& builder, FBasePassData& data) -> void {
@@ -2048,14 +2114,16 @@ namespace AltinaEngine::Rendering {
                     (view != nullptr && view->bReverseZ) ? 0.0f : 1.0f;
 
                 builder.SetRenderTargets(rtvs, 3U, &depthBinding);
+                builder.SetRecordChunks(static_cast<u32>(recordChunks.Size()));
 
                 mGraphOutputs.mGBufferA   = data.GBufferA;
                 mGraphOutputs.mGBufferB   = data.GBufferB;
                 mGraphOutputs.mGBufferC   = data.GBufferC;
                 mGraphOutputs.mSceneDepth = data.Depth;
             },
-            [drawList, drawBindings, pipelineData, bindingData, viewRect](Rhi::FRhiCmdContext& ctx,
-                const RenderCore::FFrameGraphPassResources&, const FBasePassData&) -> void {
+            [drawList, drawBindings, pipelineData, bindingData, viewRect, recordChunks,
+                resolvedPipelines](Rhi::FRhiCmdContext& ctx,
+                const RenderCore::FFrameGraphPassResources& res, const FBasePassData&) -> void {
                 Rhi::FRhiDebugMarker  marker(ctx, TEXT("Deferred.BasePass"));
                 Rhi::FRhiViewportRect viewport{};
                 viewport.mX        = static_cast<f32>(viewRect.X);
@@ -2073,10 +2141,18 @@ namespace AltinaEngine::Rendering {
                 scissor.mHeight = viewRect.Height;
                 ctx.RHISetScissor(scissor);
 
-                if (drawList != nullptr) {
-                    FDrawListExecutor::ExecuteBasePass(ctx, *drawList, drawBindings,
-                        ResolveBasePassPipeline, const_cast<FBasePassPipelineData*>(&pipelineData),
-                        BindPerDraw, const_cast<FBasePassBindingData*>(&bindingData));
+                const u32 chunkIndex = res.GetRecordChunk();
+                if (drawList != nullptr && chunkIndex < recordChunks.Size()) {
+                    // Chunks pack their per-draw data from their own offsets, so chunks recorded
+                    // on different workers never write the same slots.
+                    const auto&          chunk        = recordChunks[chunkIndex];
+                    FBasePassBindingData chunkBinding = bindingData;
+                    chunkBinding.PerDrawCursorInstances += chunk.mFirstInstance;
+                    chunkBinding.PerDrawConstantsCursor += chunk.mFirstBoundBatch;
+                    FBasePassPipelineData chunkPipeline = pipelineData;
+                    chunkPipeline.ResolvedPipelines     = &resolvedPipelines;
+                    FDrawListExecutor::ExecuteBasePassChunk(ctx, *drawList, chunk, drawBindings,
+                        FindResolvedPipeline, &chunkPipeline, BindPerDraw, &chunkBinding);
                 }
             });
     }
@@ -2207,6 +2283,16 @@ namespace AltinaEngine::Rendering {
 
         FBasePassPipelineData shadowPipelineData = pipelineData;
         shadowPipelineData.DefaultPassDesc       = &resources.DefaultShadowPassDesc;
+        // Cascades record on job workers. Every shadow batch uses the same pipeline, so it is
+        // resolved once here.
+        for (u32 i = 0U; i < 4U; ++i) {
+            const auto* shadowDrawList = mViewContext.ShadowDrawLists[i];
+            if (shadowDrawList != nullptr && !shadowDrawList->IsEmpty()) {
+                shadowPipelineData.ShadowPipeline = ResolveShadowPassPipeline(
+                    RenderCore::Render::FDrawBatch{}, nullptr, &shadowPipelineData);
+                break;
+            }
+        }
 
         Shadowing::FDeferredCsmPassSetInputs<FBasePassPipelineData, FBasePassBindingData>
             shadowInputs{};
@@ -2221,7 +2307,7 @@ namespace AltinaEngine::Rendering {
         shadowInputs.mPersistentShadowMap       = &resources.ShadowMapCSM;
         shadowInputs.mPersistentShadowMapSize   = &resources.ShadowMapCSMSize;
         shadowInputs.mPersistentShadowMapLayers = &resources.ShadowMapCSMLayers;
-        shadowInputs.mResolveShadowPipeline     = ResolveShadowPassPipeline;
+        shadowInputs.mResolveShadowPipeline     = FindResolvedShadowPipeline;
         shadowInputs.mBindPerDraw               = BindPerDraw;
         for (u32 i = 0U; i < 4U; ++i) {
             shadowInputs.mShadowDrawLists[i]       = mViewContext.ShadowDrawLists[i];
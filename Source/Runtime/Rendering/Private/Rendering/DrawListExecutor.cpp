@@ -1,19 +1,23 @@
 #include "Rendering/DrawListExecutor.h"
 
-#include "Container/HashSet.h"
+#include "Container/HashMap.h"
 #include "Geometry/StaticMeshData.h"
+#include "Geometry/VertexLayoutBuilder.h"
 #include "Material/Material.h"
 #include "Material/MaterialPass.h"
 #include "Rhi/Command/RhiCmdContext.h"
 #include "Rhi/RhiBindGroup.h"
-#include "Rhi/RhiInit.h"
 #include "Rhi/RhiPipeline.h"
+#include "Threading/Mutex.h"
 #include "Utility/String/StringViewUtility.h"
 #include "Logging/Log.h"
 
 namespace AltinaEngine::Rendering {
     namespace {
-        constexpr u32 kMaxResolvedVertexBufferSlotCount = 16U;
+        using Core::Threading::FMutex;
+        using Core::Threading::FScopedLock;
+
+        constexpr u32 kMaxResolvedVertexBufferSlotCount = FVertexStreamBindingTable::kMaxBindings;
 
         struct FResolvedVertexBufferBinding {
             Rhi::FRhiVertexBufferView mViews[kMaxResolvedVertexBufferSlotCount]   = {};
@@ -94,117 +98,224 @@ namespace AltinaEngine::Rendering {
             bindings.Submit(ctx);
         }
 
-        auto ResolveVertexStreamView(const RenderCore::Geometry::FStaticMeshLodData& lod,
-            const Rhi::FRhiVertexAttributeDesc& attr, Rhi::FRhiVertexBufferView& outView) -> bool {
+        auto GetStreamView(const RenderCore::Geometry::FStaticMeshLodData& lod,
+            EStaticMeshVertexStream stream) -> Rhi::FRhiVertexBufferView {
+            switch (stream) {
+                case EStaticMeshVertexStream::Position:
+                    return lod.mPositionBuffer.GetView();
+                case EStaticMeshVertexStream::Tangent:
+                    return lod.mTangentBuffer.GetView();
+                case EStaticMeshVertexStream::UV0:
+                    return lod.mUV0Buffer.GetView();
+                case EStaticMeshVertexStream::UV1:
+                    return lod.mUV1Buffer.GetView();
+            }
+            return {};
+        }
+
+        auto ResolveVertexStream(const Rhi::FRhiVertexAttributeDesc& attr,
+            EStaticMeshVertexStream& outStream) -> bool {
             const auto semantic = attr.mSemanticName.ToView();
             if (Core::Utility::String::EqualsIgnoreCase(semantic, TEXT("POSITION"))) {
-                outView = lod.mPositionBuffer.GetView();
-                return outView.mBuffer != nullptr;
+                outStream = EStaticMeshVertexStream::Position;
+                return true;
             }
             if (Core::Utility::String::EqualsIgnoreCase(semantic, TEXT("NORMAL"))
                 || Core::Utility::String::EqualsIgnoreCase(semantic, TEXT("TANGENT"))) {
-                // Static-mesh slot1 currently stores packed normal(float3).
-                outView = lod.mTangentBuffer.GetView();
-                return outView.mBuffer != nullptr;
+                outStream = EStaticMeshVertexStream::Tangent;
+                return true;
             }
             if (Core::Utility::String::EqualsIgnoreCase(semantic, TEXT("TEXCOORD"))) {
                 if (attr.mSemanticIndex == 0U) {
-                    outView = lod.mUV0Buffer.GetView();
-                } else if (attr.mSemanticIndex == 1U) {
-                    outView = lod.mUV1Buffer.GetView();
-                } else {
-                    return false;
+                    outStream = EStaticMeshVertexStream::UV0;
+                    return true;
+                }
+                if (attr.mSemanticIndex == 1U) {
+                    outStream = EStaticMeshVertexStream::UV1;
+                    return true;
                 }
-                return outView.mBuffer != nullptr;
             }
             return false;
         }
 
-        void BindVertexBuffersFromLayout(Rhi::FRhiCmdContext& ctx,
-            const RenderCore::Geometry::FStaticMeshLodData&   lod,
-            const Rhi::FRhiVertexLayoutDesc& layout, u32& outBindCount) {
+        struct FVertexStreamBindingCache {
+            FMutex                                                    mMutex{};
+            Core::Container::THashMap<u64, FVertexStreamBindingTable> mTables;
+        };
+
+        auto GetVertexStreamBindingCache() -> FVertexStreamBindingCache& {
+            static FVertexStreamBindingCache sCache{};
+            return sCache;
+        }
+
+        struct FVertexBindStats {
+            u32 mBindCount      = 0U;
+            u32 mMissingStreams = 0U; // table entries whose mesh buffer is missing
+            u32 mLegacyDraws    = 0U; // draws where no table entry matched the mesh
+        };
+
+        void BindVertexBuffersFromTable(Rhi::FRhiCmdContext& ctx,
+            const RenderCore::Geometry::FStaticMeshLodData&  lod,
+            const FVertexStreamBindingTable& table, FVertexBindStats& stats) {
             FResolvedVertexBufferBinding bindings{};
-            u32                          missCount = 0U;
-            for (const auto& attr : layout.mAttributes) {
-                Rhi::FRhiVertexBufferView view{};
-                if (!ResolveVertexStreamView(lod, attr, view)) {
-                    ++missCount;
-                    continue;
-                }
-                bool wasNew = false;
-                if (bindings.Add(attr.mInputSlot, view, wasNew)) {
-                    if (!wasNew) {
-                        continue;
-                    }
-                    ++outBindCount;
-                } else {
-                    ++missCount;
+            for (u32 i = 0U; i < table.mBindingCount; ++i) {
+                const auto& binding = table.mBindings[i];
+                const auto  view    = GetStreamView(lod, binding.mStream);
+                bool        wasNew  = false;
+                if (!bindings.Add(binding.mInputSlot, view, wasNew)) {
+                    ++stats.mMissingStreams;
+                } else if (wasNew) {
+                    ++stats.mBindCount;
                 }
             }
 
             if (bindings.IsEmpty()) {
-                BindVertexBuffersLegacy(ctx, lod, outBindCount);
-                LogWarningCat(TEXT("Rendering.DrawList"),
-                    "BindVertexBuffersResolved: no streams matched resolved layout, fallback to legacy binding.");
+                BindVertexBuffersLegacy(ctx, lod, stats.mBindCount);
+                ++stats.mLegacyDraws;
                 return;
             }
 
             bindings.Submit(ctx);
-            if (missCount > 0U) {
-                LogWarningCat(TEXT("Rendering.DrawList"),
-                    "BindVertexBuffersResolved: {} attributes not bound from resolved layout.",
-                    missCount);
-            }
         }
+    } // namespace
 
-        void BindVertexBuffersResolved(Rhi::FRhiCmdContext& ctx,
-            const RenderCore::Geometry::FStaticMeshLodData& lod,
-            const Rhi::FRhiVertexLayoutDesc* layout, u32& outBindCount) {
-            if (layout == nullptr || layout->mAttributes.IsEmpty()) {
-                BindVertexBuffersLegacy(ctx, lod, outBindCount);
-                return;
+    auto FDrawListExecutor::CompileVertexStreamBindings(const Rhi::FRhiVertexLayoutDesc& layout)
+        -> FVertexStreamBindingTable {
+        FVertexStreamBindingTable table{};
+        for (const auto& attr : layout.mAttributes) {
+            EStaticMeshVertexStream stream = EStaticMeshVertexStream::Position;
+            if (attr.mInputSlot >= kMaxResolvedVertexBufferSlotCount
+                || table.mBindingCount >= FVertexStreamBindingTable::kMaxBindings
+                || !ResolveVertexStream(attr, stream)) {
+                ++table.mUnresolvedAttributeCount;
+                continue;
             }
+            table.mBindings[table.mBindingCount].mInputSlot = attr.mInputSlot;
+            table.mBindings[table.mBindingCount].mStream    = stream;
+            ++table.mBindingCount;
+        }
+        return table;
+    }
 
-            BindVertexBuffersFromLayout(ctx, lod, *layout, outBindCount);
+    auto FDrawListExecutor::FindOrCompileVertexStreamBindings(
+        const Rhi::FRhiVertexLayoutDesc& layout) -> FVertexStreamBindingTable {
+        const u64   layoutHash = RenderCore::Geometry::HashVertexLayout(layout);
+        auto&       cache      = GetVertexStreamBindingCache();
+        FScopedLock lock(cache.mMutex);
+        if (const auto* table = cache.mTables.Find(layoutHash)) {
+            return *table;
         }
-    } // namespace
+
+        const auto table = CompileVertexStreamBindings(layout);
+        if (table.mUnresolvedAttributeCount > 0U) {
+            LogWarningCat(TEXT("Rendering.DrawList"),
+                "CompileVertexStreamBindings: {} of {} layout attributes have no static-mesh stream.",
+                table.mUnresolvedAttributeCount, static_cast<u32>(layout.mAttributes.Size()));
+        }
+        cache.mTables[layoutHash] = table;
+        return table;
+    }
 
     void FDrawListExecutor::ExecuteBasePass(Rhi::FRhiCmdContext& ctx,
         const RenderCore::Render::FDrawList& drawList, const FDrawListBindings& bindings,
         FDrawPipelineResolver pipelineResolver, void* pipelineUserData,
         FDrawBatchBinder batchBinder, void* batchUserData) {
-        if (drawList.IsEmpty()) {
-            return;
+        FDrawListChunk wholeList{};
+        wholeList.mBatchCount = drawList.GetBatchCount();
+        ExecuteBasePassChunk(ctx, drawList, wholeList, bindings, pipelineResolver,
+            pipelineUserData, batchBinder, batchUserData);
+    }
+
+    auto FDrawListExecutor::SplitDrawList(const RenderCore::Render::FDrawList& drawList,
+        u32 maxChunks, u32 minBatchesPerChunk) -> Core::Container::TVector<FDrawListChunk> {
+        Core::Container::TVector<FDrawListChunk> chunks;
+        const u32                                totalBatches = drawList.GetBatchCount();
+        if (totalBatches == 0U) {
+            return chunks;
         }
 
-        const auto rhiStatsBefore = Rhi::RHIGetFrameStats();
-        u32        passId         = 0U;
-        for (const auto& bucket : drawList.mBuckets) {
-            if (!bucket.mBatches.IsEmpty()) {
-                passId = static_cast<u32>(bucket.mPass);
-                break;
+        const u32 minBatches    = (minBatchesPerChunk > 0U) ? minBatchesPerChunk : 1U;
+        u32       chunkCount    = (maxChunks > 0U) ? maxChunks : 1U;
+        const u32 chunksByBatch = (totalBatches + minBatches - 1U) / minBatches;
+        if (chunkCount > chunksByBatch) {
+            chunkCount = chunksByBatch;
+        }
+        chunks.Reserve(chunkCount);
+
+        // Batches are dealt out evenly; the remainder goes to the first chunks.
+        const u32      batchesPerChunk = totalBatches / chunkCount;
+        const u32      remainder       = totalBatches % chunkCount;
+        FDrawListChunk current{};
+        current.mBatchCount = batchesPerChunk + ((remainder > 0U) ? 1U : 0U);
+        u32 boundBatches    = 0U;
+        u32 instances       = 0U;
+        u32 taken           = 0U;
+        for (u32 bucketIndex = 0U; bucketIndex < static_cast<u32>(drawList.mBuckets.Size());
+            ++bucketIndex) {
+            const auto& batches = drawList.mBuckets[bucketIndex].mBatches;
+            for (u32 batchIndex = 0U; batchIndex < static_cast<u32>(batches.Size());
+                ++batchIndex) {
+                if (taken == 0U) {
+                    current.mFirstBucket     = bucketIndex;
+                    current.mFirstBatch      = batchIndex;
+                    current.mFirstBoundBatch = boundBatches;
+                    current.mFirstInstance   = instances;
+                }
+                const u32 instanceCount = static_cast<u32>(batches[batchIndex].mInstances.Size());
+                boundBatches += (instanceCount > 0U) ? 1U : 0U;
+                instances += instanceCount;
+                if (++taken == current.mBatchCount) {
+                    chunks.PushBack(current);
+                    taken               = 0U;
+                    current.mBatchCount = batchesPerChunk
+                        + ((static_cast<u32>(chunks.Size()) < remainder) ? 1U : 0U);
+                }
             }
         }
+        return chunks;
+    }
+
+    void FDrawListExecutor::ExecuteBasePassChunk(Rhi::FRhiCmdContext& ctx,
+        const RenderCore::Render::FDrawList& drawList, const FDrawListChunk& chunk,
+        const FDrawListBindings& bindings, FDrawPipelineResolver pipelineResolver,
+        void* pipelineUserData, FDrawBatchBinder batchBinder, void* batchUserData) {
+        if (drawList.IsEmpty() || chunk.mBatchCount == 0U) {
+            return;
+        }
 
-        u32                            batchCount            = 0U;
-        u32                            materialBucketCount   = 0U;
-        u32                            drawCallCount         = 0U;
-        u32                            skippedNullMesh       = 0U;
-        u32                            skippedInvalidLod     = 0U;
-        u32                            skippedNullSection    = 0U;
-        u32                            skippedNullPipeline   = 0U;
-        u32                            skippedNullIndex      = 0U;
-        u32                            skippedZeroInst       = 0U;
-        u32                            vertexBufferBindCount = 0U;
-        Core::Container::THashSet<u64> uniqueGeometryKeys{};
-        uniqueGeometryKeys.Reserve(drawList.GetBatchCount());
-
-        for (const auto& bucket : drawList.mBuckets) {
-            if (bucket.mBatches.IsEmpty()) {
+        u32              batchCount          = 0U;
+        u32              drawCallCount       = 0U;
+        u32              skippedNullMesh     = 0U;
+        u32              skippedInvalidLod   = 0U;
+        u32              skippedNullSection  = 0U;
+        u32              skippedNullPipeline = 0U;
+        u32              skippedNullIndex    = 0U;
+        u32              skippedZeroInst     = 0U;
+        FVertexBindStats vertexBindStats{};
+
+        // Match layout semantics against mesh streams once per pass instead of once per draw.
+        const bool                bUseVertexStreamTable = bindings.ResolvedVertexLayout != nullptr
+            && !bindings.ResolvedVertexLayout->mAttributes.IsEmpty();
+        FVertexStreamBindingTable vertexStreamTable{};
+        if (bUseVertexStreamTable) {
+            vertexStreamTable = FindOrCompileVertexStreamBindings(*bindings.ResolvedVertexLayout);
+        }
+
+        u32 remainingBatches = chunk.mBatchCount;
+        for (u32 bucketIndex = chunk.mFirstBucket;
+            bucketIndex < static_cast<u32>(drawList.mBuckets.Size()) && remainingBatches > 0U;
+            ++bucketIndex) {
+            const auto& bucket     = drawList.mBuckets[bucketIndex];
+            const u32   firstBatch = (bucketIndex == chunk.mFirstBucket) ? chunk.mFirstBatch : 0U;
+            if (firstBatch >= static_cast<u32>(bucket.mBatches.Size())) {
                 continue;
             }
-            ++materialBucketCount;
-            batchCount += static_cast<u32>(bucket.mBatches.Size());
+            u32 bucketBatchCount = static_cast<u32>(bucket.mBatches.Size()) - firstBatch;
+            if (bucketBatchCount > remainingBatches) {
+                bucketBatchCount = remainingBatches;
+            }
+            remainingBatches -= bucketBatchCount;
+            batchCount += bucketBatchCount;
 
             const auto* passDesc = (bucket.mMaterial != nullptr)
                 ? bucket.mMaterial->FindPassDesc(bucket.mPass)
@@ -212,7 +323,7 @@ namespace AltinaEngine::Rendering {
             if (pipelineResolver != nullptr) {
                 auto* pipeline = pipelineResolver(bucket.mBatches[0], passDesc, pipelineUserData);
                 if (pipeline == nullptr) {
-                    skippedNullPipeline += static_cast<u32>(bucket.mBatches.Size());
+                    skippedNullPipeline += bucketBatchCount;
                     continue;
                 }
                 ctx.RHISetGraphicsPipeline(pipeline);
@@ -228,8 +339,10 @@ namespace AltinaEngine::Rendering {
                 }
             }
 
-            for (const auto& batch : bucket.mBatches) {
-                const auto* mesh = batch.mStatic.mMesh;
+            for (u32 batchIndex = firstBatch; batchIndex < firstBatch + bucketBatchCount;
+                ++batchIndex) {
+                const auto& batch = bucket.mBatches[batchIndex];
+                const auto* mesh  = batch.mStatic.mMesh;
                 if (mesh == nullptr) {
                     ++skippedNullMesh;
                     continue;
@@ -245,7 +358,6 @@ namespace AltinaEngine::Rendering {
                     ++skippedNullSection;
                     continue;
                 }
-                uniqueGeometryKeys.Insert(batch.mBatchKey.mGeometryKey);
 
                 const auto indexView = lod.mIndexBuffer.GetView();
                 if (indexView.mBuffer == nullptr) {
@@ -254,8 +366,11 @@ namespace AltinaEngine::Rendering {
                 }
 
                 ctx.RHISetPrimitiveTopology(lod.mPrimitiveTopology);
-                BindVertexBuffersResolved(
-                    ctx, lod, bindings.ResolvedVertexLayout, vertexBufferBindCount);
+                if (bUseVertexStreamTable) {
+                    BindVertexBuffersFromTable(ctx, lod, vertexStreamTable, vertexBindStats);
+                } else {
+                    BindVertexBuffersLegacy(ctx, lod, vertexBindStats.mBindCount);
+                }
                 ctx.RHISetIndexBuffer(indexView);
 
                 const u32 instanceCount = static_cast<u32>(batch.mInstances.Size());
@@ -291,14 +406,15 @@ namespace AltinaEngine::Rendering {
             return;
         }
 
-        const auto rhiStatsAfter = Rhi::RHIGetFrameStats();
-        LogInfoCat(TEXT("Rendering.DrawList"),
-            "ExecuteBasePass summary: pass={}, materialBuckets={}, draws={}, batches={}, uniqueGeometry={}, vbBinds={}, rhiVbBinds={}, skips(nullMesh={}, invalidLod={}, nullSection={}, nullPipeline={}, nullIndex={}, zeroInstance={}).",
-            passId, materialBucketCount, drawCallCount, batchCount,
-            static_cast<u32>(uniqueGeometryKeys.Num()), vertexBufferBindCount,
-            static_cast<u32>(
-                rhiStatsAfter.mSetVertexBufferCalls - rhiStatsBefore.mSetVertexBufferCalls),
-            skippedNullMesh, skippedInvalidLod, skippedNullSection, skippedNullPipeline,
-            skippedNullIndex, skippedZeroInst);
+        if (vertexBindStats.mLegacyDraws > 0U) {
+            LogWarningCat(TEXT("Rendering.DrawList"),
+                "ExecuteBasePass: {} draws matched no stream of the resolved layout, fell back to legacy binding.",
+                vertexBindStats.mLegacyDraws);
+        }
+        if (vertexBindStats.mMissingStreams > 0U) {
+            LogWarningCat(TEXT("Rendering.DrawList"),
+                "ExecuteBasePass: {} layout streams were missing from their meshes and not bound.",
+                vertexBindStats.mMissingStreams);
+        }
     }
 } // namespace AltinaEngine::Rendering
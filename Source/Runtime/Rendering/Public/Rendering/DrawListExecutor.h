@@ -2,6 +2,7 @@
 
 #include "Rendering/RenderingAPI.h"
 
+#include "Container/Vector.h"
 #include "Render/DrawList.h"
 #include "Rhi/RhiFwd.h"
 #include "Rhi/RhiStructs.h"
@@ -22,6 +23,46 @@ namespace AltinaEngine::Rendering {
         const Rhi::FRhiVertexLayoutDesc* ResolvedVertexLayout = nullptr;
     };
 
+    enum class EStaticMeshVertexStream : u8 {
+        Position = 0,
+        Tangent, // Also feeds NORMAL: slot 1 currently stores the packed normal.
+        UV0,
+        UV1
+    };
+
+    struct FVertexStreamBinding {
+        u32                     mInputSlot = 0U;
+        EStaticMeshVertexStream mStream    = EStaticMeshVertexStream::Position;
+    };
+
+    /**
+     * @brief Static-mesh vertex streams feeding a vertex layout, in attribute order.
+     *
+     * Semantic names are matched once when the table is compiled; draws only index it.
+     */
+    struct FVertexStreamBindingTable {
+        static constexpr u32 kMaxBindings = 16U;
+
+        FVertexStreamBinding mBindings[kMaxBindings] = {};
+        u32                  mBindingCount           = 0U;
+        u32 mUnresolvedAttributeCount = 0U; // unknown semantic or input slot out of range
+    };
+
+    /**
+     * @brief Contiguous run of a draw list's batches that can be recorded on its own.
+     *
+     * `mFirstBoundBatch` and `mFirstInstance` count the batches with instances, and their
+     * instances, before the chunk. A binder that packs per-draw data by batch can start a chunk
+     * at those offsets and stay clear of every other chunk, whatever order they record in.
+     */
+    struct FDrawListChunk {
+        u32 mFirstBucket     = 0U;
+        u32 mFirstBatch      = 0U; // index into the batches of mFirstBucket
+        u32 mBatchCount      = 0U;
+        u32 mFirstBoundBatch = 0U;
+        u32 mFirstInstance   = 0U;
+    };
+
     using FDrawPipelineResolver =
         Rhi::FRhiPipeline* (*)(const RenderCore::Render::FDrawBatch& batch,
             const RenderCore::FMaterialPassDesc* passDesc, void* userData);
@@ -35,5 +76,21 @@ namespace AltinaEngine::Rendering {
             const RenderCore::Render::FDrawList& drawList, const FDrawListBindings& bindings,
             FDrawPipelineResolver pipelineResolver = nullptr, void* pipelineUserData = nullptr,
             FDrawBatchBinder batchBinder = nullptr, void* batchUserData = nullptr);
+
+        // Splits into at most `maxChunks` chunks of at least `minBatchesPerChunk` batches.
+        [[nodiscard]] static auto SplitDrawList(const RenderCore::Render::FDrawList& drawList,
+            u32 maxChunks, u32 minBatchesPerChunk) -> Core::Container::TVector<FDrawListChunk>;
+        // Records one chunk; pipeline and material bindings are set again for its first bucket.
+        static void ExecuteBasePassChunk(Rhi::FRhiCmdContext& ctx,
+            const RenderCore::Render::FDrawList& drawList, const FDrawListChunk& chunk,
+            const FDrawListBindings& bindings, FDrawPipelineResolver pipelineResolver = nullptr,
+            void* pipelineUserData = nullptr, FDrawBatchBinder batchBinder = nullptr,
+            void* batchUserData = nullptr);
+
+        [[nodiscard]] static auto CompileVertexStreamBindings(
+            const Rhi::FRhiVertexLayoutDesc& layout) -> FVertexStreamBindingTable;
+        // Compiled tables are cached process-wide by layout hash.
+        [[nodiscard]] static auto FindOrCompileVertexStreamBindings(
+            const Rhi::FRhiVertexLayoutDesc& layout) -> FVertexStreamBindingTable;
     };
 } // namespace AltinaEngine::Rendering
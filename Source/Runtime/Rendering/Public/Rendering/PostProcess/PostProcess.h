@@ -3,6 +3,7 @@
 #include "Rendering/RenderingAPI.h"
 
 #include "Container/HashMap.h"
+#include "Container/Name.h"
 #include "Container/String.h"
 #include "Container/Variant.h"
 #include "Container/Vector.h"
@@ -17,6 +18,7 @@ namespace AltinaEngine::RenderCore::View {
 
 namespace AltinaEngine::Rendering {
     namespace Container = Core::Container;
+    using Container::FName;
     using Container::FString;
     using Container::FStringView;
     using Container::THashMap;
@@ -32,10 +34,11 @@ namespace AltinaEngine::Rendering {
     using FPostProcessParamValue = TVariant<bool, i32, f32, Core::Math::FVector2f,
         Core::Math::FVector3f, Core::Math::FVector4f, FString>;
 
-    using FPostProcessParams = THashMap<FString, FPostProcessParamValue>;
+    // Keyed by interned names so effects resolve their parameters without string compares.
+    using FPostProcessParams = THashMap<FName, FPostProcessParamValue>;
 
     struct AE_RENDERING_API FPostProcessNode {
-        FString            EffectId;
+        FName              EffectId;
         bool               bEnabled = true;
         FPostProcessParams Params;
     };
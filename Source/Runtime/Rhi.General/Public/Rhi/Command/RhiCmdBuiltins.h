@@ -3,13 +3,64 @@
 #include "RhiGeneralAPI.h"
 #include "Rhi/Command/RhiCmd.h"
 #include "Rhi/RhiStructs.h"
+#include "Container/String.h"
 #include "Container/Vector.h"
+#include "Platform/Generic/GenericPlatformDecl.h"
 #include "Types/Aliases.h"
 
 namespace AltinaEngine::Rhi {
     namespace Container = Core::Container;
+    using Container::FString;
+    using Container::FStringView;
     using Container::TVector;
 
+    class FRhiCmdUpdateDynamicBufferDiscard final : public FRhiCmd {
+    public:
+        // The data is copied, so the caller's memory may be reused once recording returns.
+        FRhiCmdUpdateDynamicBufferDiscard(
+            FRhiBuffer* buffer, const void* data, u64 sizeBytes, u64 offsetBytes)
+            : mBuffer(buffer), mOffsetBytes(offsetBytes) {
+            if (data == nullptr || sizeBytes == 0ULL) {
+                return;
+            }
+
+            mData.Resize(static_cast<usize>(sizeBytes));
+            Core::Platform::Generic::Memcpy(mData.Data(), data, static_cast<usize>(sizeBytes));
+        }
+
+        void Execute(FRhiCmdContext& context) override {
+            context.RHIUpdateDynamicBufferDiscard(
+                mBuffer, mData.Data(), static_cast<u64>(mData.Size()), mOffsetBytes);
+        }
+
+    private:
+        FRhiBuffer* mBuffer      = nullptr;
+        u64         mOffsetBytes = 0ULL;
+        TVector<u8> mData;
+    };
+
+    class FRhiCmdSetGraphicsPipeline final : public FRhiCmd {
+    public:
+        explicit FRhiCmdSetGraphicsPipeline(FRhiPipeline* pipeline) : mPipeline(pipeline) {}
+
+        void Execute(FRhiCmdContext& context) override {
+            context.RHISetGraphicsPipeline(mPipeline);
+        }
+
+    private:
+        FRhiPipeline* mPipeline = nullptr;
+    };
+
+    class FRhiCmdSetComputePipeline final : public FRhiCmd {
+    public:
+        explicit FRhiCmdSetComputePipeline(FRhiPipeline* pipeline) : mPipeline(pipeline) {}
+
+        void Execute(FRhiCmdContext& context) override { context.RHISetComputePipeline(mPipeline); }
+
+    private:
+        FRhiPipeline* mPipeline = nullptr;
+    };
+
     class FRhiCmdDrawIndexed final : public FRhiCmd {
     public:
         FRhiCmdDrawIndexed(
@@ -146,18 +197,25 @@ namespace AltinaEngine::Rhi {
     public:
         FRhiCmdSetRenderTargets(
             u32 colorTargetCount, FRhiTexture* const* colorTargets, FRhiTexture* depthTarget)
-            : mColorTargetCount(colorTargetCount)
-            , mColorTargets(colorTargets)
-            , mDepthTarget(depthTarget) {}
+            : mDepthTarget(depthTarget) {
+            if (colorTargets == nullptr || colorTargetCount == 0U) {
+                return;
+            }
+
+            mColorTargets.Reserve(colorTargetCount);
+            for (u32 index = 0U; index < colorTargetCount; ++index) {
+                mColorTargets.PushBack(colorTargets[index]);
+            }
+        }
 
         void Execute(FRhiCmdContext& context) override {
-            context.RHISetRenderTargets(mColorTargetCount, mColorTargets, mDepthTarget);
+            context.RHISetRenderTargets(
+                static_cast<u32>(mColorTargets.Size()), mColorTargets.Data(), mDepthTarget);
         }
 
     private:
-        u32                 mColorTargetCount = 0U;
-        FRhiTexture* const* mColorTargets     = nullptr;
-        FRhiTexture*        mDepthTarget      = nullptr;
+        TVector<FRhiTexture*> mColorTargets;
+        FRhiTexture*          mDepthTarget = nullptr;
     };
 
     class FRhiCmdBeginRenderPass final : public FRhiCmd {
@@ -199,22 +257,45 @@ namespace AltinaEngine::Rhi {
 
     class FRhiCmdSetBindGroup final : public FRhiCmd {
     public:
+        // Offsets are copied; up to kInlineDynamicOffsets are stored without allocating.
+        static constexpr u32 kInlineDynamicOffsets = 4U;
+
         FRhiCmdSetBindGroup(
             u32 setIndex, FRhiBindGroup* group, const u32* dynamicOffsets, u32 dynamicOffsetCount)
-            : mSetIndex(setIndex)
-            , mGroup(group)
-            , mDynamicOffsets(dynamicOffsets)
-            , mDynamicOffsetCount(dynamicOffsetCount) {}
+            : mSetIndex(setIndex), mGroup(group) {
+            if (dynamicOffsets == nullptr || dynamicOffsetCount == 0U) {
+                return;
+            }
+
+            mDynamicOffsetCount = dynamicOffsetCount;
+            if (dynamicOffsetCount <= kInlineDynamicOffsets) {
+                for (u32 index = 0U; index < dynamicOffsetCount; ++index) {
+                    mInlineOffsets[index] = dynamicOffsets[index];
+                }
+                return;
+            }
+            mOverflowOffsets.Reserve(dynamicOffsetCount);
+            for (u32 index = 0U; index < dynamicOffsetCount; ++index) {
+                mOverflowOffsets.PushBack(dynamicOffsets[index]);
+            }
+        }
 
         void Execute(FRhiCmdContext& context) override {
-            context.RHISetBindGroup(mSetIndex, mGroup, mDynamicOffsets, mDynamicOffsetCount);
+            const u32* offsets = nullptr;
+            if (mDynamicOffsetCount > kInlineDynamicOffsets) {
+                offsets = mOverflowOffsets.Data();
+            } else if (mDynamicOffsetCount > 0U) {
+                offsets = mInlineOffsets;
+            }
+            context.RHISetBindGroup(mSetIndex, mGroup, offsets, mDynamicOffsetCount);
         }
 
     private:
-        u32            mSetIndex           = 0U;
-        FRhiBindGroup* mGroup              = nullptr;
-        const u32*     mDynamicOffsets     = nullptr;
-        u32            mDynamicOffsetCount = 0U;
+        u32            mSetIndex                             = 0U;
+        FRhiBindGroup* mGroup                                = nullptr;
+        u32            mDynamicOffsetCount                   = 0U;
+        u32            mInlineOffsets[kInlineDynamicOffsets] = {};
+        TVector<u32>   mOverflowOffsets;
     };
 
     class FRhiCmdDispatch final : public FRhiCmd {
@@ -232,4 +313,35 @@ namespace AltinaEngine::Rhi {
         u32 mGroupCountZ = 1U;
     };
 
+    class FRhiCmdPushDebugMarker final : public FRhiCmd {
+    public:
+        explicit FRhiCmdPushDebugMarker(FStringView text) : mText(text) {}
+
+        void Execute(FRhiCmdContext& context) override {
+            context.RHIPushDebugMarker(mText.ToView());
+        }
+
+    private:
+        FString mText;
+    };
+
+    class FRhiCmdPopDebugMarker final : public FRhiCmd {
+    public:
+        FRhiCmdPopDebugMarker() = default;
+
+        void Execute(FRhiCmdContext& context) override { context.RHIPopDebugMarker(); }
+    };
+
+    class FRhiCmdInsertDebugMarker final : public FRhiCmd {
+    public:
+        explicit FRhiCmdInsertDebugMarker(FStringView text) : mText(text) {}
+
+        void Execute(FRhiCmdContext& context) override {
+            context.RHIInsertDebugMarker(mText.ToView());
+        }
+
+    private:
+        FString mText;
+    };
+
 } // namespace AltinaEngine::Rhi
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "RhiGeneralAPI.h"
+#include "Rhi/Command/RhiCmdBuiltins.h"
+#include "Rhi/Command/RhiCmdContext.h"
+#include "Rhi/Command/RhiCmdList.h"
+
+namespace AltinaEngine::Rhi {
+    /**
+     * @brief Command context that records into an `FRhiCmdList` instead of a backend.
+     *
+     * Lets code written against `FRhiCmdContext` record on a thread that owns no backend
+     * context; the list is replayed later with `FRhiCmdExecutor`. Buffer updates, vertex buffer
+     * views, render target arrays, dynamic offsets and marker text are copied at record time.
+     * Render pass and transition descs are kept as given, so the attachment and transition
+     * arrays they point to must outlive the replay.
+     */
+    class FRhiCmdListContext final : public FRhiCmdContext {
+    public:
+        explicit FRhiCmdListContext(FRhiCmdList& list) : mList(&list) {}
+
+        void RHIUpdateDynamicBufferDiscard(
+            FRhiBuffer* buffer, const void* data, u64 sizeBytes, u64 offsetBytes) override {
+            mList->Emplace<FRhiCmdUpdateDynamicBufferDiscard>(
+                buffer, data, sizeBytes, offsetBytes);
+        }
+
+        void RHISetGraphicsPipeline(FRhiPipeline* pipeline) override {
+            mList->Emplace<FRhiCmdSetGraphicsPipeline>(pipeline);
+        }
+
+        void RHISetComputePipeline(FRhiPipeline* pipeline) override {
+            mList->Emplace<FRhiCmdSetComputePipeline>(pipeline);
+        }
+
+        void RHISetPrimitiveTopology(ERhiPrimitiveTopology topology) override {
+            mList->Emplace<FRhiCmdSetPrimitiveTopology>(topology);
+        }
+
+        void RHISetVertexBuffer(u32 slot, const FRhiVertexBufferView& view) override {
+            mList->Emplace<FRhiCmdSetVertexBuffer>(slot, view);
+        }
+
+        void RHISetVertexBuffers(
+            u32 firstSlot, const FRhiVertexBufferView* views, u32 viewCount) override {
+            mList->Emplace<FRhiCmdSetVertexBuffers>(firstSlot, views, viewCount);
+        }
+
+        void RHISetIndexBuffer(const FRhiIndexBufferView& view) override {
+            mList->Emplace<FRhiCmdSetIndexBuffer>(view);
+        }
+
+        void RHISetViewport(const FRhiViewportRect& viewport) override {
+            mList->Emplace<FRhiCmdSetViewport>(viewport);
+        }
+
+        void RHISetScissor(const FRhiScissorRect& scissor) override {
+            mList->Emplace<FRhiCmdSetScissor>(scissor);
+        }
+
+        void RHISetRenderTargets(u32 colorTargetCount, FRhiTexture* const* colorTargets,
+            FRhiTexture* depthTarget) override {
+            mList->Emplace<FRhiCmdSetRenderTargets>(colorTargetCount, colorTargets, depthTarget);
+        }
+
+        void RHIBeginRenderPass(const FRhiRenderPassDesc& desc) override {
+            mList->Emplace<FRhiCmdBeginRenderPass>(desc);
+        }
+
+        void RHIEndRenderPass() override { mList->Emplace<FRhiCmdEndRenderPass>(); }
+
+        void RHIBeginTransition(const FRhiTransitionCreateInfo& info) override {
+            mList->Emplace<FRhiCmdBeginTransition>(info);
+        }
+
+        void RHIEndTransition(const FRhiTransitionCreateInfo& info) override {
+            mList->Emplace<FRhiCmdEndTransition>(info);
+        }
+
+        void RHIClearColor(FRhiTexture* colorTarget, const FRhiClearColor& color) override {
+            mList->Emplace<FRhiCmdClearColor>(colorTarget, color);
+        }
+
+        void RHISetBindGroup(u32 setIndex, FRhiBindGroup* group, const u32* dynamicOffsets,
+            u32 dynamicOffsetCount) override {
+            mList->Emplace<FRhiCmdSetBindGroup>(
+                setIndex, group, dynamicOffsets, dynamicOffsetCount);
+        }
+
+        void RHIDraw(
+            u32 vertexCount, u32 instanceCount, u32 firstVertex, u32 firstInstance) override {
+            mList->Emplace<FRhiCmdDraw>(vertexCount, instanceCount, firstVertex, firstInstance);
+        }
+
+        void RHIDrawIndexed(u32 indexCount, u32 instanceCount, u32 firstIndex, i32 vertexOffset,
+            u32 firstInstance) override {
+            mList->Emplace<FRhiCmdDrawIndexed>(
+                indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+        }
+
+        void RHIDispatch(u32 groupCountX, u32 groupCountY, u32 groupCountZ) override {
+            mList->Emplace<FRhiCmdDispatch>(groupCountX, groupCountY, groupCountZ);
+        }
+
+        void RHIPushDebugMarker(FStringView text) override {
+            mList->Emplace<FRhiCmdPushDebugMarker>(text);
+        }
+
+        void RHIPopDebugMarker() override { mList->Emplace<FRhiCmdPopDebugMarker>(); }
+
+        void RHIInsertDebugMarker(FStringView text) override {
+            mList->Emplace<FRhiCmdInsertDebugMarker>(text);
+        }
+
+        [[nodiscard]] auto GetList() const noexcept -> FRhiCmdList& { return *mList; }
+
+    private:
+        FRhiCmdList* mList = nullptr;
+    };
+
+} // namespace AltinaEngine::Rhi
@@ -34,6 +34,7 @@ namespace AltinaEngine::Rhi {
     class FRhiCmdList;
     class FRhiCmdContext;
     class FRhiCmdContextAdapter;
+    class FRhiCmdListContext;
     class FRhiCmdExecutor;
     class IRhiCmdContextOps;
     class FRhiCmdDrawIndexed;
@@ -48,6 +49,12 @@ namespace AltinaEngine::Rhi {
     class FRhiCmdSetRenderTargets;
     class FRhiCmdSetBindGroup;
     class FRhiCmdDispatch;
+    class FRhiCmdUpdateDynamicBufferDiscard;
+    class FRhiCmdSetGraphicsPipeline;
+    class FRhiCmdSetComputePipeline;
+    class FRhiCmdPushDebugMarker;
+    class FRhiCmdPopDebugMarker;
+    class FRhiCmdInsertDebugMarker;
     class FRhiSwapchain;
 
     struct FRhiInitDesc;
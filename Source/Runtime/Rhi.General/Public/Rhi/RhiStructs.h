@@ -135,6 +135,9 @@ namespace AltinaEngine::Rhi {
         // Enable heavier GPU-side validation. Expected to imply mEnableValidation.
         bool    mEnableGpuValidation    = false;
         bool    mEnableStablePowerState = false;
+        // Directory backends with a driver pipeline cache load it from and save it to. Empty
+        // keeps the cache in memory only.
+        FString mPipelineCacheDir;
     };
 
     struct FRhiBufferDesc {
@@ -63,21 +63,15 @@ namespace AltinaEngine::Rhi {
 
         class FRhiMockAdapter final : public FRhiAdapter {
         public:
-            FRhiMockAdapter(const FRhiAdapterDesc& desc, const FRhiSupportedFeatures& features,
-                const FRhiSupportedLimits& limits)
-                : FRhiAdapter(desc), mFeatures(features), mLimits(limits) {}
+            explicit FRhiMockAdapter(const FRhiMockAdapterConfig& config)
+                : FRhiAdapter(config.mDesc), mConfig(config) {}
 
-            [[nodiscard]] auto GetFeatures() const noexcept -> const FRhiSupportedFeatures& {
-                return mFeatures;
-            }
-
-            [[nodiscard]] auto GetLimits() const noexcept -> const FRhiSupportedLimits& {
-                return mLimits;
+            [[nodiscard]] auto GetConfig() const noexcept -> const FRhiMockAdapterConfig& {
+                return mConfig;
             }
 
         private:
-            FRhiSupportedFeatures mFeatures;
-            FRhiSupportedLimits   mLimits;
+            FRhiMockAdapterConfig mConfig;
         };
 
         class FRhiMockBuffer final : public FRhiBuffer {
@@ -420,9 +414,11 @@ namespace AltinaEngine::Rhi {
 
         class FRhiMockCommandContext final : public FRhiCommandContext {
         public:
-            FRhiMockCommandContext(
-                const FRhiCommandContextDesc& desc, TShared<FRhiMockCounters> counters)
-                : FRhiCommandContext(desc), mCounters(Move(counters)) {
+            FRhiMockCommandContext(const FRhiCommandContextDesc& desc,
+                TShared<FRhiMockCounters> counters, TShared<FRhiMockSubmissionLog> submissionLog)
+                : FRhiCommandContext(desc)
+                , mCounters(Move(counters))
+                , mSubmissionLog(Move(submissionLog)) {
                 if (mCounters) {
                     ++mCounters->mResourceCreated;
                 }
@@ -436,6 +432,21 @@ namespace AltinaEngine::Rhi {
 
             auto RHISubmitActiveSection(const FRhiCommandContextSubmitInfo& submitInfo)
                 -> FRhiCommandSubmissionStamp override {
+                if (mSubmissionLog) {
+                    FRhiMockSubmission submission{};
+                    submission.mQueue   = GetQueueType();
+                    submission.mMarkers = Move(mSectionMarkers);
+                    for (u32 i = 0; i < submitInfo.mWaitCount; ++i) {
+                        submission.mWaits.PushBack(submitInfo.mWaits[i]);
+                    }
+                    for (u32 i = 0; i < submitInfo.mSignalCount; ++i) {
+                        submission.mSignals.PushBack(submitInfo.mSignals[i]);
+                    }
+                    mSubmissionLog->Record(Move(submission));
+                }
+                // Markers still open continue into the next section.
+                mSectionMarkers = mOpenMarkers;
+
                 for (u32 i = 0; i < submitInfo.mSignalCount; ++i) {
                     const auto& signal = submitInfo.mSignals[i];
                     if (signal.mSemaphore == nullptr || !signal.mSemaphore->IsTimeline()) {
@@ -491,8 +502,29 @@ namespace AltinaEngine::Rhi {
             void RHIDispatch(
                 u32 /*groupCountX*/, u32 /*groupCountY*/, u32 /*groupCountZ*/) override {}
 
+            void RHIPushDebugMarker(FStringView text) override {
+                FRhiCommandContext::RHIPushDebugMarker(text);
+                if (text.IsEmpty()) {
+                    return;
+                }
+                FString marker;
+                marker.Append(text.Data(), text.Length());
+                mOpenMarkers.PushBack(marker);
+                mSectionMarkers.PushBack(Move(marker));
+            }
+
+            void RHIPopDebugMarker() override {
+                FRhiCommandContext::RHIPopDebugMarker();
+                if (!mOpenMarkers.IsEmpty()) {
+                    mOpenMarkers.PopBack();
+                }
+            }
+
         private:
-            TShared<FRhiMockCounters> mCounters;
+            TShared<FRhiMockCounters>      mCounters;
+            TShared<FRhiMockSubmissionLog> mSubmissionLog;
+            TVector<FString>               mOpenMarkers;
+            TVector<FString>               mSectionMarkers;
         };
 
         class FRhiMockQueue final : public FRhiQueue {
@@ -541,18 +573,19 @@ namespace AltinaEngine::Rhi {
 
         class FRhiMockDevice final : public FRhiDevice {
         public:
-            FRhiMockDevice(const FRhiDeviceDesc& desc, const FRhiAdapterDesc& adapterDesc,
-                const FRhiSupportedFeatures& features, const FRhiSupportedLimits& limits,
-                TShared<FRhiMockCounters> counters)
-                : FRhiDevice(desc, adapterDesc), mCounters(Move(counters)) {
-                SetSupportedFeatures(features);
-                SetSupportedLimits(limits);
+            FRhiMockDevice(const FRhiDeviceDesc& desc, const FRhiMockAdapterConfig& config,
+                TShared<FRhiMockCounters> counters, TShared<FRhiMockSubmissionLog> submissionLog)
+                : FRhiDevice(desc, config.mDesc)
+                , mCounters(Move(counters))
+                , mSubmissionLog(Move(submissionLog)) {
+                SetSupportedFeatures(config.mFeatures);
+                SetSupportedLimits(config.mLimits);
                 FRhiQueueCapabilities queueCaps;
                 queueCaps.mSupportsGraphics     = true;
                 queueCaps.mSupportsCompute      = true;
                 queueCaps.mSupportsCopy         = true;
-                queueCaps.mSupportsAsyncCompute = false;
-                queueCaps.mSupportsAsyncCopy    = false;
+                queueCaps.mSupportsAsyncCompute = config.mSupportsAsyncCompute;
+                queueCaps.mSupportsAsyncCopy    = config.mSupportsAsyncCopy;
                 SetQueueCapabilities(queueCaps);
                 RegisterQueue(
                     ERhiQueueType::Graphics, MakeResource<FRhiMockQueue>(ERhiQueueType::Graphics));
@@ -647,15 +680,102 @@ namespace AltinaEngine::Rhi {
 
             auto CreateCommandContext(const FRhiCommandContextDesc& desc)
                 -> FRhiCommandContextRef override {
-                return MakeResource<FRhiMockCommandContext>(desc, mCounters);
+                return MakeResource<FRhiMockCommandContext>(desc, mCounters, mSubmissionLog);
             }
 
         private:
-            TShared<FRhiMockCounters> mCounters;
+            TShared<FRhiMockCounters>      mCounters;
+            TShared<FRhiMockSubmissionLog> mSubmissionLog;
         };
     } // namespace
 
-    FRhiMockContext::FRhiMockContext() : mCounters(MakeShared<FRhiMockCounters>()) {}
+    void FRhiMockSubmissionLog::Record(FRhiMockSubmission submission) {
+        mSubmissions.PushBack(Move(submission));
+    }
+
+    void FRhiMockSubmissionLog::Clear() { mSubmissions.Clear(); }
+
+    auto FRhiMockSubmissionLog::FindSubmission(FStringView marker) const -> u32 {
+        for (u32 i = 0U; i < static_cast<u32>(mSubmissions.Size()); ++i) {
+            for (const auto& text : mSubmissions[i].mMarkers) {
+                if (text.ToView() == marker) {
+                    return i;
+                }
+            }
+        }
+        return kInvalidIndex;
+    }
+
+    auto FRhiMockSubmissionLog::FindSignaler(const FRhiQueueWait& wait, u32 before) const -> u32 {
+        // Timeline values only grow, so the first signal reaching the value releases the wait.
+        for (u32 i = 0U; i < before && i < static_cast<u32>(mSubmissions.Size()); ++i) {
+            for (const auto& signal : mSubmissions[i].mSignals) {
+                if (signal.mSemaphore == wait.mSemaphore && signal.mValue >= wait.mValue) {
+                    return i;
+                }
+            }
+        }
+        return kInvalidIndex;
+    }
+
+    auto FRhiMockSubmissionLog::IsOrderedBefore(u32 first, u32 second) const -> bool {
+        const u32 count = static_cast<u32>(mSubmissions.Size());
+        if (first >= count || second >= count || first >= second) {
+            return false;
+        }
+
+        // Walk the happens-before predecessors of `second` until `first` shows up.
+        TVector<bool> visited;
+        visited.Resize(count);
+        for (u32 i = 0U; i < count; ++i) {
+            visited[i] = false;
+        }
+        TVector<u32> stack;
+        stack.PushBack(second);
+        visited[second] = true;
+        while (!stack.IsEmpty()) {
+            const u32 current = stack.Back();
+            stack.PopBack();
+            if (current == first) {
+                return true;
+            }
+
+            const auto& submission = mSubmissions[current];
+            for (u32 i = current; i > 0U; --i) {
+                if (mSubmissions[i - 1U].mQueue == submission.mQueue) {
+                    if (!visited[i - 1U]) {
+                        visited[i - 1U] = true;
+                        stack.PushBack(i - 1U);
+                    }
+                    break;
+                }
+            }
+            for (const auto& wait : submission.mWaits) {
+                const u32 signaler = FindSignaler(wait, current);
+                if (signaler != kInvalidIndex && !visited[signaler]) {
+                    visited[signaler] = true;
+                    stack.PushBack(signaler);
+                }
+            }
+        }
+        return false;
+    }
+
+    auto FRhiMockSubmissionLog::CountUnsatisfiedWaits() const -> u32 {
+        u32 unsatisfied = 0U;
+        for (u32 i = 0U; i < static_cast<u32>(mSubmissions.Size()); ++i) {
+            for (const auto& wait : mSubmissions[i].mWaits) {
+                if (FindSignaler(wait, i) == kInvalidIndex) {
+                    ++unsatisfied;
+                }
+            }
+        }
+        return unsatisfied;
+    }
+
+    FRhiMockContext::FRhiMockContext()
+        : mCounters(MakeShared<FRhiMockCounters>())
+        , mSubmissionLog(MakeShared<FRhiMockSubmissionLog>()) {}
 
     FRhiMockContext::~FRhiMockContext() { Shutdown(); }
 
@@ -730,6 +850,10 @@ namespace AltinaEngine::Rhi {
         return mCounters ? mCounters->GetResourceLiveCount() : 0U;
     }
 
+    auto FRhiMockContext::GetSubmissionLog() noexcept -> FRhiMockSubmissionLog& {
+        return *mSubmissionLog;
+    }
+
     auto FRhiMockContext::InitializeBackend(const FRhiInitDesc& /*desc*/) -> bool {
         if (mCounters) {
             ++mCounters->mInitializeCalls;
@@ -752,8 +876,7 @@ namespace AltinaEngine::Rhi {
         outAdapters.Reserve(mAdapterConfigs.Size());
 
         for (const auto& config : mAdapterConfigs) {
-            outAdapters.PushBack(MakeSharedAs<FRhiAdapter, FRhiMockAdapter>(
-                config.mDesc, config.mFeatures, config.mLimits));
+            outAdapters.PushBack(MakeSharedAs<FRhiAdapter, FRhiMockAdapter>(config));
         }
     }
 
@@ -768,13 +891,13 @@ namespace AltinaEngine::Rhi {
         }
 
         const auto* mockAdapter = static_cast<const FRhiMockAdapter*>(adapter.Get());
-        const FRhiSupportedFeatures features =
-            mockAdapter ? mockAdapter->GetFeatures() : FRhiSupportedFeatures{};
-        const FRhiSupportedLimits limits =
-            mockAdapter ? mockAdapter->GetLimits() : FRhiSupportedLimits{};
+        FRhiMockAdapterConfig config{};
+        if (mockAdapter != nullptr) {
+            config = mockAdapter->GetConfig();
+        }
+        config.mDesc = adapter->GetDesc();
 
-        return MakeSharedAs<FRhiDevice, FRhiMockDevice>(
-            desc, adapter->GetDesc(), features, limits, mCounters);
+        return MakeSharedAs<FRhiDevice, FRhiMockDevice>(desc, config, mCounters, mSubmissionLog);
     }
 
 } // namespace AltinaEngine::Rhi
@@ -2,11 +2,16 @@
 
 #include "RhiMockAPI.h"
 #include "Rhi/RhiContext.h"
+#include "Rhi/RhiStructs.h"
 #include "Container/SmartPtr.h"
+#include "Container/String.h"
+#include "Container/StringView.h"
 #include "Container/Vector.h"
 
 namespace AltinaEngine::Rhi {
     namespace Container = Core::Container;
+    using Container::FString;
+    using Container::FStringView;
     using Container::TShared;
     using Container::TVector;
 
@@ -14,6 +19,9 @@ namespace AltinaEngine::Rhi {
         FRhiAdapterDesc       mDesc;
         FRhiSupportedFeatures mFeatures;
         FRhiSupportedLimits   mLimits;
+        // Devices expose dedicated compute/copy queues when set (the queues always exist).
+        bool                  mSupportsAsyncCompute = false;
+        bool                  mSupportsAsyncCopy    = false;
     };
 
     struct FRhiMockCounters {
@@ -37,6 +45,51 @@ namespace AltinaEngine::Rhi {
         }
     };
 
+    /**
+     * @brief One command context submission recorded by mock devices.
+     *
+     * Markers are the debug markers open at any point of the submitted section, so a frame graph
+     * pass can be found through its "FrameGraph.Pass:<name>" marker.
+     */
+    struct FRhiMockSubmission {
+        ERhiQueueType            mQueue = ERhiQueueType::Graphics;
+        TVector<FString>         mMarkers;
+        TVector<FRhiQueueWait>   mWaits;
+        TVector<FRhiQueueSignal> mSignals;
+    };
+
+    /**
+     * @brief Submissions of every device created by a mock context, with a dependency-order
+     * checker.
+     *
+     * Submission A is ordered before submission B when the GPU can never start B before A has
+     * finished: A was submitted earlier on the same queue, or B (transitively) waits for a
+     * semaphore value that A or a later submission of A's queue signals.
+     */
+    class AE_RHI_MOCK_API FRhiMockSubmissionLog {
+    public:
+        static constexpr u32 kInvalidIndex = ~0U;
+
+        void                 Record(FRhiMockSubmission submission);
+        void                 Clear();
+
+        [[nodiscard]] auto   GetSubmissions() const noexcept
+            -> const TVector<FRhiMockSubmission>& {
+            return mSubmissions;
+        }
+        // Index of the first submission carrying `marker`, or kInvalidIndex.
+        [[nodiscard]] auto FindSubmission(FStringView marker) const -> u32;
+        [[nodiscard]] auto IsOrderedBefore(u32 first, u32 second) const -> bool;
+        // Waits no earlier submission signals (a GPU deadlock or a read of stale data).
+        [[nodiscard]] auto CountUnsatisfiedWaits() const -> u32;
+
+    private:
+        // Earliest earlier submission signaling `wait`, or kInvalidIndex.
+        [[nodiscard]] auto FindSignaler(const FRhiQueueWait& wait, u32 before) const -> u32;
+
+        TVector<FRhiMockSubmission> mSubmissions;
+    };
+
     class AE_RHI_MOCK_API FRhiMockContext final : public FRhiContext {
     public:
         FRhiMockContext();
@@ -62,6 +115,7 @@ namespace AltinaEngine::Rhi {
         [[nodiscard]] auto GetResourceCreatedCount() const noexcept -> u32;
         [[nodiscard]] auto GetResourceDestroyedCount() const noexcept -> u32;
         [[nodiscard]] auto GetResourceLiveCount() const noexcept -> u32;
+        [[nodiscard]] auto GetSubmissionLog() noexcept -> FRhiMockSubmissionLog&;
 
     protected:
         auto InitializeBackend(const FRhiInitDesc& desc) -> bool override;
@@ -73,6 +127,7 @@ namespace AltinaEngine::Rhi {
     private:
         TVector<FRhiMockAdapterConfig> mAdapterConfigs;
         TShared<FRhiMockCounters>      mCounters;
+        TShared<FRhiMockSubmissionLog> mSubmissionLog;
     };
 
 } // namespace AltinaEngine::Rhi
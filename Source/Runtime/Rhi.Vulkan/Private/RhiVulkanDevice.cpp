@@ -16,7 +16,10 @@
 #include "RhiVulkanInternal.h"
 #include "RhiVulkanDebugUtils.h"
 #include "RhiVulkanMemoryAllocator.h"
+#include "RhiVulkanPipelineCache.h"
+#include "Container/HashMap.h"
 #include "Platform/Generic/GenericPlatformDecl.h"
+#include "Threading/Mutex.h"
 #include "Utility/Assert.h"
 
 using AltinaEngine::Move;
@@ -131,6 +134,87 @@ namespace AltinaEngine::Rhi {
             return static_cast<u32>(type);
         }
 
+        // Frames between sweeps that drop deduplicated pipelines only the device still holds.
+        constexpr u64 kPipelineSweepIntervalFrames = 120ULL;
+
+        // The debug name is left out: descs that differ only by name share one pipeline.
+        [[nodiscard]] auto HashGraphicsPipelineDesc(const FRhiGraphicsPipelineDesc& desc) noexcept
+            -> u64 {
+            u64 hash = 0ULL;
+            hash     = InternalHashCombine(hash, GetInternalHash(desc.mPipelineLayout));
+            hash     = InternalHashCombine(hash, GetInternalHash(desc.mVertexShader));
+            hash     = InternalHashCombine(hash, GetInternalHash(desc.mPixelShader));
+            hash     = InternalHashCombine(hash, GetInternalHash(desc.mGeometryShader));
+            hash     = InternalHashCombine(hash, GetInternalHash(desc.mHullShader));
+            hash     = InternalHashCombine(hash, GetInternalHash(desc.mDomainShader));
+            for (const auto& attribute : desc.mVertexLayout.mAttributes) {
+                hash = InternalHashCombine(hash, GetInternalHash(attribute.mSemanticName));
+                hash = InternalHashCombine(hash, static_cast<u64>(attribute.mSemanticIndex));
+                hash = InternalHashCombine(hash, static_cast<u64>(attribute.mFormat));
+                hash = InternalHashCombine(hash, static_cast<u64>(attribute.mInputSlot));
+                hash = InternalHashCombine(hash, static_cast<u64>(attribute.mAlignedByteOffset));
+                hash = InternalHashCombine(hash, attribute.mPerInstance ? 1ULL : 0ULL);
+                hash = InternalHashCombine(hash, static_cast<u64>(attribute.mInstanceStepRate));
+            }
+            hash = InternalHashCombine(hash, GetInternalHash(desc.mRasterState));
+            hash = InternalHashCombine(hash, GetInternalHash(desc.mDepthState));
+            hash = InternalHashCombine(hash, GetInternalHash(desc.mBlendState));
+            return hash;
+        }
+
+        [[nodiscard]] auto IsSameGraphicsPipelineDesc(
+            const FRhiGraphicsPipelineDesc& lhs, const FRhiGraphicsPipelineDesc& rhs) noexcept
+            -> bool {
+            if (lhs.mPipelineLayout != rhs.mPipelineLayout || lhs.mVertexShader != rhs.mVertexShader
+                || lhs.mPixelShader != rhs.mPixelShader
+                || lhs.mGeometryShader != rhs.mGeometryShader
+                || lhs.mHullShader != rhs.mHullShader || lhs.mDomainShader != rhs.mDomainShader) {
+                return false;
+            }
+
+            const auto& lhsAttributes = lhs.mVertexLayout.mAttributes;
+            const auto& rhsAttributes = rhs.mVertexLayout.mAttributes;
+            if (lhsAttributes.Size() != rhsAttributes.Size()) {
+                return false;
+            }
+            for (usize index = 0U; index < lhsAttributes.Size(); ++index) {
+                const auto& a = lhsAttributes[index];
+                const auto& b = rhsAttributes[index];
+                if (a.mSemanticName != b.mSemanticName || a.mSemanticIndex != b.mSemanticIndex
+                    || a.mFormat != b.mFormat || a.mInputSlot != b.mInputSlot
+                    || a.mAlignedByteOffset != b.mAlignedByteOffset
+                    || a.mPerInstance != b.mPerInstance
+                    || a.mInstanceStepRate != b.mInstanceStepRate) {
+                    return false;
+                }
+            }
+
+            const auto& lr = lhs.mRasterState;
+            const auto& rr = rhs.mRasterState;
+            if (lr.mFillMode != rr.mFillMode || lr.mCullMode != rr.mCullMode
+                || lr.mFrontFace != rr.mFrontFace || lr.mDepthBias != rr.mDepthBias
+                || lr.mDepthBiasClamp != rr.mDepthBiasClamp
+                || lr.mSlopeScaledDepthBias != rr.mSlopeScaledDepthBias
+                || lr.mDepthClip != rr.mDepthClip
+                || lr.mConservativeRaster != rr.mConservativeRaster) {
+                return false;
+            }
+
+            const auto& ld = lhs.mDepthState;
+            const auto& rd = rhs.mDepthState;
+            if (ld.mDepthEnable != rd.mDepthEnable || ld.mDepthWrite != rd.mDepthWrite
+                || ld.mDepthCompare != rd.mDepthCompare) {
+                return false;
+            }
+
+            const auto& lb = lhs.mBlendState;
+            const auto& rb = rhs.mBlendState;
+            return lb.mBlendEnable == rb.mBlendEnable && lb.mSrcColor == rb.mSrcColor
+                && lb.mDstColor == rb.mDstColor && lb.mColorOp == rb.mColorOp
+                && lb.mSrcAlpha == rb.mSrcAlpha && lb.mDstAlpha == rb.mDstAlpha
+                && lb.mAlphaOp == rb.mAlphaOp && lb.mColorWriteMask == rb.mColorWriteMask;
+        }
+
     } // namespace
 
     struct FRhiVulkanDevice::FState {
@@ -174,6 +258,18 @@ namespace AltinaEngine::Rhi {
         };
 
         FUploadQueueState mUploadQueues[3];
+
+        FVulkanPipelineCache mPipelineCache;
+
+        // Graphics pipelines by desc hash. Each entry holds a reference, so the shader and layout
+        // pointers in its key cannot be recycled for other objects while it is cached.
+        struct FGraphicsPipelineEntry {
+            FRhiGraphicsPipelineDesc mDesc;
+            FRhiPipelineRef          mPipeline;
+        };
+        Core::Threading::FMutex                                         mPipelineMutex;
+        Core::Container::THashMap<u64, TVector<FGraphicsPipelineEntry>> mGraphicsPipelines;
+        u64                                                             mEndFrameCount = 0ULL;
     };
 
     class FRhiVulkanTransition final : public FRhiTransition {
@@ -305,6 +401,8 @@ namespace AltinaEngine::Rhi {
         initUploadQueue(ERhiQueueType::Copy, mState->mTransferQueue, mState->mTransferFamily);
 
         mState->mAllocator.Init(mState->mPhysicalDevice, mState->mDevice);
+        mState->mPipelineCache.Init(
+            mState->mPhysicalDevice, mState->mDevice, GetDesc().mPipelineCacheDir);
 
         FVulkanUploadBufferManagerDesc uploadDesc{};
         uploadDesc.mPageCount      = 3U;
@@ -324,6 +422,11 @@ namespace AltinaEngine::Rhi {
                 vkDeviceWaitIdle(mState->mDevice);
             }
 
+            {
+                Core::Threading::FScopedLock lock(mState->mPipelineMutex);
+                mState->mGraphicsPipelines.Clear();
+            }
+
             // First pass: drain resources retired during normal runtime.
             FlushResourceDeleteQueue();
 
@@ -349,6 +452,7 @@ namespace AltinaEngine::Rhi {
             FlushResourceDeleteQueue();
 
             mState->mAllocator.Shutdown();
+            mState->mPipelineCache.Shutdown();
 
             if (mState->mDevice) {
                 vkDestroyDevice(mState->mDevice, nullptr);
@@ -514,15 +618,43 @@ namespace AltinaEngine::Rhi {
 
     auto FRhiVulkanDevice::CreateGraphicsPipeline(const FRhiGraphicsPipelineDesc& desc)
         -> FRhiPipelineRef {
-        const bool supportsExtDyn = mState && mState->mSupportsExtDyn;
-        return MakeResource<FRhiVulkanGraphicsPipeline>(
-            desc, mState ? mState->mDevice : VK_NULL_HANDLE, supportsExtDyn);
+        if (!mState) {
+            return MakeResource<FRhiVulkanGraphicsPipeline>(desc, VK_NULL_HANDLE, false);
+        }
+
+        // Native pipelines are built lazily per attachment set, so the lock only covers the
+        // lookup and a cheap object construction.
+        const u64                    hash = HashGraphicsPipelineDesc(desc);
+        Core::Threading::FScopedLock lock(mState->mPipelineMutex);
+        auto&                        entries = mState->mGraphicsPipelines[hash];
+        for (const auto& entry : entries) {
+            if (IsSameGraphicsPipelineDesc(entry.mDesc, desc)) {
+                mState->mPipelineCache.NoteDedupHit();
+                return entry.mPipeline;
+            }
+        }
+
+        FRhiPipelineRef pipeline = MakeResource<FRhiVulkanGraphicsPipeline>(
+            desc, mState->mDevice, mState->mSupportsExtDyn, &mState->mPipelineCache);
+        if (pipeline) {
+            entries.PushBack(FState::FGraphicsPipelineEntry{ desc, pipeline });
+        }
+        return pipeline;
     }
 
     auto FRhiVulkanDevice::CreateComputePipeline(const FRhiComputePipelineDesc& desc)
         -> FRhiPipelineRef {
-        return MakeResource<FRhiVulkanComputePipeline>(
-            desc, mState ? mState->mDevice : VK_NULL_HANDLE);
+        return MakeResource<FRhiVulkanComputePipeline>(desc,
+            mState ? mState->mDevice : VK_NULL_HANDLE,
+            mState ? &mState->mPipelineCache : nullptr);
+    }
+
+    auto FRhiVulkanDevice::GetPipelineCacheStats() const noexcept -> FRhiVulkanPipelineCacheStats {
+        FRhiVulkanPipelineCacheStats stats{};
+        if (mState) {
+            mState->mPipelineCache.FillStats(stats);
+        }
+        return stats;
     }
 
     auto FRhiVulkanDevice::CreatePipelineLayout(const FRhiPipelineLayoutDesc& desc)
@@ -1005,6 +1137,22 @@ namespace AltinaEngine::Rhi {
         }
         mState->mUploadManager.EndFrame();
 
+        if ((++mState->mEndFrameCount % kPipelineSweepIntervalFrames) == 0ULL) {
+            Core::Threading::FScopedLock lock(mState->mPipelineMutex);
+            for (auto& bucket : mState->mGraphicsPipelines) {
+                auto& entries = bucket.second;
+                for (usize index = entries.Size(); index > 0U; --index) {
+                    if (entries[index - 1U].mPipeline.GetRefCount() > 1U) {
+                        continue;
+                    }
+                    if (index != entries.Size()) {
+                        entries[index - 1U] = Move(entries.Back());
+                    }
+                    entries.PopBack();
+                }
+            }
+        }
+
         // Vulkan backend currently does not track a GPU-completed serial like D3D11 queries.
         // Drain queued resource destruction at frame end only after queue-idle waits are
         // serialized through the submit thread. Do not call vkDeviceWaitIdle() here, otherwise
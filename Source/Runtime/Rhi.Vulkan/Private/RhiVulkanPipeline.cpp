@@ -3,6 +3,7 @@
 #include "RhiVulkan/RhiVulkanDevice.h"
 #include "RhiVulkan/RhiVulkanResources.h"
 #include "RhiVulkanInternal.h"
+#include "RhiVulkanPipelineCache.h"
 
 #include "Logging/Log.h"
 #include "Rhi/RhiInit.h"
@@ -15,11 +16,11 @@ namespace AltinaEngine::Rhi {
     namespace {
         constexpr auto     kFrameTimingCategory = TEXT("FrameTiming");
 
-        [[nodiscard]] auto ElapsedMilliseconds(
-            const std::chrono::steady_clock::time_point& startTime) noexcept -> double {
+        [[nodiscard]] auto ElapsedNanoseconds(
+            const std::chrono::steady_clock::time_point& startTime) noexcept -> u64 {
             using namespace std::chrono;
-            return duration_cast<duration<double, std::milli>>(steady_clock::now() - startTime)
-                .count();
+            return static_cast<u64>(
+                duration_cast<nanoseconds>(steady_clock::now() - startTime).count());
         }
 
         [[nodiscard]] auto ToVkStageFlags(ERhiShaderStageFlags visibility) noexcept
@@ -541,9 +542,10 @@ namespace AltinaEngine::Rhi {
     }
 
     struct FRhiVulkanGraphicsPipeline::FState {
-        VkDevice         mDevice                       = VK_NULL_HANDLE;
-        VkPipelineLayout mLayout                       = VK_NULL_HANDLE;
-        bool             mSupportsExtendedDynamicState = false;
+        VkDevice              mDevice                       = VK_NULL_HANDLE;
+        VkPipelineLayout      mLayout                       = VK_NULL_HANDLE;
+        FVulkanPipelineCache* mPipelineCache                = nullptr;
+        bool                  mSupportsExtendedDynamicState = false;
 
         struct FEntry {
             u64        mKey      = 0ULL;
@@ -552,11 +554,12 @@ namespace AltinaEngine::Rhi {
         Core::Container::TVector<FEntry> mPipelines;
     };
 
-    FRhiVulkanGraphicsPipeline::FRhiVulkanGraphicsPipeline(
-        const FRhiGraphicsPipelineDesc& desc, VkDevice device, bool supportsExtendedDynamicState)
+    FRhiVulkanGraphicsPipeline::FRhiVulkanGraphicsPipeline(const FRhiGraphicsPipelineDesc& desc,
+        VkDevice device, bool supportsExtendedDynamicState, FVulkanPipelineCache* pipelineCache)
         : FRhiPipeline(desc) {
         mState                                = new FState{};
         mState->mDevice                       = device;
+        mState->mPipelineCache                = pipelineCache;
         mState->mSupportsExtendedDynamicState = supportsExtendedDynamicState;
 
         if (desc.mPipelineLayout) {
@@ -785,16 +788,23 @@ namespace AltinaEngine::Rhi {
         info.subpass             = 0;
         info.pNext               = renderingInfo;
 
+        const VkPipelineCache pipelineCache = (mState->mPipelineCache != nullptr)
+            ? mState->mPipelineCache->GetHandle()
+            : VK_NULL_HANDLE;
         const auto pipelineCreateStart = std::chrono::steady_clock::now();
         VkPipeline pipeline            = VK_NULL_HANDLE;
-        if (vkCreateGraphicsPipelines(mState->mDevice, VK_NULL_HANDLE, 1, &info, nullptr, &pipeline)
+        if (vkCreateGraphicsPipelines(mState->mDevice, pipelineCache, 1, &info, nullptr, &pipeline)
             != VK_SUCCESS) {
             return VK_NULL_HANDLE;
         }
+        const u64 createNanoseconds = ElapsedNanoseconds(pipelineCreateStart);
+        if (mState->mPipelineCache != nullptr) {
+            mState->mPipelineCache->NotePipelineCreated(true, createNanoseconds);
+        }
         LogInfoCat(kFrameTimingCategory,
             TEXT("Vulkan.PipelineCreate name={} dynamicRendering={} attachmentHash={} ms={:.3f}"),
             GetGraphicsDesc().mDebugName.ToView(), usingDynamicRendering ? 1U : 0U, attachmentHash,
-            ElapsedMilliseconds(pipelineCreateStart));
+            static_cast<f64>(createNanoseconds) / 1000000.0);
 
         mState->mPipelines.PushBack(FState::FEntry{ key, pipeline });
         return pipeline;
@@ -806,8 +816,8 @@ namespace AltinaEngine::Rhi {
         VkPipelineLayout mLayout   = VK_NULL_HANDLE;
     };
 
-    FRhiVulkanComputePipeline::FRhiVulkanComputePipeline(
-        const FRhiComputePipelineDesc& desc, VkDevice device)
+    FRhiVulkanComputePipeline::FRhiVulkanComputePipeline(const FRhiComputePipelineDesc& desc,
+        VkDevice device, FVulkanPipelineCache* pipelineCache)
         : FRhiPipeline(desc) {
         mState          = new FState{};
         mState->mDevice = device;
@@ -837,9 +847,14 @@ namespace AltinaEngine::Rhi {
         info.stage  = stage;
         info.layout = mState->mLayout;
 
-        if (vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &info, nullptr, &mState->mPipeline)
+        const VkPipelineCache cache =
+            (pipelineCache != nullptr) ? pipelineCache->GetHandle() : VK_NULL_HANDLE;
+        const auto createStart = std::chrono::steady_clock::now();
+        if (vkCreateComputePipelines(device, cache, 1, &info, nullptr, &mState->mPipeline)
             != VK_SUCCESS) {
             mState->mPipeline = VK_NULL_HANDLE;
+        } else if (pipelineCache != nullptr) {
+            pipelineCache->NotePipelineCreated(false, ElapsedNanoseconds(createStart));
         }
     }
 
@@ -0,0 +1,228 @@
+#include "RhiVulkanPipelineCache.h"
+
+#include "RhiVulkan/RhiVulkanDevice.h"
+
+#include "Container/Vector.h"
+#include "Logging/Log.h"
+#include "Platform/Generic/GenericPlatformDecl.h"
+#include "Platform/PlatformFileSystem.h"
+
+#include <chrono>
+
+namespace AltinaEngine::Rhi {
+    namespace {
+        constexpr auto kLogCategory = TEXT("RHI.Vulkan");
+        constexpr u32  kFileMagic   = 0x43504541U; // "AEPC"
+        constexpr u32  kFileVersion = 1U;
+
+        struct FPipelineCacheFileHeader {
+            u32 mMagic         = kFileMagic;
+            u32 mVersion       = kFileVersion;
+            u32 mVendorId      = 0U;
+            u32 mDeviceId      = 0U;
+            u32 mDriverVersion = 0U;
+            u8  mCacheUuid[VK_UUID_SIZE]{};
+            u32 mReserved = 0U;
+            u64 mDataSize = 0ULL;
+            u64 mDataHash = 0ULL;
+        };
+
+        [[nodiscard]] auto HashBytes(const u8* data, usize size) noexcept -> u64 {
+            u64 hash = 1469598103934665603ULL;
+            for (usize index = 0U; index < size; ++index) {
+                hash ^= static_cast<u64>(data[index]);
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }
+
+        [[nodiscard]] auto ElapsedNanoseconds(
+            const std::chrono::steady_clock::time_point& startTime) noexcept -> u64 {
+            using namespace std::chrono;
+            return static_cast<u64>(
+                duration_cast<nanoseconds>(steady_clock::now() - startTime).count());
+        }
+
+        void FillHeader(
+            FPipelineCacheFileHeader& header, const VkPhysicalDeviceProperties& props) noexcept {
+            header.mVendorId      = props.vendorID;
+            header.mDeviceId      = props.deviceID;
+            header.mDriverVersion = props.driverVersion;
+            for (u32 index = 0U; index < VK_UUID_SIZE; ++index) {
+                header.mCacheUuid[index] = props.pipelineCacheUUID[index];
+            }
+        }
+
+        // Returns the driver data inside `bytes`, or null when the file was not written by this
+        // driver on this device or is damaged.
+        [[nodiscard]] auto FindValidCacheData(const Core::Container::TVector<u8>& bytes,
+            const VkPhysicalDeviceProperties& props, usize& outSize) noexcept -> const u8* {
+            outSize = 0U;
+            if (bytes.Size() < sizeof(FPipelineCacheFileHeader)) {
+                return nullptr;
+            }
+            FPipelineCacheFileHeader header{};
+            Core::Platform::Generic::Memcpy(&header, bytes.Data(), sizeof(header));
+
+            FPipelineCacheFileHeader expected{};
+            FillHeader(expected, props);
+            if (header.mMagic != kFileMagic || header.mVersion != kFileVersion
+                || header.mVendorId != expected.mVendorId || header.mDeviceId != expected.mDeviceId
+                || header.mDriverVersion != expected.mDriverVersion) {
+                return nullptr;
+            }
+            for (u32 index = 0U; index < VK_UUID_SIZE; ++index) {
+                if (header.mCacheUuid[index] != expected.mCacheUuid[index]) {
+                    return nullptr;
+                }
+            }
+
+            const u8* data = bytes.Data() + sizeof(FPipelineCacheFileHeader);
+            const u64 size = static_cast<u64>(bytes.Size() - sizeof(FPipelineCacheFileHeader));
+            if (header.mDataSize != size || header.mDataHash != HashBytes(data, size)) {
+                return nullptr;
+            }
+            outSize = static_cast<usize>(size);
+            return data;
+        }
+    } // namespace
+
+    FVulkanPipelineCache::~FVulkanPipelineCache() { Shutdown(); }
+
+    void FVulkanPipelineCache::Init(VkPhysicalDevice physicalDevice, VkDevice device,
+        const Core::Container::FString& cacheDir) noexcept {
+        mDevice = device;
+        if (mDevice == VK_NULL_HANDLE) {
+            return;
+        }
+        if (physicalDevice != VK_NULL_HANDLE) {
+            vkGetPhysicalDeviceProperties(physicalDevice, &mProperties);
+        }
+
+        mCacheDir = cacheDir;
+        mFilePath.Clear();
+        if (!mCacheDir.IsEmptyString()) {
+            mFilePath = mCacheDir;
+            mFilePath.Append(TEXT("/Vulkan_"));
+            mFilePath.AppendNumber(mProperties.vendorID);
+            mFilePath.Append(TEXT("_"));
+            mFilePath.AppendNumber(mProperties.deviceID);
+            mFilePath.Append(TEXT(".bin"));
+        }
+
+        const auto                   loadStart = std::chrono::steady_clock::now();
+        Core::Container::TVector<u8> fileBytes;
+        const u8*                    initialData = nullptr;
+        usize                        initialSize = 0U;
+        if (!mFilePath.IsEmptyString() && Core::Platform::ReadFileBytes(mFilePath, fileBytes)) {
+            initialData = FindValidCacheData(fileBytes, mProperties, initialSize);
+            if (initialData == nullptr) {
+                LogWarningCat(kLogCategory,
+                    TEXT("Pipeline cache {} is stale or damaged; starting cold."),
+                    mFilePath.ToView());
+            }
+        }
+
+        VkPipelineCacheCreateInfo info{};
+        info.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        info.initialDataSize = initialSize;
+        info.pInitialData    = initialData;
+        if (vkCreatePipelineCache(mDevice, &info, nullptr, &mCache) != VK_SUCCESS) {
+            mCache = VK_NULL_HANDLE;
+            if (initialSize > 0U) {
+                // The driver rejected the data despite the header check; drop it.
+                info.initialDataSize = 0U;
+                info.pInitialData    = nullptr;
+                initialSize          = 0U;
+                if (vkCreatePipelineCache(mDevice, &info, nullptr, &mCache) != VK_SUCCESS) {
+                    mCache = VK_NULL_HANDLE;
+                }
+            }
+        }
+        mLoadedBytes     = (mCache != VK_NULL_HANDLE) ? static_cast<u64>(initialSize) : 0ULL;
+        mLoadNanoseconds = ElapsedNanoseconds(loadStart);
+
+        LogInfoCat(kLogCategory,
+            TEXT("Vulkan.PipelineCache load path={} warm={} bytes={} ms={:.3f}"),
+            mFilePath.IsEmptyString() ? TEXT("<memory>") : mFilePath.ToView(),
+            (mLoadedBytes > 0ULL) ? 1U : 0U, mLoadedBytes,
+            static_cast<f64>(mLoadNanoseconds) / 1000000.0);
+    }
+
+    void FVulkanPipelineCache::Shutdown() noexcept {
+        if (mCache == VK_NULL_HANDLE) {
+            mDevice = VK_NULL_HANDLE;
+            return;
+        }
+
+        FRhiVulkanPipelineCacheStats stats{};
+        FillStats(stats);
+        const bool saved = Save();
+        LogInfoCat(kLogCategory,
+            TEXT("Vulkan.PipelineCache graphics={} compute={} dedup={} createMs={:.3f} saved={}"),
+            stats.GraphicsPipelines, stats.ComputePipelines, stats.DedupHits,
+            static_cast<f64>(stats.CreateNanoseconds) / 1000000.0, saved ? 1U : 0U);
+
+        vkDestroyPipelineCache(mDevice, mCache, nullptr);
+        mCache  = VK_NULL_HANDLE;
+        mDevice = VK_NULL_HANDLE;
+    }
+
+    auto FVulkanPipelineCache::Save() noexcept -> bool {
+        if (mCache == VK_NULL_HANDLE || mFilePath.IsEmptyString()) {
+            return false;
+        }
+        // Nothing new reached the driver since the file was read.
+        if (mLoadedBytes > 0ULL && mGraphicsCreates.Load() == 0U && mComputeCreates.Load() == 0U) {
+            return false;
+        }
+
+        usize dataSize = 0U;
+        if (vkGetPipelineCacheData(mDevice, mCache, &dataSize, nullptr) != VK_SUCCESS
+            || dataSize == 0U) {
+            return false;
+        }
+        Core::Container::TVector<u8> bytes;
+        bytes.Resize(sizeof(FPipelineCacheFileHeader) + dataSize);
+        u8* data = bytes.Data() + sizeof(FPipelineCacheFileHeader);
+        if (vkGetPipelineCacheData(mDevice, mCache, &dataSize, data) != VK_SUCCESS) {
+            return false;
+        }
+        bytes.Resize(sizeof(FPipelineCacheFileHeader) + dataSize);
+        data = bytes.Data() + sizeof(FPipelineCacheFileHeader);
+
+        FPipelineCacheFileHeader header{};
+        FillHeader(header, mProperties);
+        header.mDataSize = static_cast<u64>(dataSize);
+        header.mDataHash = HashBytes(data, dataSize);
+        Core::Platform::Generic::Memcpy(bytes.Data(), &header, sizeof(header));
+
+        Core::Platform::CreateDirectories(mCacheDir);
+        if (!Core::Platform::WriteFileBytes(mFilePath, bytes.Data(), bytes.Size())) {
+            LogWarningCat(
+                kLogCategory, TEXT("Failed to write pipeline cache {}."), mFilePath.ToView());
+            return false;
+        }
+        return true;
+    }
+
+    void FVulkanPipelineCache::NotePipelineCreated(bool graphics, u64 nanoseconds) noexcept {
+        if (graphics) {
+            mGraphicsCreates.FetchAdd(1U);
+        } else {
+            mComputeCreates.FetchAdd(1U);
+        }
+        mCreateNanoseconds.FetchAdd(nanoseconds);
+    }
+
+    void FVulkanPipelineCache::NoteDedupHit() noexcept { mDedupHits.FetchAdd(1U); }
+
+    void FVulkanPipelineCache::FillStats(FRhiVulkanPipelineCacheStats& outStats) const noexcept {
+        outStats.LoadedBytes       = mLoadedBytes;
+        outStats.LoadNanoseconds   = mLoadNanoseconds;
+        outStats.GraphicsPipelines = mGraphicsCreates.Load();
+        outStats.ComputePipelines  = mComputeCreates.Load();
+        outStats.CreateNanoseconds = mCreateNanoseconds.Load();
+        outStats.DedupHits         = mDedupHits.Load();
+    }
+} // namespace AltinaEngine::Rhi
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "RhiVulkanInternal.h"
+#include "Container/String.h"
+#include "Threading/Atomic.h"
+#include "Types/Aliases.h"
+
+namespace AltinaEngine::Rhi {
+    struct FRhiVulkanPipelineCacheStats;
+
+    /**
+     * @brief Device-wide `VkPipelineCache`, persisted between runs.
+     *
+     * The cache file lives in the device's pipeline cache directory and is named after the
+     * vendor and device ID. Its header also records the driver version and the driver's
+     * pipeline cache UUID; a file written by another driver, or one that fails its checksum, is
+     * ignored and overwritten on shutdown instead of being handed to the driver.
+     *
+     * `vkCreate*Pipelines` synchronizes access to the cache internally, so pipelines may be
+     * created from any thread.
+     */
+    class FVulkanPipelineCache {
+    public:
+        FVulkanPipelineCache() = default;
+        ~FVulkanPipelineCache();
+
+        FVulkanPipelineCache(const FVulkanPipelineCache&)                    = delete;
+        auto operator=(const FVulkanPipelineCache&) -> FVulkanPipelineCache& = delete;
+
+        void Init(VkPhysicalDevice physicalDevice, VkDevice device,
+            const Core::Container::FString& cacheDir) noexcept;
+        // Writes the cache file (if a directory was given) and destroys the cache.
+        void Shutdown() noexcept;
+        auto Save() noexcept -> bool;
+
+        [[nodiscard]] auto GetHandle() const noexcept -> VkPipelineCache { return mCache; }
+
+        void NotePipelineCreated(bool graphics, u64 nanoseconds) noexcept;
+        void NoteDedupHit() noexcept;
+        void FillStats(FRhiVulkanPipelineCacheStats& outStats) const noexcept;
+
+    private:
+        VkDevice                      mDevice = VK_NULL_HANDLE;
+        VkPipelineCache               mCache  = VK_NULL_HANDLE;
+        Core::Container::FString      mCacheDir;
+        Core::Container::FString      mFilePath;
+        VkPhysicalDeviceProperties    mProperties{};
+        u64                           mLoadedBytes     = 0ULL;
+        u64                           mLoadNanoseconds = 0ULL;
+        Core::Threading::TAtomic<u32> mGraphicsCreates;
+        Core::Threading::TAtomic<u32> mComputeCreates;
+        Core::Threading::TAtomic<u32> mDedupHits;
+        Core::Threading::TAtomic<u64> mCreateNanoseconds;
+    };
+} // namespace AltinaEngine::Rhi
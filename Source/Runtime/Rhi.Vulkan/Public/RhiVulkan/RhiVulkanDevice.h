@@ -26,6 +26,21 @@
 #endif
 
 namespace AltinaEngine::Rhi {
+    /**
+     * @brief Pipeline creation totals of a `FRhiVulkanDevice` since it was created.
+     *
+     * Compare a cold start (no cache file) with a warm one: `CreateNanoseconds` is the time
+     * spent inside `vkCreate*Pipelines`, which the on-disk pipeline cache shortens.
+     */
+    struct FRhiVulkanPipelineCacheStats {
+        u64 LoadedBytes       = 0ULL; // driver cache data read from disk; 0 on a cold start
+        u64 LoadNanoseconds   = 0ULL;
+        u32 GraphicsPipelines = 0U; // VkPipelines, one per attachment/topology variant
+        u32 ComputePipelines  = 0U;
+        u64 CreateNanoseconds = 0ULL;
+        u32 DedupHits         = 0U; // CreateGraphicsPipeline calls served by an existing pipeline
+    };
+
     class AE_RHI_VULKAN_API FRhiVulkanDevice final : public FRhiDevice {
     public:
         FRhiVulkanDevice(const FRhiDeviceDesc& desc, const FRhiAdapterDesc& adapterDesc,
@@ -48,6 +63,7 @@ namespace AltinaEngine::Rhi {
         [[nodiscard]] auto SupportsExtendedDynamicState() const noexcept -> bool;
         [[nodiscard]] auto SupportsDebugNames() const noexcept -> bool;
         [[nodiscard]] auto GetInternalAllocatorHandle() const noexcept -> void*;
+        [[nodiscard]] auto GetPipelineCacheStats() const noexcept -> FRhiVulkanPipelineCacheStats;
 
         void               NotifyViewportAcquired(VkSemaphore acquire, VkSemaphore renderComplete);
         [[nodiscard]] auto ConsumePendingAcquireSemaphore() noexcept -> VkSemaphore;
@@ -8,6 +8,8 @@
 #include "Rhi/RhiRefs.h"
 
 namespace AltinaEngine::Rhi {
+    class FVulkanPipelineCache;
+
     class AE_RHI_VULKAN_API FRhiVulkanPipelineLayout final : public FRhiPipelineLayout {
     public:
         FRhiVulkanPipelineLayout(const FRhiPipelineLayoutDesc& desc, VkDevice device);
@@ -62,7 +64,7 @@ namespace AltinaEngine::Rhi {
     class AE_RHI_VULKAN_API FRhiVulkanGraphicsPipeline final : public FRhiPipeline {
     public:
         FRhiVulkanGraphicsPipeline(const FRhiGraphicsPipelineDesc& desc, VkDevice device,
-            bool supportsExtendedDynamicState);
+            bool supportsExtendedDynamicState, FVulkanPipelineCache* pipelineCache = nullptr);
         ~FRhiVulkanGraphicsPipeline() override;
 
         [[nodiscard]] auto GetNativePipeline() const noexcept -> VkPipeline;
@@ -87,7 +89,8 @@ namespace AltinaEngine::Rhi {
 
     class AE_RHI_VULKAN_API FRhiVulkanComputePipeline final : public FRhiPipeline {
     public:
-        FRhiVulkanComputePipeline(const FRhiComputePipelineDesc& desc, VkDevice device);
+        FRhiVulkanComputePipeline(const FRhiComputePipelineDesc& desc, VkDevice device,
+            FVulkanPipelineCache* pipelineCache = nullptr);
         ~FRhiVulkanComputePipeline() override;
 
         [[nodiscard]] auto GetNativePipeline() const noexcept -> VkPipeline;
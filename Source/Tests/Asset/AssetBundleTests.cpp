@@ -0,0 +1,389 @@
+#include "Asset/AssetBundle.h"
+#include "Asset/AssetManager.h"
+#include "Asset/AssetRegistry.h"
+#include "Platform/PlatformFileSystem.h"
+#include "Threading/Atomic.h"
+#include "TestHarness.h"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+#include <thread>
+
+namespace {
+    namespace Container = AltinaEngine::Core::Container;
+    using AltinaEngine::FUuid;
+    using AltinaEngine::u16;
+    using AltinaEngine::u32;
+    using AltinaEngine::u64;
+    using AltinaEngine::u8;
+    using AltinaEngine::usize;
+    using AltinaEngine::Asset::EAssetType;
+    using AltinaEngine::Asset::FAssetDesc;
+    using AltinaEngine::Asset::FAssetHandle;
+    using AltinaEngine::Asset::FAssetManager;
+    using AltinaEngine::Asset::FAssetRegistry;
+    using AltinaEngine::Asset::IAsset;
+    using AltinaEngine::Asset::IAssetLoader;
+    using AltinaEngine::Asset::IAssetStream;
+    using AltinaEngine::Asset::EBundleCompression;
+    using AltinaEngine::Asset::EBundleFlags;
+    using AltinaEngine::Asset::FAssetBundleReader;
+    using AltinaEngine::Asset::FAssetBundleWriter;
+    using AltinaEngine::Asset::FBundleIndexEntry;
+    using AltinaEngine::Asset::HasBundleFlag;
+    using AltinaEngine::Core::Threading::TAtomic;
+    using Container::FString;
+    using Container::TShared;
+    using Container::TVector;
+
+    auto MakeUuid(u8 id) -> FUuid {
+        FUuid::FBytes bytes{};
+        bytes[0]  = id;
+        bytes[15] = 0xB7U;
+        return FUuid(bytes);
+    }
+
+    // Mesh-like data: runs of repeated values with occasional noise.
+    auto MakeCompressible(usize size) -> TVector<u8> {
+        TVector<u8> bytes;
+        bytes.Resize(size);
+        u32 state = 7U;
+        for (usize index = 0; index < size; ++index) {
+            state           = state * 1664525U + 1013904223U;
+            const u32 noise = ((state >> 24U) == 0U) ? 1U : 0U;
+            bytes[index]    = static_cast<u8>((index / 24U) % 7U + noise);
+        }
+        return bytes;
+    }
+
+    auto MakeNoise(usize size) -> TVector<u8> {
+        TVector<u8> bytes;
+        bytes.Resize(size);
+        u32 state = 99U;
+        for (usize index = 0; index < size; ++index) {
+            state        = state * 1664525U + 1013904223U;
+            bytes[index] = static_cast<u8>(state >> 24U);
+        }
+        return bytes;
+    }
+
+    auto ToFString(const std::filesystem::path& path) -> FString {
+        const auto text = path.string();
+        FString    out;
+        for (const char value : text) {
+            out.Append(static_cast<AltinaEngine::TChar>(value));
+        }
+        return out;
+    }
+
+    auto Matches(const TVector<u8>& left, const TVector<u8>& right) -> bool {
+        return left.Size() == right.Size()
+            && std::memcmp(left.Data(), right.Data(), static_cast<size_t>(left.Size())) == 0;
+    }
+
+    class FPayloadAsset final : public IAsset {
+    public:
+        explicit FPayloadAsset(TVector<u8> payload) : mPayload(AltinaEngine::Move(payload)) {}
+        TVector<u8> mPayload;
+    };
+
+    // Stands in for the mesh and texture loaders: validates a header and copies the payload
+    // into the asset, reading it in place when the stream is memory-backed.
+    class FPayloadLoader final : public IAssetLoader {
+    public:
+        [[nodiscard]] auto CanLoad(EAssetType type) const noexcept -> bool override {
+            return type == EAssetType::Mesh;
+        }
+
+        auto Load(const FAssetDesc& /*desc*/, IAssetStream& stream) -> TShared<IAsset> override {
+            const usize size = stream.Size();
+            if (size < sizeof(u32)) {
+                return {};
+            }
+            TVector<u8> payload;
+            payload.Resize(size);
+            mLastData = stream.GetData();
+            if (const u8* data = mLastData) {
+                mInPlaceLoads.FetchAdd(1U);
+                std::memcpy(payload.Data(), data, size);
+            } else if (stream.Read(payload.Data(), size) != size) {
+                return {};
+            }
+            return Container::MakeSharedAs<IAsset, FPayloadAsset>(AltinaEngine::Move(payload));
+        }
+
+        TAtomic<u32> mInPlaceLoads;
+        const u8*    mLastData = nullptr; // backing bytes of the last load, for serial tests
+    };
+
+    void RunChunkedRoundTrip(EBundleCompression compression, const char* fileName) {
+        const TVector<u8> large = MakeCompressible(300000U);
+        const TVector<u8> noise = MakeNoise(20000U);
+        const TVector<u8> small = MakeCompressible(100U);
+
+        FAssetBundleWriter writer(compression, 16U * 1024U);
+        REQUIRE(writer.AddEntry(MakeUuid(1U), EAssetType::Mesh, large.Data(), large.Size()));
+        REQUIRE(writer.AddEntry(MakeUuid(2U), EAssetType::Texture2D, noise.Data(), noise.Size()));
+        REQUIRE(writer.AddEntry(MakeUuid(3U), EAssetType::Script, small.Data(), small.Size()));
+        REQUIRE(!writer.AddEntry(MakeUuid(3U), EAssetType::Script, small.Data(), small.Size()));
+        REQUIRE(writer.GetPayloadSize() < static_cast<u64>(large.Size() + noise.Size()));
+
+        const auto bundlePath = std::filesystem::current_path() / fileName;
+        REQUIRE(writer.WriteToFile(ToFString(bundlePath)));
+
+        FAssetBundleReader reader;
+        REQUIRE(reader.Open(ToFString(bundlePath)));
+        const u16 flags = reader.GetHeader().mFlags;
+        REQUIRE(HasBundleFlag(flags, EBundleFlags::HasChunks));
+        REQUIRE(HasBundleFlag(flags, EBundleFlags::HasCompression));
+
+        FBundleIndexEntry largeEntry{};
+        REQUIRE(reader.GetEntry(MakeUuid(1U), largeEntry));
+        REQUIRE_EQ(largeEntry.mCompression, static_cast<u32>(compression));
+        REQUIRE_EQ(largeEntry.mChunkCount, 19U);
+        REQUIRE(largeEntry.mSize < largeEntry.mRawSize);
+
+        // Incompressible data falls back to a plain entry.
+        FBundleIndexEntry noiseEntry{};
+        REQUIRE(reader.GetEntry(MakeUuid(2U), noiseEntry));
+        REQUIRE_EQ(noiseEntry.mCompression, static_cast<u32>(EBundleCompression::None));
+        REQUIRE_EQ(noiseEntry.mChunkCount, 0U);
+
+        FBundleIndexEntry smallEntry{};
+        REQUIRE(reader.GetEntry(MakeUuid(3U), smallEntry));
+
+        // Concurrent reads share the one file handle.
+        bool results[4]{};
+        {
+            std::thread threads[4];
+            for (usize index = 0; index < 4U; ++index) {
+                threads[index] = std::thread([&, index]() {
+                    bool ok = true;
+                    for (u32 round = 0U; round < 8U; ++round) {
+                        TVector<u8> bytes;
+                        ok = ok && reader.ReadEntry(largeEntry, bytes) && Matches(bytes, large);
+                        ok = ok && reader.ReadEntry(noiseEntry, bytes) && Matches(bytes, noise);
+                        ok = ok && reader.ReadEntry(smallEntry, bytes) && Matches(bytes, small);
+                    }
+                    results[index] = ok;
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+        for (const bool ok : results) {
+            REQUIRE(ok);
+        }
+
+        // A chunk table pointing outside the index block is rejected instead of read.
+        FBundleIndexEntry broken = largeEntry;
+        broken.mChunkTableOffset = 0xfffffff0U;
+        TVector<u8> bytes;
+        REQUIRE(!reader.ReadEntry(broken, bytes));
+        REQUIRE(bytes.IsEmpty());
+
+        reader.Close();
+        std::error_code ec;
+        std::filesystem::remove(bundlePath, ec);
+    }
+} // namespace
+
+TEST_CASE("Asset.Bundle.Chunked.Lz4") {
+    RunChunkedRoundTrip(EBundleCompression::Lz4, "BundleLz4.pak");
+}
+
+TEST_CASE("Asset.Bundle.Lz4.OverlappingMatches") {
+    // Periodic runs make the encoder emit matches that overlap their own output, for periods
+    // below and above the 8-byte bytewise-copy threshold of the decoder.
+    TVector<u8> bytes;
+    u32         state = 3U;
+    for (u32 period = 1U; period <= 40U; ++period) {
+        u8 pattern[40]{};
+        for (u32 index = 0U; index < period; ++index) {
+            state          = state * 1664525U + 1013904223U;
+            pattern[index] = static_cast<u8>(state >> 24U);
+        }
+        for (u32 index = 0U; index < 500U + period; ++index) {
+            bytes.PushBack(pattern[index % period]);
+        }
+    }
+
+    FAssetBundleWriter writer(EBundleCompression::Lz4, 16U * 1024U);
+    REQUIRE(writer.AddEntry(MakeUuid(1U), EAssetType::Mesh, bytes.Data(), bytes.Size()));
+    const auto bundlePath = std::filesystem::current_path() / "BundleLz4Overlap.pak";
+    REQUIRE(writer.WriteToFile(ToFString(bundlePath)));
+
+    FAssetBundleReader reader;
+    REQUIRE(reader.Open(ToFString(bundlePath)));
+    FBundleIndexEntry entry{};
+    REQUIRE(reader.GetEntry(MakeUuid(1U), entry));
+    REQUIRE_EQ(entry.mCompression, static_cast<u32>(EBundleCompression::Lz4));
+    TVector<u8> decoded;
+    REQUIRE(reader.ReadEntry(entry, decoded));
+    REQUIRE(Matches(decoded, bytes));
+
+    reader.Close();
+    std::error_code ec;
+    std::filesystem::remove(bundlePath, ec);
+}
+
+TEST_CASE("Asset.Bundle.Chunked.Zstd") {
+    // Zstd support is optional at build time; the writer refuses it when absent.
+    FAssetBundleWriter probe(EBundleCompression::Zstd);
+    const u8           byte = 1U;
+    if (!probe.AddEntry(MakeUuid(1U), EAssetType::Script, &byte, 1U)) {
+        return;
+    }
+    RunChunkedRoundTrip(EBundleCompression::Zstd, "BundleZstd.pak");
+}
+
+TEST_CASE("Asset.Bundle.ManagerLoadsStoredAndCompressedEntries") {
+    // Noise does not shrink, so the LZ4 writer stores it as a plain entry next to the
+    // compressed one.
+    const TVector<u8> stored     = MakeNoise(40000U);
+    const TVector<u8> compressed = MakeCompressible(200000U);
+
+    FAssetBundleWriter writer(EBundleCompression::Lz4, 16U * 1024U);
+    REQUIRE(writer.AddEntry(MakeUuid(1U), EAssetType::Mesh, stored.Data(), stored.Size()));
+    REQUIRE(
+        writer.AddEntry(MakeUuid(2U), EAssetType::Mesh, compressed.Data(), compressed.Size()));
+    const auto bundlePath = std::filesystem::current_path() / "BundleManagerLoad.pak";
+    REQUIRE(writer.WriteToFile(ToFString(bundlePath)));
+
+    FAssetBundleReader bundle;
+    REQUIRE(bundle.Open(ToFString(bundlePath)));
+    FBundleIndexEntry storedEntry{};
+    FBundleIndexEntry compressedEntry{};
+    REQUIRE(bundle.GetEntry(MakeUuid(1U), storedEntry));
+    REQUIRE(bundle.GetEntry(MakeUuid(2U), compressedEntry));
+    REQUIRE_EQ(storedEntry.mCompression, static_cast<u32>(EBundleCompression::None));
+    REQUIRE_EQ(compressedEntry.mCompression, static_cast<u32>(EBundleCompression::Lz4));
+    const u8* mapped = bundle.GetEntryData(storedEntry);
+    REQUIRE(mapped != nullptr);
+    REQUIRE(bundle.GetEntryData(compressedEntry) == nullptr);
+
+    FAssetRegistry registry;
+    for (u8 id = 1U; id <= 2U; ++id) {
+        FAssetDesc desc{};
+        desc.mHandle = { MakeUuid(id), EAssetType::Mesh };
+        registry.AddAsset(AltinaEngine::Move(desc));
+    }
+
+    FPayloadLoader loader;
+    FAssetManager  manager;
+    manager.SetRegistry(&registry);
+    manager.RegisterLoader(&loader);
+    manager.RegisterBundle(&bundle);
+
+    // The stored entry reaches the loader as the mapped bytes themselves.
+    TShared<IAsset> storedAsset = manager.Load({ MakeUuid(1U), EAssetType::Mesh });
+    REQUIRE(storedAsset);
+    REQUIRE(loader.mLastData == mapped);
+    REQUIRE(Matches(static_cast<const FPayloadAsset*>(storedAsset.Get())->mPayload, stored));
+
+    // The compressed entry is decoded into a buffer first.
+    TShared<IAsset> compressedAsset = manager.Load({ MakeUuid(2U), EAssetType::Mesh });
+    REQUIRE(compressedAsset);
+    REQUIRE(loader.mLastData != nullptr);
+    REQUIRE(loader.mLastData != mapped);
+    REQUIRE(Matches(
+        static_cast<const FPayloadAsset*>(compressedAsset.Get())->mPayload, compressed));
+
+    manager.UnregisterBundle(&bundle);
+    manager.ClearCache();
+    bundle.Close();
+    std::error_code ec;
+    std::filesystem::remove(bundlePath, ec);
+}
+
+BENCHMARK_CASE("Asset.Bundle.MappedLoadBenchmark") {
+    constexpr u32   kAssetCount = 48U;
+    constexpr usize kAssetSize  = 1024U * 1024U;
+    constexpr u32   kRounds     = 4U;
+
+    const auto      root = std::filesystem::current_path() / "BundleLoadBench";
+    std::error_code ec;
+    std::filesystem::create_directories(root, ec);
+
+    FAssetRegistry     registry;
+    FAssetBundleWriter plainWriter(EBundleCompression::None);
+    FAssetBundleWriter lz4Writer(EBundleCompression::Lz4);
+    for (u32 index = 0U; index < kAssetCount; ++index) {
+        TVector<u8> payload = MakeCompressible(kAssetSize);
+        payload[0]          = static_cast<u8>(index);
+
+        FAssetDesc desc{};
+        desc.mHandle = { MakeUuid(static_cast<u8>(index + 1U)), EAssetType::Mesh };
+        const auto cookedPath = root / ("Asset" + std::to_string(index) + ".bin");
+        desc.mCookedPath = ToFString(cookedPath);
+        REQUIRE(AltinaEngine::Core::Platform::WriteFileBytes(
+            desc.mCookedPath, payload.Data(), payload.Size()));
+        REQUIRE(plainWriter.AddEntry(desc.mHandle.mUuid, EAssetType::Mesh, payload.Data(),
+            payload.Size()));
+        REQUIRE(lz4Writer.AddEntry(desc.mHandle.mUuid, EAssetType::Mesh, payload.Data(),
+            payload.Size()));
+        registry.AddAsset(AltinaEngine::Move(desc));
+    }
+    REQUIRE(plainWriter.WriteToFile(ToFString(root / "Plain.pak")));
+    REQUIRE(lz4Writer.WriteToFile(ToFString(root / "Lz4.pak")));
+
+    FAssetBundleReader plainBundle;
+    FAssetBundleReader lz4Bundle;
+    REQUIRE(plainBundle.Open(ToFString(root / "Plain.pak")));
+    REQUIRE(lz4Bundle.Open(ToFString(root / "Lz4.pak")));
+
+    // Loads every asset kRounds times through `bundle` (loose cooked files when null).
+    auto measure = [&](const FAssetBundleReader* bundle, u32& outInPlace) -> double {
+        FPayloadLoader loader;
+        FAssetManager  manager;
+        manager.SetRegistry(&registry);
+        manager.RegisterLoader(&loader);
+        manager.RegisterBundle(bundle);
+
+        u32        loaded = 0U;
+        const auto start  = std::chrono::steady_clock::now();
+        for (u32 round = 0U; round < kRounds; ++round) {
+            for (u32 index = 0U; index < kAssetCount; ++index) {
+                TShared<IAsset> asset =
+                    manager.Load({ MakeUuid(static_cast<u8>(index + 1U)), EAssetType::Mesh });
+                const auto* payload = static_cast<const FPayloadAsset*>(asset.Get());
+                if (payload != nullptr && payload->mPayload.Size() == kAssetSize
+                    && payload->mPayload[0] == static_cast<u8>(index)) {
+                    ++loaded;
+                }
+            }
+            manager.ClearCache();
+        }
+        const double seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        manager.UnregisterBundle(bundle);
+        REQUIRE_EQ(loaded, kAssetCount * kRounds);
+        outInPlace = loader.mInPlaceLoads.Load();
+        return static_cast<double>(kAssetSize) * kAssetCount * kRounds / (1024.0 * 1024.0)
+            / seconds;
+    };
+
+    u32          copyInPlace   = 0U;
+    u32          mappedInPlace = 0U;
+    u32          lz4InPlace    = 0U;
+    const double copyMBps      = measure(nullptr, copyInPlace);
+    const double mappedMBps    = measure(&plainBundle, mappedInPlace);
+    const double lz4MBps       = measure(&lz4Bundle, lz4InPlace);
+
+    std::cout << "[Bench][AssetBundleLoad] " << kAssetCount << " x " << (kAssetSize >> 10U)
+              << " KiB, " << kRounds << " rounds: loose files (read + copy)=" << copyMBps
+              << " MB/s, mapped bundle (in place)=" << mappedMBps
+              << " MB/s, lz4 bundle (parallel decode)=" << lz4MBps
+              << " MB/s; staging buffer per load: " << (kAssetSize >> 10U) << " KiB vs 0 KiB\n";
+
+    // Every load from the uncompressed bundle read the mapped bytes in place.
+    REQUIRE_EQ(mappedInPlace, kAssetCount * kRounds);
+
+    plainBundle.Close();
+    lz4Bundle.Close();
+    std::filesystem::remove_all(root, ec);
+}
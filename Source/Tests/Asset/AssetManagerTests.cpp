@@ -0,0 +1,213 @@
+#include "Asset/AssetManager.h"
+#include "Asset/AssetRegistry.h"
+#include "Threading/Atomic.h"
+#include "Threading/Mutex.h"
+#include "TestHarness.h"
+
+#include <chrono>
+#include <initializer_list>
+#include <thread>
+
+namespace {
+    namespace Container = AltinaEngine::Core::Container;
+    using AltinaEngine::FUuid;
+    using AltinaEngine::Move;
+    using AltinaEngine::u32;
+    using AltinaEngine::u8;
+    using AltinaEngine::usize;
+    using AltinaEngine::Asset::EAssetLoadState;
+    using AltinaEngine::Asset::EAssetType;
+    using AltinaEngine::Asset::FAssetDesc;
+    using AltinaEngine::Asset::FAssetHandle;
+    using AltinaEngine::Asset::FAssetLoadHandle;
+    using AltinaEngine::Asset::FAssetManager;
+    using AltinaEngine::Asset::FAssetRegistry;
+    using AltinaEngine::Asset::IAsset;
+    using AltinaEngine::Asset::IAssetLoader;
+    using AltinaEngine::Asset::IAssetStream;
+    using AltinaEngine::Core::Threading::FMutex;
+    using AltinaEngine::Core::Threading::FScopedLock;
+    using AltinaEngine::Core::Threading::TAtomic;
+    using Container::TShared;
+    using Container::TVector;
+
+    class FTestAsset final : public IAsset {
+    public:
+        explicit FTestAsset(u8 id) : mId(id) {}
+        u8 mId = 0U;
+    };
+
+    // Script assets may have no cooked file, so the loader never touches the disk. The asset
+    // whose id equals `mGateId` blocks in Load until the gate opens.
+    class FRecordingLoader final : public IAssetLoader {
+    public:
+        [[nodiscard]] auto CanLoad(EAssetType type) const noexcept -> bool override {
+            return type == EAssetType::Script;
+        }
+
+        auto Load(const FAssetDesc& desc, IAssetStream& /*stream*/) -> TShared<IAsset> override {
+            const u8 id = desc.mHandle.mUuid.GetBytes()[0];
+            if (id == mGateId) {
+                mGateEntered.Store(1U);
+                while (mGateOpen.Load() == 0U) {
+                    std::this_thread::yield();
+                }
+            }
+            {
+                FScopedLock lock(mMutex);
+                mOrder.PushBack(id);
+            }
+            return Container::MakeSharedAs<IAsset, FTestAsset>(id);
+        }
+
+        [[nodiscard]] auto IndexOf(u8 id) -> usize {
+            FScopedLock lock(mMutex);
+            for (usize index = 0; index < mOrder.Size(); ++index) {
+                if (mOrder[index] == id) {
+                    return index;
+                }
+            }
+            return mOrder.Size();
+        }
+
+        [[nodiscard]] auto LoadCount() -> usize {
+            FScopedLock lock(mMutex);
+            return mOrder.Size();
+        }
+
+        u8           mGateId = 0U;
+        TAtomic<u32> mGateEntered;
+        TAtomic<u32> mGateOpen;
+
+    private:
+        FMutex      mMutex;
+        TVector<u8> mOrder;
+    };
+
+    auto MakeHandle(u8 id) -> FAssetHandle {
+        FUuid::FBytes bytes{};
+        bytes[0]  = id;
+        bytes[15] = 0xA5U;
+        return { FUuid(bytes), EAssetType::Script };
+    }
+
+    void AddScript(FAssetRegistry& registry, u8 id, std::initializer_list<u8> dependencies) {
+        FAssetDesc desc{};
+        desc.mHandle = MakeHandle(id);
+        for (const u8 dependency : dependencies) {
+            desc.mDependencies.PushBack(MakeHandle(dependency));
+        }
+        registry.AddAsset(Move(desc));
+    }
+
+    auto Loaded(const FAssetLoadHandle& handle) -> u8 {
+        TShared<IAsset> asset = handle.Get();
+        return asset ? static_cast<FTestAsset*>(asset.Get())->mId : 0U;
+    }
+} // namespace
+
+TEST_CASE("Asset.Manager.LoadAsync.DependenciesFirst") {
+    // 1 -> {2, 3}, 3 -> {4}, 4 -> {1} closes a cycle that must be ignored.
+    FAssetRegistry registry;
+    AddScript(registry, 1U, { 2U, 3U });
+    AddScript(registry, 2U, {});
+    AddScript(registry, 3U, { 4U });
+    AddScript(registry, 4U, { 1U });
+
+    FRecordingLoader loader;
+    FAssetManager    manager;
+    manager.SetRegistry(&registry);
+    manager.RegisterLoader(&loader);
+
+    FAssetLoadHandle root = manager.LoadAsync(MakeHandle(1U), 5);
+    REQUIRE(root.IsValid());
+    REQUIRE_EQ(Loaded(root), static_cast<u8>(1U));
+    REQUIRE(root.GetState() == EAssetLoadState::Loaded);
+
+    REQUIRE_EQ(loader.LoadCount(), 4U);
+    REQUIRE(loader.IndexOf(4U) < loader.IndexOf(3U));
+    REQUIRE(loader.IndexOf(3U) < loader.IndexOf(1U));
+    REQUIRE(loader.IndexOf(2U) < loader.IndexOf(1U));
+    REQUIRE(manager.FindLoaded(MakeHandle(4U)));
+
+    // Cached assets complete immediately and share the instance with Load().
+    FAssetLoadHandle again = manager.LoadAsync(MakeHandle(3U));
+    REQUIRE(again.IsDone());
+    REQUIRE(again.Get().Get() == manager.Load(MakeHandle(3U)).Get());
+    REQUIRE_EQ(loader.LoadCount(), 4U);
+
+    FAssetLoadHandle missing = manager.LoadAsync(MakeHandle(9U));
+    REQUIRE(missing.IsDone());
+    REQUIRE(missing.GetState() == EAssetLoadState::Failed);
+}
+
+TEST_CASE("Asset.Manager.LoadAsync.CancelAndBump") {
+    // 1 -> {2}, 2 -> {3}; asset 3 blocks in its loader until the gate opens.
+    FAssetRegistry registry;
+    AddScript(registry, 1U, { 2U });
+    AddScript(registry, 2U, { 3U });
+    AddScript(registry, 3U, {});
+
+    FRecordingLoader loader;
+    loader.mGateId = 3U;
+    FAssetManager manager;
+    manager.SetRegistry(&registry);
+    manager.RegisterLoader(&loader);
+
+    FAssetLoadHandle top    = manager.LoadAsync(MakeHandle(1U));
+    FAssetLoadHandle middle = manager.LoadAsync(MakeHandle(2U));
+    while (loader.mGateEntered.Load() == 0U) {
+        std::this_thread::yield();
+    }
+    REQUIRE(top.GetState() == EAssetLoadState::Pending);
+    middle.SetPriority(100);
+
+    // Asset 2 still has a pending dependent; asset 3 already started decoding.
+    REQUIRE(!middle.Cancel());
+    REQUIRE(!manager.LoadAsync(MakeHandle(3U)).Cancel());
+
+    REQUIRE(top.Cancel());
+    REQUIRE(top.GetState() == EAssetLoadState::Cancelled);
+    REQUIRE(!top.Get());
+    // Asset 2 was also requested on its own, so it survives the cancel.
+    REQUIRE(middle.GetState() == EAssetLoadState::Pending);
+
+    loader.mGateOpen.Store(1U);
+    REQUIRE_EQ(Loaded(middle), static_cast<u8>(2U));
+    REQUIRE_EQ(loader.LoadCount(), 2U);
+    REQUIRE(!manager.FindLoaded(MakeHandle(1U)));
+}
+
+TEST_CASE("Asset.Manager.Load.PinsInFlightRequest") {
+    // 1 -> {2}, 2 -> {3}; asset 2 is only queued as a dependency when Load() joins it.
+    FAssetRegistry registry;
+    AddScript(registry, 1U, { 2U });
+    AddScript(registry, 2U, { 3U });
+    AddScript(registry, 3U, {});
+
+    FRecordingLoader loader;
+    loader.mGateId = 3U;
+    FAssetManager manager;
+    manager.SetRegistry(&registry);
+    manager.RegisterLoader(&loader);
+
+    FAssetLoadHandle top = manager.LoadAsync(MakeHandle(1U));
+    while (loader.mGateEntered.Load() == 0U) {
+        std::this_thread::yield();
+    }
+
+    TShared<IAsset> blocked;
+    std::thread     waiter([&]() { blocked = manager.Load(MakeHandle(2U)); });
+    // Give the blocking Load() time to find the in-flight request and pin it.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // Cancelling the parent, or the request itself through another handle, leaves it alone.
+    REQUIRE(top.Cancel());
+    REQUIRE(!manager.LoadAsync(MakeHandle(2U)).Cancel());
+
+    loader.mGateOpen.Store(1U);
+    waiter.join();
+    REQUIRE(blocked);
+    REQUIRE_EQ(static_cast<FTestAsset*>(blocked.Get())->mId, static_cast<u8>(2U));
+    REQUIRE_EQ(loader.LoadCount(), 2U);
+}
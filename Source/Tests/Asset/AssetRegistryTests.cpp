@@ -0,0 +1,206 @@
+#include "Asset/AssetRegistry.h"
+#include "TestHarness.h"
+
+#include <chrono>
+#include <iostream>
+
+namespace {
+    namespace Container = AltinaEngine::Core::Container;
+    using AltinaEngine::FUuid;
+    using AltinaEngine::Move;
+    using AltinaEngine::u32;
+    using AltinaEngine::u8;
+    using AltinaEngine::Asset::EAssetType;
+    using AltinaEngine::Asset::FAssetDesc;
+    using AltinaEngine::Asset::FAssetHandle;
+    using AltinaEngine::Asset::FAssetRedirector;
+    using AltinaEngine::Asset::FAssetRegistry;
+    using Container::FNativeString;
+    using Container::FString;
+
+    auto MakeUuid(u32 value) -> FUuid {
+        FUuid::FBytes bytes{};
+        bytes[0]  = static_cast<u8>(value);
+        bytes[1]  = static_cast<u8>(value >> 8U);
+        bytes[2]  = static_cast<u8>(value >> 16U);
+        bytes[3]  = static_cast<u8>(value >> 24U);
+        bytes[15] = 0x5AU;
+        return FUuid(bytes);
+    }
+
+    auto MakePath(u32 value) -> FString {
+        FString path(TEXT("Bench/Asset_"));
+        path.AppendNumber(value);
+        return path;
+    }
+
+    void FillRegistry(FAssetRegistry& registry, u32 count) {
+        for (u32 index = 0U; index < count; ++index) {
+            FAssetDesc desc{};
+            desc.mHandle      = { MakeUuid(index), EAssetType::Mesh };
+            desc.mVirtualPath = MakePath(index);
+            registry.AddAsset(Move(desc));
+        }
+    }
+
+    // Average nanoseconds per lookup of `lookups` pseudo-random entries by path, UUID and desc.
+    auto MeasureLookupNs(const FAssetRegistry& registry, u32 count, u32 lookups, u32& outFound)
+        -> double {
+        Container::TVector<FString> paths;
+        paths.Reserve(lookups);
+        u32 state = 12345U;
+        for (u32 index = 0U; index < lookups; ++index) {
+            state = state * 1664525U + 1013904223U;
+            paths.PushBack(MakePath(state % count));
+        }
+
+        outFound         = 0U;
+        const auto start = std::chrono::steady_clock::now();
+        for (const FString& path : paths) {
+            const FAssetHandle handle = registry.FindByPath(path.ToView());
+            if (registry.FindByUuid(handle.mUuid).IsValid()
+                && registry.GetDesc(handle) != nullptr) {
+                ++outFound;
+            }
+        }
+        const double totalNs =
+            std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+                .count();
+        return totalNs / static_cast<double>(lookups);
+    }
+} // namespace
+
+TEST_CASE("Asset.Registry.RedirectorChains.Collapsed") {
+    // old-a -> old-b -> level; paths match regardless of case.
+    FAssetRegistry registry{};
+    FNativeString  text{};
+    text.Append("{\"SchemaVersion\":1,\"Assets\":["
+                "{\"Uuid\":\"00000000-0000-0000-0000-00000000000c\","
+                "\"Type\":\"Level\",\"VirtualPath\":\"Demo/Levels/Main\",\"CookedPath\":\"\","
+                "\"Dependencies\":[],\"Desc\":{\"Encoding\":1,\"ByteSize\":8}}],\"Redirectors\":["
+                "{\"OldUuid\":\"00000000-0000-0000-0000-00000000000a\","
+                "\"NewUuid\":\"00000000-0000-0000-0000-00000000000b\","
+                "\"OldVirtualPath\":\"Demo/Old/A\"},"
+                "{\"OldUuid\":\"00000000-0000-0000-0000-00000000000b\","
+                "\"NewUuid\":\"00000000-0000-0000-0000-00000000000c\","
+                "\"OldVirtualPath\":\"Demo/Old/B\"}]}");
+    REQUIRE(registry.LoadFromJsonText(text.ToView()));
+
+    const FAssetHandle level = registry.FindByPath(TEXT("demo/LEVELS/main"));
+    REQUIRE(level.IsValid());
+    REQUIRE_EQ(level.mType, EAssetType::Level);
+    REQUIRE(registry.FindByPath(TEXT("DEMO/OLD/A")) == level);
+    REQUIRE(registry.FindByPath(TEXT("demo/old/b")) == level);
+    REQUIRE(!registry.FindByPath(TEXT("demo/old/c")).IsValid());
+
+    FUuid::FBytes bytes{};
+    bytes[15] = 0x0AU;
+    REQUIRE(registry.ResolveRedirector({ FUuid(bytes), EAssetType::Level }) == level);
+    // Dependency lists may carry UUIDs without a type.
+    REQUIRE(registry.ResolveRedirector({ level.mUuid, EAssetType::Unknown }) == level);
+
+    // A redirector added later extends the existing chain; cycles terminate.
+    FAssetRedirector cycle{};
+    cycle.mOldUuid = MakeUuid(1U);
+    cycle.mNewUuid = MakeUuid(2U);
+    registry.AddRedirector(cycle);
+    cycle.mOldUuid = MakeUuid(2U);
+    cycle.mNewUuid = MakeUuid(1U);
+    registry.AddRedirector(cycle);
+    REQUIRE(!registry.ResolveRedirector({ MakeUuid(1U), EAssetType::Level }).mUuid.IsNil());
+}
+
+TEST_CASE("Asset.Registry.RedirectorsAddedIncrementallyMatchChainWalk") {
+    // Random hops over a small UUID space produce shared ends, duplicates and cycles.
+    constexpr u32                        kUuidCount  = 40U;
+    constexpr u32                        kRedirCount = 120U;
+    FAssetRegistry                       registry{};
+    Container::TVector<FAssetRedirector> redirectors;
+    u32                                  state     = 777U;
+    bool                                 bAllMatch = true;
+    for (u32 added = 0U; added < kRedirCount; ++added) {
+        state = state * 1664525U + 1013904223U;
+        FAssetRedirector redirector{};
+        redirector.mOldUuid = MakeUuid((state >> 8U) % kUuidCount);
+        redirector.mNewUuid = MakeUuid((state >> 20U) % kUuidCount);
+        redirectors.PushBack(redirector);
+        registry.AddRedirector(redirector);
+
+        // Reference: walk each chain hop by hop; the first redirector of a UUID wins, and a
+        // chain that never ends keeps the redirector's own target.
+        const auto findFirst = [&redirectors](const FUuid& uuid) -> const FAssetRedirector* {
+            for (const auto& entry : redirectors) {
+                if (entry.mOldUuid == uuid) {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        };
+        for (u32 uuid = 0U; uuid < kUuidCount; ++uuid) {
+            const FAssetRedirector* first = findFirst(MakeUuid(uuid));
+            if (first == nullptr) {
+                continue;
+            }
+            FUuid target = first->mNewUuid;
+            u32   hops   = 0U;
+            while (hops < static_cast<u32>(redirectors.Size())) {
+                const FAssetRedirector* next = findFirst(target);
+                if (next == nullptr) {
+                    break;
+                }
+                target = next->mNewUuid;
+                ++hops;
+            }
+            if (hops == static_cast<u32>(redirectors.Size())) {
+                target = first->mNewUuid;
+            }
+            const FAssetHandle resolved =
+                registry.ResolveRedirector({ MakeUuid(uuid), EAssetType::Mesh });
+            bAllMatch = bAllMatch && resolved.mUuid == target;
+        }
+    }
+    REQUIRE(bAllMatch);
+}
+
+BENCHMARK_CASE("Asset.Registry.LookupBenchmark") {
+    constexpr u32 kSmallCount = 1000U;
+    constexpr u32 kLargeCount = 1000000U;
+    constexpr u32 kLookups    = 200000U;
+
+    FAssetRegistry small{};
+    FillRegistry(small, kSmallCount);
+
+    FAssetRegistry large{};
+    const auto     buildStart = std::chrono::steady_clock::now();
+    FillRegistry(large, kLargeCount);
+    const double   buildMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart)
+            .count();
+
+    u32          smallFound = 0U;
+    u32          largeFound = 0U;
+    const double smallNs    = MeasureLookupNs(small, kSmallCount, kLookups, smallFound);
+    const double largeNs    = MeasureLookupNs(large, kLargeCount, kLookups, largeFound);
+
+    // One asset renamed over and over: every new hop extends the whole chain before it.
+    constexpr u32 kRenames    = 100000U;
+    const auto    renameStart = std::chrono::steady_clock::now();
+    for (u32 index = 0U; index < kRenames; ++index) {
+        FAssetRedirector redirector{};
+        redirector.mOldUuid = MakeUuid(kLargeCount + index);
+        redirector.mNewUuid = MakeUuid(kLargeCount + index + 1U);
+        large.AddRedirector(redirector);
+    }
+    const double renameMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - renameStart)
+            .count();
+
+    std::cout << "[Bench][AssetRegistry] build " << kLargeCount << " assets=" << buildMs
+              << " ms, path+uuid+desc lookup: " << kSmallCount << " assets=" << smallNs
+              << " ns, " << kLargeCount << " assets=" << largeNs << " ns, " << kRenames
+              << " chained redirectors=" << renameMs << " ms\n";
+    REQUIRE_EQ(smallFound, kLookups);
+    REQUIRE_EQ(largeFound, kLookups);
+    REQUIRE(large.ResolveRedirector({ MakeUuid(kLargeCount), EAssetType::Mesh }).mUuid
+        == MakeUuid(kLargeCount + kRenames));
+}
@@ -0,0 +1,191 @@
+#include "TestHarness.h"
+
+#include "Container/HashMap.h"
+#include "Container/Name.h"
+#include "Container/String.h"
+#include "Container/Vector.h"
+#include "Platform/PlatformMemory.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+    using AltinaEngine::TChar;
+    using AltinaEngine::u32;
+    using AltinaEngine::u64;
+    using AltinaEngine::usize;
+    using AltinaEngine::Core::Container::FName;
+    using AltinaEngine::Core::Container::FString;
+    using AltinaEngine::Core::Container::FStringView;
+    using AltinaEngine::Core::Container::THashMap;
+    using AltinaEngine::Core::Container::TVector;
+    using AltinaEngine::Core::Platform::EMemoryTag;
+    using AltinaEngine::Core::Platform::GetMemoryTagStats;
+
+    auto HeapAllocations() -> u64 {
+        return GetMemoryTagStats(EMemoryTag::Default).mTotalAllocations;
+    }
+
+    auto MakeLabel(const char* prefix, u32 index) -> FString {
+        char      buffer[64] = {};
+        const int written    = std::snprintf(buffer, sizeof(buffer), "%s%u", prefix, index);
+        FString   label;
+        for (int i = 0; i < written; ++i) {
+            label.PushBack(static_cast<TChar>(buffer[i]));
+        }
+        return label;
+    }
+
+    template <typename Func> auto MeasureNs(u32 iterations, Func&& func) -> double {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    }
+} // namespace
+
+TEST_CASE("Container.Name.InternAndResolve") {
+    const FName none;
+    REQUIRE(none.IsNone());
+    REQUIRE(none.ToView().IsEmpty());
+    REQUIRE(FName(FStringView()).IsNone());
+
+    const FName bloom(TEXT("Bloom"));
+    const FName again(FString(TEXT("Bloom")).ToView());
+    const FName upper(TEXT("BLOOM"));
+    REQUIRE(!bloom.IsNone());
+    REQUIRE(bloom == again);
+    REQUIRE(bloom != upper);
+    REQUIRE(bloom.ToView() == FStringView(TEXT("Bloom")));
+    REQUIRE_EQ(bloom.ToView().Data()[5], TEXT('\0'));
+    REQUIRE(bloom.ToString() == FStringView(TEXT("Bloom")));
+
+    REQUIRE(FName::Find(TEXT("Bloom")) == bloom);
+    REQUIRE(FName::Find(TEXT("Container.Name.NeverInterned")).IsNone());
+
+    THashMap<FName, u32> map;
+    map[bloom] = 7U;
+    REQUIRE_EQ(map[FName(TEXT("Bloom"))], 7U);
+    REQUIRE(!map.HasKey(upper));
+}
+
+TEST_CASE("Container.Name.RejectsOversizedNames") {
+    // Larger than an entry block for any character width; such a name is never added.
+    FString oversized;
+    for (u32 index = 0U; index < 70000U; ++index) {
+        oversized.PushBack(static_cast<TChar>('a'));
+    }
+    REQUIRE(FName(oversized.ToView()).IsNone());
+    REQUIRE(FName::Find(oversized.ToView()).IsNone());
+    REQUIRE(!FName(TEXT("Container.Name.AfterOversized")).IsNone());
+}
+
+TEST_CASE("Container.Name.ConcurrentIntern") {
+    constexpr u32                   kThreads = 4U;
+    constexpr u32                   kNames   = 2000U;
+    std::vector<std::vector<FName>> results(kThreads);
+    std::vector<std::thread>        threads;
+    for (u32 thread = 0U; thread < kThreads; ++thread) {
+        threads.emplace_back([&results, thread] {
+            for (u32 index = 0U; index < kNames; ++index) {
+                // Every thread interns the same names, in a different order.
+                const u32 name = (index * 7U + thread * 500U) % kNames;
+                results[thread].push_back(FName(MakeLabel("Concurrent.", name).ToView()));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (u32 thread = 0U; thread < kThreads; ++thread) {
+        for (u32 index = 0U; index < kNames; ++index) {
+            const u32   name     = (index * 7U + thread * 500U) % kNames;
+            const FName expected = FName::Find(MakeLabel("Concurrent.", name).ToView());
+            REQUIRE(!expected.IsNone());
+            REQUIRE(results[thread][index] == expected);
+            REQUIRE(expected.ToView() == MakeLabel("Concurrent.", name).ToView());
+        }
+    }
+}
+
+BENCHMARK_CASE("Container.Name.Benchmark") {
+    constexpr u32 kLabels = 256U;
+    constexpr u32 kRounds = 2000U;
+
+    // Short strings stay inline: building and copying them does not touch the heap.
+    u64 allocations = HeapAllocations();
+    {
+        TVector<FString> labels;
+        labels.Reserve(kLabels);
+        for (u32 index = 0U; index < kLabels; ++index) {
+            labels.PushBack(MakeLabel("Pass.GBuffer.", index));
+        }
+        TVector<FString> copies = labels;
+        REQUIRE_EQ(copies.Size(), static_cast<usize>(kLabels));
+    }
+    allocations = HeapAllocations() - allocations;
+    std::cout << "[Bench][Name] heap allocations for " << kLabels
+              << " short labels built and copied: " << allocations << "\n";
+    REQUIRE_EQ(allocations, 2U); // the two vectors
+
+    // Equality and hashing: the string path walks characters, the name path compares handles.
+    TVector<FString> strings;
+    TVector<FName>   names;
+    for (u32 index = 0U; index < kLabels; ++index) {
+        strings.PushBack(MakeLabel("PostProcess.Effect.Parameter.", index));
+        names.PushBack(FName(strings.Back().ToView()));
+    }
+    const FString targetString = MakeLabel("PostProcess.Effect.Parameter.", kLabels - 1U);
+    const FName   targetName(targetString.ToView());
+
+    usize        stringHits = 0U;
+    usize        nameHits   = 0U;
+    const auto   iterations = kRounds * kLabels;
+    const double stringNs   = MeasureNs(iterations, [&] {
+        for (u32 round = 0U; round < kRounds; ++round) {
+            for (const FString& value : strings) {
+                stringHits += (value == targetString) ? 1U : 0U;
+            }
+        }
+    });
+    const double nameNs = MeasureNs(iterations, [&] {
+        for (u32 round = 0U; round < kRounds; ++round) {
+            for (const FName value : names) {
+                nameHits += (value == targetName) ? 1U : 0U;
+            }
+        }
+    });
+
+    THashMap<FString, u32> stringMap;
+    THashMap<FName, u32>   nameMap;
+    for (u32 index = 0U; index < kLabels; ++index) {
+        stringMap[strings[index]] = index;
+        nameMap[names[index]]     = index;
+    }
+    usize        lookupSum      = 0U;
+    const double stringLookupNs = MeasureNs(iterations, [&] {
+        for (u32 round = 0U; round < kRounds; ++round) {
+            for (const FString& value : strings) {
+                lookupSum += stringMap.FindIt(value)->second;
+            }
+        }
+    });
+    const double nameLookupNs = MeasureNs(iterations, [&] {
+        for (u32 round = 0U; round < kRounds; ++round) {
+            for (const FName value : names) {
+                lookupSum += nameMap.FindIt(value)->second;
+            }
+        }
+    });
+
+    std::cout << "[Bench][Name] compare per op: FString " << stringNs << " ns, FName " << nameNs
+              << " ns; map lookup per op: FString " << stringLookupNs << " ns, FName "
+              << nameLookupNs << " ns\n";
+    REQUIRE_EQ(stringHits, static_cast<usize>(kRounds));
+    REQUIRE_EQ(nameHits, static_cast<usize>(kRounds));
+    REQUIRE(lookupSum > 0U);
+}
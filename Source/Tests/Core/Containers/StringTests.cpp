@@ -2,6 +2,7 @@
 
 #include "Container/String.h"
 #include "Container/StringView.h"
+#include "Platform/PlatformMemory.h"
 #include <unordered_map>
 #include <unordered_set>
 
@@ -142,3 +143,52 @@ TEST_CASE("TBasicString number append and hashing") {
     set.insert(FNativeStringView("beta"));
     REQUIRE(set.find(FNativeStringView("beta")) != set.end());
 }
+
+TEST_CASE("TBasicString inline storage and heap transition") {
+    using AltinaEngine::u64;
+    using AltinaEngine::usize;
+    using AltinaEngine::Core::Platform::EMemoryTag;
+    using AltinaEngine::Core::Platform::GetMemoryTagStats;
+    const auto heapAllocations = [] {
+        return GetMemoryTagStats(EMemoryTag::Default).mTotalAllocations;
+    };
+    REQUIRE_EQ(sizeof(FNativeString), 32U);
+
+    const u64     before = heapAllocations();
+    FNativeString shortText("Engine.RenderFrame");
+    FNativeString copy(shortText);
+    FNativeString moved(AltinaEngine::Move(copy));
+    shortText.Append(".Pass");
+    REQUIRE(shortText.IsInline());
+    REQUIRE(moved == FNativeStringView("Engine.RenderFrame"));
+    REQUIRE(copy.IsEmptyString());
+    REQUIRE_EQ(heapAllocations(), before);
+
+    // Growing past the inline buffer moves the contents, including an aliased tail, to the heap.
+    FNativeString text("0123456789abcdef0123");
+    text.Append(text.SubstrView(10U, 10U));
+    REQUIRE(!text.IsInline());
+    REQUIRE(text == FNativeStringView("0123456789abcdef0123abcdef0123"));
+    REQUIRE_EQ(text.CStr()[text.Length()], '\0');
+
+    const char*   heapData = text.GetData();
+    FNativeString stolen(AltinaEngine::Move(text));
+    REQUIRE(stolen.GetData() == heapData);
+    REQUIRE(text.IsInline());
+    REQUIRE_EQ(text.Length(), 0U);
+
+    stolen.Assign(stolen.SubstrView(20U, 4U));
+    REQUIRE(stolen == FNativeStringView("abcd"));
+    stolen.Resize(6U);
+    REQUIRE_EQ(stolen.Length(), 6U);
+    REQUIRE_EQ(stolen[5], '\0');
+    stolen.PopBack();
+    stolen.Clear();
+    REQUIRE(stolen.IsEmptyString());
+    REQUIRE_EQ(stolen.CStr()[0], '\0');
+    for (usize index = 0U; index < 100U; ++index) {
+        stolen.PushBack(static_cast<char>('a' + index % 26U));
+    }
+    REQUIRE_EQ(stolen.Length(), 100U);
+    REQUIRE_EQ(stolen.Back(), 'v');
+}
@@ -0,0 +1,355 @@
+#include "TestHarness.h"
+
+#include "Container/HashMap.h"
+#include "Container/RobinHoodHashMap.h"
+#include "Container/String.h"
+#include "Container/SwissHashMap.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace AltinaEngine;
+using namespace AltinaEngine::Core::Container;
+
+namespace {
+    struct FCollisionHash {
+        auto operator()(i32 value) const -> usize { return static_cast<usize>(value & 3); }
+    };
+
+    template <typename Func> auto MeasureNs(usize iterations, Func&& func) -> double {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count()
+            / static_cast<double>(iterations);
+    }
+
+    // Reflection: type hash -> metadata record, plus a small property table per type.
+    struct FBenchTypeInfo {
+        u64  TypeHash = 0ULL;
+        u64  Size     = 0ULL;
+        u64  Flags[10]{};
+        bool bPolymorphic = false;
+    };
+
+    template <template <typename, typename, typename, typename> class TMap>
+    auto RunReflectionWorkload(u32 rounds, u64& checksum) -> double {
+        constexpr u32 kTypes      = 4096U;
+        constexpr u32 kProperties = 12U;
+        using FRegistry  = TMap<u64, FBenchTypeInfo, THashFunc<u64>, TEqual<u64>>;
+        using FPropTable = TMap<u64, u32, THashFunc<u64>, TEqual<u64>>;
+
+        std::mt19937_64  rng(42ULL);
+        std::vector<u64> typeHashes(kTypes);
+        FRegistry        registry;
+        std::vector<FPropTable> properties(kTypes);
+        for (u32 i = 0U; i < kTypes; ++i) {
+            typeHashes[i]     = rng();
+            auto& info        = registry[typeHashes[i]];
+            info.TypeHash     = typeHashes[i];
+            info.Size         = i;
+            info.bPolymorphic = (i & 1U) != 0U;
+            for (u32 p = 0U; p < kProperties; ++p) {
+                properties[i][typeHashes[i] ^ (p * 0x9e3779b9ULL)] = p;
+            }
+        }
+
+        // Resolve type -> property, with one miss in eight (unregistered RTTI lookups).
+        std::vector<u32> order(kTypes);
+        for (u32 i = 0U; i < kTypes; ++i) {
+            order[i] = static_cast<u32>(rng() % kTypes);
+        }
+        const usize ops = static_cast<usize>(rounds) * kTypes * 2U;
+        return MeasureNs(ops, [&] {
+            for (u32 round = 0U; round < rounds; ++round) {
+                for (u32 i = 0U; i < kTypes; ++i) {
+                    const u64 hash = ((i & 7U) == 0U) ? ~typeHashes[order[i]]
+                                                      : typeHashes[order[i]];
+                    const FBenchTypeInfo* info = registry.Find(hash);
+                    if (info == nullptr) {
+                        ++checksum;
+                        continue;
+                    }
+                    const u32* prop = properties[order[i]].Find(
+                        info->TypeHash ^ ((round % kProperties) * 0x9e3779b9ULL));
+                    checksum += info->Size + ((prop != nullptr) ? *prop : 0U);
+                }
+            }
+        });
+    }
+
+    // Component storage: generational component id -> dense index, with per-frame churn.
+    struct FBenchComponentId {
+        u32 Index      = 0U;
+        u32 Generation = 0U;
+        u64 Type       = 0ULL;
+
+        [[nodiscard]] auto operator==(const FBenchComponentId& rhs) const -> bool {
+            return Index == rhs.Index && Generation == rhs.Generation && Type == rhs.Type;
+        }
+    };
+
+    struct FBenchComponentIdHash {
+        auto operator()(const FBenchComponentId& id) const -> usize {
+            u64 seed = id.Type;
+            seed ^= static_cast<u64>(id.Index) + 0x9e3779b97f4a7c15ULL + (seed << 6U)
+                + (seed >> 2U);
+            seed ^= static_cast<u64>(id.Generation) + 0x9e3779b97f4a7c15ULL + (seed << 6U)
+                + (seed >> 2U);
+            return static_cast<usize>(seed);
+        }
+    };
+
+    template <template <typename, typename, typename, typename> class TMap>
+    auto RunComponentWorkload(u32 frames, u64& checksum) -> double {
+        constexpr u32 kComponents = 65536U;
+        constexpr u32 kChurn      = kComponents / 16U;
+        using FMap = TMap<FBenchComponentId, u32, FBenchComponentIdHash, TEqual<FBenchComponentId>>;
+
+        std::vector<FBenchComponentId> ids(kComponents);
+        FMap                           map;
+        for (u32 i = 0U; i < kComponents; ++i) {
+            ids[i] = { i, 1U, 0x51ed270b27f1a6d3ULL + (i % 7U) };
+            map.Emplace(ids[i], i);
+        }
+
+        std::mt19937 rng(7U);
+        const usize  ops = static_cast<usize>(frames) * (kComponents + 2U * kChurn);
+        return MeasureNs(ops, [&] {
+            for (u32 frame = 0U; frame < frames; ++frame) {
+                // Destroy and respawn a slice of components with a bumped generation.
+                for (u32 c = 0U; c < kChurn; ++c) {
+                    FBenchComponentId& id = ids[rng() % kComponents];
+                    map.Remove(id);
+                    ++id.Generation;
+                    map.Emplace(id, id.Index);
+                }
+                for (u32 i = 0U; i < kComponents; ++i) {
+                    const u32* dense = map.Find(ids[(i * 2654435761U) % kComponents]);
+                    checksum += (dense != nullptr) ? *dense : 0U;
+                }
+            }
+        });
+    }
+
+    // Job state: monotonically increasing handles live for a short window, so the map sees
+    // continuous insert/lookup/erase of fresh keys.
+    struct FBenchJobState {
+        u32 State        = 0U;
+        u32 Dependencies = 0U;
+        u64 Continuation = 0ULL;
+    };
+
+    template <template <typename, typename, typename, typename> class TMap>
+    auto RunJobWorkload(u32 jobs, u64& checksum) -> double {
+        constexpr u64 kInFlight = 2048ULL;
+        using FMap              = TMap<u64, FBenchJobState, THashFunc<u64>, TEqual<u64>>;
+
+        FMap map;
+        return MeasureNs(static_cast<usize>(jobs) * 4U, [&] {
+            for (u64 handle = 1ULL; handle <= jobs; ++handle) {
+                map.Emplace(handle, FBenchJobState{ 1U, static_cast<u32>(handle & 3U), handle });
+                if (handle > 1ULL) {
+                    if (FBenchJobState* parent = map.Find(handle - 1ULL)) {
+                        ++parent->Dependencies;
+                    }
+                }
+                if (handle > kInFlight) {
+                    const u64 done = handle - kInFlight;
+                    if (const FBenchJobState* state = map.Find(done)) {
+                        checksum += state->Dependencies;
+                    }
+                    map.Remove(done);
+                }
+            }
+        });
+    }
+} // namespace
+
+static_assert(CSameAs<THashMap<u64, u32>, TSwissHashMap<u64, u32>> == kHashMapUseSwissTable);
+
+TEST_CASE("TSwissHashMap - try emplace and find") {
+    TSwissHashMap<i32, i32> map;
+    REQUIRE(map.Find(7) == nullptr);
+    REQUIRE(map.begin() == map.end());
+
+    auto first = map.TryEmplace(7, 11);
+    REQUIRE(first.second);
+    REQUIRE(first.first != map.end());
+    REQUIRE(first.first->second == 11);
+
+    auto second = map.TryEmplace(7, 19);
+    REQUIRE(!second.second);
+    REQUIRE(second.first->second == 11);
+
+    REQUIRE(map.Num() == 1);
+    REQUIRE(map.Contains(7));
+    REQUIRE(!map.Contains(8));
+    map[8] = 3;
+    REQUIRE(map.At(8) == 3);
+}
+
+TEST_CASE("TSwissHashMap - colliding keys and tombstones") {
+    TSwissHashMap<i32, i32, FCollisionHash> map;
+
+    // Every key shares one of four hashes, so they all compete for the same control tags.
+    for (i32 i = 0; i < 200; ++i) {
+        REQUIRE(map.Emplace(i, i * 10).second);
+    }
+    for (i32 i = 0; i < 200; i += 3) {
+        REQUIRE(map.Remove(i));
+        REQUIRE(!map.Remove(i));
+    }
+    for (i32 i = 0; i < 200; ++i) {
+        i32* found = map.Find(i);
+        REQUIRE((found == nullptr) == (i % 3 == 0));
+        if (found != nullptr) {
+            REQUIRE(*found == i * 10);
+        }
+    }
+
+    // Tombstones are reused and the map keeps working after a same-size rehash.
+    for (i32 i = 0; i < 200; i += 3) {
+        REQUIRE(map.Emplace(i, -i).second);
+    }
+    REQUIRE(map.Num() == 200);
+    map.Rehash(0);
+    for (i32 i = 0; i < 200; ++i) {
+        REQUIRE(map.At(i) == ((i % 3 == 0) ? -i : i * 10));
+    }
+}
+
+TEST_CASE("TSwissHashMap - max load factor applies to a filled table") {
+    TSwissHashMap<i32, i32> map;
+    for (i32 i = 0; i < 100; ++i) {
+        REQUIRE(map.Emplace(i, i).second);
+    }
+    for (i32 i = 0; i < 100; i += 4) {
+        REQUIRE(map.Remove(i));
+    }
+
+    // Lowering the limit below the current load rehashes right away.
+    map.SetMaxLoadFactor(0.25F);
+    REQUIRE(map.LoadFactor() <= 0.25F);
+    for (i32 i = 100; i < 300; ++i) {
+        REQUIRE(map.Emplace(i, i).second);
+        REQUIRE(map.LoadFactor() <= 0.25F);
+    }
+
+    // Raising it lets the same table fill further before it grows.
+    map.SetMaxLoadFactor(0.75F);
+    const f32 before = map.LoadFactor();
+    for (i32 i = 300; i < 500; ++i) {
+        REQUIRE(map.Emplace(i, i).second);
+    }
+    REQUIRE(map.LoadFactor() > before);
+    REQUIRE(map.LoadFactor() <= 0.75F);
+
+    for (i32 i = 0; i < 500; ++i) {
+        const i32* found = map.Find(i);
+        REQUIRE((found == nullptr) == (i < 100 && i % 4 == 0));
+    }
+}
+
+TEST_CASE("TSwissHashMap - iteration, erase by iterator and copies") {
+    TSwissHashMap<u32, FString> map;
+    for (u32 i = 0U; i < 100U; ++i) {
+        FString text(TEXT("entry-with-a-heap-allocated-name-"));
+        text.PushBack(static_cast<TChar>('0' + (i % 10U)));
+        map.InsertOrAssign(i, text);
+    }
+
+    u32 visited = 0U;
+    for (auto it = map.begin(); it != map.end();) {
+        ++visited;
+        it = ((it->first & 1U) != 0U) ? map.Erase(it) : ++it;
+    }
+    REQUIRE(visited == 100U);
+    REQUIRE(map.Num() == 50U);
+
+    TSwissHashMap<u32, FString> copy(map);
+    TSwissHashMap<u32, FString> moved(Move(map));
+    REQUIRE(map.IsEmpty());
+    REQUIRE(copy.Num() == 50U);
+    REQUIRE(moved.Num() == 50U);
+    for (const auto& [key, value] : copy) {
+        REQUIRE((key & 1U) == 0U);
+        REQUIRE(moved.At(key) == value);
+    }
+    copy.Clear();
+    REQUIRE(copy.IsEmpty());
+    REQUIRE(copy.FindIt(0U) == copy.end());
+}
+
+TEST_CASE("TSwissHashMap - randomized parity with unordered_map") {
+    TSwissHashMap<u64, u32>            map;
+    std::unordered_map<u64, u32>       oracle;
+
+    std::mt19937_64                    rng(123456789ULL);
+    std::uniform_int_distribution<u64> keyDist(0ULL, 4095ULL);
+    std::uniform_int_distribution<u32> valDist(0U, 0xFFFFU);
+    std::uniform_int_distribution<u32> opDist(0U, 99U);
+
+    for (u32 step = 0U; step < 100000U; ++step) {
+        const u32 op  = opDist(rng);
+        const u64 key = keyDist(rng);
+
+        if (op < 45U) {
+            const u32 value       = valDist(rng);
+            auto [itA, insertedA] = map.InsertOrAssign(key, value);
+            auto [itB, insertedB] = oracle.insert_or_assign(key, value);
+            REQUIRE(insertedA == insertedB);
+            REQUIRE(itA != map.end());
+            REQUIRE(itA->second == itB->second);
+        } else if (op < 70U) {
+            REQUIRE(map.Erase(key) == oracle.erase(key));
+        } else if (op < 90U) {
+            auto itA = map.FindIt(key);
+            auto itB = oracle.find(key);
+            REQUIRE((itA == map.end()) == (itB == oracle.end()));
+            if (itA != map.end() && itB != oracle.end()) {
+                REQUIRE(itA->second == itB->second);
+            }
+        } else if (op < 95U) {
+            map.Clear();
+            oracle.clear();
+        } else {
+            map.Reserve(static_cast<usize>(keyDist(rng)));
+        }
+
+        REQUIRE(map.Num() == oracle.size());
+        if ((step % 64U) == 0U) {
+            usize iterated = 0U;
+            for (const auto& entry : map) {
+                ++iterated;
+                REQUIRE(oracle.at(entry.first) == entry.second);
+            }
+            REQUIRE(iterated == oracle.size());
+        }
+    }
+}
+
+BENCHMARK_CASE("TSwissHashMap - Benchmark") {
+    u64 swissSum = 0ULL;
+    u64 robinSum = 0ULL;
+
+    const double reflectionRobin = RunReflectionWorkload<TRobinHoodHashMap>(64U, robinSum);
+    const double reflectionSwiss = RunReflectionWorkload<TSwissHashMap>(64U, swissSum);
+    std::cout << "[Bench][HashMap] reflection lookup per op: RobinHood " << reflectionRobin
+              << " ns, Swiss " << reflectionSwiss << " ns\n";
+
+    const double componentRobin = RunComponentWorkload<TRobinHoodHashMap>(32U, robinSum);
+    const double componentSwiss = RunComponentWorkload<TSwissHashMap>(32U, swissSum);
+    std::cout << "[Bench][HashMap] component storage per op: RobinHood " << componentRobin
+              << " ns, Swiss " << componentSwiss << " ns\n";
+
+    const double jobRobin = RunJobWorkload<TRobinHoodHashMap>(1U << 20U, robinSum);
+    const double jobSwiss = RunJobWorkload<TSwissHashMap>(1U << 20U, swissSum);
+    std::cout << "[Bench][HashMap] job state churn per op: RobinHood " << jobRobin
+              << " ns, Swiss " << jobSwiss << " ns\n";
+
+    REQUIRE(swissSum == robinSum);
+}
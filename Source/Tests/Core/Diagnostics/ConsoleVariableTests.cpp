@@ -66,3 +66,21 @@ TEST_CASE("ConsoleVariable: render thread latch") {
     immediate->Set(11);
     REQUIRE_EQ(immediate->GetRenderValue<int>(), 11);
 }
+
+TEST_CASE("ConsoleVariable: names that cannot be interned are rejected") {
+    // Such a name resolves to None; registering it would share one registry key with every
+    // other rejected name.
+    FString oversized;
+    for (int index = 0; index < 70000; ++index) {
+        oversized.PushBack(TEXT('a'));
+    }
+    int before = 0;
+    FConsoleVariable::ForEach([&](const FConsoleVariable&) { ++before; });
+
+    REQUIRE(FConsoleVariable::Register(oversized.CStr(), 1) == nullptr);
+    REQUIRE(FConsoleVariable::Find(oversized) == nullptr);
+
+    int after = 0;
+    FConsoleVariable::ForEach([&](const FConsoleVariable&) { ++after; });
+    REQUIRE_EQ(after, before);
+}
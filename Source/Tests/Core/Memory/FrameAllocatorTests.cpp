@@ -0,0 +1,153 @@
+#include "TestHarness.h"
+
+#include "Memory/FrameAllocator.h"
+#include "Platform/PlatformMemory.h"
+
+#include <thread>
+
+namespace {
+    using AltinaEngine::u32;
+    using AltinaEngine::u64;
+    using AltinaEngine::usize;
+    using AltinaEngine::Core::Memory::FFrameArena;
+    using AltinaEngine::Core::Memory::FFrameMemory;
+    using AltinaEngine::Core::Memory::TFrameAllocator;
+    using AltinaEngine::Core::Memory::TFrameVector;
+    using AltinaEngine::Core::Platform::EMemoryTag;
+    using AltinaEngine::Core::Platform::GetMemoryTagStats;
+
+    auto HeapAllocations() -> u64 {
+        return GetMemoryTagStats(EMemoryTag::Default).mTotalAllocations;
+    }
+
+    auto IsAligned(const void* ptr, usize alignment) -> bool {
+        return (reinterpret_cast<usize>(ptr) & (alignment - 1U)) == 0U;
+    }
+} // namespace
+
+TEST_CASE("Memory.FrameArena.AllocateAndReset") {
+    FFrameArena arena(1024U);
+    REQUIRE(arena.Allocate(0U, 8U) == nullptr);
+    REQUIRE(arena.Allocate(8U, 3U) == nullptr);
+
+    auto* first  = static_cast<char*>(arena.Allocate(24U, 8U));
+    auto* second = static_cast<char*>(arena.Allocate(40U, 64U));
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+    REQUIRE(IsAligned(second, 64U));
+    REQUIRE(second >= first + 24);
+    REQUIRE_EQ(arena.GetChunkCount(), 1U);
+
+    // Blocks larger than a chunk get a chunk of their own.
+    void* large = arena.Allocate(4096U, 16U);
+    REQUIRE(large != nullptr);
+    REQUIRE_EQ(arena.GetChunkCount(), 2U);
+
+    // A frame that spilled is served from one larger chunk afterwards, without new heap traffic
+    // once that chunk exists.
+    arena.Reset();
+    REQUIRE_EQ(arena.GetUsedBytes(), 0U);
+    REQUIRE_EQ(arena.GetChunkCount(), 0U);
+    for (u32 frame = 0U; frame < 3U; ++frame) {
+        const u64 before = HeapAllocations();
+        REQUIRE(arena.Allocate(24U, 8U) != nullptr);
+        REQUIRE(arena.Allocate(40U, 64U) != nullptr);
+        REQUIRE(arena.Allocate(4096U, 16U) != nullptr);
+        REQUIRE_EQ(arena.GetChunkCount(), 1U);
+        REQUIRE_EQ(HeapAllocations() - before, (frame == 0U) ? 1U : 0U);
+        arena.Reset();
+    }
+
+    arena.Release();
+    REQUIRE_EQ(arena.GetReservedBytes(), 0U);
+}
+
+TEST_CASE("Memory.FrameArena.ChunksDoubleWithinAFrame") {
+    FFrameArena arena(1024U);
+    for (u32 index = 0U; index < 4U; ++index) {
+        REQUIRE(arena.Allocate(960U, 16U) != nullptr);
+    }
+    REQUIRE_EQ(arena.GetChunkCount(), 3U);
+    REQUIRE_EQ(arena.GetReservedBytes(), static_cast<usize>(1024U + 2048U + 4096U));
+
+    // The next frame starts from the learned size again, not from the last doubled chunk.
+    arena.Reset();
+    REQUIRE(arena.Allocate(16U, 16U) != nullptr);
+    REQUIRE_EQ(arena.GetReservedBytes(), static_cast<usize>(7U * 1024U));
+
+    arena.Release();
+    arena.GrowChunkSize(8192U);
+    REQUIRE(arena.Allocate(16U, 16U) != nullptr);
+    REQUIRE_EQ(arena.GetReservedBytes(), static_cast<usize>(8192U));
+}
+
+TEST_CASE("Memory.FrameAllocator.DoubleBuffered") {
+    FFrameMemory::ShutdownThread();
+    REQUIRE(FFrameMemory::GetThreadArena() == nullptr);
+
+    FFrameMemory::BeginFrame();
+    FFrameArena* frameA = FFrameMemory::GetThreadArena();
+    REQUIRE(frameA != nullptr);
+    REQUIRE(TFrameAllocator<u32>() == TFrameAllocator<u32>(frameA));
+    auto* previous = static_cast<u32*>(frameA->Allocate(sizeof(u32), alignof(u32)));
+    *previous      = 0xC0FFEEU;
+
+    // The next frame uses the other arena, so the block of the previous frame is still intact.
+    FFrameMemory::BeginFrame();
+    FFrameArena* frameB = FFrameMemory::GetThreadArena();
+    REQUIRE(frameB != frameA);
+    REQUIRE(frameB->Allocate(256U, 16U) != nullptr);
+    REQUIRE_EQ(*previous, 0xC0FFEEU);
+
+    // Two frames later the first arena is rewound and hands out the same memory again.
+    FFrameMemory::BeginFrame();
+    REQUIRE(FFrameMemory::GetThreadArena() == frameA);
+    REQUIRE_EQ(frameA->GetUsedBytes(), 0U);
+    REQUIRE(frameA->Allocate(sizeof(u32), alignof(u32)) == previous);
+    REQUIRE_EQ(FFrameMemory::GetThreadFrameCount(), 3U);
+
+    FFrameMemory::ShutdownThread();
+    REQUIRE_EQ(FFrameMemory::GetThreadFrameCount(), 0U);
+}
+
+TEST_CASE("Memory.FrameAllocator.VectorSteadyStateSkipsHeap") {
+    FFrameMemory::ShutdownThread();
+    u64 lastFrameAllocations = 0U;
+    for (u32 frame = 0U; frame < 8U; ++frame) {
+        FFrameMemory::BeginFrame();
+        const u64         before = HeapAllocations();
+
+        TFrameVector<u32> values;
+        for (u32 index = 0U; index < 100000U; ++index) {
+            values.PushBack(index);
+        }
+        TFrameVector<u64> copies;
+        copies.Reserve(values.Size());
+        for (const u32 value : values) {
+            copies.PushBack(value);
+        }
+        REQUIRE_EQ(values.Size(), 100000U);
+        REQUIRE_EQ(copies[99999U], 99999ULL);
+        lastFrameAllocations = HeapAllocations() - before;
+    }
+    REQUIRE_EQ(lastFrameAllocations, 0U);
+    FFrameMemory::ShutdownThread();
+}
+
+TEST_CASE("Memory.FrameAllocator.HeapFallbackWithoutFrames") {
+    // Threads that never begin a frame get ordinary heap blocks, freed with the container.
+    bool fallback = false;
+    u32  sum      = 0U;
+    std::thread([&] {
+        fallback = TFrameAllocator<u32>().GetArena() == nullptr;
+        TFrameVector<u32> values;
+        for (u32 index = 0U; index < 1000U; ++index) {
+            values.PushBack(index);
+        }
+        for (const u32 value : values) {
+            sum += value;
+        }
+    }).join();
+    REQUIRE(fallback);
+    REQUIRE_EQ(sum, 499500U);
+}
@@ -0,0 +1,235 @@
+#include "TestHarness.h"
+
+#include "Platform/PlatformMemory.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+    using AltinaEngine::u32;
+    using AltinaEngine::u64;
+    using AltinaEngine::u8;
+    using AltinaEngine::usize;
+    using AltinaEngine::Core::Platform::EMemoryTag;
+    using AltinaEngine::Core::Platform::FMemoryAllocator;
+    using AltinaEngine::Core::Platform::FMemoryTagStats;
+    using AltinaEngine::Core::Platform::FScopedMemoryTag;
+    using AltinaEngine::Core::Platform::GetCurrentMemoryTag;
+    using AltinaEngine::Core::Platform::GetGlobalMemoryAllocator;
+    using AltinaEngine::Core::Platform::GetMemoryTagStats;
+
+    void FillPattern(void* ptr, usize size, u32 seed) {
+        auto* bytes = static_cast<u8*>(ptr);
+        for (usize index = 0U; index < size; ++index) {
+            bytes[index] = static_cast<u8>((index * 31U) ^ seed);
+        }
+    }
+
+    auto CheckPattern(const void* ptr, usize size, u32 seed) -> bool {
+        const auto* bytes = static_cast<const u8*>(ptr);
+        for (usize index = 0U; index < size; ++index) {
+            if (bytes[index] != static_cast<u8>((index * 31U) ^ seed)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto IsAligned(const void* ptr, usize alignment) -> bool {
+        return (reinterpret_cast<usize>(ptr) & (alignment - 1U)) == 0U;
+    }
+
+    struct FChurnAllocator {
+        virtual ~FChurnAllocator()                = default;
+        virtual auto Allocate(usize size) -> void* = 0;
+        virtual void Free(void* ptr)               = 0;
+    };
+
+    struct FEngineChurnAllocator final : FChurnAllocator {
+        FMemoryAllocator* mAllocator = GetGlobalMemoryAllocator();
+        auto Allocate(usize size) -> void* override { return mAllocator->MemoryAllocate(size, 0U); }
+        void Free(void* ptr) override { mAllocator->MemoryFree(ptr); }
+    };
+
+    struct FSystemChurnAllocator final : FChurnAllocator {
+        auto Allocate(usize size) -> void* override { return std::malloc(size); }
+        void Free(void* ptr) override { std::free(ptr); }
+    };
+
+    // Keeps a window of live blocks and replaces a pseudo-random one per iteration, which is
+    // roughly what container-heavy frame code does. Sizes are mostly small, some up to 64 KiB.
+    void RunChurn(FChurnAllocator& allocator, u32 iterations, u32 seed) {
+        constexpr u32      kWindow = 1024U;
+        std::vector<void*> live(kWindow, nullptr);
+        u32                state = seed;
+        for (u32 iteration = 0U; iteration < iterations; ++iteration) {
+            state            = state * 1664525U + 1013904223U;
+            const u32  slot  = (state >> 8U) % kWindow;
+            const u32  shape = state >> 28U;
+            const usize size = (shape == 0U) ? (4096U + (state & 0xffffU))
+                                             : (16U + ((state >> 4U) & 0x1ffU));
+            allocator.Free(live[slot]);
+            live[slot] = allocator.Allocate(size);
+            static_cast<u8*>(live[slot])[0] = static_cast<u8>(iteration);
+        }
+        for (void* ptr : live) {
+            allocator.Free(ptr);
+        }
+    }
+
+    // Total allocations per second over `threadCount` threads.
+    auto MeasureChurn(FChurnAllocator& allocator, u32 threadCount, u32 iterations) -> double {
+        const auto               start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (u32 index = 0U; index < threadCount; ++index) {
+            threads.emplace_back(
+                [&allocator, iterations, index] { RunChurn(allocator, iterations, index + 1U); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        const double seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return static_cast<double>(threadCount) * iterations / seconds;
+    }
+} // namespace
+
+TEST_CASE("Memory.Allocator.AlignedReallocKeepsContents") {
+    FMemoryAllocator* allocator = GetGlobalMemoryAllocator();
+    const usize       alignments[] = { 0U, 16U, 64U, 256U, 4096U, 256U * 1024U };
+    const usize       sizes[]      = { 24U, 700U, 30000U, 100000U, 3U * 1024U * 1024U };
+
+    u32 seed = 1U;
+    for (const usize alignment : alignments) {
+        const usize expectedAlignment = (alignment == 0U) ? 16U : alignment;
+        for (const usize from : sizes) {
+            for (const usize to : sizes) {
+                void* block = allocator->MemoryAllocate(from, alignment);
+                REQUIRE(block != nullptr);
+                REQUIRE(IsAligned(block, expectedAlignment));
+                FillPattern(block, from, seed);
+
+                void* moved = allocator->MemoryReallocate(block, to, alignment);
+                REQUIRE(moved != nullptr);
+                REQUIRE(IsAligned(moved, expectedAlignment));
+                REQUIRE(CheckPattern(moved, (from < to) ? from : to, seed));
+                FillPattern(moved, to, seed + 1U);
+                REQUIRE(CheckPattern(moved, to, seed + 1U));
+                allocator->MemoryFree(moved);
+                ++seed;
+            }
+        }
+    }
+
+    REQUIRE(allocator->MemoryAllocate(0U, 16U) == nullptr);
+    REQUIRE(allocator->MemoryReallocate(allocator->MemoryAllocate(8U, 8U), 0U, 8U) == nullptr);
+}
+
+TEST_CASE("Memory.Allocator.TagStats") {
+    FMemoryAllocator*     allocator = GetGlobalMemoryAllocator();
+    const FMemoryTagStats before    = GetMemoryTagStats(EMemoryTag::Tools);
+    const usize           sizes[]   = { 8U, 100U, 5000U, 200000U };
+
+    std::vector<void*> blocks;
+    {
+        FScopedMemoryTag tag(EMemoryTag::Tools);
+        REQUIRE(GetCurrentMemoryTag() == EMemoryTag::Tools);
+        for (const usize size : sizes) {
+            blocks.push_back(allocator->MemoryAllocate(size, 0U));
+        }
+    }
+    REQUIRE(GetCurrentMemoryTag() == EMemoryTag::Default);
+
+    const FMemoryTagStats during = GetMemoryTagStats(EMemoryTag::Tools);
+    REQUIRE_EQ(during.mLiveAllocations, before.mLiveAllocations + 4U);
+    REQUIRE_EQ(during.mTotalAllocations, before.mTotalAllocations + 4U);
+    REQUIRE(during.mLiveBytes >= before.mLiveBytes + 8U + 100U + 5000U + 200000U);
+
+    // Reallocation keeps the tag even outside the scope; frees from another thread are charged
+    // back to it as well.
+    blocks[0] = allocator->MemoryReallocate(blocks[0], 64000U, 0U);
+    REQUIRE_EQ(GetMemoryTagStats(EMemoryTag::Tools).mLiveAllocations, during.mLiveAllocations);
+    std::thread([&] {
+        for (void* block : blocks) {
+            allocator->MemoryFree(block);
+        }
+    }).join();
+
+    const FMemoryTagStats after = GetMemoryTagStats(EMemoryTag::Tools);
+    REQUIRE_EQ(after.mLiveAllocations, before.mLiveAllocations);
+    REQUIRE_EQ(after.mLiveBytes, before.mLiveBytes);
+    REQUIRE_EQ(after.mTotalAllocations, before.mTotalAllocations + 5U);
+}
+
+TEST_CASE("Memory.Allocator.CrossThreadFree") {
+    constexpr u32     kThreads = 4U;
+    constexpr u32     kBlocks  = 20000U;
+    FMemoryAllocator* allocator = GetGlobalMemoryAllocator();
+    const u64         before    = GetMemoryTagStats(EMemoryTag::Default).mLiveAllocations;
+
+    // Each thread allocates a batch and frees the batch of its neighbour, so every span sees
+    // remote frees, and spans of exited threads get adopted by the survivors.
+    std::vector<std::vector<void*>> batches(kThreads);
+    std::vector<char>               intact(kThreads, 1);
+    for (u32 round = 0U; round < 3U; ++round) {
+        std::vector<std::thread> threads;
+        for (u32 index = 0U; index < kThreads; ++index) {
+            threads.emplace_back([&, index] {
+                std::vector<void*>& batch = batches[index];
+                for (u32 block = 0U; block < kBlocks; ++block) {
+                    const usize size = 16U + (block * 7U + index) % 2000U;
+                    void*       ptr  = allocator->MemoryAllocate(size, 0U);
+                    FillPattern(ptr, 16U, block);
+                    batch.push_back(ptr);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        threads.clear();
+
+        for (u32 index = 0U; index < kThreads; ++index) {
+            threads.emplace_back([&, index] {
+                std::vector<void*>& batch = batches[(index + 1U) % kThreads];
+                for (u32 block = 0U; block < batch.size(); ++block) {
+                    if (!CheckPattern(batch[block], 16U, block)) {
+                        intact[index] = 0;
+                    }
+                    allocator->MemoryFree(batch[block]);
+                }
+                batch.clear();
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    for (const char ok : intact) {
+        REQUIRE(ok != 0);
+    }
+    REQUIRE_EQ(GetMemoryTagStats(EMemoryTag::Default).mLiveAllocations, before);
+}
+
+BENCHMARK_CASE("Memory.Allocator.Benchmark") {
+    constexpr u32         kIterations = 2000000U;
+    FEngineChurnAllocator engine{};
+    FSystemChurnAllocator system{};
+
+    const double engineSingle = MeasureChurn(engine, 1U, kIterations);
+    const double systemSingle = MeasureChurn(system, 1U, kIterations);
+    const double engineMulti  = MeasureChurn(engine, 4U, kIterations / 4U);
+    const double systemMulti  = MeasureChurn(system, 4U, kIterations / 4U);
+
+    std::cout << "[Bench][MemoryAllocator] churn alloc+free per second: 1 thread engine="
+              << engineSingle / 1.0e6 << " M, malloc=" << systemSingle / 1.0e6
+              << " M; 4 threads engine=" << engineMulti / 1.0e6
+              << " M, malloc=" << systemMulti / 1.0e6 << " M\n";
+    REQUIRE(engineSingle > 0.0);
+    REQUIRE(systemSingle > 0.0);
+}
@@ -66,3 +66,78 @@ TEST_CASE("Reflection.Serialization.Json.Point2D") {
     REQUIRE(result.mX == original.mX);
     REQUIRE(result.mY == original.mY);
 }
+
+TEST_CASE("Reflection.Serialization.Json.FieldLookupOrder") {
+    FJsonDeserializer deserializer;
+    REQUIRE(deserializer.SetText(FNativeStringView(
+        "{\"A\":1,\"Nested\":{\"X\":[4,5],\"Y\":6},\"B\":true,\"C\":2.5}")));
+
+    deserializer.BeginObject();
+    REQUIRE(deserializer.TryReadFieldName(TEXT("C")));
+    REQUIRE(deserializer.Read<f64>() == 2.5);
+    REQUIRE(deserializer.TryReadFieldName(TEXT("A")));
+    REQUIRE(deserializer.Read<i32>() == 1);
+    REQUIRE(!deserializer.TryReadFieldName(TEXT("Missing")));
+
+    REQUIRE(deserializer.TryReadFieldName(TEXT("Nested")));
+    deserializer.BeginObject();
+    REQUIRE(deserializer.TryReadFieldName(TEXT("Y")));
+    REQUIRE(deserializer.Read<u32>() == 6U);
+    REQUIRE(deserializer.TryReadFieldName(TEXT("X")));
+    usize count = 0;
+    deserializer.BeginArray(count);
+    REQUIRE(count == 2U);
+    REQUIRE(deserializer.Read<i32>() == 4);
+    deserializer.EndArray();
+    deserializer.EndObject();
+
+    REQUIRE(deserializer.TryReadFieldName(TEXT("B")));
+    REQUIRE(deserializer.Read<bool>());
+    deserializer.EndObject();
+
+    REQUIRE(!deserializer.SetText(FNativeStringView("{\"A\":}")));
+    REQUIRE(deserializer.GetError().Length() > 0U);
+}
+
+TEST_CASE("Reflection.Serialization.Json.FieldLookupRepeatsAndDuplicates") {
+    FJsonDeserializer deserializer;
+    REQUIRE(deserializer.SetText(FNativeStringView("{\"A\":1,\"B\":2,\"A\":3,\"C\":4}")));
+
+    deserializer.BeginObject();
+    REQUIRE(!deserializer.TryReadFieldName(TEXT("Missing")));
+    REQUIRE(!deserializer.TryReadFieldName(TEXT("Missing")));
+    REQUIRE(deserializer.TryReadFieldName(TEXT("C")));
+    REQUIRE(deserializer.Read<i32>() == 4);
+    REQUIRE(deserializer.TryReadFieldName(TEXT("A")));
+    REQUIRE(deserializer.Read<i32>() == 1);
+    REQUIRE(deserializer.TryReadFieldName(TEXT("A")));
+    REQUIRE(deserializer.Read<i32>() == 1);
+    REQUIRE(deserializer.TryReadFieldName(TEXT("B")));
+    REQUIRE(deserializer.Read<i32>() == 2);
+    deserializer.EndObject();
+}
+
+TEST_CASE("Reflection.Serialization.Json.FieldLookupEscapedKeys") {
+    // Keys are compared decoded, both while scanning and on later cached lookups.
+    FJsonDeserializer deserializer;
+    REQUIRE(deserializer.SetText(FNativeStringView(
+        "{\"\\u0041\":1,\"N\":{\"X\":2},"
+        "\"B\\u0042-0123456789-0123456789-0123456789\":3}")));
+
+    deserializer.BeginObject();
+    REQUIRE(deserializer.TryReadFieldName(TEXT("BB-0123456789-0123456789-0123456789")));
+    REQUIRE(deserializer.Read<i32>() == 3);
+
+    REQUIRE(deserializer.TryReadFieldName(TEXT("N")));
+    deserializer.BeginObject();
+    REQUIRE(deserializer.TryReadFieldName(TEXT("X")));
+    REQUIRE(deserializer.Read<i32>() == 2);
+    deserializer.EndObject();
+
+    REQUIRE(deserializer.TryReadFieldName(TEXT("A")));
+    REQUIRE(deserializer.Read<i32>() == 1);
+    REQUIRE(!deserializer.TryReadFieldName(TEXT("B\\u0042-0123456789-0123456789-0123456789")));
+    REQUIRE(deserializer.TryReadFieldName(TEXT("BB-0123456789-0123456789-0123456789")));
+    REQUIRE(deserializer.Read<i32>() == 3);
+    deserializer.EndObject();
+}
@@ -1,7 +1,10 @@
 #include "TestHarness.h"
 #include "../../Runtime/Core/Public/Instrumentation/Instrumentation.h"
 #include <cstring>
+#include <string>
+#include <thread>
 
+using namespace AltinaEngine;
 using namespace AltinaEngine::Core::Instrumentation;
 
 // Minimal tests using the project's test harness (matches TEST_CASE style in repository)
@@ -32,3 +35,73 @@ TEST_CASE("Instrumentation: ThreadName and Counters") {
     REQUIRE(count >= 1);
     REQUIRE(totalMs >= 0);
 }
+
+TEST_CASE("Instrumentation: trace capture exports nested scopes as Chrome JSON") {
+    SetCurrentThreadName("TraceMainThread");
+    REQUIRE(!BeginTraceScope("trace.before")); // no capture yet
+
+    BeginTraceCapture();
+    REQUIRE(IsTraceCaptureActive());
+    {
+        AE_TRACE_SCOPE("trace.outer");
+        {
+            AE_TRACE_SCOPE("trace.inner");
+        }
+        std::thread worker([]() {
+            SetCurrentThreadName("TraceWorker");
+            AE_TRACE_SCOPE("trace.worker");
+        });
+        worker.join();
+    }
+    EndTraceCapture();
+    REQUIRE(!IsTraceCaptureActive());
+
+    Core::Container::FNativeString json;
+    WriteChromeTrace(json);
+    const std::string text(json.GetData(), json.Length());
+
+    REQUIRE(text.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(text.find("\"trace.outer\"") != std::string::npos);
+    REQUIRE(text.find("\"trace.inner\"") != std::string::npos);
+    REQUIRE(text.find("\"trace.worker\"") != std::string::npos);
+    REQUIRE(text.find("\"TraceWorker\"") != std::string::npos);
+    REQUIRE(text.find("\"thread_name\"") != std::string::npos);
+    REQUIRE(text.find("\"trace.before\"") == std::string::npos);
+
+    // Every begin has a matching end.
+    usize begins = 0;
+    usize ends   = 0;
+    for (usize pos = text.find("\"ph\":\"B\""); pos != std::string::npos;
+         pos       = text.find("\"ph\":\"B\"", pos + 1))
+        ++begins;
+    for (usize pos = text.find("\"ph\":\"E\""); pos != std::string::npos;
+         pos       = text.find("\"ph\":\"E\"", pos + 1))
+        ++ends;
+    REQUIRE(begins >= 3);
+    REQUIRE_EQ(begins, ends);
+}
+
+TEST_CASE("Instrumentation: exited threads hand their trace buffer to the next thread") {
+    auto countThreads = []() -> usize {
+        Core::Container::FNativeString json;
+        WriteChromeTrace(json);
+        const std::string text(json.GetData(), json.Length());
+        usize             count = 0;
+        for (usize pos = text.find("\"thread_name\""); pos != std::string::npos;
+             pos       = text.find("\"thread_name\"", pos + 1))
+            ++count;
+        return count;
+    };
+
+    BeginTraceCapture();
+    // Warm up one buffer so a free one exists regardless of what earlier tests left behind.
+    std::thread([]() { AE_TRACE_SCOPE("trace.recycle.warmup"); }).join();
+    const usize before = countThreads();
+    for (int i = 0; i < 8; ++i) {
+        std::thread([]() { AE_TRACE_SCOPE("trace.recycle"); }).join();
+    }
+    const usize after = countThreads();
+    EndTraceCapture();
+
+    REQUIRE_EQ(after, before);
+}
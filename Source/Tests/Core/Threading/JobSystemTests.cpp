@@ -6,6 +6,7 @@
 #include <random>
 #include <algorithm>
 #include <utility>
+#include <thread>
 
 using namespace AltinaEngine::Core;
 
@@ -190,3 +191,41 @@ TEST_CASE("FJobDescriptor complex dependency graph") {
     FJobSystem::Wait(finalH);
     REQUIRE(finalOk);
 }
+
+TEST_CASE("FJobDescriptor deep dependency chain does not park workers") {
+    using namespace AltinaEngine::Core::Jobs;
+
+    // Submit the whole chain before any of it may run: the root waits on a gate job that is
+    // only released at the end. With blocking prerequisite waits this would need one parked
+    // worker per link.
+    std::atomic<bool> gateOpen{ false };
+    FJobDescriptor    gateDesc;
+    gateDesc.Callback = [&gateOpen]() {
+        while (!gateOpen.load())
+            std::this_thread::yield();
+    };
+    FJobHandle       prev = FJobSystem::Submit(gateDesc);
+
+    std::atomic<int> counter{ 0 };
+    bool             ordered = true;
+    const int        kDepth  = 5000;
+    for (int i = 0; i < kDepth; ++i) {
+        FJobDescriptor desc;
+        desc.Callback = [&counter, &ordered, i]() {
+            if (counter.load() != i)
+                ordered = false;
+            counter.store(i + 1);
+        };
+        desc.Prerequisites.PushBack(prev);
+        prev = FJobSystem::Submit(desc);
+    }
+
+    REQUIRE_EQ(counter.load(), 0);
+    gateOpen.store(true);
+    FJobSystem::Wait(prev);
+    REQUIRE_EQ(counter.load(), kDepth);
+    REQUIRE(ordered);
+
+    // Completed handles may have been recycled; waiting on them must still return at once.
+    FJobSystem::Wait(prev);
+}
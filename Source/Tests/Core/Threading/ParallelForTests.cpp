@@ -0,0 +1,171 @@
+#include "TestHarness.h"
+
+#include "../../Runtime/Core/Public/Jobs/Parallel.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace AltinaEngine::Core;
+using namespace AltinaEngine::Core::Jobs;
+
+namespace {
+    template <typename Fn> auto MeasureMs(Fn&& fn) -> double {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
+
+    auto Shade(float v) -> float { return std::sqrt(v * v + 1.0f) * std::sin(v) + std::cos(v); }
+} // namespace
+
+TEST_CASE("ParallelFor visits every index exactly once") {
+    const usize                   kCount = 100000;
+    std::vector<std::atomic<int>> visits(kCount);
+
+    ParallelFor(kCount, 64, [&](usize i) { visits[i].fetch_add(1); });
+
+    bool allOnce = true;
+    for (usize i = 0; i < kCount; ++i)
+        allOnce = allOnce && visits[i].load() == 1;
+    REQUIRE(allOnce);
+}
+
+TEST_CASE("ParallelFor handles empty, single-chunk and auto-grain ranges") {
+    int calls = 0;
+    ParallelFor(0, 16, [&](usize) { ++calls; });
+    REQUIRE_EQ(calls, 0);
+
+    ParallelForRange(10, 16, [&](usize begin, usize end) {
+        REQUIRE_EQ(begin, static_cast<usize>(0));
+        REQUIRE_EQ(end, static_cast<usize>(10));
+        ++calls;
+    });
+    REQUIRE_EQ(calls, 1);
+
+    std::atomic<usize> sum{ 0 };
+    ParallelFor(5000, 0, [&](usize i) { sum.fetch_add(i); });
+    REQUIRE_EQ(sum.load(), static_cast<usize>(5000 * 4999 / 2));
+}
+
+TEST_CASE("ParallelFor nested inside ParallelFor completes") {
+    std::atomic<int> total{ 0 };
+    ParallelFor(32, 1, [&](usize) {
+        ParallelFor(256, 16, [&](usize) { total.fetch_add(1); });
+    });
+    REQUIRE_EQ(total.load(), 32 * 256);
+}
+
+TEST_CASE("ParallelFor rethrows a body exception after every range has finished") {
+    // The calling thread always keeps the lowest range; the highest one is split off and
+    // usually stolen, so both the caller and worker paths throw.
+    const usize kCount = 4096;
+    for (const usize throwAt : { static_cast<usize>(0), kCount - 1 }) {
+        std::atomic<int> running{ 0 };
+        bool             caught = false;
+        try {
+            ParallelFor(kCount, 16, [&](usize i) {
+                running.fetch_add(1);
+                std::this_thread::sleep_for(std::chrono::microseconds(1));
+                running.fetch_sub(1);
+                if (i == throwAt) {
+                    throw std::runtime_error("body failed");
+                }
+            });
+        } catch (const std::runtime_error&) {
+            caught = true;
+        }
+        REQUIRE(caught);
+        REQUIRE_EQ(running.load(), 0);
+    }
+
+    std::atomic<usize> sum{ 0 };
+    ParallelFor(1000, 8, [&](usize i) { sum.fetch_add(i); });
+    REQUIRE_EQ(sum.load(), static_cast<usize>(1000 * 999 / 2));
+}
+
+TEST_CASE("ParallelReduce matches serial sum") {
+    const usize      kCount = 1 << 20;
+    std::vector<u64> values(kCount);
+    u64              expected = 0;
+    for (usize i = 0; i < kCount; ++i) {
+        values[i] = (i * 2654435761ULL) & 0xFFFF;
+        expected += values[i];
+    }
+
+    const u64 result = ParallelReduce(
+        kCount, 4096, static_cast<u64>(0),
+        [&](usize begin, usize end) {
+            u64 acc = 0;
+            for (usize i = begin; i < end; ++i)
+                acc += values[i];
+            return acc;
+        },
+        [](u64 a, u64 b) { return a + b; });
+    REQUIRE_EQ(result, expected);
+}
+
+TEST_CASE("FWaitGroup waits for submitted jobs") {
+    FWaitGroup       group;
+    std::atomic<int> counter{ 0 };
+    const int        kJobs = 64;
+    group.Add(kJobs);
+    for (int i = 0; i < kJobs; ++i) {
+        FJobDescriptor desc;
+        desc.Callback = [&]() {
+            counter.fetch_add(1);
+            group.Done();
+        };
+        FJobSystem::Submit(desc);
+    }
+    group.Wait();
+    REQUIRE(group.IsDone());
+    REQUIRE_EQ(counter.load(), kJobs);
+}
+
+BENCHMARK_CASE("ParallelFor micro-benchmark against serial loops") {
+    const usize        kCount = 1 << 22;
+    std::vector<float> input(kCount);
+    std::vector<float> output(kCount);
+    for (usize i = 0; i < kCount; ++i)
+        input[i] = static_cast<float>(i % 1024) * 0.01f;
+
+    const double serialForMs = MeasureMs([&]() {
+        for (usize i = 0; i < kCount; ++i)
+            output[i] = Shade(input[i]);
+    });
+    const double parallelForMs = MeasureMs([&]() {
+        ParallelFor(kCount, 0, [&](usize i) { output[i] = Shade(input[i]); });
+    });
+
+    double       serialSum      = 0.0;
+    const double serialReduceMs = MeasureMs([&]() {
+        for (usize i = 0; i < kCount; ++i)
+            serialSum += Shade(input[i]);
+    });
+    double       parallelSum      = 0.0;
+    const double parallelReduceMs = MeasureMs([&]() {
+        parallelSum = ParallelReduce(
+            kCount, 16384, 0.0,
+            [&](usize begin, usize end) {
+                double acc = 0.0;
+                for (usize i = begin; i < end; ++i)
+                    acc += Shade(input[i]);
+                return acc;
+            },
+            [](double a, double b) { return a + b; });
+    });
+
+    std::cout << "[Bench][ParallelFor] n=" << kCount << " serial=" << serialForMs
+              << " ms parallel=" << parallelForMs << " ms\n";
+    std::cout << "[Bench][ParallelReduce] n=" << kCount << " serial=" << serialReduceMs
+              << " ms parallel=" << parallelReduceMs << " ms\n";
+
+    REQUIRE_CLOSE(parallelSum, serialSum, std::abs(serialSum) * 1e-6 + 1e-3);
+    REQUIRE_CLOSE(output[kCount - 1], Shade(input[kCount - 1]), 1e-6f);
+}
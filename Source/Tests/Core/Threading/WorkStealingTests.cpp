@@ -0,0 +1,158 @@
+#include "TestHarness.h"
+
+#include "../../Runtime/Core/Public/Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+using namespace AltinaEngine::Core;
+using namespace AltinaEngine::Core::Jobs;
+
+namespace {
+    auto WaitForCount(const std::atomic<int>& counter, int expected, int timeoutMs) -> bool {
+        const auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (counter.load() < expected) {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    // Roughly fixed amount of ALU work per job so the benchmark measures scheduling overhead
+    // against a realistic payload rather than an empty lambda.
+    auto BurnCycles(u32 seed) -> float {
+        float acc = static_cast<float>(seed);
+        for (int i = 0; i < 2000; ++i)
+            acc = std::sqrt(acc * 1.0001f + 1.0f);
+        return acc;
+    }
+} // namespace
+
+TEST_CASE("FWorkerPool work-stealing executes external submissions") {
+    FWorkerPoolConfig cfg;
+    cfg.mMinThreads = 2;
+    cfg.mMaxThreads = 4;
+    cfg.mAllowSteal = true;
+
+    FWorkerPool pool(cfg);
+    pool.Start();
+
+    std::atomic<int> counter{ 0 };
+    const int        kJobs = 2000;
+    for (int i = 0; i < kJobs; ++i)
+        pool.Submit([&counter]() { counter.fetch_add(1); });
+
+    REQUIRE(WaitForCount(counter, kJobs, 5000));
+    REQUIRE(pool.GetWorkerCount() >= 2);
+    REQUIRE(pool.GetWorkerCount() <= 4);
+    pool.Stop();
+    REQUIRE_EQ(counter.load(), kJobs);
+}
+
+TEST_CASE("FWorkerPool work-stealing spreads nested submissions") {
+    FWorkerPoolConfig cfg;
+    cfg.mMinThreads = 4;
+    cfg.mMaxThreads = 4;
+    cfg.mAllowSteal = true;
+
+    FWorkerPool pool(cfg);
+    pool.Start();
+
+    // One root job fans out onto its own deque and then blocks until the children are done, so
+    // every child has to be stolen by another worker.
+    std::atomic<int>  counter{ 0 };
+    std::atomic<int>  stolen{ 0 };
+    std::atomic<bool> rootDrained{ false };
+    const int         kChildren = 512;
+
+    pool.Submit([&]() {
+        const auto root = std::this_thread::get_id();
+        for (int i = 0; i < kChildren; ++i) {
+            pool.Submit([&, root, i]() {
+                BurnCycles(static_cast<u32>(i));
+                if (std::this_thread::get_id() != root)
+                    stolen.fetch_add(1);
+                counter.fetch_add(1);
+            });
+        }
+        rootDrained.store(WaitForCount(counter, kChildren, 10000));
+    });
+
+    REQUIRE(WaitForCount(counter, kChildren, 10000));
+    pool.Stop();
+    REQUIRE_EQ(counter.load(), kChildren);
+    REQUIRE(rootDrained.load());
+    REQUIRE_EQ(stolen.load(), kChildren);
+}
+
+TEST_CASE("FWorkerPool work-stealing drains pending jobs on Stop") {
+    FWorkerPoolConfig cfg;
+    cfg.mMinThreads = 1;
+    cfg.mMaxThreads = 2;
+    cfg.mAllowSteal = true;
+
+    std::atomic<int> counter{ 0 };
+    {
+        FWorkerPool pool(cfg);
+        pool.Start();
+        for (int i = 0; i < 256; ++i)
+            pool.SubmitWithPriority([&counter]() { counter.fetch_add(1); }, i % 3);
+    } // destructor stops the pool
+    REQUIRE_EQ(counter.load(), 256);
+}
+
+BENCHMARK_CASE("FWorkerPool work-stealing scaling benchmark") {
+    const u32 hw       = std::max(1U, std::thread::hardware_concurrency());
+    const int kJobs    = 20000;
+    double    serialMs = 0.0;
+    float     sink     = 0.0f;
+
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kJobs; ++i)
+            sink += BurnCycles(static_cast<u32>(i));
+        serialMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start)
+                       .count();
+    }
+    std::cout << "[Bench][WorkStealing] serial: " << serialMs << " ms\n";
+
+    for (u32 threads = 1; threads <= hw; threads *= 2) {
+        for (int steal = 0; steal < 2; ++steal) {
+            FWorkerPoolConfig cfg;
+            cfg.mMinThreads = threads;
+            cfg.mMaxThreads = threads;
+            cfg.mAllowSteal = steal != 0;
+
+            FWorkerPool      pool(cfg);
+            std::atomic<int> counter{ 0 };
+            pool.Start();
+
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < kJobs; ++i) {
+                pool.Submit([&counter, i]() {
+                    volatile float r = BurnCycles(static_cast<u32>(i));
+                    (void)r;
+                    counter.fetch_add(1);
+                });
+            }
+            const bool done = WaitForCount(counter, kJobs, 60000);
+            const double ms = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start)
+                                  .count();
+            pool.Stop();
+
+            REQUIRE(done);
+            std::cout << "[Bench][WorkStealing] threads=" << threads
+                      << (steal ? " steal" : " shared-queue") << ": " << ms
+                      << " ms (speedup x" << (ms > 0.0 ? serialMs / ms : 0.0) << ")\n";
+        }
+    }
+    REQUIRE(sink != 0.0f);
+}
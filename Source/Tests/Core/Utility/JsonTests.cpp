@@ -1,19 +1,33 @@
 #include "TestHarness.h"
 
+#include "Platform/PlatformMemory.h"
 #include "Utility/Json.h"
 
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
 #include <string_view>
 
 namespace {
     namespace Container = AltinaEngine::Core::Container;
+    using AltinaEngine::u32;
+    using AltinaEngine::u64;
+    using AltinaEngine::usize;
+    using AltinaEngine::Core::Platform::EMemoryTag;
+    using AltinaEngine::Core::Platform::GetMemoryTagStats;
+    using AltinaEngine::Core::Utility::Json::EJsonToken;
     using AltinaEngine::Core::Utility::Json::EJsonType;
     using AltinaEngine::Core::Utility::Json::FindObjectValue;
     using AltinaEngine::Core::Utility::Json::FindObjectValueInsensitive;
     using AltinaEngine::Core::Utility::Json::FJsonDocument;
+    using AltinaEngine::Core::Utility::Json::FJsonPullReader;
     using AltinaEngine::Core::Utility::Json::FJsonValue;
     using AltinaEngine::Core::Utility::Json::GetBoolValue;
     using AltinaEngine::Core::Utility::Json::GetNumberValue;
     using AltinaEngine::Core::Utility::Json::GetStringValue;
+    using AltinaEngine::Core::Utility::Json::GetStringView;
+    using AltinaEngine::Core::Utility::Json::ParseJsonSax;
     using Container::FNativeString;
     using Container::FNativeStringView;
 
@@ -21,6 +35,63 @@ namespace {
         const std::string_view view(value.GetData(), value.Length());
         return view == std::string_view(expected);
     }
+
+    auto EqualsLiteral(FNativeStringView value, const char* expected) -> bool {
+        return std::string_view(value.Data(), value.Length()) == std::string_view(expected);
+    }
+
+    auto HeapAllocations() -> u64 {
+        return GetMemoryTagStats(EMemoryTag::Default).mTotalAllocations;
+    }
+
+    auto LiveBytes() -> u64 { return GetMemoryTagStats(EMemoryTag::Default).mLiveBytes; }
+
+    // Records SAX events as a compact trace: {}[] for containers, k/s/n/b/z for the rest.
+    struct FTraceHandler {
+        std::string Trace;
+        u32         StopAfter = 0U;
+
+        auto Record(char c) -> bool {
+            Trace.push_back(c);
+            return StopAfter == 0U || Trace.size() < StopAfter;
+        }
+        auto OnBeginObject() -> bool { return Record('{'); }
+        auto OnEndObject() -> bool { return Record('}'); }
+        auto OnBeginArray() -> bool { return Record('['); }
+        auto OnEndArray() -> bool { return Record(']'); }
+        auto OnKey(FNativeStringView) -> bool { return Record('k'); }
+        auto OnString(FNativeStringView) -> bool { return Record('s'); }
+        auto OnNumber(double) -> bool { return Record('n'); }
+        auto OnBool(bool) -> bool { return Record('b'); }
+        auto OnNull() -> bool { return Record('z'); }
+    };
+
+    // Registry-shaped document: an asset array of small objects with nested descriptors.
+    auto MakeBenchDocument(u32 assets) -> std::string {
+        std::string text = "{\"SchemaVersion\":1,\"Assets\":[";
+        for (u32 i = 0U; i < assets; ++i) {
+            const std::string id = std::to_string(i);
+            if (i != 0U) {
+                text += ",";
+            }
+            text += "{\"Uuid\":\"00000000-0000-0000-0000-" + std::string(12U - id.size(), '0') + id
+                + "\",\"Type\":\"Texture2D\",\"VirtualPath\":\"Engine/Textures/T_" + id
+                + "\",\"Dependencies\":[],\"Desc\":{\"Width\":" + std::to_string(256U + i % 7U)
+                + ",\"Height\":512,\"MipCount\":10,\"SRGB\":true,\"Scale\":0.5}}";
+        }
+        text += "],\"Redirectors\":[]}";
+        return text;
+    }
+
+    template <typename Func> auto MeasureMBps(usize bytes, u32 rounds, Func&& func) -> double {
+        const auto start = std::chrono::steady_clock::now();
+        for (u32 round = 0U; round < rounds; ++round) {
+            func();
+        }
+        const double seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return static_cast<double>(bytes) * rounds / (1024.0 * 1024.0) / seconds;
+    }
 } // namespace
 
 TEST_CASE("Json parse simple object") {
@@ -196,3 +267,275 @@ TEST_CASE("Json rejects trailing comma and bad escape") {
     REQUIRE(!doc.Parse(FNativeStringView("[1,]")));
     REQUIRE(!doc.Parse(FNativeStringView("{\"a\":\"\\x\"}")));
 }
+
+TEST_CASE("Json unicode escape decodes to utf8") {
+    const char*   json = "[\"\\u00e9\\u20ac\", \"\\ud83d\\ude00\", \"\\ud83d!\"]";
+    FJsonDocument doc;
+    REQUIRE(doc.Parse(FNativeStringView(json)));
+
+    const FJsonValue* root = doc.GetRoot();
+    REQUIRE(root != nullptr);
+    REQUIRE_EQ(root->Array.Size(), static_cast<usize>(3));
+    REQUIRE(EqualsLiteral(root->Array[0]->String, "\xC3\xA9\xE2\x82\xAC"));
+    REQUIRE(EqualsLiteral(root->Array[1]->String, "\xF0\x9F\x98\x80"));
+    REQUIRE(EqualsLiteral(root->Array[2]->String, "?!"));
+}
+
+TEST_CASE("Json parse in situ keeps views into the buffer") {
+    char          json[] = "{\"Plain\":\"abc\",\"Escaped\":\"a\\tb\",\"List\":[1,2]}";
+    FJsonDocument doc;
+    REQUIRE(doc.ParseInSitu(json, sizeof(json) - 1U));
+
+    const FJsonValue* root = doc.GetRoot();
+    REQUIRE(root != nullptr);
+
+    FNativeStringView plain;
+    REQUIRE(GetStringView(FindObjectValue(*root, "Plain"), plain));
+    REQUIRE(EqualsLiteral(plain, "abc"));
+    REQUIRE(plain.Data() >= json && plain.Data() < json + sizeof(json));
+
+    FNativeStringView escaped;
+    REQUIRE(GetStringView(FindObjectValue(*root, "Escaped"), escaped));
+    REQUIRE(EqualsLiteral(escaped, "a\tb"));
+    REQUIRE(escaped.Data() >= json && escaped.Data() < json + sizeof(json));
+
+    const FJsonValue* list = FindObjectValue(*root, "List");
+    REQUIRE(list != nullptr);
+    usize count = 0U;
+    for (const FJsonValue* value : list->Array) {
+        REQUIRE(value->Type == EJsonType::Number);
+        ++count;
+    }
+    REQUIRE_EQ(count, static_cast<usize>(2));
+}
+
+TEST_CASE("Json large objects use indexed lookup") {
+    std::string json = "{";
+    for (u32 i = 0U; i < 40U; ++i) {
+        json += "\"Key" + std::to_string(i) + "\":" + std::to_string(i) + ",";
+    }
+    json += "\"Key7\":100}";
+
+    FJsonDocument doc;
+    REQUIRE(doc.Parse(FNativeStringView(json.data(), json.size())));
+    const FJsonValue* root = doc.GetRoot();
+    REQUIRE(root != nullptr);
+    REQUIRE(root->Object.HasIndex());
+    REQUIRE_EQ(root->Object.Size(), static_cast<usize>(41));
+
+    for (u32 i = 0U; i < 40U; ++i) {
+        const std::string key   = "Key" + std::to_string(i);
+        double            value = -1.0;
+        REQUIRE(GetNumberValue(FindObjectValue(*root, key.c_str()), value));
+        REQUIRE_EQ(static_cast<u32>(value), i);
+    }
+    // Duplicates resolve to the first member, as with the linear scan.
+    double duplicate = 0.0;
+    REQUIRE(GetNumberValue(FindObjectValue(*root, "Key7"), duplicate));
+    REQUIRE_EQ(static_cast<u32>(duplicate), 7U);
+    REQUIRE(FindObjectValue(*root, "Key40") == nullptr);
+    REQUIRE(FindObjectValueInsensitive(*root, "KEY39") != nullptr);
+}
+
+TEST_CASE("Json small documents keep a small arena") {
+    const u64 before = LiveBytes();
+    {
+        FJsonDocument doc;
+        REQUIRE(doc.Parse(FNativeStringView("{\"Name\":\"Cube\",\"Lods\":[0,1]}")));
+        REQUIRE(LiveBytes() - before <= 8ULL * 1024ULL);
+
+        // Larger input grows the arena past its first chunk.
+        const std::string json = MakeBenchDocument(256U);
+        REQUIRE(doc.Parse(FNativeStringView(json.data(), json.size())));
+        const FJsonValue* assets = FindObjectValue(*doc.GetRoot(), "Assets");
+        REQUIRE(assets != nullptr);
+        REQUIRE_EQ(assets->Array.Size(), static_cast<usize>(256));
+    }
+    REQUIRE_EQ(LiveBytes(), before);
+}
+
+TEST_CASE("Json reused document stops allocating") {
+    const std::string json = MakeBenchDocument(64U);
+    FJsonDocument     doc;
+    REQUIRE(doc.Parse(FNativeStringView(json.data(), json.size())));
+
+    const u64 before = HeapAllocations();
+    for (u32 round = 0U; round < 4U; ++round) {
+        REQUIRE(doc.Parse(FNativeStringView(json.data(), json.size())));
+    }
+    REQUIRE_EQ(HeapAllocations() - before, 0ULL);
+
+    const FJsonValue* assets = FindObjectValue(*doc.GetRoot(), "Assets");
+    REQUIRE(assets != nullptr);
+    REQUIRE_EQ(assets->Array.Size(), static_cast<usize>(64));
+}
+
+TEST_CASE("Json pull reader tokens and skipping") {
+    const char*     json = "{\"a\":[1,{\"b\":null}],\"c\":\"x\\ny\",\"d\":false}";
+    FJsonPullReader reader{ FNativeStringView(json) };
+
+    REQUIRE(reader.Next() == EJsonToken::BeginObject);
+    REQUIRE(reader.Next() == EJsonToken::Key);
+    REQUIRE(EqualsLiteral(reader.GetString(), "a"));
+    REQUIRE(reader.SkipValue());
+    REQUIRE_EQ(reader.GetDepth(), 1U);
+
+    REQUIRE(reader.Next() == EJsonToken::Key);
+    REQUIRE(EqualsLiteral(reader.GetString(), "c"));
+    REQUIRE(reader.Next() == EJsonToken::String);
+    REQUIRE(EqualsLiteral(reader.GetString(), "x\ny"));
+
+    // Copies are independent cursors.
+    FJsonPullReader lookahead = reader;
+    REQUIRE(lookahead.Next() == EJsonToken::Key);
+    REQUIRE(lookahead.Next() == EJsonToken::Bool);
+    REQUIRE(!lookahead.GetBool());
+
+    REQUIRE(reader.SkipToContainerEnd());
+    REQUIRE(reader.GetToken() == EJsonToken::EndObject);
+    REQUIRE(reader.Next() == EJsonToken::End);
+    REQUIRE(reader.Next() == EJsonToken::End);
+
+    FJsonPullReader broken{ FNativeStringView("[1 2]") };
+    REQUIRE(broken.Next() == EJsonToken::BeginArray);
+    REQUIRE(broken.Next() == EJsonToken::Number);
+    REQUIRE(broken.Next() == EJsonToken::Error);
+    REQUIRE(broken.Next() == EJsonToken::Error);
+    REQUIRE(broken.GetError().Length() > 0);
+}
+
+TEST_CASE("Json pull reader copies keep their own escaped strings") {
+    // The first value fits the scratch string's inline buffer, the others spill to the heap.
+    // Each read of the source overwrites its scratch, so a copy or move that still pointed
+    // into it would see the next value.
+    const char* kShort = "a\nb";
+    const char* kLong  = "c\nd-0123456789-0123456789-0123456789-0123456789";
+    const char* json   = "[\"a\\nb\",\"c\\nd-0123456789-0123456789-0123456789-0123456789\","
+                         "\"e\\nf-0123456789-0123456789-0123456789-0123456789\"]";
+    FJsonPullReader reader{ FNativeStringView(json) };
+    REQUIRE(reader.Next() == EJsonToken::BeginArray);
+
+    REQUIRE(reader.Next() == EJsonToken::String);
+    FJsonPullReader shortCopy = reader;
+    FJsonPullReader shortAssigned;
+    shortAssigned = reader;
+    FJsonPullReader shortSource = reader;
+    FJsonPullReader shortMoved(AltinaEngine::Move(shortSource));
+
+    REQUIRE(reader.Next() == EJsonToken::String);
+    REQUIRE(EqualsLiteral(reader.GetString(), kLong));
+    FJsonPullReader longCopy = reader;
+    FJsonPullReader longSource = reader;
+    FJsonPullReader longMoved;
+    longMoved = AltinaEngine::Move(longSource);
+
+    REQUIRE(reader.Next() == EJsonToken::String);
+    REQUIRE(EqualsLiteral(shortCopy.GetString(), kShort));
+    REQUIRE(EqualsLiteral(shortAssigned.GetString(), kShort));
+    REQUIRE(EqualsLiteral(shortMoved.GetString(), kShort));
+    REQUIRE(EqualsLiteral(longCopy.GetString(), kLong));
+    REQUIRE(EqualsLiteral(longMoved.GetString(), kLong));
+
+    // Copies resume from their own position.
+    REQUIRE(shortCopy.Next() == EJsonToken::String);
+    REQUIRE(EqualsLiteral(shortCopy.GetString(), kLong));
+    REQUIRE(longMoved.Next() == EJsonToken::String);
+    REQUIRE(longMoved.Next() == EJsonToken::EndArray);
+}
+
+TEST_CASE("Json pull reader seeks back to a passed value") {
+    const char*     json = "{\"a\":\"x\\ty\",\"b\":{\"c\":[1,2]},\"d\":3}";
+    FJsonPullReader reader{ FNativeStringView(json) };
+    REQUIRE(reader.Next() == EJsonToken::BeginObject);
+    const u32 memberDepth = reader.GetDepth();
+
+    REQUIRE(reader.Next() == EJsonToken::Key);
+    REQUIRE(reader.Next() == EJsonToken::String);
+    const usize stringOffset = reader.GetTokenOffset();
+    REQUIRE(reader.Next() == EJsonToken::Key);
+    REQUIRE(reader.Next() == EJsonToken::BeginObject);
+    const usize objectOffset = reader.GetTokenOffset();
+    REQUIRE(reader.SkipValue());
+    REQUIRE(reader.SkipToContainerEnd());
+    REQUIRE(reader.Next() == EJsonToken::End);
+
+    FJsonPullReader value;
+    REQUIRE(value.SeekValue(reader, stringOffset, memberDepth) == EJsonToken::String);
+    REQUIRE(EqualsLiteral(value.GetString(), "x\ty"));
+
+    REQUIRE(value.SeekValue(reader, objectOffset, memberDepth) == EJsonToken::BeginObject);
+    REQUIRE(value.Next() == EJsonToken::Key);
+    REQUIRE(EqualsLiteral(value.GetString(), "c"));
+    REQUIRE(value.Next() == EJsonToken::BeginArray);
+    REQUIRE(value.SkipToContainerEnd());
+    REQUIRE(value.Next() == EJsonToken::EndObject);
+    REQUIRE_EQ(value.GetDepth(), memberDepth);
+}
+
+TEST_CASE("Json rejects excessive nesting") {
+    const std::string json = std::string(FJsonPullReader::kMaxDepth + 1U, '[')
+        + std::string(FJsonPullReader::kMaxDepth + 1U, ']');
+    FJsonDocument     doc;
+    REQUIRE(!doc.Parse(FNativeStringView(json.data(), json.size())));
+    REQUIRE(doc.GetError().Length() > 0);
+
+    const std::string nested = std::string(FJsonPullReader::kMaxDepth, '[')
+        + std::string(FJsonPullReader::kMaxDepth, ']');
+    REQUIRE(doc.Parse(FNativeStringView(nested.data(), nested.size())));
+}
+
+TEST_CASE("Json sax events") {
+    FTraceHandler handler;
+    REQUIRE(ParseJsonSax(
+        FNativeStringView("{\"a\":[1,\"s\",true,null],\"b\":{}}"), handler));
+    REQUIRE(handler.Trace == "{k[nsbz]k{}}");
+
+    FTraceHandler stopping;
+    stopping.StopAfter = 3U;
+    REQUIRE(!ParseJsonSax(FNativeStringView("[1,2,3,4]"), stopping));
+    REQUIRE(stopping.Trace == "[nn");
+
+    FTraceHandler failing;
+    FNativeString error;
+    REQUIRE(!ParseJsonSax(FNativeStringView("[1,]"), failing, &error));
+    REQUIRE(error.Length() > 0);
+}
+
+BENCHMARK_CASE("Json - Benchmark") {
+    constexpr u32           kRounds = 8U;
+    const std::string       json    = MakeBenchDocument(20000U);
+    const usize             bytes   = json.size();
+    const FNativeStringView text(json.data(), json.size());
+
+    FJsonDocument doc;
+    usize         checksum = 0U;
+    const double  domMBps  = MeasureMBps(bytes, kRounds, [&] {
+        REQUIRE(doc.Parse(text));
+        checksum += FindObjectValue(*doc.GetRoot(), "Assets")->Array.Size();
+    });
+
+    std::string  buffer;
+    const double inSituMBps = MeasureMBps(bytes, kRounds, [&] {
+        buffer = json;
+        REQUIRE(doc.ParseInSitu(buffer.data(), buffer.size()));
+        checksum += doc.GetRoot()->Object.Size();
+    });
+
+    const double skipMBps = MeasureMBps(bytes, kRounds, [&] {
+        FJsonPullReader reader(text);
+        REQUIRE(reader.SkipValue());
+        checksum += reader.GetOffset();
+    });
+
+    const double saxMBps = MeasureMBps(bytes, kRounds, [&] {
+        FTraceHandler handler;
+        handler.Trace.reserve(bytes / 4U);
+        REQUIRE(ParseJsonSax(text, handler));
+        checksum += handler.Trace.size();
+    });
+
+    REQUIRE(checksum > 0U);
+    std::cout << "[Bench][Json] size=" << (bytes / 1024U) << " KiB dom=" << domMBps
+              << " MB/s insitu=" << inSituMBps << " MB/s skip=" << skipMBps
+              << " MB/s sax=" << saxMBps << " MB/s\n";
+}
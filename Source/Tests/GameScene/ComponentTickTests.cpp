@@ -0,0 +1,170 @@
+#include "TestHarness.h"
+
+#include "Engine/GameScene/World.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace {
+    using AltinaEngine::usize;
+    using AltinaEngine::GameScene::CParallelTickComponent;
+    using AltinaEngine::GameScene::FComponent;
+    using AltinaEngine::GameScene::FComponentId;
+    using AltinaEngine::GameScene::FGameObjectId;
+    using AltinaEngine::GameScene::FWorld;
+
+    struct FCountingTickComponent final : public FComponent {
+        int  mTicks = 0;
+        void Tick(float /*dt*/) override { ++mTicks; }
+    };
+
+    struct FParallelTickComponent final : public FComponent {
+        static constexpr bool kTickInParallel = true;
+        static std::atomic<int> sTicks;
+
+        float mValue = 0.0f;
+        void  Tick(float dt) override {
+            mValue += dt;
+            sTicks.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+    std::atomic<int> FParallelTickComponent::sTicks{ 0 };
+
+    // Destroys another component of the same type from inside its own Tick.
+    struct FSelfDestructComponent final : public FComponent {
+        static int   sTicks;
+        FComponentId mVictim{};
+        void         Tick(float /*dt*/) override {
+            ++sTicks;
+            if (mVictim.IsValid()) {
+                GetWorld()->DestroyComponent(mVictim);
+                mVictim = {};
+            }
+        }
+    };
+    int FSelfDestructComponent::sTicks = 0;
+
+    static_assert(CParallelTickComponent<FParallelTickComponent>);
+    static_assert(!CParallelTickComponent<FCountingTickComponent>);
+} // namespace
+
+TEST_CASE("GameScene.World.ComponentTick.SkipsDisabledAndInactive") {
+    FWorld world;
+    auto   a = world.CreateGameObject();
+    auto   b = world.CreateGameObject();
+    auto   c = world.CreateGameObject();
+
+    auto   compA = a.AddComponent<FCountingTickComponent>();
+    auto   compB = b.AddComponent<FCountingTickComponent>();
+    auto   compC = c.AddComponent<FCountingTickComponent>();
+
+    compB.Get().SetEnabled(false);
+    c.SetActive(false);
+    world.Tick(0.016f);
+    REQUIRE_EQ(compA.Get().mTicks, 1);
+    REQUIRE_EQ(compB.Get().mTicks, 0);
+    REQUIRE_EQ(compC.Get().mTicks, 0);
+
+    compB.Get().SetEnabled(true);
+    c.SetActive(true);
+    world.Tick(0.016f);
+    REQUIRE_EQ(compA.Get().mTicks, 2);
+    REQUIRE_EQ(compB.Get().mTicks, 1);
+    REQUIRE_EQ(compC.Get().mTicks, 1);
+}
+
+TEST_CASE("GameScene.World.ComponentTick.DestroyKeepsOtherIdsValid") {
+    FWorld                    world;
+    std::vector<FComponentId> ids;
+    for (int i = 0; i < 8; ++i) {
+        auto object = world.CreateGameObject();
+        ids.push_back(object.AddComponent<FCountingTickComponent>().GetId());
+    }
+
+    // Removing from the middle swaps the last dense entry into the hole.
+    world.DestroyComponent(ids[2]);
+    world.DestroyComponent(ids[0]);
+    world.Tick(0.016f);
+
+    for (usize i = 0; i < ids.size(); ++i) {
+        if (i == 0 || i == 2) {
+            REQUIRE(!world.IsAlive(ids[i]));
+            continue;
+        }
+        REQUIRE(world.IsAlive(ids[i]));
+        REQUIRE_EQ(world.ResolveComponent<FCountingTickComponent>(ids[i]).mTicks, 1);
+    }
+}
+
+TEST_CASE("GameScene.World.ComponentTick.DestroyDuringTick") {
+    FSelfDestructComponent::sTicks = 0;
+
+    FWorld world;
+    auto   first  = world.CreateGameObject().AddComponent<FSelfDestructComponent>();
+    auto   second = world.CreateGameObject().AddComponent<FSelfDestructComponent>();
+    auto   third  = world.CreateGameObject().AddComponent<FSelfDestructComponent>();
+    first.Get().mVictim = second.GetId();
+
+    world.Tick(0.016f);
+    REQUIRE(!world.IsAlive(second.GetId()));
+    REQUIRE_EQ(FSelfDestructComponent::sTicks, 2); // first and third
+
+    world.Tick(0.016f);
+    REQUIRE_EQ(FSelfDestructComponent::sTicks, 4);
+    REQUIRE(world.IsAlive(third.GetId()));
+}
+
+TEST_CASE("GameScene.World.ComponentTick.ParallelTickVisitsEachOnce") {
+    FParallelTickComponent::sTicks = 0;
+
+    constexpr int             kCount = 10000;
+    FWorld                    world;
+    std::vector<FComponentId> ids;
+    ids.reserve(kCount);
+    for (int i = 0; i < kCount; ++i) {
+        ids.push_back(world.CreateGameObject().AddComponent<FParallelTickComponent>().GetId());
+    }
+
+    world.Tick(1.0f);
+    world.Tick(1.0f);
+    REQUIRE_EQ(FParallelTickComponent::sTicks.load(), 2 * kCount);
+
+    bool allTwice = true;
+    for (const auto& id : ids) {
+        allTwice = allTwice && world.ResolveComponent<FParallelTickComponent>(id).mValue == 2.0f;
+    }
+    REQUIRE(allTwice);
+}
+
+BENCHMARK_CASE("GameScene.World.ComponentTick.Benchmark") {
+    constexpr int kCount = 100000;
+    FWorld        world;
+    std::vector<FGameObjectId> objects;
+    objects.reserve(kCount);
+    for (int i = 0; i < kCount; ++i) {
+        auto object = world.CreateGameObject();
+        (void)object.AddComponent<FCountingTickComponent>();
+        (void)object.AddComponent<FParallelTickComponent>();
+        objects.push_back(object.GetId());
+    }
+    // Half of the objects inactive: those components should cost nothing.
+    for (int i = 0; i < kCount; i += 2) {
+        world.SetGameObjectActive(objects[static_cast<usize>(i)], false);
+    }
+
+    const auto   start = std::chrono::steady_clock::now();
+    constexpr int kFrames = 10;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        world.Tick(0.016f);
+    }
+    const double ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+
+    std::cout << "[Bench][ComponentTick] objects=" << kCount
+              << " (50% inactive, serial + parallel types) avg frame=" << (ms / kFrames)
+              << " ms\n";
+    REQUIRE(ms >= 0.0);
+}
@@ -2,23 +2,34 @@
 
 #include "Engine/Runtime/MaterialCache.h"
 #include "Engine/Runtime/SceneBatching.h"
+#include "Engine/Runtime/SceneSpatialIndex.h"
 #include "Engine/Runtime/SceneView.h"
 #include "Engine/GameScene/MeshMaterialComponent.h"
 #include "Geometry/StaticMeshData.h"
 #include "Math/LinAlg/Common.h"
+#include "Memory/FrameAllocator.h"
+#include "Platform/PlatformMemory.h"
 #include "Utility/Uuid.h"
 
+#include <chrono>
+#include <iostream>
+
 namespace {
     using AltinaEngine::f32;
     using AltinaEngine::FUuid;
     using AltinaEngine::u32;
+    using AltinaEngine::u64;
     using AltinaEngine::u8;
     using AltinaEngine::Asset::EAssetType;
     using AltinaEngine::Asset::FAssetHandle;
+    using AltinaEngine::Core::Memory::FFrameMemory;
+    using AltinaEngine::Core::Platform::EMemoryTag;
+    using AltinaEngine::Core::Platform::GetMemoryTagStats;
     using AltinaEngine::Engine::FMaterialCache;
     using AltinaEngine::Engine::FRenderScene;
     using AltinaEngine::Engine::FSceneBatchBuilder;
     using AltinaEngine::Engine::FSceneBatchBuildParams;
+    using AltinaEngine::Engine::FSceneDrawListCache;
     using AltinaEngine::Engine::FSceneStaticMesh;
     using AltinaEngine::Engine::FSceneView;
     using AltinaEngine::GameScene::FMeshMaterialComponent;
@@ -103,6 +114,48 @@ namespace {
         view.View.BeginFrame();
         return view;
     }
+
+    void AssignMeshComponentIds(FRenderScene& scene) {
+        for (u32 i = 0U; i < static_cast<u32>(scene.StaticMeshes.Size()); ++i) {
+            scene.StaticMeshes[i].MeshComponentId.Index      = i;
+            scene.StaticMeshes[i].MeshComponentId.Generation = 1U;
+            scene.StaticMeshes[i].MeshComponentId.Type       = 1U;
+        }
+    }
+
+    auto DrawListsMatch(const AltinaEngine::RenderCore::Render::FDrawList& lhs,
+        const AltinaEngine::RenderCore::Render::FDrawList& rhs) -> bool {
+        if (lhs.mBuckets.Size() != rhs.mBuckets.Size()) {
+            return false;
+        }
+        for (AltinaEngine::usize b = 0U; b < lhs.mBuckets.Size(); ++b) {
+            const auto& lhsBucket = lhs.mBuckets[b];
+            const auto& rhsBucket = rhs.mBuckets[b];
+            if (!(lhsBucket.mBucketKey == rhsBucket.mBucketKey)
+                || lhsBucket.mMaterial != rhsBucket.mMaterial
+                || lhsBucket.mBatches.Size() != rhsBucket.mBatches.Size()) {
+                return false;
+            }
+            for (AltinaEngine::usize i = 0U; i < lhsBucket.mBatches.Size(); ++i) {
+                const auto& lhsBatch = lhsBucket.mBatches[i];
+                const auto& rhsBatch = rhsBucket.mBatches[i];
+                if (!(lhsBatch.mBatchKey == rhsBatch.mBatchKey)
+                    || lhsBatch.mStatic.mMesh != rhsBatch.mStatic.mMesh
+                    || lhsBatch.mStatic.mSectionIndex != rhsBatch.mStatic.mSectionIndex
+                    || lhsBatch.mInstances.Size() != rhsBatch.mInstances.Size()) {
+                    return false;
+                }
+                for (AltinaEngine::usize n = 0U; n < lhsBatch.mInstances.Size(); ++n) {
+                    if (lhsBatch.mInstances[n].mWorld(0, 3) != rhsBatch.mInstances[n].mWorld(0, 3)
+                        || lhsBatch.mInstances[n].mObjectId
+                            != rhsBatch.mInstances[n].mObjectId) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
 } // namespace
 
 TEST_CASE("GameScene.SceneBatching.GroupsDifferentGeometryIntoSameMaterialBucket") {
@@ -231,6 +284,56 @@ TEST_CASE("GameScene.SceneBatching.FrustumCullsInvisibleStaticMeshes") {
     REQUIRE_EQ(drawList.mBuckets[0].mBatches[0].mInstances.Size(), 1U);
 }
 
+TEST_CASE("GameScene.SceneBatching.FrustumCullingUsesSyncedSpatialIndex") {
+    FMaterialConverterGuard converterGuard(
+        [](const FAssetHandle&, const AltinaEngine::Asset::FMeshMaterialParameterBlock&) {
+            return FMaterial{};
+        });
+
+    FStaticMeshData        mesh           = MakeStaticMesh();
+    const FAssetHandle     materialHandle = MakeMaterialHandle(4U);
+    FMeshMaterialComponent materials      = MakeMaterialComponent(materialHandle);
+
+    FRenderScene           scene{};
+    scene.StaticMeshes.PushBack(
+        MakeSceneEntry(mesh, materials, AltinaEngine::Core::Math::FVector3f(0.0f, 0.0f, 5.0f)));
+    scene.StaticMeshes.PushBack(
+        MakeSceneEntry(mesh, materials, AltinaEngine::Core::Math::FVector3f(10.0f, 0.0f, 5.0f)));
+    for (u32 i = 0U; i < 2U; ++i) {
+        scene.StaticMeshes[i].MeshComponentId.Index      = i;
+        scene.StaticMeshes[i].MeshComponentId.Generation = 1U;
+        scene.StaticMeshes[i].MeshComponentId.Type       = 1U;
+    }
+
+    AltinaEngine::Engine::FSceneSpatialIndex spatialIndex{};
+    AltinaEngine::Engine::BuildSceneBounds(scene, 0U, scene.StaticMeshBounds);
+    spatialIndex.Sync(scene);
+    REQUIRE(spatialIndex.IsSyncedWith(scene));
+
+    FMaterialCache         materialCache{};
+    FSceneBatchBuilder     builder{};
+    FSceneBatchBuildParams params{};
+    params.Pass                  = EMaterialPass::BasePass;
+    params.bAllowInstancing      = true;
+    params.bEnableFrustumCulling = true;
+
+    AltinaEngine::RenderCore::Render::FDrawList drawList{};
+    const FSceneView                            view = MakeView();
+    builder.Build(scene, view, params, materialCache, drawList);
+    REQUIRE_EQ(drawList.GetBatchCount(), 1U);
+    REQUIRE_EQ(drawList.mBuckets[0].mBatches[0].mInstances.Size(), 1U);
+
+    // Move the culled mesh into view; the next sync relocates it in the hierarchy.
+    scene.StaticMeshes[1].WorldMatrix(0, 3) = 0.5f;
+    AltinaEngine::Engine::BuildSceneBounds(scene, 0U, scene.StaticMeshBounds);
+    spatialIndex.Sync(scene);
+    REQUIRE_EQ(spatialIndex.GetStats().Moved, 1U);
+
+    builder.Build(scene, view, params, materialCache, drawList);
+    REQUIRE_EQ(drawList.GetBatchCount(), 1U);
+    REQUIRE_EQ(drawList.mBuckets[0].mBatches[0].mInstances.Size(), 2U);
+}
+
 TEST_CASE("GameScene.SceneBatching.CanDisableFrustumCulling") {
     FMaterialConverterGuard converterGuard(
         [](const FAssetHandle&, const AltinaEngine::Asset::FMeshMaterialParameterBlock&) {
@@ -444,3 +547,328 @@ TEST_CASE("GameScene.SceneBatching.SmallCasterCullsTinyShadowCasters") {
     REQUIRE_EQ(drawList.mBuckets[0].mBatches[0].mInstances.Size(), 1U);
     REQUIRE_EQ(drawList.mBuckets[0].mBatches[0].mInstances[0].mWorld(0, 3), 0.0f);
 }
+
+TEST_CASE("GameScene.SceneBatching.RetainedCacheReusesStructureAndPatchesTransforms") {
+    FMaterialConverterGuard converterGuard(
+        [](const FAssetHandle&, const AltinaEngine::Asset::FMeshMaterialParameterBlock&) {
+            return FMaterial{};
+        });
+
+    FStaticMeshData        meshA      = MakeStaticMesh();
+    FStaticMeshData        meshB      = MakeStaticMesh();
+    FMeshMaterialComponent materialsA = MakeMaterialComponent(MakeMaterialHandle(5U));
+    FMeshMaterialComponent materialsB = MakeMaterialComponent(MakeMaterialHandle(6U));
+
+    FRenderScene           scene{};
+    scene.StaticMeshes.PushBack(
+        MakeSceneEntry(meshA, materialsA, AltinaEngine::Core::Math::FVector3f(0.0f, 0.0f, 5.0f)));
+    scene.StaticMeshes.PushBack(
+        MakeSceneEntry(meshB, materialsB, AltinaEngine::Core::Math::FVector3f(1.0f, 0.0f, 5.0f)));
+    scene.StaticMeshes.PushBack(
+        MakeSceneEntry(meshA, materialsA, AltinaEngine::Core::Math::FVector3f(-1.0f, 0.0f, 5.0f)));
+    AssignMeshComponentIds(scene);
+
+    FMaterialCache         materialCache{};
+    FSceneBatchBuilder     builder{};
+    FSceneDrawListCache    cache{};
+    FSceneBatchBuildParams params{};
+    params.Pass                  = EMaterialPass::BasePass;
+    params.bAllowInstancing      = true;
+    params.bEnableFrustumCulling = true;
+
+    const FSceneView                            view = MakeView();
+    AltinaEngine::RenderCore::Render::FDrawList reference{};
+    const auto& retained = builder.Build(scene, view, params, materialCache, cache);
+    REQUIRE(&retained == &cache.GetDrawList());
+    REQUIRE_EQ(cache.GetStats().Misses, 3U);
+    REQUIRE_EQ(cache.GetStats().Hits, 0U);
+    REQUIRE(!cache.GetStats().bStructureReused);
+    builder.Build(scene, view, params, materialCache, reference);
+    REQUIRE(DrawListsMatch(retained, reference));
+
+    // Only transforms changed: every mesh hits and the sorted structure is reused in place.
+    scene.StaticMeshes[1].WorldMatrix(0, 3) = 2.0f;
+    REQUIRE(&builder.Build(scene, view, params, materialCache, cache) == &retained);
+    REQUIRE_EQ(cache.GetStats().Hits, 3U);
+    REQUIRE_EQ(cache.GetStats().Misses, 0U);
+    REQUIRE(cache.GetStats().bStructureReused);
+    REQUIRE(!cache.GetStats().bCopiedShared);
+    REQUIRE_CLOSE(cache.GetStats().GetHitRate(), 1.0f, 1e-6f);
+    builder.Build(scene, view, params, materialCache, reference);
+    REQUIRE(DrawListsMatch(retained, reference));
+    REQUIRE_EQ(retained.GetBatchCount(), 2U);
+
+    // With transform revisions, unchanged meshes are not rewritten at all.
+    for (auto& entry : scene.StaticMeshes) {
+        entry.TransformRevision = 1ULL;
+    }
+    builder.Build(scene, view, params, materialCache, cache);
+    scene.StaticMeshes[2].WorldMatrix(0, 3) = -2.0f;
+    scene.StaticMeshes[2].TransformRevision = 2ULL;
+    builder.Build(scene, view, params, materialCache, cache);
+    REQUIRE_EQ(cache.GetStats().WrittenInstances, 1U);
+    builder.Build(scene, view, params, materialCache, reference);
+    REQUIRE(DrawListsMatch(cache.GetDrawList(), reference));
+    builder.Build(scene, view, params, materialCache, cache);
+    REQUIRE_EQ(cache.GetStats().WrittenInstances, 0U);
+}
+
+TEST_CASE("GameScene.SceneBatching.RetainedCacheRebuildsChangedMeshes") {
+    FMaterialConverterGuard converterGuard(
+        [](const FAssetHandle&, const AltinaEngine::Asset::FMeshMaterialParameterBlock&) {
+            return FMaterial{};
+        });
+
+    FStaticMeshData        mesh      = MakeStaticMesh();
+    FMeshMaterialComponent materials = MakeMaterialComponent(MakeMaterialHandle(7U));
+
+    FRenderScene           scene{};
+    scene.StaticMeshes.PushBack(
+        MakeSceneEntry(mesh, materials, AltinaEngine::Core::Math::FVector3f(0.0f, 0.0f, 5.0f)));
+    scene.StaticMeshes.PushBack(
+        MakeSceneEntry(mesh, materials, AltinaEngine::Core::Math::FVector3f(1.0f, 0.0f, 5.0f)));
+    AssignMeshComponentIds(scene);
+
+    FMaterialCache         materialCache{};
+    FSceneBatchBuilder     builder{};
+    FSceneDrawListCache    cache{};
+    FSceneBatchBuildParams params{};
+    params.Pass                  = EMaterialPass::BasePass;
+    params.bAllowInstancing      = true;
+    params.bEnableFrustumCulling = true;
+
+    const FSceneView view = MakeView();
+    REQUIRE_EQ(builder.Build(scene, view, params, materialCache, cache).GetBucketCount(), 1U);
+
+    // A material change misses for that mesh only and splits the bucket.
+    FMeshMaterialComponent otherMaterials = MakeMaterialComponent(MakeMaterialHandle(8U));
+    scene.StaticMeshes[1].Materials       = &otherMaterials;
+    builder.Build(scene, view, params, materialCache, cache);
+    REQUIRE_EQ(cache.GetStats().Hits, 1U);
+    REQUIRE_EQ(cache.GetStats().Misses, 1U);
+    REQUIRE(!cache.GetStats().bStructureReused);
+    REQUIRE_EQ(cache.GetDrawList().GetBucketCount(), 2U);
+
+    // Parameter edits made through the component are picked up as well.
+    otherMaterials.GetMaterials()[0].Parameters.SetScalar(1U, 0.5f);
+    builder.Build(scene, view, params, materialCache, cache);
+    REQUIRE_EQ(cache.GetStats().Misses, 1U);
+
+    // Culled meshes keep their entries and hit again once visible.
+    scene.StaticMeshes[1].WorldMatrix(2, 3) = -5.0f;
+    builder.Build(scene, view, params, materialCache, cache);
+    REQUIRE_EQ(cache.GetStats().VisibleMeshes, 1U);
+    REQUIRE(!cache.GetStats().bStructureReused);
+    REQUIRE_EQ(cache.GetDrawList().GetBucketCount(), 1U);
+    scene.StaticMeshes[1].WorldMatrix(2, 3) = 5.0f;
+    builder.Build(scene, view, params, materialCache, cache);
+    REQUIRE_EQ(cache.GetStats().Hits, 2U);
+    REQUIRE_EQ(cache.GetStats().Misses, 0U);
+    REQUIRE_EQ(cache.GetDrawList().GetBucketCount(), 2U);
+
+    // Resolved materials die with the material cache.
+    materialCache.Clear();
+    builder.Build(scene, view, params, materialCache, cache);
+    REQUIRE_EQ(cache.GetStats().Misses, 2U);
+
+    // Meshes without a component id cannot be retained but still draw.
+    scene.StaticMeshes[0].MeshComponentId = {};
+    builder.Build(scene, view, params, materialCache, cache);
+    REQUIRE_EQ(cache.GetStats().Uncached, 1U);
+    REQUIRE_EQ(cache.GetStats().Hits, 1U);
+    REQUIRE_EQ(cache.GetDrawList().GetBucketCount(), 2U);
+}
+
+TEST_CASE("GameScene.SceneBatching.RetainedCacheMatchesFullRebuildUnderRandomEdits") {
+    FMaterialConverterGuard converterGuard(
+        [](const FAssetHandle&, const AltinaEngine::Asset::FMeshMaterialParameterBlock&) {
+            return FMaterial{};
+        });
+
+    constexpr u32          kInitialMeshes = 48U;
+    constexpr u32          kMaterialCount = 4U;
+    constexpr u32          kFrames        = 200U;
+    FStaticMeshData        meshes[2]      = { MakeStaticMesh(), MakeStaticMesh() };
+    FMeshMaterialComponent materials[kMaterialCount] = {
+        MakeMaterialComponent(MakeMaterialHandle(1U)),
+        MakeMaterialComponent(MakeMaterialHandle(2U)),
+        MakeMaterialComponent(MakeMaterialHandle(3U)),
+        MakeMaterialComponent(MakeMaterialHandle(4U)),
+    };
+
+    u32        rng  = 0x2545F491U;
+    const auto next = [&rng](u32 range) {
+        rng ^= rng << 13U;
+        rng ^= rng >> 17U;
+        rng ^= rng << 5U;
+        return rng % range;
+    };
+
+    FRenderScene scene{};
+    u32          nextComponentIndex = 0U;
+    const auto   addMesh            = [&]() {
+        FSceneStaticMesh entry = MakeSceneEntry(meshes[next(2U)], materials[next(kMaterialCount)],
+            AltinaEngine::Core::Math::FVector3f(static_cast<f32>(next(9U)) - 4.0f, 0.0f, 5.0f));
+        entry.MeshComponentId.Index      = nextComponentIndex++;
+        entry.MeshComponentId.Generation = 1U;
+        entry.MeshComponentId.Type       = 1U;
+        entry.TransformRevision          = 1ULL;
+        scene.StaticMeshes.PushBack(entry);
+    };
+    for (u32 i = 0U; i < kInitialMeshes; ++i) {
+        addMesh();
+    }
+
+    FMaterialCache         materialCache{};
+    FSceneBatchBuilder     builder{};
+    FSceneDrawListCache    cache{};
+    FSceneBatchBuildParams params{};
+    params.Pass                  = EMaterialPass::BasePass;
+    params.bAllowInstancing      = true;
+    params.bEnableFrustumCulling = true;
+
+    const FSceneView                            view = MakeView();
+    AltinaEngine::RenderCore::Render::FDrawList reference{};
+    AltinaEngine::RenderCore::Render::FDrawList snapshotReference{};
+    bool                                        bAllMatched = true;
+    u32                                         copies      = 0U;
+    for (u32 frame = 0U; frame < kFrames; ++frame) {
+        // Every few frames the render thread still holds the previous list.
+        FSceneDrawListCache::FSharedDrawList snapshot{};
+        if (frame % 5U == 0U) {
+            snapshot = cache.ShareDrawList();
+            builder.Build(scene, view, params, materialCache, snapshotReference);
+        }
+
+        const u32 edits = next(4U);
+        for (u32 edit = 0U; edit < edits; ++edit) {
+            if (scene.StaticMeshes.IsEmpty()) {
+                addMesh();
+            }
+            auto& entry = scene.StaticMeshes[next(static_cast<u32>(scene.StaticMeshes.Size()))];
+            switch (next(5U)) {
+                case 0U: // Leave or re-enter the view.
+                    entry.WorldMatrix(2, 3) = (entry.WorldMatrix(2, 3) > 0.0f) ? -5.0f : 5.0f;
+                    ++entry.TransformRevision;
+                    break;
+                case 1U:
+                    entry.WorldMatrix(0, 3) = static_cast<f32>(next(9U)) - 4.0f;
+                    ++entry.TransformRevision;
+                    break;
+                case 2U:
+                    entry.Materials = &materials[next(kMaterialCount)];
+                    break;
+                case 3U:
+                    addMesh();
+                    break;
+                default: // Swap-remove, which also moves another entry to a new scene index.
+                    entry = scene.StaticMeshes[scene.StaticMeshes.Size() - 1U];
+                    scene.StaticMeshes.PopBack();
+                    break;
+            }
+        }
+
+        builder.Build(scene, view, params, materialCache, cache);
+        builder.Build(scene, view, params, materialCache, reference);
+        bAllMatched = bAllMatched && DrawListsMatch(cache.GetDrawList(), reference);
+        if (snapshot.Get() != nullptr) {
+            bAllMatched = bAllMatched && DrawListsMatch(*snapshot.Get(), snapshotReference);
+            if (cache.GetStats().bCopiedShared) {
+                ++copies;
+                REQUIRE(snapshot.Get() != &cache.GetDrawList());
+            }
+        }
+    }
+    REQUIRE(bAllMatched);
+    REQUIRE(copies > 0U);
+}
+
+BENCHMARK_CASE("GameScene.SceneBatching.RetainedCacheBenchmark") {
+    FMaterialConverterGuard converterGuard(
+        [](const FAssetHandle&, const AltinaEngine::Asset::FMeshMaterialParameterBlock&) {
+            return FMaterial{};
+        });
+
+    constexpr u32                   kMeshCount     = 20000U;
+    constexpr u32                   kMaterialCount = 16U;
+    constexpr u32                   kFrames        = 10U;
+    FStaticMeshData                 meshes[4]      = { MakeStaticMesh(), MakeStaticMesh(),
+                        MakeStaticMesh(), MakeStaticMesh() };
+    AltinaEngine::Core::Container::TVector<FMeshMaterialComponent> materials;
+    for (u32 i = 0U; i < kMaterialCount; ++i) {
+        materials.PushBack(MakeMaterialComponent(MakeMaterialHandle(static_cast<u8>(i))));
+    }
+
+    FRenderScene scene{};
+    scene.StaticMeshes.Reserve(kMeshCount);
+    for (u32 i = 0U; i < kMeshCount; ++i) {
+        const u32 meshIndex = (i / kMaterialCount) % 4U;
+        scene.StaticMeshes.PushBack(MakeSceneEntry(meshes[meshIndex], materials[i % kMaterialCount],
+            AltinaEngine::Core::Math::FVector3f(
+                static_cast<f32>(i % 100U) * 0.2f - 10.0f, 0.0f, 20.0f)));
+    }
+    AssignMeshComponentIds(scene);
+
+    FMaterialCache         materialCache{};
+    FSceneBatchBuilder     builder{};
+    FSceneDrawListCache    cache{};
+    FSceneBatchBuildParams params{};
+    params.Pass             = EMaterialPass::BasePass;
+    params.bAllowInstancing = true;
+    const FSceneView                            view = MakeView();
+    AltinaEngine::RenderCore::Render::FDrawList drawList{};
+    // Frames run through the frame arena like the engine loop does; heap allocations per frame
+    // are what is left over (output draw list and retained cache).
+    u64        heapAllocations = 0ULL;
+    const auto measureMs       = [&](auto&& build, auto&& changeScene) {
+        FFrameMemory::BeginFrame();
+        build(); // warm up
+        const u64  allocationsBefore = GetMemoryTagStats(EMemoryTag::Default).mTotalAllocations;
+        const auto start             = std::chrono::steady_clock::now();
+        for (u32 frame = 0U; frame < kFrames; ++frame) {
+            FFrameMemory::BeginFrame();
+            changeScene(frame);
+            build();
+        }
+        const double ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                .count();
+        heapAllocations =
+            (GetMemoryTagStats(EMemoryTag::Default).mTotalAllocations - allocationsBefore)
+            / kFrames;
+        return ms / static_cast<double>(kFrames);
+    };
+    const auto fullBuild = [&]() {
+        builder.Build(scene, view, params, materialCache, drawList);
+    };
+    const auto retainedBuild = [&]() {
+        builder.Build(scene, view, params, materialCache, cache);
+    };
+    const auto moveOne = [&](u32 frame) {
+        scene.StaticMeshes[frame].WorldMatrix(1, 3) = static_cast<f32>(frame) * 0.01f;
+    };
+    // Every other frame a mesh leaves the view, and comes back on the next one.
+    const auto toggleOne = [&](u32 frame) {
+        scene.StaticMeshes[(frame / 2U) * 7U].WorldMatrix(2, 3) =
+            (frame % 2U == 0U) ? -20.0f : 20.0f;
+    };
+
+    const double rebuildMs           = measureMs(fullBuild, moveOne);
+    const u64    rebuildAllocations  = heapAllocations;
+    const double retainedMs          = measureMs(retainedBuild, moveOne);
+    const u64    retainedAllocations = heapAllocations;
+    REQUIRE(cache.GetStats().bStructureReused);
+    const double patchedMs = measureMs(retainedBuild, toggleOne);
+    FFrameMemory::ShutdownThread();
+
+    std::cout << "[Bench][SceneBatching] meshes=" << kMeshCount
+              << " full rebuild=" << rebuildMs << " ms/frame, retained=" << retainedMs
+              << " ms/frame, retained with visibility changes=" << patchedMs
+              << " ms/frame, hit rate=" << cache.GetStats().GetHitRate() << "\n";
+    std::cout << "[Bench][SceneBatching] heap allocations/frame: full rebuild="
+              << rebuildAllocations << ", retained=" << retainedAllocations
+              << ", retained with visibility changes=" << heapAllocations << "\n";
+    REQUIRE_EQ(drawList.GetBatchCount(), 64U);
+    builder.Build(scene, view, params, materialCache, drawList);
+    REQUIRE(DrawListsMatch(cache.GetDrawList(), drawList));
+}
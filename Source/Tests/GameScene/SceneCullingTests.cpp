@@ -0,0 +1,252 @@
+#include "TestHarness.h"
+
+#include "Engine/Runtime/SceneCulling.h"
+#include "Geometry/StaticMeshData.h"
+#include "Math/LinAlg/Common.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace {
+    using AltinaEngine::f32;
+    using AltinaEngine::u32;
+    using AltinaEngine::Core::Math::FMatrix4x4f;
+    using AltinaEngine::Core::Math::FVector3f;
+    using AltinaEngine::Core::Math::FVector4f;
+    using AltinaEngine::Engine::FRenderScene;
+    using AltinaEngine::Engine::FSceneBoundsCache;
+    using AltinaEngine::Engine::FSceneBoundsSoA;
+    using AltinaEngine::Engine::FSceneStaticMesh;
+    using AltinaEngine::Engine::FSceneView;
+    using AltinaEngine::Engine::FSceneVisibility;
+    using AltinaEngine::RenderCore::Geometry::FStaticMeshData;
+    using AltinaEngine::RenderCore::View::FRenderTargetExtent2D;
+    using AltinaEngine::RenderCore::View::FViewRect;
+
+    auto MakeUnitMesh() -> FStaticMeshData {
+        FStaticMeshData mesh{};
+        mesh.mLods.Resize(1U);
+        mesh.mLods[0].mBounds.Min = FVector3f(-0.5f, -0.5f, -0.5f);
+        mesh.mLods[0].mBounds.Max = FVector3f(0.5f, 0.5f, 0.5f);
+        mesh.mBounds              = mesh.mLods[0].mBounds;
+        return mesh;
+    }
+
+    auto MakeView() -> FSceneView {
+        FSceneView view{};
+        view.View.ViewRect           = FViewRect{ 0, 0, 1280U, 720U };
+        view.View.RenderTargetExtent = FRenderTargetExtent2D{ 1280U, 720U };
+        view.View.Camera.mNearPlane  = 0.1f;
+        view.View.Camera.mFarPlane   = 100.0f;
+        view.View.BeginFrame();
+        return view;
+    }
+
+    // Reference: transform the 8 corners to clip space and reject when all of them are outside
+    // the same clip plane (the pre-SoA culling test).
+    auto IsVisibleReference(const FMatrix4x4f& viewProj, const FMatrix4x4f& world) -> bool {
+        bool outside[6] = { true, true, true, true, true, true };
+        for (u32 corner = 0U; corner < 8U; ++corner) {
+            const FVector4f local((corner & 1U) ? 0.5f : -0.5f, (corner & 2U) ? 0.5f : -0.5f,
+                (corner & 4U) ? 0.5f : -0.5f, 1.0f);
+            const FVector4f clip = AltinaEngine::Core::Math::MatMul(
+                viewProj, AltinaEngine::Core::Math::MatMul(world, local));
+            outside[0] = outside[0] && clip[0] < -clip[3];
+            outside[1] = outside[1] && clip[0] > clip[3];
+            outside[2] = outside[2] && clip[1] < -clip[3];
+            outside[3] = outside[3] && clip[1] > clip[3];
+            outside[4] = outside[4] && clip[2] < 0.0f;
+            outside[5] = outside[5] && clip[2] > clip[3];
+        }
+        for (const bool out : outside) {
+            if (out) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void FillScene(FRenderScene& scene, const FStaticMeshData& mesh, u32 count, u32 seed) {
+        std::mt19937                          rng(seed);
+        std::uniform_real_distribution<float> position(-80.0f, 80.0f);
+        std::uniform_real_distribution<float> scale(0.2f, 4.0f);
+        scene.StaticMeshes.Clear();
+        scene.StaticMeshes.Reserve(count);
+        for (u32 i = 0U; i < count; ++i) {
+            FSceneStaticMesh entry{};
+            entry.Mesh                  = &mesh;
+            entry.WorldMatrix           = AltinaEngine::Core::Math::LinAlg::Identity<f32, 4U>();
+            entry.WorldMatrix(0, 0)     = scale(rng);
+            entry.WorldMatrix(1, 1)     = scale(rng);
+            entry.WorldMatrix(2, 2)     = scale(rng);
+            entry.WorldMatrix(0, 3)     = position(rng);
+            entry.WorldMatrix(1, 3)     = position(rng);
+            entry.WorldMatrix(2, 3)     = position(rng);
+            entry.PrevWorldMatrix       = entry.WorldMatrix;
+            entry.MeshComponentId.Index = i;
+            entry.TransformRevision     = 1ULL;
+            entry.MeshRevision          = 1ULL;
+            scene.StaticMeshes.PushBack(entry);
+        }
+    }
+
+    template <typename Fn> auto MeasureMs(Fn&& fn) -> double {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
+} // namespace
+
+TEST_CASE("Engine.SceneCulling.PlaneCullMatchesCornerReference") {
+    const FStaticMeshData mesh = MakeUnitMesh();
+    FRenderScene          scene{};
+    FillScene(scene, mesh, 1003U, 7U); // not a multiple of the lane count
+
+    FSceneBoundsSoA bounds{};
+    AltinaEngine::Engine::BuildSceneBounds(scene, 0U, bounds);
+    REQUIRE(bounds.IsBuiltFor(scene, 0U));
+
+    const FSceneView view      = MakeView();
+    FVector4f        planes[6] = { FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f),
+               FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f) };
+    AltinaEngine::Engine::ExtractFrustumPlanes(view.View.Matrices.ViewProj, planes);
+
+    FSceneVisibility visibility{};
+    AltinaEngine::Engine::InitSceneVisibility(bounds, visibility);
+    REQUIRE_EQ(visibility.CountVisible(), 1003U);
+    AltinaEngine::Engine::CullSceneBoundsAgainstPlanes(bounds, planes, 6U, visibility);
+
+    u32 mismatches = 0U;
+    u32 visible    = 0U;
+    for (u32 i = 0U; i < bounds.Count; ++i) {
+        const bool expected =
+            IsVisibleReference(view.View.Matrices.ViewProj, scene.StaticMeshes[i].WorldMatrix);
+        visible += expected ? 1U : 0U;
+        mismatches += (expected != visibility.IsVisible(i)) ? 1U : 0U;
+    }
+    REQUIRE_EQ(mismatches, 0U);
+    REQUIRE(visible > 0U);
+    REQUIRE(visible < bounds.Count);
+}
+
+TEST_CASE("Engine.SceneCulling.EntriesWithoutBoundsAreNeverCulled") {
+    FStaticMeshData mesh = MakeUnitMesh();
+    mesh.mLods[0].mBounds = {};
+    FRenderScene scene{};
+    FillScene(scene, mesh, 8U, 3U);
+
+    FSceneBoundsSoA bounds{};
+    AltinaEngine::Engine::BuildSceneBounds(scene, 0U, bounds);
+
+    // A plane nothing can be inside of.
+    const FVector4f  plane(0.0f, 0.0f, 0.0f, -1.0f);
+    FSceneVisibility visibility{};
+    AltinaEngine::Engine::InitSceneVisibility(bounds, visibility);
+    AltinaEngine::Engine::CullSceneBoundsAgainstPlanes(bounds, &plane, 1U, visibility);
+    AltinaEngine::Engine::CullSceneBoundsBelowRadius(bounds, 100.0f, visibility);
+    REQUIRE_EQ(visibility.CountVisible(), 8U);
+
+    // Entries whose LOD does not exist are not renderable at all.
+    AltinaEngine::Engine::BuildSceneBounds(scene, 1U, bounds);
+    AltinaEngine::Engine::InitSceneVisibility(bounds, visibility);
+    REQUIRE_EQ(visibility.CountVisible(), 0U);
+}
+
+TEST_CASE("Engine.SceneCulling.BoundsCacheRecomputesOnlyChangedEntries") {
+    const FStaticMeshData mesh = MakeUnitMesh();
+    FRenderScene          scene{};
+    FillScene(scene, mesh, 37U, 5U);
+    scene.BuildSerial = 1ULL;
+
+    FSceneBoundsCache cache{};
+    cache.Update(scene, 0U);
+    REQUIRE_EQ(cache.GetStats().Updated, 37U);
+    REQUIRE_EQ(cache.GetStats().Reused, 0U);
+    REQUIRE(&scene.GetStaticMeshBounds() == &cache.GetBounds());
+    REQUIRE(cache.GetBounds().IsBuiltFor(scene, 0U));
+
+    // A new build of the same scene invalidates bounds that were not updated for it.
+    FRenderScene rebuilt = scene;
+    rebuilt.BuildSerial  = 2ULL;
+    REQUIRE(!cache.GetBounds().IsBuiltFor(rebuilt, 0U));
+
+    rebuilt.StaticMeshes[3].WorldMatrix(0, 3) += 10.0f;
+    ++rebuilt.StaticMeshes[3].TransformRevision;
+    cache.Update(rebuilt, 0U);
+    REQUIRE_EQ(cache.GetStats().Updated, 1U);
+    REQUIRE_EQ(cache.GetStats().Reused, 36U);
+    REQUIRE(cache.GetBounds().IsBuiltFor(rebuilt, 0U));
+
+    FSceneBoundsSoA reference{};
+    AltinaEngine::Engine::BuildSceneBounds(rebuilt, 0U, reference);
+    const FSceneBoundsSoA& cached = cache.GetBounds();
+    REQUIRE_EQ(cached.Renderable.Size(), reference.Renderable.Size());
+    u32 mismatches = 0U;
+    for (u32 word = 0U; word < cached.Renderable.Size(); ++word) {
+        mismatches += (cached.Renderable[word] != reference.Renderable[word]) ? 1U : 0U;
+        mismatches += (cached.HasBounds[word] != reference.HasBounds[word]) ? 1U : 0U;
+    }
+    for (u32 i = 0U; i < cached.Count; ++i) {
+        mismatches += (cached.CenterX[i] != reference.CenterX[i]) ? 1U : 0U;
+        mismatches += (cached.CenterY[i] != reference.CenterY[i]) ? 1U : 0U;
+        mismatches += (cached.CenterZ[i] != reference.CenterZ[i]) ? 1U : 0U;
+        mismatches += (cached.ExtentX[i] != reference.ExtentX[i]) ? 1U : 0U;
+        mismatches += (cached.ExtentY[i] != reference.ExtentY[i]) ? 1U : 0U;
+        mismatches += (cached.ExtentZ[i] != reference.ExtentZ[i]) ? 1U : 0U;
+    }
+    REQUIRE_EQ(mismatches, 0U);
+
+    // Scenes from another world never reuse entries, even with matching ids and revisions.
+    rebuilt.WorldId     = 7U;
+    rebuilt.BuildSerial = 3ULL;
+    cache.Update(rebuilt, 0U);
+    REQUIRE_EQ(cache.GetStats().Updated, 37U);
+}
+
+BENCHMARK_CASE("Engine.SceneCulling.Benchmark") {
+    constexpr u32         kCount = 200000U;
+    const FStaticMeshData mesh   = MakeUnitMesh();
+    FRenderScene          scene{};
+    FillScene(scene, mesh, kCount, 11U);
+
+    const FSceneView view      = MakeView();
+    FVector4f        planes[6] = { FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f),
+               FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f) };
+    AltinaEngine::Engine::ExtractFrustumPlanes(view.View.Matrices.ViewProj, planes);
+
+    FSceneBoundsSoA bounds{};
+    const double    buildMs =
+        MeasureMs([&]() { AltinaEngine::Engine::BuildSceneBounds(scene, 0U, bounds); });
+
+    // Persistent bounds: a steady-state frame only revalidates the entry keys.
+    FSceneBoundsCache cache{};
+    cache.Update(scene, 0U);
+    const double cachedMs = MeasureMs([&]() { cache.Update(scene, 0U); });
+
+    // Five passes (base + four cascades) reuse the same bounds.
+    FSceneVisibility visibility{};
+    const double     cullMs = MeasureMs([&]() {
+        for (u32 pass = 0U; pass < 5U; ++pass) {
+            AltinaEngine::Engine::InitSceneVisibility(bounds, visibility);
+            AltinaEngine::Engine::CullSceneBoundsAgainstPlanes(bounds, planes, 6U, visibility);
+        }
+    });
+
+    u32          referenceVisible = 0U;
+    const double referenceMs      = MeasureMs([&]() {
+        for (u32 i = 0U; i < kCount; ++i) {
+            referenceVisible +=
+                IsVisibleReference(view.View.Matrices.ViewProj, scene.StaticMeshes[i].WorldMatrix)
+                     ? 1U
+                     : 0U;
+        }
+    });
+
+    std::cout << "[Bench][SceneCulling] meshes=" << kCount << " bounds build=" << buildMs
+              << " ms, cached update=" << cachedMs << " ms, 5 passes SoA cull=" << cullMs
+              << " ms, 1 pass corner reference=" << referenceMs << " ms\n";
+    REQUIRE_EQ(visibility.CountVisible(), referenceVisible);
+    REQUIRE_EQ(cache.GetStats().Reused, kCount);
+}
@@ -0,0 +1,280 @@
+#include "TestHarness.h"
+
+#include "Engine/Runtime/SceneSpatialIndex.h"
+#include "Geometry/StaticMeshData.h"
+#include "Math/LinAlg/Common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+    using AltinaEngine::f32;
+    using AltinaEngine::u32;
+    using AltinaEngine::Core::Math::FVector3f;
+    using AltinaEngine::Core::Math::FVector4f;
+    using AltinaEngine::Engine::FRenderScene;
+    using AltinaEngine::Engine::FSceneSpatialIndex;
+    using AltinaEngine::Engine::FSceneStaticMesh;
+    using AltinaEngine::Engine::FSceneView;
+    using AltinaEngine::Engine::FSceneVisibility;
+    using AltinaEngine::GameScene::FComponentId;
+    using AltinaEngine::RenderCore::Geometry::FStaticMeshData;
+    using AltinaEngine::RenderCore::View::FRenderTargetExtent2D;
+    using AltinaEngine::RenderCore::View::FViewRect;
+
+    auto MakeUnitMesh() -> FStaticMeshData {
+        FStaticMeshData mesh{};
+        mesh.mLods.Resize(1U);
+        mesh.mLods[0].mBounds.Min = FVector3f(-0.5f, -0.5f, -0.5f);
+        mesh.mLods[0].mBounds.Max = FVector3f(0.5f, 0.5f, 0.5f);
+        mesh.mBounds              = mesh.mLods[0].mBounds;
+        return mesh;
+    }
+
+    auto MakeView(f32 fovY) -> FSceneView {
+        FSceneView view{};
+        view.View.ViewRect                   = FViewRect{ 0, 0, 1280U, 720U };
+        view.View.RenderTargetExtent         = FRenderTargetExtent2D{ 1280U, 720U };
+        view.View.Camera.mVerticalFovRadians = fovY;
+        view.View.Camera.mNearPlane          = 0.1f;
+        view.View.Camera.mFarPlane           = 150.0f;
+        view.View.BeginFrame();
+        return view;
+    }
+
+    auto MakeKey(u32 index) -> FComponentId {
+        FComponentId id{};
+        id.Index      = index;
+        id.Generation = 1U;
+        id.Type       = 1U;
+        return id;
+    }
+
+    struct FSceneFixture {
+        FStaticMeshData                       Mesh = MakeUnitMesh();
+        std::mt19937                          Rng{ 5U };
+        std::uniform_real_distribution<float> Position{ -100.0f, 100.0f };
+        FRenderScene                          Scene{};
+        u32                                   NextKey = 1U;
+
+        void Place(FSceneStaticMesh& entry) {
+            entry.WorldMatrix       = AltinaEngine::Core::Math::LinAlg::Identity<f32, 4U>();
+            entry.WorldMatrix(0, 3) = Position(Rng);
+            entry.WorldMatrix(1, 3) = Position(Rng);
+            entry.WorldMatrix(2, 3) = Position(Rng);
+        }
+
+        void Add(u32 count) {
+            for (u32 i = 0U; i < count; ++i) {
+                FSceneStaticMesh entry{};
+                entry.Mesh            = &Mesh;
+                entry.MeshComponentId = MakeKey(NextKey++);
+                Place(entry);
+                Scene.StaticMeshes.PushBack(entry);
+            }
+        }
+
+        // Rebuild the per-frame data the way FSceneViewBuilder does and sync the index.
+        void Sync(FSceneSpatialIndex& index) {
+            AltinaEngine::Engine::BuildSceneBounds(Scene, 0U, Scene.StaticMeshBounds);
+            index.Sync(Scene);
+        }
+    };
+
+    auto BruteForcePlanes(const FRenderScene& scene, const FVector4f* planes, u32 planeCount)
+        -> FSceneVisibility {
+        FSceneVisibility visibility{};
+        AltinaEngine::Engine::InitSceneVisibility(scene.StaticMeshBounds, visibility);
+        AltinaEngine::Engine::CullSceneBoundsAgainstPlanes(
+            scene.StaticMeshBounds, planes, planeCount, visibility);
+        return visibility;
+    }
+
+    auto SameBits(const FSceneVisibility& lhs, const FSceneVisibility& rhs) -> bool {
+        if (lhs.Count != rhs.Count) {
+            return false;
+        }
+        for (u32 i = 0U; i < lhs.Count; ++i) {
+            if (lhs.IsVisible(i) != rhs.IsVisible(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void ExtractPlanes(const FSceneView& view, FVector4f (&planes)[6]) {
+        AltinaEngine::Engine::ExtractFrustumPlanes(view.View.Matrices.ViewProj, planes);
+    }
+
+    template <typename Fn> auto MeasureMs(Fn&& fn) -> double {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
+} // namespace
+
+TEST_CASE("Engine.SceneSpatialIndex.IncrementalSyncMatchesBruteForce") {
+    FSceneFixture      fixture{};
+    FSceneSpatialIndex index{};
+    fixture.Add(2000U);
+    fixture.Sync(index);
+    REQUIRE(index.IsSyncedWith(fixture.Scene));
+    REQUIRE_EQ(index.GetStats().Inserted, 2000U);
+    REQUIRE_EQ(index.GetStats().ProxyCount, 2000U);
+
+    const FSceneView view      = MakeView(1.0f);
+    FVector4f        planes[6] = { FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f),
+               FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f) };
+    ExtractPlanes(view, planes);
+
+    FSceneVisibility visibility{};
+    index.QueryPlanes(planes, 6U, visibility);
+    REQUIRE(SameBits(visibility, BruteForcePlanes(fixture.Scene, planes, 6U)));
+
+    // Unchanged frame: nothing touches the hierarchy.
+    fixture.Sync(index);
+    REQUIRE_EQ(index.GetStats().Inserted, 0U);
+    REQUIRE_EQ(index.GetStats().Moved, 0U);
+    REQUIRE_EQ(index.GetStats().Removed, 0U);
+
+    // Jitter stays inside the enlarged leaf boxes.
+    for (u32 i = 0U; i < 100U; ++i) {
+        fixture.Scene.StaticMeshes[i].WorldMatrix(0, 3) += 0.01f;
+    }
+    fixture.Sync(index);
+    REQUIRE_EQ(index.GetStats().Moved, 0U);
+
+    // Teleport some, drop some (reordering the rest) and add new ones.
+    for (u32 i = 0U; i < 300U; ++i) {
+        fixture.Place(fixture.Scene.StaticMeshes[i * 5U]);
+    }
+    auto& meshes = fixture.Scene.StaticMeshes;
+    for (u32 i = 0U; i < 200U; ++i) {
+        meshes[i * 7U] = meshes.Back();
+        meshes.PopBack();
+    }
+    fixture.Add(150U);
+    fixture.Sync(index);
+
+    const auto stats = index.GetStats();
+    REQUIRE_EQ(stats.Inserted, 150U);
+    REQUIRE_EQ(stats.Removed, 200U);
+    REQUIRE(stats.Moved > 0U);
+    REQUIRE_EQ(stats.ProxyCount, 1950U);
+    REQUIRE(stats.TreeHeight < 40U);
+
+    index.QueryPlanes(planes, 6U, visibility);
+    REQUIRE(SameBits(visibility, BruteForcePlanes(fixture.Scene, planes, 6U)));
+
+    // A scene that was not synced (or changed since) is not served by the index.
+    fixture.Add(1U);
+    REQUIRE(!index.IsSyncedWith(fixture.Scene));
+}
+
+TEST_CASE("Engine.SceneSpatialIndex.BoxSphereAndUnindexedEntries") {
+    FSceneFixture      fixture{};
+    FSceneSpatialIndex index{};
+    fixture.Add(500U);
+
+    // One entry without bounds and one sharing another entry's key.
+    FStaticMeshData unbounded = MakeUnitMesh();
+    unbounded.mLods[0].mBounds = {};
+    FSceneStaticMesh noBounds = fixture.Scene.StaticMeshes[0];
+    noBounds.Mesh             = &unbounded;
+    noBounds.MeshComponentId  = MakeKey(100000U);
+    fixture.Scene.StaticMeshes.PushBack(noBounds);
+    FSceneStaticMesh duplicate = fixture.Scene.StaticMeshes[1];
+    fixture.Place(duplicate);
+    fixture.Scene.StaticMeshes.PushBack(duplicate);
+    fixture.Sync(index);
+    REQUIRE_EQ(index.GetStats().Unindexed, 2U);
+
+    const FVector3f boxMin(-20.0f, -20.0f, -20.0f);
+    const FVector3f boxMax(30.0f, 10.0f, 25.0f);
+    const FVector3f center(10.0f, -5.0f, 3.0f);
+    const f32       radius = 25.0f;
+
+    std::vector<u32> expectedBox;
+    std::vector<u32> expectedSphere;
+    const auto&      bounds = fixture.Scene.StaticMeshBounds;
+    for (u32 i = 0U; i < bounds.Count; ++i) {
+        if (((bounds.HasBounds[i >> 6U] >> (i & 63U)) & 1ULL) == 0ULL) {
+            expectedBox.push_back(i);
+            expectedSphere.push_back(i);
+            continue;
+        }
+        const f32 c[3] = { bounds.CenterX[i], bounds.CenterY[i], bounds.CenterZ[i] };
+        const f32 e[3] = { bounds.ExtentX[i], bounds.ExtentY[i], bounds.ExtentZ[i] };
+        bool      overlapsBox = true;
+        f32       distanceSq  = 0.0f;
+        for (u32 axis = 0U; axis < 3U; ++axis) {
+            overlapsBox = overlapsBox && c[axis] + e[axis] >= boxMin[axis]
+                && c[axis] - e[axis] <= boxMax[axis];
+            const f32 clamped = std::clamp(center[axis], c[axis] - e[axis], c[axis] + e[axis]);
+            distanceSq += (center[axis] - clamped) * (center[axis] - clamped);
+        }
+        if (overlapsBox) {
+            expectedBox.push_back(i);
+        }
+        if (distanceSq <= radius * radius) {
+            expectedSphere.push_back(i);
+        }
+    }
+
+    AltinaEngine::Core::Container::TVector<u32> hits;
+    index.QueryBox(boxMin, boxMax, hits);
+    std::vector<u32> boxHits(hits.Data(), hits.Data() + hits.Size());
+    std::sort(boxHits.begin(), boxHits.end());
+    REQUIRE(boxHits == expectedBox);
+
+    hits.Clear();
+    index.QuerySphere(center, radius, hits);
+    std::vector<u32> sphereHits(hits.Data(), hits.Data() + hits.Size());
+    std::sort(sphereHits.begin(), sphereHits.end());
+    REQUIRE(sphereHits == expectedSphere);
+}
+
+BENCHMARK_CASE("Engine.SceneSpatialIndex.Benchmark") {
+    constexpr u32      kCount = 50000U;
+    FSceneFixture      fixture{};
+    FSceneSpatialIndex index{};
+    fixture.Add(kCount);
+
+    const double buildMs = MeasureMs([&]() { fixture.Sync(index); });
+    for (u32 i = 0U; i < kCount; i += 100U) {
+        fixture.Place(fixture.Scene.StaticMeshes[i]);
+    }
+    const double resyncMs = MeasureMs([&]() { fixture.Sync(index); });
+
+    // A narrow view sees a small fraction of the level.
+    const FSceneView view      = MakeView(0.35f);
+    FVector4f        planes[6] = { FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f),
+               FVector4f(0.0f), FVector4f(0.0f), FVector4f(0.0f) };
+    ExtractPlanes(view, planes);
+
+    constexpr u32    kPasses = 5U; // base pass + four cascades
+    FSceneVisibility visibility{};
+    const double     treeMs = MeasureMs([&]() {
+        for (u32 pass = 0U; pass < kPasses; ++pass) {
+            index.QueryPlanes(planes, 6U, visibility);
+        }
+    });
+    FSceneVisibility reference{};
+    const double     flatMs = MeasureMs([&]() {
+        for (u32 pass = 0U; pass < kPasses; ++pass) {
+            reference = BruteForcePlanes(fixture.Scene, planes, 6U);
+        }
+    });
+
+    const auto stats = index.GetStats();
+    std::cout << "[Bench][SceneSpatialIndex] meshes=" << kCount
+              << " visible=" << visibility.CountVisible() << " height=" << stats.TreeHeight
+              << " build=" << buildMs << " ms, resync(1% moved=" << stats.Moved
+              << ")=" << resyncMs << " ms, " << kPasses << " passes bvh=" << treeMs
+              << " ms vs flat SoA=" << flatMs << " ms\n";
+    REQUIRE(SameBits(visibility, reference));
+}
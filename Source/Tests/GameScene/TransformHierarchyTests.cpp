@@ -0,0 +1,156 @@
+#include "TestHarness.h"
+
+#include "Engine/GameScene/World.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace {
+    using AltinaEngine::f32;
+    using AltinaEngine::u32;
+    using AltinaEngine::usize;
+    using AltinaEngine::Core::Math::FVector3f;
+    using AltinaEngine::Core::Math::LinAlg::FSpatialTransform;
+    using AltinaEngine::GameScene::FGameObjectId;
+    using AltinaEngine::GameScene::FWorld;
+
+    auto MakeTranslation(f32 x, f32 y, f32 z) -> FSpatialTransform {
+        FSpatialTransform transform = FSpatialTransform::Identity();
+        transform.Translation       = FVector3f(x, y, z);
+        return transform;
+    }
+
+    auto WorldX(FWorld& world, FGameObjectId id) -> f32 {
+        return world.Object(id).GetWorldTransform().Translation.X();
+    }
+
+    // Builds `count` nodes where node i (i > 0) is parented to node (i - 1) / branching, i.e.
+    // a complete tree with the given fan-out. Returns ids in creation order.
+    auto BuildTree(FWorld& world, usize count, usize branching) -> std::vector<FGameObjectId> {
+        std::vector<FGameObjectId> ids;
+        ids.reserve(count);
+        for (usize i = 0; i < count; ++i) {
+            auto object = world.CreateGameObject();
+            object.SetLocalTransform(MakeTranslation(1.0f, 0.0f, 0.0f));
+            if (i > 0) {
+                object.SetParent(ids[(i - 1) / branching]);
+            }
+            ids.push_back(object.GetId());
+        }
+        return ids;
+    }
+
+    template <typename Fn> auto MeasureMs(Fn&& fn) -> double {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
+} // namespace
+
+TEST_CASE("GameScene.World.Transforms.ChildCreatedBeforeParentResolves") {
+    FWorld world;
+
+    // Creation order deliberately puts the child's slot before its parent's.
+    auto   child  = world.CreateGameObject();
+    auto   parent = world.CreateGameObject();
+    child.SetLocalTransform(MakeTranslation(1.0f, 0.0f, 0.0f));
+    parent.SetLocalTransform(MakeTranslation(10.0f, 0.0f, 0.0f));
+    child.SetParent(parent.GetId());
+
+    world.UpdateTransforms();
+    REQUIRE_CLOSE(WorldX(world, child.GetId()), 11.0f, 1e-5f);
+
+    parent.SetLocalTransform(MakeTranslation(20.0f, 0.0f, 0.0f));
+    world.UpdateTransforms();
+    REQUIRE_CLOSE(WorldX(world, child.GetId()), 21.0f, 1e-5f);
+}
+
+TEST_CASE("GameScene.World.Transforms.ReparentAndDestroyRebuildHierarchy") {
+    FWorld world;
+    auto   a     = world.CreateGameObject();
+    auto   b     = world.CreateGameObject();
+    auto   child = world.CreateGameObject();
+    a.SetLocalTransform(MakeTranslation(5.0f, 0.0f, 0.0f));
+    b.SetLocalTransform(MakeTranslation(100.0f, 0.0f, 0.0f));
+    child.SetLocalTransform(MakeTranslation(1.0f, 0.0f, 0.0f));
+    child.SetParent(a.GetId());
+    world.UpdateTransforms();
+    REQUIRE_CLOSE(WorldX(world, child.GetId()), 6.0f, 1e-5f);
+
+    child.SetParent(b.GetId());
+    world.UpdateTransforms();
+    REQUIRE_CLOSE(WorldX(world, child.GetId()), 101.0f, 1e-5f);
+
+    // A destroyed parent leaves the child as a root that keeps its last world transform.
+    world.DestroyGameObject(b);
+    world.UpdateTransforms();
+    REQUIRE_CLOSE(WorldX(world, child.GetId()), 101.0f, 1e-5f);
+
+    child.ClearParent();
+    world.UpdateTransforms();
+    REQUIRE_CLOSE(WorldX(world, child.GetId()), 1.0f, 1e-5f);
+}
+
+TEST_CASE("GameScene.World.Transforms.DeepChainAndParentCycle") {
+    FWorld     world;
+    const auto chain = BuildTree(world, 20000, 1);
+    world.UpdateTransforms();
+    REQUIRE_CLOSE(WorldX(world, chain.back()), 20000.0f, 1e-1f);
+
+    // Cycles are invalid but must not hang the update.
+    auto x = world.CreateGameObject();
+    auto y = world.CreateGameObject();
+    x.SetParent(y.GetId());
+    y.SetParent(x.GetId());
+    world.UpdateTransforms();
+    REQUIRE(world.IsAlive(x.GetId()));
+}
+
+TEST_CASE("GameScene.World.Transforms.WideLevelsMatchSerialReference") {
+    FWorld     world;
+    const auto ids = BuildTree(world, 50000, 16);
+    world.UpdateTransforms();
+
+    // Node i sits at depth d(i) and each level adds one unit along X.
+    std::vector<u32> depth(ids.size(), 0U);
+    bool             allMatch = true;
+    for (usize i = 0; i < ids.size(); ++i) {
+        depth[i] = (i == 0) ? 0U : depth[(i - 1) / 16] + 1U;
+        allMatch = allMatch && (WorldX(world, ids[i]) == static_cast<f32>(depth[i] + 1U));
+    }
+    REQUIRE(allMatch);
+
+    world.Object(ids[0]).SetLocalTransform(MakeTranslation(3.0f, 0.0f, 0.0f));
+    world.UpdateTransforms();
+    REQUIRE_CLOSE(WorldX(world, ids.back()), static_cast<f32>(depth.back() + 3U), 1e-4f);
+}
+
+BENCHMARK_CASE("GameScene.World.Transforms.Benchmark100k") {
+    constexpr usize kNodeCount = 100000;
+    const usize     branchings[] = { 4, 64, 1 };
+
+    for (const usize branching : branchings) {
+        FWorld     world;
+        const auto ids = BuildTree(world, kNodeCount, branching);
+
+        const double rebuildMs = MeasureMs([&]() { world.UpdateTransforms(); });
+
+        world.Object(ids[0]).SetLocalTransform(MakeTranslation(2.0f, 0.0f, 0.0f));
+        const double fullMs = MeasureMs([&]() { world.UpdateTransforms(); });
+
+        for (usize i = 0; i < kNodeCount; i += 100) {
+            world.Object(ids[i]).SetLocalTransform(MakeTranslation(1.0f, 1.0f, 0.0f));
+        }
+        const double sparseMs = MeasureMs([&]() { world.UpdateTransforms(); });
+        const double cleanMs  = MeasureMs([&]() { world.UpdateTransforms(); });
+
+        std::cout << "[Bench][TransformHierarchy] nodes=" << kNodeCount
+                  << " branching=" << branching << " rebuild+update=" << rebuildMs
+                  << " ms root-dirty=" << fullMs << " ms 1%-dirty=" << sparseMs
+                  << " ms clean=" << cleanMs << " ms\n";
+
+        REQUIRE(world.Object(ids.back()).GetWorldTransform().Translation.X() > 2.0f);
+    }
+}
@@ -278,3 +278,23 @@ TEST_CASE("RHI launch config honors startup overrides") {
     REQUIRE(!initDesc.mEnableGpuValidation);
     REQUIRE(!initDesc.mEnableDebugNames);
 }
+
+TEST_CASE("RHI launch config resolves pipeline cache dir") {
+    AltinaEngine::Core::Utility::EngineConfig::FConfigCollection config{};
+#if AE_PLATFORM_WIN
+    REQUIRE(config.ParseJsonConfig(AltinaEngine::Core::Container::FNativeStringView(
+        "{\"Rhi\":{\"PipelineCacheDir\":\"C:/Cache/Psos\"}}")));
+    REQUIRE(AltinaEngine::Launch::ResolveRhiPipelineCacheDir(config)
+        == AltinaEngine::Core::Container::FString(TEXT("C:/Cache/Psos")));
+#else
+    REQUIRE(config.ParseJsonConfig(AltinaEngine::Core::Container::FNativeStringView(
+        "{\"Rhi\":{\"PipelineCacheDir\":\"/tmp/Psos\"}}")));
+    REQUIRE(AltinaEngine::Launch::ResolveRhiPipelineCacheDir(config)
+        == AltinaEngine::Core::Container::FString(TEXT("/tmp/Psos")));
+#endif
+
+    AltinaEngine::Core::Utility::EngineConfig::FConfigCollection disabled{};
+    REQUIRE(disabled.ParseJsonConfig(AltinaEngine::Core::Container::FNativeStringView(
+        "{\"Rhi\":{\"DisablePipelineCache\":true}}")));
+    REQUIRE(AltinaEngine::Launch::ResolveRhiPipelineCacheDir(disabled).IsEmptyString());
+}
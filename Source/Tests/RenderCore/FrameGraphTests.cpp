@@ -2,6 +2,7 @@
 
 #include "FrameGraph/FrameGraph.h"
 #include "FrameGraph/FrameGraphExecutor.h"
+#include "Jobs/JobSystem.h"
 #include "RhiMock/RhiMockContext.h"
 #include "Rhi/Command/RhiCmdContext.h"
 #include "Rhi/RhiCommandContext.h"
@@ -21,6 +22,8 @@
 #include "Rhi/RhiCommandList.h"
 #include "Rhi/RhiViewport.h"
 
+#include <initializer_list>
+
 namespace {
     using AltinaEngine::i32;
     using AltinaEngine::TChar;
@@ -122,6 +125,9 @@ namespace {
         u32  mBeginTransitionCount = 0U;
         u32  mDispatchCount        = 0U;
         u32  mTransitionBeforePass = 0U;
+        u32  mBeginRenderPassCount = 0U;
+        u32  mEndRenderPassCount   = 0U;
+        AltinaEngine::Core::Container::TVector<u32> mDispatchGroups;
 
         void RHIUpdateDynamicBufferDiscard(AltinaEngine::Rhi::FRhiBuffer* /*buffer*/,
             const void* /*data*/, u64 /*sizeBytes*/, u64 /*offsetBytes*/) override {}
@@ -137,8 +143,10 @@ namespace {
         void RHISetRenderTargets(u32 /*colorTargetCount*/,
             AltinaEngine::Rhi::FRhiTexture* const* /*colorTargets*/,
             AltinaEngine::Rhi::FRhiTexture* /*depthTarget*/) override {}
-        void RHIBeginRenderPass(const AltinaEngine::Rhi::FRhiRenderPassDesc& /*desc*/) override {}
-        void RHIEndRenderPass() override {}
+        void RHIBeginRenderPass(const AltinaEngine::Rhi::FRhiRenderPassDesc& /*desc*/) override {
+            ++mBeginRenderPassCount;
+        }
+        void RHIEndRenderPass() override { ++mEndRenderPassCount; }
         void RHIBeginTransition(
             const AltinaEngine::Rhi::FRhiTransitionCreateInfo& /*info*/) override {
             ++mBeginTransitionCount;
@@ -156,15 +164,18 @@ namespace {
             u32 /*firstInstance*/) override {}
         void RHIDrawIndexed(u32 /*indexCount*/, u32 /*instanceCount*/, u32 /*firstIndex*/,
             i32 /*vertexOffset*/, u32 /*firstInstance*/) override {}
-        void RHIDispatch(u32 /*groupCountX*/, u32 /*groupCountY*/, u32 /*groupCountZ*/) override {
+        void RHIDispatch(u32 groupCountX, u32 /*groupCountY*/, u32 /*groupCountZ*/) override {
             ++mDispatchCount;
+            mDispatchGroups.PushBack(groupCountX);
         }
     };
 
     enum class ETestEvent : u8 {
         BeginTransition = 0,
         EndTransition,
-        Dispatch
+        Dispatch,
+        BeginRenderPass,
+        EndRenderPass
     };
 
     struct FSubmitRecord {
@@ -270,8 +281,10 @@ namespace {
         void RHISetRenderTargets(u32 /*colorTargetCount*/,
             AltinaEngine::Rhi::FRhiTexture* const* /*colorTargets*/,
             AltinaEngine::Rhi::FRhiTexture* /*depthTarget*/) override {}
-        void RHIBeginRenderPass(const AltinaEngine::Rhi::FRhiRenderPassDesc& /*desc*/) override {}
-        void RHIEndRenderPass() override {}
+        void RHIBeginRenderPass(const AltinaEngine::Rhi::FRhiRenderPassDesc& /*desc*/) override {
+            mEvents.PushBack(ETestEvent::BeginRenderPass);
+        }
+        void RHIEndRenderPass() override { mEvents.PushBack(ETestEvent::EndRenderPass); }
         void RHIBeginTransition(
             const AltinaEngine::Rhi::FRhiTransitionCreateInfo& /*info*/) override {
             mEvents.PushBack(ETestEvent::BeginTransition);
@@ -955,3 +968,682 @@ TEST_CASE("FrameGraph.AutoTransitionsBeforePass") {
     REQUIRE(cmdContext.mBeginTransitionCount >= 1U);
     REQUIRE(cmdContext.mTransitionBeforePass >= 1U);
 }
+
+namespace {
+    auto MakeTransientTextureDesc(const TChar* name) -> FFrameGraphTextureDesc {
+        FFrameGraphTextureDesc desc{};
+        desc.mDesc.mDebugName.Assign(name);
+        desc.mDesc.mWidth  = 16U;
+        desc.mDesc.mHeight = 8U;
+        desc.mDesc.mFormat = ERhiFormat::R8G8B8A8Unorm;
+        desc.mDesc.mBindFlags =
+            ERhiTextureBindFlags::ShaderResource | ERhiTextureBindFlags::UnorderedAccess;
+        return desc;
+    }
+
+    struct FChainTextures {
+        AltinaEngine::Rhi::FRhiTexture* mFirst = nullptr;
+        AltinaEngine::Rhi::FRhiTexture* mLast  = nullptr;
+    };
+
+    // A -> B -> C, each pass reading the previous transient and writing a new one of the same
+    // description, so the first and the last transient never overlap.
+    void AddTransientChain(FFrameGraph& graph, FChainTextures& outTextures) {
+        struct FPassData {
+            FFrameGraphTextureRef In;
+            FFrameGraphTextureRef Out;
+        };
+        FFrameGraphTextureRef previous{};
+        const TChar*          names[] = { TEXT("Chain0"), TEXT("Chain1"), TEXT("Chain2") };
+        for (u32 i = 0U; i < 3U; ++i) {
+            FFrameGraphPassDesc desc{};
+            desc.mName  = "TransientChain";
+            desc.mType  = EFrameGraphPassType::Compute;
+            desc.mQueue = EFrameGraphQueue::Graphics;
+            graph.AddPass<FPassData>(
+                desc,
+                [&](FFrameGraphPassBuilder& builder, FPassData& data) {
+                    if (previous.IsValid()) {
+                        data.In = builder.Read(previous, ERhiResourceState::ShaderResource);
+                    }
+                    data.Out = builder.CreateTexture(MakeTransientTextureDesc(names[i]));
+                    data.Out = builder.Write(data.Out, ERhiResourceState::UnorderedAccess);
+                    previous = data.Out;
+                    if (i == 2U) {
+                        builder.SetSideEffect(); // keeps the chain from being culled
+                    }
+                },
+                [&outTextures, i](AltinaEngine::Rhi::FRhiCmdContext& ctx,
+                    const FFrameGraphPassResources& res, const FPassData& data) {
+                    if (i == 0U) {
+                        outTextures.mFirst = res.GetTexture(data.Out);
+                    } else if (i == 2U) {
+                        outTextures.mLast = res.GetTexture(data.Out);
+                    }
+                    ctx.RHIDispatch(1U, 1U, 1U);
+                });
+        }
+    }
+} // namespace
+
+TEST_CASE("FrameGraph.TransientPool_AliasesNonOverlappingLifetimes") {
+    FRhiMockContext context;
+    auto            device = CreateMockDevice(context);
+
+    FFrameGraph     graph(*device);
+    graph.BeginFrame(1);
+    FChainTextures textures{};
+    AddTransientChain(graph, textures);
+    graph.Compile();
+
+    FTestCmdContext cmdContext;
+    graph.Execute(cmdContext);
+
+    const auto& stats     = graph.GetTransientStats();
+    const u64   sizeBytes = 16ULL * 8ULL * 4ULL;
+    REQUIRE_EQ(stats.TransientTextures, 3U);
+    REQUIRE_EQ(stats.PhysicalTextures, 2U);
+    REQUIRE_EQ(stats.Created, 2U);
+    REQUIRE_EQ(stats.Aliased, 1U);
+    REQUIRE_EQ(stats.NaiveBytes, 3ULL * sizeBytes);
+    REQUIRE_EQ(stats.PeakLiveBytes, 2ULL * sizeBytes);
+    REQUIRE_EQ(stats.AllocatedBytes, 2ULL * sizeBytes);
+    REQUIRE(textures.mFirst != nullptr);
+    REQUIRE(textures.mFirst == textures.mLast);
+    graph.EndFrame();
+}
+
+TEST_CASE("FrameGraph.TransientPool_RecyclesAcrossGraphs") {
+    FRhiMockContext context;
+    auto            device = CreateMockDevice(context);
+
+    AltinaEngine::RenderCore::FFrameGraphTransientPool pool;
+    FChainTextures                                     firstFrame{};
+    {
+        FFrameGraph graph(*device, &pool);
+        AddTransientChain(graph, firstFrame);
+        graph.Compile();
+        FTransitionTrackingCmdContext cmdContext;
+        graph.Execute(cmdContext);
+        REQUIRE_EQ(graph.GetTransientStats().Created, 2U);
+        // Common -> UAV before the first pass, then one batch before each later pass.
+        REQUIRE_EQ(cmdContext.mBeginTransitionCount, 3U);
+    }
+    REQUIRE_EQ(pool.GetPooledObjectCount(), 2U);
+
+    const u32      createdBefore = context.GetResourceCreatedCount();
+    FChainTextures secondFrame{};
+    {
+        FFrameGraph graph(*device, &pool);
+        AddTransientChain(graph, secondFrame);
+        graph.Compile();
+        FTransitionTrackingCmdContext cmdContext;
+        graph.Execute(cmdContext);
+
+        const auto& stats = graph.GetTransientStats();
+        REQUIRE_EQ(stats.Created, 0U);
+        REQUIRE_EQ(stats.ReusedFromPool, 2U);
+        REQUIRE_EQ(stats.Aliased, 1U);
+        // Recycled textures start in the state the previous graph left them in: the first
+        // texture is still in UnorderedAccess, so the first pass needs no transition.
+        REQUIRE_EQ(cmdContext.mTransitionBeforePass, 0U);
+        REQUIRE_EQ(cmdContext.mBeginTransitionCount, 2U);
+    }
+    REQUIRE_EQ(context.GetResourceCreatedCount(), createdBefore);
+    REQUIRE(secondFrame.mFirst != nullptr);
+    REQUIRE(secondFrame.mFirst == firstFrame.mFirst);
+
+    pool.Reset();
+    REQUIRE_EQ(pool.GetPooledObjectCount(), 0U);
+}
+
+TEST_CASE("FrameGraph.TransientPool_CpuVisibleBuffersAreNotPooled") {
+    FRhiMockContext context;
+    auto            device = CreateMockDevice(context);
+
+    AltinaEngine::RenderCore::FFrameGraphTransientPool pool;
+    for (u32 frame = 0U; frame < 2U; ++frame) {
+        FFrameGraph         graph(*device, &pool);
+        FFrameGraphPassDesc desc{};
+        desc.mName  = "TransientUpload";
+        desc.mType  = EFrameGraphPassType::Copy;
+        desc.mQueue = EFrameGraphQueue::Graphics;
+        graph.AddPass(desc, [](FFrameGraphPassBuilder& builder) {
+            FFrameGraphBufferDesc upload{};
+            upload.mDesc.mSizeBytes = 256U;
+            upload.mDesc.mUsage     = AltinaEngine::Rhi::ERhiResourceUsage::Dynamic;
+            upload.mDesc.mCpuAccess = AltinaEngine::Rhi::ERhiCpuAccess::Write;
+            auto buffer             = builder.CreateBuffer(upload);
+            builder.Write(buffer, ERhiResourceState::CopySrc);
+
+            FFrameGraphBufferDesc scratch{};
+            scratch.mDesc.mSizeBytes = 512U;
+            scratch.mDesc.mBindFlags = ERhiBufferBindFlags::UnorderedAccess;
+            auto scratchBuffer       = builder.CreateBuffer(scratch);
+            builder.Write(scratchBuffer, ERhiResourceState::CopyDst);
+            builder.SetSideEffect();
+        });
+        graph.Compile();
+
+        const auto& stats = graph.GetTransientStats();
+        REQUIRE_EQ(stats.TransientBuffers, 2U);
+        REQUIRE_EQ(stats.Unpooled, 1U);
+        REQUIRE_EQ(stats.NaiveBytes, 768ULL);
+        REQUIRE_EQ(stats.ReusedFromPool, (frame == 0U) ? 0U : 1U);
+    }
+    REQUIRE_EQ(pool.GetPooledObjectCount(), 1U);
+}
+
+TEST_CASE("FrameGraph.TransientPool_EstimateTextureSize") {
+    FRhiTextureDesc desc{};
+    desc.mWidth     = 16U;
+    desc.mHeight    = 16U;
+    desc.mMipLevels = 5U;
+    desc.mFormat    = ERhiFormat::R8G8B8A8Unorm;
+    REQUIRE_EQ(AltinaEngine::RenderCore::EstimateTextureSizeBytes(desc),
+        (256ULL + 64ULL + 16ULL + 4ULL + 1ULL) * 4ULL);
+
+    desc.mMipLevels = 1U;
+    desc.mFormat    = ERhiFormat::BC1Unorm;
+    REQUIRE_EQ(AltinaEngine::RenderCore::EstimateTextureSizeBytes(desc), 16ULL * 8ULL);
+
+    desc.mFormat      = ERhiFormat::R16G16B16A16Float;
+    desc.mDimension   = AltinaEngine::Rhi::ERhiTextureDimension::Cube;
+    desc.mArrayLayers = 6U;
+    REQUIRE_EQ(AltinaEngine::RenderCore::EstimateTextureSizeBytes(desc), 256ULL * 8ULL * 6ULL);
+}
+
+namespace {
+    struct FCullingRecord {
+        u32 mExecutedMask = 0U;
+    };
+
+    struct FNoPassData {};
+
+    void AddComputePass(FFrameGraph& graph, const char* name, u32 bit, FCullingRecord& record,
+        FFrameGraphTextureRef* read, FFrameGraphTextureRef* written, bool sideEffect) {
+        FFrameGraphPassDesc desc{};
+        desc.mName  = name;
+        desc.mType  = EFrameGraphPassType::Compute;
+        desc.mQueue = EFrameGraphQueue::Graphics;
+        graph.AddPass<FNoPassData>(
+            desc,
+            [&](FFrameGraphPassBuilder& builder) {
+                if (read != nullptr) {
+                    builder.Read(*read, ERhiResourceState::ShaderResource);
+                }
+                if (written != nullptr) {
+                    if (!written->IsValid()) {
+                        *written = builder.CreateTexture(MakeTransientTextureDesc(TEXT("Cull")));
+                    }
+                    builder.Write(*written, ERhiResourceState::UnorderedAccess);
+                }
+                if (sideEffect) {
+                    builder.SetSideEffect();
+                }
+            },
+            [&record, bit](AltinaEngine::Rhi::FRhiCmdContext& ctx,
+                const FFrameGraphPassResources& /*res*/) {
+                record.mExecutedMask |= bit;
+                ctx.RHIDispatch(1U, 1U, 1U);
+            });
+    }
+} // namespace
+
+TEST_CASE("FrameGraph.Culling_DropsPassesWithoutConsumers") {
+    FRhiMockContext context;
+    auto            device = CreateMockDevice(context);
+
+    FRhiTextureDesc importedDesc = MakeTransientTextureDesc(TEXT("CullImported")).mDesc;
+    auto            external     = device->CreateTexture(importedDesc);
+    REQUIRE(external);
+
+    FFrameGraph graph(*device);
+    graph.BeginFrame(1);
+    auto           imported = graph.ImportTexture(external, ERhiResourceState::Common);
+
+    FCullingRecord record{};
+    // Dead chain: nothing consumes DeadB's output, so DeadA is culled with it.
+    FFrameGraphTextureRef deadA{};
+    FFrameGraphTextureRef deadB{};
+    AddComputePass(graph, "DeadA", 1U << 0U, record, nullptr, &deadA, false);
+    AddComputePass(graph, "DeadB", 1U << 1U, record, &deadA, &deadB, false);
+    // Live chain ending in a side effect.
+    FFrameGraphTextureRef live{};
+    AddComputePass(graph, "Producer", 1U << 2U, record, nullptr, &live, false);
+    AddComputePass(graph, "Consumer", 1U << 3U, record, &live, nullptr, true);
+    // Writing an imported texture is visible outside the graph.
+    AddComputePass(graph, "WritesImported", 1U << 4U, record, nullptr, &imported, false);
+    // Declaring no writes at all is treated as a side effect.
+    AddComputePass(graph, "NoWrites", 1U << 5U, record, nullptr, nullptr, false);
+    graph.Compile();
+
+    FTransitionTrackingCmdContext cmdContext;
+    graph.Execute(cmdContext);
+
+    const auto& compileStats = graph.GetCompileStats();
+    REQUIRE_EQ(compileStats.Passes, 6U);
+    REQUIRE_EQ(compileStats.CulledPasses, 2U);
+    REQUIRE_EQ(compileStats.CulledTextures, 2U);
+    REQUIRE_EQ(record.mExecutedMask, 0x3CU);
+    REQUIRE_EQ(cmdContext.mDispatchCount, 4U);
+    // Culled transients are never created.
+    REQUIRE_EQ(graph.GetTransientStats().TransientTextures, 1U);
+    REQUIRE_EQ(graph.GetTransientStats().Created, 1U);
+    graph.EndFrame();
+}
+
+TEST_CASE("FrameGraphExecutor.Culling_SkipsCulledPasses") {
+    FTestDevice    device(false, false);
+    FFrameGraph    graph(device);
+    FCullingRecord record{};
+
+    FFrameGraphTextureRef dead{};
+    FFrameGraphTextureRef live{};
+    AddComputePass(graph, "Dead", 1U << 0U, record, nullptr, &dead, false);
+    AddComputePass(graph, "Producer", 1U << 1U, record, nullptr, &live, false);
+    AddComputePass(graph, "Consumer", 1U << 2U, record, &live, nullptr, true);
+
+    FFrameGraphExecutor executor(device);
+    executor.Execute(graph);
+
+    REQUIRE_EQ(record.mExecutedMask, 0x6U);
+    auto* gfxContext = device.GetTestContext(AltinaEngine::Rhi::ERhiQueueType::Graphics);
+    REQUIRE(gfxContext != nullptr);
+    u32 dispatches = 0U;
+    for (const auto evt : gfxContext->GetEvents()) {
+        dispatches += (evt == ETestEvent::Dispatch) ? 1U : 0U;
+    }
+    REQUIRE_EQ(dispatches, 2U);
+}
+
+namespace {
+    struct FMergeTargets {
+        FFrameGraphTextureRef mColor;
+        FFrameGraphRTVRef     mColorRTV;
+        FFrameGraphTextureRef mDepth;
+        FFrameGraphDSVRef     mDepthDSV;
+    };
+
+    // Three raster passes on the same targets: the second one loads what the first stored and
+    // is merged into its render pass, the third clears and needs a render pass of its own.
+    void AddMergeablePasses(FFrameGraph& graph, FMergeTargets& targets, u32& executedCount) {
+        const AltinaEngine::Rhi::ERhiLoadOp loadOps[] = { AltinaEngine::Rhi::ERhiLoadOp::Clear,
+            AltinaEngine::Rhi::ERhiLoadOp::Load, AltinaEngine::Rhi::ERhiLoadOp::Clear };
+        for (u32 i = 0U; i < 3U; ++i) {
+            FFrameGraphPassDesc desc{};
+            desc.mName  = "MergeRaster";
+            desc.mType  = EFrameGraphPassType::Raster;
+            desc.mQueue = EFrameGraphQueue::Graphics;
+            graph.AddPass<FNoPassData>(
+                desc,
+                [&, i](FFrameGraphPassBuilder& builder) {
+                    FRhiTextureViewRange range{};
+                    range.mMipCount        = 1U;
+                    range.mLayerCount      = 1U;
+                    range.mDepthSliceCount = 1U;
+                    if (i == 0U) {
+                        FFrameGraphTextureDesc colorDesc = MakeTransientTextureDesc(TEXT("Color"));
+                        colorDesc.mDesc.mBindFlags       = ERhiTextureBindFlags::RenderTarget;
+                        targets.mColor                   = builder.CreateTexture(colorDesc);
+
+                        FFrameGraphTextureDesc depthDesc = MakeTransientTextureDesc(TEXT("Depth"));
+                        depthDesc.mDesc.mFormat          = ERhiFormat::D24UnormS8Uint;
+                        depthDesc.mDesc.mBindFlags       = ERhiTextureBindFlags::DepthStencil;
+                        targets.mDepth                   = builder.CreateTexture(depthDesc);
+
+                        FRhiDepthStencilViewDesc dsvDesc{};
+                        dsvDesc.mFormat   = depthDesc.mDesc.mFormat;
+                        dsvDesc.mRange    = range;
+                        targets.mDepthDSV = builder.CreateDSV(targets.mDepth, dsvDesc);
+                    }
+                    // Every pass creates its own RTV of the same texture and range.
+                    FRhiRenderTargetViewDesc rtvDesc{};
+                    rtvDesc.mFormat   = ERhiFormat::R8G8B8A8Unorm;
+                    rtvDesc.mRange    = range;
+                    targets.mColorRTV = builder.CreateRTV(targets.mColor, rtvDesc);
+
+                    FRdgRenderTargetBinding rtv{};
+                    rtv.mRTV    = targets.mColorRTV;
+                    rtv.mLoadOp = loadOps[i];
+                    FRdgDepthStencilBinding dsv{};
+                    dsv.mDSV           = targets.mDepthDSV;
+                    dsv.mDepthLoadOp   = loadOps[i];
+                    dsv.mStencilLoadOp = loadOps[i];
+                    builder.SetRenderTargets(&rtv, 1U, &dsv);
+                    if (i == 2U) {
+                        builder.SetSideEffect();
+                    }
+                },
+                [&executedCount](AltinaEngine::Rhi::FRhiCmdContext& ctx,
+                    const FFrameGraphPassResources& /*res*/) {
+                    ++executedCount;
+                    ctx.RHIDraw(3U, 1U, 0U, 0U);
+                });
+        }
+    }
+} // namespace
+
+TEST_CASE("FrameGraph.MergesRasterPassesSharingTargets") {
+    FRhiMockContext context;
+    auto            device = CreateMockDevice(context);
+
+    FFrameGraph     graph(*device);
+    graph.BeginFrame(1);
+    FMergeTargets targets{};
+    u32           executedCount = 0U;
+    AddMergeablePasses(graph, targets, executedCount);
+    graph.Compile();
+    REQUIRE_EQ(graph.GetCompileStats().MergedPasses, 1U);
+
+    FTransitionTrackingCmdContext cmdContext;
+    graph.Execute(cmdContext);
+    REQUIRE_EQ(executedCount, 3U);
+    REQUIRE_EQ(cmdContext.mBeginRenderPassCount, 2U);
+    REQUIRE_EQ(cmdContext.mEndRenderPassCount, 2U);
+    graph.EndFrame();
+}
+
+TEST_CASE("FrameGraph.CompileCache_ReusesCompiledTopology") {
+    FRhiMockContext context;
+    auto            device = CreateMockDevice(context);
+
+    AltinaEngine::RenderCore::FFrameGraphTransientPool pool;
+    AltinaEngine::RenderCore::FFrameGraphCompileCache  cache;
+    u32                                                createdAfterFirstFrame = 0U;
+    u32                                                transitionsPerFrame[3]{};
+    for (u32 frame = 0U; frame < 3U; ++frame) {
+        FFrameGraph   graph(*device, &pool, &cache);
+        FMergeTargets targets{};
+        u32           executedCount = 0U;
+        AddMergeablePasses(graph, targets, executedCount);
+        graph.Compile();
+
+        FTransitionTrackingCmdContext cmdContext;
+        graph.Execute(cmdContext);
+        REQUIRE_EQ(executedCount, 3U);
+        REQUIRE_EQ(cmdContext.mBeginRenderPassCount, 2U);
+        transitionsPerFrame[frame] = cmdContext.mBeginTransitionCount;
+
+        const auto& stats = graph.GetCompileStats();
+        REQUIRE_EQ(stats.MergedPasses, 1U);
+        if (frame == 0U) {
+            REQUIRE(!stats.CacheHit);
+            // The three passes declare identical RTVs of the color target: only the first one
+            // creates a view.
+            REQUIRE_EQ(stats.ViewsCreated, 2U);
+            REQUIRE_EQ(stats.ViewsReused, 2U);
+            createdAfterFirstFrame = context.GetResourceCreatedCount();
+        } else {
+            REQUIRE(stats.CacheHit);
+            REQUIRE_EQ(stats.ViewsCreated, 0U);
+            REQUIRE_EQ(stats.ViewsReused, 4U);
+        }
+        // The second frame starts from the states the first one left behind, so its barriers
+        // are recompiled once; from then on they match.
+        REQUIRE(stats.TransitionsReused == (frame == 2U));
+    }
+
+    REQUIRE_EQ(context.GetResourceCreatedCount(), createdAfterFirstFrame);
+    REQUIRE_EQ(transitionsPerFrame[2], transitionsPerFrame[1]);
+    // Views kept by the pool do not count as references from outside it.
+    REQUIRE_EQ(pool.GetPooledObjectCount(), 2U);
+    REQUIRE_EQ(cache.GetEntryCount(), 1U);
+    REQUIRE_EQ(cache.GetStats().Misses, 1ULL);
+    REQUIRE_EQ(cache.GetStats().Hits, 2ULL);
+    REQUIRE_EQ(cache.GetStats().TransitionHits, 1ULL);
+}
+
+TEST_CASE("FrameGraph.CompileCache_KeysOnDeclaration") {
+    FRhiMockContext context;
+    auto            device = CreateMockDevice(context);
+
+    AltinaEngine::RenderCore::FFrameGraphTransientPool pool;
+    AltinaEngine::RenderCore::FFrameGraphCompileCache  cache;
+    const auto compileChain = [&](bool withMergeablePasses) {
+        FFrameGraph    graph(*device, &pool, &cache);
+        FChainTextures textures{};
+        AddTransientChain(graph, textures);
+        FMergeTargets targets{};
+        u32           executedCount = 0U;
+        if (withMergeablePasses) {
+            AddMergeablePasses(graph, targets, executedCount);
+        }
+        graph.Compile();
+        FTransitionTrackingCmdContext cmdContext;
+        graph.Execute(cmdContext);
+        REQUIRE(textures.mLast != nullptr);
+        return graph.GetCompileStats().CacheHit;
+    };
+
+    REQUIRE(!compileChain(false));
+    REQUIRE(!compileChain(true));
+    REQUIRE(compileChain(false));
+    REQUIRE(compileChain(true));
+    REQUIRE_EQ(cache.GetEntryCount(), 2U);
+
+    cache.Reset();
+    REQUIRE_EQ(cache.GetEntryCount(), 0U);
+    REQUIRE(!compileChain(false));
+}
+
+namespace {
+    // Dispatches `id * 10 + chunk` for every chunk, so replay order is visible in the groups.
+    void AddRecordedPass(FFrameGraph& graph, const char* name, u32 id, u32 chunkCount,
+        bool parallelRecord) {
+        FFrameGraphPassDesc desc{};
+        desc.mName  = name;
+        desc.mType  = EFrameGraphPassType::Compute;
+        desc.mQueue = EFrameGraphQueue::Graphics;
+        if (parallelRecord) {
+            desc.mFlags = AltinaEngine::RenderCore::EFrameGraphPassFlags::ParallelRecord;
+        }
+        graph.AddPass<FNoPassData>(
+            desc,
+            [&](FFrameGraphPassBuilder& builder) {
+                builder.SetSideEffect();
+                builder.SetRecordChunks(chunkCount);
+            },
+            [id](AltinaEngine::Rhi::FRhiCmdContext& ctx, const FFrameGraphPassResources& res) {
+                REQUIRE(res.GetRecordChunk() < res.GetRecordChunkCount());
+                ctx.RHIPushDebugMarker(TEXT("Recorded"));
+                ctx.RHIDispatch(id * 10U + res.GetRecordChunk(), 1U, 1U);
+                ctx.RHIPopDebugMarker();
+            });
+    }
+} // namespace
+
+TEST_CASE("FrameGraph.ParallelRecord_ReplaysInDeclarationOrder") {
+    FRhiMockContext context;
+    auto            device = CreateMockDevice(context);
+
+    FFrameGraph     graph(*device);
+    graph.BeginFrame(1);
+    AddRecordedPass(graph, "Serial", 1U, 1U, false);
+    AddRecordedPass(graph, "ParallelChunked", 2U, 3U, true);
+    AddRecordedPass(graph, "Parallel", 3U, 1U, true);
+    AddRecordedPass(graph, "SerialChunked", 4U, 2U, false);
+    graph.Compile();
+
+    FTransitionTrackingCmdContext cmdContext;
+    graph.Execute(cmdContext);
+
+    const u32 expected[] = { 10U, 20U, 21U, 22U, 30U, 40U, 41U };
+    REQUIRE_EQ(cmdContext.mDispatchGroups.Size(), 7U);
+    for (u32 i = 0U; i < 7U; ++i) {
+        REQUIRE_EQ(cmdContext.mDispatchGroups[i], expected[i]);
+    }
+
+    const auto& recordStats = graph.GetRecordStats();
+    auto*       pool        = AltinaEngine::Core::Jobs::FJobSystem::GetDefaultWorkerPool();
+    if (pool != nullptr && pool->GetWorkerCount() > 0U) {
+        REQUIRE_EQ(recordStats.ParallelPasses, 2U);
+        REQUIRE_EQ(recordStats.RecordedLists, 4U);
+        REQUIRE_EQ(recordStats.RecordedCommands, 12U); // marker push, dispatch, marker pop
+    } else {
+        REQUIRE_EQ(recordStats.RecordedLists, 0U);
+    }
+    graph.EndFrame();
+}
+
+TEST_CASE("FrameGraphExecutor.MergesRasterPassesSharingTargets") {
+    FTestDevice   device(false, false);
+    FFrameGraph   graph(device);
+    FMergeTargets targets{};
+    u32           executedCount = 0U;
+    AddMergeablePasses(graph, targets, executedCount);
+
+    FFrameGraphExecutor executor(device);
+    executor.Execute(graph);
+    REQUIRE_EQ(executedCount, 3U);
+
+    auto* gfxContext = device.GetTestContext(AltinaEngine::Rhi::ERhiQueueType::Graphics);
+    REQUIRE(gfxContext != nullptr);
+    u32  depth    = 0U;
+    u32  begins   = 0U;
+    bool balanced = true;
+    for (const auto evt : gfxContext->GetEvents()) {
+        if (evt == ETestEvent::BeginRenderPass) {
+            balanced = balanced && depth == 0U;
+            ++depth;
+            ++begins;
+        } else if (evt == ETestEvent::EndRenderPass) {
+            balanced = balanced && depth == 1U;
+            --depth;
+        }
+    }
+    REQUIRE_EQ(begins, 2U);
+    REQUIRE(balanced);
+    REQUIRE_EQ(depth, 0U);
+}
+
+namespace {
+    auto CreateAsyncComputeMockDevice(FRhiMockContext& context) {
+        AltinaEngine::Rhi::FRhiMockAdapterConfig config{};
+        config.mDesc = MakeAdapterDesc(
+            TEXT("Mock Discrete"), ERhiAdapterType::Discrete, ERhiVendorId::Nvidia);
+        config.mSupportsAsyncCompute = true;
+        context.AddAdapter(config);
+        REQUIRE(context.Init(FRhiInitDesc{}));
+        auto device = context.CreateDevice(0);
+        REQUIRE(device);
+        return device;
+    }
+
+    struct FAsyncTextures {
+        FFrameGraphTextureRef mDepth{};
+        FFrameGraphTextureRef mShadows{};
+        FFrameGraphTextureRef mAmbientOcclusion{};
+        FFrameGraphTextureRef mAtmosphereLut{};
+    };
+
+    void AddQueuePass(FFrameGraph& graph, const char* name, EFrameGraphQueue queue,
+        std::initializer_list<FFrameGraphTextureRef*> reads, FFrameGraphTextureRef* written) {
+        FFrameGraphPassDesc desc{};
+        desc.mName  = name;
+        desc.mType  = EFrameGraphPassType::Compute;
+        desc.mQueue = queue;
+        graph.AddPass<FNoPassData>(
+            desc,
+            [readList = AltinaEngine::Core::Container::TVector<FFrameGraphTextureRef*>(reads),
+                written](FFrameGraphPassBuilder& builder) {
+                for (auto* read : readList) {
+                    builder.Read(*read, ERhiResourceState::ShaderResource);
+                }
+                if (written != nullptr) {
+                    *written = builder.CreateTexture(MakeTransientTextureDesc(TEXT("Async")));
+                    builder.Write(*written, ERhiResourceState::UnorderedAccess);
+                } else {
+                    builder.SetSideEffect();
+                }
+            },
+            [](AltinaEngine::Rhi::FRhiCmdContext& ctx, const FFrameGraphPassResources& /*res*/) {
+                ctx.RHIDispatch(1U, 1U, 1U);
+            });
+    }
+
+    // Depth -> Ssao (async) -> Lighting, with Shadows and the atmosphere LUT independent of the
+    // async chain.
+    void AddAsyncComputeFrame(FFrameGraph& graph, FAsyncTextures& textures) {
+        graph.BeginFrame(1);
+        AddQueuePass(graph, "Depth", EFrameGraphQueue::Graphics, {}, &textures.mDepth);
+        AddQueuePass(graph, "Shadows", EFrameGraphQueue::Graphics, {}, &textures.mShadows);
+        AddQueuePass(graph, "Ssao", EFrameGraphQueue::Compute, { &textures.mDepth },
+            &textures.mAmbientOcclusion);
+        AddQueuePass(
+            graph, "AtmosphereLut", EFrameGraphQueue::Compute, {}, &textures.mAtmosphereLut);
+        AddQueuePass(graph, "Lighting", EFrameGraphQueue::Graphics,
+            { &textures.mAmbientOcclusion, &textures.mShadows, &textures.mAtmosphereLut },
+            nullptr);
+        graph.Compile();
+    }
+
+    void RequireAsyncComputeOrder(const AltinaEngine::Rhi::FRhiMockSubmissionLog& log) {
+        const u32 depth    = log.FindSubmission(TEXT("FrameGraph.Pass:Depth"));
+        const u32 shadows  = log.FindSubmission(TEXT("FrameGraph.Pass:Shadows"));
+        const u32 ssao     = log.FindSubmission(TEXT("FrameGraph.Pass:Ssao"));
+        const u32 lut      = log.FindSubmission(TEXT("FrameGraph.Pass:AtmosphereLut"));
+        const u32 lighting = log.FindSubmission(TEXT("FrameGraph.Pass:Lighting"));
+        REQUIRE(lighting != AltinaEngine::Rhi::FRhiMockSubmissionLog::kInvalidIndex);
+
+        REQUIRE(log.GetSubmissions()[ssao].mQueue == AltinaEngine::Rhi::ERhiQueueType::Compute);
+        REQUIRE_EQ(ssao, lut);
+        REQUIRE(log.IsOrderedBefore(depth, ssao));
+        REQUIRE(log.IsOrderedBefore(ssao, lighting));
+        REQUIRE(log.IsOrderedBefore(shadows, lighting));
+        // Shadows and SSAO are free to overlap.
+        REQUIRE(!log.IsOrderedBefore(ssao, shadows));
+        REQUIRE(!log.IsOrderedBefore(shadows, ssao));
+        REQUIRE_EQ(log.CountUnsatisfiedWaits(), 0U);
+    }
+} // namespace
+
+TEST_CASE("FrameGraphExecutor.AsyncCompute_OverlapsIndependentGraphicsWork") {
+    FRhiMockContext context;
+    auto            device = CreateAsyncComputeMockDevice(context);
+
+    FFrameGraph     graph(*device);
+    FAsyncTextures  textures{};
+    AddAsyncComputeFrame(graph, textures);
+
+    FFrameGraphExecutor executor(*device);
+    executor.Execute(graph);
+    graph.EndFrame();
+
+    const auto& stats = executor.GetStats();
+    REQUIRE_EQ(stats.Passes, 5U);
+    REQUIRE_EQ(stats.AsyncPasses, 2U);
+    REQUIRE_EQ(stats.HoistedPasses, 2U);
+    // Ssao waits for Depth; Lighting needs one wait for both async passes.
+    REQUIRE_EQ(stats.Waits, 2U);
+    REQUIRE_EQ(stats.RedundantWaits, 1U);
+    RequireAsyncComputeOrder(context.GetSubmissionLog());
+}
+
+TEST_CASE("FrameGraphExecutor.AsyncCompute_PoolsContextsAcrossFrames") {
+    FRhiMockContext     context;
+    auto                device = CreateAsyncComputeMockDevice(context);
+    FFrameGraphExecutor executor(*device);
+
+    {
+        FFrameGraph    graph(*device);
+        FAsyncTextures textures{};
+        AddAsyncComputeFrame(graph, textures);
+        executor.Execute(graph);
+        graph.EndFrame();
+        REQUIRE_EQ(executor.GetStats().ContextsCreated, 2U);
+    }
+
+    context.GetSubmissionLog().Clear();
+    FFrameGraph    graph(*device);
+    FAsyncTextures textures{};
+    AddAsyncComputeFrame(graph, textures);
+    const u32 createdBefore = context.GetResourceCreatedCount();
+    executor.Execute(graph);
+    graph.EndFrame();
+
+    // No command contexts, semaphores or transitions are created for the second frame.
+    REQUIRE_EQ(executor.GetStats().ContextsCreated, 0U);
+    REQUIRE_EQ(context.GetResourceCreatedCount(), createdBefore);
+    RequireAsyncComputeOrder(context.GetSubmissionLog());
+}
@@ -0,0 +1,117 @@
+#include "TestHarness.h"
+
+#include "Rendering/DrawListExecutor.h"
+
+namespace {
+    using AltinaEngine::TChar;
+    using AltinaEngine::u32;
+    using AltinaEngine::Rendering::EStaticMeshVertexStream;
+    using AltinaEngine::Rendering::FDrawListExecutor;
+    using AltinaEngine::RenderCore::Render::FDrawBatch;
+    using AltinaEngine::RenderCore::Render::FDrawInstanceData;
+    using AltinaEngine::RenderCore::Render::FDrawList;
+    using AltinaEngine::RenderCore::Render::FDrawMaterialBucket;
+    using AltinaEngine::Rhi::FRhiVertexAttributeDesc;
+    using AltinaEngine::Rhi::FRhiVertexLayoutDesc;
+
+    void AddAttribute(
+        FRhiVertexLayoutDesc& layout, const TChar* semantic, u32 semanticIndex, u32 inputSlot) {
+        FRhiVertexAttributeDesc attr{};
+        attr.mSemanticName.Assign(semantic);
+        attr.mSemanticIndex = semanticIndex;
+        attr.mInputSlot     = inputSlot;
+        layout.mAttributes.PushBack(attr);
+    }
+
+    void AddBucket(FDrawList& list, u32 batchCount, u32 instancesPerBatch) {
+        FDrawMaterialBucket bucket{};
+        for (u32 batchIndex = 0U; batchIndex < batchCount; ++batchIndex) {
+            FDrawBatch batch{};
+            for (u32 instance = 0U; instance < instancesPerBatch; ++instance) {
+                batch.mInstances.PushBack(FDrawInstanceData{});
+            }
+            bucket.mBatches.PushBack(batch);
+        }
+        list.mBuckets.PushBack(bucket);
+    }
+} // namespace
+
+TEST_CASE("Rendering.DrawListExecutor.CompilesVertexStreamBindings") {
+    FRhiVertexLayoutDesc layout{};
+    AddAttribute(layout, TEXT("position"), 0U, 0U);
+    AddAttribute(layout, TEXT("NORMAL"), 0U, 1U);
+    AddAttribute(layout, TEXT("TEXCOORD"), 0U, 2U);
+    AddAttribute(layout, TEXT("TexCoord"), 1U, 3U);
+    AddAttribute(layout, TEXT("TEXCOORD"), 2U, 4U); // no third UV stream
+    AddAttribute(layout, TEXT("COLOR"), 0U, 5U);
+    AddAttribute(layout, TEXT("TANGENT"), 0U, 16U); // slot out of range
+
+    const auto table = FDrawListExecutor::CompileVertexStreamBindings(layout);
+    REQUIRE_EQ(table.mBindingCount, 4U);
+    REQUIRE_EQ(table.mUnresolvedAttributeCount, 3U);
+    REQUIRE(table.mBindings[0].mStream == EStaticMeshVertexStream::Position);
+    REQUIRE_EQ(table.mBindings[0].mInputSlot, 0U);
+    REQUIRE(table.mBindings[1].mStream == EStaticMeshVertexStream::Tangent);
+    REQUIRE_EQ(table.mBindings[1].mInputSlot, 1U);
+    REQUIRE(table.mBindings[2].mStream == EStaticMeshVertexStream::UV0);
+    REQUIRE_EQ(table.mBindings[2].mInputSlot, 2U);
+    REQUIRE(table.mBindings[3].mStream == EStaticMeshVertexStream::UV1);
+    REQUIRE_EQ(table.mBindings[3].mInputSlot, 3U);
+}
+
+TEST_CASE("Rendering.DrawListExecutor.CachesVertexStreamBindingsByLayout") {
+    FRhiVertexLayoutDesc layoutA{};
+    AddAttribute(layoutA, TEXT("POSITION"), 0U, 0U);
+    AddAttribute(layoutA, TEXT("TEXCOORD"), 0U, 1U);
+
+    FRhiVertexLayoutDesc layoutB{};
+    AddAttribute(layoutB, TEXT("POSITION"), 0U, 0U);
+    AddAttribute(layoutB, TEXT("TEXCOORD"), 1U, 1U);
+
+    const auto first  = FDrawListExecutor::FindOrCompileVertexStreamBindings(layoutA);
+    const auto cached = FDrawListExecutor::FindOrCompileVertexStreamBindings(layoutA);
+    const auto other  = FDrawListExecutor::FindOrCompileVertexStreamBindings(layoutB);
+    REQUIRE_EQ(first.mBindingCount, 2U);
+    REQUIRE_EQ(cached.mBindingCount, 2U);
+    REQUIRE(cached.mBindings[1].mStream == EStaticMeshVertexStream::UV0);
+    REQUIRE_EQ(other.mBindingCount, 2U);
+    REQUIRE(other.mBindings[1].mStream == EStaticMeshVertexStream::UV1);
+}
+
+TEST_CASE("Rendering.DrawListExecutor.SplitsDrawListIntoChunks") {
+    FDrawList list{};
+    AddBucket(list, 3U, 2U);
+    AddBucket(list, 0U, 0U);
+    AddBucket(list, 4U, 0U); // batches without instances are never bound
+    AddBucket(list, 3U, 1U);
+
+    const auto chunks = FDrawListExecutor::SplitDrawList(list, 3U, 1U);
+    REQUIRE_EQ(static_cast<u32>(chunks.Size()), 3U);
+
+    // 10 batches: 4 + 3 + 3, and a chunk may start in the middle of a bucket.
+    REQUIRE_EQ(chunks[0].mFirstBucket, 0U);
+    REQUIRE_EQ(chunks[0].mFirstBatch, 0U);
+    REQUIRE_EQ(chunks[0].mBatchCount, 4U);
+    REQUIRE_EQ(chunks[0].mFirstBoundBatch, 0U);
+    REQUIRE_EQ(chunks[0].mFirstInstance, 0U);
+
+    REQUIRE_EQ(chunks[1].mFirstBucket, 2U);
+    REQUIRE_EQ(chunks[1].mFirstBatch, 1U);
+    REQUIRE_EQ(chunks[1].mBatchCount, 3U);
+    REQUIRE_EQ(chunks[1].mFirstBoundBatch, 3U);
+    REQUIRE_EQ(chunks[1].mFirstInstance, 6U);
+
+    REQUIRE_EQ(chunks[2].mFirstBucket, 3U);
+    REQUIRE_EQ(chunks[2].mFirstBatch, 0U);
+    REQUIRE_EQ(chunks[2].mBatchCount, 3U);
+    REQUIRE_EQ(chunks[2].mFirstBoundBatch, 3U);
+    REQUIRE_EQ(chunks[2].mFirstInstance, 6U);
+
+    // Small lists are not split below the minimum chunk size.
+    const auto single = FDrawListExecutor::SplitDrawList(list, 8U, 64U);
+    REQUIRE_EQ(static_cast<u32>(single.Size()), 1U);
+    REQUIRE_EQ(single[0].mBatchCount, 10U);
+
+    const auto none = FDrawListExecutor::SplitDrawList(FDrawList{}, 4U, 1U);
+    REQUIRE(none.IsEmpty());
+}
@@ -0,0 +1,175 @@
+#include "TestHarness.h"
+
+#include "Rhi/Command/RhiCmdContext.h"
+#include "Rhi/Command/RhiCmdExecutor.h"
+#include "Rhi/Command/RhiCmdList.h"
+#include "Rhi/Command/RhiCmdListContext.h"
+#include "Container/String.h"
+#include "Container/Vector.h"
+
+namespace {
+    using AltinaEngine::i32;
+    using AltinaEngine::u32;
+    using AltinaEngine::u64;
+    using AltinaEngine::u8;
+    using AltinaEngine::Core::Container::FString;
+    using AltinaEngine::Core::Container::FStringView;
+    using AltinaEngine::Core::Container::TVector;
+    using AltinaEngine::Rhi::ERhiPrimitiveTopology;
+    using AltinaEngine::Rhi::FRhiBindGroup;
+    using AltinaEngine::Rhi::FRhiBuffer;
+    using AltinaEngine::Rhi::FRhiClearColor;
+    using AltinaEngine::Rhi::FRhiCmdContext;
+    using AltinaEngine::Rhi::FRhiCmdExecutor;
+    using AltinaEngine::Rhi::FRhiCmdList;
+    using AltinaEngine::Rhi::FRhiCmdListContext;
+    using AltinaEngine::Rhi::FRhiIndexBufferView;
+    using AltinaEngine::Rhi::FRhiPipeline;
+    using AltinaEngine::Rhi::FRhiRenderPassDesc;
+    using AltinaEngine::Rhi::FRhiScissorRect;
+    using AltinaEngine::Rhi::FRhiTexture;
+    using AltinaEngine::Rhi::FRhiTransitionCreateInfo;
+    using AltinaEngine::Rhi::FRhiVertexBufferView;
+    using AltinaEngine::Rhi::FRhiViewportRect;
+
+    // Flattens every call into a log line so replayed lists can be compared with direct calls.
+    class FCallLogCmdContext final : public FRhiCmdContext {
+    public:
+        TVector<FString> mCalls;
+        TVector<u8>      mUploadedBytes;
+        TVector<u32>     mDynamicOffsets;
+
+        void RHIUpdateDynamicBufferDiscard(
+            FRhiBuffer* /*buffer*/, const void* data, u64 sizeBytes, u64 offsetBytes) override {
+            Log(TEXT("Update"), static_cast<u32>(offsetBytes));
+            const auto* bytes = static_cast<const u8*>(data);
+            for (u64 index = 0ULL; index < sizeBytes; ++index) {
+                mUploadedBytes.PushBack(bytes[index]);
+            }
+        }
+        void RHISetGraphicsPipeline(FRhiPipeline* /*pipeline*/) override {
+            Log(TEXT("GraphicsPipeline"), 0U);
+        }
+        void RHISetComputePipeline(FRhiPipeline* /*pipeline*/) override {
+            Log(TEXT("ComputePipeline"), 0U);
+        }
+        void RHISetPrimitiveTopology(ERhiPrimitiveTopology /*topology*/) override {
+            Log(TEXT("Topology"), 0U);
+        }
+        void RHISetVertexBuffer(u32 slot, const FRhiVertexBufferView& /*view*/) override {
+            Log(TEXT("VertexBuffer"), slot);
+        }
+        void RHISetIndexBuffer(const FRhiIndexBufferView& /*view*/) override {
+            Log(TEXT("IndexBuffer"), 0U);
+        }
+        void RHISetViewport(const FRhiViewportRect& /*viewport*/) override {
+            Log(TEXT("Viewport"), 0U);
+        }
+        void RHISetScissor(const FRhiScissorRect& /*scissor*/) override {
+            Log(TEXT("Scissor"), 0U);
+        }
+        void RHISetRenderTargets(u32 colorTargetCount, FRhiTexture* const* colorTargets,
+            FRhiTexture* /*depthTarget*/) override {
+            u32 nonNull = 0U;
+            for (u32 index = 0U; index < colorTargetCount; ++index) {
+                nonNull += (colorTargets[index] != nullptr) ? 1U : 0U;
+            }
+            Log(TEXT("RenderTargets"), nonNull);
+        }
+        void RHIBeginRenderPass(const FRhiRenderPassDesc& /*desc*/) override {
+            Log(TEXT("BeginRenderPass"), 0U);
+        }
+        void RHIEndRenderPass() override { Log(TEXT("EndRenderPass"), 0U); }
+        void RHIBeginTransition(const FRhiTransitionCreateInfo& /*info*/) override {
+            Log(TEXT("BeginTransition"), 0U);
+        }
+        void RHIEndTransition(const FRhiTransitionCreateInfo& /*info*/) override {
+            Log(TEXT("EndTransition"), 0U);
+        }
+        void RHIClearColor(FRhiTexture* /*colorTarget*/, const FRhiClearColor& /*color*/) override {
+            Log(TEXT("Clear"), 0U);
+        }
+        void RHISetBindGroup(u32 setIndex, FRhiBindGroup* /*group*/, const u32* dynamicOffsets,
+            u32 dynamicOffsetCount) override {
+            Log(TEXT("BindGroup"), setIndex);
+            for (u32 index = 0U; index < dynamicOffsetCount; ++index) {
+                mDynamicOffsets.PushBack(dynamicOffsets[index]);
+            }
+        }
+        void RHIDraw(u32 vertexCount, u32 /*instanceCount*/, u32 /*firstVertex*/,
+            u32 /*firstInstance*/) override {
+            Log(TEXT("Draw"), vertexCount);
+        }
+        void RHIDrawIndexed(u32 indexCount, u32 /*instanceCount*/, u32 /*firstIndex*/,
+            i32 /*vertexOffset*/, u32 /*firstInstance*/) override {
+            Log(TEXT("DrawIndexed"), indexCount);
+        }
+        void RHIDispatch(u32 groupCountX, u32 /*groupCountY*/, u32 /*groupCountZ*/) override {
+            Log(TEXT("Dispatch"), groupCountX);
+        }
+        void RHIPushDebugMarker(FStringView text) override {
+            FString call(TEXT("Push:"));
+            call.Append(text);
+            mCalls.PushBack(call);
+        }
+        void RHIPopDebugMarker() override { Log(TEXT("Pop"), 0U); }
+
+    private:
+        void Log(const AltinaEngine::TChar* name, u32 value) {
+            FString call(name);
+            call.Append(TEXT(":"));
+            call.AppendNumber(value);
+            mCalls.PushBack(call);
+        }
+    };
+
+    void RecordSample(FRhiCmdContext& ctx) {
+        FRhiTexture* targets[2] = { reinterpret_cast<FRhiTexture*>(0x10), nullptr };
+        ctx.RHISetRenderTargets(2U, targets, nullptr);
+        targets[0] = nullptr; // the recorded command keeps its own copy
+
+        u32 offsets[5] = { 256U, 512U, 768U, 1024U, 1280U };
+        ctx.RHISetBindGroup(1U, nullptr, offsets, 1U);
+        ctx.RHISetBindGroup(2U, nullptr, offsets, 5U);
+        offsets[0] = 0U;
+
+        u8 bytes[4] = { 1U, 2U, 3U, 4U };
+        ctx.RHIUpdateDynamicBufferDiscard(nullptr, bytes, 4ULL, 64ULL);
+        bytes[0] = 9U;
+
+        ctx.RHIPushDebugMarker(TEXT("Chunk"));
+        ctx.RHISetGraphicsPipeline(nullptr);
+        ctx.RHIDrawIndexed(36U, 1U, 0U, 0, 0U);
+        ctx.RHIDispatch(7U, 1U, 1U);
+        ctx.RHIPopDebugMarker();
+    }
+} // namespace
+
+TEST_CASE("Rhi.CmdListContext.ReplaysRecordedCalls") {
+    FCallLogCmdContext direct;
+    RecordSample(direct);
+
+    FRhiCmdList        list;
+    FRhiCmdListContext recorder(list);
+    RecordSample(recorder);
+    REQUIRE_EQ(list.GetCommandCount(), static_cast<u32>(direct.mCalls.Size()));
+
+    // Replay after the caller's arrays changed: the list must hold the recorded values.
+    FCallLogCmdContext replayed;
+    FRhiCmdExecutor::Execute(list, replayed);
+
+    REQUIRE_EQ(replayed.mCalls.Size(), direct.mCalls.Size());
+    for (AltinaEngine::usize index = 0U; index < direct.mCalls.Size(); ++index) {
+        REQUIRE(replayed.mCalls[index] == direct.mCalls[index]);
+    }
+    REQUIRE(replayed.mCalls[0] == FString(TEXT("RenderTargets:1")));
+
+    REQUIRE_EQ(replayed.mDynamicOffsets.Size(), 6U);
+    REQUIRE_EQ(replayed.mDynamicOffsets[0], 256U);
+    REQUIRE_EQ(replayed.mDynamicOffsets[1], 256U);
+    REQUIRE_EQ(replayed.mDynamicOffsets[5], 1280U);
+
+    REQUIRE_EQ(replayed.mUploadedBytes.Size(), 4U);
+    REQUIRE_EQ(replayed.mUploadedBytes[0], static_cast<u8>(1U));
+    REQUIRE_EQ(replayed.mUploadedBytes[3], static_cast<u8>(4U));
+}
@@ -3,6 +3,7 @@
 #include "RhiMock/RhiMockContext.h"
 #include "Rhi/RhiDevice.h"
 #include "Rhi/RhiBuffer.h"
+#include "Rhi/RhiCommandContext.h"
 #include "Rhi/RhiTexture.h"
 #include "Rhi/RhiFence.h"
 #include "Rhi/RhiQueue.h"
@@ -23,8 +24,12 @@ namespace {
     using AltinaEngine::Rhi::FRhiAdapterDesc;
     using AltinaEngine::Rhi::FRhiBufferDesc;
     using AltinaEngine::Rhi::FRhiBufferRef;
+    using AltinaEngine::Rhi::FRhiCommandContextDesc;
+    using AltinaEngine::Rhi::FRhiCommandContextSubmitInfo;
     using AltinaEngine::Rhi::FRhiInitDesc;
+    using AltinaEngine::Rhi::FRhiMockAdapterConfig;
     using AltinaEngine::Rhi::FRhiMockContext;
+    using AltinaEngine::Rhi::FRhiMockSubmissionLog;
     using AltinaEngine::Rhi::FRhiQueueSignal;
     using AltinaEngine::Rhi::FRhiQueueWait;
     using AltinaEngine::Rhi::FRhiSubmitInfo;
@@ -169,6 +174,86 @@ TEST_CASE("RhiMock.SubmitPropagatesSyncValues") {
     REQUIRE_EQ(fence->GetCompletedValue(), 7ULL);
 }
 
+TEST_CASE("RhiMock.SubmissionLogOrdersThroughSemaphores") {
+    FRhiMockContext       context;
+    FRhiMockAdapterConfig config{};
+    config.mDesc = MakeAdapterDesc(
+        TEXT("Mock Discrete"), ERhiAdapterType::Discrete, ERhiVendorId::Nvidia, 2ULL << 30);
+    config.mSupportsAsyncCompute = true;
+    context.AddAdapter(config);
+
+    REQUIRE(context.Init(FRhiInitDesc{}));
+    auto device = context.CreateDevice(0);
+    REQUIRE(device);
+    REQUIRE(device->GetQueueCapabilities().mSupportsAsyncCompute);
+    REQUIRE(!device->GetQueueCapabilities().mSupportsAsyncCopy);
+
+    FRhiCommandContextDesc graphicsDesc{};
+    graphicsDesc.mQueueType = ERhiQueueType::Graphics;
+    FRhiCommandContextDesc computeDesc{};
+    computeDesc.mQueueType = ERhiQueueType::Compute;
+    auto graphics          = device->CreateCommandContext(graphicsDesc);
+    auto compute           = device->CreateCommandContext(computeDesc);
+    auto timeline          = device->CreateSemaphore(true, 0ULL);
+    REQUIRE(graphics);
+    REQUIRE(compute);
+
+    FRhiQueueSignal signal{};
+    signal.mSemaphore = timeline.Get();
+    signal.mValue     = 1ULL;
+    FRhiQueueWait wait{};
+    wait.mSemaphore = timeline.Get();
+    wait.mValue     = 1ULL;
+
+    // Producer (graphics) -> Consumer (compute, waits); Unrelated runs on graphics afterwards.
+    graphics->RHIPushDebugMarker(TEXT("Producer"));
+    graphics->RHIPopDebugMarker();
+    FRhiCommandContextSubmitInfo signalSubmit{};
+    signalSubmit.mSignals     = &signal;
+    signalSubmit.mSignalCount = 1U;
+    graphics->RHIFlushContextDevice(signalSubmit);
+
+    compute->RHIPushDebugMarker(TEXT("Consumer"));
+    compute->RHIPopDebugMarker();
+    FRhiCommandContextSubmitInfo waitSubmit{};
+    waitSubmit.mWaits     = &wait;
+    waitSubmit.mWaitCount = 1U;
+    compute->RHIFlushContextDevice(waitSubmit);
+
+    graphics->RHIPushDebugMarker(TEXT("Unrelated"));
+    graphics->RHIPopDebugMarker();
+    graphics->RHIFlushContextDevice({});
+
+    // A wait nothing signals.
+    FRhiQueueWait stale{};
+    stale.mSemaphore = timeline.Get();
+    stale.mValue     = 9ULL;
+    FRhiCommandContextSubmitInfo staleSubmit{};
+    staleSubmit.mWaits     = &stale;
+    staleSubmit.mWaitCount = 1U;
+    compute->RHIFlushContextDevice(staleSubmit);
+
+    auto&     log       = context.GetSubmissionLog();
+    const u32 producer  = log.FindSubmission(TEXT("Producer"));
+    const u32 consumer  = log.FindSubmission(TEXT("Consumer"));
+    const u32 unrelated = log.FindSubmission(TEXT("Unrelated"));
+    REQUIRE_EQ(log.GetSubmissions().Size(), 4U);
+    REQUIRE_EQ(producer, 0U);
+    REQUIRE_EQ(consumer, 1U);
+    REQUIRE_EQ(unrelated, 2U);
+    REQUIRE_EQ(log.FindSubmission(TEXT("Missing")), FRhiMockSubmissionLog::kInvalidIndex);
+
+    REQUIRE(log.IsOrderedBefore(producer, consumer));
+    REQUIRE(log.IsOrderedBefore(producer, unrelated));
+    REQUIRE(!log.IsOrderedBefore(consumer, unrelated));
+    REQUIRE(!log.IsOrderedBefore(unrelated, consumer));
+    REQUIRE(log.IsOrderedBefore(consumer, 3U));
+    REQUIRE_EQ(log.CountUnsatisfiedWaits(), 1U);
+
+    log.Clear();
+    REQUIRE(log.GetSubmissions().IsEmpty());
+}
+
 TEST_CASE("RhiMock.TextureDescValidation") {
     FRhiMockContext context;
     context.AddAdapter(MakeAdapterDesc(
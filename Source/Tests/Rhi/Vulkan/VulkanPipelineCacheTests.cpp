@@ -0,0 +1,93 @@
+#include "TestHarness.h"
+
+#include "RhiVulkan/RhiVulkanContext.h"
+#include "RhiVulkan/RhiVulkanDevice.h"
+
+#include "Platform/PlatformFileSystem.h"
+#include "Rhi/RhiDevice.h"
+#include "Rhi/RhiInit.h"
+#include "Rhi/RhiPipeline.h"
+#include "Rhi/RhiPipelineLayout.h"
+
+using AltinaEngine::Core::Container::FString;
+using AltinaEngine::Rhi::ERhiBackend;
+using AltinaEngine::Rhi::ERhiRasterCullMode;
+using AltinaEngine::Rhi::FRhiDevice;
+using AltinaEngine::Rhi::FRhiDeviceDesc;
+using AltinaEngine::Rhi::FRhiGraphicsPipelineDesc;
+using AltinaEngine::Rhi::FRhiInitDesc;
+using AltinaEngine::Rhi::FRhiPipelineLayoutDesc;
+using AltinaEngine::Rhi::FRhiVulkanContext;
+using AltinaEngine::Rhi::FRhiVulkanDevice;
+using AltinaEngine::Rhi::FRhiVulkanPipelineCacheStats;
+using AltinaEngine::Rhi::RHIExit;
+using AltinaEngine::Rhi::RHIInit;
+
+namespace {
+    auto MakeCacheDir() -> FString {
+        FString dir = AltinaEngine::Core::Platform::GetTempDirectory();
+        dir.Append(TEXT("/AltinaEngineTestsPipelineCache"));
+        return dir;
+    }
+
+    // Creates a device on `cacheDir`, runs `body` on it and tears it down again, which writes
+    // the cache file. Returns false when no Vulkan device is available.
+    template <typename TBody> auto WithDevice(const FString& cacheDir, TBody&& body) -> bool {
+        FRhiVulkanContext context;
+        FRhiInitDesc      init{};
+        init.mAppName.Assign(TEXT("AltinaEngineTestsRhiVulkan"));
+        init.mBackend          = ERhiBackend::Vulkan;
+        init.mEnableDebugNames = false;
+
+        FRhiDeviceDesc deviceDesc{};
+        deviceDesc.mPipelineCacheDir = cacheDir;
+
+        auto deviceShared = RHIInit(context, init, deviceDesc);
+        if (!deviceShared) {
+            RHIExit(context);
+            return false;
+        }
+        body(*static_cast<FRhiVulkanDevice*>(deviceShared.Get()));
+        deviceShared.Reset();
+        RHIExit(context);
+        return true;
+    }
+} // namespace
+
+TEST_CASE("Rhi.Vulkan.PipelineCache.DedupAndPersist") {
+    const FString cacheDir = MakeCacheDir();
+    AltinaEngine::Core::Platform::CreateDirectories(cacheDir);
+
+    FRhiVulkanPipelineCacheStats coldStats{};
+    const bool                   hasDevice = WithDevice(cacheDir, [&](FRhiVulkanDevice& device) {
+        auto layout = device.CreatePipelineLayout(FRhiPipelineLayoutDesc{});
+        REQUIRE(layout.Get() != nullptr);
+
+        FRhiGraphicsPipelineDesc desc{};
+        desc.mDebugName.Assign(TEXT("First"));
+        desc.mPipelineLayout = layout.Get();
+        auto first           = device.CreateGraphicsPipeline(desc);
+
+        desc.mDebugName.Assign(TEXT("SameStateOtherName"));
+        auto same = device.CreateGraphicsPipeline(desc);
+
+        desc.mRasterState.mCullMode = ERhiRasterCullMode::None;
+        auto other                  = device.CreateGraphicsPipeline(desc);
+
+        REQUIRE(first.Get() != nullptr);
+        REQUIRE(same.Get() == first.Get());
+        REQUIRE(other.Get() != first.Get());
+        coldStats = device.GetPipelineCacheStats();
+    });
+    if (!hasDevice) {
+        return;
+    }
+    REQUIRE_EQ(coldStats.DedupHits, 1U);
+
+    // The second device starts from the file the first one wrote.
+    FRhiVulkanPipelineCacheStats warmStats{};
+    REQUIRE(WithDevice(cacheDir,
+        [&](FRhiVulkanDevice& device) { warmStats = device.GetPipelineCacheStats(); }));
+    REQUIRE(warmStats.LoadedBytes > 0ULL);
+    REQUIRE_EQ(warmStats.DedupHits, 0U);
+}
@@ -15,6 +15,7 @@ namespace Test {
     struct Case {
         const char* name;
         TestFunc    func;
+        bool        benchmark;
     };
 
     inline std::vector<Case>& cases() {
@@ -26,7 +27,9 @@ namespace Test {
     inline int current_failures = 0;
 
     struct Registrar {
-        Registrar(const char* name, TestFunc f) { cases().push_back({ name, f }); }
+        Registrar(const char* name, TestFunc f, bool benchmark = false) {
+            cases().push_back({ name, f, benchmark });
+        }
     };
 
     inline int run_all() {
@@ -35,15 +38,26 @@ namespace Test {
         const char* start          = std::getenv("ALTINA_TEST_START");
         const char* stop           = std::getenv("ALTINA_TEST_STOP_AFTER");
         const char* list           = std::getenv("ALTINA_TEST_LIST");
+        // Benchmarks are opt-in: they only run (exclusively) when ALTINA_TEST_BENCH is set.
+        const char* bench          = std::getenv("ALTINA_TEST_BENCH");
+        const bool  benchMode      = (bench != nullptr) && (bench[0] != '\0');
         bool        started        = (start == nullptr) || (start[0] == '\0');
         if ((list != nullptr) && (list[0] != '\0')) {
             for (auto& c : cases()) {
-                std::cout << c.name << std::endl;
+                std::cout << c.name << (c.benchmark ? " [bench]" : "") << std::endl;
             }
             return 0;
         }
-        std::cout << "Running " << cases().size() << " test(s)" << std::endl;
+        std::size_t selected = 0;
+        for (auto& c : cases()) {
+            selected += (c.benchmark == benchMode) ? 1U : 0U;
+        }
+        std::cout << "Running " << selected << (benchMode ? " benchmark(s)" : " test(s)")
+                  << std::endl;
         for (auto& c : cases()) {
+            if (c.benchmark != benchMode) {
+                continue;
+            }
             if (!started) {
                 if (std::string_view(c.name).find(start) != std::string_view::npos) {
                     started = true;
@@ -97,6 +111,13 @@ namespace Test {
         name, &TEST_CONCAT(test_fn_, __LINE__));              \
     static void TEST_CONCAT(test_fn_, __LINE__)()
 
+// Timing-oriented cases. Skipped by the regular unit run; see AE_ENABLE_TEST_BENCHMARKS.
+#define BENCHMARK_CASE(name)                                  \
+    static void            TEST_CONCAT(test_fn_, __LINE__)(); \
+    static Test::Registrar TEST_CONCAT(test_reg_, __LINE__)(  \
+        name, &TEST_CONCAT(test_fn_, __LINE__), true);        \
+    static void TEST_CONCAT(test_fn_, __LINE__)()
+
 #define STATIC_REQUIRE(x) static_assert((x))
 
 #define REQUIRE(expr) Test::Require((expr), #expr, __FILE__, __LINE__)
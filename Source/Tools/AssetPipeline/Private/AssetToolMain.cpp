@@ -516,13 +516,6 @@ namespace AltinaEngine::Tools::AssetPipeline {
             std::vector<u8>   Data;
         };
 
-        void WriteBundleUuid(Asset::FBundleIndexEntry& entry, const FUuid& uuid) {
-            const auto& bytes = uuid.GetBytes();
-            for (usize index = 0; index < FUuid::kByteCount; ++index) {
-                entry.mUuid[index] = bytes[index];
-            }
-        }
-
         auto LoadRegistryAssets(const std::filesystem::path& registryPath,
             const std::filesystem::path& cookedRoot, std::vector<FBundledAsset>& outAssets)
             -> bool {
@@ -813,7 +806,8 @@ namespace AltinaEngine::Tools::AssetPipeline {
             std::cout << "  cook     --root <repoRoot> --platform <Platform> [--demo <DemoName>]";
             std::cout << " [--build-root <BuildRoot>] [--cook-root <CookRoot>]\n";
             std::cout << "  bundle   --root <repoRoot> --platform <Platform> [--demo <DemoName>]";
-            std::cout << " [--build-root <BuildRoot>] [--cook-root <CookRoot>]\n";
+            std::cout << " [--build-root <BuildRoot>] [--cook-root <CookRoot>]";
+            std::cout << " [--compression lz4|zstd|none] [--chunk-kb <KiB>]\n";
             std::cout << "  validate --registry <PathToAssetRegistry.json>\n";
             std::cout << "  clean    --root <repoRoot> [--build-root <BuildRoot>] --cache\n";
             std::cout << "  modelinfo --source <PathToModel> [--target-radius <R>]\n";
@@ -1606,6 +1600,35 @@ namespace AltinaEngine::Tools::AssetPipeline {
                     return left.UuidText < right.UuidText;
                 });
 
+            Asset::EBundleCompression compression = Asset::EBundleCompression::Lz4;
+            if (command.Options.contains("compression")) {
+                std::string value = command.Options.at("compression");
+                ToLowerAscii(value);
+                if (value == "none") {
+                    compression = Asset::EBundleCompression::None;
+                } else if (value == "zstd") {
+                    compression = Asset::EBundleCompression::Zstd;
+                } else if (value != "lz4") {
+                    std::cerr << "Invalid --compression: " << value << "\n";
+                    return 1;
+                }
+            }
+            u32  chunkSize = Asset::FAssetBundleWriter::kDefaultChunkSize;
+            auto chunkIt   = command.Options.find("chunk-kb");
+            if (chunkIt != command.Options.end()) {
+                unsigned long chunkKb = 0;
+                try {
+                    chunkKb = std::stoul(chunkIt->second);
+                } catch (...) {
+                    chunkKb = 0;
+                }
+                if (chunkKb == 0 || chunkKb > 65536) {
+                    std::cerr << "Invalid --chunk-kb.\n";
+                    return 1;
+                }
+                chunkSize = static_cast<u32>(chunkKb) * 1024U;
+            }
+
             const std::string bundleName = demoFilter.empty() ? std::string("All") : demoFilter;
             const std::filesystem::path bundlePath =
                 paths.CookedRoot / "Bundles" / (bundleName + ".pak");
@@ -1613,78 +1636,40 @@ namespace AltinaEngine::Tools::AssetPipeline {
             std::error_code ec;
             std::filesystem::create_directories(bundlePath.parent_path(), ec);
 
-            std::ofstream file(bundlePath, std::ios::binary);
-            if (!file) {
-                std::cerr << "Failed to open bundle for writing: " << bundlePath.string() << "\n";
-                return 1;
-            }
-
-            Asset::FBundleHeader header{};
-            header.mMagic   = Asset::kBundleMagic;
-            header.mVersion = Asset::kBundleVersion;
-
-            file.write(reinterpret_cast<const char*>(&header),
-                static_cast<std::streamsize>(sizeof(header)));
-
-            u64                                   offset = sizeof(header);
-            std::vector<Asset::FBundleIndexEntry> entries;
-            entries.reserve(assets.size());
-
+            Asset::FAssetBundleWriter writer(compression, chunkSize);
+            u64                       rawSize = 0;
             for (const auto& asset : assets) {
                 if (asset.Data.empty()) {
                     std::cerr << "Skipping empty asset: " << asset.CookedPath << "\n";
                     continue;
                 }
-
-                Asset::FBundleIndexEntry entry{};
-                WriteBundleUuid(entry, asset.Uuid);
-                entry.mType             = static_cast<u32>(asset.Type);
-                entry.mCompression      = static_cast<u32>(Asset::EBundleCompression::None);
-                entry.mOffset           = offset;
-                entry.mSize             = static_cast<u64>(asset.Data.size());
-                entry.mRawSize          = static_cast<u64>(asset.Data.size());
-                entry.mChunkCount       = 0;
-                entry.mChunkTableOffset = 0;
-
-                file.write(reinterpret_cast<const char*>(asset.Data.data()),
-                    static_cast<std::streamsize>(asset.Data.size()));
-                offset += entry.mSize;
-                entries.push_back(entry);
+                if (!writer.AddEntry(
+                        asset.Uuid, asset.Type, asset.Data.data(), asset.Data.size())) {
+                    std::cerr << "Failed to add asset to bundle: " << asset.CookedPath << "\n";
+                    return 1;
+                }
+                rawSize += static_cast<u64>(asset.Data.size());
             }
 
-            const u64                 indexOffset = offset;
-            Asset::FBundleIndexHeader indexHeader{};
-            indexHeader.mEntryCount      = static_cast<u32>(entries.size());
-            indexHeader.mStringTableSize = 0;
+            Container::TVector<u8> bundleBytes;
+            writer.Build(bundleBytes);
 
-            file.write(reinterpret_cast<const char*>(&indexHeader),
-                static_cast<std::streamsize>(sizeof(indexHeader)));
-
-            if (!entries.empty()) {
-                file.write(reinterpret_cast<const char*>(entries.data()),
-                    static_cast<std::streamsize>(
-                        entries.size() * sizeof(Asset::FBundleIndexEntry)));
+            std::ofstream file(bundlePath, std::ios::binary);
+            if (!file) {
+                std::cerr << "Failed to open bundle for writing: " << bundlePath.string() << "\n";
+                return 1;
             }
-
-            const u64 indexSize = sizeof(indexHeader)
-                + static_cast<u64>(entries.size()) * sizeof(Asset::FBundleIndexEntry);
-            const u64 bundleSize = indexOffset + indexSize;
-
-            header.mIndexOffset = indexOffset;
-            header.mIndexSize   = indexSize;
-            header.mBundleSize  = bundleSize;
-
-            file.seekp(0, std::ios::beg);
-            file.write(reinterpret_cast<const char*>(&header),
-                static_cast<std::streamsize>(sizeof(header)));
-
+            file.write(reinterpret_cast<const char*>(bundleBytes.Data()),
+                static_cast<std::streamsize>(bundleBytes.Size()));
             if (!file.good()) {
                 std::cerr << "Failed to write bundle: " << bundlePath.string() << "\n";
                 return 1;
             }
 
             std::cout << "Bundle: " << bundlePath.string() << "\n";
-            std::cout << "Bundle assets: " << entries.size() << "\n";
+            std::cout << "Bundle assets: " << writer.GetEntryCount() << "\n";
+            std::cout << "Bundle payload: " << writer.GetPayloadSize() << " / " << rawSize
+                      << " bytes\n";
             return 0;
         }
         auto ValidateRegistry(const std::filesystem::path& registryPath) -> int {